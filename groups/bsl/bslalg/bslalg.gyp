@@ -11,6 +11,7 @@
       'bslalg_bidirectionalnode.cpp',
       'bslalg_constructorproxy.cpp',
       'bslalg_containerbase.cpp',
+      'bslalg_daryheaputil.cpp',
       'bslalg_dequeimputil.cpp',
       'bslalg_dequeiterator.cpp',
       'bslalg_dequeprimitives.cpp',
@@ -21,6 +22,7 @@
       'bslalg_hashutil.cpp',
       'bslalg_hastrait.cpp',
       'bslalg_rangecompare.cpp',
+      'bslalg_rankedrbtreeutil.cpp',
       'bslalg_rbtreeanchor.cpp',
       'bslalg_rbtreenode.cpp',
       'bslalg_rbtreeutil.cpp',
@@ -50,6 +52,7 @@
       'bslalg_bidirectionalnode.t',
       'bslalg_constructorproxy.t',
       'bslalg_containerbase.t',
+      'bslalg_daryheaputil.t',
       'bslalg_dequeimputil.t',
       'bslalg_dequeiterator.t',
       'bslalg_dequeprimitives.t',
@@ -60,6 +63,7 @@
       'bslalg_hashutil.t',
       'bslalg_hastrait.t',
       'bslalg_rangecompare.t',
+      'bslalg_rankedrbtreeutil.t',
       'bslalg_rbtreeanchor.t',
       'bslalg_rbtreenode.t',
       'bslalg_rbtreeutil.t',
@@ -89,6 +93,7 @@
       '<(PRODUCT_DIR)/bslalg_bidirectionalnode.t',
       '<(PRODUCT_DIR)/bslalg_constructorproxy.t',
       '<(PRODUCT_DIR)/bslalg_containerbase.t',
+      '<(PRODUCT_DIR)/bslalg_daryheaputil.t',
       '<(PRODUCT_DIR)/bslalg_dequeimputil.t',
       '<(PRODUCT_DIR)/bslalg_dequeiterator.t',
       '<(PRODUCT_DIR)/bslalg_dequeprimitives.t',
@@ -99,6 +104,7 @@
       '<(PRODUCT_DIR)/bslalg_hashutil.t',
       '<(PRODUCT_DIR)/bslalg_hastrait.t',
       '<(PRODUCT_DIR)/bslalg_rangecompare.t',
+      '<(PRODUCT_DIR)/bslalg_rankedrbtreeutil.t',
       '<(PRODUCT_DIR)/bslalg_rbtreeanchor.t',
       '<(PRODUCT_DIR)/bslalg_rbtreenode.t',
       '<(PRODUCT_DIR)/bslalg_rbtreeutil.t',
@@ -257,6 +263,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_containerbase.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_daryheaputil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_daryheaputil.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_dequeimputil.t',
       'type': 'executable',
@@ -337,6 +351,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_rangecompare.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_rankedrbtreeutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_rankedrbtreeutil.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_rbtreeanchor.t',
       'type': 'executable',
@@ -0,0 +1,971 @@
+// bslalg_daryheaputil.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLALG_DARYHEAPUTIL
+#define INCLUDED_BSLALG_DARYHEAPUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide algorithms on heaps whose nodes have 'ARITY' children.
+//
+//@CLASSES:
+//  bslalg::DAryHeapUtil: namespace for d-ary heap algorithms
+//
+//@SEE_ALSO: bslstl_priorityqueue, bslstl_addressablepriorityqueue
+//
+//@DESCRIPTION: This component provides a class template, 'DAryHeapUtil',
+// parameterized by an 'ARITY' of at least 2, providing a namespace for
+// algorithms that arrange, and maintain, the elements of a random-access
+// sequence as a d-ary heap: a complete tree of 'ARITY'-way branching, stored
+// level by level, in which no element is ordered (by a supplied comparator)
+// before any of its children.  The element at position 'i' of a heap has its
+// children at positions 'ARITY * i + 1' through 'ARITY * i + ARITY', and its
+// parent at position '(i - 1) / ARITY'.  The first element of a heap is
+// therefore an element not ordered before any other element (i.e., a largest
+// element if the comparator is 'native_std::less').  A 'DAryHeapUtil<2>' heap
+// is the binary heap maintained by the 'native_std::make_heap',
+// 'native_std::push_heap', and 'native_std::pop_heap' algorithms.
+//
+///Choosing an Arity
+///-----------------
+// A heap of N elements has a height of about 'log(N) / log(ARITY)' levels.
+// Restoring the heap property after an element is added at the back ("sifting
+// up") compares the element only with its ancestors, so a wider heap does
+// fewer comparisons and moves to add an element.  Restoring the heap property
+// after the first element is replaced ("sifting down") compares, at each
+// level, all of the children of a node, so that a wider heap does more
+// comparisons, but fewer moves, and, since the children of a node are
+// adjacent in memory, touches about as many cache lines as a binary heap.  An
+// arity of 4 is a good default, and is the one used by
+// 'bsl::dary_priority_queue': relative to a binary heap, it does as many
+// comparisons to remove an element (4 per level on half as many levels), and
+// half as many moves (and notifications to an observer).  Whether it is
+// faster than a binary heap depends on the relative costs of comparing and
+// moving elements, and should be measured.
+//
+///Observing the Movement of Elements
+///----------------------------------
+// Each algorithm moving elements has an overload taking an additional
+// 'observer' functor, which is called, as 'observer(element, position)', for
+// each element moved to a new position, once the element has reached that
+// position, and before it is moved again (an element may be reported at
+// several positions in turn), so that, whenever an algorithm returns or
+// throws, the last position reported for each element is its position.  This
+// allows an element to be located in a heap without searching for it (see
+// 'bslstl_addressablepriorityqueue'), for example by keeping its position in
+// an array indexed by an identifier held in the element.  The observer must
+// not throw.
+//
+///Moving Elements
+///---------------
+// The algorithms of this component never create copies of elements (which,
+// for allocator-aware types, might allocate memory from the default
+// allocator).  Elements of a bitwise moveable type (see
+// 'bslmf_isbitwisemoveable') are moved by copying their bytes: an element
+// being sifted is moved aside, leaving a "hole" that moves through the heap
+// as each element displaced by the sifting is moved into it, and the sifted
+// element is moved into the final hole, so that each level traversed costs a
+// single move.  Elements of other types are exchanged with
+// 'bslalg::SwapUtil::swap', at each level traversed.
+//
+///Exception Safety
+///----------------
+// If the comparator and the swapping of elements (of types that are not
+// bitwise moveable) do not throw, no algorithm of this component throws;
+// otherwise, the sequence on which an algorithm was called holds the same
+// elements, each reported to the observer (if any) at its position, but may
+// no longer be a heap, if an exception propagates from it.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Selecting the Smallest Values
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to keep the three smallest of a stream of values, without
+// sorting the stream.  We keep the smallest values seen so far in a 4-ary heap
+// of which the first element is the largest of them, so that each value of
+// the stream needs to be compared only with that element.
+//
+// First, we arrange the first three values of the stream as a heap:
+//..
+//  typedef bslalg::DAryHeapUtil<4> HeapUtil;
+//
+//  const int stream[]   = { 42, 17, 99, 8, 23, 16, 4, 15 };
+//  const int NUM_VALUES = sizeof stream / sizeof *stream;
+//
+//  int smallest[3] = { stream[0], stream[1], stream[2] };
+//  HeapUtil::makeHeap(smallest, smallest + 3, native_std::less<int>());
+//  assert(99 == smallest[0]);
+//..
+// Then, we replace the largest of the values kept with each smaller value of
+// the rest of the stream, restoring the heap property with 'siftDown':
+//..
+//  for (int i = 3; i < NUM_VALUES; ++i) {
+//      if (stream[i] < smallest[0]) {
+//          smallest[0] = stream[i];
+//          HeapUtil::siftDown(smallest,
+//                             smallest + 3,
+//                             0,
+//                             native_std::less<int>());
+//      }
+//  }
+//..
+// Finally, we remove the values kept from the heap, largest first, with
+// 'popHeap', which moves the first element of a heap to its back:
+//..
+//  HeapUtil::popHeap(smallest, smallest + 3, native_std::less<int>());
+//  assert(15 == smallest[2]);
+//  HeapUtil::popHeap(smallest, smallest + 2, native_std::less<int>());
+//  assert( 8 == smallest[1]);
+//  assert( 4 == smallest[0]);
+//..
+// Note that popping each element of a heap in turn sorts the sequence.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_METAINT
+#include <bslmf_metaint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>  // 'memcpy'
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                      // ================================
+                      // struct DAryHeapUtil_NullObserver
+                      // ================================
+
+struct DAryHeapUtil_NullObserver {
+    // This 'struct' provides an observer of the movement of elements in a
+    // heap that does nothing.
+
+    // ACCESSORS
+    template <class VALUE>
+    void operator()(const VALUE&, native_std::size_t) const;
+        // Do nothing.
+};
+
+                          // =======================
+                          // class DAryHeapUtil_Hole
+                          // =======================
+
+template <class VALUE, class OBSERVER>
+class DAryHeapUtil_Hole {
+    // This proctor class moves aside an element of a bitwise moveable
+    // (template parameter) type 'VALUE', leaving a "hole" in a sequence that
+    // can be moved by moving other elements of the sequence into it, and, on
+    // destruction, moves the element back into the hole, wherever it is.
+    // Each element moved, including the element moved aside if it is moved
+    // back into another position, is reported to an observer of the
+    // (template parameter) type 'OBSERVER' at its new position.
+
+    // DATA
+    bsls::ObjectBuffer<VALUE>  d_value;       // element moved aside
+    VALUE                     *d_hole_p;      // address of the hole
+    native_std::size_t         d_position;    // position of the hole
+    native_std::size_t         d_start;       // initial position of the hole
+    OBSERVER                  *d_observer_p;  // observer (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    DAryHeapUtil_Hole(const DAryHeapUtil_Hole&);
+    DAryHeapUtil_Hole& operator=(const DAryHeapUtil_Hole&);
+
+  public:
+    // CREATORS
+    DAryHeapUtil_Hole(VALUE              *element,
+                      native_std::size_t  position,
+                      OBSERVER           *observer);
+        // Create a proctor moving aside the specified 'element' at the
+        // specified 'position', leaving a hole at its address, and reporting
+        // the elements it moves to the specified 'observer'.
+
+    ~DAryHeapUtil_Hole();
+        // Move the element held by this proctor into the hole, report it to
+        // the observer if the hole has moved, and destroy this proctor.
+
+    // MANIPULATORS
+    void fill(VALUE *element, native_std::size_t position);
+        // Move the specified 'element' into the hole, report it to the
+        // observer at the position of the hole, and leave a hole at the
+        // address of 'element', at the specified 'position'.
+
+    // ACCESSORS
+    native_std::size_t position() const;
+        // Return the position of the hole.
+
+    const VALUE& value() const;
+        // Return a reference providing non-modifiable access to the element
+        // held by this proctor.
+};
+
+                            // ===================
+                            // struct DAryHeapUtil
+                            // ===================
+
+template <int ARITY>
+struct DAryHeapUtil {
+    // This 'struct' provides a namespace for a suite of utility functions
+    // operating on a random-access sequence of elements arranged as a heap in
+    // which each element has (at most) the (template parameter) 'ARITY'
+    // children.  Each function takes a 'comparator', a functor such that
+    // 'comparator(a, b)' returns 'true' if 'a' is ordered before 'b', which
+    // must provide a strict weak ordering of the elements.  Each function
+    // taking an 'observer' calls 'observer(element, position)' for each
+    // element moved to a new position (see {Observing the Movement of
+    // Elements}).
+
+    BSLMF_ASSERT(2 <= ARITY);
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+    static native_std::size_t privateSiftDown(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  length,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<1>  *);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+    static native_std::size_t privateSiftDown(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  length,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<0>  *);
+        // Sift down the specified 'element' at the specified 'position' of
+        // the sequence of the specified 'length' elements starting at the
+        // specified 'first', as described in 'siftDown', and return its final
+        // position.  The last argument is for overloading resolution only: it
+        // is of type 'bslmf::MetaInt<1> *' if 'VALUE' is bitwise moveable,
+        // so that elements are moved through a hole, and of type
+        // 'bslmf::MetaInt<0> *' otherwise, so that elements are swapped.
+
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+    static native_std::size_t privateSiftUp(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<1>  *);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+    static native_std::size_t privateSiftUp(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<0>  *);
+        // Sift up the specified 'element' at the specified 'position' of the
+        // sequence starting at the specified 'first', as described in
+        // 'siftUp', and return its final position.  The last argument is for
+        // overloading resolution only, as for 'privateSiftDown'.
+
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+    static native_std::size_t dispatchSiftDown(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  length,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+    static native_std::size_t dispatchSiftUp(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element);
+        // Call the 'privateSiftDown' or 'privateSiftUp' overload,
+        // respectively, appropriate to the 'VALUE' type of the specified
+        // 'element', passing the other arguments, and return the result.
+
+  public:
+    // CLASS METHODS
+    static native_std::size_t parent(native_std::size_t position);
+        // Return the position of the parent of the element at the specified
+        // 'position' in a heap.  The behavior is undefined unless
+        // '0 < position'.
+
+    static native_std::size_t firstChild(native_std::size_t position);
+        // Return the position of the first child of the element at the
+        // specified 'position' in a heap.  Note that the element has no
+        // children if the returned value is not less than the length of the
+        // heap.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static bool isHeap(RANDOM_ITER       first,
+                       RANDOM_ITER       last,
+                       const COMPARATOR& comparator);
+        // Return 'true' if the sequence of elements starting at the specified
+        // 'first' and ending immediately before the specified 'last' is a heap
+        // according to the specified 'comparator', and 'false' otherwise.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void makeHeap(RANDOM_ITER       first,
+                         RANDOM_ITER       last,
+                         const COMPARATOR& comparator);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+    static void makeHeap(RANDOM_ITER       first,
+                         RANDOM_ITER       last,
+                         const COMPARATOR& comparator,
+                         OBSERVER&         observer);
+        // Rearrange the sequence of elements starting at the specified 'first'
+        // and ending immediately before the specified 'last' into a heap
+        // according to the specified 'comparator'.  Optionally specify an
+        // 'observer' to be notified of each element moved.  This operation
+        // takes O[N] operations, where N is the length of the sequence.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void pushHeap(RANDOM_ITER       first,
+                         RANDOM_ITER       last,
+                         const COMPARATOR& comparator);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+    static void pushHeap(RANDOM_ITER       first,
+                         RANDOM_ITER       last,
+                         const COMPARATOR& comparator,
+                         OBSERVER&         observer);
+        // Add the last element of the sequence of elements starting at the
+        // specified 'first' and ending immediately before the specified 'last'
+        // to the heap formed by the preceding elements, according to the
+        // specified 'comparator'.  Optionally specify an 'observer' to be
+        // notified of each element moved.  This operation takes
+        // O[log(N) / log(ARITY)] operations, where N is the length of the
+        // sequence.  The behavior is undefined unless 'first < last', and the
+        // elements preceding the last element form a heap.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void popHeap(RANDOM_ITER       first,
+                        RANDOM_ITER       last,
+                        const COMPARATOR& comparator);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+    static void popHeap(RANDOM_ITER       first,
+                        RANDOM_ITER       last,
+                        const COMPARATOR& comparator,
+                        OBSERVER&         observer);
+        // Exchange the first element of the heap starting at the specified
+        // 'first' and ending immediately before the specified 'last' with its
+        // last element, and rearrange the elements preceding the last element
+        // into a heap according to the specified 'comparator'.  Optionally
+        // specify an 'observer' to be notified of each element moved.  This
+        // operation takes O[ARITY * log(N) / log(ARITY)] operations, where N
+        // is the length of the heap.  The behavior is undefined unless
+        // 'first < last', and the sequence is a heap.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static native_std::size_t siftDown(RANDOM_ITER        first,
+                                       RANDOM_ITER        last,
+                                       native_std::size_t position,
+                                       const COMPARATOR&  comparator);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+    static native_std::size_t siftDown(RANDOM_ITER        first,
+                                       RANDOM_ITER        last,
+                                       native_std::size_t position,
+                                       const COMPARATOR&  comparator,
+                                       OBSERVER&          observer);
+        // Move the element at the specified 'position' of the sequence of
+        // elements starting at the specified 'first' and ending immediately
+        // before the specified 'last' towards the back of the sequence,
+        // exchanging it with its greatest child, according to the specified
+        // 'comparator', while it is ordered before that child, and return its
+        // final position.  Optionally specify an 'observer' to be notified of
+        // each element moved.  This operation takes
+        // O[ARITY * log(N) / log(ARITY)] operations, where N is the length of
+        // the sequence.  The behavior is undefined unless
+        // 'position < last - first', and the subtrees rooted at each of the
+        // children of the element are heaps.  Note that the subtree rooted at
+        // 'position' is a heap on return.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static native_std::size_t siftUp(RANDOM_ITER        first,
+                                     native_std::size_t position,
+                                     const COMPARATOR&  comparator);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+    static native_std::size_t siftUp(RANDOM_ITER        first,
+                                     native_std::size_t position,
+                                     const COMPARATOR&  comparator,
+                                     OBSERVER&          observer);
+        // Move the element at the specified 'position' of the sequence of
+        // elements starting at the specified 'first' towards the front of the
+        // sequence, exchanging it with its parent while the parent is ordered
+        // before it according to the specified 'comparator', and return its
+        // final position.  Optionally specify an 'observer' to be notified of
+        // each element moved.  This operation takes O[log(N) / log(ARITY)]
+        // operations, where N is 'position + 1'.  The behavior is undefined
+        // unless the elements preceding 'position' form a heap, and each
+        // ancestor of the element is ordered before none of the descendants
+        // of the element.  Note that the sequence ending at 'position' is a
+        // heap on return.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static native_std::size_t update(RANDOM_ITER        first,
+                                     RANDOM_ITER        last,
+                                     native_std::size_t position,
+                                     const COMPARATOR&  comparator);
+    template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+    static native_std::size_t update(RANDOM_ITER        first,
+                                     RANDOM_ITER        last,
+                                     native_std::size_t position,
+                                     const COMPARATOR&  comparator,
+                                     OBSERVER&          observer);
+        // Restore the heap property of the sequence of elements starting at
+        // the specified 'first' and ending immediately before the specified
+        // 'last', which was a heap before the element at the specified
+        // 'position' changed, by sifting that element up or down according
+        // to the specified 'comparator', and return its final position.
+        // Optionally specify an 'observer' to be notified of each element
+        // moved.  This operation takes O[ARITY * log(N) / log(ARITY)]
+        // operations, where N is the length of the sequence.  The behavior is
+        // undefined unless 'position < last - first', and the sequence would
+        // be a heap but for the element at 'position'.
+};
+
+// ============================================================================
+//                      TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // struct DAryHeapUtil_NullObserver
+                      // --------------------------------
+
+// ACCESSORS
+template <class VALUE>
+inline
+void DAryHeapUtil_NullObserver::operator()(const VALUE&,
+                                           native_std::size_t) const
+{
+}
+
+                          // -----------------------
+                          // class DAryHeapUtil_Hole
+                          // -----------------------
+
+// CREATORS
+template <class VALUE, class OBSERVER>
+inline
+DAryHeapUtil_Hole<VALUE, OBSERVER>::DAryHeapUtil_Hole(
+                                                  VALUE              *element,
+                                                  native_std::size_t  position,
+                                                  OBSERVER           *observer)
+: d_hole_p(element)
+, d_position(position)
+, d_start(position)
+, d_observer_p(observer)
+{
+    native_std::memcpy(d_value.buffer(),
+                       static_cast<const void *>(element),
+                       sizeof(VALUE));
+}
+
+template <class VALUE, class OBSERVER>
+inline
+DAryHeapUtil_Hole<VALUE, OBSERVER>::~DAryHeapUtil_Hole()
+{
+    native_std::memcpy(static_cast<void *>(d_hole_p),
+                       d_value.buffer(),
+                       sizeof(VALUE));
+    if (d_position != d_start) {
+        (*d_observer_p)(*d_hole_p, d_position);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE, class OBSERVER>
+inline
+void DAryHeapUtil_Hole<VALUE, OBSERVER>::fill(VALUE              *element,
+                                              native_std::size_t  position)
+{
+    native_std::memcpy(static_cast<void *>(d_hole_p),
+                       static_cast<const void *>(element),
+                       sizeof(VALUE));
+    (*d_observer_p)(*d_hole_p, d_position);
+    d_hole_p   = element;
+    d_position = position;
+}
+
+// ACCESSORS
+template <class VALUE, class OBSERVER>
+inline
+native_std::size_t DAryHeapUtil_Hole<VALUE, OBSERVER>::position() const
+{
+    return d_position;
+}
+
+template <class VALUE, class OBSERVER>
+inline
+const VALUE& DAryHeapUtil_Hole<VALUE, OBSERVER>::value() const
+{
+    return d_value.object();
+}
+
+                            // -------------------
+                            // struct DAryHeapUtil
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+native_std::size_t DAryHeapUtil<ARITY>::privateSiftDown(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  length,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<1>  *)
+{
+    // Move the element aside, and move it back into the hole at its final
+    // position (or at the position reached, should 'comparator' throw) when
+    // 'hole' is destroyed.
+
+    DAryHeapUtil_Hole<VALUE, OBSERVER> hole(element, position, &observer);
+
+    while (true) {
+        native_std::size_t child = firstChild(position);
+        if (child >= length) {
+            break;
+        }
+
+        // Find the greatest child; all but the last node having children has
+        // 'ARITY' of them.
+
+        const native_std::size_t end = length - child > ARITY
+                                     ? child + ARITY
+                                     : length;
+        native_std::size_t greatest = child;
+        for (++child; child < end; ++child) {
+            if (comparator(first[greatest], first[child])) {
+                greatest = child;
+            }
+        }
+
+        if (!comparator(hole.value(), first[greatest])) {
+            break;
+        }
+        hole.fill(bsls::Util::addressOf(first[greatest]), greatest);
+        position = greatest;
+    }
+    return position;
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+native_std::size_t DAryHeapUtil<ARITY>::privateSiftDown(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  length,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<0>  *)
+{
+    (void)element;
+
+    while (true) {
+        native_std::size_t child = firstChild(position);
+        if (child >= length) {
+            break;
+        }
+
+        const native_std::size_t end = length - child > ARITY
+                                     ? child + ARITY
+                                     : length;
+        native_std::size_t greatest = child;
+        for (++child; child < end; ++child) {
+            if (comparator(first[greatest], first[child])) {
+                greatest = child;
+            }
+        }
+
+        if (!comparator(first[position], first[greatest])) {
+            break;
+        }
+        SwapUtil::swap(bsls::Util::addressOf(first[position]),
+                       bsls::Util::addressOf(first[greatest]));
+        observer(first[position], position);
+        observer(first[greatest], greatest);
+        position = greatest;
+    }
+    return position;
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+native_std::size_t DAryHeapUtil<ARITY>::privateSiftUp(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<1>  *)
+{
+    DAryHeapUtil_Hole<VALUE, OBSERVER> hole(element, position, &observer);
+
+    while (position) {
+        const native_std::size_t up = parent(position);
+        if (!comparator(first[up], hole.value())) {
+            break;
+        }
+        hole.fill(bsls::Util::addressOf(first[up]), up);
+        position = up;
+    }
+    return position;
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+native_std::size_t DAryHeapUtil<ARITY>::privateSiftUp(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element,
+                                            bslmf::MetaInt<0>  *)
+{
+    (void)element;
+
+    while (position) {
+        const native_std::size_t up = parent(position);
+        if (!comparator(first[up], first[position])) {
+            break;
+        }
+        SwapUtil::swap(bsls::Util::addressOf(first[up]),
+                       bsls::Util::addressOf(first[position]));
+        observer(first[position], position);
+        observer(first[up], up);
+        position = up;
+    }
+    return position;
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::dispatchSiftDown(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  length,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element)
+{
+    enum { k_IS_BITWISE_MOVEABLE = bslmf::IsBitwiseMoveable<VALUE>::value };
+
+    return privateSiftDown(first,
+                           length,
+                           position,
+                           comparator,
+                           observer,
+                           element,
+                           (bslmf::MetaInt<k_IS_BITWISE_MOVEABLE> *)0);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER, class VALUE>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::dispatchSiftUp(
+                                            RANDOM_ITER         first,
+                                            native_std::size_t  position,
+                                            const COMPARATOR&   comparator,
+                                            OBSERVER&           observer,
+                                            VALUE              *element)
+{
+    enum { k_IS_BITWISE_MOVEABLE = bslmf::IsBitwiseMoveable<VALUE>::value };
+
+    return privateSiftUp(first,
+                         position,
+                         comparator,
+                         observer,
+                         element,
+                         (bslmf::MetaInt<k_IS_BITWISE_MOVEABLE> *)0);
+}
+
+// CLASS METHODS
+template <int ARITY>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::parent(native_std::size_t position)
+{
+    BSLS_ASSERT_SAFE(0 < position);
+
+    return (position - 1) / ARITY;
+}
+
+template <int ARITY>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::firstChild(
+                                                   native_std::size_t position)
+{
+    return position * ARITY + 1;
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+bool DAryHeapUtil<ARITY>::isHeap(RANDOM_ITER       first,
+                                 RANDOM_ITER       last,
+                                 const COMPARATOR& comparator)
+{
+    const native_std::size_t length = last - first;
+
+    for (native_std::size_t i = 1; i < length; ++i) {
+        if (comparator(first[parent(i)], first[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void DAryHeapUtil<ARITY>::makeHeap(RANDOM_ITER       first,
+                                   RANDOM_ITER       last,
+                                   const COMPARATOR& comparator)
+{
+    DAryHeapUtil_NullObserver observer;
+    makeHeap(first, last, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+void DAryHeapUtil<ARITY>::makeHeap(RANDOM_ITER       first,
+                                   RANDOM_ITER       last,
+                                   const COMPARATOR& comparator,
+                                   OBSERVER&         observer)
+{
+    const native_std::size_t length = last - first;
+
+    if (length < 2) {
+        return;                                                       // RETURN
+    }
+
+    // Sift down each element having children, from the last to the first, so
+    // that the subtrees rooted at the children of each are already heaps.
+
+    native_std::size_t position = parent(length - 1) + 1;
+    while (position) {
+        --position;
+        siftDown(first, last, position, comparator, observer);
+    }
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void DAryHeapUtil<ARITY>::pushHeap(RANDOM_ITER       first,
+                                   RANDOM_ITER       last,
+                                   const COMPARATOR& comparator)
+{
+    BSLS_ASSERT_SAFE(first < last);
+
+    DAryHeapUtil_NullObserver observer;
+    siftUp(first, (last - first) - 1, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+inline
+void DAryHeapUtil<ARITY>::pushHeap(RANDOM_ITER       first,
+                                   RANDOM_ITER       last,
+                                   const COMPARATOR& comparator,
+                                   OBSERVER&         observer)
+{
+    BSLS_ASSERT_SAFE(first < last);
+
+    siftUp(first, (last - first) - 1, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void DAryHeapUtil<ARITY>::popHeap(RANDOM_ITER       first,
+                                  RANDOM_ITER       last,
+                                  const COMPARATOR& comparator)
+{
+    DAryHeapUtil_NullObserver observer;
+    popHeap(first, last, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+void DAryHeapUtil<ARITY>::popHeap(RANDOM_ITER       first,
+                                  RANDOM_ITER       last,
+                                  const COMPARATOR& comparator,
+                                  OBSERVER&         observer)
+{
+    BSLS_ASSERT_SAFE(first < last);
+
+    const native_std::size_t lastPosition = (last - first) - 1;
+
+    if (0 == lastPosition) {
+        return;                                                       // RETURN
+    }
+
+    SwapUtil::swap(bsls::Util::addressOf(first[0]),
+                   bsls::Util::addressOf(first[lastPosition]));
+    observer(first[lastPosition], lastPosition);
+    observer(first[0], 0);
+    siftDown(first, last - 1, 0, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::siftDown(
+                                           RANDOM_ITER        first,
+                                           RANDOM_ITER        last,
+                                           native_std::size_t position,
+                                           const COMPARATOR&  comparator)
+{
+    DAryHeapUtil_NullObserver observer;
+    return siftDown(first, last, position, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::siftDown(
+                                           RANDOM_ITER        first,
+                                           RANDOM_ITER        last,
+                                           native_std::size_t position,
+                                           const COMPARATOR&  comparator,
+                                           OBSERVER&          observer)
+{
+    const native_std::size_t length = last - first;
+
+    BSLS_ASSERT_SAFE(position < length);
+
+    return dispatchSiftDown(first,
+                            length,
+                            position,
+                            comparator,
+                            observer,
+                            bsls::Util::addressOf(first[position]));
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::siftUp(RANDOM_ITER        first,
+                                               native_std::size_t position,
+                                               const COMPARATOR&  comparator)
+{
+    DAryHeapUtil_NullObserver observer;
+    return siftUp(first, position, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::siftUp(RANDOM_ITER        first,
+                                               native_std::size_t position,
+                                               const COMPARATOR&  comparator,
+                                               OBSERVER&          observer)
+{
+    return dispatchSiftUp(first,
+                          position,
+                          comparator,
+                          observer,
+                          bsls::Util::addressOf(first[position]));
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+native_std::size_t DAryHeapUtil<ARITY>::update(RANDOM_ITER        first,
+                                               RANDOM_ITER        last,
+                                               native_std::size_t position,
+                                               const COMPARATOR&  comparator)
+{
+    DAryHeapUtil_NullObserver observer;
+    return update(first, last, position, comparator, observer);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR, class OBSERVER>
+native_std::size_t DAryHeapUtil<ARITY>::update(RANDOM_ITER        first,
+                                               RANDOM_ITER        last,
+                                               native_std::size_t position,
+                                               const COMPARATOR&  comparator,
+                                               OBSERVER&          observer)
+{
+    BSLS_ASSERT_SAFE(position < static_cast<native_std::size_t>(last - first));
+
+    if (position && comparator(first[parent(position)], first[position])) {
+        return siftUp(first, position, comparator, observer);         // RETURN
+    }
+    return siftDown(first, last, position, comparator, observer);
+}
+
+}  // close namespace bslalg
+}  // close namespace BloombergLP
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
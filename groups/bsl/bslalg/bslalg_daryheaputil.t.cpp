@@ -0,0 +1,1052 @@
+// bslalg_daryheaputil.t.cpp                                          -*-C++-*-
+#include <bslalg_daryheaputil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslalg;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility of static function templates
+// parameterized by the arity of the heap.  Each test case is run for several
+// arities.  'parent' and 'firstChild' are tested against each other and a
+// table.  'isHeap' is tested against a table of sequences.  The algorithms
+// moving elements are tested on many pseudo-random sequences of elements
+// having duplicate keys and a unique identifier, verifying that the result
+// is a heap holding the same elements, and, using an observer recording the
+// position of each identifier, that every element moved was reported at its
+// final position.
+//-----------------------------------------------------------------------------
+// struct DAryHeapUtil
+// [ 2] size_t parent(size_t position);
+// [ 2] size_t firstChild(size_t position);
+// [ 3] bool isHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+// [ 5] void makeHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+// [ 5] void makeHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&, OBS&);
+// [ 5] void pushHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+// [ 5] void pushHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&, OBS&);
+// [ 5] void popHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+// [ 5] void popHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&, OBS&);
+// [ 4] size_t siftDown(RANDOM_ITER, RANDOM_ITER, size_t, const COMP&);
+// [ 4] size_t siftDown(RANDOM_ITER, RANDOM_ITER, size_t, const C&, OBS&);
+// [ 4] size_t siftUp(RANDOM_ITER, size_t, const COMP&);
+// [ 4] size_t siftUp(RANDOM_ITER, size_t, const COMP&, OBS&);
+// [ 4] size_t update(RANDOM_ITER, RANDOM_ITER, size_t, const COMP&);
+// [ 4] size_t update(RANDOM_ITER, RANDOM_ITER, size_t, const C&, OBS&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+enum { k_MAX_LENGTH = 64 };  // maximum length of the sequences tested
+
+// ============================================================================
+//                         GLOBAL CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct Element {
+    // An element of a heap, having a key, by which elements are ordered, and
+    // an identifier unique within the sequence holding the element.  This
+    // type is bitwise moveable, so that the algorithms under test move it by
+    // copying its bytes.
+
+    int d_key;  // key ordering the element
+    int d_id;   // identifier of the element
+};
+
+namespace BloombergLP {
+namespace bslmf {
+
+template <>
+struct IsBitwiseMoveable<Element> : bsl::true_type {
+};
+
+}  // close namespace bslmf
+}  // close enterprise namespace
+
+class SwappedElement {
+    // An element of a heap, having the same members as 'Element', that is
+    // not bitwise moveable, so that the algorithms under test swap it.
+
+  public:
+    // PUBLIC DATA
+    int d_key;  // key ordering the element
+    int d_id;   // identifier of the element
+
+    // CREATORS
+    SwappedElement()
+    : d_key(0)
+    , d_id(0)
+    {
+    }
+
+    SwappedElement(const SwappedElement& original)
+    : d_key(original.d_key)
+    , d_id(original.d_id)
+    {
+    }
+
+    // MANIPULATORS
+    SwappedElement& operator=(const SwappedElement& rhs)
+    {
+        d_key = rhs.d_key;
+        d_id  = rhs.d_id;
+        return *this;
+    }
+};
+
+struct KeyLess {
+    // This 'struct' defines a comparator ordering elements by ascending
+    // keys.
+
+    template <class ELEMENT>
+    bool operator()(const ELEMENT& lhs, const ELEMENT& rhs) const
+    {
+        return lhs.d_key < rhs.d_key;
+    }
+};
+
+struct KeyGreater {
+    // This 'struct' defines a comparator ordering elements by descending
+    // keys.
+
+    template <class ELEMENT>
+    bool operator()(const ELEMENT& lhs, const ELEMENT& rhs) const
+    {
+        return lhs.d_key > rhs.d_key;
+    }
+};
+
+class ThrowingKeyLess {
+    // This class defines a comparator ordering elements by ascending keys
+    // that throws an 'int' once it has been called a given number of times.
+
+    // DATA
+    int *d_countdown_p;  // number of calls left before throwing
+
+  public:
+    // CREATORS
+    explicit ThrowingKeyLess(int *countdown)
+        // Create a comparator that throws when called once the specified
+        // 'countdown', decremented by each call, is 0.
+    : d_countdown_p(countdown)
+    {
+    }
+
+    // ACCESSORS
+    template <class ELEMENT>
+    bool operator()(const ELEMENT& lhs, const ELEMENT& rhs) const
+    {
+        if (0 == (*d_countdown_p)--) {
+            throw 0;
+        }
+        return lhs.d_key < rhs.d_key;
+    }
+};
+
+class PositionObserver {
+    // This class records, in an array indexed by the identifiers of elements,
+    // the position to which each element is reported to have moved, and
+    // counts the reports.
+
+    // DATA
+    int *d_positions_p;  // position of each element, indexed by identifier
+    int  d_numCalls;     // number of reports
+
+  public:
+    // CREATORS
+    explicit PositionObserver(int *positions)
+        // Create an observer recording positions in the specified
+        // 'positions' array.
+    : d_positions_p(positions)
+    , d_numCalls(0)
+    {
+    }
+
+    // MANIPULATORS
+    template <class ELEMENT>
+    void operator()(const ELEMENT& element, native_std::size_t position)
+        // Record that the specified 'element' is at the specified 'position'.
+    {
+        d_positions_p[element.d_id] = static_cast<int>(position);
+        ++d_numCalls;
+    }
+
+    // ACCESSORS
+    int numCalls() const
+        // Return the number of reports recorded by this observer.
+    {
+        return d_numCalls;
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+int nextRandom(unsigned *seed)
+    // Return a pseudo-random number in the range '[0 .. 32767]', advancing
+    // the specified 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>(*seed >> 16) & 0x7fff;
+}
+
+template <class ELEMENT>
+void fillRandom(ELEMENT *elements, int length, int numKeys, unsigned *seed)
+    // Set the keys of the specified 'length' leading 'elements' to
+    // pseudo-random values in the range '[0 .. numKeys)', generated from the
+    // specified 'seed', and their identifiers to their positions.
+{
+    for (int i = 0; i < length; ++i) {
+        elements[i].d_key = nextRandom(seed) % numKeys;
+        elements[i].d_id  = i;
+    }
+}
+
+template <class ELEMENT>
+void initPositions(int *positions, const ELEMENT *elements, int length)
+    // Set the entry of the specified 'positions' array for the identifier of
+    // each of the specified 'length' leading 'elements' to the position of
+    // the element.
+{
+    for (int i = 0; i < length; ++i) {
+        positions[elements[i].d_id] = i;
+    }
+}
+
+template <class ELEMENT>
+bool hasPositions(const int *positions, const ELEMENT *elements, int length)
+    // Return 'true' if the entry of the specified 'positions' array for the
+    // identifier of each of the specified 'length' leading 'elements' is the
+    // position of the element, and 'false' otherwise.
+{
+    for (int i = 0; i < length; ++i) {
+        if (positions[elements[i].d_id] != i) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class ELEMENT>
+void copyElements(ELEMENT *to, const ELEMENT *from, int length)
+    // Assign the specified 'length' leading elements of 'from' to those of
+    // the specified 'to'.
+{
+    for (int i = 0; i < length; ++i) {
+        to[i] = from[i];
+    }
+}
+
+template <class ELEMENT>
+bool isPermutation(const ELEMENT *lhs, const ELEMENT *rhs, int length)
+    // Return 'true' if the specified 'length' leading elements of 'lhs' are a
+    // permutation of those of 'rhs', having equal keys for equal identifiers,
+    // and 'false' otherwise.  The behavior is undefined unless the
+    // identifiers of 'rhs' are the positions of its elements.
+{
+    bool seen[k_MAX_LENGTH] = { false };
+    for (int i = 0; i < length; ++i) {
+        const int id = lhs[i].d_id;
+        if (id < 0 || id >= length || seen[id]
+         || lhs[i].d_key != rhs[id].d_key) {
+            return false;                                             // RETURN
+        }
+        seen[id] = true;
+    }
+    return true;
+}
+
+// ============================================================================
+//                       TEST DRIVER TEMPLATE
+// ----------------------------------------------------------------------------
+
+template <int ARITY, class ELEMENT = Element>
+struct TestDriver {
+    // This templatized 'struct' provides a namespace for testing the
+    // 'DAryHeapUtil' utility having the (template parameter) 'ARITY' on
+    // sequences of the (template parameter) 'ELEMENT' type.
+
+    // TYPES
+    typedef DAryHeapUtil<ARITY> Obj;
+
+    // TEST CASES
+    static void testCase5();
+        // Test 'makeHeap', 'pushHeap', and 'popHeap'.
+
+    static void testCase4();
+        // Test 'siftUp', 'siftDown', and 'update'.
+
+    static void testCase2();
+        // Test 'parent' and 'firstChild'.
+};
+
+template <int ARITY, class ELEMENT>
+void TestDriver<ARITY, ELEMENT>::testCase5()
+{
+    if (verbose) printf("\tARITY = %d\n", ARITY);
+
+    unsigned seed = 12345 + ARITY;
+
+    for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+        for (int trial = 0; trial < 8; ++trial) {
+            const int NUM_KEYS = trial % 2 ? length + 1 : 4;
+
+            ELEMENT original[k_MAX_LENGTH];
+            fillRandom(original, length, NUM_KEYS, &seed);
+
+            // 'makeHeap' with and without an observer.
+
+            ELEMENT heap[k_MAX_LENGTH];
+            int     positions[k_MAX_LENGTH];
+
+            copyElements(heap, original, length);
+            Obj::makeHeap(heap, heap + length, KeyLess());
+            ASSERTV(length, trial,
+                    Obj::isHeap(heap, heap + length, KeyLess()));
+            ASSERTV(length, trial, isPermutation(heap, original, length));
+
+            copyElements(heap, original, length);
+            initPositions(positions, heap, length);
+            PositionObserver observer(positions);
+            Obj::makeHeap(heap, heap + length, KeyGreater(), observer);
+            ASSERTV(length, trial,
+                    Obj::isHeap(heap, heap + length, KeyGreater()));
+            ASSERTV(length, trial, isPermutation(heap, original, length));
+            ASSERTV(length, trial, hasPositions(positions, heap, length));
+
+            // 'pushHeap' each element in turn.
+
+            copyElements(heap, original, length);
+            for (int i = 1; i <= length; ++i) {
+                Obj::pushHeap(heap, heap + i, KeyLess());
+                ASSERTV(length, trial, i,
+                        Obj::isHeap(heap, heap + i, KeyLess()));
+            }
+            ASSERTV(length, trial, isPermutation(heap, original, length));
+
+            copyElements(heap, original, length);
+            initPositions(positions, heap, length);
+            for (int i = 1; i <= length; ++i) {
+                Obj::pushHeap(heap, heap + i, KeyLess(), observer);
+                ASSERTV(length, trial, i,
+                        Obj::isHeap(heap, heap + i, KeyLess()));
+                ASSERTV(length, trial, i, hasPositions(positions, heap, i));
+            }
+
+            // 'popHeap' each element in turn, which sorts the sequence.
+
+            for (int i = length; i > 0; --i) {
+                Obj::popHeap(heap, heap + i, KeyLess(), observer);
+                ASSERTV(length, trial, i,
+                        Obj::isHeap(heap, heap + i - 1, KeyLess()));
+                ASSERTV(length, trial, i,
+                        hasPositions(positions, heap, length));
+            }
+            ASSERTV(length, trial, isPermutation(heap, original, length));
+            for (int i = 1; i < length; ++i) {
+                ASSERTV(length, trial, i, heap[i - 1].d_key <= heap[i].d_key);
+            }
+
+            Obj::makeHeap(heap, heap + length, KeyGreater());
+            for (int i = length; i > 0; --i) {
+                Obj::popHeap(heap, heap + i, KeyGreater());
+            }
+            for (int i = 1; i < length; ++i) {
+                ASSERTV(length, trial, i, heap[i - 1].d_key >= heap[i].d_key);
+            }
+        }
+    }
+
+    if (verbose) printf("\tNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        ELEMENT heap[2];
+        heap[0].d_key = 1;
+        heap[1].d_id  = 1;
+
+        ASSERT_SAFE_PASS(Obj::pushHeap(heap, heap + 1, KeyLess()));
+        ASSERT_SAFE_FAIL(Obj::pushHeap(heap, heap,     KeyLess()));
+        ASSERT_SAFE_PASS(Obj::popHeap( heap, heap + 1, KeyLess()));
+        ASSERT_SAFE_FAIL(Obj::popHeap( heap, heap,     KeyLess()));
+    }
+}
+
+template <int ARITY, class ELEMENT>
+void TestDriver<ARITY, ELEMENT>::testCase4()
+{
+    if (verbose) printf("\tARITY = %d\n", ARITY);
+
+    unsigned seed = 54321 + ARITY;
+
+    for (int length = 1; length <= k_MAX_LENGTH; ++length) {
+        for (int trial = 0; trial < 4; ++trial) {
+            const int NUM_KEYS = trial % 2 ? length + 1 : 3;
+
+            ELEMENT original[k_MAX_LENGTH];
+            fillRandom(original, length, NUM_KEYS, &seed);
+            Obj::makeHeap(original, original + length, KeyLess());
+
+            for (int pos = 0; pos < length; ++pos) {
+                const native_std::size_t POS = pos;
+
+                for (int newKey = -1; newKey <= NUM_KEYS; ++newKey) {
+                    ELEMENT heap[k_MAX_LENGTH];
+                    int     positions[k_MAX_LENGTH];
+                    ELEMENT expected[k_MAX_LENGTH];
+
+                    copyElements(heap, original, length);
+                    heap[pos].d_key = newKey;
+                    copyElements(expected, heap, length);
+                    for (int i = 0; i < length; ++i) {
+                        expected[heap[i].d_id] = heap[i];
+                    }
+                    const int ID = heap[pos].d_id;
+
+                    // 'update' with an observer
+
+                    initPositions(positions, heap, length);
+                    PositionObserver observer(positions);
+                    const native_std::size_t RESULT =
+                              Obj::update(heap, heap + length, pos, KeyLess(),
+                                          observer);
+
+                    ASSERTV(length, pos, newKey,
+                            Obj::isHeap(heap, heap + length, KeyLess()));
+                    ASSERTV(length, pos, newKey,
+                            isPermutation(heap, expected, length));
+                    ASSERTV(length, pos, newKey,
+                            hasPositions(positions, heap, length));
+                    ASSERTV(length, pos, newKey,
+                            ID == heap[RESULT].d_id);
+                    ASSERTV(length, pos, newKey, observer.numCalls(),
+                            (RESULT == POS) == (0 == observer.numCalls()));
+
+                    // 'update' without an observer
+
+                    copyElements(heap, original, length);
+                    heap[pos].d_key = newKey;
+                    ASSERTV(length, pos, newKey, RESULT ==
+                            Obj::update(heap, heap + length, pos, KeyLess()));
+                    ASSERTV(length, pos, newKey,
+                            Obj::isHeap(heap, heap + length, KeyLess()));
+
+                    // 'siftUp' after increasing, and 'siftDown' after
+                    // decreasing, a key.
+
+                    copyElements(heap, original, length);
+                    heap[pos].d_key = newKey;
+                    initPositions(positions, heap, length);
+                    native_std::size_t result;
+                    if (newKey >= original[pos].d_key) {
+                        result = Obj::siftUp(heap, pos, KeyLess(), observer);
+                        ASSERTV(length, pos, newKey,
+                                result <= POS);
+                    }
+                    else {
+                        result = Obj::siftDown(heap,
+                                               heap + length,
+                                               pos,
+                                               KeyLess(),
+                                               observer);
+                        ASSERTV(length, pos, newKey,
+                                result >= POS);
+                    }
+                    ASSERTV(length, pos, newKey, ID == heap[result].d_id);
+                    ASSERTV(length, pos, newKey,
+                            Obj::isHeap(heap, heap + length, KeyLess()));
+                    ASSERTV(length, pos, newKey,
+                            hasPositions(positions, heap, length));
+
+                    // An element greater than all others is sifted up to the
+                    // front, and one less than all others down to a leaf.
+
+                    copyElements(heap, original, length);
+                    heap[pos].d_key = NUM_KEYS;
+                    ASSERTV(length, pos,
+                            0 == Obj::siftUp(heap, pos, KeyLess()));
+                    ASSERTV(length, pos, ID == heap[0].d_id);
+
+                    copyElements(heap, original, length);
+                    heap[pos].d_key = -1;
+                    result = Obj::siftDown(heap,
+                                           heap + length,
+                                           pos,
+                                           KeyLess());
+                    ASSERTV(length, pos, ID == heap[result].d_id);
+                    ASSERTV(length, pos,
+                            Obj::firstChild(result)
+                                  >= static_cast<native_std::size_t>(length));
+
+#ifdef BDE_BUILD_TARGET_EXC
+                    // If the comparator throws, the sequence holds the same
+                    // elements, each reported at its position.
+
+                    for (int limit = 0; ; ++limit) {
+                        copyElements(heap, original, length);
+                        heap[pos].d_key = newKey;
+                        initPositions(positions, heap, length);
+
+                        int  countdown = limit;
+                        bool caught    = false;
+                        try {
+                            Obj::update(heap,
+                                        heap + length,
+                                        pos,
+                                        ThrowingKeyLess(&countdown),
+                                        observer);
+                        }
+                        catch (int) {
+                            caught = true;
+                        }
+                        ASSERTV(length, pos, newKey, limit,
+                                isPermutation(heap, expected, length));
+                        ASSERTV(length, pos, newKey, limit,
+                                hasPositions(positions, heap, length));
+                        if (!caught) {
+                            break;
+                        }
+                    }
+#endif
+                }
+            }
+        }
+    }
+
+    if (verbose) printf("\tNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        ELEMENT heap[2];
+        heap[0].d_key = 1;
+        heap[1].d_id  = 1;
+
+        ASSERT_SAFE_PASS(Obj::siftDown(heap, heap + 2, 1, KeyLess()));
+        ASSERT_SAFE_FAIL(Obj::siftDown(heap, heap + 2, 2, KeyLess()));
+        ASSERT_SAFE_PASS(Obj::update(  heap, heap + 2, 1, KeyLess()));
+        ASSERT_SAFE_FAIL(Obj::update(  heap, heap + 2, 2, KeyLess()));
+    }
+}
+
+template <int ARITY, class ELEMENT>
+void TestDriver<ARITY, ELEMENT>::testCase2()
+{
+    if (verbose) printf("\tARITY = %d\n", ARITY);
+
+    ASSERT(1 == Obj::firstChild(0));
+    ASSERT(ARITY + 1 == Obj::firstChild(1));
+    ASSERT(0 == Obj::parent(1));
+    ASSERT(0 == Obj::parent(ARITY));
+    ASSERT(1 == Obj::parent(ARITY + 1));
+
+    for (native_std::size_t pos = 1; pos < 1000; ++pos) {
+        const native_std::size_t PARENT = Obj::parent(pos);
+        const native_std::size_t FIRST  = Obj::firstChild(PARENT);
+
+        ASSERTV(pos, PARENT < pos);
+        ASSERTV(pos, FIRST <= pos);
+        ASSERTV(pos, pos < FIRST + ARITY);
+        ASSERTV(pos, (pos - 1) % ARITY == pos - FIRST);
+    }
+
+    if (verbose) printf("\tNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        ASSERT_SAFE_PASS(Obj::parent(1));
+        ASSERT_SAFE_FAIL(Obj::parent(0));
+    }
+}
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Selecting the Smallest Values
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to keep the three smallest of a stream of values, without
+// sorting the stream.  We keep the smallest values seen so far in a 4-ary heap
+// of which the first element is the largest of them, so that each value of
+// the stream needs to be compared only with that element.
+//
+// First, we arrange the first three values of the stream as a heap:
+//..
+    typedef bslalg::DAryHeapUtil<4> HeapUtil;
+
+    const int stream[]   = { 42, 17, 99, 8, 23, 16, 4, 15 };
+    const int NUM_VALUES = sizeof stream / sizeof *stream;
+
+    int smallest[3] = { stream[0], stream[1], stream[2] };
+    HeapUtil::makeHeap(smallest, smallest + 3, native_std::less<int>());
+    ASSERT(99 == smallest[0]);
+//..
+// Then, we replace the largest of the values kept with each smaller value of
+// the rest of the stream, restoring the heap property with 'siftDown':
+//..
+    for (int i = 3; i < NUM_VALUES; ++i) {
+        if (stream[i] < smallest[0]) {
+            smallest[0] = stream[i];
+            HeapUtil::siftDown(smallest,
+                               smallest + 3,
+                               0,
+                               native_std::less<int>());
+        }
+    }
+//..
+// Finally, we remove the values kept from the heap, largest first, with
+// 'popHeap', which moves the first element of a heap to its back:
+//..
+    HeapUtil::popHeap(smallest, smallest + 3, native_std::less<int>());
+    ASSERT(15 == smallest[2]);
+    HeapUtil::popHeap(smallest, smallest + 2, native_std::less<int>());
+    ASSERT( 8 == smallest[1]);
+    ASSERT( 4 == smallest[0]);
+//..
+// Note that popping each element of a heap in turn sorts the sequence.
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'makeHeap', 'pushHeap', AND 'popHeap'
+        //
+        // Concerns:
+        //: 1 'makeHeap' arranges any sequence, including an empty one, into a
+        //:   heap holding the same elements.
+        //:
+        //: 2 'pushHeap' adds the last element of a sequence to the heap formed
+        //:   by the preceding elements.
+        //:
+        //: 3 'popHeap' moves the first element of a heap to its back, and
+        //:   leaves the preceding elements a heap, so that popping each
+        //:   element in turn sorts the sequence.
+        //:
+        //: 4 Duplicate keys are supported.
+        //:
+        //: 5 Every element moved is reported to the observer at its final
+        //:   position.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, and 8, and for elements that are and are
+        //:   not bitwise moveable, for each length up to 64, generate
+        //:   pseudo-random sequences of elements having few or many distinct
+        //:   keys, and:
+        //:
+        //:   1 Call 'makeHeap', with both 'KeyLess' and 'KeyGreater', and
+        //:     verify the result is a heap and a permutation of the original
+        //:     sequence.  (C-1, 4)
+        //:
+        //:   2 Call 'pushHeap' on each prefix in turn, verifying each prefix
+        //:     is then a heap.  (C-2)
+        //:
+        //:   3 Call 'popHeap' on each prefix in turn, from the longest,
+        //:     verifying the remaining prefix is a heap, and finally that the
+        //:     sequence is sorted.  (C-3)
+        //:
+        //:   4 Where an observer is supplied, verify after each call that the
+        //:     position recorded for each element is its position.  (C-5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void makeHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+        //   void makeHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&, OBS&);
+        //   void pushHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+        //   void pushHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&, OBS&);
+        //   void popHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+        //   void popHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&, OBS&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'makeHeap', 'pushHeap', AND 'popHeap'"
+                            "\n=====================================\n");
+
+        if (verbose) printf("\nBitwise moveable elements.\n");
+
+        TestDriver<2>::testCase5();
+        TestDriver<3>::testCase5();
+        TestDriver<4>::testCase5();
+        TestDriver<8>::testCase5();
+
+        if (verbose) printf("\nElements that are not bitwise moveable.\n");
+
+        TestDriver<2, SwappedElement>::testCase5();
+        TestDriver<4, SwappedElement>::testCase5();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'siftUp', 'siftDown', AND 'update'
+        //
+        // Concerns:
+        //: 1 After the key of any element of a heap is changed, 'update'
+        //:   restores the heap property, and returns the final position of
+        //:   the element.
+        //:
+        //: 2 'siftUp' restores the heap property after a key is increased,
+        //:   and 'siftDown' after a key is decreased, each returning the final
+        //:   position of the element.
+        //:
+        //: 3 An element greater than all others is sifted up to the front, and
+        //:   an element less than all others is sifted down to a leaf.
+        //:
+        //: 4 Every element moved is reported to the observer at its final
+        //:   position, and the observer is not called if no element moves.
+        //:
+        //: 5 If the comparator throws, the sequence holds the same elements,
+        //:   and every element moved has been reported at its position.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, and 5, and for elements that are and are not
+        //:   bitwise moveable, for each length up to 64, generate
+        //:   pseudo-random heaps, and, for each position and each new key
+        //:   from one less than the least key to one more than the greatest,
+        //:   change the key of the element at that position, call 'update',
+        //:   'siftUp', or 'siftDown', and verify the result is a heap holding
+        //:   the same elements, the returned position, and the positions
+        //:   recorded by the observer.  (C-1..4)
+        //:
+        //: 2 For each such change of key, call 'update' with a comparator
+        //:   throwing after each number of calls in turn, and verify that the
+        //:   sequence holds the same elements and the positions recorded by
+        //:   the observer.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   size_t siftDown(RANDOM_ITER, RANDOM_ITER, size_t, const COMP&);
+        //   size_t siftDown(RANDOM_ITER, RANDOM_ITER, size_t, const C&, OBS&);
+        //   size_t siftUp(RANDOM_ITER, size_t, const COMP&);
+        //   size_t siftUp(RANDOM_ITER, size_t, const COMP&, OBS&);
+        //   size_t update(RANDOM_ITER, RANDOM_ITER, size_t, const COMP&);
+        //   size_t update(RANDOM_ITER, RANDOM_ITER, size_t, const C&, OBS&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'siftUp', 'siftDown', AND 'update'"
+                            "\n==================================\n");
+
+        if (verbose) printf("\nBitwise moveable elements.\n");
+
+        TestDriver<2>::testCase4();
+        TestDriver<3>::testCase4();
+        TestDriver<4>::testCase4();
+        TestDriver<5>::testCase4();
+
+        if (verbose) printf("\nElements that are not bitwise moveable.\n");
+
+        TestDriver<2, SwappedElement>::testCase4();
+        TestDriver<5, SwappedElement>::testCase4();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'isHeap'
+        //
+        // Concerns:
+        //: 1 'isHeap' returns 'true' for an empty sequence and a sequence of
+        //:   one element.
+        //:
+        //: 2 'isHeap' returns 'false' if, and only if, any element is ordered
+        //:   before one of its children according to the arity.
+        //:
+        //: 3 Equal elements do not violate the heap property.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, for a set of sequences of
+        //:   digits, verify the result of 'isHeap' for arities 2 and 3, with
+        //:   'native_std::less', and, on the reversed digits, with
+        //:   'native_std::greater'.  (C-1..3)
+        //
+        // Testing:
+        //   bool isHeap(RANDOM_ITER, RANDOM_ITER, const COMPARATOR&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'isHeap'"
+                            "\n========\n");
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_spec_p;   // sequence of digits
+            bool        d_binary;   // expected result for arity 2
+            bool        d_ternary;  // expected result for arity 3
+        } DATA[] = {
+            //LINE  SPEC      BINARY  TERNARY
+            //----  --------  ------  -------
+            { L_,   "",       true,   true    },
+            { L_,   "5",      true,   true    },
+            { L_,   "55",     true,   true    },
+            { L_,   "54",     true,   true    },
+            { L_,   "45",     false,  false   },
+            { L_,   "543",    true,   true    },
+            { L_,   "534",    true,   true    },
+            { L_,   "453",    false,  false   },
+            { L_,   "5432",   true,   true    },
+            { L_,   "5346",   false,  false   },
+            { L_,   "5143",   false,  true    },
+            { L_,   "5555",   true,   true    },
+            { L_,   "5155",   false,  true    },
+            { L_,   "54321",  true,   true    },
+            { L_,   "52341",  false,  true    },
+            { L_,   "53421",  true,   true    },
+            { L_,   "51234",  false,  false   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *SPEC    = DATA[ti].d_spec_p;
+            const bool  BINARY  = DATA[ti].d_binary;
+            const bool  TERNARY = DATA[ti].d_ternary;
+            const int   LENGTH  = static_cast<int>(strlen(SPEC));
+
+            int values[8];
+            int negated[8];
+            for (int i = 0; i < LENGTH; ++i) {
+                values[i]  = SPEC[i] - '0';
+                negated[i] = -values[i];
+            }
+
+            if (veryVerbose) { T_ P_(LINE) P(SPEC) }
+
+            native_std::less<int>    less;
+            native_std::greater<int> greater;
+
+            ASSERTV(LINE, BINARY  ==
+                    DAryHeapUtil<2>::isHeap(values, values + LENGTH, less));
+            ASSERTV(LINE, TERNARY ==
+                    DAryHeapUtil<3>::isHeap(values, values + LENGTH, less));
+            ASSERTV(LINE, BINARY  ==
+                    DAryHeapUtil<2>::isHeap(negated,
+                                            negated + LENGTH,
+                                            greater));
+            ASSERTV(LINE, TERNARY ==
+                    DAryHeapUtil<3>::isHeap(negated,
+                                            negated + LENGTH,
+                                            greater));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'parent' AND 'firstChild'
+        //
+        // Concerns:
+        //: 1 The children of the element at position 'i' are at the 'ARITY'
+        //:   positions starting at 'firstChild(i)', and 'parent' of each of
+        //:   them is 'i'.
+        //:
+        //: 2 The first element is the parent of the elements at positions 1
+        //:   through 'ARITY'.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, and 7, verify the results for the first
+        //:   positions explicitly, and, for each position up to 1000, that
+        //:   the position lies within the children of its parent.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   size_t parent(size_t position);
+        //   size_t firstChild(size_t position);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'parent' AND 'firstChild'"
+                            "\n=========================\n");
+
+        TestDriver<2>::testCase2();
+        TestDriver<3>::testCase2();
+        TestDriver<4>::testCase2();
+        TestDriver<7>::testCase2();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push descending and then ascending values onto a 4-ary heap,
+        //:   verifying the first element after each push, then pop every
+        //:   element, verifying that the sequence is sorted.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef DAryHeapUtil<4> Obj;
+
+        enum { NUM_VALUES = 20 };
+
+        native_std::less<int> less;
+        int                   values[NUM_VALUES];
+
+        for (int i = 0; i < NUM_VALUES / 2; ++i) {
+            values[i] = NUM_VALUES / 2 - i;
+            Obj::pushHeap(values, values + i + 1, less);
+            ASSERTV(i, NUM_VALUES / 2 == values[0]);
+        }
+        for (int i = NUM_VALUES / 2; i < NUM_VALUES; ++i) {
+            values[i] = i + 1;
+            Obj::pushHeap(values, values + i + 1, less);
+            ASSERTV(i, i + 1 == values[0]);
+        }
+        ASSERT(Obj::isHeap(values, values + NUM_VALUES, less));
+
+        for (int i = NUM_VALUES; i > 0; --i) {
+            Obj::popHeap(values, values + i, less);
+            ASSERTV(i, i == values[i - 1]);
+        }
+        ASSERT(!Obj::isHeap(values, values + NUM_VALUES, less));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
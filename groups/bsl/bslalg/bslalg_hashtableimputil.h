@@ -96,6 +96,20 @@ BSLS_IDENT("$Id: $")
 //:   'computeBucketIndex(HASHER(extractKey(link)' is the index of the bucket,
 //:   and no other nodes.
 //
+///Batched Lookup
+///--------------
+// Finding a key in a hash table larger than the processor caches typically
+// incurs two dependent cache misses: one to load the bucket, and one to load
+// the first node of the bucket.  Looking up a sequence of independent keys
+// one at a time therefore stalls on each of these misses in turn.
+// 'findBatch' looks up a group of keys (whose hash codes have already been
+// computed) in three passes: the first prefetches the bucket of each key, the
+// second prefetches the first node of each bucket, and the third compares
+// the keys, so that the misses of all the keys of the group are outstanding
+// at the same time.  The keys are processed in groups of 16, which suffice
+// to keep the memory system busy; larger groups gain little, and risk
+// evicting the prefetched lines before they are used.
+//
 ///'KEY_CONFIG' Template Parameter
 ///-------------------------------
 // Several of the operations provided by 'HashTableImpUtil' are template
@@ -542,6 +556,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_nativestd.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 #ifndef INCLUDED_BSLS_PLATFORM
 #include <bsls_platform.h>
 #endif
@@ -758,6 +776,26 @@ struct HashTableImpUtil {
         //                  const KEY_CONFIG::KeyType& key2)
         //..
 
+    template <class KEY_CONFIG, class KEY_EQUAL>
+    static void findBatch(
+                   BidirectionalLink                        **results,
+                   const HashTableAnchor&                     anchor,
+                   const typename KEY_CONFIG::KeyType *const *keys,
+                   const native_std::size_t                  *hashCodes,
+                   int                                        numKeys,
+                   const KEY_EQUAL&                           equalityFunctor);
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array the value that 'find' would return for the key
+        // referred to by the corresponding element of the specified 'keys'
+        // array, having the hash code at the corresponding position of the
+        // specified 'hashCodes' array, in the specified 'anchor', using the
+        // specified 'equalityFunctor' to compare keys.  Prefetch the buckets,
+        // then the first link of each bucket, of each group of keys before
+        // comparing any key of the group (see {Batched Lookup}).  The
+        // behavior is undefined unless '0 <= numKeys', each array has at least
+        // 'numKeys' elements, and the requirements of 'find' are met for each
+        // key.
+
     template <class KEY_CONFIG, class HASHER>
     static void rehash(HashTableAnchor   *newAnchor,
                        BidirectionalLink *elementList,
@@ -881,6 +919,59 @@ BidirectionalLink *HashTableImpUtil::find(
     return 0;
 }
 
+template <class KEY_CONFIG, class KEY_EQUAL>
+void HashTableImpUtil::findBatch(
+                   BidirectionalLink                        **results,
+                   const HashTableAnchor&                     anchor,
+                   const typename KEY_CONFIG::KeyType *const *keys,
+                   const native_std::size_t                  *hashCodes,
+                   int                                        numKeys,
+                   const KEY_EQUAL&                           equalityFunctor)
+{
+    BSLS_ASSERT_SAFE(results);
+    BSLS_ASSERT_SAFE(keys);
+    BSLS_ASSERT_SAFE(hashCodes);
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    enum { k_GROUP_SIZE = 16 };  // keys whose misses may be outstanding
+
+    for (int base = 0; base < numKeys; base += k_GROUP_SIZE) {
+        const int numInGroup = numKeys - base < k_GROUP_SIZE
+                             ? numKeys - base
+                             : k_GROUP_SIZE;
+
+        const HashTableBucket *buckets[k_GROUP_SIZE];
+
+        for (int i = 0; i < numInGroup; ++i) {
+            buckets[i] = findBucketForHashCode(anchor, hashCodes[base + i]);
+            bsls::PerformanceHint::prefetchForReading(buckets[i]);
+        }
+
+        for (int i = 0; i < numInGroup; ++i) {
+            if (buckets[i]->first()) {
+                bsls::PerformanceHint::prefetchForReading(
+                                                        buckets[i]->first());
+            }
+        }
+
+        for (int i = 0; i < numInGroup; ++i) {
+            const HashTableBucket& bucket = *buckets[i];
+            const int              index  = base + i;
+
+            results[index] = 0;
+            for (BidirectionalLink *cursor     = bucket.first(),
+                                   * const end = bucket.end();
+                                 end != cursor; cursor = cursor->nextLink()) {
+                if (equalityFunctor(*keys[index],
+                                    extractKey<KEY_CONFIG>(cursor))) {
+                    results[index] = cursor;
+                    break;
+                }
+            }
+        }
+    }
+}
+
 template <class KEY_CONFIG, class HASHER>
 void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
                               BidirectionalLink *elementList,
@@ -45,6 +45,7 @@ using namespace BloombergLP::bslalg;
 // ----------------------------------------------------------------------------
 // [  ] ...
 // ----------------------------------------------------------------------------
+// [12] findBatch(Link **r, const Anchor&, Key **k, size_t *h, int n, E);
 // [10] remove(HashTableAnchor *a, BidirectionalLink *l, size_t  h);
 // [10] bucketContainsLink(const Bucket& b, BidirectionalLink *l);
 // [ 9] find(const HashTableAnchor& a, KeyType& key, comparator, size_t h);
@@ -667,7 +668,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -748,6 +749,136 @@ int main(int argc, char *argv[])
         ASSERT(0 == hs.count("chomp"));
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'findBatch'
+        //
+        // Concerns:
+        //: 1 'findBatch' loads, for each key, the same address 'find' returns
+        //:   for that key, whether or not the key is in the table.
+        //:
+        //: 2 Keys are found correctly whatever their number, in particular
+        //:   when it is not a multiple of the size of the groups whose buckets
+        //:   are prefetched together, and when the table is empty.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a table holding the values in '[0 .. 64)' that are not
+        //:   multiples of 3, using each value as its own hash code, and look
+        //:   up, in batches of varying sizes, the values in a slightly larger
+        //:   range.  Verify each result against 'find'.  Repeat the lookup on
+        //:   an empty table.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   findBatch(Link **r, const Anchor&, Key **k, size_t *h, int n, E);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING 'findBatch'\n"
+                            "===================\n");
+
+        bslma::TestAllocator da("defaultAllocator", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        bslma::TestAllocator oa("objectAllocator", veryVeryVeryVerbose);
+
+        typedef TestSetKeyPolicy<int> TestPolicy;
+        typedef NodeUtil<int>         IntNodeUtil;
+
+        enum { NUM_VALUES = 64, MAX_KEYS = NUM_VALUES + 8 };
+
+        Bucket buckets[8];
+        memset(buckets, 0, sizeof(buckets));
+
+        Anchor anchor(buckets, 8, 0);    const Anchor& ANCHOR = anchor;
+
+        Bucket emptyBucket;
+        memset(&emptyBucket, 0, sizeof(emptyBucket));
+
+        Anchor emptyAnchor(&emptyBucket, 1, 0);
+        const Anchor& EMPTY_ANCHOR = emptyAnchor;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            if (0 != i % 3) {
+                Obj::insertAtBackOfBucket(&anchor,
+                                          IntNodeUtil::create(i, &oa),
+                                          i);
+            }
+        }
+
+        int         keys[MAX_KEYS];
+        const int  *keyPtrs[MAX_KEYS];
+        size_t      hashCodes[MAX_KEYS];
+        Link       *results[MAX_KEYS];
+
+        for (int first = 0; first < 8; ++first) {
+            for (int numKeys = 0; first + numKeys <= MAX_KEYS; ++numKeys) {
+                for (int i = 0; i < numKeys; ++i) {
+                    keys[i]      = first + i;
+                    keyPtrs[i]   = &keys[i];
+                    hashCodes[i] = keys[i];
+                }
+
+                Obj::findBatch<TestPolicy>(results,
+                                           ANCHOR,
+                                           keyPtrs,
+                                           hashCodes,
+                                           numKeys,
+                                           Equals<int>());
+
+                for (int i = 0; i < numKeys; ++i) {
+                    Link *EXP = Obj::find<TestPolicy>(ANCHOR,
+                                                      keys[i],
+                                                      Equals<int>(),
+                                                      hashCodes[i]);
+                    ASSERTV(first, numKeys, i, EXP == results[i]);
+                    ASSERTV(first, numKeys, i,
+                            (0 == results[i]) == (0 == keys[i] % 3
+                                               || NUM_VALUES <= keys[i]));
+                }
+
+                Obj::findBatch<TestPolicy>(results,
+                                           EMPTY_ANCHOR,
+                                           keyPtrs,
+                                           hashCodes,
+                                           numKeys,
+                                           Equals<int>());
+
+                for (int i = 0; i < numKeys; ++i) {
+                    ASSERTV(first, numKeys, i, 0 == results[i]);
+                }
+            }
+        }
+
+        ASSERT((Obj::isWellFormed<TestPolicy>(anchor, Mod8Hasher())));
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(Obj::findBatch<TestPolicy>(results, ANCHOR,
+                                                        keyPtrs, hashCodes,
+                                                        1, Equals<int>()));
+            ASSERT_SAFE_FAIL(Obj::findBatch<TestPolicy>(      0, ANCHOR,
+                                                        keyPtrs, hashCodes,
+                                                        1, Equals<int>()));
+            ASSERT_SAFE_FAIL(Obj::findBatch<TestPolicy>(results, ANCHOR,
+                                                              0, hashCodes,
+                                                        1, Equals<int>()));
+            ASSERT_SAFE_FAIL(Obj::findBatch<TestPolicy>(results, ANCHOR,
+                                                        keyPtrs,         0,
+                                                        1, Equals<int>()));
+            ASSERT_SAFE_FAIL(Obj::findBatch<TestPolicy>(results, ANCHOR,
+                                                        keyPtrs, hashCodes,
+                                                       -1, Equals<int>()));
+        }
+
+        IntNodeUtil::disposeList(anchor.listRootAddress(), &oa);
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // ATTEMPTED USAGE EXAMPLE
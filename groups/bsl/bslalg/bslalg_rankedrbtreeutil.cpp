@@ -0,0 +1,255 @@
+// bslalg_rankedrbtreeutil.cpp                                        -*-C++-*-
+#include <bslalg_rankedrbtreeutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslalg_rbtreeutil.h>
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bslalg {
+
+static inline void updateSubtreeSize(RbTreeNode *node)
+    // Set the subtree size of the specified 'node' to one more than the sum
+    // of the subtree sizes recorded by its children.  The behavior is
+    // undefined unless 'node' is a 'RankedRbTreeNode'.
+{
+    static_cast<RankedRbTreeNode *>(node)->setSubtreeSize(
+                         RankedRbTreeUtil::subtreeSize(node->leftChild())
+                       + RankedRbTreeUtil::subtreeSize(node->rightChild())
+                       + 1);
+}
+
+static void updatePath(RbTreeAnchor *tree, RbTreeNode *node)
+    // Update the subtree sizes of each node on the path from the specified
+    // 'node' to the root of the specified 'tree', and of each child of those
+    // nodes, from the bottom up.  If 'node' is the sentinel of 'tree', this
+    // function has no effect.  The behavior is undefined unless the subtree
+    // sizes of every other node of 'tree' are valid.  Note that this restores
+    // the subtree sizes after a node is inserted or removed below 'node', and
+    // the tree is rebalanced by rotations, because each node moved by those
+    // rotations either ends on that path, or is a child of a node on the path
+    // and has children that were not moved.
+{
+    while (tree->sentinel() != node) {
+        if (node->leftChild()) {
+            updateSubtreeSize(node->leftChild());
+        }
+        if (node->rightChild()) {
+            updateSubtreeSize(node->rightChild());
+        }
+        updateSubtreeSize(node);
+        node = node->parent();
+    }
+}
+
+static RbTreeNode *firstPostOrderNode(RbTreeNode *node)
+    // Return the address of the first node in a post-order traversal of the
+    // subtree rooted at the specified 'node'.
+{
+    while (node->leftChild() || node->rightChild()) {
+        node = node->leftChild() ? node->leftChild() : node->rightChild();
+    }
+    return node;
+}
+
+static RbTreeNode *nextPostOrderNode(RbTreeNode *node)
+    // Return the address of the node following the specified 'node' in a
+    // post-order traversal of the tree containing 'node'.  The behavior is
+    // undefined unless 'node' is not the root of its tree.
+{
+    RbTreeNode *parent = node->parent();
+    if (parent->leftChild() == node && parent->rightChild()) {
+        return firstPostOrderNode(parent->rightChild());              // RETURN
+    }
+    return parent;
+}
+
+                        // ----------------------
+                        // struct RankedRbTreeUtil
+                        // ----------------------
+
+// CLASS METHODS
+void RankedRbTreeUtil::insertAt(RbTreeAnchor     *tree,
+                                RbTreeNode       *parentNode,
+                                bool              leftChildFlag,
+                                RankedRbTreeNode *newNode)
+{
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(parentNode);
+    BSLS_ASSERT(newNode);
+
+    RbTreeUtil::insertAt(tree, parentNode, leftChildFlag, newNode);
+    updatePath(tree, newNode);
+}
+
+void RankedRbTreeUtil::remove(RbTreeAnchor *tree, RankedRbTreeNode *node)
+{
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(tree->rootNode());
+
+    // Find the lowest node whose subtree loses a node, as would
+    // 'RbTreeUtil::remove': the parent of 'node' if 'node' has a null child,
+    // and otherwise the parent of the successor of 'node' before that
+    // successor is moved to the position of 'node'.
+
+    RbTreeNode *parentOfX;
+    if (0 == node->leftChild() || 0 == node->rightChild()) {
+        parentOfX = node->parent();
+    }
+    else {
+        RbTreeNode *successor = RbTreeUtil::leftmost(node->rightChild());
+        parentOfX = successor->parent() == node
+                    ? successor
+                    : successor->parent();
+    }
+
+    RbTreeUtil::remove(tree, node);
+    updatePath(tree, parentOfX);
+}
+
+void RankedRbTreeUtil::rotateLeft(RankedRbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(node->rightChild());
+
+    RankedRbTreeNode *pivot =
+                       static_cast<RankedRbTreeNode *>(node->rightChild());
+    const int         size  = node->subtreeSize();
+
+    RbTreeUtil::rotateLeft(node);
+
+    pivot->setSubtreeSize(size);
+    updateSubtreeSize(node);
+}
+
+void RankedRbTreeUtil::rotateRight(RankedRbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(node->leftChild());
+
+    RankedRbTreeNode *pivot =
+                        static_cast<RankedRbTreeNode *>(node->leftChild());
+    const int         size  = node->subtreeSize();
+
+    RbTreeUtil::rotateRight(node);
+
+    pivot->setSubtreeSize(size);
+    updateSubtreeSize(node);
+}
+
+void RankedRbTreeUtil::updateSubtreeSizes(RbTreeAnchor *tree)
+{
+    BSLS_ASSERT(tree);
+
+    RbTreeNode *root = tree->rootNode();
+    if (!root) {
+        return;                                                       // RETURN
+    }
+
+    // Visit the nodes in post-order, so that the children of each node are
+    // updated before it, without using storage proportional to the height
+    // of the tree (which, for a vine, is the number of nodes).
+
+    RbTreeNode *node = firstPostOrderNode(root);
+    while (root != node) {
+        updateSubtreeSize(node);
+        node = nextPostOrderNode(node);
+    }
+    updateSubtreeSize(root);
+}
+
+int RankedRbTreeUtil::rank(const RbTreeAnchor& tree, const RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+
+    if (tree.sentinel() == node) {
+        return tree.numNodes();                                       // RETURN
+    }
+
+    int result = subtreeSize(node->leftChild());
+    while (tree.sentinel() != node->parent()) {
+        const RbTreeNode *parent = node->parent();
+        if (parent->rightChild() == node) {
+            result += subtreeSize(parent->leftChild()) + 1;
+        }
+        node = parent;
+    }
+    return result;
+}
+
+const RbTreeNode *RankedRbTreeUtil::select(const RbTreeAnchor& tree,
+                                           int                 index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index <= tree.numNodes());
+
+    const RbTreeNode *node = tree.rootNode();
+    while (node) {
+        const int leftSize = subtreeSize(node->leftChild());
+        if (index < leftSize) {
+            node = node->leftChild();
+        }
+        else if (index == leftSize) {
+            return node;                                              // RETURN
+        }
+        else {
+            index -= leftSize + 1;
+            node   = node->rightChild();
+        }
+    }
+    return tree.sentinel();
+}
+
+bool RankedRbTreeUtil::hasValidSubtreeSizes(const RbTreeAnchor& tree)
+{
+    RbTreeNode *root = const_cast<RbTreeNode *>(tree.rootNode());
+    if (!root) {
+        return 0 == tree.numNodes();                                  // RETURN
+    }
+    if (subtreeSize(root) != tree.numNodes()) {
+        return false;                                                 // RETURN
+    }
+
+    RbTreeNode *node = firstPostOrderNode(root);
+    while (true) {
+        if (subtreeSize(node) != subtreeSize(node->leftChild())
+                               + subtreeSize(node->rightChild())
+                               + 1) {
+            return false;                                             // RETURN
+        }
+        if (root == node) {
+            return true;                                              // RETURN
+        }
+        node = nextPostOrderNode(node);
+    }
+}
+
+}  // close namespace bslalg
+}  // close namespace BloombergLP
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
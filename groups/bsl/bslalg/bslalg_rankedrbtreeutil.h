@@ -0,0 +1,352 @@
+// bslalg_rankedrbtreeutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLALG_RANKEDRBTREEUTIL
+#define INCLUDED_BSLALG_RANKEDRBTREEUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide red-black tree algorithms maintaining subtree sizes.
+//
+//@CLASSES:
+//  bslalg::RankedRbTreeNode: red-black tree node recording its subtree size
+//  bslalg::RankedRbTreeUtil: namespace for order-statistic tree functions
+//
+//@SEE_ALSO: bslalg_rbtreeutil, bslalg_rbtreenode, bslstl_rankedtree
+//
+//@DESCRIPTION: This component provides a POD-like node class,
+// 'RankedRbTreeNode', that extends 'RbTreeNode' with the number of nodes in
+// the subtree it roots, and a utility 'struct', 'RankedRbTreeUtil', providing
+// the modifying algorithms of 'RbTreeUtil' that maintain those subtree sizes,
+// and the order-statistic algorithms that they make possible: finding the
+// position ("rank") of a node in the in-order sequence of the nodes of a
+// tree, and finding the node at a given position ("select"), each in
+// O[log(N)] operations, where N is the number of nodes in the tree, rather
+// than the O[N] operations of a walk from the first node.
+//
+// A tree of 'RankedRbTreeNode' objects is an ordinary red-black tree anchored
+// by an 'RbTreeAnchor': every non-modifying algorithm of 'RbTreeUtil'
+// ('find', 'lowerBound', 'next', 'isWellFormed', etc.) applies to it
+// unchanged.  Every node of such a tree must be a 'RankedRbTreeNode', other
+// than the sentinel node of the anchor, whose subtree size is never
+// accessed.
+//
+///Maintaining Subtree Sizes
+///-------------------------
+// The subtree size of a node changes only if a node is inserted into, or
+// removed from, its subtree, or if the node is moved by a rotation.
+// 'RankedRbTreeUtil::insertAt' and 'RankedRbTreeUtil::remove' rely on the
+// corresponding functions of 'RbTreeUtil' to modify and rebalance the tree,
+// and then restore the subtree sizes by visiting the path from the point of
+// modification to the root: each node moved by the rebalancing is either on
+// that path, or is a child of a node on that path whose own children were not
+// moved, so recomputing the size of each node on the path, and of each child
+// of those nodes, from the bottom up, restores the size of every node in
+// O[log(N)] operations.  'RankedRbTreeUtil::rotateLeft' and
+// 'RankedRbTreeUtil::rotateRight' maintain the sizes of the two nodes that
+// they move, for clients restructuring a tree directly.
+//
+// Algorithms of 'RbTreeUtil' that build or restructure a whole tree ('merge',
+// 'treeToVine', 'vineToTree') do not maintain subtree sizes: after using
+// them on a tree of 'RankedRbTreeNode' objects, 'updateSubtreeSizes' must be
+// called to recompute the size of every node, in O[N] operations.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Finding the Rank of a Value
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a tree of 'int' values, and want to know how many of the
+// values are less than a given one, without visiting each of them.
+//
+// First, we define a node type holding an 'int' value, and a comparator
+// ordering nodes by their values:
+//..
+//  struct IntNode : public RankedRbTreeNode {
+//      // A ranked red-black tree node containing an integer value.
+//
+//      int d_value;  // "payload" value represented by the node
+//  };
+//
+//  struct IntNodeComparator {
+//      // This class defines a comparator providing comparison operations
+//      // between 'IntNode' objects, and 'int' values.
+//
+//      bool operator()(const RbTreeNode& lhs, int rhs) const
+//      {
+//          return static_cast<const IntNode&>(lhs).d_value < rhs;
+//      }
+//
+//      bool operator()(int lhs, const RbTreeNode& rhs) const
+//      {
+//          return lhs < static_cast<const IntNode&>(rhs).d_value;
+//      }
+//  };
+//..
+// Then, we insert nodes holding the values 0, 10, ..., 90 into a tree, in a
+// scrambled order, using 'RbTreeUtil::findInsertLocation' to find the
+// location of each node, and 'RankedRbTreeUtil::insertAt' to insert it:
+//..
+//  RbTreeAnchor      tree;
+//  IntNode           nodes[10];
+//  IntNodeComparator comparator;
+//
+//  for (int i = 0; i < 10; ++i) {
+//      nodes[i].d_value = (i * 7) % 10 * 10;
+//
+//      bool        leftFlag;
+//      RbTreeNode *parent = RbTreeUtil::findInsertLocation(&leftFlag,
+//                                                          &tree,
+//                                                          comparator,
+//                                                          nodes[i].d_value);
+//      RankedRbTreeUtil::insertAt(&tree, parent, leftFlag, &nodes[i]);
+//  }
+//  assert(10 == tree.numNodes());
+//  assert(RankedRbTreeUtil::hasValidSubtreeSizes(tree));
+//..
+// Next, we find the number of values less than 45, which is the rank of the
+// first node not ordered before 45:
+//..
+//  const RbTreeNode *node = RbTreeUtil::lowerBound(tree, comparator, 45);
+//  assert(5 == RankedRbTreeUtil::rank(tree, node));
+//..
+// Then, we find the median (the sixth smallest) value:
+//..
+//  node = RankedRbTreeUtil::select(tree, 5);
+//  assert(50 == static_cast<const IntNode *>(node)->d_value);
+//..
+// Finally, we remove the node holding 0, and observe that the rank of the
+// node holding 50 has decreased:
+//..
+//  RankedRbTreeUtil::remove(&tree, &nodes[0]);
+//  assert(4 == RankedRbTreeUtil::rank(tree, node));
+//  assert(RankedRbTreeUtil::hasValidSubtreeSizes(tree));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEANCHOR
+#include <bslalg_rbtreeanchor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREENODE
+#include <bslalg_rbtreenode.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                        // ======================
+                        // class RankedRbTreeNode
+                        // ======================
+
+class RankedRbTreeNode : public RbTreeNode {
+    // This POD-like 'class' describes a node suitable for use in a red-black
+    // binary search tree whose nodes record the number of nodes in the
+    // subtree they root (including themselves).  In order to meet the
+    // essential requirements of a POD type, this 'class' does not define a
+    // constructor or destructor.  Like 'RbTreeNode', this type does not
+    // contain any "payload" member data.
+
+    // DATA
+    int d_subtreeSize;  // number of nodes in the subtree rooted at this node
+
+  public:
+    //! RankedRbTreeNode() = default;
+        // Create a 'RankedRbTreeNode' object having uninitialized values.
+
+    //! RankedRbTreeNode(const RankedRbTreeNode& original) = default;
+        // Create a 'RankedRbTreeNode' object having the same value as the
+        // specified 'original' object.
+
+    //! ~RankedRbTreeNode() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! RankedRbTreeNode& operator=(const RankedRbTreeNode& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void setSubtreeSize(int value);
+        // Set the number of nodes in the subtree rooted at this node to the
+        // specified 'value'.
+
+    // ACCESSORS
+    int subtreeSize() const;
+        // Return the number of nodes in the subtree rooted at this node.
+};
+
+                        // ======================
+                        // struct RankedRbTreeUtil
+                        // ======================
+
+struct RankedRbTreeUtil {
+    // This 'struct' provides a namespace for a suite of utility functions that
+    // operate on red-black trees of 'RankedRbTreeNode' objects, maintaining
+    // or using the subtree size of each node.  In each function, the nodes of
+    // the supplied trees, other than their sentinel nodes, must be
+    // 'RankedRbTreeNode' objects.  Each method of this class provides the
+    // no-throw exception guarantee.
+
+    // CLASS METHODS
+                                 // Modification
+
+    static void insertAt(RbTreeAnchor     *tree,
+                         RbTreeNode       *parentNode,
+                         bool              leftChildFlag,
+                         RankedRbTreeNode *newNode);
+        // Insert the specified 'newNode' into the specified 'tree' as either
+        // the left or right child of the specified 'parentNode', as indicated
+        // by the specified 'leftChildFlag', rebalance the tree as does
+        // 'RbTreeUtil::insertAt', and update the subtree sizes of the nodes
+        // of 'tree'.  This operation takes O[log(N)] operations, where N is
+        // the number of nodes in 'tree'.  The behavior is undefined unless
+        // the subtree sizes of the nodes of 'tree' are valid (see
+        // 'hasValidSubtreeSizes'), and the requirements of
+        // 'RbTreeUtil::insertAt' are met.
+
+    static void remove(RbTreeAnchor *tree, RankedRbTreeNode *node);
+        // Remove the specified 'node' from the specified 'tree', rebalance the
+        // tree as does 'RbTreeUtil::remove', and update the subtree sizes of
+        // the remaining nodes of 'tree'.  This operation takes O[log(N)]
+        // operations, where N is the number of nodes in 'tree'.  The behavior
+        // is undefined unless the subtree sizes of the nodes of 'tree' are
+        // valid (see 'hasValidSubtreeSizes'), and 'node' is a node of 'tree'.
+
+    static void rotateLeft(RankedRbTreeNode *node);
+        // Perform a counter-clockwise rotation on the specified 'node', as
+        // does 'RbTreeUtil::rotateLeft', and update the subtree sizes of
+        // 'node' and of its right child (the pivot), which become valid if
+        // they were valid before the rotation.  The behavior is undefined
+        // unless the requirements of 'RbTreeUtil::rotateLeft' are met.
+
+    static void rotateRight(RankedRbTreeNode *node);
+        // Perform a clockwise rotation on the specified 'node', as does
+        // 'RbTreeUtil::rotateRight', and update the subtree sizes of 'node'
+        // and of its left child (the pivot), which become valid if they were
+        // valid before the rotation.  The behavior is undefined unless the
+        // requirements of 'RbTreeUtil::rotateRight' are met.
+
+    static void updateSubtreeSizes(RbTreeAnchor *tree);
+        // Set the subtree size of each node of the specified 'tree' to the
+        // number of nodes in the subtree it roots.  This operation takes O[N]
+        // operations, where N is the number of nodes in 'tree', and is
+        // intended to be used after restructuring the whole tree (e.g., with
+        // 'RbTreeUtil::vineToTree').  The behavior is undefined unless 'tree'
+        // is a valid binary tree.
+
+                                 // Order Statistics
+
+    static int rank(const RbTreeAnchor& tree, const RbTreeNode *node);
+        // Return the number of nodes of the specified 'tree' ordered before
+        // the specified 'node' (i.e., the position of 'node' in an in-order
+        // traversal of 'tree'), or the number of nodes of 'tree' if 'node' is
+        // 'tree.sentinel()'.  This operation takes O[log(N)] operations, where
+        // N is the number of nodes in 'tree'.  The behavior is undefined
+        // unless the subtree sizes of the nodes of 'tree' are valid, and
+        // 'node' is either a node of 'tree' or its sentinel.
+
+    static const RbTreeNode *select(const RbTreeAnchor& tree, int index);
+    static       RbTreeNode *select(      RbTreeAnchor& tree, int index);
+        // Return the address of the node of the specified 'tree' at the
+        // specified 'index' in an in-order traversal of 'tree', or
+        // 'tree.sentinel()' if 'index' is the number of nodes of 'tree'.  This
+        // operation takes O[log(N)] operations, where N is the number of nodes
+        // in 'tree'.  The behavior is undefined unless the subtree sizes of
+        // the nodes of 'tree' are valid, and
+        // '0 <= index <= tree.numNodes()'.
+
+    static int subtreeSize(const RbTreeNode *subtree);
+        // Return the number of nodes in the specified 'subtree' as recorded by
+        // its root, or 0 if 'subtree' is 0.  The behavior is undefined unless
+        // 'subtree' is 0 or is a 'RankedRbTreeNode' that is not the sentinel
+        // of a tree.
+
+                                 // Testing
+
+    static bool hasValidSubtreeSizes(const RbTreeAnchor& tree);
+        // Return 'true' if the subtree size of each node of the specified
+        // 'tree' is the number of nodes in the subtree it roots, and that of
+        // the root node is 'tree.numNodes()', and 'false' otherwise.  This
+        // operation takes O[N] operations, where N is the number of nodes in
+        // 'tree'.  The behavior is undefined unless 'tree' is a valid binary
+        // tree.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------------
+                        // class RankedRbTreeNode
+                        // ----------------------
+
+// MANIPULATORS
+inline
+void RankedRbTreeNode::setSubtreeSize(int value)
+{
+    d_subtreeSize = value;
+}
+
+// ACCESSORS
+inline
+int RankedRbTreeNode::subtreeSize() const
+{
+    return d_subtreeSize;
+}
+
+                        // ----------------------
+                        // struct RankedRbTreeUtil
+                        // ----------------------
+
+// CLASS METHODS
+inline
+RbTreeNode *RankedRbTreeUtil::select(RbTreeAnchor& tree, int index)
+{
+    return const_cast<RbTreeNode *>(
+                  select(const_cast<const RbTreeAnchor&>(tree), index));
+}
+
+inline
+int RankedRbTreeUtil::subtreeSize(const RbTreeNode *subtree)
+{
+    return subtree
+           ? static_cast<const RankedRbTreeNode *>(subtree)->subtreeSize()
+           : 0;
+}
+
+}  // close namespace bslalg
+}  // close namespace BloombergLP
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,794 @@
+// bslalg_rankedrbtreeutil.t.cpp                                      -*-C++-*-
+#include <bslalg_rankedrbtreeutil.h>
+
+#include <bslalg_rbtreeutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+using namespace bslalg;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a POD-like node type recording a subtree
+// size, and a utility of static functions maintaining and using those
+// sizes.  The node accessors are tested directly.  The rotations are tested
+// on small hand-built trees.  'updateSubtreeSizes' and
+// 'hasValidSubtreeSizes' are tested on trees built with
+// 'RbTreeUtil::vineToTree' and then deliberately corrupted.  'insertAt' and
+// 'remove' are tested by long sequences of random insertions and removals,
+// verifying after each operation that the tree is a well-formed red-black
+// tree, that every subtree size is valid, and that 'rank' and 'select' agree
+// with an array model of the ordered values.
+//-----------------------------------------------------------------------------
+// class RankedRbTreeNode
+// [ 2] void setSubtreeSize(int value);
+// [ 2] int subtreeSize() const;
+//
+// struct RankedRbTreeUtil
+// [ 5] void insertAt(RbTreeAnchor *, RbTreeNode *, bool, RankedRbTreeNode *);
+// [ 5] void remove(RbTreeAnchor *tree, RankedRbTreeNode *node);
+// [ 3] void rotateLeft(RankedRbTreeNode *node);
+// [ 3] void rotateRight(RankedRbTreeNode *node);
+// [ 4] void updateSubtreeSizes(RbTreeAnchor *tree);
+// [ 5] int rank(const RbTreeAnchor& tree, const RbTreeNode *node);
+// [ 5] const RbTreeNode *select(const RbTreeAnchor& tree, int index);
+// [ 5] RbTreeNode *select(RbTreeAnchor& tree, int index);
+// [ 2] int subtreeSize(const RbTreeNode *subtree);
+// [ 4] bool hasValidSubtreeSizes(const RbTreeAnchor& tree);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef RankedRbTreeUtil Obj;
+typedef RankedRbTreeNode Node;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                         GLOBAL CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct IntNode : public RankedRbTreeNode {
+    // A ranked red-black tree node containing an integer value.
+
+    int d_value;  // "payload" value represented by the node
+};
+
+struct IntNodeComparator {
+    // This class defines a comparator providing comparison operations
+    // between 'IntNode' objects, and 'int' values.
+
+    bool operator()(const RbTreeNode& lhs, int rhs) const
+    {
+        return static_cast<const IntNode&>(lhs).d_value < rhs;
+    }
+
+    bool operator()(int lhs, const RbTreeNode& rhs) const
+    {
+        return lhs < static_cast<const IntNode&>(rhs).d_value;
+    }
+};
+
+struct NodeComparator {
+    // This class defines a comparator ordering 'IntNode' objects by their
+    // values, as required by 'RbTreeUtil::isWellFormed'.
+
+    bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const
+    {
+        return static_cast<const IntNode&>(lhs).d_value
+             < static_cast<const IntNode&>(rhs).d_value;
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+int valueOf(const RbTreeNode *node)
+    // Return the value held by the specified 'node'.
+{
+    return static_cast<const IntNode *>(node)->d_value;
+}
+
+static
+void initNode(IntNode *node, int value)
+    // Set the links, the subtree size and the value of the specified 'node'
+    // to those of an unattached node holding the specified 'value'.
+{
+    node->setParent(0);
+    node->setLeftChild(0);
+    node->setRightChild(0);
+    node->makeRed();
+    node->setSubtreeSize(1);
+    node->d_value = value;
+}
+
+static
+void link(IntNode *parent, IntNode *left, IntNode *right)
+    // Make the specified 'left' and 'right' the children of the specified
+    // 'parent', and set the subtree size of 'parent' accordingly.  Either of
+    // 'left' and 'right' may be 0.
+{
+    parent->setLeftChild(left);
+    parent->setRightChild(right);
+    if (left) {
+        left->setParent(parent);
+    }
+    if (right) {
+        right->setParent(parent);
+    }
+    parent->setSubtreeSize(Obj::subtreeSize(left)
+                         + Obj::subtreeSize(right)
+                         + 1);
+}
+
+static
+int insertValue(RbTreeAnchor *tree, IntNode *node, int value)
+    // Insert the specified 'node', holding the specified 'value', into the
+    // specified 'tree' after any nodes holding equal values, and return the
+    // rank of 'node' after the insertion.
+{
+    IntNodeComparator comparator;
+    initNode(node, value);
+
+    bool        leftFlag;
+    RbTreeNode *parent = RbTreeUtil::findInsertLocation(&leftFlag,
+                                                        tree,
+                                                        comparator,
+                                                        value);
+    Obj::insertAt(tree, parent, leftFlag, node);
+    return Obj::rank(*tree, node);
+}
+
+static
+bool matchesModel(const RbTreeAnchor& tree, const int *model, int numValues)
+    // Return 'true' if the specified 'tree' is a well-formed red-black tree
+    // having valid subtree sizes, holding the specified 'numValues' values of
+    // the specified sorted 'model' array, and for which 'rank' and 'select'
+    // agree with the position of each node, and 'false' otherwise.
+{
+    NodeComparator comparator;
+
+    if (!RbTreeUtil::isWellFormed(tree, comparator)
+     || !Obj::hasValidSubtreeSizes(tree)
+     || numValues != tree.numNodes()) {
+        return false;                                                 // RETURN
+    }
+
+    int               index = 0;
+    const RbTreeNode *node  = tree.firstNode();
+    for (; tree.sentinel() != node; node = RbTreeUtil::next(node), ++index) {
+        if (model[index] != valueOf(node)
+         || index != Obj::rank(tree, node)
+         || node != Obj::select(tree, index)) {
+            return false;                                             // RETURN
+        }
+    }
+    return numValues == index
+        && tree.sentinel() == Obj::select(tree, numValues)
+        && numValues == Obj::rank(tree, tree.sentinel());
+}
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Finding the Rank of a Value
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a tree of 'int' values, and want to know how many of the
+// values are less than a given one, without visiting each of them.
+//
+// First, we define a node type holding an 'int' value, and a comparator
+// ordering nodes by their values (see 'IntNode' and 'IntNodeComparator'
+// above).
+//
+// Then, we insert nodes holding the values 0, 10, ..., 90 into a tree, in a
+// scrambled order, using 'RbTreeUtil::findInsertLocation' to find the
+// location of each node, and 'RankedRbTreeUtil::insertAt' to insert it:
+//..
+    RbTreeAnchor      tree;
+    IntNode           nodes[10];
+    IntNodeComparator comparator;
+
+    for (int i = 0; i < 10; ++i) {
+        nodes[i].d_value = (i * 7) % 10 * 10;
+
+        bool        leftFlag;
+        RbTreeNode *parent = RbTreeUtil::findInsertLocation(&leftFlag,
+                                                            &tree,
+                                                            comparator,
+                                                            nodes[i].d_value);
+        RankedRbTreeUtil::insertAt(&tree, parent, leftFlag, &nodes[i]);
+    }
+    ASSERT(10 == tree.numNodes());
+    ASSERT(RankedRbTreeUtil::hasValidSubtreeSizes(tree));
+//..
+// Next, we find the number of values less than 45, which is the rank of the
+// first node not ordered before 45:
+//..
+    const RbTreeNode *node = RbTreeUtil::lowerBound(tree, comparator, 45);
+    ASSERT(5 == RankedRbTreeUtil::rank(tree, node));
+//..
+// Then, we find the median (the sixth smallest) value:
+//..
+    node = RankedRbTreeUtil::select(tree, 5);
+    ASSERT(50 == static_cast<const IntNode *>(node)->d_value);
+//..
+// Finally, we remove the node holding 0, and observe that the rank of the
+// node holding 50 has decreased:
+//..
+    RankedRbTreeUtil::remove(&tree, &nodes[0]);
+    ASSERT(4 == RankedRbTreeUtil::rank(tree, node));
+    ASSERT(RankedRbTreeUtil::hasValidSubtreeSizes(tree));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'insertAt', 'remove', 'rank' AND 'select'
+        //
+        // Concerns:
+        //: 1 'insertAt' and 'remove' modify and rebalance the tree as do the
+        //:   corresponding functions of 'RbTreeUtil'.
+        //:
+        //: 2 After 'insertAt' and 'remove', the subtree size of every node is
+        //:   valid, whichever rebalancing cases were exercised.
+        //:
+        //: 3 'rank' returns the in-order position of a node, and the number
+        //:   of nodes for the sentinel.
+        //:
+        //: 4 'select' returns the node at an in-order position, and the
+        //:   sentinel for the number of nodes.
+        //:
+        //: 5 Equal values are supported.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 For a series of value ranges (including ranges with many
+        //:   duplicates), insert nodes holding random values, and then remove
+        //:   random nodes interleaved with further insertions, maintaining a
+        //:   sorted array model, and after each operation verify the tree,
+        //:   its sizes, and every 'rank' and 'select' against the model.
+        //:   (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void insertAt(RbTreeAnchor *, RbTreeNode *, bool, Node *);
+        //   void remove(RbTreeAnchor *tree, RankedRbTreeNode *node);
+        //   int rank(const RbTreeAnchor& tree, const RbTreeNode *node);
+        //   const RbTreeNode *select(const RbTreeAnchor& tree, int index);
+        //   RbTreeNode *select(RbTreeAnchor& tree, int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insertAt', 'remove', 'rank' AND 'select'"
+                            "\n=========================================\n");
+
+        enum { MAX_NODES = 128 };
+
+        const int RANGES[] = { 1, 4, 32, 1000, 1 << 20 };
+        const int NUM_RANGES = static_cast<int>(sizeof RANGES
+                                                / sizeof *RANGES);
+
+        srand(12345);
+
+        for (int ti = 0; ti < NUM_RANGES; ++ti) {
+            const int RANGE = RANGES[ti];
+
+            if (veryVerbose) { T_ P(RANGE) }
+
+            for (int trial = 0; trial < 20; ++trial) {
+                IntNode      nodes[MAX_NODES];
+                IntNode     *inTree[MAX_NODES];  // nodes in the tree
+                IntNode     *freeNodes[MAX_NODES];
+                int          model[MAX_NODES];
+                int          numInTree = 0;
+                int          numFree   = MAX_NODES;
+                RbTreeAnchor tree;
+
+                for (int i = 0; i < MAX_NODES; ++i) {
+                    freeNodes[i] = &nodes[i];
+                }
+
+                for (int op = 0; op < 4 * MAX_NODES; ++op) {
+                    const bool insertFlag = 0 == numInTree
+                                         || (0 < numFree
+                                             && (op < MAX_NODES
+                                                 || rand() % 2));
+                    if (insertFlag) {
+                        IntNode   *node  = freeNodes[--numFree];
+                        const int  VALUE = rand() % RANGE;
+                        const int  RANK  = insertValue(&tree, node, VALUE);
+
+                        // The new node follows the nodes holding equal values.
+
+                        int pos = numInTree;
+                        while (pos > 0 && model[pos - 1] > VALUE) {
+                            model[pos] = model[pos - 1];
+                            --pos;
+                        }
+                        model[pos] = VALUE;
+                        ASSERTV(RANGE, op, pos, RANK, pos == RANK);
+
+                        inTree[numInTree++] = node;
+                    }
+                    else {
+                        const int  idx  = rand() % numInTree;
+                        IntNode   *node = inTree[idx];
+                        const int  pos  = Obj::rank(tree, node);
+
+                        ASSERTV(RANGE, op, model[pos] == node->d_value);
+
+                        Obj::remove(&tree, node);
+
+                        for (int i = pos; i < numInTree - 1; ++i) {
+                            model[i] = model[i + 1];
+                        }
+                        inTree[idx] = inTree[--numInTree];
+                        freeNodes[numFree++] = node;
+                    }
+                    ASSERTV(RANGE, trial, op,
+                            matchesModel(tree, model, numInTree));
+                }
+
+                // Verify the non-'const' 'select'.
+
+                RbTreeAnchor& mX = tree;
+                for (int i = 0; i <= numInTree; ++i) {
+                    const RbTreeAnchor& X    = tree;
+                    const RbTreeNode   *EXP  = Obj::select(X, i);
+                    RbTreeNode         *node = Obj::select(mX, i);
+                    ASSERTV(RANGE, i, EXP == node);
+                }
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            RbTreeAnchor tree;
+            IntNode      nodes[3];
+
+            ASSERT_SAFE_PASS(insertValue(&tree, &nodes[0], 1));
+            ASSERT_SAFE_PASS(insertValue(&tree, &nodes[1], 2));
+            initNode(&nodes[2], 3);
+
+            ASSERT_FAIL(Obj::insertAt(0, tree.rootNode(), true, &nodes[2]));
+            ASSERT_FAIL(Obj::insertAt(&tree, 0, true, &nodes[2]));
+            ASSERT_FAIL(Obj::insertAt(&tree, tree.rootNode(), true, 0));
+
+            ASSERT_FAIL(Obj::remove(0, &nodes[0]));
+            ASSERT_FAIL(Obj::remove(&tree, 0));
+
+            ASSERT_FAIL(Obj::rank(tree, 0));
+            ASSERT_PASS(Obj::rank(tree, tree.sentinel()));
+
+            ASSERT_FAIL(Obj::select(tree, -1));
+            ASSERT_PASS(Obj::select(tree,  0));
+            ASSERT_PASS(Obj::select(tree,  2));
+            ASSERT_FAIL(Obj::select(tree,  3));
+
+            RbTreeAnchor empty;
+            ASSERT_FAIL(Obj::remove(&empty, &nodes[2]));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'updateSubtreeSizes' AND 'hasValidSubtreeSizes'
+        //
+        // Concerns:
+        //: 1 'updateSubtreeSizes' sets the size of every node of a tree,
+        //:   whatever their previous values.
+        //:
+        //: 2 'updateSubtreeSizes' supports empty trees, and degenerate trees
+        //:   (vines) of any length.
+        //:
+        //: 3 'hasValidSubtreeSizes' returns 'false' if any one node has an
+        //:   invalid size, or if the size of the root differs from the
+        //:   number of nodes recorded by the anchor, and 'true' otherwise.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 For trees of 0 to 'MAX_NODES' nodes, built as a vine and then
+        //:   balanced with 'RbTreeUtil::vineToTree', with arbitrary subtree
+        //:   sizes, call 'updateSubtreeSizes' and verify the sizes with
+        //:   'hasValidSubtreeSizes', and against the rank of each node.  Then
+        //:   corrupt the size of each node in turn, and of the anchor, and
+        //:   verify that 'hasValidSubtreeSizes' returns 'false'.  (C-1, 3)
+        //:
+        //: 2 Repeat P-1 for the vine itself.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void updateSubtreeSizes(RbTreeAnchor *tree);
+        //   bool hasValidSubtreeSizes(const RbTreeAnchor& tree);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\n'updateSubtreeSizes' AND 'hasValidSubtreeSizes'"
+                        "\n===============================================\n");
+
+        enum { MAX_NODES = 40 };
+
+        for (int balance = 0; balance < 2; ++balance) {
+            for (int n = 0; n <= MAX_NODES; ++n) {
+                IntNode      nodes[MAX_NODES];
+                RbTreeAnchor tree;
+
+                for (int i = 0; i < n; ++i) {
+                    initNode(&nodes[i], i);
+                    nodes[i].setSubtreeSize(-7);
+                    RbTreeUtil::appendToVine(&tree, &nodes[i]);
+                }
+                if (balance) {
+                    RbTreeUtil::vineToTree(&tree);
+                }
+                ASSERTV(balance, n,
+                        0 == n || !Obj::hasValidSubtreeSizes(tree));
+
+                Obj::updateSubtreeSizes(&tree);
+                ASSERTV(balance, n, Obj::hasValidSubtreeSizes(tree));
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(balance, n, i, i == Obj::rank(tree, &nodes[i]));
+                    ASSERTV(balance, n, i, &nodes[i] == Obj::select(tree, i));
+
+                    nodes[i].setSubtreeSize(nodes[i].subtreeSize() + 1);
+                    ASSERTV(balance, n, i, !Obj::hasValidSubtreeSizes(tree));
+                    nodes[i].setSubtreeSize(nodes[i].subtreeSize() - 1);
+                }
+                ASSERTV(balance, n, Obj::hasValidSubtreeSizes(tree));
+
+                tree.incrementNumNodes();
+                ASSERTV(balance, n, !Obj::hasValidSubtreeSizes(tree));
+                tree.decrementNumNodes();
+                ASSERTV(balance, n, Obj::hasValidSubtreeSizes(tree));
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            RbTreeAnchor tree;
+            ASSERT_PASS(Obj::updateSubtreeSizes(&tree));
+            ASSERT_FAIL(Obj::updateSubtreeSizes(0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'rotateLeft' AND 'rotateRight'
+        //
+        // Concerns:
+        //: 1 'rotateLeft' and 'rotateRight' restructure the tree as do the
+        //:   corresponding functions of 'RbTreeUtil'.
+        //:
+        //: 2 The rotated node and its pivot have valid subtree sizes after
+        //:   the rotation, and no other size is changed.
+        //:
+        //: 3 Rotations of nodes having null grandchildren are supported.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Build, by hand, the tree 'B(A, D(C, E))' below a root node, and
+        //:   rotate 'B' left and then right, verifying the structure, and the
+        //:   size of every node, after each rotation.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with 'C' or 'A' absent.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void rotateLeft(RankedRbTreeNode *node);
+        //   void rotateRight(RankedRbTreeNode *node);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'rotateLeft' AND 'rotateRight'"
+                            "\n==============================\n");
+
+        for (int mask = 0; mask < 4; ++mask) {
+            const bool HAS_A = mask & 1;
+            const bool HAS_C = mask & 2;
+
+            if (veryVerbose) { T_ P_(HAS_A) P(HAS_C) }
+
+            IntNode root, a, b, c, d, e;
+            initNode(&root, 100);
+            initNode(&a, 1);
+            initNode(&b, 2);
+            initNode(&c, 3);
+            initNode(&d, 4);
+            initNode(&e, 5);
+
+            link(&d, HAS_C ? &c : 0, &e);
+            link(&b, HAS_A ? &a : 0, &d);
+            link(&root, &b, 0);
+
+            const int SIZE = 3 + HAS_A + HAS_C;
+            ASSERTV(mask, SIZE + 1 == root.subtreeSize());
+
+            Obj::rotateLeft(&b);
+
+            // Expect 'D(B(A, C), E)'.
+
+            ASSERTV(mask, &d == root.leftChild());
+            ASSERTV(mask, &b == d.leftChild());
+            ASSERTV(mask, &e == d.rightChild());
+            ASSERTV(mask, (HAS_A ? &a : 0) == b.leftChild());
+            ASSERTV(mask, (HAS_C ? &c : 0) == b.rightChild());
+
+            ASSERTV(mask, SIZE + 1 == root.subtreeSize());
+            ASSERTV(mask, SIZE     == d.subtreeSize());
+            ASSERTV(mask, 1 + HAS_A + HAS_C == b.subtreeSize());
+            ASSERTV(mask, 1 == e.subtreeSize());
+
+            Obj::rotateRight(&d);
+
+            // Expect 'B(A, D(C, E))' again.
+
+            ASSERTV(mask, &b == root.leftChild());
+            ASSERTV(mask, &d == b.rightChild());
+            ASSERTV(mask, (HAS_A ? &a : 0) == b.leftChild());
+            ASSERTV(mask, (HAS_C ? &c : 0) == d.leftChild());
+            ASSERTV(mask, &e == d.rightChild());
+
+            ASSERTV(mask, SIZE + 1 == root.subtreeSize());
+            ASSERTV(mask, SIZE     == b.subtreeSize());
+            ASSERTV(mask, 2 + HAS_C == d.subtreeSize());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            IntNode leaf;
+            initNode(&leaf, 0);
+
+            ASSERT_FAIL(Obj::rotateLeft(0));
+            ASSERT_FAIL(Obj::rotateRight(0));
+            ASSERT_FAIL(Obj::rotateLeft(&leaf));
+            ASSERT_FAIL(Obj::rotateRight(&leaf));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SUBTREE SIZE ACCESSORS
+        //
+        // Concerns:
+        //: 1 'setSubtreeSize' sets the value returned by 'subtreeSize'.
+        //:
+        //: 2 'setSubtreeSize' does not affect the links or color of the node.
+        //:
+        //: 3 'RankedRbTreeUtil::subtreeSize' returns the size recorded by a
+        //:   node, and 0 for a null node.
+        //
+        // Plan:
+        //: 1 Set a series of sizes on a node with known links and color, and
+        //:   verify each with both accessors, and verify the links and color.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   void setSubtreeSize(int value);
+        //   int subtreeSize() const;
+        //   int subtreeSize(const RbTreeNode *subtree);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSUBTREE SIZE ACCESSORS"
+                            "\n======================\n");
+
+        const int SIZES[] = { 0, 1, 2, 1000, 0x7fffffff };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        IntNode  other;
+        IntNode  mX;
+        const Node& X = mX;
+
+        mX.setParent(&other);
+        mX.setLeftChild(&other);
+        mX.setRightChild(0);
+        mX.makeBlack();
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            mX.setSubtreeSize(SIZES[ti]);
+
+            ASSERTV(ti, SIZES[ti] == X.subtreeSize());
+            ASSERTV(ti, SIZES[ti] == Obj::subtreeSize(&X));
+            ASSERTV(ti, &other    == X.parent());
+            ASSERTV(ti, &other    == X.leftChild());
+            ASSERTV(ti, 0         == X.rightChild());
+            ASSERTV(ti, X.isBlack());
+        }
+
+        ASSERT(0 == Obj::subtreeSize(0));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert ascending values into a tree, verify the rank of each node
+        //:   and the node at each index, then remove every other node and
+        //:   verify again.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        enum { NUM_NODES = 16 };
+
+        IntNode      nodes[NUM_NODES];
+        RbTreeAnchor tree;
+        int          model[NUM_NODES];
+
+        for (int i = 0; i < NUM_NODES; ++i) {
+            ASSERTV(i, i == insertValue(&tree, &nodes[i], i));
+            model[i] = i;
+        }
+        ASSERT(matchesModel(tree, model, NUM_NODES));
+
+        for (int i = 0; i < NUM_NODES; i += 2) {
+            Obj::remove(&tree, &nodes[i]);
+        }
+        for (int i = 0; i < NUM_NODES / 2; ++i) {
+            model[i] = 2 * i + 1;
+        }
+        ASSERT(matchesModel(tree, model, NUM_NODES / 2));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -153,6 +153,49 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
     }
 }
 
+static RbTreeNode *buildBalancedSubtree(RbTreeNode **vineNode,
+                                        int          numNodes,
+                                        int          depth,
+                                        int          redDepth)
+    // Return the root of a balanced subtree built from the specified
+    // 'numNodes' nodes of a vine ending at the specified '*vineNode' (i.e.,
+    // '*vineNode' and the 'numNodes - 1' nodes preceding it), and load into
+    // 'vineNode' the node preceding those nodes in the vine.  The root of the
+    // subtree is at the specified 'depth' of the tree being built, and the
+    // nodes at the specified 'redDepth' are colored red and all others
+    // black.  Return 0 if '0 == numNodes'.  Note that the nodes are consumed
+    // in descending order (the right subtree is built before the left), as
+    // each node of a vine refers to its predecessor.
+{
+    if (0 == numNodes) {
+        return 0;                                                     // RETURN
+    }
+
+    const int   numRight = (numNodes - 1) / 2;
+    RbTreeNode *right    = buildBalancedSubtree(vineNode,
+                                                numRight,
+                                                depth + 1,
+                                                redDepth);
+    RbTreeNode *node     = *vineNode;
+    *vineNode = node->leftChild();
+    RbTreeNode *left     = buildBalancedSubtree(vineNode,
+                                                numNodes - numRight - 1,
+                                                depth + 1,
+                                                redDepth);
+
+    node->setLeftChild(left);
+    node->setRightChild(right);
+    if (left) {
+        left->setParent(node);
+    }
+    if (right) {
+        right->setParent(node);
+    }
+    node->setColor(depth == redDepth ? RbTreeNode::BSLALG_RED
+                                     : RbTreeNode::BSLALG_BLACK);
+    return node;
+}
+
                         // ----------------
                         // class RbTreeUtil
                         // ----------------
@@ -322,6 +365,77 @@ void RbTreeUtil::insertAt(RbTreeAnchor *tree,
     tree->incrementNumNodes();
 }
 
+void RbTreeUtil::appendToVine(RbTreeAnchor *vine, RbTreeNode *newNode)
+{
+    BSLS_ASSERT(vine);
+    BSLS_ASSERT(newNode);
+
+    RbTreeNode *lastNode = vine->rootNode();
+    newNode->setLeftChild(lastNode);
+    newNode->setRightChild(0);
+    newNode->setParent(vine->sentinel());
+    if (lastNode) {
+        lastNode->setParent(newNode);
+    }
+    else {
+        vine->setFirstNode(newNode);
+    }
+    vine->setRootNode(newNode);
+    vine->incrementNumNodes();
+}
+
+void RbTreeUtil::treeToVine(RbTreeAnchor *tree)
+{
+    BSLS_ASSERT(tree);
+
+    // Rotate each right child onto the left spine of the tree, working down
+    // from the root; each rotation moves one more node onto the spine.
+
+    RbTreeNode *node = tree->rootNode();
+    while (node) {
+        RbTreeNode *pivot = node->rightChild();
+        if (pivot) {
+            rotateLeft(node);
+            node = pivot;
+        }
+        else {
+            node = node->leftChild();
+        }
+    }
+}
+
+void RbTreeUtil::vineToTree(RbTreeAnchor *vine)
+{
+    BSLS_ASSERT(vine);
+
+    const int numNodes = vine->numNodes();
+    if (0 == numNodes) {
+        vine->reset(0, vine->sentinel(), 0);
+        return;                                                       // RETURN
+    }
+
+    // The balanced tree built by 'buildBalancedSubtree' has every level full
+    // except (possibly) the deepest, at depth 'floor(log2(numNodes + 1))'.
+    // Coloring the nodes of that partial level red, and all others black,
+    // gives every path from the root the same number of black nodes.
+
+    int redDepth = 0;
+    for (int n = numNodes + 1; n > 1; n >>= 1) {
+        ++redDepth;
+    }
+
+    RbTreeNode *vineNode = vine->rootNode();
+    RbTreeNode *root     = buildBalancedSubtree(&vineNode,
+                                                numNodes,
+                                                0,
+                                                redDepth);
+    BSLS_ASSERT(0 == vineNode);
+
+    root->setParent(vine->sentinel());
+    vine->setRootNode(root);
+    vine->setFirstNode(leftmost(root));
+}
+
 void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
 {
     BSLS_ASSERT(0 != node);
@@ -604,6 +718,32 @@ bool RbTreeUtil_Validator::isWellFormedAnchor(const RbTreeAnchor& tree)
     return count == tree.numNodes();
 }
 
+                        // --------------------------
+                        // class RbTreeUtil_VineGuard
+                        // --------------------------
+
+// CREATORS
+RbTreeUtil_VineGuard::RbTreeUtil_VineGuard(RbTreeAnchor *vine,
+                                           RbTreeNode  **node)
+: d_vine_p(vine)
+, d_node_p(node)
+{
+    BSLS_ASSERT(vine);
+    BSLS_ASSERT(node);
+}
+
+RbTreeUtil_VineGuard::~RbTreeUtil_VineGuard()
+{
+    RbTreeNode *node = *d_node_p;
+    while (d_vine_p->sentinel() != node) {
+        RbTreeNode *nextNode = node->parent();
+        RbTreeUtil::appendToVine(d_vine_p, node);
+        node = nextNode;
+    }
+    *d_node_p = node;
+    RbTreeUtil::vineToTree(d_vine_p);
+}
+
 }  // close namespace bslalg
 }  // close namespace BloombergLP
 
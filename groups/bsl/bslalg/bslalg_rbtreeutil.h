@@ -42,6 +42,8 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 //  find                Find the node with the supplied value.
 //
+//  findBatch           Find the nodes with each of a sequence of values.
+//
 //  lowerBound          Find the first node not less-than the supplied value.
 //
 //  upperBound          Find the first node greater than the supplied value.
@@ -65,11 +67,25 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 //  insertAt            Insert the supplied node at the indicated position.
 //
+//  merge               Move the nodes of one tree into another tree.
+//
 //  remove              Remove the supplied node from the tree.
 //
 //  swap                Swap the contents of two trees.
 //..
 //
+///Bulk Construction
+///- - - - - - - - -
+// The following algorithms are used to build, or rebuild, a tree in linear
+// time from an ordered sequence of nodes (see {Vines}):
+//..
+//  appendToVine        Append the supplied node to the end of a vine.
+//
+//  treeToVine          Flatten a tree into a vine.
+//
+//  vineToTree          Rebuild a vine into a balanced red-black tree.
+//..
+//
 ///Utility
 ///- - - -
 // The following algorithms are typically used when implementing higher-level
@@ -96,6 +112,18 @@ BSLS_IDENT("$Id$ $CSID$")
 //  isWellFormed        Indicate if the 'RbTreeAnchor' object is well-formed.
 //..
 //
+///Batched Search
+///--------------
+// Each step of the descent of a tree larger than the processor caches
+// typically incurs a cache miss, on which the next step depends, so that a
+// search for a single value proceeds at the pace of one memory access per
+// level.  'findBatch' searches for a group of independent values by
+// descending the tree for all of them in lockstep, one level at a time,
+// prefetching the node each search visits next before advancing the other
+// searches, so that the misses of all the searches of a group are
+// outstanding at the same time.  The values are searched for in groups of
+// 16.
+//
 ///Well-Formed 'RbTreeAnchor' Objects
 ///----------------------------------
 // Many of the algorithms defined in this component operate over a complete
@@ -131,6 +159,21 @@ BSLS_IDENT("$Id$ $CSID$")
 // not a canonical requirement of a red-black tree but an additional invariant
 // enforced by the methods of 'RbTreeUtil' to simplify the implementations.
 //
+///Vines
+///-----
+// A *vine* is a degenerate ordered binary tree, held by an 'RbTreeAnchor', in
+// which no node has a right child.  The root node of a vine is therefore its
+// *last* node, the left child of each node is that node's predecessor, and
+// the parent of each node is that node's successor (the parent of the root
+// node being the sentinel).  The first node and node count of a vine are
+// maintained exactly as for a well-formed tree, but the colors of its nodes
+// are unspecified.  A vine is an intermediate form that allows a sequence of
+// nodes, supplied in order, to be assembled in constant time per node
+// ('appendToVine') and then balanced in a single linear pass
+// ('vineToTree'), rather than paying O(log(N)) comparisons and a rebalancing
+// per node.  A vine is a valid binary tree, and so may be passed to
+// 'deleteTree' and 'RbTreeUtilTreeProctor'.
+//
 ///The Sentinel Node
 ///- - - - - - - - -
 // The sentinel node is 'RbTreeNode' object (unique to an 'RbTreeAnchor'
@@ -691,6 +734,10 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 #ifndef INCLUDED_STDIO
 #include <stdio.h>
 #define INCLUDED_STDIO
@@ -828,6 +875,24 @@ struct RbTreeUtil {
         // position before which 'value' could be inserted into 'tree' while
         // preserving its ordering.
 
+    template <class NODE_VALUE_COMPARATOR, class VALUE>
+    static void findBatch(const RbTreeNode       **results,
+                          const RbTreeAnchor&      tree,
+                          NODE_VALUE_COMPARATOR&   comparator,
+                          const VALUE *const      *values,
+                          int                      numValues);
+        // Load into each of the specified 'numValues' elements of the
+        // specified 'results' array the address that 'find' would return for
+        // the value referred to by the corresponding element of the specified
+        // 'values' array in the specified 'tree' (organized according to the
+        // specified 'comparator').  Descend the tree for each group of values
+        // in lockstep, prefetching the nodes to be visited (see
+        // {Batched Search}).  'COMPARATOR' shall meet the requirements of
+        // 'find'.  The behavior is undefined unless '0 <= numValues', each
+        // array has at least 'numValues' elements, 'comparator' provides a
+        // strict weak ordering on objects of type 'VALUE', and 'tree' is
+        // well-formed (see 'isWellFormed').
+
                                  // Modification
 
     template <class FACTORY>
@@ -980,6 +1045,36 @@ struct RbTreeUtil {
         // conjunction with the 'findInsertLocation' or
         // 'findUniqueInsertLocation' methods.
 
+    template <class NODE_COMPARATOR>
+    static void merge(RbTreeAnchor     *tree,
+                      RbTreeAnchor     *source,
+                      NODE_COMPARATOR&  comparator,
+                      bool              uniqueFlag);
+        // Move the nodes of the specified 'source' tree into the specified
+        // 'tree', both organized according to the specified 'comparator'.  If
+        // the specified 'uniqueFlag' is 'true', a node of 'source' comparing
+        // equal to a node of 'tree' is not moved, and the nodes that are not
+        // moved are left in 'source'; otherwise, all nodes are moved, and each
+        // node of 'source' is placed after the nodes of 'tree' comparing equal
+        // to it, preserving the relative order of the nodes of 'source'.
+        // Both resulting trees will be well-formed (see 'isWellFormed').
+        // This operation takes O(N + M) operations if 'M * log(N + M)' is not
+        // smaller than 'N + M', and O(M * log(N + M)) operations otherwise,
+        // where N and M are the respective number of nodes in 'tree' and
+        // 'source'.  'NODE_COMPARATOR' shall be a functor providing a method
+        // that can be called as if it had the following signature:
+        //..
+        //  bool operator()(const RbTreeNode&, const RbTreeNode&) const;
+        //..
+        // The behavior is undefined unless 'comparator' provides a strict
+        // weak ordering on the nodes of 'tree' and 'source', 'tree' and
+        // 'source' are distinct, 'tree' is well-formed, 'source' is either
+        // well-formed or a vine (see {Vines}), and, if 'uniqueFlag' is
+        // 'true', no two nodes of 'tree', and no two nodes of 'source',
+        // compare equal.  Note that if 'comparator' throws, both trees are
+        // left well-formed, but some nodes of 'source' may have been moved
+        // into 'tree'.
+
     static void remove(RbTreeAnchor *tree, RbTreeNode *node);
         // Remove the specified 'node' from the specified 'tree', and then
         // rebalance 'tree' so that it again forms a valid red-black tree (see
@@ -992,6 +1087,32 @@ struct RbTreeUtil {
         // exception-safety guarantee.  The behavior is undefined unless 'a'
         // and 'b' are well-formed (see 'isWellFormed').
 
+                                 // Bulk Construction
+
+    static void appendToVine(RbTreeAnchor *vine, RbTreeNode *newNode);
+        // Append the specified 'newNode' to the end of the specified 'vine'
+        // (see {Vines}), so that 'newNode' becomes the last (and root) node of
+        // 'vine'.  This operation takes constant time and performs no
+        // comparisons.  The behavior is undefined unless 'vine' is a vine, and
+        // 'newNode' is not a node in 'vine' and would not be ordered before
+        // any node of 'vine'.
+
+    static void treeToVine(RbTreeAnchor *tree);
+        // Rearrange the nodes of the specified 'tree' into a vine (see
+        // {Vines}) holding the same nodes in the same order.  This operation
+        // takes O(N) operations, where N is the number of nodes in 'tree',
+        // and performs no comparisons.  The behavior is undefined unless
+        // 'tree' is a valid binary tree whose first node and node count are
+        // correct (e.g., 'tree' is well-formed or is a vine).
+
+    static void vineToTree(RbTreeAnchor *vine);
+        // Rearrange the nodes of the specified 'vine' (see {Vines}) into a
+        // balanced tree holding the same nodes in the same order, and color
+        // them so that the resulting tree is well-formed (see
+        // 'isWellFormed').  This operation takes O(N) operations, where N is
+        // the number of nodes in 'vine', and performs no comparisons.  The
+        // behavior is undefined unless 'vine' is a vine.
+
                                  // Utility
 
     static bool isLeftChild(const RbTreeNode *node);
@@ -1205,6 +1326,45 @@ struct RbTreeUtil_Validator {
         // 'RbTreeUtil::isWellFormed').
 };
 
+                        // ==========================
+                        // class RbTreeUtil_VineGuard
+                        // ==========================
+
+class RbTreeUtil_VineGuard {
+    // This component-private class implements a guard that, on destruction,
+    // appends to a vine (see {Vines}) the nodes remaining in an ordered
+    // sequence of nodes detached from that vine (each referring to its
+    // successor as its parent, and the last referring to the vine's
+    // sentinel), and then rebuilds the vine into a well-formed tree.  It is
+    // used by 'RbTreeUtil::merge' to leave both trees well-formed whether
+    // the merge completes or the comparator throws.
+
+    // DATA
+    RbTreeAnchor  *d_vine_p;  // vine to be completed (held, not owned)
+
+    RbTreeNode   **d_node_p;  // address of the first node remaining in the
+                              // detached sequence (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RbTreeUtil_VineGuard(const RbTreeUtil_VineGuard&);
+    RbTreeUtil_VineGuard& operator=(const RbTreeUtil_VineGuard&);
+
+  public:
+    // CREATORS
+    RbTreeUtil_VineGuard(RbTreeAnchor *vine, RbTreeNode **node);
+        // Create a guard that, on destruction, appends to the specified
+        // 'vine' each node of the ordered sequence starting at '*node' (as
+        // '*node' is when the guard is destroyed), where the specified 'node'
+        // is the address of the first node remaining in the sequence, and
+        // then rebuilds 'vine' into a well-formed tree.
+
+    ~RbTreeUtil_VineGuard();
+        // Append the nodes remaining in the sequence supplied at construction
+        // to the vine supplied at construction, and rebuild that vine into a
+        // well-formed tree.
+};
+
                         // ============================
                         // struct RbTreeUtilTreeProctor
                         // ============================
@@ -1330,6 +1490,67 @@ const RbTreeNode *RbTreeUtil::lowerBound(const RbTreeAnchor&    tree,
     return nextLargestNode;
 }
 
+template <class NODE_VALUE_COMPARATOR, class VALUE>
+void RbTreeUtil::findBatch(const RbTreeNode       **results,
+                           const RbTreeAnchor&      tree,
+                           NODE_VALUE_COMPARATOR&   comparator,
+                           const VALUE *const      *values,
+                           int                      numValues)
+{
+    BSLS_ASSERT_SAFE(results);
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    enum { k_GROUP_SIZE = 16 };  // searches whose misses may be outstanding
+
+    for (int base = 0; base < numValues; base += k_GROUP_SIZE) {
+        const int numInGroup = numValues - base < k_GROUP_SIZE
+                             ? numValues - base
+                             : k_GROUP_SIZE;
+
+        // As in 'lowerBound', 'results[base + i]' holds the leftmost node
+        // visited that is not less than 'values[base + i]'.
+
+        const RbTreeNode  *nodes[k_GROUP_SIZE];
+        const RbTreeNode **bounds = results + base;
+
+        for (int i = 0; i < numInGroup; ++i) {
+            nodes[i]  = tree.rootNode();
+            bounds[i] = tree.sentinel();
+        }
+
+        int numActive = tree.rootNode() ? numInGroup : 0;
+        while (0 < numActive) {
+            numActive = 0;
+            for (int i = 0; i < numInGroup; ++i) {
+                const RbTreeNode *node = nodes[i];
+                if (!node) {
+                    continue;
+                }
+                if (comparator(*node, *values[base + i])) {
+                    node = node->rightChild();
+                }
+                else {
+                    bounds[i] = node;
+                    node = node->leftChild();
+                }
+                if (node) {
+                    bsls::PerformanceHint::prefetchForReading(node);
+                    ++numActive;
+                }
+                nodes[i] = node;
+            }
+        }
+
+        for (int i = 0; i < numInGroup; ++i) {
+            if (bounds[i] != tree.sentinel()
+             && comparator(*values[base + i], *bounds[i])) {
+                bounds[i] = tree.sentinel();
+            }
+        }
+    }
+}
+
 template <class NODE_VALUE_COMPARATOR, class VALUE>
 inline
 RbTreeNode *RbTreeUtil::upperBound(RbTreeAnchor&          tree,
@@ -1673,6 +1894,108 @@ void RbTreeUtil::insert(RbTreeAnchor           *tree,
     return insertAt(tree, parent, leftChildFlag, newNode);
 }
 
+template <class NODE_COMPARATOR>
+void RbTreeUtil::merge(RbTreeAnchor     *tree,
+                       RbTreeAnchor     *source,
+                       NODE_COMPARATOR&  comparator,
+                       bool              uniqueFlag)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(source);
+    BSLS_ASSERT_SAFE(tree != source);
+
+    const int treeSize   = tree->numNodes();
+    const int sourceSize = source->numNodes();
+
+    if (0 == sourceSize) {
+        return;                                                       // RETURN
+    }
+
+    // Detach the nodes of 'source' as an ordered sequence, by flattening it
+    // into a vine (in which the parent of each node is its successor).  Nodes
+    // that are not moved into 'tree' are appended back onto 'source', and
+    // 'sourceGuard' rebuilds 'source' (after appending any nodes not yet
+    // visited, if 'comparator' throws).
+
+    treeToVine(source);
+    RbTreeNode *sourceNode = source->firstNode();
+    source->reset(0, source->sentinel(), 0);
+    RbTreeUtil_VineGuard sourceGuard(source, &sourceNode);
+
+    int logTotal = 0;
+    for (int n = treeSize + sourceSize; n > 1; n >>= 1) {
+        ++logTotal;
+    }
+
+    if (0 != treeSize && sourceSize < (treeSize + sourceSize) / logTotal) {
+        // 'source' is small relative to 'tree': inserting its nodes one at a
+        // time is cheaper than a linear merge, which must visit every node of
+        // 'tree'.
+
+        while (source->sentinel() != sourceNode) {
+            RbTreeNode *nextNode = sourceNode->parent();
+            if (uniqueFlag) {
+                int         comparisonResult;
+                RbTreeNode *parent = findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            tree,
+                                                            comparator,
+                                                            *sourceNode);
+                if (comparisonResult) {
+                    insertAt(tree, parent, comparisonResult < 0, sourceNode);
+                }
+                else {
+                    appendToVine(source, sourceNode);
+                }
+            }
+            else {
+                bool        leftChildFlag;
+                RbTreeNode *parent = findInsertLocation(&leftChildFlag,
+                                                        tree,
+                                                        comparator,
+                                                        *sourceNode);
+                insertAt(tree, parent, leftChildFlag, sourceNode);
+            }
+            sourceNode = nextNode;
+        }
+        return;                                                       // RETURN
+    }
+
+    // Detach the nodes of 'tree' in the same way, and merge the two ordered
+    // sequences back into 'tree' as a vine.  Note that 'treeGuard' appends
+    // the nodes of 'tree' not yet visited, which are ordered after all of
+    // those already merged, and rebuilds 'tree'.
+
+    treeToVine(tree);
+    RbTreeNode *treeNode = tree->firstNode();
+    tree->reset(0, tree->sentinel(), 0);
+    RbTreeUtil_VineGuard treeGuard(tree, &treeNode);
+
+    while (tree->sentinel() != treeNode && source->sentinel() != sourceNode) {
+        RbTreeNode *nextNode;
+        if (comparator(*sourceNode, *treeNode)) {
+            nextNode = sourceNode->parent();
+            appendToVine(tree, sourceNode);
+            sourceNode = nextNode;
+        }
+        else if (uniqueFlag && !comparator(*treeNode, *sourceNode)) {
+            nextNode = sourceNode->parent();
+            appendToVine(source, sourceNode);
+            sourceNode = nextNode;
+        }
+        else {
+            nextNode = treeNode->parent();
+            appendToVine(tree, treeNode);
+            treeNode = nextNode;
+        }
+    }
+    while (source->sentinel() != sourceNode) {
+        RbTreeNode *nextNode = sourceNode->parent();
+        appendToVine(tree, sourceNode);
+        sourceNode = nextNode;
+    }
+}
+
 inline
 bool RbTreeUtil::isLeftChild(const RbTreeNode *node)
 {
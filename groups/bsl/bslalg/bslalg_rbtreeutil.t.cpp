@@ -64,6 +64,7 @@ using namespace bslalg;
 // [11]       RbTreeNode *lowerBound(Anchor&, const COMP&, const VALUE&);
 // [12] const RbTreeNode *upperBound(const Anchor&, const COMP&, const VALUE&);
 // [12]       RbTreeNode *upperBound(Anchor&, const COMP&, const VALUE&);
+// [28] void findBatch(const Node **, const Anchor&, COMP&, VAL **, int);
 // Modification
 // [20] void copyTree(RbTreeAnchor *, const RbTreeAnchor& , FACTORY *);
 // [19] void deleteTree(RbTreeAnchor *, FACTORY *);
@@ -73,12 +74,16 @@ using namespace bslalg;
 // [16] RbTreeNode *findUniqueInsertLocation(int *,Anchor*,COMP&,VALUE&,Node*);
 // [ 9] void insert(RbTreeAnchor *, const COMP& , RbTreeNode *);
 // [17] void insertAt(RbTreeAnchor *,RbTreeNode *, bool, RbTreeNode *);
+// [27] void merge(RbTreeAnchor *, RbTreeAnchor *, const COMP&, bool);
 // [18] void remove(RbTreeAnchor *, RbTreeNode *);
 // [21] void swap(RbTreeAnchor *, RbTreeAnchor *);
 // [22] bool isLeftChild(const RbTreeNode *);
 // [22] bool isRightChild(const RbTreeNode *);
 // [23] void rotateLeft(RbTreeNode *);
 // [23] void rotateRight(RbTreeNode *);
+// [26] void appendToVine(RbTreeAnchor *, RbTreeNode *);
+// [26] void treeToVine(RbTreeAnchor *);
+// [26] void vineToTree(RbTreeAnchor *);
 // Testing
 // [24] void printTreeStructure(FILE *, const Node *, Callback, int, int);
 // [ 7] int validateRbTree(const RbTreeNode *, const COMP& );
@@ -87,7 +92,7 @@ using namespace bslalg;
 // [ 2] Validator::isWellFormedAnchor(const RbTreeAnchor& ,const COMPR& );
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [29] USAGE EXAMPLE
 // [ 3] CONCERN: gg Generator
 // [25] CONCERN: Additional verification of exception safety of 'copyTree'
 
@@ -227,6 +232,68 @@ struct IntNodeValueComparator {
     }
 };
 
+struct CountingIntNodeComparator {
+    // A 'RbTreeUtil' complaint node comparison functor for 'IntNode' objects
+    // that counts the number of comparisons it performs, and (in exception
+    // enabled builds) throws an 'int' once a limit on that number is reached.
+
+    int *d_count_p;  // number of comparisons performed (held, not owned)
+    int  d_limit;    // number of comparisons after which to throw, or -1
+
+    explicit CountingIntNodeComparator(int *count, int limit = -1)
+        // Create a comparator that increments the specified 'count' on each
+        // comparison.  Optionally specify a 'limit' on the value of 'count'
+        // at which a comparison throws (in exception enabled builds).
+    : d_count_p(count)
+    , d_limit(limit)
+    {
+    }
+
+    bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const {
+        // Return 'true' if the integer value in the specified 'lhs' node is
+        // less than that of the specified 'rhs' node.
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (*d_count_p == d_limit) {
+            throw d_limit;
+        }
+#endif
+        ++*d_count_p;
+        return static_cast<const IntNode&>(lhs).value() <
+               static_cast<const IntNode&>(rhs).value();
+    }
+};
+
+bool isVine(const RbTreeAnchor& vine)
+    // Return 'true' if the specified 'vine' is a vine (see {Vines} in the
+    // component documentation) holding nodes in non-decreasing order of
+    // their 'IntNode' values, and 'false' otherwise.
+{
+    if (0 == vine.rootNode()) {
+        return 0 == vine.numNodes() && vine.sentinel() == vine.firstNode();
+                                                                      // RETURN
+    }
+    if (vine.sentinel() != vine.rootNode()->parent()) {
+        return false;                                                 // RETURN
+    }
+    int            count = 0;
+    const IntNode *node  = static_cast<const IntNode *>(vine.rootNode());
+    const IntNode *last  = 0;
+    while (node) {
+        if (node->rightChild()) {
+            return false;                                             // RETURN
+        }
+        if (last && (node->parent() != last
+                  || last->value() < node->value())) {
+            return false;                                             // RETURN
+        }
+        ++count;
+        last = node;
+        node = static_cast<const IntNode *>(node->leftChild());
+    }
+    return count == vine.numNodes() && last == vine.firstNode();
+}
+
 void assignIntNodeValue(IntNode *node, int value)
     // Assign to the specified 'node' the specified 'value'.  Note that this
     // function signature is designed to be used by the 'gg' generator function
@@ -5703,7 +5770,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 26: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5779,6 +5846,493 @@ int main(int argc, char *argv[])
               }
           }
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD: findBatch
+        //
+        // Concerns:
+        //:  1 'findBatch' loads, for each value, the same address 'find'
+        //:    returns for that value, whether or not the value is held by the
+        //:    tree, and whether or not it is held by several nodes.
+        //:
+        //:  2 Values are found correctly whatever their number, in particular
+        //:    when it is not a multiple of the size of the groups searched in
+        //:    lockstep, and when the tree is empty.
+        //:
+        //:  3 QoI: Asserted precondition violations are detected when
+        //:    enabled.
+        //
+        // Plan:
+        //:  1 For a range of tree sizes, build a tree holding each even value
+        //:    twice, and search it with 'findBatch' for a range of values
+        //:    (both odd and even, and including values outside the range held
+        //:    by the tree), in batches of varying size.  Verify each result
+        //:    against 'find'.  (C-1..2)
+        //:
+        //:  2 Verify that, in appropriate build modes, defensive checks are
+        //:    triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void findBatch(const Node **, const Anchor&, COMP&, VAL **, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD: findBatch"
+                            "\n=======================\n");
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 33, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            Array<IntNode> nodes(&ta);
+            nodes.reset(N);
+
+            IntNodeComparator nodeComparator;
+            RbTreeAnchor      tree;
+            for (int i = 0; i < N; ++i) {
+                nodes[i].value() = 2 * (i / 2);
+                Obj::insert(&tree, nodeComparator, &nodes[i]);
+            }
+
+            // Search for each value in '[-2 .. N + 2]', starting at each of
+            // the first few values, so that the batches have varying sizes.
+
+            for (int first = -2; first < 3; ++first) {
+                const int NUM_VALUES = N + 3 - first;
+
+                Array<int>                values(&ta);
+                Array<const int *>        valuePtrs(&ta);
+                Array<const RbTreeNode *> results(&ta);
+                values.reset(NUM_VALUES);
+                valuePtrs.reset(NUM_VALUES);
+                results.reset(NUM_VALUES);
+
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    values[i]    = first + i;
+                    valuePtrs[i] = &values[i];
+                }
+
+                IntNodeValueComparator comparator;
+                Obj::findBatch(results.data(),
+                               tree,
+                               comparator,
+                               valuePtrs.data(),
+                               NUM_VALUES);
+
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    const RbTreeNode *EXP = Obj::find(tree,
+                                                      comparator,
+                                                      values[i]);
+                    ASSERTV(N, first, i, EXP == results[i]);
+                }
+            }
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            IntNodeValueComparator  comparator;
+            RbTreeAnchor            tree;
+            const int               VALUE = 0;
+            const int              *values[1] = { &VALUE };
+#if defined(BDE_BUILD_TARGET_EXC) && defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
+            const int *const       *NULL_VALUES = 0;
+#endif
+            const RbTreeNode       *results[1];
+
+            ASSERT_SAFE_PASS(Obj::findBatch(results, tree, comparator,
+                                            values, 1));
+            ASSERT_SAFE_PASS(Obj::findBatch(results, tree, comparator,
+                                            values, 0));
+            ASSERT_SAFE_FAIL(Obj::findBatch(      0, tree, comparator,
+                                            values, 1));
+            ASSERT_SAFE_FAIL(Obj::findBatch(results, tree, comparator,
+                                            NULL_VALUES, 1));
+            ASSERT_SAFE_FAIL(Obj::findBatch(results, tree, comparator,
+                                            values, -1));
+        }
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD: merge
+        //
+        // Concerns:
+        //:  1 'merge' moves every node of the source tree into the target
+        //:    tree, leaving both trees well-formed.
+        //:
+        //:  2 If 'uniqueFlag' is 'true', a source node comparing equal to a
+        //:    target node is not moved, and is left in the source tree.
+        //:
+        //:  3 If 'uniqueFlag' is 'false', each moved node follows the target
+        //:    nodes comparing equal to it, and the relative order of the
+        //:    source nodes is preserved.
+        //:
+        //:  4 Both the linear merge and the node-by-node insertion used for
+        //:    a small source tree behave as in C-1..3.
+        //:
+        //:  5 The number of comparisons is linear in the total number of
+        //:    nodes.
+        //:
+        //:  6 If the comparator throws, both trees are left well-formed, and
+        //:    no node is lost.
+        //:
+        //:  7 QoI: Asserted precondition violations are detected when
+        //:    enabled.
+        //
+        // Plan:
+        //:  1 For a range of target and source sizes (covering both of the
+        //:    strategies of C-4), and a range of offsets between the values
+        //:    held by the two trees, build a target and a source tree, merge
+        //:    them, and verify the resulting trees are well-formed, hold the
+        //:    expected values, and that the relative order of the nodes is as
+        //:    described in C-2..3.  Verify the number of comparisons is at
+        //:    most four times the total number of nodes.  (C-1..5)
+        //:
+        //:  2 Using a comparator that throws after a given number of
+        //:    comparisons, merge trees for each such number until no exception
+        //:    is thrown, and verify both trees are well-formed and together
+        //:    hold all the nodes.  (C-6)
+        //:
+        //:  3 Verify that, in appropriate build modes, defensive checks are
+        //:    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void merge(RbTreeAnchor *, RbTreeAnchor *, const COMP&, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHOD: merge"
+                            "\n===================\n");
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 33, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int uniqueFlag = 0; uniqueFlag < 2; ++uniqueFlag) {
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        for (int si = 0; si < NUM_SIZES; ++si) {
+        for (int offset = -3; offset <= 3; ++offset) {
+            const int N = SIZES[ti];
+            const int M = SIZES[si];
+
+            // Target values are '0, 2, 4, ...'; source values are
+            // 'offset, offset + 3, ...' in the unique case, and
+            // 'offset, offset, offset + 3, offset + 3, ...' otherwise.
+
+            Array<IntNode> targetNodes(&ta);
+            Array<IntNode> sourceNodes(&ta);
+            targetNodes.reset(N);
+            sourceNodes.reset(M);
+
+            IntNodeComparator nodeComparator;
+            RbTreeAnchor      target;
+            RbTreeAnchor      source;
+            for (int i = 0; i < N; ++i) {
+                targetNodes[i].value() = 2 * i;
+                Obj::insert(&target, nodeComparator, &targetNodes[i]);
+            }
+            for (int i = 0; i < M; ++i) {
+                sourceNodes[i].value() = offset
+                                       + 3 * (uniqueFlag ? i : i / 2);
+                Obj::insert(&source, nodeComparator, &sourceNodes[i]);
+            }
+
+            int expMoved = M;
+            if (uniqueFlag) {
+                for (int i = 0; i < M; ++i) {
+                    const int VALUE = sourceNodes[i].value();
+                    if (0 <= VALUE && VALUE < 2 * N && 0 == VALUE % 2) {
+                        --expMoved;
+                    }
+                }
+            }
+
+            int                       numComparisons = 0;
+            CountingIntNodeComparator countingComparator(&numComparisons);
+            Obj::merge(&target, &source, countingComparator, uniqueFlag);
+
+            ASSERTV(uniqueFlag, N, M, offset,
+                    Obj::isWellFormed(target, nodeComparator));
+            ASSERTV(uniqueFlag, N, M, offset,
+                    Obj::isWellFormed(source, nodeComparator));
+            ASSERTV(uniqueFlag, N, M, offset, target.numNodes(),
+                    N + expMoved == target.numNodes());
+            ASSERTV(uniqueFlag, N, M, offset, source.numNodes(),
+                    M - expMoved == source.numNodes());
+            ASSERTV(uniqueFlag, N, M, offset, numComparisons,
+                    numComparisons <= 4 * (N + M));
+
+            // Verify the order of the nodes in 'target'.
+
+            const IntNode *prev = 0;
+            for (const RbTreeNode *node = target.firstNode();
+                 target.sentinel() != node;
+                 node = Obj::next(node)) {
+                const IntNode *curr = static_cast<const IntNode *>(node);
+                if (prev && prev->value() == curr->value()) {
+                    const bool prevIsSource = sourceNodes.data() <= prev
+                                        && prev < sourceNodes.data() + M;
+                    const bool currIsSource = sourceNodes.data() <= curr
+                                        && curr < sourceNodes.data() + M;
+
+                    ASSERTV(uniqueFlag, N, M, offset, !uniqueFlag);
+                    ASSERTV(uniqueFlag, N, M, offset,
+                            !prevIsSource || currIsSource);
+                    ASSERTV(uniqueFlag, N, M, offset,
+                            !currIsSource || !prevIsSource || prev < curr);
+                }
+                prev = curr;
+            }
+
+            // Verify the nodes remaining in 'source' are those whose values
+            // are held by 'target'.
+
+            for (const RbTreeNode *node = source.firstNode();
+                 source.sentinel() != node;
+                 node = Obj::next(node)) {
+                const int VALUE = static_cast<const IntNode *>(node)->value();
+                ASSERTV(uniqueFlag, N, M, offset, VALUE,
+                        0 <= VALUE && VALUE < 2 * N && 0 == VALUE % 2);
+            }
+        }
+        }
+        }
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tTest exception safety.\n");
+        for (int uniqueFlag = 0; uniqueFlag < 2; ++uniqueFlag) {
+        for (int si = 0; si < 2; ++si) {
+            // Use a small source (node-by-node insertion) and a source of the
+            // same size as the target (linear merge).
+
+            const int N = 100;
+            const int M = 0 == si ? 3 : N;
+
+            for (int limit = 0; ; ++limit) {
+                Array<IntNode> targetNodes(&ta);
+                Array<IntNode> sourceNodes(&ta);
+                targetNodes.reset(N);
+                sourceNodes.reset(M);
+
+                IntNodeComparator nodeComparator;
+                RbTreeAnchor      target;
+                RbTreeAnchor      source;
+                for (int i = 0; i < N; ++i) {
+                    targetNodes[i].value() = 2 * i;
+                    Obj::insert(&target, nodeComparator, &targetNodes[i]);
+                }
+                for (int i = 0; i < M; ++i) {
+                    sourceNodes[i].value() = 3 * i;
+                    Obj::insert(&source, nodeComparator, &sourceNodes[i]);
+                }
+
+                int                       numComparisons = 0;
+                CountingIntNodeComparator throwingComparator(&numComparisons,
+                                                             limit);
+                bool                      threwFlag = false;
+                try {
+                    Obj::merge(&target,
+                               &source,
+                               throwingComparator,
+                               uniqueFlag);
+                }
+                catch (int) {
+                    threwFlag = true;
+                }
+
+                ASSERTV(uniqueFlag, M, limit,
+                        Obj::isWellFormed(target, nodeComparator));
+                ASSERTV(uniqueFlag, M, limit,
+                        Obj::isWellFormed(source, nodeComparator));
+                ASSERTV(uniqueFlag, M, limit,
+                        N + M == target.numNodes() + source.numNodes());
+
+                if (!threwFlag) {
+                    break;
+                }
+            }
+        }
+        }
+#endif
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            IntNodeComparator nodeComparator;
+            RbTreeAnchor      x, y;
+            ASSERT_SAFE_PASS(Obj::merge(&x, &y, nodeComparator, true));
+            ASSERT_SAFE_FAIL(Obj::merge(&x, &x, nodeComparator, true));
+            ASSERT_SAFE_FAIL(Obj::merge( 0, &y, nodeComparator, true));
+            ASSERT_SAFE_FAIL(Obj::merge(&x,  0, nodeComparator, true));
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS: appendToVine, treeToVine, vineToTree
+        //
+        // Concerns:
+        //:  1 'appendToVine' appends the supplied node as the last (root)
+        //:    node of a vine, maintaining the first node and node count.
+        //:
+        //:  2 'vineToTree' produces a well-formed tree holding the nodes of
+        //:    the vine in the same order, for every number of nodes.
+        //:
+        //:  3 'treeToVine' produces a vine holding the nodes of the tree in
+        //:    the same order, for any tree shape.
+        //:
+        //:  4 A vine can be destroyed by 'RbTreeUtilTreeProctor'.
+        //:
+        //:  5 QoI: Asserted precondition violations are detected when
+        //:    enabled.
+        //
+        // Plan:
+        //:  1 For each number of nodes from 0 to 130, append nodes with
+        //:    increasing values to an empty vine, verifying the vine after
+        //:    each append.  (C-1)
+        //:
+        //:  2 Convert the vine to a tree and verify it is well-formed and
+        //:    holds the nodes in order; convert it back to a vine, and then
+        //:    to a tree again, and verify the results.  (C-2..3)
+        //:
+        //:  3 Build trees of various sizes by inserting nodes in a
+        //:    pseudo-random order, convert each to a vine and back, and
+        //:    verify the results.  (C-2..3)
+        //:
+        //:  4 Build a vine of 'DeleteTestNode' objects, guard it with a
+        //:    'RbTreeUtilTreeProctor', and verify all nodes are deleted when
+        //:    the proctor is destroyed.  (C-4)
+        //:
+        //:  5 Verify that, in appropriate build modes, defensive checks are
+        //:    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void appendToVine(RbTreeAnchor *, RbTreeNode *);
+        //   void treeToVine(RbTreeAnchor *);
+        //   void vineToTree(RbTreeAnchor *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHODS: appendToVine, treeToVine, "
+                            "vineToTree"
+                            "\n========================================="
+                            "==========\n");
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+        IntNodeComparator    nodeComparator;
+
+        if (verbose) printf("\tBuild vines and convert them to trees.\n");
+        for (int n = 0; n <= 130; ++n) {
+            Array<IntNode> nodes(&ta);
+            nodes.reset(n);
+
+            RbTreeAnchor tree;
+            for (int i = 0; i < n; ++i) {
+                nodes[i].value() = i / 2;
+                Obj::appendToVine(&tree, &nodes[i]);
+
+                ASSERTV(n, i, isVine(tree));
+                ASSERTV(n, i, i + 1 == tree.numNodes());
+                ASSERTV(n, i, &nodes[i] == tree.rootNode());
+                ASSERTV(n, i, &nodes[0] == tree.firstNode());
+            }
+            ASSERTV(n, isVine(tree));
+
+            for (int pass = 0; pass < 2; ++pass) {
+                Obj::vineToTree(&tree);
+
+                ASSERTV(n, pass, Obj::isWellFormed(tree, nodeComparator));
+                ASSERTV(n, pass, n == tree.numNodes());
+
+                int i = 0;
+                for (RbTreeNode *node = tree.firstNode();
+                     tree.sentinel() != node;
+                     node = Obj::next(node)) {
+                    ASSERTV(n, pass, i, &nodes[i] == node);
+                    ++i;
+                }
+                ASSERTV(n, pass, i, n == i);
+
+                Obj::treeToVine(&tree);
+
+                ASSERTV(n, pass, isVine(tree));
+                ASSERTV(n, pass, n == tree.numNodes());
+                ASSERTV(n, pass, 0 == n || &nodes[0] == tree.firstNode());
+            }
+        }
+
+        if (verbose) printf("\tConvert trees of arbitrary shape.\n");
+        for (int n = 0; n <= 130; n += 3) {
+            Array<IntNode> nodes(&ta);
+            nodes.reset(n);
+
+            RbTreeAnchor tree;
+            for (int i = 0; i < n; ++i) {
+                nodes[i].value() = (i * 37) % 41;
+                Obj::insert(&tree, nodeComparator, &nodes[i]);
+            }
+            ASSERTV(n, Obj::isWellFormed(tree, nodeComparator));
+
+            const RbTreeNode *first = tree.firstNode();
+
+            Obj::treeToVine(&tree);
+
+            ASSERTV(n, isVine(tree));
+            ASSERTV(n, n == tree.numNodes());
+            ASSERTV(n, first == tree.firstNode());
+
+            Obj::vineToTree(&tree);
+
+            ASSERTV(n, Obj::isWellFormed(tree, nodeComparator));
+            ASSERTV(n, n == tree.numNodes());
+            ASSERTV(n, first == tree.firstNode());
+        }
+
+        if (verbose) printf("\tDestroy a vine with a proctor.\n");
+        {
+            const int             NUM_NODES = 20;
+            Array<DeleteTestNode> nodes(&ta);
+            nodes.reset(NUM_NODES);
+
+            DeleteTestNodeFactory factory;
+            {
+                RbTreeAnchor tree;
+                RbTreeUtilTreeProctor<DeleteTestNodeFactory> proctor(&tree,
+                                                                     &factory);
+                for (int i = 0; i < NUM_NODES; ++i) {
+                    nodes[i].d_value   = i;
+                    nodes[i].d_deleted = false;
+                    Obj::appendToVine(&tree, &nodes[i]);
+                }
+            }
+            for (int i = 0; i < NUM_NODES; ++i) {
+                ASSERTV(i, nodes[i].d_deleted);
+            }
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            RbTreeAnchor tree;
+            IntNode      node;
+            node.reset(0, 0, 0, BLACK);
+            ASSERT_FAIL(Obj::appendToVine(0, &node));
+            ASSERT_FAIL(Obj::appendToVine(&tree, 0));
+            ASSERT_PASS(Obj::appendToVine(&tree, &node));
+            ASSERT_FAIL(Obj::treeToVine(0));
+            ASSERT_PASS(Obj::treeToVine(&tree));
+            ASSERT_FAIL(Obj::vineToTree(0));
+            ASSERT_PASS(Obj::vineToTree(&tree));
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // CLASS METHOD: copyTree (Additional Exception Safety Tests)
@@ -1,12 +1,15 @@
 {
   'variables': {
     'bslim_sources': [
+      'bslim_formatbuffer.cpp',
       'bslim_printer.cpp',
     ],
     'bslim_tests': [
+      'bslim_formatbuffer.t',
       'bslim_printer.t',
     ],
     'bslim_tests_paths': [
+      '<(PRODUCT_DIR)/bslim_formatbuffer.t',
       '<(PRODUCT_DIR)/bslim_printer.t',
     ],
     'bslim_pkgdeps': [
@@ -68,6 +71,14 @@
       'xcode_settings': { 'LD_DYLIB_INSTALL_NAME': '' },
     },
 
+    {
+      'target_name': 'bslim_formatbuffer.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslim_pkgdeps)', 'bslim' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslim_formatbuffer.t.cpp' ],
+    },
     {
       'target_name': 'bslim_printer.t',
       'type': 'executable',
@@ -0,0 +1,240 @@
+// bslim_formatbuffer.cpp                                             -*-C++-*-
+#include <bslim_formatbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_platform.h>
+
+#include <stdio.h>     // 'snprintf' [NOT '<cstdio>', which does not include
+                       // 'snprintf']
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_MIN_ALLOCATED_CAPACITY = 256  // capacity of the first buffer obtained
+                                    // from the allocator
+};
+
+static const char s_digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+    // Decimal representations of the values 0 to 99, two digits each.
+
+inline
+char *formatDecimal(char *end, bsls::Types::Uint64 value)
+    // Write the decimal representation of the specified 'value' to the
+    // characters immediately preceding the specified 'end', and return the
+    // address of the first character written.  The behavior is undefined
+    // unless at least 20 characters precede 'end'.
+{
+    // Produce two digits per division, which halves the number of (slow)
+    // 64-bit divisions.
+
+    while (value >= 100) {
+        const unsigned pair = static_cast<unsigned>(value % 100) * 2;
+        value /= 100;
+        *--end = s_digitPairs[pair + 1];
+        *--end = s_digitPairs[pair];
+    }
+    if (value >= 10) {
+        const unsigned pair = static_cast<unsigned>(value) * 2;
+        *--end = s_digitPairs[pair + 1];
+        *--end = s_digitPairs[pair];
+    }
+    else {
+        *--end = static_cast<char>('0' + value);
+    }
+    return end;
+}
+
+}  // close unnamed namespace
+
+namespace bslim {
+
+                            // ------------------
+                            // class FormatBuffer
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+void FormatBuffer::grow(int numCharacters)
+{
+    BSLS_ASSERT(0 <= numCharacters);
+
+    const int length = this->length();
+
+    int newCapacity = capacity() * 2;
+    if (newCapacity < k_MIN_ALLOCATED_CAPACITY) {
+        newCapacity = k_MIN_ALLOCATED_CAPACITY;
+    }
+    if (newCapacity - length < numCharacters) {
+        newCapacity = length + numCharacters;
+    }
+
+    char *newBuffer = static_cast<char *>(
+                                       d_allocator_p->allocate(newCapacity));
+    if (length) {
+        bsl::memcpy(newBuffer, pbase(), length);
+    }
+    if (d_allocatedBuffer_p) {
+        d_allocator_p->deallocate(d_allocatedBuffer_p);
+    }
+    d_allocatedBuffer_p = newBuffer;
+
+    setp(newBuffer, newBuffer + newCapacity);
+    pbump(length);
+}
+
+// PROTECTED MANIPULATORS
+FormatBuffer::int_type FormatBuffer::overflow(int_type character)
+{
+    if (traits_type::eq_int_type(character, traits_type::eof())) {
+        return traits_type::not_eof(character);                       // RETURN
+    }
+
+    append(traits_type::to_char_type(character));
+    return character;
+}
+
+bsl::streamsize FormatBuffer::xsputn(const char      *string,
+                                     bsl::streamsize  length)
+{
+    append(string, static_cast<int>(length));
+    return length;
+}
+
+// CREATORS
+FormatBuffer::FormatBuffer(bslma::Allocator *basicAllocator)
+: d_allocatedBuffer_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stream(this)
+{
+}
+
+FormatBuffer::FormatBuffer(char             *buffer,
+                           int               capacity,
+                           bslma::Allocator *basicAllocator)
+: d_allocatedBuffer_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stream(this)
+{
+    BSLS_ASSERT(0 <= capacity);
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    setp(buffer, buffer + capacity);
+}
+
+FormatBuffer::~FormatBuffer()
+{
+    if (d_allocatedBuffer_p) {
+        d_allocator_p->deallocate(d_allocatedBuffer_p);
+    }
+}
+
+// MANIPULATORS
+void FormatBuffer::appendDouble(double value)
+{
+    // 'bsl::ostream' formats a 'double' having the default formatting state
+    // using 'printf' format "%.*g" with a precision of 6.
+
+    char      buffer[32];
+    const int length = snprintf(buffer, sizeof buffer, "%.6g", value);
+
+    BSLS_ASSERT(0 < length && length < static_cast<int>(sizeof buffer));
+
+    append(buffer, length);
+}
+
+void FormatBuffer::appendHex(bsls::Types::Uint64 value)
+{
+    static const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+    char  buffer[2 + 16];
+    char *end   = buffer + sizeof buffer;
+    char *begin = end;
+
+    if (0 == value) {
+        append('0');
+        return;                                                       // RETURN
+    }
+
+    for (; value; value >>= 4) {
+        *--begin = k_HEX_DIGITS[value & 0xf];
+    }
+    *--begin = 'x';
+    *--begin = '0';
+
+    append(begin, static_cast<int>(end - begin));
+}
+
+void FormatBuffer::appendInt64(bsls::Types::Int64 value)
+{
+    char  buffer[24];
+    char *end = buffer + sizeof buffer;
+
+    // Negate in unsigned arithmetic, which is well-defined for the most
+    // negative value.
+
+    const bsls::Types::Uint64 magnitude = value < 0
+                               ? 0 - static_cast<bsls::Types::Uint64>(value)
+                               : static_cast<bsls::Types::Uint64>(value);
+
+    char *begin = formatDecimal(end, magnitude);
+    if (value < 0) {
+        *--begin = '-';
+    }
+
+    append(begin, static_cast<int>(end - begin));
+}
+
+void FormatBuffer::appendUint64(bsls::Types::Uint64 value)
+{
+    char  buffer[24];
+    char *end   = buffer + sizeof buffer;
+    char *begin = formatDecimal(end, value);
+
+    append(begin, static_cast<int>(end - begin));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
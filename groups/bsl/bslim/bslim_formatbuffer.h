@@ -0,0 +1,382 @@
+// bslim_formatbuffer.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLIM_FORMATBUFFER
+#define INCLUDED_BSLIM_FORMATBUFFER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a stream buffer that formats directly to memory.
+//
+//@CLASSES:
+//  bslim::FormatBuffer: in-memory output buffer with direct formatting
+//
+//@SEE_ALSO: bslim_printer
+//
+//@DESCRIPTION: This component provides a mechanism class,
+// 'bslim::FormatBuffer', that accumulates formatted output in a contiguous
+// region of memory.  Characters and values can be written to a 'FormatBuffer'
+// in two ways:
+//
+//: o Directly, by calling the 'append' family of methods, which copy
+//:   characters into the buffer, and format integers, floating-point values,
+//:   and addresses without constructing a stream sentry or consulting a
+//:   locale.
+//:
+//: o Through a standard 'bsl::ostream', which is provided by the 'stream'
+//:   method, and which writes to the same buffer ('FormatBuffer' is-a
+//:   'bsl::streambuf').  Output written directly and output written through
+//:   the stream are interleaved in the order in which they are written.
+//
+// The second form allows a 'FormatBuffer' to be supplied to any function that
+// writes to a 'bsl::ostream', such as a standard BDE 'print' method; the first
+// form allows code that knows it is writing to a 'FormatBuffer' to bypass the
+// (relatively expensive) 'bsl::ostream' machinery.  In particular,
+// 'bslim::Printer' recognizes a stream whose stream buffer is a
+// 'FormatBuffer', and formats fundamental types, strings, addresses, and
+// indentation directly into the buffer (see 'bslim_printer').
+//
+// The direct formatting methods produce exactly the characters that the
+// corresponding 'bsl::ostream' output operators produce for a stream having
+// the default formatting state (i.e., 'flags() == (skipws | dec)',
+// 'precision() == 6', and 'width() == 0'):
+//..
+//  Method                   Equivalent 'bsl::ostream' output
+//  ----------------------   --------------------------------------------
+//  appendInt64(value)       stream << value
+//  appendUint64(value)      stream << value
+//  appendDouble(value)      stream << value
+//  appendHex(value)         stream << bsl::hex << bsl::showbase << value
+//..
+//
+///Memory Allocation
+///-----------------
+// A 'FormatBuffer' may be supplied with an initial buffer at construction
+// (typically an array on the stack of the caller).  Output is written to the
+// initial buffer until it is full, at which point the output is moved to a
+// buffer obtained from the allocator supplied at construction (or the
+// currently installed default allocator), whose capacity is doubled as
+// necessary.  Note that the accumulated output is always contiguous.
+// 'reset' discards the accumulated output, but retains the current buffer, so
+// that a 'FormatBuffer' that is reused to format a sequence of messages
+// allocates memory only while the size of the largest message grows.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Trace Message
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that we want to emit a trace message describing an order, and that
+// we want to avoid both allocating memory and the cost of 'bsl::ostream'
+// formatting in the common case.
+//
+// First, we create a 'FormatBuffer' supplied with a buffer on the stack:
+//..
+//  char               storage[128];
+//  bslim::FormatBuffer buffer(storage, sizeof storage);
+//..
+// Then, we format the order using the direct formatting methods:
+//..
+//  buffer.append("order: id=");
+//  buffer.appendInt64(12345);
+//  buffer.append(" price=");
+//  buffer.appendDouble(65.89);
+//  buffer.append(" qty=");
+//  buffer.appendUint64(100);
+//..
+// Next, we write a value of a type that can be formatted only with
+// 'operator<<' to the stream provided by the buffer:
+//..
+//  buffer.stream() << ' ' << 'X' << 'Y';
+//..
+// Now, we verify the formatted message, which is contiguous in memory, and
+// was formatted without allocating memory:
+//..
+//  const bsl::string expected("order: id=12345 price=65.89 qty=100 XY");
+//
+//  assert(expected.length() == static_cast<bsl::size_t>(buffer.length()));
+//  assert(0 == bsl::memcmp(expected.data(),
+//                          buffer.data(),
+//                          buffer.length()));
+//  assert(storage == buffer.data());
+//..
+// Finally, we 'reset' the buffer to format the next message:
+//..
+//  buffer.reset();
+//  assert(0 == buffer.length());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOS
+#include <bsl_ios.h>
+#endif
+
+#ifndef INCLUDED_BSL_OSTREAM
+#include <bsl_ostream.h>
+#endif
+
+#ifndef INCLUDED_BSL_STREAMBUF
+#include <bsl_streambuf.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslim {
+
+                            // ==================
+                            // class FormatBuffer
+                            // ==================
+
+class FormatBuffer : public bsl::streambuf {
+    // This class implements an output stream buffer that accumulates
+    // characters in a contiguous region of memory, and that provides methods
+    // to format values directly into that memory.  The put area of the base
+    // 'bsl::streambuf' ('pbase()', 'pptr()', 'epptr()') always describes the
+    // whole of the current buffer, so that output written through 'stream()'
+    // and output written by the 'append' methods are correctly interleaved.
+
+    // DATA
+    char             *d_allocatedBuffer_p;  // buffer obtained from
+                                            // 'd_allocator_p' (owned), or 0
+                                            // if the buffer supplied at
+                                            // construction (if any) is in use
+
+    bslma::Allocator *d_allocator_p;        // memory allocator (held, not
+                                            // owned)
+
+    bsl::ostream      d_stream;             // stream writing to this buffer
+
+  private:
+    // NOT IMPLEMENTED
+    FormatBuffer(const FormatBuffer&);
+    FormatBuffer& operator=(const FormatBuffer&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    void grow(int numCharacters);
+        // Move the accumulated output to a buffer having room for at least
+        // the specified 'numCharacters' additional characters.
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual int_type overflow(int_type character = traits_type::eof());
+        // Append the specified 'character' to this buffer, growing the buffer
+        // if necessary.  Return 'character', or a value other than
+        // 'traits_type::eof()' if 'character' is 'traits_type::eof()'.
+
+    virtual bsl::streamsize xsputn(const char      *string,
+                                   bsl::streamsize  length);
+        // Append the specified 'length' characters of the specified 'string'
+        // to this buffer, growing the buffer if necessary.  Return 'length'.
+
+  public:
+    // CREATORS
+    explicit
+    FormatBuffer(bslma::Allocator *basicAllocator = 0);
+        // Create an empty format buffer.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FormatBuffer(char             *buffer,
+                 int               capacity,
+                 bslma::Allocator *basicAllocator = 0);
+        // Create an empty format buffer that writes to the specified 'buffer'
+        // of the specified 'capacity' until 'buffer' is full.  Optionally
+        // specify a 'basicAllocator' used to supply memory when 'buffer' is
+        // full.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 <= capacity', and 'buffer' refers to an array of at least
+        // 'capacity' characters that outlives this object.
+
+    virtual ~FormatBuffer();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void append(char character);
+        // Append the specified 'character' to this buffer.
+
+    void append(const char *string);
+        // Append the characters of the specified null-terminated 'string' to
+        // this buffer.
+
+    void append(const char *string, int length);
+        // Append the specified 'length' characters of the specified 'string'
+        // to this buffer.  The behavior is undefined unless '0 <= length'.
+
+    void appendDouble(double value);
+        // Append to this buffer the representation of the specified 'value'
+        // produced by 'operator<<' on a 'bsl::ostream' having the default
+        // formatting state (i.e., 'printf' format "%.6g").
+
+    void appendHex(bsls::Types::Uint64 value);
+        // Append to this buffer the hexadecimal representation of the
+        // specified 'value' in lower case, prefixed by "0x" unless 'value' is
+        // 0 (i.e., as formatted by 'bsl::hex' and 'bsl::showbase').
+
+    void appendInt64(bsls::Types::Int64 value);
+        // Append to this buffer the decimal representation of the specified
+        // 'value'.
+
+    void appendSpaces(int numSpaces);
+        // Append the specified 'numSpaces' space characters to this buffer.
+        // This method has no effect if 'numSpaces <= 0'.
+
+    void appendUint64(bsls::Types::Uint64 value);
+        // Append to this buffer the decimal representation of the specified
+        // 'value'.
+
+    void reset();
+        // Discard the output accumulated in this buffer.  Note that the
+        // current buffer (and its capacity) is retained.
+
+    bsl::ostream& stream();
+        // Return a reference providing modifiable access to a stream that
+        // writes to this buffer.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the number of characters that this buffer can hold without
+        // obtaining memory from the allocator.
+
+    const char *data() const;
+        // Return the address of the (contiguous, but not null-terminated)
+        // output accumulated in this buffer.  The returned address is
+        // invalidated by any subsequent output to this buffer.
+
+    int length() const;
+        // Return the number of characters accumulated in this buffer.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class FormatBuffer
+                            // ------------------
+
+// MANIPULATORS
+inline
+void FormatBuffer::append(char character)
+{
+    if (pptr() == epptr()) {
+        grow(1);
+    }
+    *pptr() = character;
+    pbump(1);
+}
+
+inline
+void FormatBuffer::append(const char *string, int length)
+{
+    BSLS_ASSERT_SAFE(string || 0 == length);
+    BSLS_ASSERT_SAFE(0 <= length);
+
+    if (epptr() - pptr() < length) {
+        grow(length);
+    }
+    bsl::memcpy(pptr(), string, length);
+    pbump(length);
+}
+
+inline
+void FormatBuffer::append(const char *string)
+{
+    BSLS_ASSERT_SAFE(string);
+
+    append(string, static_cast<int>(bsl::strlen(string)));
+}
+
+inline
+void FormatBuffer::appendSpaces(int numSpaces)
+{
+    if (numSpaces <= 0) {
+        return;                                                       // RETURN
+    }
+    if (epptr() - pptr() < numSpaces) {
+        grow(numSpaces);
+    }
+    bsl::memset(pptr(), ' ', numSpaces);
+    pbump(numSpaces);
+}
+
+inline
+void FormatBuffer::reset()
+{
+    setp(pbase(), epptr());
+}
+
+inline
+bsl::ostream& FormatBuffer::stream()
+{
+    return d_stream;
+}
+
+// ACCESSORS
+inline
+int FormatBuffer::capacity() const
+{
+    return static_cast<int>(epptr() - pbase());
+}
+
+inline
+const char *FormatBuffer::data() const
+{
+    return pbase();
+}
+
+inline
+int FormatBuffer::length() const
+{
+    return static_cast<int>(pptr() - pbase());
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,744 @@
+// bslim_formatbuffer.t.cpp                                           -*-C++-*-
+
+#include <bslim_formatbuffer.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <stdlib.h>    // 'atoi'
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test implements a stream buffer that accumulates
+// output in contiguous memory, and that formats values directly into that
+// memory.  We first verify that characters are accumulated correctly, both in
+// a buffer supplied at construction and in memory obtained from the allocator
+// once that buffer is full.  We then verify that each direct formatting
+// method produces exactly the output produced by the equivalent 'bsl::ostream'
+// operation, over a set of values that includes the boundary values of each
+// type.  Finally, we verify that output written through 'stream()' and output
+// written directly are correctly interleaved.
+//-----------------------------------------------------------------------------
+// PROTECTED MANIPULATORS
+// [ 5] int_type overflow(int_type character);
+// [ 5] bsl::streamsize xsputn(const char *string, bsl::streamsize length);
+//
+// CREATORS
+// [ 2] explicit FormatBuffer(bslma::Allocator *basicAllocator = 0);
+// [ 2] FormatBuffer(char *buffer, int capacity, bslma::Allocator *ba = 0);
+// [ 2] ~FormatBuffer();
+//
+// MANIPULATORS
+// [ 2] void append(char character);
+// [ 2] void append(const char *string);
+// [ 2] void append(const char *string, int length);
+// [ 4] void appendDouble(double value);
+// [ 3] void appendHex(bsls::Types::Uint64 value);
+// [ 3] void appendInt64(bsls::Types::Int64 value);
+// [ 2] void appendSpaces(int numSpaces);
+// [ 3] void appendUint64(bsls::Types::Uint64 value);
+// [ 5] void reset();
+// [ 5] bsl::ostream& stream();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] const char *data() const;
+// [ 2] int length() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+#define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+//=============================================================================
+//                  STANDARD BDE LOOP-ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+
+#define LOOP_ASSERT(I,X) { \
+    if (!(X)) { bsl::cout << #I << ": " << I << "\n"; \
+                aSsErT(1, #X, __LINE__); }}
+
+#define LOOP2_ASSERT(I,J,X) { \
+    if (!(X)) { bsl::cout << #I << ": " << I << "\t"  \
+                          << #J << ": " << J << "\n"; \
+                aSsErT(1, #X, __LINE__); } }
+
+#define LOOP3_ASSERT(I,J,K,X) { \
+   if (!(X)) { bsl::cout << #I << ": " << I << "\t" \
+                         << #J << ": " << J << "\t" \
+                         << #K << ": " << K << "\n";\
+               aSsErT(1, #X, __LINE__); } }
+
+//=============================================================================
+//                  SEMI-STANDARD TEST OUTPUT MACROS
+//-----------------------------------------------------------------------------
+
+#define P(X) bsl::cout << #X " = " << (X) << bsl::endl;
+                                              // Print identifier and value.
+#define Q(X) bsl::cout << "<| " #X " |>" << bsl::endl;
+                                              // Quote identifier literally.
+#define P_(X) bsl::cout << #X " = " << (X) << ", " << bsl::flush;
+                                              // P(X) without '\n'
+#define L_ __LINE__                           // current Line number
+#define NL "\n"
+#define T_ cout << '\t' << flush;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslim::FormatBuffer Obj;
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+static bsl::string contents(const Obj& buffer)
+    // Return a string holding the output accumulated in the specified
+    // 'buffer'.
+{
+    return bsl::string(buffer.data(), buffer.length());
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void) veryVeryVerbose;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "USAGE EXAMPLE" << bsl::endl
+                               << "=============" << bsl::endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Trace Message
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that we want to emit a trace message describing an order, and that
+// we want to avoid both allocating memory and the cost of 'bsl::ostream'
+// formatting in the common case.
+//
+// First, we create a 'FormatBuffer' supplied with a buffer on the stack:
+//..
+    char               storage[128];
+    bslim::FormatBuffer buffer(storage, sizeof storage);
+//..
+// Then, we format the order using the direct formatting methods:
+//..
+    buffer.append("order: id=");
+    buffer.appendInt64(12345);
+    buffer.append(" price=");
+    buffer.appendDouble(65.89);
+    buffer.append(" qty=");
+    buffer.appendUint64(100);
+//..
+// Next, we write a value of a type that can be formatted only with
+// 'operator<<' to the stream provided by the buffer:
+//..
+    buffer.stream() << ' ' << 'X' << 'Y';
+//..
+// Now, we verify the formatted message, which is contiguous in memory, and
+// was formatted without allocating memory:
+//..
+    const bsl::string expected("order: id=12345 price=65.89 qty=100 XY");
+
+    ASSERT(expected.length() == static_cast<bsl::size_t>(buffer.length()));
+    ASSERT(0 == bsl::memcmp(expected.data(),
+                            buffer.data(),
+                            buffer.length()));
+    ASSERT(storage == buffer.data());
+//..
+// Finally, we 'reset' the buffer to format the next message:
+//..
+    buffer.reset();
+    ASSERT(0 == buffer.length());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // STREAM OUTPUT AND 'reset'
+        //
+        // Concerns:
+        //: 1 Output written through 'stream()' is appended to the buffer.
+        //:
+        //: 2 Output written through 'stream()' and output written directly
+        //:   are interleaved in the order in which they are written, including
+        //:   when the buffer grows in the middle of a stream operation.
+        //:
+        //: 3 'reset' discards the accumulated output, but retains the current
+        //:   buffer, so that subsequent output does not allocate.
+        //:
+        //: 4 The stream provided by 'stream()' is in the default formatting
+        //:   state, and is in a good state after writing.
+        //
+        // Plan:
+        //: 1 Alternately write to a 'FormatBuffer' directly and through its
+        //:   stream, and write the same sequence to a 'bsl::ostringstream'.
+        //:   Compare the output after each step.  Repeat with initial buffers
+        //:   of several sizes.  (C-1..2, 4)
+        //:
+        //: 2 'reset' a buffer that has allocated memory, write output no
+        //:   longer than its capacity, and verify that no memory is
+        //:   allocated.  (C-3)
+        //
+        // Testing:
+        //   int_type overflow(int_type character);
+        //   bsl::streamsize xsputn(const char *string, bsl::streamsize n);
+        //   void reset();
+        //   bsl::ostream& stream();
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "STREAM OUTPUT AND 'reset'" << bsl::endl
+                               << "=========================" << bsl::endl;
+
+        if (verbose) bsl::cout << "\nInterleaved output." << bsl::endl;
+
+        for (int size = 0; size < 40; ++size) {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            char storage[40];
+            Obj  mX(storage, size, &oa);  const Obj& X = mX;
+
+            bsl::ostringstream expected;
+
+            ASSERT((bsl::ios_base::skipws | bsl::ios_base::dec)
+                                                       == mX.stream().flags());
+            ASSERT(6 == mX.stream().precision());
+            ASSERT(0 == mX.stream().width());
+
+            for (int i = 0; i < 30; ++i) {
+                mX.stream() << "i=" << i << ' ';
+                expected    << "i=" << i << ' ';
+
+                mX.appendInt64(-i);
+                expected << -i;
+
+                mX.stream() << bsl::string(i, '*');
+                expected    << bsl::string(i, '*');
+
+                mX.append(';');
+                expected << ';';
+
+                LOOP2_ASSERT(size, i, mX.stream().good());
+                LOOP2_ASSERT(size, i, expected.str() == contents(X));
+            }
+        }
+
+        if (verbose) bsl::cout << "\n'reset'." << bsl::endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            char storage[8];
+            Obj  mX(storage, sizeof storage, &oa);  const Obj& X = mX;
+
+            mX.reset();
+            ASSERT(0       == X.length());
+            ASSERT(storage == X.data());
+
+            mX.append("0123456789");
+            ASSERT(1 == oa.numBlocksInUse());
+
+            const char *const DATA     = X.data();
+            const int         CAPACITY = X.capacity();
+
+            mX.reset();
+            ASSERT(0        == X.length());
+            ASSERT(DATA     == X.data());
+            ASSERT(CAPACITY == X.capacity());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            mX.stream() << bsl::string(CAPACITY, 'x');
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+            ASSERT(bsl::string(CAPACITY, 'x') == contents(X));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FLOATING-POINT FORMATTING
+        //
+        // Concerns:
+        //: 1 'appendDouble' produces the same characters as 'operator<<' on a
+        //:   'bsl::ostream' having the default formatting state, for values
+        //:   of every magnitude, including 0, negative 0, denormal values,
+        //:   the extreme finite values, infinity, and NaN.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, compare the output of
+        //:   'appendDouble' with the output of 'operator<<' on a
+        //:   'bsl::ostringstream' for a set of values that includes the
+        //:   boundary values, and for each of a sequence of values spanning
+        //:   the range of exponents.  (C-1)
+        //
+        // Testing:
+        //   void appendDouble(double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "FLOATING-POINT FORMATTING" << bsl::endl
+                               << "=========================" << bsl::endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double NaN = bsl::numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int    d_line;   // source line number
+            double d_value;  // value to format
+        } DATA[] = {
+            //LINE  VALUE
+            //----  ------------------
+            { L_,   0.0                },
+            { L_,   -0.0               },
+            { L_,   1.0                },
+            { L_,   -1.0               },
+            { L_,   0.5                },
+            { L_,   65.89              },
+            { L_,   123456.0           },
+            { L_,   1234567.0          },
+            { L_,   0.0001             },
+            { L_,   0.00001            },
+            { L_,   1.0 / 3.0          },
+            { L_,   -2.0 / 3.0         },
+            { L_,   999999.5           },
+            { L_,   1e100              },
+            { L_,   DBL_MAX            },
+            { L_,   -DBL_MAX           },
+            { L_,   DBL_MIN            },
+            { L_,   DBL_MIN / 1024.0   },
+            { L_,   DBL_EPSILON        },
+            { L_,   INF                },
+            { L_,   -INF               },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE  = DATA[ti].d_line;
+            const double VALUE = DATA[ti].d_value;
+
+            Obj mX;  const Obj& X = mX;
+            mX.appendDouble(VALUE);
+
+            bsl::ostringstream expected;
+            expected << VALUE;
+
+            if (veryVerbose) { P_(LINE) P(contents(X)) }
+
+            LOOP3_ASSERT(LINE, expected.str(), contents(X),
+                         expected.str() == contents(X));
+        }
+
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.appendDouble(NaN);
+
+            bsl::ostringstream expected;
+            expected << NaN;
+
+            LOOP2_ASSERT(expected.str(), contents(X),
+                         expected.str() == contents(X));
+        }
+
+        if (verbose) bsl::cout << "\nSpanning the range of exponents."
+                               << bsl::endl;
+
+        for (double value = 1.2345678e-300; value < 1e300; value *= 7.1) {
+            Obj mX;  const Obj& X = mX;
+            mX.appendDouble(value);
+            mX.appendDouble(-value);
+
+            bsl::ostringstream expected;
+            expected << value << -value;
+
+            LOOP3_ASSERT(value, expected.str(), contents(X),
+                         expected.str() == contents(X));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INTEGER FORMATTING
+        //
+        // Concerns:
+        //: 1 'appendInt64' and 'appendUint64' produce the same characters as
+        //:   'operator<<' on a 'bsl::ostream' having the default formatting
+        //:   state, for all values, including 0, the extreme values, and the
+        //:   values on either side of each power of 10.
+        //:
+        //: 2 'appendHex' produces the same characters as 'operator<<' on a
+        //:   'bsl::ostream' having the 'bsl::hex' and 'bsl::showbase' flags
+        //:   (in particular, 0 is formatted without a prefix).
+        //
+        // Plan:
+        //: 1 Compare the output of each method with the output of
+        //:   'operator<<' on a 'bsl::ostringstream' for 0, the extreme values,
+        //:   each power of 10 (and its neighbors), and each power of 2 (and
+        //:   its neighbors).  (C-1..2)
+        //
+        // Testing:
+        //   void appendHex(bsls::Types::Uint64 value);
+        //   void appendInt64(bsls::Types::Int64 value);
+        //   void appendUint64(bsls::Types::Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "INTEGER FORMATTING" << bsl::endl
+                               << "==================" << bsl::endl;
+
+        bsl::vector<Uint64> values;
+        values.push_back(0);
+        values.push_back(bsl::numeric_limits<Uint64>::max());
+        values.push_back(bsl::numeric_limits<Int64>::max());
+        values.push_back(static_cast<Uint64>(
+                                         bsl::numeric_limits<Int64>::min()));
+        for (Uint64 power = 1; power <= 10000000000000000000ULL; power *= 10) {
+            values.push_back(power - 1);
+            values.push_back(power);
+            values.push_back(power + 1);
+            if (power > bsl::numeric_limits<Uint64>::max() / 10) {
+                break;
+            }
+        }
+        for (int shift = 0; shift < 64; ++shift) {
+            const Uint64 power = static_cast<Uint64>(1) << shift;
+            values.push_back(power - 1);
+            values.push_back(power);
+            values.push_back(power + 1);
+        }
+
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            const Uint64 UVALUE = values[i];
+            const Int64  SVALUE = static_cast<Int64>(UVALUE);
+
+            if (veryVerbose) { P_(UVALUE) P(SVALUE) }
+
+            {
+                Obj mX;  const Obj& X = mX;
+                mX.appendUint64(UVALUE);
+
+                bsl::ostringstream expected;
+                expected << UVALUE;
+
+                LOOP2_ASSERT(expected.str(), contents(X),
+                             expected.str() == contents(X));
+            }
+            {
+                Obj mX;  const Obj& X = mX;
+                mX.appendInt64(SVALUE);
+                mX.appendInt64(-SVALUE);
+
+                bsl::ostringstream expected;
+                expected << SVALUE << -SVALUE;
+
+                LOOP2_ASSERT(expected.str(), contents(X),
+                             expected.str() == contents(X));
+            }
+            {
+                Obj mX;  const Obj& X = mX;
+                mX.appendHex(UVALUE);
+
+                bsl::ostringstream expected;
+                expected << bsl::hex << bsl::showbase << UVALUE;
+
+                LOOP2_ASSERT(expected.str(), contents(X),
+                             expected.str() == contents(X));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND MEMORY ALLOCATION
+        //
+        // Concerns:
+        //: 1 A default-constructed buffer is empty, and allocates no memory
+        //:   until output is written to it.
+        //:
+        //: 2 A buffer supplied at construction is used (without allocating)
+        //:   until it is full.
+        //:
+        //: 3 When the current buffer is full, the accumulated output is moved
+        //:   to a larger buffer obtained from the object allocator, and the
+        //:   previous allocated buffer (if any) is released, so that at most
+        //:   one block is in use.
+        //:
+        //: 4 The capacity grows geometrically.
+        //:
+        //: 5 The default allocator is used if no allocator is supplied.
+        //:
+        //: 6 All memory is released on destruction.
+        //:
+        //: 7 'appendSpaces' has no effect for non-positive arguments.
+        //
+        // Plan:
+        //: 1 For each initial buffer size in a range, append characters one
+        //:   at a time using each 'append' overload, and 'appendSpaces',
+        //:   comparing the output with an expected string, and verifying the
+        //:   use of the allocator, after each step.  (C-1..6)
+        //:
+        //: 2 Call 'appendSpaces' with 0 and negative arguments.  (C-7)
+        //
+        // Testing:
+        //   explicit FormatBuffer(bslma::Allocator *basicAllocator = 0);
+        //   FormatBuffer(char *buffer, int capacity, bslma::Allocator *ba);
+        //   ~FormatBuffer();
+        //   void append(char character);
+        //   void append(const char *string);
+        //   void append(const char *string, int length);
+        //   void appendSpaces(int numSpaces);
+        //   int capacity() const;
+        //   const char *data() const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                         << "PRIMARY MANIPULATORS AND MEMORY ALLOCATION"
+                         << bsl::endl
+                         << "=========================================="
+                         << bsl::endl;
+
+        if (verbose) bsl::cout << "\nDefault construction." << bsl::endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+            mX.append('a');
+            ASSERT(1   == X.length());
+            ASSERT('a' == *X.data());
+            ASSERT(1   == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) bsl::cout << "\nSupplied buffer and growth." << bsl::endl;
+
+        for (int size = 0; size <= 16; ++size) {
+            for (int method = 0; method < 4; ++method) {
+                bslma::TestAllocator oa("object", veryVeryVerbose);
+
+                char storage[16];
+                {
+                    Obj mX(storage, size, &oa);  const Obj& X = mX;
+
+                    ASSERT(0    == X.length());
+                    ASSERT(size == X.capacity());
+
+                    bsl::string expected;
+                    int         previousCapacity = X.capacity();
+
+                    for (int i = 0; i < 1000; ++i) {
+                        const char c = static_cast<char>('a' + i % 26);
+                        const char s[] = { c, 0 };
+
+                        switch (method) {
+                          case 0: mX.append(c);         break;
+                          case 1: mX.append(s);         break;
+                          case 2: mX.append(s, 1);      break;
+                          case 3: mX.appendSpaces(1);   break;
+                        }
+                        expected.push_back(3 == method ? ' ' : c);
+
+                        LOOP3_ASSERT(size, method, i,
+                                     expected == contents(X));
+
+                        if (X.length() <= size) {
+                            LOOP3_ASSERT(size, method, i,
+                                         storage == X.data());
+                            LOOP3_ASSERT(size, method, i,
+                                         0 == oa.numBlocksTotal());
+                        }
+                        else {
+                            LOOP3_ASSERT(size, method, i,
+                                         storage != X.data());
+                            LOOP3_ASSERT(size, method, i,
+                                         1 == oa.numBlocksInUse());
+                        }
+
+                        if (X.capacity() != previousCapacity) {
+                            LOOP3_ASSERT(size, method, i,
+                                       X.capacity() >= 2 * previousCapacity);
+                            previousCapacity = X.capacity();
+                        }
+                    }
+
+                    // Logarithmic number of allocations.
+
+                    LOOP2_ASSERT(size, method, oa.numAllocations() <= 4);
+                }
+                LOOP2_ASSERT(size, method, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) bsl::cout << "\nLong appends." << bsl::endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            const bsl::string LONG(5000, 'z');
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.append('a');
+            mX.append(LONG.c_str());
+            mX.appendSpaces(3000);
+            mX.append(LONG.data(), static_cast<int>(LONG.length()));
+
+            ASSERT('a' + LONG + bsl::string(3000, ' ') + LONG == contents(X));
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+
+        if (verbose) bsl::cout << "\nNon-positive 'appendSpaces'."
+                               << bsl::endl;
+        {
+            char storage[4];
+            Obj  mX(storage, sizeof storage);  const Obj& X = mX;
+
+            mX.appendSpaces(0);
+            mX.appendSpaces(-1);
+            mX.appendSpaces(INT_MIN);
+            mX.append("", 0);
+            mX.append("");
+            ASSERT(0 == X.length());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a sequence of values to a buffer, both directly and
+        //:   through its stream, and verify the output.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "BREATHING TEST" << bsl::endl
+                               << "==============" << bsl::endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        mX.append("a = ");
+        mX.appendInt64(-42);
+        mX.append(", b = ", 6);
+        mX.appendUint64(42);
+        mX.append(',');
+        mX.appendSpaces(2);
+        mX.append("c = ");
+        mX.appendDouble(1.5);
+        mX.append(", d = ");
+        mX.appendHex(255);
+        mX.stream() << ", e = " << 7;
+
+        if (veryVerbose) { P(contents(X)) }
+
+        ASSERT("a = -42, b = 42,  c = 1.5, d = 0xff, e = 7" == contents(X));
+
+        mX.reset();
+        ASSERT(0 == X.length());
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
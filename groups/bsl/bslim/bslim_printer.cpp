@@ -59,8 +59,18 @@ namespace bslim {
 // PRIVATE ACCESSORS
 void Printer::printEndIndentation() const
 {
+    FormatBuffer *buffer = directBuffer();
+
     if (d_spacesPerLevel < 0) {
-        *d_stream_p << ' ';
+        if (buffer) {
+            buffer->append(' ');
+        }
+        else {
+            *d_stream_p << ' ';
+        }
+    }
+    else if (buffer) {
+        buffer->appendSpaces(d_spacesPerLevel * d_level);
     }
     else {
         *d_stream_p << bsl::setw(d_spacesPerLevel * d_level) << "";
@@ -69,8 +79,18 @@ void Printer::printEndIndentation() const
 
 void Printer::printIndentation() const
 {
+    FormatBuffer *buffer = directBuffer();
+
     if (d_spacesPerLevel < 0) {
-        *d_stream_p << ' ';
+        if (buffer) {
+            buffer->append(' ');
+        }
+        else {
+            *d_stream_p << ' ';
+        }
+    }
+    else if (buffer) {
+        buffer->appendSpaces(d_spacesPerLevel * d_levelPlusOne);
     }
     else {
         *d_stream_p << bsl::setw(d_spacesPerLevel * d_levelPlusOne) << "";
@@ -81,6 +101,7 @@ void Printer::printIndentation() const
 Printer::Printer(bsl::ostream *stream, int level, int spacesPerLevel)
 : d_stream_p(stream)
 , d_spacesPerLevel(spacesPerLevel)
+, d_buffer_p(dynamic_cast<FormatBuffer *>(stream->rdbuf()))
 {
     BSLS_ASSERT(stream);
 
@@ -101,6 +122,20 @@ int Printer::absLevel() const
 
 void Printer::end(bool suppressBracket) const
 {
+    FormatBuffer *buffer = directBuffer();
+
+    if (buffer) {
+        if (!suppressBracket) {
+            printEndIndentation();
+            buffer->append(']');
+        }
+
+        if (d_spacesPerLevel >= 0) {
+            buffer->append('\n');
+        }
+        return;                                                       // RETURN
+    }
+
     if (!suppressBracket) {
         printEndIndentation();
         *d_stream_p << ']';
@@ -116,13 +151,17 @@ void Printer::printHexAddr(const void *address, const char *name) const
     printIndentation();
 
     if (name != NULL) {
-        *d_stream_p << name << " = ";
+        printName(name);
     }
 
-    Printer_Helper::print(*d_stream_p,
-                          address,
-                          -d_levelPlusOne,
-                          d_spacesPerLevel);
+    FormatBuffer *buffer = directBuffer();
+    if (!buffer
+     || !Printer_Helper::printDirect(buffer, address, d_spacesPerLevel)) {
+        Printer_Helper::print(*d_stream_p,
+                              address,
+                              -d_levelPlusOne,
+                              d_spacesPerLevel);
+    }
 }
 
 int Printer::spacesPerLevel() const
@@ -132,6 +171,25 @@ int Printer::spacesPerLevel() const
 
 void Printer::start(bool suppressBracket) const
 {
+    FormatBuffer *buffer = directBuffer();
+
+    if (buffer) {
+        if (!suppressInitialIndentFlag()) {
+            const int absSpacesPerLevel = d_spacesPerLevel < 0
+                                          ? -d_spacesPerLevel
+                                          :  d_spacesPerLevel;
+            buffer->appendSpaces(absSpacesPerLevel * d_level);
+        }
+
+        if (!suppressBracket) {
+            buffer->append('[');
+            if (d_spacesPerLevel >= 0) {
+                buffer->append('\n');
+            }
+        }
+        return;                                                       // RETURN
+    }
+
     if (!suppressInitialIndentFlag()) {
         const int absSpacesPerLevel = d_spacesPerLevel < 0
                                       ? -d_spacesPerLevel
@@ -246,6 +304,66 @@ void Printer_Helper::printRaw(bsl::ostream&              stream,
     }
 }
 
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 char          data,
+                                 int           spacesPerLevel)
+{
+    if (bsl::isprint(data)) {
+        buffer->append('\'');
+        buffer->append(data);
+        buffer->append('\'');
+    }
+    else {
+        switch (data) {
+          case '\n': buffer->append("'\\n'", 4); break;
+          case '\t': buffer->append("'\\t'", 4); break;
+          case '\0': buffer->append("'\\0'", 4); break;
+          default: {
+            buffer->appendHex(static_cast<bsls::Types::UintPtr>(data));
+          }
+        }
+    }
+
+    if (spacesPerLevel >= 0) {
+        buffer->append('\n');
+    }
+    return true;
+}
+
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 const char   *data,
+                                 int           spacesPerLevel)
+{
+    if (0 == data) {
+        buffer->append("NULL", 4);
+    }
+    else {
+        buffer->append('"');
+        buffer->append(data);
+        buffer->append('"');
+    }
+    if (spacesPerLevel >= 0) {
+        buffer->append('\n');
+    }
+    return true;
+}
+
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 const void   *data,
+                                 int           spacesPerLevel)
+{
+    if (0 == data) {
+        buffer->append("NULL", 4);
+    }
+    else {
+        buffer->appendHex(reinterpret_cast<bsls::Types::UintPtr>(data));
+    }
+    if (spacesPerLevel >= 0) {
+        buffer->append('\n');
+    }
+    return true;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
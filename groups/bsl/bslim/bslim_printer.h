@@ -12,6 +12,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bslim::Printer: mechanism to implement standard 'print' methods
 //
+//@SEE_ALSO: bslim_formatbuffer
+//
 //@DESCRIPTION: This component provides a mechanism class, 'Printer', that, in
 // many cases, simplifies the implementation of types providing a 'print'
 // method with the signature:
@@ -75,6 +77,44 @@ BSLS_IDENT("$Id: $")
 // before any of the other methods, and 'end' should be called after all the
 // other methods have been called.
 //
+///Formatting Directly to a 'bslim::FormatBuffer'
+///----------------------------------------------
+// Formatting through a 'bsl::ostream' constructs a sentry object, and (for
+// arithmetic types) consults the locale of the stream, for every value that is
+// written, which makes a 'print' method that uses 'Printer' relatively
+// expensive.  If the stream buffer of the stream supplied to a 'Printer' is a
+// 'bslim::FormatBuffer' (see 'bslim_formatbuffer'), then the 'Printer'
+// formats the following directly into that buffer, bypassing the stream:
+//
+//: o indentation, brackets, and attribute names
+//:
+//: o values of type 'bool', 'char', 'short', 'int', 'long', 'long long' (and
+//:   their 'unsigned' counterparts), 'float', and 'double'
+//:
+//: o values of type 'const char *' (or an array of 'const char'),
+//:   'const void *', and 'bsl::string'
+//
+// Values of all other types (including the values nested in a pair, range, or
+// container, each of which is printed by a 'Printer' of its own) are printed
+// exactly as described above, and a nested 'Printer' also formats directly to
+// the buffer.  Direct formatting produces exactly the output that formatting
+// through the stream would produce, and is used only while the stream is in a
+// good state, has the default formatting flags, precision, and width, and is
+// not tied to another stream.  For example:
+//..
+//  char                storage[512];
+//  bslim::FormatBuffer buffer(storage, sizeof storage);
+//
+//  bslim::Printer printer(&buffer.stream(), 0, -1);
+//  printer.start();
+//  printer.printAttribute("ticker", "ABC");
+//  printer.printAttribute("price", 65.89);
+//  printer.end();
+//
+//  const bsl::string output(buffer.data(), buffer.length());
+//  assert("[ ticker = \"ABC\" price = 65.89 ]" == output);
+//..
+//
 ///Usage
 ///-----
 // In the following examples, we examine the implementation of the 'print'
@@ -522,6 +562,10 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 #endif
 
+#ifndef INCLUDED_BSLIM_FORMATBUFFER
+#include <bslim_formatbuffer.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
 #include <bslalg_typetraithasstliterators.h>
 #endif
@@ -592,8 +636,21 @@ class Printer {
     int           d_spacesPerLevel;            // spaces per level used in
                                                // formatting
 
+    FormatBuffer *d_buffer_p;                  // stream buffer of
+                                               // 'd_stream_p' if it is a
+                                               // 'FormatBuffer', and 0
+                                               // otherwise (held, not owned)
+
   private:
     // PRIVATE ACCESSORS
+    FormatBuffer *directBuffer() const;
+        // Return the address of the stream buffer of the output stream
+        // supplied at construction if that buffer is a 'FormatBuffer', and
+        // the stream is in a good state, has the default formatting flags,
+        // precision, and width, and is not tied to another stream (i.e., if
+        // formatting directly to the buffer produces the same output as
+        // formatting through the stream), and 0 otherwise.
+
     void printEndIndentation() const;
         // Print to the output stream supplied at construction
         // 'absLevel() * spacesPerLevel()' blank spaces if
@@ -604,6 +661,10 @@ class Printer {
         // '(absLevel() + 1) * spacesPerLevel()' blank spaces if
         // 'spacesPerLevel() >= 0', and print a single blank space otherwise.
 
+    void printName(const char *name) const;
+        // Print to the output stream supplied at construction the specified
+        // 'name' followed by " = ".
+
   private:
     // NOT IMPLEMENTED
     Printer& operator=(const Printer&);
@@ -614,7 +675,11 @@ class Printer {
         // Create a 'Printer' object that will print to the specified 'stream'
         // in a format dictated by the values of the specified 'level' and
         // 'spacesPerLevel', as per the contract of the standard BDE 'print'
-        // method.  The behavior is undefined unless 'stream' is valid.
+        // method.  If the stream buffer of 'stream' is a 'FormatBuffer',
+        // values of common types are formatted directly to that buffer (see
+        // "Formatting Directly to a 'bslim::FormatBuffer'" in the component
+        // documentation).  The behavior is undefined unless 'stream' is
+        // valid.
 
     ~Printer();
         // Destroy this 'Printer' object.
@@ -935,6 +1000,64 @@ struct Printer_Helper {
         // 'PrintRaw': the 'print' method of this class dispatches the actual
         // printing to the appropriate specialized 'printRaw' method for the
         // individual TYPE for printing.
+
+                      // Direct formatting
+
+    template <class TYPE>
+    static bool printDirect(FormatBuffer *buffer,
+                            const TYPE&   data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            bool          data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            char          data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            short         data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer   *buffer,
+                            unsigned short  data,
+                            int             spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            int           data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            unsigned int  data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            long          data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer  *buffer,
+                            unsigned long  data,
+                            int            spacesPerLevel);
+    static bool printDirect(FormatBuffer       *buffer,
+                            bsls::Types::Int64  data,
+                            int                 spacesPerLevel);
+    static bool printDirect(FormatBuffer        *buffer,
+                            bsls::Types::Uint64  data,
+                            int                  spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            float         data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            double        data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            const char   *data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer *buffer,
+                            const void   *data,
+                            int           spacesPerLevel);
+    static bool printDirect(FormatBuffer       *buffer,
+                            const bsl::string&  data,
+                            int                 spacesPerLevel);
+        // Format the specified 'data' to the specified 'buffer', producing
+        // the same output as 'print' would produce, using the specified
+        // 'spacesPerLevel', to a stream having the default formatting state,
+        // and return 'true' if the (deduced) type of 'data' is one of those
+        // for which an overload is declared above; otherwise, return 'false'
+        // without producing any output.
 };
 
 // ============================================================================
@@ -946,6 +1069,34 @@ struct Printer_Helper {
                                 // class Printer
                                 // -------------
 
+// PRIVATE ACCESSORS
+inline
+FormatBuffer *Printer::directBuffer() const
+{
+    if (d_buffer_p
+     && 0 == d_stream_p->rdstate()
+     && (bsl::ios_base::skipws | bsl::ios_base::dec) == d_stream_p->flags()
+     && 0 == d_stream_p->width()
+     && 6 == d_stream_p->precision()
+     && 0 == d_stream_p->tie()) {
+        return d_buffer_p;                                            // RETURN
+    }
+    return 0;
+}
+
+inline
+void Printer::printName(const char *name) const
+{
+    FormatBuffer *buffer = directBuffer();
+    if (buffer) {
+        buffer->append(name);
+        buffer->append(" = ", 3);
+    }
+    else {
+        *d_stream_p << name << " = ";
+    }
+}
+
 // ACCESSORS
 
 template <class TYPE>
@@ -954,13 +1105,16 @@ void Printer::printAttribute(const char *name, const TYPE& data) const
     BSLS_ASSERT_SAFE(0 != name);
 
     printIndentation();
+    printName(name);
 
-    *d_stream_p << name << " = ";
-
-    Printer_Helper::print(*d_stream_p,
-                          data,
-                          -d_levelPlusOne,
-                          d_spacesPerLevel);
+    FormatBuffer *buffer = directBuffer();
+    if (!buffer
+     || !Printer_Helper::printDirect(buffer, data, d_spacesPerLevel)) {
+        Printer_Helper::print(*d_stream_p,
+                              data,
+                              -d_levelPlusOne,
+                              d_spacesPerLevel);
+    }
 }
 
 template <class ITERATOR>
@@ -971,8 +1125,7 @@ void Printer::printAttribute(const char      *name,
     BSLS_ASSERT_SAFE(0 != name);
 
     printIndentation();
-
-    *d_stream_p << name << " = ";
+    printName(name);
 
     Printer_Helper::print(*d_stream_p,
                           begin,
@@ -989,7 +1142,7 @@ void Printer::printForeign(const TYPE&           data,
     printIndentation();
 
     if (name) {
-        *d_stream_p << name << " = ";
+        printName(name);
     }
 
     printFunctionObject(*d_stream_p,
@@ -1004,16 +1157,29 @@ void Printer::printOrNull(const TYPE& address, const char *name) const
     printIndentation();
 
     if (name) {
-        *d_stream_p << name << " = ";
+        printName(name);
     }
 
+    FormatBuffer *buffer = directBuffer();
+
     if (0 == address) {
-        *d_stream_p << "NULL";
-        if (d_spacesPerLevel >= 0) {
-            *d_stream_p << '\n';
+        if (buffer) {
+            buffer->append("NULL", 4);
+            if (d_spacesPerLevel >= 0) {
+                buffer->append('\n');
+            }
+        }
+        else {
+            *d_stream_p << "NULL";
+            if (d_spacesPerLevel >= 0) {
+                *d_stream_p << '\n';
+            }
         }
     }
-    else {
+    else if (!buffer
+          || !Printer_Helper::printDirect(buffer,
+                                          *address,
+                                          d_spacesPerLevel)) {
         Printer_Helper::print(*d_stream_p,
                               *address,
                               -d_levelPlusOne,
@@ -1029,14 +1195,18 @@ void Printer::printOrNull<const void *>(const void *const&  address,
     printIndentation();
 
     if (name) {
-        *d_stream_p << name << " = ";
+        printName(name);
     }
     const void *temp = address;
 
-    Printer_Helper::print(*d_stream_p,
-                          temp,
-                          -d_levelPlusOne,
-                          d_spacesPerLevel);
+    FormatBuffer *buffer = directBuffer();
+    if (!buffer
+     || !Printer_Helper::printDirect(buffer, temp, d_spacesPerLevel)) {
+        Printer_Helper::print(*d_stream_p,
+                              temp,
+                              -d_levelPlusOne,
+                              d_spacesPerLevel);
+    }
 }
 
 template <>
@@ -1053,10 +1223,14 @@ void Printer::printValue(const TYPE& data) const
 {
     printIndentation();
 
-    Printer_Helper::print(*d_stream_p,
-                          data,
-                          -d_levelPlusOne,
-                          d_spacesPerLevel);
+    FormatBuffer *buffer = directBuffer();
+    if (!buffer
+     || !Printer_Helper::printDirect(buffer, data, d_spacesPerLevel)) {
+        Printer_Helper::print(*d_stream_p,
+                              data,
+                              -d_levelPlusOne,
+                              d_spacesPerLevel);
+    }
 }
 
 template <class ITERATOR>
@@ -1246,6 +1420,146 @@ void Printer_Helper::printRaw(bsl::ostream&              stream,
     data.print(stream, level, spacesPerLevel);
 }
 
+                      // Direct formatting
+
+template <class TYPE>
+inline
+bool Printer_Helper::printDirect(FormatBuffer *,
+                                 const TYPE&   ,
+                                 int           )
+{
+    return false;
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 bool          data,
+                                 int           spacesPerLevel)
+{
+    if (data) {
+        buffer->append("true", 4);
+    }
+    else {
+        buffer->append("false", 5);
+    }
+    if (spacesPerLevel >= 0) {
+        buffer->append('\n');
+    }
+    return true;
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 short         data,
+                                 int           spacesPerLevel)
+{
+    return printDirect(buffer,
+                       static_cast<bsls::Types::Int64>(data),
+                       spacesPerLevel);
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer   *buffer,
+                                 unsigned short  data,
+                                 int             spacesPerLevel)
+{
+    return printDirect(buffer,
+                       static_cast<bsls::Types::Uint64>(data),
+                       spacesPerLevel);
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 int           data,
+                                 int           spacesPerLevel)
+{
+    return printDirect(buffer,
+                       static_cast<bsls::Types::Int64>(data),
+                       spacesPerLevel);
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 unsigned int  data,
+                                 int           spacesPerLevel)
+{
+    return printDirect(buffer,
+                       static_cast<bsls::Types::Uint64>(data),
+                       spacesPerLevel);
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 long          data,
+                                 int           spacesPerLevel)
+{
+    return printDirect(buffer,
+                       static_cast<bsls::Types::Int64>(data),
+                       spacesPerLevel);
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer  *buffer,
+                                 unsigned long  data,
+                                 int            spacesPerLevel)
+{
+    return printDirect(buffer,
+                       static_cast<bsls::Types::Uint64>(data),
+                       spacesPerLevel);
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer       *buffer,
+                                 bsls::Types::Int64  data,
+                                 int                 spacesPerLevel)
+{
+    buffer->appendInt64(data);
+    if (spacesPerLevel >= 0) {
+        buffer->append('\n');
+    }
+    return true;
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer        *buffer,
+                                 bsls::Types::Uint64  data,
+                                 int                  spacesPerLevel)
+{
+    buffer->appendUint64(data);
+    if (spacesPerLevel >= 0) {
+        buffer->append('\n');
+    }
+    return true;
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 float         data,
+                                 int           spacesPerLevel)
+{
+    return printDirect(buffer, static_cast<double>(data), spacesPerLevel);
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer *buffer,
+                                 double        data,
+                                 int           spacesPerLevel)
+{
+    buffer->appendDouble(data);
+    if (spacesPerLevel >= 0) {
+        buffer->append('\n');
+    }
+    return true;
+}
+
+inline
+bool Printer_Helper::printDirect(FormatBuffer       *buffer,
+                                 const bsl::string&  data,
+                                 int                 spacesPerLevel)
+{
+    return printDirect(buffer, data.c_str(), spacesPerLevel);
+}
+
 // This method, though declared first in the struct, is placed last among the
 // methods in 'Printer_Helper' so that it can inline the 'printRaw' methods it
 // calls.
@@ -2,8 +2,11 @@
 
 #include <bslim_printer.h>
 
+#include <bslim_formatbuffer.h>
 #include <bslma_testallocator.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdio.h>
 #include <bsl_iostream.h>
@@ -68,6 +71,8 @@ using namespace bslim;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [20] USAGE EXAMPLE
+// [25] FORMATTING DIRECTLY TO A 'FormatBuffer'
+// [-1] PERFORMANCE: 'bsl::ostringstream' VS. 'FormatBuffer'
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -223,6 +228,70 @@ void testFunctionAddress(int)
 {
 }
 
+void printEverything(bsl::ostream& stream, int level, int spacesPerLevel)
+    // Print to the specified 'stream' an object having an attribute of each
+    // type that 'Printer' can format directly to a 'bslim::FormatBuffer', and
+    // an attribute of each of several types that it cannot, using the
+    // specified 'level' and 'spacesPerLevel'.
+{
+    static int       intValue  = 42;
+    static const int *nullInt  = 0;
+    static const char charArray[] = "array";
+
+    bsl::vector<int> vector;
+    vector.push_back(1);
+    vector.push_back(-2);
+
+    bsl::map<bsl::string, double> map;
+    map["pi"]  = 3.14159265;
+    map["big"] = 1e300;
+
+    Obj printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("bool",    true);
+    printer.printAttribute("false",   false);
+    printer.printAttribute("char",    'c');
+    printer.printAttribute("newline", '\n');
+    printer.printAttribute("tab",     '\t');
+    printer.printAttribute("nul",     '\0');
+    printer.printAttribute("bell",    '\a');
+    printer.printAttribute("short",   static_cast<short>(-32768));
+    printer.printAttribute("ushort",  static_cast<unsigned short>(65535));
+    printer.printAttribute("int",     -2147483647 - 1);
+    printer.printAttribute("uint",    4294967295U);
+    printer.printAttribute("long",    -123456789L);
+    printer.printAttribute("ulong",   123456789UL);
+    printer.printAttribute("int64",
+                           -static_cast<bsls::Types::Int64>(
+                                             9223372036854775807LL) - 1);
+    printer.printAttribute("uint64",  ~static_cast<bsls::Types::Uint64>(0));
+    printer.printAttribute("float",   1.25f);
+    printer.printAttribute("double",  65.89);
+    printer.printAttribute("small",   1.0e-10);
+    printer.printAttribute("string",  "abc");
+    printer.printAttribute("array",   charArray);
+    printer.printAttribute("bslstr",  bsl::string("def"));
+    printer.printAttribute("null",    static_cast<const char *>(0));
+    printer.printAttribute("voidp",   static_cast<const void *>(&intValue));
+    printer.printAttribute("nullvp",  static_cast<const void *>(0));
+    printer.printAttribute("uchar",   static_cast<unsigned char>(200));
+    printer.printAttribute("enum",    TestEnumWithStreaming::VALUE_B);
+    printer.printAttribute("vector",  vector);
+    printer.printAttribute("map",     map);
+    printer.printAttribute("pair",
+                           bsl::pair<int, bsl::string>(1, "x"));
+    printer.printAttribute("print",   HasPrint(7));
+    printer.printAttribute("range",   vector.begin(), vector.end());
+    printer.printForeign(NoPrint(9), &NoPrintUtil::print, "foreign");
+    printer.printHexAddr(&intValue, "hex");
+    printer.printHexAddr(&intValue, 0);
+    printer.printOrNull(&intValue, "ptr");
+    printer.printOrNull(nullInt, "nullptr");
+    printer.printValue(-7);
+    printer.printValue("value");
+    printer.end();
+}
+
 //=============================================================================
 //                              USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -589,6 +658,111 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 25: {
+        // --------------------------------------------------------------------
+        // FORMATTING DIRECTLY TO A 'FormatBuffer'
+        //
+        // Concerns:
+        //: 1 A 'Printer' whose stream has a 'bslim::FormatBuffer' as its
+        //:   stream buffer produces exactly the same output as a 'Printer'
+        //:   whose stream is a 'bsl::ostringstream', for every type that is
+        //:   formatted directly, and for types that are not, for all values
+        //:   of 'level' and 'spacesPerLevel'.
+        //:
+        //: 2 The output is the same when the stream does not have the default
+        //:   formatting state (in which case the direct formatting path is not
+        //:   used).
+        //:
+        //: 3 Nothing is written if the stream is not in a good state.
+        //
+        // Plan:
+        //: 1 For each of a set of values of 'level' and 'spacesPerLevel',
+        //:   print an object having attributes of many types to a
+        //:   'bsl::ostringstream' and to the stream of a 'FormatBuffer', and
+        //:   compare the output.  (C-1)
+        //:
+        //: 2 Repeat P-1 after applying the same formatting manipulators to
+        //:   both streams.  (C-2)
+        //:
+        //: 3 Repeat P-1 after setting 'badbit' on both streams.  (C-3)
+        //
+        // Testing:
+        //   FORMATTING DIRECTLY TO A 'FormatBuffer'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nFORMATTING DIRECTLY TO A 'FormatBuffer'"
+                          << "\n=======================================\n";
+
+        static const struct {
+            int d_line;            // source line number
+            int d_level;           // 'level' supplied to 'Printer'
+            int d_spacesPerLevel;  // 'spacesPerLevel' supplied to 'Printer'
+        } DATA[] = {
+            //LINE  LEVEL  SPL
+            //----  -----  ---
+            { L_,    0,     4  },
+            { L_,    1,     2  },
+            { L_,    3,     0  },
+            { L_,   -2,     3  },
+            { L_,    0,    -1  },
+            { L_,    2,    -2  },
+            { L_,   -1,    -4  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE  = DATA[ti].d_line;
+            const int LEVEL = DATA[ti].d_level;
+            const int SPL   = DATA[ti].d_spacesPerLevel;
+
+            for (int mode = 0; mode < 5; ++mode) {
+                bslma::TestAllocator oa("object", veryVeryVerbose);
+
+                char                storage[64];
+                bslim::FormatBuffer buffer(storage, sizeof storage, &oa);
+                bsl::ostringstream  expected;
+
+                bsl::ostream& direct = buffer.stream();
+
+                switch (mode) {
+                  case 0: {
+                    // default formatting state
+                  } break;
+                  case 1: {
+                    direct   << bsl::hex << bsl::showbase;
+                    expected << bsl::hex << bsl::showbase;
+                  } break;
+                  case 2: {
+                    direct.precision(3);
+                    expected.precision(3);
+                  } break;
+                  case 3: {
+                    direct   << bsl::boolalpha << bsl::uppercase;
+                    expected << bsl::boolalpha << bsl::uppercase;
+                  } break;
+                  case 4: {
+                    direct.setstate(bsl::ios_base::badbit);
+                    expected.setstate(bsl::ios_base::badbit);
+                  } break;
+                }
+
+                printEverything(direct,   LEVEL, SPL);
+                printEverything(expected, LEVEL, SPL);
+
+                const bsl::string ACTUAL(buffer.data(), buffer.length());
+                const bsl::string EXPECTED(expected.str());
+
+                if (veryVerbose) {
+                    T_ P_(LINE) P(mode)
+                    cout << ACTUAL << endl;
+                }
+
+                LOOP3_ASSERT(LINE, mode, EXPECTED, EXPECTED == ACTUAL);
+                LOOP3_ASSERT(LINE, mode, ACTUAL,   EXPECTED == ACTUAL);
+                LOOP2_ASSERT(LINE, mode, (4 == mode) == ACTUAL.empty());
+            }
+        }
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 4
@@ -2280,6 +2454,62 @@ int main(int argc, char *argv[])
         LOOP2_ASSERT(EXPECTED, ACTUAL, EXPECTED == ACTUAL);
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'bsl::ostringstream' VS. 'FormatBuffer'
+        //
+        // Concerns:
+        //: 1 Printing to a stream whose stream buffer is a 'FormatBuffer' is
+        //:   faster than printing to a 'bsl::ostringstream'.
+        //
+        // Plan:
+        //: 1 Repeatedly print an object having attributes of many types to a
+        //:   'bsl::ostringstream', and to the stream of a 'FormatBuffer' that
+        //:   is reset before each iteration, and report the elapsed times.
+        //:   The number of iterations may be specified as the second
+        //:   argument.
+        //
+        // Testing:
+        //   PERFORMANCE: 'bsl::ostringstream' VS. 'FormatBuffer'
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: 'bsl::ostringstream' VS. 'FormatBuffer'"
+             << "\n====================================================\n";
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 20000;
+
+        bsls::Stopwatch timer;
+
+        for (int spl = 4; spl >= -1; spl -= 5) {
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bsl::ostringstream stream;
+                printEverything(stream, 1, spl);
+            }
+            timer.stop();
+            const double streamTime = timer.elapsedTime();
+
+            char                storage[4096];
+            bslim::FormatBuffer buffer(storage, sizeof storage);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                buffer.reset();
+                printEverything(buffer.stream(), 1, spl);
+            }
+            timer.stop();
+            const double bufferTime = timer.elapsedTime();
+
+            printf("spacesPerLevel = %2d: ostringstream: %8.4fs  "
+                   "FormatBuffer: %8.4fs  (%.2fx)\n",
+                   spl,
+                   streamTime,
+                   bufferTime,
+                   bufferTime > 0 ? streamTime / bufferTime : 0.0);
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
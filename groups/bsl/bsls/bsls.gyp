@@ -1,6 +1,7 @@
 {
   'variables': {
     'bsls_sources': [
+      'bsls_adaptivelock.cpp',
       'bsls_alignedbuffer.cpp',
       'bsls_alignment.cpp',
       'bsls_alignmentfromtype.cpp',
@@ -33,6 +34,7 @@
       'bsls_compilerfeatures.cpp',
       'bsls_exceptionutil.cpp',
       'bsls_ident.cpp',
+      'bsls_latencyhistogram.cpp',
       'bsls_macroincrement.cpp',
       'bsls_nativestd.cpp',
       'bsls_nullptr.cpp',
@@ -40,6 +42,8 @@
       'bsls_performancehint.cpp',
       'bsls_platform.cpp',
       'bsls_protocoltest.cpp',
+      'bsls_regionprofiler.cpp',
+      'bsls_shardedcounter.cpp',
       'bsls_stopwatch.cpp',
       'bsls_timeutil.cpp',
       'bsls_types.cpp',
@@ -47,6 +51,7 @@
       'bsls_util.cpp',
     ],
     'bsls_tests': [
+      'bsls_adaptivelock.t',
       'bsls_alignedbuffer.t',
       'bsls_alignment.t',
       'bsls_alignmentfromtype.t',
@@ -79,6 +84,7 @@
       'bsls_compilerfeatures.t',
       'bsls_exceptionutil.t',
       'bsls_ident.t',
+      'bsls_latencyhistogram.t',
       'bsls_macroincrement.t',
       'bsls_nativestd.t',
       'bsls_nullptr.t',
@@ -86,6 +92,8 @@
       'bsls_performancehint.t',
       'bsls_platform.t',
       'bsls_protocoltest.t',
+      'bsls_regionprofiler.t',
+      'bsls_shardedcounter.t',
       'bsls_stopwatch.t',
       'bsls_timeutil.t',
       'bsls_types.t',
@@ -93,6 +101,7 @@
       'bsls_util.t',
     ],
     'bsls_tests_paths': [
+      '<(PRODUCT_DIR)/bsls_adaptivelock.t',
       '<(PRODUCT_DIR)/bsls_alignedbuffer.t',
       '<(PRODUCT_DIR)/bsls_alignment.t',
       '<(PRODUCT_DIR)/bsls_alignmentfromtype.t',
@@ -125,6 +134,7 @@
       '<(PRODUCT_DIR)/bsls_compilerfeatures.t',
       '<(PRODUCT_DIR)/bsls_exceptionutil.t',
       '<(PRODUCT_DIR)/bsls_ident.t',
+      '<(PRODUCT_DIR)/bsls_latencyhistogram.t',
       '<(PRODUCT_DIR)/bsls_macroincrement.t',
       '<(PRODUCT_DIR)/bsls_nativestd.t',
       '<(PRODUCT_DIR)/bsls_nullptr.t',
@@ -132,6 +142,8 @@
       '<(PRODUCT_DIR)/bsls_performancehint.t',
       '<(PRODUCT_DIR)/bsls_platform.t',
       '<(PRODUCT_DIR)/bsls_protocoltest.t',
+      '<(PRODUCT_DIR)/bsls_regionprofiler.t',
+      '<(PRODUCT_DIR)/bsls_shardedcounter.t',
       '<(PRODUCT_DIR)/bsls_stopwatch.t',
       '<(PRODUCT_DIR)/bsls_timeutil.t',
       '<(PRODUCT_DIR)/bsls_types.t',
@@ -195,6 +207,14 @@
       ],
     },
 
+    {
+      'target_name': 'bsls_adaptivelock.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_adaptivelock.t.cpp' ],
+    },
     {
       'target_name': 'bsls_alignedbuffer.t',
       'type': 'executable',
@@ -456,6 +476,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_ident.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_latencyhistogram.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_latencyhistogram.t.cpp' ],
+    },
     {
       'target_name': 'bsls_macroincrement.t',
       'type': 'executable',
@@ -512,6 +540,22 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_protocoltest.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_regionprofiler.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_regionprofiler.t.cpp' ],
+    },
+    {
+      'target_name': 'bsls_shardedcounter.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_shardedcounter.t.cpp' ],
+    },
     {
       'target_name': 'bsls_stopwatch.t',
       'type': 'executable',
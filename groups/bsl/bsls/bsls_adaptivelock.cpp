@@ -0,0 +1,286 @@
+// bsls_adaptivelock.cpp                                              -*-C++-*-
+#include <bsls_adaptivelock.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_atomic.h>         // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+#include <bsls_timeutil.h>       // for testing only
+
+#include <bsls_platform.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_MIN_SPIN_ATTEMPTS =  4,  // attempts allowed even for a lock whose
+                               // running average is 0
+
+    k_MAX_SPIN_ATTEMPTS = 16,  // upper bound on the attempts made before
+                               // blocking
+
+    k_MAX_BACKOFF       = 64   // upper bound on the number of spin-wait hints
+                               // issued between attempts
+};
+
+inline
+void spinWaitHint()
+    // Issue the processor's spin-wait hint instruction, if any, which reduces
+    // power consumption and the penalty incurred on leaving the spin loop.
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    YieldProcessor();
+#elif defined(BSLS_PLATFORM_CMP_GNU)                                          \
+   && (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+    __asm__ __volatile__("pause" ::: "memory");
+#elif defined(BSLS_PLATFORM_CMP_GNU) && defined(BSLS_PLATFORM_CPU_POWERPC)
+    __asm__ __volatile__("or 27,27,27" ::: "memory");  // low thread priority
+    __asm__ __volatile__("or 2,2,2"    ::: "memory");  // normal priority
+#endif
+}
+
+inline
+void backoff(int numHints)
+    // Issue the specified 'numHints' spin-wait hints.
+{
+    for (int i = 0; i < numHints; ++i) {
+        spinWaitHint();
+    }
+}
+
+bool isMultiprocessor()
+    // Return 'true' if the process may run on more than one processor, and
+    // 'false' otherwise.
+{
+    static bsls::AtomicOperations::AtomicTypes::Int s_state = { 0 };
+        // 0: unknown, 1: uniprocessor, 2: multiprocessor
+
+    int state = bsls::AtomicOperations::getIntRelaxed(&s_state);
+    if (0 == state) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        const long numProcessors = info.dwNumberOfProcessors;
+#else
+        const long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        state = 1 == numProcessors ? 1 : 2;
+        bsls::AtomicOperations::setIntRelaxed(&s_state, state);
+    }
+    return 2 == state;
+}
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                             // ------------------
+                             // class AdaptiveLock
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+void AdaptiveLock::lockSlow()
+{
+    if (isMultiprocessor()) {
+        // 'estimate' is a fixed-point value with three fractional bits; each
+        // update computes 'estimate = 7/8 * estimate + attempts'.
+
+        const int estimate = AtomicOperations::getIntRelaxed(&d_spinEstimate);
+
+        int maxAttempts = estimate / 4 + k_MIN_SPIN_ATTEMPTS;
+        if (maxAttempts > k_MAX_SPIN_ATTEMPTS) {
+            maxAttempts = k_MAX_SPIN_ATTEMPTS;
+        }
+
+        int numHints = 1;
+        for (int attempt = 1; attempt <= maxAttempts; ++attempt) {
+            backoff(numHints);
+            if (numHints < k_MAX_BACKOFF) {
+                numHints *= 2;
+            }
+
+            if (0 == d_mutex.tryLock()) {
+                AtomicOperations::setIntRelaxed(&d_spinEstimate,
+                                                estimate - estimate / 8
+                                                                   + attempt);
+                return;                                               // RETURN
+            }
+        }
+
+        AtomicOperations::setIntRelaxed(&d_spinEstimate,
+                                        estimate - estimate / 8);
+    }
+
+    d_mutex.lock();
+}
+
+                            // --------------------
+                            // class AdaptiveRwLock
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+void AdaptiveRwLock::lockReadSlow()
+{
+    // Withdraw the optimistic increment made by 'lockRead', so that the writer
+    // can observe the departure of the readers it is waiting for.
+
+    decrementReaders();
+
+    if (isMultiprocessor()) {
+        int numHints = 1;
+        for (int attempt = 0; attempt < k_MIN_SPIN_ATTEMPTS; ++attempt) {
+            backoff(numHints);
+            numHints *= 2;
+
+            if (0 == (AtomicOperations::getIntAcquire(&d_state)
+                                                              & WRITER_FLAG)
+             && 0 == tryLockRead()) {
+                return;                                               // RETURN
+            }
+        }
+    }
+
+    // Block until the writer releases 'd_writeLock'.  While that lock is held
+    // by this thread no writer can set 'WRITER_FLAG', so the reader count can
+    // be incremented unconditionally.
+
+    d_writeLock.lock();
+    AtomicOperations::addIntAcqRel(&d_state, 1);
+    d_writeLock.unlock();
+}
+
+void AdaptiveRwLock::waitForReaders()
+{
+    if (isMultiprocessor()) {
+        int numHints = 1;
+        for (int attempt = 0; attempt < k_MAX_SPIN_ATTEMPTS; ++attempt) {
+            backoff(numHints);
+            if (numHints < k_MAX_BACKOFF) {
+                numHints *= 2;
+            }
+
+            if (WRITER_FLAG == AtomicOperations::getIntAcquire(&d_state)) {
+                return;                                               // RETURN
+            }
+        }
+    }
+
+    // Announce that this thread is about to block.  From now on, the thread
+    // that clears 'WAITER_FLAG', having found no readers left, is the one to
+    // proceed (if it is this thread) or to wake this thread (if it is a
+    // reader).  This thread resumes only once that reader has finished using
+    // this object, which may then be safely destroyed.
+
+    const int state = AtomicOperations::addIntNvAcqRel(&d_state, WAITER_FLAG);
+    if (WRITER_FLAG + WAITER_FLAG == state
+     && WRITER_FLAG + WAITER_FLAG == AtomicOperations::testAndSwapIntAcqRel(
+                                                    &d_state,
+                                                    WRITER_FLAG + WAITER_FLAG,
+                                                    WRITER_FLAG)) {
+        return;                                                       // RETURN
+    }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(d_readersGone, INFINITE);
+#else
+    pthread_mutex_lock(&d_waitMutex);
+    while (!d_isWriterWoken) {
+        pthread_cond_wait(&d_readersGone, &d_waitMutex);
+    }
+    d_isWriterWoken = false;
+    pthread_mutex_unlock(&d_waitMutex);
+#endif
+}
+
+void AdaptiveRwLock::wakeWriter()
+{
+    // Readers that fail to acquire the lock withdraw their increments, so
+    // several threads may find that no readers remain; only the one that
+    // clears 'WAITER_FLAG' wakes the writer.
+
+    if (WRITER_FLAG + WAITER_FLAG != AtomicOperations::testAndSwapIntAcqRel(
+                                                    &d_state,
+                                                    WRITER_FLAG + WAITER_FLAG,
+                                                    WRITER_FLAG)) {
+        return;                                                       // RETURN
+    }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SetEvent(d_readersGone);
+#else
+    pthread_mutex_lock(&d_waitMutex);
+    d_isWriterWoken = true;
+    pthread_cond_signal(&d_readersGone);
+    pthread_mutex_unlock(&d_waitMutex);
+#endif
+}
+
+// CREATORS
+AdaptiveRwLock::AdaptiveRwLock()
+{
+    AtomicOperations::initInt(&d_state, 0);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    d_readersGone = CreateEventA(0, FALSE, FALSE, 0);
+    BSLS_ASSERT(0 != d_readersGone);
+#else
+    d_isWriterWoken = false;
+
+    int status = pthread_mutex_init(&d_waitMutex, 0);
+    (void)status;
+    BSLS_ASSERT_SAFE(0 == status);
+
+    status = pthread_cond_init(&d_readersGone, 0);
+    BSLS_ASSERT_SAFE(0 == status);
+#endif
+}
+
+AdaptiveRwLock::~AdaptiveRwLock()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    CloseHandle(d_readersGone);
+#else
+    int status = pthread_cond_destroy(&d_readersGone);
+    (void)status;
+    BSLS_ASSERT(0 == status);
+
+    status = pthread_mutex_destroy(&d_waitMutex);
+    BSLS_ASSERT(0 == status);
+#endif
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,644 @@
+// bsls_adaptivelock.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLS_ADAPTIVELOCK
+#define INCLUDED_BSLS_ADAPTIVELOCK
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide spin-then-block mutex and reader-writer locks.
+//
+//@CLASSES:
+//  bsls::AdaptiveLock: mutex that spins with backoff before blocking
+//  bsls::AdaptiveLockGuard: RAII mechanism for an 'AdaptiveLock'
+//  bsls::AdaptiveRwLock: writer-preferring reader-writer lock
+//  bsls::AdaptiveRwLockReadGuard: RAII mechanism for a read lock
+//  bsls::AdaptiveRwLockWriteGuard: RAII mechanism for a write lock
+//
+//@SEE_ALSO: bsls_bsllock
+//
+//@DESCRIPTION: This component provides two locking primitives intended to
+// protect *short* critical sections, and RAII guards for each.
+// 'bsls::AdaptiveLock' is a non-recursive mutex that, when the lock is
+// contended, first spins for a bounded time (using exponential backoff and,
+// where available, the processor's spin-wait hint instruction) in the
+// expectation that the holder will release the lock shortly, and only then
+// blocks the calling thread on an underlying 'bsls::BslLock'.
+// 'bsls::AdaptiveRwLock' is a reader-writer lock, built on an atomic reader
+// count and an 'AdaptiveLock', that allows any number of concurrent readers
+// or a single writer, and that gives preference to writers.
+//
+// 'bsls::AdaptiveLockGuard', 'bsls::AdaptiveRwLockReadGuard', and
+// 'bsls::AdaptiveRwLockWriteGuard' have the same interface as
+// 'bsls::BslLockGuard', and 'bsls::AdaptiveLock' has the same interface as
+// 'bsls::BslLock', so code using 'bsls::BslLock' can switch to
+// 'bsls::AdaptiveLock' by changing only the declared types.  Like
+// 'bsls::BslLock', these types are intended for use by low-level library code;
+// other clients should use the facilities of 'bslmt'.
+//
+///Spinning Policy
+///---------------
+// When 'AdaptiveLock::lock' finds the lock held, it makes a bounded number of
+// further attempts to acquire it, waiting before each attempt for a number of
+// spin-wait hints that doubles on each attempt (up to a fixed maximum).  The
+// number of attempts is adapted to the observed behavior of the lock: it is
+// limited to a small multiple of a running average of the number of attempts
+// that recently led to acquiring the lock, where spinning that ends in
+// blocking counts as zero attempts.  A lock that is typically released after a
+// short spin therefore allows longer spins, whereas a lock whose holders
+// routinely keep it for a long time quickly reverts to a minimal spin before
+// blocking.  On a machine
+// with a single processor, no spinning is performed, as the holder cannot
+// make progress while the waiter spins.
+//
+// A writer in 'AdaptiveRwLock::lockWrite' waiting for the active readers to
+// leave spins in the same fashion and then blocks until it is woken by the
+// last of those readers to release the lock.  A reader that finds a writer
+// active or waiting spins briefly and then blocks until the writer has
+// released the lock.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Cache
+/// - - - - - - - - - - - - - - -
+// Suppose we want a small, thread-safe cache mapping integer keys to values,
+// that is read far more often than it is updated.  First, we define the
+// class, protecting its data with a 'bsls::AdaptiveRwLock':
+//..
+//  class my_Cache {
+//      // This class provides a thread-safe fixed-capacity cache of 'int'
+//      // values.
+//
+//      // DATA
+//      int                          d_values[16];  // values, by key
+//      mutable bsls::AdaptiveRwLock d_lock;        // guards 'd_values'
+//
+//    public:
+//      // CREATORS
+//      my_Cache()
+//          // Create a cache in which all keys map to 0.
+//      {
+//          for (int i = 0; i < 16; ++i) {
+//              d_values[i] = 0;
+//          }
+//      }
+//
+//      // MANIPULATORS
+//      void update(int key, int value)
+//          // Set the value for the specified 'key' to the specified 'value'.
+//          // The behavior is undefined unless '0 <= key < 16'.
+//      {
+//          bsls::AdaptiveRwLockWriteGuard guard(&d_lock);
+//          d_values[key] = value;
+//      }
+//
+//      // ACCESSORS
+//      int lookup(int key) const
+//          // Return the value for the specified 'key'.  The behavior is
+//          // undefined unless '0 <= key < 16'.
+//      {
+//          bsls::AdaptiveRwLockReadGuard guard(&d_lock);
+//          return d_values[key];
+//      }
+//  };
+//..
+// Then, we use the cache:
+//..
+//  my_Cache cache;
+//  cache.update(3, 42);
+//  assert(42 == cache.lookup(3));
+//  assert( 0 == cache.lookup(4));
+//..
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+
+#ifndef INCLUDED_PTHREAD
+#include <pthread.h>
+#define INCLUDED_PTHREAD
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace bsls {
+
+                             // ==================
+                             // class AdaptiveLock
+                             // ==================
+
+class AdaptiveLock {
+    // This 'class' implements a non-recursive mutex that spins (with
+    // exponential backoff) for a bounded, adaptively-determined number of
+    // attempts before blocking on an underlying 'BslLock'.  See 'Spinning
+    // Policy' in the component-level documentation.
+
+    // DATA
+    BslLock                        d_mutex;         // underlying mutex
+
+    AtomicOperations::AtomicTypes::Int
+                                   d_spinEstimate;  // running average of
+                                                    // attempts that acquired
+                                                    // the lock by spinning,
+                                                    // in units of 1/8 attempt
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveLock(const AdaptiveLock&);             // = delete
+    AdaptiveLock& operator=(const AdaptiveLock&);  // = delete
+
+    // PRIVATE MANIPULATORS
+    void lockSlow();
+        // Acquire the lock on this object, which was found to be held by
+        // another thread, spinning before blocking according to the policy
+        // described in the component-level documentation.
+
+  public:
+    // CREATORS
+    AdaptiveLock();
+        // Create a lock object initialized to the unlocked state.
+
+    //! ~AdaptiveLock() = default;
+        // Destroy this lock object.  The behavior is undefined unless this
+        // object is in the unlocked state.
+
+    // MANIPULATORS
+    void lock();
+        // Acquire the lock on this object.  If the lock on this object is
+        // currently held by another thread, then spin for a bounded time and,
+        // if the lock is still unavailable, suspend execution of the calling
+        // thread until the lock can be acquired.  The behavior is undefined
+        // unless the calling thread does not already hold the lock on this
+        // object.
+
+    int tryLock();
+        // Attempt to acquire the lock on this object without blocking or
+        // spinning.  Return 0 on success, and a non-zero value if the lock is
+        // currently held by another thread.  The behavior is undefined unless
+        // the calling thread does not already hold the lock on this object.
+
+    void unlock();
+        // Release the lock on this object that was previously acquired
+        // through a successful call to 'lock' or 'tryLock', enabling another
+        // thread to acquire the lock.  The behavior is undefined unless the
+        // calling thread holds the lock on this object.
+};
+
+                          // =======================
+                          // class AdaptiveLockGuard
+                          // =======================
+
+class AdaptiveLockGuard {
+    // This 'class' implements a guard for automatically acquiring and
+    // releasing the lock on an associated 'bsls::AdaptiveLock' object.  This
+    // mechanism follows the RAII idiom whereby the lock is acquired upon
+    // construction and released upon destruction.
+
+    // DATA
+    AdaptiveLock *d_lock_p;  // lock guarded by this object (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveLockGuard(const AdaptiveLockGuard&);             // = delete
+    AdaptiveLockGuard& operator=(const AdaptiveLockGuard&);  // = delete
+
+  public:
+    // CREATORS
+    explicit AdaptiveLockGuard(AdaptiveLock *lock);
+        // Create a guard object that manages the specified 'lock', and
+        // acquires the lock on 'lock' by invoking its 'lock' method.  The
+        // behavior is undefined unless the calling thread does not already
+        // hold the lock on 'lock'.  Note that 'lock' must remain valid
+        // throughout the lifetime of this guard, or until 'release' is called.
+
+    ~AdaptiveLockGuard();
+        // Destroy this guard object and release the lock on the object it
+        // manages (if any) by invoking its 'unlock' method.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the object currently managed by this guard,
+        // if any, without unlocking it.
+};
+
+                            // ====================
+                            // class AdaptiveRwLock
+                            // ====================
+
+class AdaptiveRwLock {
+    // This 'class' implements a non-recursive, writer-preferring
+    // reader-writer lock that allows either any number of readers or a single
+    // writer to hold the lock.  Once a writer has begun to acquire the lock,
+    // no further readers are admitted until the writer releases it.
+
+    // PRIVATE TYPES
+    enum {
+        WRITER_FLAG = 1 << 30, // added to 'd_state' while a writer holds, or
+                               // is waiting for readers to release, the lock
+
+        WAITER_FLAG = 1 << 29  // added to 'd_state' while a writer is blocked
+                               // waiting for readers to release the lock
+    };
+
+    // DATA
+    AtomicOperations::AtomicTypes::Int
+                     d_state;          // number of readers holding (or
+                                       // attempting to acquire) the lock, plus
+                                       // 'WRITER_FLAG' if a writer holds or is
+                                       // acquiring the lock, plus
+                                       // 'WAITER_FLAG' if that writer is
+                                       // blocked
+
+    AdaptiveLock     d_writeLock;      // held by the (unique) writer for the
+                                       // duration of its acquisition and
+                                       // ownership; blocked readers wait on
+                                       // this lock
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    void            *d_readersGone;    // 'HANDLE' of an auto-reset event on
+                                       // which a blocked writer waits
+#else
+    pthread_mutex_t  d_waitMutex;      // protects 'd_isWriterWoken'
+
+    pthread_cond_t   d_readersGone;    // condition on which a blocked writer
+                                       // waits
+
+    bool             d_isWriterWoken;  // 'true' once a blocked writer has
+                                       // been woken, and until it resumes
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveRwLock(const AdaptiveRwLock&);             // = delete
+    AdaptiveRwLock& operator=(const AdaptiveRwLock&);  // = delete
+
+    // PRIVATE MANIPULATORS
+    void decrementReaders();
+        // Decrement the number of readers in 'd_state', and wake the writer
+        // blocked waiting for readers, if any, if no readers remain.
+
+    void lockReadSlow();
+        // Acquire a read lock on this object, having found that a writer
+        // holds, or is acquiring, the lock.
+
+    void waitForReaders();
+        // Wait until all readers have released this lock.  The behavior is
+        // undefined unless the calling thread holds 'd_writeLock' and has
+        // set 'WRITER_FLAG' in 'd_state'.
+
+    void wakeWriter();
+        // Wake the writer blocked waiting for readers, having found that no
+        // readers remain, unless another thread has already done so, or the
+        // writer has found that no readers remain.
+
+  public:
+    // CREATORS
+    AdaptiveRwLock();
+        // Create a reader-writer lock initialized to the unlocked state.
+
+    ~AdaptiveRwLock();
+        // Destroy this lock object.  The behavior is undefined unless this
+        // object is in the unlocked state.
+
+    // MANIPULATORS
+    void lockRead();
+        // Acquire a read lock on this object, waiting (first spinning, then
+        // blocking) while a writer holds or is acquiring the lock.  The
+        // behavior is undefined if the calling thread already holds a lock on
+        // this object.
+
+    void lockWrite();
+        // Acquire the write lock on this object, waiting (first spinning,
+        // then blocking) until no other thread holds a lock on this object.
+        // The behavior is undefined if the calling thread already holds a
+        // lock on this object.
+
+    int tryLockRead();
+        // Attempt to acquire a read lock on this object without waiting.
+        // Return 0 on success, and a non-zero value if a writer holds or is
+        // acquiring the lock.
+
+    int tryLockWrite();
+        // Attempt to acquire the write lock on this object without waiting.
+        // Return 0 on success, and a non-zero value if any other thread holds
+        // or is acquiring a lock on this object.
+
+    void unlockRead();
+        // Release a read lock on this object.  The behavior is undefined
+        // unless the calling thread holds a read lock on this object.
+
+    void unlockWrite();
+        // Release the write lock on this object.  The behavior is undefined
+        // unless the calling thread holds the write lock on this object.
+};
+
+                        // =============================
+                        // class AdaptiveRwLockReadGuard
+                        // =============================
+
+class AdaptiveRwLockReadGuard {
+    // This 'class' implements a guard for automatically acquiring and
+    // releasing a read lock on an associated 'bsls::AdaptiveRwLock' object.
+
+    // DATA
+    AdaptiveRwLock *d_lock_p;  // lock guarded by this object (held, not
+                               // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveRwLockReadGuard(const AdaptiveRwLockReadGuard&);
+    AdaptiveRwLockReadGuard& operator=(const AdaptiveRwLockReadGuard&);
+
+  public:
+    // CREATORS
+    explicit AdaptiveRwLockReadGuard(AdaptiveRwLock *lock);
+        // Create a guard object that manages the specified 'lock', and
+        // acquires a read lock on 'lock' by invoking its 'lockRead' method.
+        // The behavior is undefined unless the calling thread does not already
+        // hold a lock on 'lock'.
+
+    ~AdaptiveRwLockReadGuard();
+        // Destroy this guard object and release the read lock on the object
+        // it manages (if any) by invoking its 'unlockRead' method.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the object currently managed by this guard,
+        // if any, without unlocking it.
+};
+
+                       // ==============================
+                       // class AdaptiveRwLockWriteGuard
+                       // ==============================
+
+class AdaptiveRwLockWriteGuard {
+    // This 'class' implements a guard for automatically acquiring and
+    // releasing the write lock on an associated 'bsls::AdaptiveRwLock'
+    // object.
+
+    // DATA
+    AdaptiveRwLock *d_lock_p;  // lock guarded by this object (held, not
+                               // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveRwLockWriteGuard(const AdaptiveRwLockWriteGuard&);
+    AdaptiveRwLockWriteGuard& operator=(const AdaptiveRwLockWriteGuard&);
+
+  public:
+    // CREATORS
+    explicit AdaptiveRwLockWriteGuard(AdaptiveRwLock *lock);
+        // Create a guard object that manages the specified 'lock', and
+        // acquires the write lock on 'lock' by invoking its 'lockWrite'
+        // method.  The behavior is undefined unless the calling thread does
+        // not already hold a lock on 'lock'.
+
+    ~AdaptiveRwLockWriteGuard();
+        // Destroy this guard object and release the write lock on the object
+        // it manages (if any) by invoking its 'unlockWrite' method.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the object currently managed by this guard,
+        // if any, without unlocking it.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class AdaptiveLock
+                             // ------------------
+
+// CREATORS
+inline
+AdaptiveLock::AdaptiveLock()
+{
+    AtomicOperations::initInt(&d_spinEstimate, 0);
+}
+
+// MANIPULATORS
+inline
+void AdaptiveLock::lock()
+{
+    if (0 != d_mutex.tryLock()) {
+        lockSlow();
+    }
+}
+
+inline
+int AdaptiveLock::tryLock()
+{
+    return d_mutex.tryLock();
+}
+
+inline
+void AdaptiveLock::unlock()
+{
+    d_mutex.unlock();
+}
+
+                          // -----------------------
+                          // class AdaptiveLockGuard
+                          // -----------------------
+
+// CREATORS
+inline
+AdaptiveLockGuard::AdaptiveLockGuard(AdaptiveLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lock();
+}
+
+inline
+AdaptiveLockGuard::~AdaptiveLockGuard()
+{
+    if (d_lock_p) {
+        d_lock_p->unlock();
+    }
+}
+
+// MANIPULATORS
+inline
+void AdaptiveLockGuard::release()
+{
+    d_lock_p = 0;
+}
+
+                            // --------------------
+                            // class AdaptiveRwLock
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+inline
+void AdaptiveRwLock::decrementReaders()
+{
+    if (WRITER_FLAG + WAITER_FLAG ==
+                             AtomicOperations::addIntNvAcqRel(&d_state, -1)) {
+        wakeWriter();
+    }
+}
+
+// MANIPULATORS
+inline
+void AdaptiveRwLock::lockRead()
+{
+    if (AtomicOperations::addIntNvAcqRel(&d_state, 1) & WRITER_FLAG) {
+        lockReadSlow();
+    }
+}
+
+inline
+void AdaptiveRwLock::lockWrite()
+{
+    d_writeLock.lock();
+    if (WRITER_FLAG != AtomicOperations::addIntNvAcqRel(&d_state,
+                                                        WRITER_FLAG)) {
+        waitForReaders();
+    }
+}
+
+inline
+int AdaptiveRwLock::tryLockRead()
+{
+    if (AtomicOperations::addIntNvAcqRel(&d_state, 1) & WRITER_FLAG) {
+        decrementReaders();
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+inline
+int AdaptiveRwLock::tryLockWrite()
+{
+    if (0 != d_writeLock.tryLock()) {
+        return 1;                                                     // RETURN
+    }
+    if (0 != AtomicOperations::testAndSwapIntAcqRel(&d_state,
+                                                    0,
+                                                    WRITER_FLAG)) {
+        d_writeLock.unlock();
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+inline
+void AdaptiveRwLock::unlockRead()
+{
+    decrementReaders();
+}
+
+inline
+void AdaptiveRwLock::unlockWrite()
+{
+    AtomicOperations::addIntAcqRel(&d_state, -WRITER_FLAG);
+    d_writeLock.unlock();
+}
+
+                        // -----------------------------
+                        // class AdaptiveRwLockReadGuard
+                        // -----------------------------
+
+// CREATORS
+inline
+AdaptiveRwLockReadGuard::AdaptiveRwLockReadGuard(AdaptiveRwLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lockRead();
+}
+
+inline
+AdaptiveRwLockReadGuard::~AdaptiveRwLockReadGuard()
+{
+    if (d_lock_p) {
+        d_lock_p->unlockRead();
+    }
+}
+
+// MANIPULATORS
+inline
+void AdaptiveRwLockReadGuard::release()
+{
+    d_lock_p = 0;
+}
+
+                       // ------------------------------
+                       // class AdaptiveRwLockWriteGuard
+                       // ------------------------------
+
+// CREATORS
+inline
+AdaptiveRwLockWriteGuard::AdaptiveRwLockWriteGuard(AdaptiveRwLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lockWrite();
+}
+
+inline
+AdaptiveRwLockWriteGuard::~AdaptiveRwLockWriteGuard()
+{
+    if (d_lock_p) {
+        d_lock_p->unlockWrite();
+    }
+}
+
+// MANIPULATORS
+inline
+void AdaptiveRwLockWriteGuard::release()
+{
+    d_lock_p = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1177 @@
+// bsls_adaptivelock.t.cpp                                            -*-C++-*-
+#include <bsls_adaptivelock.h>
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_atomic.h>         // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+#include <bsls_timeutil.h>       // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// We are testing a mutex, 'bsls::AdaptiveLock', a reader-writer lock,
+// 'bsls::AdaptiveRwLock', and a guard for each kind of lock.  The single
+// threaded behavior of the 'try*' methods establishes the state transitions
+// of each lock.  Mutual exclusion is then verified by having many threads
+// update shared, unprotected data under the lock and checking that no update
+// is lost or observed half-done.  Since spinning and blocking are not
+// directly observable, the contended paths are exercised mostly by these
+// stress tests, and by verifying that a writer kept waiting by a reader
+// consumes little processor time; negative test cases measure their
+// performance.
+// ----------------------------------------------------------------------------
+// 'AdaptiveLock' class:
+// [ 2] AdaptiveLock();
+// [ 2] ~AdaptiveLock();
+// [ 2] void lock();
+// [ 2] int tryLock();
+// [ 2] void unlock();
+//
+// 'AdaptiveLockGuard' class:
+// [ 3] AdaptiveLockGuard(AdaptiveLock *lock);
+// [ 3] ~AdaptiveLockGuard();
+// [ 3] void release();
+//
+// 'AdaptiveRwLock' class:
+// [ 4] AdaptiveRwLock();
+// [ 4] ~AdaptiveRwLock();
+// [ 4] void lockRead();
+// [ 4] void lockWrite();
+// [ 4] int tryLockRead();
+// [ 4] int tryLockWrite();
+// [ 4] void unlockRead();
+// [ 4] void unlockWrite();
+//
+// 'AdaptiveRwLockReadGuard' class:
+// [ 5] AdaptiveRwLockReadGuard(AdaptiveRwLock *lock);
+// [ 5] ~AdaptiveRwLockReadGuard();
+// [ 5] void release();
+//
+// 'AdaptiveRwLockWriteGuard' class:
+// [ 5] AdaptiveRwLockWriteGuard(AdaptiveRwLock *lock);
+// [ 5] ~AdaptiveRwLockWriteGuard();
+// [ 5] void release();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 2] CONCERN: 'AdaptiveLock' provides mutual exclusion under contention
+// [ 4] CONCERN: 'AdaptiveRwLock' excludes readers from a writer.
+// [ 3] CONCERN: Precondition violations are detected when enabled.
+// [-1] PERFORMANCE: contended 'AdaptiveLock' vs. 'BslLock'
+// [-2] PERFORMANCE: read-mostly 'AdaptiveRwLock' vs. 'BslLock'
+
+// ============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::AdaptiveLock             Obj;
+typedef bsls::AdaptiveLockGuard        Guard;
+typedef bsls::AdaptiveRwLock           RwObj;
+typedef bsls::AdaptiveRwLockReadGuard  ReadGuard;
+typedef bsls::AdaptiveRwLockWriteGuard WriteGuard;
+typedef bsls::Types::Int64             Int64;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+enum { MAX_THREADS = 64 };
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+static
+void sleepMilliseconds(int milliseconds)
+    // Suspend the calling thread for at least the specified 'milliseconds'.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    Sleep(milliseconds);
+#else
+    usleep(milliseconds * 1000);
+#endif
+}
+
+static
+void runThreads(ThreadFunction func, void *args, int argSize, int numThreads)
+    // Run the specified 'func' in the specified 'numThreads' threads, passing
+    // to thread 'i' the address 'args + i * argSize', where the specified
+    // 'args' is the address of an array of 'numThreads' objects of the
+    // specified 'argSize', and wait for all of the threads to complete.
+{
+    ThreadId ids[MAX_THREADS];
+    for (int i = 0; i < numThreads; ++i) {
+        ids[i] = createThread(func, static_cast<char *>(args) + i * argSize);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+    }
+}
+
+                                // ------
+                                // case 2
+                                // ------
+
+struct MutexStressData {
+    Obj             d_lock;
+    int             d_counter;      // protected by 'd_lock'
+    int             d_shadow;       // always equal to 'd_counter' when
+                                    // 'd_lock' is not held
+    bsls::AtomicInt d_numErrors;
+};
+
+struct MutexStressArgs {
+    MutexStressData *d_data_p;
+    int              d_iterations;
+};
+
+extern "C" void *mutexStressThread(void *arg)
+{
+    MutexStressArgs *args = static_cast<MutexStressArgs *>(arg);
+    MutexStressData *data = args->d_data_p;
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        if (i % 3) {
+            data->d_lock.lock();
+        }
+        else {
+            while (0 != data->d_lock.tryLock()) {
+                ;
+            }
+        }
+        if (data->d_counter != data->d_shadow) {
+            ++data->d_numErrors;
+        }
+        ++data->d_counter;
+        ++data->d_shadow;
+        data->d_lock.unlock();
+    }
+    return 0;
+}
+
+                                // ------
+                                // case 4
+                                // ------
+
+struct RwStressData {
+    RwObj           d_lock;
+    int             d_values[4];  // all elements equal when no writer holds
+                                  // 'd_lock'
+    bsls::AtomicInt d_numErrors;
+    bsls::AtomicInt d_numReads;
+};
+
+struct RwStressArgs {
+    RwStressData *d_data_p;
+    int           d_iterations;
+    bool          d_isWriter;
+};
+
+extern "C" void *rwStressThread(void *arg)
+{
+    RwStressArgs *args = static_cast<RwStressArgs *>(arg);
+    RwStressData *data = args->d_data_p;
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        if (args->d_isWriter) {
+            if (i & 1) {
+                data->d_lock.lockWrite();
+            }
+            else {
+                while (0 != data->d_lock.tryLockWrite()) {
+                    ;
+                }
+            }
+            if (data->d_values[0] != data->d_values[3]) {
+                ++data->d_numErrors;
+            }
+            for (int j = 0; j < 4; ++j) {
+                ++data->d_values[j];
+            }
+            data->d_lock.unlockWrite();
+        }
+        else {
+            if (i & 1) {
+                data->d_lock.lockRead();
+            }
+            else {
+                while (0 != data->d_lock.tryLockRead()) {
+                    ;
+                }
+            }
+            const int v = data->d_values[0];
+            for (int j = 1; j < 4; ++j) {
+                if (v != data->d_values[j]) {
+                    ++data->d_numErrors;
+                }
+            }
+            data->d_lock.unlockRead();
+            ++data->d_numReads;
+        }
+    }
+    return 0;
+}
+
+struct TryInfo {
+    RwObj *d_lock_p;
+    int    d_readResult;
+    int    d_writeResult;
+};
+
+extern "C" void *tryRwThread(void *arg)
+    // Attempt to acquire a read lock and then the write lock on the lock
+    // referred to by the specified 'arg' (a 'TryInfo'), recording the results
+    // and releasing any lock acquired.
+{
+    TryInfo *info = static_cast<TryInfo *>(arg);
+
+    info->d_readResult = info->d_lock_p->tryLockRead();
+    if (0 == info->d_readResult) {
+        info->d_lock_p->unlockRead();
+    }
+    info->d_writeResult = info->d_lock_p->tryLockWrite();
+    if (0 == info->d_writeResult) {
+        info->d_lock_p->unlockWrite();
+    }
+    return 0;
+}
+
+struct BlockedWriterInfo {
+    RwObj           *d_lock_p;
+    bsls::AtomicInt  d_hasLock;  // 1 once the writer holds the lock
+    Int64            d_cpuTime;  // processor time consumed by 'lockWrite'
+};
+
+extern "C" void *blockedWriterThread(void *arg)
+    // Acquire and release the write lock on the lock referred to by the
+    // specified 'arg' (a 'BlockedWriterInfo'), recording the processor time
+    // consumed by the calling thread while acquiring it.
+{
+    BlockedWriterInfo *info = static_cast<BlockedWriterInfo *>(arg);
+
+    const Int64 start = bsls::TimeUtil::getThreadCpuTimer();
+    info->d_lock_p->lockWrite();
+    info->d_cpuTime = bsls::TimeUtil::getThreadCpuTimer() - start;
+
+    info->d_hasLock = 1;
+    info->d_lock_p->unlockWrite();
+    return 0;
+}
+
+static
+void tryFromOtherThread(RwObj *lock, int *readResult, int *writeResult)
+    // Load into the specified 'readResult' and 'writeResult' the results of
+    // calling 'tryLockRead' and 'tryLockWrite' on the specified 'lock' from
+    // another thread.
+{
+    TryInfo info;
+    info.d_lock_p = lock;
+    joinThread(createThread(&tryRwThread, &info));
+    *readResult  = info.d_readResult;
+    *writeResult = info.d_writeResult;
+}
+
+                                // -------
+                                // case -1
+                                // -------
+
+template <class LOCK>
+struct ContentionData {
+    LOCK            d_lock;
+    Int64           d_counter;    // protected by 'd_lock'
+    bsls::AtomicInt d_go;
+};
+
+template <class LOCK>
+struct ContentionArgs {
+    ContentionData<LOCK> *d_data_p;
+    int                   d_iterations;
+    int                   d_criticalWork;  // loop iterations inside lock
+    int                   d_outsideWork;   // loop iterations outside lock
+};
+
+static
+int spinWork(int n)
+    // Perform the specified 'n' iterations of busy work, and return a value
+    // that depends on them.
+{
+    volatile int x = 0;
+    for (int i = 0; i < n; ++i) {
+        x = x + i;
+    }
+    return x;
+}
+
+template <class LOCK>
+void *contentionThread(void *arg)
+{
+    ContentionArgs<LOCK> *args = static_cast<ContentionArgs<LOCK> *>(arg);
+    ContentionData<LOCK> *data = args->d_data_p;
+
+    while (0 == data->d_go.load()) {
+        ;
+    }
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        data->d_lock.lock();
+        data->d_counter += spinWork(args->d_criticalWork) & 1;
+        ++data->d_counter;
+        data->d_lock.unlock();
+
+        spinWork(args->d_outsideWork);
+    }
+    return 0;
+}
+
+template <class LOCK>
+double runContention(int numThreads,
+                     int iterations,
+                     int criticalWork,
+                     int outsideWork)
+    // Return the average wall time, in nanoseconds, per lock acquisition when
+    // the specified 'numThreads' threads each acquire a 'LOCK' the specified
+    // 'iterations' times, performing the specified 'criticalWork' iterations
+    // of busy work while holding the lock and the specified 'outsideWork'
+    // iterations after releasing it.
+{
+    ContentionData<LOCK> data;
+    data.d_counter = 0;
+    data.d_go      = 0;
+
+    ContentionArgs<LOCK> args[MAX_THREADS];
+    ThreadId             ids[MAX_THREADS];
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_data_p       = &data;
+        args[i].d_iterations   = iterations;
+        args[i].d_criticalWork = criticalWork;
+        args[i].d_outsideWork  = outsideWork;
+        ids[i] = createThread(&contentionThread<LOCK>, &args[i]);
+    }
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    data.d_go = 1;
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+    }
+    const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(elapsed)
+                          / (static_cast<double>(iterations) * numThreads);
+}
+
+                                // -------
+                                // case -2
+                                // -------
+
+struct MutexAsRwLock {
+    // This 'struct' adapts 'bsls::BslLock' to the interface of
+    // 'bsls::AdaptiveRwLock' (using exclusive locking for readers) to provide
+    // a baseline for the reader-writer benchmark.
+
+    bsls::BslLock d_lock;
+
+    void lockRead()    { d_lock.lock(); }
+    void unlockRead()  { d_lock.unlock(); }
+    void lockWrite()   { d_lock.lock(); }
+    void unlockWrite() { d_lock.unlock(); }
+};
+
+template <class LOCK>
+struct ReadMostlyData {
+    LOCK            d_lock;
+    int             d_table[64];  // protected by 'd_lock'
+    bsls::AtomicInt d_go;
+};
+
+template <class LOCK>
+struct ReadMostlyArgs {
+    ReadMostlyData<LOCK> *d_data_p;
+    int                   d_iterations;
+    int                   d_writePercent;
+};
+
+template <class LOCK>
+void *readMostlyThread(void *arg)
+{
+    ReadMostlyArgs<LOCK> *args = static_cast<ReadMostlyArgs<LOCK> *>(arg);
+    ReadMostlyData<LOCK> *data = args->d_data_p;
+
+    while (0 == data->d_go.load()) {
+        ;
+    }
+
+    unsigned int seed = static_cast<unsigned int>(
+                                  reinterpret_cast<bsls::Types::UintPtr>(arg));
+    int sum = 0;
+    for (int i = 0; i < args->d_iterations; ++i) {
+        seed = seed * 1103515245U + 12345U;
+        const int index = (seed >> 16) & 63;
+        if (static_cast<int>((seed >> 8) % 100) < args->d_writePercent) {
+            data->d_lock.lockWrite();
+            ++data->d_table[index];
+            data->d_lock.unlockWrite();
+        }
+        else {
+            data->d_lock.lockRead();
+            sum += data->d_table[index];
+            data->d_lock.unlockRead();
+        }
+    }
+    return sum == 42 ? arg : 0;
+}
+
+template <class LOCK>
+double runReadMostly(int numThreads, int iterations, int writePercent)
+    // Return the average wall time, in nanoseconds, per operation when the
+    // specified 'numThreads' threads each perform the specified 'iterations'
+    // operations on a table protected by a 'LOCK', the specified
+    // 'writePercent' percent of which are writes.
+{
+    ReadMostlyData<LOCK> data;
+    for (int i = 0; i < 64; ++i) {
+        data.d_table[i] = 0;
+    }
+    data.d_go = 0;
+
+    ReadMostlyArgs<LOCK> args[MAX_THREADS];
+    ThreadId             ids[MAX_THREADS];
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_data_p       = &data;
+        args[i].d_iterations   = iterations;
+        args[i].d_writePercent = writePercent;
+        ids[i] = createThread(&readMostlyThread<LOCK>, &args[i]);
+    }
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    data.d_go = 1;
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+    }
+    const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(elapsed)
+                          / (static_cast<double>(iterations) * numThreads);
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Cache
+/// - - - - - - - - - - - - - - -
+// Suppose we want a small, thread-safe cache mapping integer keys to values,
+// that is read far more often than it is updated.  First, we define the
+// class, protecting its data with a 'bsls::AdaptiveRwLock':
+//..
+    class my_Cache {
+        // This class provides a thread-safe fixed-capacity cache of 'int'
+        // values.
+
+        // DATA
+        int                          d_values[16];  // values, by key
+        mutable bsls::AdaptiveRwLock d_lock;        // guards 'd_values'
+
+      public:
+        // CREATORS
+        my_Cache()
+            // Create a cache in which all keys map to 0.
+        {
+            for (int i = 0; i < 16; ++i) {
+                d_values[i] = 0;
+            }
+        }
+
+        // MANIPULATORS
+        void update(int key, int value)
+            // Set the value for the specified 'key' to the specified 'value'.
+            // The behavior is undefined unless '0 <= key < 16'.
+        {
+            bsls::AdaptiveRwLockWriteGuard guard(&d_lock);
+            d_values[key] = value;
+        }
+
+        // ACCESSORS
+        int lookup(int key) const
+            // Return the value for the specified 'key'.  The behavior is
+            // undefined unless '0 <= key < 16'.
+        {
+            bsls::AdaptiveRwLockReadGuard guard(&d_lock);
+            return d_values[key];
+        }
+    };
+//..
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we use the cache:
+//..
+    my_Cache cache;
+    cache.update(3, 42);
+    ASSERT(42 == cache.lookup(3));
+    ASSERT( 0 == cache.lookup(4));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // READER-WRITER GUARDS
+        //
+        // Concerns:
+        //: 1 A read guard acquires a read lock on construction and releases
+        //:   it on destruction.
+        //:
+        //: 2 A write guard acquires the write lock on construction and
+        //:   releases it on destruction.
+        //:
+        //: 3 'release' detaches a guard from its lock without unlocking it.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 While each kind of guard is in scope, use 'try*' methods from
+        //:   another thread to observe the state of the lock; repeat after
+        //:   the guard is destroyed, and after 'release'.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null lock.  (C-4)
+        //
+        // Testing:
+        //   AdaptiveRwLockReadGuard(AdaptiveRwLock *lock);
+        //   ~AdaptiveRwLockReadGuard();
+        //   void release();
+        //   AdaptiveRwLockWriteGuard(AdaptiveRwLock *lock);
+        //   ~AdaptiveRwLockWriteGuard();
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nREADER-WRITER GUARDS"
+                            "\n====================\n");
+
+        RwObj mX;
+        int   readResult, writeResult;
+
+        {
+            ReadGuard guard(&mX);
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 == readResult);
+            ASSERT(0 != writeResult);
+        }
+        tryFromOtherThread(&mX, &readResult, &writeResult);
+        ASSERT(0 == readResult);
+        ASSERT(0 == writeResult);
+
+        {
+            WriteGuard guard(&mX);
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 != readResult);
+            ASSERT(0 != writeResult);
+        }
+        tryFromOtherThread(&mX, &readResult, &writeResult);
+        ASSERT(0 == readResult);
+        ASSERT(0 == writeResult);
+
+        {
+            ReadGuard guard(&mX);
+            guard.release();
+        }
+        tryFromOtherThread(&mX, &readResult, &writeResult);
+        ASSERT(0 == readResult);
+        ASSERT(0 != writeResult);
+        mX.unlockRead();
+
+        {
+            WriteGuard guard(&mX);
+            guard.release();
+        }
+        tryFromOtherThread(&mX, &readResult, &writeResult);
+        ASSERT(0 != readResult);
+        ASSERT(0 != writeResult);
+        mX.unlockWrite();
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            RwObj mY;
+
+            ASSERT_SAFE_PASS((ReadGuard(&mY)));
+            ASSERT_SAFE_FAIL( ReadGuard(   0));
+            ASSERT_SAFE_PASS((WriteGuard(&mY)));
+            ASSERT_SAFE_FAIL( WriteGuard(   0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'AdaptiveRwLock'
+        //
+        // Concerns:
+        //: 1 Following construction, the lock is unlocked: both a read lock
+        //:   and the write lock can be acquired.
+        //:
+        //: 2 Any number of threads can hold read locks at the same time, but
+        //:   the write lock cannot be acquired while a read lock is held.
+        //:
+        //: 3 Neither a read lock nor the write lock can be acquired while the
+        //:   write lock is held.
+        //:
+        //: 4 'unlockRead' and 'unlockWrite' restore the unlocked state once
+        //:   all locks are released.
+        //:
+        //: 5 Under contention, readers never observe a writer's partial
+        //:   update, writers exclude each other, and every operation
+        //:   completes (i.e., there is no deadlock).
+        //:
+        //: 6 A writer waiting for a reader that holds the lock for a long time
+        //:   blocks, rather than consuming processor time, and acquires the
+        //:   lock once the reader releases it.
+        //
+        // Plan:
+        //: 1 Acquire and release locks in the main thread using each of the
+        //:   manipulators, observing the state of the lock from another
+        //:   thread using 'tryLockRead' and 'tryLockWrite'.  (C-1..4)
+        //:
+        //: 2 Run a mix of reader and writer threads, where writers increment
+        //:   every element of a shared array and readers verify that the
+        //:   elements are equal.  Verify that no errors were recorded, and
+        //:   that the array holds the total number of writes.  (C-5)
+        //:
+        //: 3 Hold a read lock in the main thread while another thread calls
+        //:   'lockWrite', release it after 200 milliseconds, and verify that
+        //:   the writer acquired the lock only then, having consumed less than
+        //:   half that time of processor time.  (C-6)
+        //
+        // Testing:
+        //   AdaptiveRwLock();
+        //   ~AdaptiveRwLock();
+        //   void lockRead();
+        //   void lockWrite();
+        //   int tryLockRead();
+        //   int tryLockWrite();
+        //   void unlockRead();
+        //   void unlockWrite();
+        //   CONCERN: 'AdaptiveRwLock' excludes readers from a writer.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'AdaptiveRwLock'"
+                            "\n================\n");
+
+        {
+            RwObj mX;
+            int   readResult, writeResult;
+
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 == readResult);
+            ASSERT(0 == writeResult);
+
+            mX.lockRead();
+            ASSERT(0 == mX.tryLockRead());
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 == readResult);
+            ASSERT(0 != writeResult);
+
+            mX.unlockRead();
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 == readResult);
+            ASSERT(0 != writeResult);
+
+            mX.unlockRead();
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 == readResult);
+            ASSERT(0 == writeResult);
+
+            mX.lockWrite();
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 != readResult);
+            ASSERT(0 != writeResult);
+
+            mX.unlockWrite();
+            ASSERT(0 == mX.tryLockWrite());
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 != readResult);
+            ASSERT(0 != writeResult);
+
+            mX.unlockWrite();
+            tryFromOtherThread(&mX, &readResult, &writeResult);
+            ASSERT(0 == readResult);
+            ASSERT(0 == writeResult);
+        }
+
+        if (verbose) printf("\nStress test.\n");
+        {
+            enum { NUM_THREADS = 8, NUM_WRITERS = 2, NUM_ITERATIONS = 20000 };
+
+            RwStressData data;
+            for (int j = 0; j < 4; ++j) {
+                data.d_values[j] = 0;
+            }
+
+            RwStressArgs args[NUM_THREADS];
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                args[i].d_data_p     = &data;
+                args[i].d_iterations = NUM_ITERATIONS;
+                args[i].d_isWriter   = i < NUM_WRITERS;
+            }
+            runThreads(&rwStressThread, args, sizeof *args, NUM_THREADS);
+
+            ASSERTV(data.d_numErrors, 0 == data.d_numErrors);
+            for (int j = 0; j < 4; ++j) {
+                ASSERTV(j, data.d_values[j],
+                        NUM_WRITERS * NUM_ITERATIONS == data.d_values[j]);
+            }
+            ASSERT((NUM_THREADS - NUM_WRITERS) * NUM_ITERATIONS
+                                                           == data.d_numReads);
+        }
+
+        if (verbose) printf("\nWriter blocked by a long-held read lock.\n");
+        {
+            enum { HOLD_MILLISECONDS = 200 };
+
+            bsls::TimeUtil::initialize();
+
+            RwObj             mX;
+            BlockedWriterInfo info;
+            info.d_lock_p  = &mX;
+            info.d_cpuTime = 0;
+
+            mX.lockRead();
+            const ThreadId id = createThread(&blockedWriterThread, &info);
+
+            sleepMilliseconds(HOLD_MILLISECONDS);
+            ASSERT(0 == info.d_hasLock);
+
+            mX.unlockRead();
+            joinThread(id);
+
+            ASSERT(1 == info.d_hasLock);
+            ASSERTV(info.d_cpuTime,
+                    info.d_cpuTime < HOLD_MILLISECONDS / 2 * 1000 * 1000);
+
+            if (veryVerbose) { T_ P(info.d_cpuTime) }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'AdaptiveLockGuard'
+        //
+        // Concerns:
+        //: 1 The guard acquires the lock on construction and releases it on
+        //:   destruction.
+        //:
+        //: 2 'release' detaches the guard from its lock without unlocking it.
+        //:
+        //: 3 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Observe the state of the lock using 'tryLock' after each
+        //:   operation.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null lock.  (C-3)
+        //
+        // Testing:
+        //   AdaptiveLockGuard(AdaptiveLock *lock);
+        //   ~AdaptiveLockGuard();
+        //   void release();
+        //   CONCERN: Precondition violations are detected when enabled.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'AdaptiveLockGuard'"
+                            "\n===================\n");
+
+        Obj mX;
+        {
+            Guard guard(&mX);
+        }
+        ASSERT(0 == mX.tryLock());
+        mX.unlock();
+
+        {
+            Guard guard(&mX);
+            guard.release();
+        }
+        mX.unlock();
+        ASSERT(0 == mX.tryLock());
+        mX.unlock();
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mY;
+
+            ASSERT_SAFE_PASS((Guard(&mY)));
+            ASSERT_SAFE_FAIL( Guard(  0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'AdaptiveLock'
+        //
+        // Concerns:
+        //: 1 Following construction, the lock is unlocked.
+        //:
+        //: 2 'lock' and 'tryLock' acquire the lock for exclusive access, and
+        //:   'tryLock' fails while the lock is held.
+        //:
+        //: 3 'unlock' releases the lock.
+        //:
+        //: 4 Under contention (i.e., when the spin-then-block path is taken)
+        //:   no two threads hold the lock at the same time and no thread is
+        //:   left waiting forever.
+        //
+        // Plan:
+        //: 1 Use 'tryLock' to observe the state of the lock after each
+        //:   operation.  (C-1..3)
+        //:
+        //: 2 Run many threads that increment two shared, unprotected counters
+        //:   under the lock, verifying on each acquisition that the counters
+        //:   are equal, and verify the final count.  (C-4)
+        //
+        // Testing:
+        //   AdaptiveLock();
+        //   ~AdaptiveLock();
+        //   void lock();
+        //   int tryLock();
+        //   void unlock();
+        //   CONCERN: 'AdaptiveLock' provides mutual exclusion under contention
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'AdaptiveLock'"
+                            "\n==============\n");
+
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.tryLock());
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+
+            mX.lock();
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+            ASSERT(0 == mX.tryLock());
+            mX.unlock();
+        }
+
+        if (verbose) printf("\nStress test.\n");
+
+        const int THREAD_COUNTS[] = { 2, 4, 16 };
+        const int NUM_THREAD_COUNTS = sizeof THREAD_COUNTS
+                                    / sizeof *THREAD_COUNTS;
+
+        for (int ti = 0; ti < NUM_THREAD_COUNTS; ++ti) {
+            const int NUM_THREADS    = THREAD_COUNTS[ti];
+            const int NUM_ITERATIONS = 20000;
+
+            if (veryVerbose) { T_ P(NUM_THREADS) }
+
+            MutexStressData data;
+            data.d_counter = 0;
+            data.d_shadow  = 0;
+
+            MutexStressArgs args[16];
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                args[i].d_data_p     = &data;
+                args[i].d_iterations = NUM_ITERATIONS;
+            }
+            runThreads(&mutexStressThread, args, sizeof *args, NUM_THREADS);
+
+            ASSERTV(NUM_THREADS, data.d_numErrors, 0 == data.d_numErrors);
+            ASSERTV(NUM_THREADS, data.d_counter,
+                    NUM_THREADS * NUM_ITERATIONS == data.d_counter);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Lock and unlock each kind of lock, directly and through guards.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;
+        mX.lock();
+        mX.unlock();
+        {
+            Guard guard(&mX);
+        }
+
+        RwObj mY;
+        mY.lockRead();
+        mY.lockRead();
+        mY.unlockRead();
+        mY.unlockRead();
+        mY.lockWrite();
+        mY.unlockWrite();
+        {
+            ReadGuard guard(&mY);
+        }
+        {
+            WriteGuard guard(&mY);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONTENDED MUTEX
+        //
+        // Concerns:
+        //: 1 For short critical sections under contention, 'AdaptiveLock' is
+        //:   faster than 'BslLock' because waiters usually acquire the lock
+        //:   while spinning rather than being suspended.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 64 threads and for a few critical-section
+        //:   lengths, measure the average wall time per acquisition for
+        //:   'BslLock' and 'AdaptiveLock', and print the results.  The number
+        //:   of acquisitions per thread may be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: contended 'AdaptiveLock' vs. 'BslLock'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: CONTENDED MUTEX"
+                            "\n============================\n");
+
+        const int ITERATIONS = verbose ? atoi(argv[2]) : 100000;
+
+        const int CRITICAL_WORK[] = { 0, 20, 200 };
+        const int NUM_CRITICAL_WORK = sizeof CRITICAL_WORK
+                                    / sizeof *CRITICAL_WORK;
+
+        for (int wi = 0; wi < NUM_CRITICAL_WORK; ++wi) {
+            const int WORK = CRITICAL_WORK[wi];
+
+            printf("\ncritical section: %d iterations, outside: %d\n",
+                   WORK, 2 * WORK + 10);
+            printf("%8s %14s %14s\n", "threads", "BslLock", "AdaptiveLock");
+            printf("%8s %14s %14s\n", "", "(ns/op)", "(ns/op)");
+
+            for (int n = 1; n <= MAX_THREADS; n *= 2) {
+                const double bslLock = runContention<bsls::BslLock>(
+                                                              n,
+                                                              ITERATIONS / n,
+                                                              WORK,
+                                                              2 * WORK + 10);
+                const double adaptive = runContention<Obj>(n,
+                                                           ITERATIONS / n,
+                                                           WORK,
+                                                           2 * WORK + 10);
+                printf("%8d %14.2f %14.2f\n", n, bslLock, adaptive);
+            }
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: READ-MOSTLY DATA
+        //
+        // Concerns:
+        //: 1 For read-mostly access, 'AdaptiveRwLock' allows readers to
+        //:   proceed concurrently, outperforming an exclusive 'BslLock'.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 64 threads and write ratios of 0%, 1%, and
+        //:   10%, measure the average wall time per operation on a table
+        //:   protected by a 'BslLock' (used for both reads and writes) and by
+        //:   an 'AdaptiveRwLock', and print the results.  The number of
+        //:   operations per thread may be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: read-mostly 'AdaptiveRwLock' vs. 'BslLock'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: READ-MOSTLY DATA"
+                            "\n=============================\n");
+
+        const int ITERATIONS = verbose ? atoi(argv[2]) : 100000;
+
+        const int WRITE_PERCENT[] = { 0, 1, 10 };
+        const int NUM_WRITE_PERCENT = sizeof WRITE_PERCENT
+                                    / sizeof *WRITE_PERCENT;
+
+        for (int wi = 0; wi < NUM_WRITE_PERCENT; ++wi) {
+            const int PERCENT = WRITE_PERCENT[wi];
+
+            printf("\nwrites: %d%%\n", PERCENT);
+            printf("%8s %14s %14s\n", "threads", "BslLock", "AdaptiveRwLock");
+            printf("%8s %14s %14s\n", "", "(ns/op)", "(ns/op)");
+
+            for (int n = 1; n <= MAX_THREADS; n *= 2) {
+                const double bslLock = runReadMostly<MutexAsRwLock>(
+                                                              n,
+                                                              ITERATIONS / n,
+                                                              PERCENT);
+                const double rwLock = runReadMostly<RwObj>(n,
+                                                           ITERATIONS / n,
+                                                           PERCENT);
+                printf("%8d %14.2f %14.2f\n", n, bslLock, rwLock);
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -282,6 +282,9 @@ extern "C" {
     __declspec(dllimport) void __stdcall LeaveCriticalSection(
                                          LPCRITICAL_SECTION lpCriticalSection);
 
+    __declspec(dllimport) BOOL __stdcall TryEnterCriticalSection(
+                                         LPCRITICAL_SECTION lpCriticalSection);
+
 }  // extern "C"
 
 #else
@@ -349,11 +352,17 @@ class BslLock {
         // on this object.  Note that deadlock may result if this method is
         // invoked while the calling thread holds the lock on the object.
 
+    int tryLock();
+        // Attempt to acquire the lock on this object without blocking.
+        // Return 0 on success, and a non-zero value if the lock is currently
+        // held by another thread.  The behavior is undefined unless the
+        // calling thread does not already hold the lock on this object.
+
     void unlock();
         // Release the lock on this object that was previously acquired
-        // through a call to 'lock', enabling another thread to acquire the
-        // lock.  The behavior is undefined unless the calling thread holds the
-        // lock on this object.
+        // through a successful call to 'lock' or 'tryLock', enabling another
+        // thread to acquire the lock.  The behavior is undefined unless the
+        // calling thread holds the lock on this object.
 };
 
                              // ==================
@@ -456,6 +465,19 @@ void BslLock::lock()
 #endif
 }
 
+inline
+int BslLock::tryLock()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return TryEnterCriticalSection(
+                         reinterpret_cast<_RTL_CRITICAL_SECTION *>(d_lock))
+           ? 0
+           : 1;
+#else
+    return pthread_mutex_trylock(&d_lock);
+#endif
+}
+
 inline
 void BslLock::unlock()
 {
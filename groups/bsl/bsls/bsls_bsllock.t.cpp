@@ -35,6 +35,7 @@ using namespace BloombergLP;
 // [ 1] BslLock::~BslLock();
 // [ 1] void BslLock::lock();
 // [ 1] void BslLock::unlock();
+// [ 3] int BslLock::tryLock();
 //
 // 'BslLockGuard' class:
 // [ 2] BslLockGuard::BslLockGuard(BslLock *lock);
@@ -42,7 +43,7 @@ using namespace BloombergLP;
 // [ 2] void BslLockGuard::release();
 // ----------------------------------------------------------------------------
 // [ 1] BASIC TEST
-// [ 3] USAGE EXAMPLE
+// [ 4] USAGE EXAMPLE
 // [ 2] CONCERN: Precondition violations are detected when enabled.
 
 // ============================================================================
@@ -179,6 +180,27 @@ extern "C" void *threadFunction(void *arg)
     info->d_lock->unlock();                                           // UNLOCK
     info->d_threadDone = 1;
 
+    return arg;
+}
+
+                                // ------
+                                // case 3
+                                // ------
+
+struct TryLockInfo {
+    Obj *d_lock;
+    int  d_result;
+};
+
+extern "C" void *tryLockThreadFunction(void *arg)
+{
+    TryLockInfo *info = (TryLockInfo *)arg;
+
+    info->d_result = info->d_lock->tryLock();
+    if (0 == info->d_result) {
+        info->d_lock->unlock();
+    }
+
     return arg;
 }
 
@@ -418,7 +440,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -467,6 +489,56 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'tryLock'
+        //
+        // Concerns:
+        //: 1 'tryLock' acquires an unlocked lock and returns 0.
+        //:
+        //: 2 'tryLock' returns a non-zero value, without blocking, if the lock
+        //:   is held by another thread.
+        //:
+        //: 3 A lock acquired with 'tryLock' is released by 'unlock'.
+        //
+        // Plan:
+        //: 1 Acquire an unlocked lock using 'tryLock' in the main thread and
+        //:   verify the return value.  Create a child thread that calls
+        //:   'tryLock' on the held lock, and verify that it fails.  (C-1..2)
+        //:
+        //: 2 Unlock the lock, and verify that the child thread can acquire
+        //:   it with 'tryLock'.  (C-3)
+        //
+        // Testing:
+        //   int BslLock::tryLock();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'tryLock'"
+                            "\n=================\n");
+
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.tryLock());                                // LOCK
+
+            TryLockInfo info;
+            info.d_lock   = &mX;
+            info.d_result = -1;
+
+            ThreadId id = createThread(&tryLockThreadFunction, &info);
+            joinThread(id);
+
+            ASSERT(0 != info.d_result);
+
+            mX.unlock();                                              // UNLOCK
+
+            info.d_result = -1;
+            id = createThread(&tryLockThreadFunction, &info);
+            joinThread(id);
+
+            ASSERT(0 == info.d_result);
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // GUARD TEST
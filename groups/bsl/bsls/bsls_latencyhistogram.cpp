@@ -0,0 +1,162 @@
+// bsls_latencyhistogram.cpp                                          -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// CLASS METHODS
+Types::Int64 LatencyHistogram::bucketLowerBound(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < NUM_BUCKETS);
+
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> SUB_BUCKET_BITS) - 1;
+    const int mantissa = SUB_BUCKET_COUNT + (index & (SUB_BUCKET_COUNT - 1));
+
+    return static_cast<Types::Int64>(mantissa) << shift;
+}
+
+Types::Int64 LatencyHistogram::bucketUpperBound(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < NUM_BUCKETS);
+
+    if (NUM_BUCKETS - 1 == index) {
+        return (static_cast<Types::Int64>(1) << MAX_VALUE_BITS) - 1;
+                                                                      // RETURN
+    }
+
+    return bucketLowerBound(index + 1) - 1;
+}
+
+// CREATORS
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+// MANIPULATORS
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+    if (0 == other.d_count) {
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        d_counts[i] += other.d_counts[i];
+    }
+
+    if (0 == d_count || other.d_min < d_min) {
+        d_min = other.d_min;
+    }
+    if (0 == d_count || other.d_max > d_max) {
+        d_max = other.d_max;
+    }
+    d_count += other.d_count;
+    d_sum   += other.d_sum;
+}
+
+void LatencyHistogram::reset()
+{
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        d_counts[i] = 0;
+    }
+    d_count = 0;
+    d_sum   = 0;
+
+    // Start 'd_min' and 'd_max' at the extremes so that 'record' need not
+    // test for the first value.
+
+    d_min   = static_cast<Types::Int64>(~static_cast<Types::Uint64>(0) >> 1);
+    d_max   = 0;
+}
+
+// ACCESSORS
+Types::Int64 LatencyHistogram::valueAtPercentile(double percentile) const
+{
+    BSLS_ASSERT_SAFE(0.0 <= percentile);
+    BSLS_ASSERT_SAFE(percentile <= 100.0);
+
+    if (0 == d_count) {
+        return 0;                                                     // RETURN
+    }
+
+    if (0.0 == percentile) {
+        return d_min;                                                 // RETURN
+    }
+
+    // Compute the 1-based rank of the requested value, rounding to the
+    // nearest integer (rounding up, or taking the ceiling, would make the
+    // result sensitive to the representation error in 'percentile').
+
+    Types::Int64 rank = static_cast<Types::Int64>(
+                      percentile / 100.0 * static_cast<double>(d_count) + 0.5);
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > d_count) {
+        rank = d_count;
+    }
+
+    Types::Int64 cumulative = 0;
+    int          index      = 0;
+    for (; index < NUM_BUCKETS - 1; ++index) {
+        cumulative += d_counts[index];
+        if (cumulative >= rank) {
+            break;
+        }
+    }
+
+    // The highest bucket also holds values beyond its nominal bound, so the
+    // exact maximum is the best available answer for it.
+
+    const Types::Int64 result = NUM_BUCKETS - 1 == index
+                              ? d_max
+                              : bucketUpperBound(index);
+
+    return result < d_min ? d_min
+         : result > d_max ? d_max
+         : result;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
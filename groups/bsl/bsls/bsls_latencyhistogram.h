@@ -0,0 +1,500 @@
+// bsls_latencyhistogram.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLS_LATENCYHISTOGRAM
+#define INCLUDED_BSLS_LATENCYHISTOGRAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size log-linear histogram of latencies.
+//
+//@CLASSES:
+//  bsls::LatencyHistogram: fixed-memory histogram with percentile queries
+//  bsls::LatencyHistogramTimer: scoped guard recording elapsed time
+//
+//@SEE_ALSO: bsls_timeutil, bsls_stopwatch
+//
+//@DESCRIPTION: This component provides a class, 'bsls::LatencyHistogram',
+// that records the distribution of a sequence of non-negative 64-bit values
+// (typically latencies in nanoseconds) in a fixed number of buckets, and
+// answers queries for the count, minimum, maximum, mean, and arbitrary
+// percentiles (e.g., the median, or the 99.9th percentile) of the recorded
+// values.  A 'bsls::LatencyHistogram' never allocates memory, and recording a
+// value takes a handful of instructions, so a histogram can be updated on
+// latency-critical paths where a 'bsls::Stopwatch', which accumulates only a
+// total, is not informative enough.
+//
+// This component also provides a guard, 'bsls::LatencyHistogramTimer', that
+// reads the 'bsls::TimeUtil' raw timer upon construction and, upon
+// destruction, records the elapsed time in nanoseconds into a histogram.
+//
+///Bucketing Scheme
+///----------------
+// Buckets are arranged in the "log-linear" scheme popularized by
+// HdrHistogram: the range of values is divided into powers of two, and each
+// power of two is subdivided into 'SUB_BUCKET_COUNT' (32) equal-width
+// buckets.  Values less than '2 * SUB_BUCKET_COUNT' are therefore recorded
+// exactly, and larger values are recorded with a relative error of less than
+// '1 / SUB_BUCKET_COUNT' (about 3%).  Locating the bucket of a value requires
+// only a count-leading-zeros instruction, two shifts, and an addition.
+//
+// Values up to (but not including) '2^MAX_VALUE_BITS' (2^36, or about 68.7
+// seconds when values are nanoseconds) are distinguished; larger values are
+// counted in the highest bucket.  Negative values (which may arise, for
+// example, from a clock adjustment) are recorded as 0.  The minimum, maximum,
+// and sum of the recorded values are maintained exactly, so 'min', 'max', and
+// 'mean' are not subject to bucketing error, and percentile queries are
+// clamped to the range '[min() .. max()]'.
+//
+// The memory footprint of a histogram is a little over 'NUM_BUCKETS' (1024)
+// 64-bit counters, or about 8 KB.
+//
+///Thread Safety
+///-------------
+// 'bsls::LatencyHistogram' is *not* thread-safe: recording is a sequence of
+// plain (non-atomic) updates, which is what makes it cheap.  The intended
+// pattern for multi-threaded programs is that each thread records into a
+// histogram of its own, and that histograms are combined with 'add' (under
+// whatever synchronization the program uses to hand data between threads) for
+// reporting.  A copy of a histogram is a snapshot of its state at the time of
+// the copy, and 'reset' discards all recorded values, so a thread can
+// periodically publish a snapshot of its histogram and then reset it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring Per-Message Latency
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the distribution of the time spent processing
+// each message in a service.  First, we define a function that processes a
+// message, using a 'bsls::LatencyHistogramTimer' to record the duration of
+// the processing into a histogram:
+//..
+//  void processMessage(bsls::LatencyHistogram *histogram, int message)
+//      // Process the specified 'message', recording the time taken into the
+//      // specified 'histogram'.
+//  {
+//      bsls::LatencyHistogramTimer timer(histogram);
+//
+//      // ... (process 'message')
+//
+//      (void)message;
+//  }
+//..
+// Then, we process some messages:
+//..
+//  bsls::LatencyHistogram histogram;
+//
+//  for (int i = 0; i < 1000; ++i) {
+//      processMessage(&histogram, i);
+//  }
+//  assert(1000 == histogram.count());
+//..
+// Next, to illustrate the percentile queries, we record some known values
+// into a second histogram, and combine the two:
+//..
+//  bsls::LatencyHistogram other;
+//  for (int i = 1; i <= 100; ++i) {
+//      other.record(i * 1000);
+//  }
+//  assert(100      == other.count());
+//  assert(1000     == other.min());
+//  assert(100000   == other.max());
+//  assert(50500.0  == other.mean());
+//..
+// Percentiles are reported as the highest value that is recorded in the same
+// bucket as the value at the requested rank, so they are accurate to within
+// about 3%:
+//..
+//  const bsls::Types::Int64 median = other.valueAtPercentile(50.0);
+//  assert(50000 <= median);
+//  assert(median < 50000 + 50000 / 32);
+//
+//  assert(100000 == other.valueAtPercentile(100.0));
+//
+//  histogram.add(other);
+//  assert(1100 == histogram.count());
+//..
+// Finally, note that the percentile queries do not modify the histogram, and
+// so a reporting thread can query a snapshot (i.e., a copy) at leisure.
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    #ifndef INCLUDED_INTRIN
+    #include <intrin.h>
+    #define INCLUDED_INTRIN
+    #endif
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // ======================
+                           // class LatencyHistogram
+                           // ======================
+
+class LatencyHistogram {
+    // This class records the distribution of a sequence of non-negative
+    // 64-bit values in 'NUM_BUCKETS' log-linear buckets (see {Bucketing
+    // Scheme}), and provides percentile queries on the recorded values.  This
+    // class has value semantics only in the sense that copies are
+    // independent snapshots; no equality comparison is provided.  This class
+    // is not thread-safe.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        SUB_BUCKET_BITS  = 5,                     // log2 of the number of
+                                                  // buckets per power of two
+
+        SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS,  // buckets per power of two
+
+        MAX_VALUE_BITS   = 36,                    // values '>=
+                                                  // 2^MAX_VALUE_BITS' share
+                                                  // the highest bucket
+
+        NUM_BUCKETS      = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1)
+                                                           * SUB_BUCKET_COUNT
+                                                  // total number of buckets
+    };
+
+  private:
+    // DATA
+    Types::Int64 d_counts[NUM_BUCKETS];  // number of values in each bucket
+    Types::Int64 d_count;                // total number of values
+    Types::Int64 d_sum;                  // sum of the values
+    Types::Int64 d_min;                  // least value, if 'd_count > 0'
+    Types::Int64 d_max;                  // greatest value, if 'd_count > 0'
+
+    // PRIVATE CLASS METHODS
+    static int highestBit(Types::Uint64 value);
+        // Return the index of the most-significant set bit in the specified
+        // 'value'.  The behavior is undefined unless '0 != value'.
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(Types::Int64 value);
+        // Return the index of the bucket in which the specified 'value' is
+        // recorded.  Negative values are treated as 0, and values greater
+        // than or equal to '2^MAX_VALUE_BITS' are treated as
+        // '2^MAX_VALUE_BITS - 1'.
+
+    static Types::Int64 bucketLowerBound(int index);
+        // Return the least value recorded in the bucket having the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < NUM_BUCKETS'.
+
+    static Types::Int64 bucketUpperBound(int index);
+        // Return the greatest value recorded in the bucket having the
+        // specified 'index', except that, for the highest bucket, return
+        // '2^MAX_VALUE_BITS - 1'.  The behavior is undefined unless
+        // '0 <= index < NUM_BUCKETS'.
+
+    // CREATORS
+    LatencyHistogram();
+        // Create an empty histogram.
+
+    //! LatencyHistogram(const LatencyHistogram& original) = default;
+        // Create a histogram having the same recorded values as the specified
+        // 'original' histogram.
+
+    //! ~LatencyHistogram() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! LatencyHistogram& operator=(const LatencyHistogram& rhs) = default;
+        // Assign to this histogram the recorded values of the specified 'rhs'
+        // histogram, and return a reference providing modifiable access to
+        // this histogram.
+
+    void add(const LatencyHistogram& other);
+        // Add the values recorded in the specified 'other' histogram to this
+        // histogram.
+
+    void record(Types::Int64 value);
+        // Record the specified 'value' in this histogram.  A negative 'value'
+        // is recorded as 0.
+
+    void recordElapsed(const TimeUtil::OpaqueNativeTime& startTime);
+        // Record in this histogram the number of nanoseconds elapsed since
+        // the specified 'startTime', which must have been obtained from
+        // 'TimeUtil::getTimerRaw'.
+
+    void reset();
+        // Discard all values recorded in this histogram.
+
+    // ACCESSORS
+    Types::Int64 bucketCount(int index) const;
+        // Return the number of values recorded in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < NUM_BUCKETS'.
+
+    Types::Int64 count() const;
+        // Return the number of values recorded in this histogram.
+
+    Types::Int64 max() const;
+        // Return the greatest value recorded in this histogram, or 0 if no
+        // values have been recorded.
+
+    double mean() const;
+        // Return the arithmetic mean of the values recorded in this
+        // histogram, or 0 if no values have been recorded.
+
+    Types::Int64 min() const;
+        // Return the least value recorded in this histogram, or 0 if no
+        // values have been recorded.
+
+    Types::Int64 sum() const;
+        // Return the sum of the values recorded in this histogram.
+
+    Types::Int64 valueAtPercentile(double percentile) const;
+        // Return an upper bound, accurate to within the precision of the
+        // buckets, of the value below or at which the specified 'percentile'
+        // of the values recorded in this histogram fall, or 0 if no values
+        // have been recorded.  Specifically, return 'min()' if 'percentile'
+        // is 0, and otherwise the greatest value that is recorded in the same
+        // bucket as the 'N'th smallest recorded value (where 'N' is
+        // 'percentile / 100 * count()' rounded to the nearest integer, but at
+        // least 1), clamped to the range '[min() .. max()]'.  The behavior is
+        // undefined unless '0 <= percentile <= 100'.
+};
+
+                        // ===========================
+                        // class LatencyHistogramTimer
+                        // ===========================
+
+class LatencyHistogramTimer {
+    // This class implements a guard that reads the 'TimeUtil' raw timer upon
+    // construction and records, upon destruction, the time elapsed (in
+    // nanoseconds) into a histogram supplied at construction.
+
+    // DATA
+    LatencyHistogram           *d_histogram_p;  // histogram to record into,
+                                                // or 0 if released
+    TimeUtil::OpaqueNativeTime  d_startTime;    // raw time at construction
+
+  private:
+    // NOT IMPLEMENTED
+    LatencyHistogramTimer(const LatencyHistogramTimer&);
+    LatencyHistogramTimer& operator=(const LatencyHistogramTimer&);
+
+  public:
+    // CREATORS
+    explicit LatencyHistogramTimer(LatencyHistogram *histogram);
+        // Create a guard that, upon destruction, records into the specified
+        // 'histogram' the number of nanoseconds elapsed since its
+        // construction.  The behavior is undefined unless 'histogram' is not
+        // 0.
+
+    ~LatencyHistogramTimer();
+        // Destroy this object and, unless 'release' has been called, record
+        // into the histogram supplied at construction the number of
+        // nanoseconds elapsed since the construction of this object.
+
+    // MANIPULATORS
+    void release();
+        // Release this guard from the histogram supplied at construction, so
+        // that no value is recorded upon destruction.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// PRIVATE CLASS METHODS
+inline
+int LatencyHistogram::highestBit(Types::Uint64 value)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU)
+    return 63 - __builtin_clzll(value);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    int result = 0;
+    for (int shift = 32; shift > 0; shift >>= 1) {
+        if (value >> shift) {
+            value  >>= shift;
+            result  += shift;
+        }
+    }
+    return result;
+#endif
+}
+
+// CLASS METHODS
+inline
+int LatencyHistogram::bucketIndex(Types::Int64 value)
+{
+    const Types::Uint64 limit = static_cast<Types::Uint64>(1)
+                                                             << MAX_VALUE_BITS;
+
+    // A single unsigned comparison detects both negative and too-large
+    // values, keeping the common path free of further branches.
+
+    Types::Uint64 v = static_cast<Types::Uint64>(value);
+    if (v >= limit) {
+        v = value < 0 ? 0 : limit - 1;
+    }
+
+    // Setting the 'SUB_BUCKET_COUNT' bit maps the values below
+    // '2 * SUB_BUCKET_COUNT' linearly onto the buckets of the same indices,
+    // so that small values need no special case.
+
+    const int shift = highestBit(v | SUB_BUCKET_COUNT) - SUB_BUCKET_BITS;
+
+    return ((shift + 1) << SUB_BUCKET_BITS)
+         + static_cast<int>(v >> shift)
+         - SUB_BUCKET_COUNT;
+}
+
+// MANIPULATORS
+inline
+void LatencyHistogram::record(Types::Int64 value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+
+    ++d_counts[bucketIndex(value)];
+    ++d_count;
+    d_sum += value;
+    if (value < d_min) {
+        d_min = value;
+    }
+    if (value > d_max) {
+        d_max = value;
+    }
+}
+
+inline
+void LatencyHistogram::recordElapsed(
+                                   const TimeUtil::OpaqueNativeTime& startTime)
+{
+    TimeUtil::OpaqueNativeTime now;
+    TimeUtil::getTimerRaw(&now);
+    record(TimeUtil::convertRawTime(now)
+                                       - TimeUtil::convertRawTime(startTime));
+}
+
+// ACCESSORS
+inline
+Types::Int64 LatencyHistogram::bucketCount(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < NUM_BUCKETS);
+
+    return d_counts[index];
+}
+
+inline
+Types::Int64 LatencyHistogram::count() const
+{
+    return d_count;
+}
+
+inline
+Types::Int64 LatencyHistogram::max() const
+{
+    return d_count ? d_max : 0;
+}
+
+inline
+double LatencyHistogram::mean() const
+{
+    return d_count ? static_cast<double>(d_sum) / static_cast<double>(d_count)
+                   : 0.0;
+}
+
+inline
+Types::Int64 LatencyHistogram::min() const
+{
+    return d_count ? d_min : 0;
+}
+
+inline
+Types::Int64 LatencyHistogram::sum() const
+{
+    return d_sum;
+}
+
+                        // ---------------------------
+                        // class LatencyHistogramTimer
+                        // ---------------------------
+
+// CREATORS
+inline
+LatencyHistogramTimer::LatencyHistogramTimer(LatencyHistogram *histogram)
+: d_histogram_p(histogram)
+{
+    BSLS_ASSERT_SAFE(histogram);
+
+    TimeUtil::getTimerRaw(&d_startTime);
+}
+
+inline
+LatencyHistogramTimer::~LatencyHistogramTimer()
+{
+    if (d_histogram_p) {
+        d_histogram_p->recordElapsed(d_startTime);
+    }
+}
+
+// MANIPULATORS
+inline
+void LatencyHistogramTimer::release()
+{
+    d_histogram_p = 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
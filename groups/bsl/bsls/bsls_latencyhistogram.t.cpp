@@ -0,0 +1,957 @@
+// bsls_latencyhistogram.t.cpp                                        -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+#include <bsls_timeutil.h>       // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a histogram, 'bsls::LatencyHistogram',
+// and a guard, 'bsls::LatencyHistogramTimer', that records elapsed times into
+// a histogram.  The mapping of values to buckets is a pure function that we
+// verify exhaustively at bucket boundaries.  The accessors are then verified
+// against values computed independently from the recorded sequence, and
+// 'valueAtPercentile' is verified against both hand-computed tables and the
+// exact percentiles of large uniformly-distributed samples, within the
+// documented precision.
+// ----------------------------------------------------------------------------
+// 'LatencyHistogram' class:
+// [ 2] static int bucketIndex(Int64 value);
+// [ 2] static Int64 bucketLowerBound(int index);
+// [ 2] static Int64 bucketUpperBound(int index);
+// [ 3] LatencyHistogram();
+// [ 3] LatencyHistogram(const LatencyHistogram& original);
+// [ 3] ~LatencyHistogram();
+// [ 3] LatencyHistogram& operator=(const LatencyHistogram& rhs);
+// [ 4] void add(const LatencyHistogram& other);
+// [ 3] void record(Int64 value);
+// [ 6] void recordElapsed(const TimeUtil::OpaqueNativeTime& startTime);
+// [ 3] void reset();
+// [ 3] Int64 bucketCount(int index) const;
+// [ 3] Int64 count() const;
+// [ 3] Int64 max() const;
+// [ 3] double mean() const;
+// [ 3] Int64 min() const;
+// [ 3] Int64 sum() const;
+// [ 5] Int64 valueAtPercentile(double percentile) const;
+//
+// 'LatencyHistogramTimer' class:
+// [ 6] explicit LatencyHistogramTimer(LatencyHistogram *histogram);
+// [ 6] ~LatencyHistogramTimer();
+// [ 6] void release();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: cost of 'record' and of a timed scope
+
+// ============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::LatencyHistogram      Obj;
+typedef bsls::LatencyHistogramTimer Timer;
+typedef bsls::Types::Int64          Int64;
+typedef bsls::TimeUtil              TU;
+
+const Int64 LIMIT = static_cast<Int64>(1) << Obj::MAX_VALUE_BITS;
+    // least value that is not distinguished by the histogram
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *seed)
+    // Return the next value of a simple linear congruential generator having
+    // the specified 'seed' state, and update 'seed'.
+{
+    *seed = *seed * 1103515245U + 12345U;
+    return *seed >> 8;
+}
+
+static int compareInt64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Int64' at the
+    // specified 'lhs' address is less than, equal to, or greater than the
+    // 'Int64' at the specified 'rhs' address, respectively.
+{
+    const Int64 a = *static_cast<const Int64 *>(lhs);
+    const Int64 b = *static_cast<const Int64 *>(rhs);
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+static void busyWork(int iterations)
+    // Perform the specified 'iterations' of work that cannot be optimized
+    // away.
+{
+    volatile int x = 0;
+    for (int i = 0; i < iterations; ++i) {
+        x = x + i;
+    }
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring Per-Message Latency
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the distribution of the time spent processing
+// each message in a service.  First, we define a function that processes a
+// message, using a 'bsls::LatencyHistogramTimer' to record the duration of
+// the processing into a histogram:
+//..
+    void processMessage(bsls::LatencyHistogram *histogram, int message)
+        // Process the specified 'message', recording the time taken into the
+        // specified 'histogram'.
+    {
+        bsls::LatencyHistogramTimer timer(histogram);
+
+        // ... (process 'message')
+
+        (void)message;
+    }
+//..
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we process some messages:
+//..
+    bsls::LatencyHistogram histogram;
+
+    for (int i = 0; i < 1000; ++i) {
+        processMessage(&histogram, i);
+    }
+    ASSERT(1000 == histogram.count());
+//..
+// Next, to illustrate the percentile queries, we record some known values
+// into a second histogram, and combine the two:
+//..
+    bsls::LatencyHistogram other;
+    for (int i = 1; i <= 100; ++i) {
+        other.record(i * 1000);
+    }
+    ASSERT(100      == other.count());
+    ASSERT(1000     == other.min());
+    ASSERT(100000   == other.max());
+    ASSERT(50500.0  == other.mean());
+//..
+// Percentiles are reported as the highest value that is recorded in the same
+// bucket as the value at the requested rank, so they are accurate to within
+// about 3%:
+//..
+    const bsls::Types::Int64 median = other.valueAtPercentile(50.0);
+    ASSERT(50000 <= median);
+    ASSERT(median < 50000 + 50000 / 32);
+
+    ASSERT(100000 == other.valueAtPercentile(100.0));
+
+    histogram.add(other);
+    ASSERT(1100 == histogram.count());
+//..
+// Finally, note that the percentile queries do not modify the histogram, and
+// so a reporting thread can query a snapshot (i.e., a copy) at leisure.
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'recordElapsed' AND 'LatencyHistogramTimer'
+        //
+        // Concerns:
+        //: 1 'recordElapsed' records a single value: the number of
+        //:   nanoseconds elapsed since the supplied raw time.
+        //:
+        //: 2 The timer records one value, equal to the time elapsed between
+        //:   its construction and destruction, into the histogram supplied at
+        //:   construction.
+        //:
+        //: 3 A released timer records nothing.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Bracket 'recordElapsed', and the lifetime of a timer, with calls
+        //:   to 'TimeUtil::getTimer', and verify that exactly one value is
+        //:   recorded, and that it is bounded by the bracketing interval.
+        //:   (C-1..2)
+        //:
+        //: 2 Release a timer and verify that nothing is recorded.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null histogram.  (C-4)
+        //
+        // Testing:
+        //   void recordElapsed(const TimeUtil::OpaqueNativeTime& startTime);
+        //   explicit LatencyHistogramTimer(LatencyHistogram *histogram);
+        //   ~LatencyHistogramTimer();
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'recordElapsed' AND 'LatencyHistogramTimer'"
+                            "\n===========================================\n");
+
+        TU::initialize();
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const Int64 before = TU::getTimer();
+            TU::OpaqueNativeTime start;
+            TU::getTimerRaw(&start);
+            busyWork(100000);
+            mX.recordElapsed(start);
+            const Int64 after = TU::getTimer();
+
+            if (veryVerbose) { T_ P_(X.max()) P(after - before) }
+
+            ASSERT(1 == X.count());
+            ASSERT(0 <= X.min());
+            ASSERTV(X.max(), after - before, X.max() <= after - before);
+        }
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const Int64 before = TU::getTimer();
+            {
+                Timer timer(&mX);
+                busyWork(100000);
+            }
+            const Int64 after = TU::getTimer();
+
+            if (veryVerbose) { T_ P_(X.max()) P(after - before) }
+
+            ASSERT(1 == X.count());
+            ASSERT(0 <= X.min());
+            ASSERTV(X.max(), after - before, X.max() <= after - before);
+
+            {
+                Timer timer(&mX);
+                timer.release();
+            }
+            ASSERT(1 == X.count());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;
+
+            ASSERT_SAFE_PASS((Timer(&mX)));
+            ASSERT_SAFE_FAIL( Timer(  0));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'valueAtPercentile'
+        //
+        // Concerns:
+        //: 1 An empty histogram reports 0 for every percentile.
+        //:
+        //: 2 The rank of the requested value is the requested fraction of the
+        //:   count, rounded to the nearest integer, and at least 1.
+        //:
+        //: 3 The reported value is the upper bound of the bucket holding the
+        //:   value of that rank, clamped to '[min() .. max()]'; in particular,
+        //:   the 0th and 100th percentiles are the exact minimum and maximum.
+        //:
+        //: 4 For arbitrary distributions, the reported value is not less than
+        //:   the exact percentile and exceeds it by less than
+        //:   '1 / SUB_BUCKET_COUNT' of it.
+        //:
+        //: 5 Values that saturate the highest bucket are reported as the
+        //:   exact maximum.
+        //:
+        //: 6 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, record sequences of values and
+        //:   verify the result of 'valueAtPercentile' for several
+        //:   percentiles against hand-computed expected values.  (C-1..3, 5)
+        //:
+        //: 2 Record large pseudo-random samples, drawn from distributions of
+        //:   differing scales, sort a copy of each sample, and compare the
+        //:   result of 'valueAtPercentile' for many percentiles with the
+        //:   exact percentile taken from the sorted sample.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for percentiles outside '[0 .. 100]'.  (C-6)
+        //
+        // Testing:
+        //   Int64 valueAtPercentile(double percentile) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'valueAtPercentile'"
+                            "\n===================\n");
+
+        if (verbose) printf("\nTable-driven test.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;        // values to record, as '*'-
+                                           // separated decimal numbers
+                double      d_percentile;
+                Int64       d_expected;
+            } DATA[] = {
+                //LINE  SPEC                     PERCENTILE  EXPECTED
+                //----  ----------------------   ----------  --------
+                { L_,   "",                           0.0,          0 },
+                { L_,   "",                          50.0,          0 },
+                { L_,   "",                         100.0,          0 },
+
+                { L_,   "7",                          0.0,          7 },
+                { L_,   "7",                         50.0,          7 },
+                { L_,   "7",                        100.0,          7 },
+
+                { L_,   "1*2*3*4",                    0.0,          1 },
+                { L_,   "1*2*3*4",                   25.0,          1 },
+                { L_,   "1*2*3*4",                   25.1,          1 },
+                { L_,   "1*2*3*4",                   37.6,          2 },
+                { L_,   "1*2*3*4",                   50.0,          2 },
+                { L_,   "1*2*3*4",                   75.0,          3 },
+                { L_,   "1*2*3*4",                   99.9,          4 },
+                { L_,   "1*2*3*4",                  100.0,          4 },
+
+                // Buckets of width 2 start at 64; 100 is in '[100 .. 101]'.
+
+                { L_,   "100*100*100*500",           50.0,        101 },
+                { L_,   "100*101*102*103",           25.0,        101 },
+                { L_,   "100*101*102*103",           50.0,        101 },
+                { L_,   "100*101*102*103",           75.0,        103 },
+
+                // 1000 is in the bucket '[992 .. 1007]'.
+
+                { L_,   "1000*2000",                  0.0,       1000 },
+                { L_,   "1000*2000",                 50.0,       1007 },
+                { L_,   "1000*2000",                100.0,       2000 },
+                { L_,   "1000*1001*1002",            50.0,       1002 },
+
+                // Negative values are recorded as 0.
+
+                { L_,   "-5*10",                     50.0,          0 },
+
+                // Values beyond the limit are reported exactly at the top.
+
+                { L_,   "1*100000000000",            50.0,          1 },
+                { L_,   "1*100000000000",            99.0, 100000000000LL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE       = DATA[ti].d_line;
+                const char  *SPEC       = DATA[ti].d_spec;
+                const double PERCENTILE = DATA[ti].d_percentile;
+                const Int64  EXPECTED   = DATA[ti].d_expected;
+
+                Obj mX;  const Obj& X = mX;
+
+                const char *p = SPEC;
+                while (*p) {
+                    char *end;
+                    mX.record(strtoll(p, &end, 10));
+                    p = '*' == *end ? end + 1 : end;
+                }
+
+                const Int64 result = X.valueAtPercentile(PERCENTILE);
+
+                if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(result) }
+
+                ASSERTV(LINE, EXPECTED, result, EXPECTED == result);
+            }
+        }
+
+        if (verbose) printf("\nRandom samples.\n");
+        {
+            enum { NUM_SAMPLES = 10000 };
+
+            static Int64 values[NUM_SAMPLES];
+
+            const unsigned int SCALES[] = { 1, 50, 1000, 1000000, 100000000 };
+            const int NUM_SCALES = sizeof SCALES / sizeof *SCALES;
+
+            unsigned int seed = 12345;
+
+            for (int si = 0; si < NUM_SCALES; ++si) {
+                const unsigned int SCALE = SCALES[si];
+
+                Obj mX;  const Obj& X = mX;
+
+                for (int i = 0; i < NUM_SAMPLES; ++i) {
+
+                    // Use the product of two uniform values for a skewed,
+                    // long-tailed distribution.
+
+                    const Int64 value = static_cast<Int64>(
+                                                nextRandom(&seed) % 1000)
+                                      * (nextRandom(&seed) % SCALE + 1);
+                    values[i] = value;
+                    mX.record(value);
+                }
+                qsort(values, NUM_SAMPLES, sizeof *values, &compareInt64);
+
+                ASSERTV(SCALE, values[0] == X.min());
+                ASSERTV(SCALE, values[NUM_SAMPLES - 1] == X.max());
+
+                for (int pi = 0; pi <= 1000; ++pi) {
+                    const double PERCENTILE = pi / 10.0;
+
+                    int rank = (pi * NUM_SAMPLES + 500) / 1000;
+                    if (rank < 1) {
+                        rank = 1;
+                    }
+                    const Int64 exact  = 0 == pi ? values[0]
+                                                 : values[rank - 1];
+                    const Int64 result = X.valueAtPercentile(PERCENTILE);
+
+                    ASSERTV(SCALE, PERCENTILE, exact, result,
+                            exact <= result);
+                    ASSERTV(SCALE, PERCENTILE, exact, result,
+                            result - exact <= exact / Obj::SUB_BUCKET_COUNT);
+                }
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = mX;
+            mX.record(1);
+
+            ASSERT_SAFE_FAIL(X.valueAtPercentile( -0.1));
+            ASSERT_SAFE_PASS(X.valueAtPercentile(  0.0));
+            ASSERT_SAFE_PASS(X.valueAtPercentile(100.0));
+            ASSERT_SAFE_FAIL(X.valueAtPercentile(100.1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'add'
+        //
+        // Concerns:
+        //: 1 After 'add', the histogram is identical to one in which the
+        //:   values of both histograms had been recorded.
+        //:
+        //: 2 Adding an empty histogram, or adding to an empty histogram, does
+        //:   not disturb the minimum and maximum.
+        //:
+        //: 3 The added histogram is not modified.
+        //
+        // Plan:
+        //: 1 Record disjoint portions of a sequence of values into two
+        //:   histograms, and the whole sequence into a third.  Add one of the
+        //:   partial histograms to the other, and compare all accessors with
+        //:   those of the third.  Repeat for every split point, including
+        //:   the split points leaving one histogram empty.  (C-1..3)
+        //
+        // Testing:
+        //   void add(const LatencyHistogram& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'add'"
+                            "\n=====\n");
+
+        const Int64 VALUES[] = { 17, 3, 100000, 64, 5000000, 0, 250, 3, 99 };
+        const int   NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int split = 0; split <= NUM_VALUES; ++split) {
+            Obj mA;  const Obj& A = mA;
+            Obj mB;  const Obj& B = mB;
+            Obj mW;  const Obj& W = mW;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                (i < split ? mA : mB).record(VALUES[i]);
+                mW.record(VALUES[i]);
+            }
+
+            const Int64 B_COUNT = B.count();
+            mA.add(B);
+
+            ASSERTV(split, B_COUNT == B.count());
+            ASSERTV(split, W.count() == A.count());
+            ASSERTV(split, W.sum()   == A.sum());
+            ASSERTV(split, W.min()   == A.min());
+            ASSERTV(split, W.max()   == A.max());
+            for (int i = 0; i < Obj::NUM_BUCKETS; ++i) {
+                ASSERTV(split, i, W.bucketCount(i) == A.bucketCount(i));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'record', 'reset', COPYING, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed histogram is empty: 'count', 'sum', 'min',
+        //:   'max', and 'mean' are 0, as is every bucket count.
+        //:
+        //: 2 'record' increments the count of exactly the bucket identified
+        //:   by 'bucketIndex', and maintains the exact count, sum, minimum,
+        //:   and maximum.
+        //:
+        //: 3 Negative values are recorded as 0.
+        //:
+        //: 4 Values beyond the distinguished range are counted in the
+        //:   highest bucket, but are reflected exactly in 'max' and 'sum'.
+        //:
+        //: 5 'reset' returns the histogram to the empty state.
+        //:
+        //: 6 A copy is an independent snapshot.
+        //
+        // Plan:
+        //: 1 Record a sequence of values, checking every accessor against
+        //:   independently maintained expected values after each.  (C-1..4)
+        //:
+        //: 2 Copy-construct and assign copies, then modify the original and
+        //:   verify that the copies are unchanged.  (C-6)
+        //:
+        //: 3 Reset the histogram and verify that it is empty.  (C-5)
+        //
+        // Testing:
+        //   LatencyHistogram();
+        //   LatencyHistogram(const LatencyHistogram& original);
+        //   ~LatencyHistogram();
+        //   LatencyHistogram& operator=(const LatencyHistogram& rhs);
+        //   void record(Int64 value);
+        //   void reset();
+        //   Int64 bucketCount(int index) const;
+        //   Int64 count() const;
+        //   Int64 max() const;
+        //   double mean() const;
+        //   Int64 min() const;
+        //   Int64 sum() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\n'record', 'reset', COPYING, AND BASIC ACCESSORS"
+                        "\n===============================================\n");
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0   == X.count());
+        ASSERT(0   == X.sum());
+        ASSERT(0   == X.min());
+        ASSERT(0   == X.max());
+        ASSERT(0.0 == X.mean());
+        for (int i = 0; i < Obj::NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == X.bucketCount(i));
+        }
+
+        const Int64 VALUES[] = {
+            500, 3, 3, 70000, 0, 63, 64, 65, -20, LIMIT - 1, LIMIT,
+            LIMIT * 4, 1000
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        Int64 expCount = 0, expSum = 0, expMin = 0, expMax = 0;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Int64 VALUE    = VALUES[i];
+            const Int64 RECORDED = VALUE < 0 ? 0 : VALUE;
+            const int   INDEX    = Obj::bucketIndex(RECORDED);
+
+            const Int64 bucketBefore = X.bucketCount(INDEX);
+
+            mX.record(VALUE);
+
+            expMin = 0 == expCount || RECORDED < expMin ? RECORDED : expMin;
+            expMax = 0 == expCount || RECORDED > expMax ? RECORDED : expMax;
+            ++expCount;
+            expSum += RECORDED;
+
+            if (veryVerbose) { T_ P_(VALUE) P(INDEX) }
+
+            ASSERTV(VALUE, bucketBefore + 1 == X.bucketCount(INDEX));
+            ASSERTV(VALUE, expCount == X.count());
+            ASSERTV(VALUE, expSum   == X.sum());
+            ASSERTV(VALUE, expMin   == X.min());
+            ASSERTV(VALUE, expMax   == X.max());
+            ASSERTV(VALUE, (double) expSum / (double) expCount == X.mean());
+        }
+        ASSERT(3 == X.bucketCount(Obj::NUM_BUCKETS - 1));
+
+        Int64 total = 0;
+        for (int i = 0; i < Obj::NUM_BUCKETS; ++i) {
+            total += X.bucketCount(i);
+        }
+        ASSERT(total == X.count());
+
+        if (verbose) printf("\nCopying.\n");
+        {
+            const Obj Y(X);
+            Obj mZ;  const Obj& Z = mZ;
+            mZ.record(1);
+            mZ = X;
+
+            mX.record(12345);
+
+            ASSERT(expCount == Y.count());
+            ASSERT(expCount == Z.count());
+            ASSERT(expSum   == Y.sum());
+            ASSERT(expSum   == Z.sum());
+            ASSERT(0 == Y.bucketCount(Obj::bucketIndex(12345)));
+            ASSERT(0 == Z.bucketCount(Obj::bucketIndex(12345)));
+            ASSERT(expCount + 1 == X.count());
+        }
+
+        if (verbose) printf("\n'reset'.\n");
+        {
+            mX.reset();
+
+            ASSERT(0   == X.count());
+            ASSERT(0   == X.sum());
+            ASSERT(0   == X.min());
+            ASSERT(0   == X.max());
+            ASSERT(0.0 == X.mean());
+            for (int i = 0; i < Obj::NUM_BUCKETS; ++i) {
+                ASSERTV(i, 0 == X.bucketCount(i));
+            }
+
+            mX.record(42);
+            ASSERT(42 == X.min());
+            ASSERT(42 == X.max());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_FAIL(X.bucketCount(-1));
+            ASSERT_SAFE_PASS(X.bucketCount(0));
+            ASSERT_SAFE_PASS(X.bucketCount(Obj::NUM_BUCKETS - 1));
+            ASSERT_SAFE_FAIL(X.bucketCount(Obj::NUM_BUCKETS));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUCKET MAPPING
+        //
+        // Concerns:
+        //: 1 The buckets partition '[0 .. 2^MAX_VALUE_BITS)' into contiguous,
+        //:   non-overlapping, increasing ranges.
+        //:
+        //: 2 'bucketIndex' maps every value within a bucket's bounds, and no
+        //:   other value, to that bucket.
+        //:
+        //: 3 Values less than '2 * SUB_BUCKET_COUNT' have buckets of their
+        //:   own, and the width of every other bucket is less than
+        //:   '1 / SUB_BUCKET_COUNT' of its lower bound.
+        //:
+        //: 4 Negative values map to bucket 0, and values of at least
+        //:   '2^MAX_VALUE_BITS' to the highest bucket.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every bucket, verify the relationship of its bounds to those
+        //:   of its neighbors, its width, and that 'bucketIndex' maps its
+        //:   bounds (and, for wide buckets, its midpoint) to it.  (C-1..3)
+        //:
+        //: 2 Verify 'bucketIndex' for negative and very large values.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid bucket indices.  (C-5)
+        //
+        // Testing:
+        //   static int bucketIndex(Int64 value);
+        //   static Int64 bucketLowerBound(int index);
+        //   static Int64 bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBUCKET MAPPING"
+                            "\n==============\n");
+
+        ASSERT(0         == Obj::bucketLowerBound(0));
+        ASSERT(LIMIT - 1 == Obj::bucketUpperBound(Obj::NUM_BUCKETS - 1));
+
+        for (int i = 0; i < Obj::NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Obj::bucketLowerBound(i);
+            const Int64 UPPER = Obj::bucketUpperBound(i);
+
+            if (veryVerbose) { T_ P_(i) P_(LOWER) P(UPPER) }
+
+            ASSERTV(i, LOWER <= UPPER);
+            if (i > 0) {
+                ASSERTV(i, Obj::bucketUpperBound(i - 1) + 1 == LOWER);
+            }
+            if (i < 2 * Obj::SUB_BUCKET_COUNT) {
+                ASSERTV(i, i == LOWER);
+                ASSERTV(i, i == UPPER);
+            }
+            else {
+                ASSERTV(i, UPPER - LOWER < LOWER / Obj::SUB_BUCKET_COUNT);
+            }
+
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+            ASSERTV(i, i == Obj::bucketIndex(UPPER));
+            ASSERTV(i, i == Obj::bucketIndex(LOWER + (UPPER - LOWER) / 2));
+        }
+
+        ASSERT(0 == Obj::bucketIndex(-1));
+        ASSERT(0 == Obj::bucketIndex(-LIMIT));
+        ASSERT(0 == Obj::bucketIndex(
+                     static_cast<Int64>(static_cast<bsls::Types::Uint64>(1)
+                                                                      << 63)));
+        ASSERT(Obj::NUM_BUCKETS - 1 == Obj::bucketIndex(LIMIT));
+        ASSERT(Obj::NUM_BUCKETS - 1 == Obj::bucketIndex(LIMIT * 1000));
+        ASSERT(Obj::NUM_BUCKETS - 1 == Obj::bucketIndex(
+                    static_cast<Int64>(~static_cast<bsls::Types::Uint64>(0)
+                                                                       >> 1)));
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_FAIL(Obj::bucketLowerBound(-1));
+            ASSERT_SAFE_PASS(Obj::bucketLowerBound(0));
+            ASSERT_SAFE_PASS(Obj::bucketLowerBound(Obj::NUM_BUCKETS - 1));
+            ASSERT_SAFE_FAIL(Obj::bucketLowerBound(Obj::NUM_BUCKETS));
+
+            ASSERT_SAFE_FAIL(Obj::bucketUpperBound(-1));
+            ASSERT_SAFE_PASS(Obj::bucketUpperBound(0));
+            ASSERT_SAFE_PASS(Obj::bucketUpperBound(Obj::NUM_BUCKETS - 1));
+            ASSERT_SAFE_FAIL(Obj::bucketUpperBound(Obj::NUM_BUCKETS));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record a few values, and query the histogram.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.count());
+
+        mX.record(10);
+        mX.record(20);
+        mX.record(30);
+
+        ASSERT(3    == X.count());
+        ASSERT(10   == X.min());
+        ASSERT(30   == X.max());
+        ASSERT(60   == X.sum());
+        ASSERT(20.0 == X.mean());
+        ASSERT(20   == X.valueAtPercentile(50.0));
+
+        Obj mY(X);
+        mY.add(X);
+        ASSERT(6 == mY.count());
+
+        mX.reset();
+        ASSERT(0 == X.count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RECORDING COST
+        //
+        // Concerns:
+        //: 1 Recording a value costs a few nanoseconds.
+        //
+        // Plan:
+        //: 1 Record a large number of values, drawn from a precomputed table
+        //:   of values spread over many powers of two (so that bucket
+        //:   selection is not trivially predictable), and report the average
+        //:   cost per value, less the cost of the loop that reads the table.
+        //:
+        //: 2 Report the average cost of an empty scope timed by a
+        //:   'LatencyHistogramTimer', which includes two reads of the raw
+        //:   timer.  The number of iterations (in millions) may be given as
+        //:   the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: cost of 'record' and of a timed scope
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: RECORDING COST"
+                            "\n===========================\n");
+
+        TU::initialize();
+
+        const int MILLIONS   = verbose ? atoi(argv[2]) : 10;
+        const int ITERATIONS = 1000000 * (MILLIONS > 0 ? MILLIONS : 1);
+
+        enum { TABLE_SIZE = 4096 };  // a power of two
+        static Int64 table[TABLE_SIZE];
+
+        unsigned int seed = 1;
+        for (int i = 0; i < TABLE_SIZE; ++i) {
+            const unsigned int r = nextRandom(&seed);
+            table[i] = static_cast<Int64>(r & 1023) << (r >> 10) % 24;
+        }
+
+        Obj mX;  const Obj& X = mX;
+
+        volatile Int64 sink = 0;
+
+        Int64 start = TU::getTimer();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            sink = table[i & (TABLE_SIZE - 1)];
+        }
+        const Int64 loopTime = TU::getTimer() - start;
+
+        if (veryVerbose) { T_ P(sink) }
+
+        start = TU::getTimer();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            mX.record(table[i & (TABLE_SIZE - 1)]);
+        }
+        const Int64 recordTime = TU::getTimer() - start;
+
+        printf("record:       %6.2f nsec/value (loop overhead %.2f)\n",
+               (double) (recordTime - loopTime) / ITERATIONS,
+               (double) loopTime / ITERATIONS);
+        printf("p50 = %lld, p99 = %lld, p99.9 = %lld\n",
+               X.valueAtPercentile(50.0),
+               X.valueAtPercentile(99.0),
+               X.valueAtPercentile(99.9));
+
+        Obj mY;
+        start = TU::getTimer();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Timer timer(&mY);
+        }
+        const Int64 timerTime = TU::getTimer() - start;
+
+        printf("timed scope:  %6.2f nsec/scope (recorded p50 = %lld)\n",
+               (double) timerTime / ITERATIONS,
+               mY.valueAtPercentile(50.0));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
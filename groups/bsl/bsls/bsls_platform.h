@@ -139,6 +139,16 @@ BSLS_IDENT("$Id: $")
 //  #endif
 //  }
 //..
+// Finally, the size (in bytes) of a cache line on the target processor is
+// provided as a compile-time constant:
+//..
+//  BSLS_PLATFORM_CACHE_LINE_SIZE
+//..
+// This value is intended for laying out data that is modified concurrently by
+// multiple threads such that independently-modified objects do not share a
+// cache line (i.e., to avoid "false sharing"); see 'bsls_shardedcounter'.
+// Note that the value is a conservative compile-time estimate for the
+// processor family, and is not queried from the hardware.
 
 #ifdef __cplusplus
 namespace BloombergLP {
@@ -787,6 +797,12 @@ struct bsls_Platform_Assert;
 #if defined(BSLS_PLATFORM_CMP_IBM) && !defined(BSLS_PLATFORM_CPU_64_BIT)
     #define BSLS_PLATFORM_NO_64_BIT_LITERALS 1
 #endif
+
+#if defined(BSLS_PLATFORM_CPU_POWERPC) || defined(BSLS_PLATFORM_CPU_IA64)
+    #define BSLS_PLATFORM_CACHE_LINE_SIZE 128
+#else
+    #define BSLS_PLATFORM_CACHE_LINE_SIZE 64
+#endif
 // ----------------------------------------------------------------------------
 
                                  // Validation
@@ -103,6 +103,7 @@ bool isLittleEndian()
 // [ 2] BSLS_PLATFORM_IS_LITTLE_ENDIAN
 // [ 2] BSLS_PLATFORM_IS_BIG_ENDIAN
 // [ 3] BSLS_PLATFORM_NO_64_BIT_LITERALS
+// [ 5] BSLS_PLATFORM_CACHE_LINE_SIZE
 // ============================================================================
 
 int main(int argc, char *argv[])
@@ -117,6 +118,46 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING CACHE LINE SIZE
+        //
+        // Concerns:
+        //: 1 'BSLS_PLATFORM_CACHE_LINE_SIZE' is usable in a preprocessor
+        //:   expression and as an integral constant expression.
+        //:
+        //: 2 The value is a power of two that is large enough to hold any
+        //:   fundamental type.
+        //
+        // Plan:
+        //: 1 Use the macro in an '#if' and as an array bound.  (C-1)
+        //:
+        //: 2 Verify that the value is a power of two that is not less than
+        //:   the size of 'long double' or of a pointer.  (C-2)
+        //
+        // Testing:
+        //   BSLS_PLATFORM_CACHE_LINE_SIZE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Testing Cache Line Size" << endl
+                          << "=======================" << endl;
+
+#if BSLS_PLATFORM_CACHE_LINE_SIZE < 32
+        ASSERT(!"Cache line size is implausibly small.");
+#endif
+
+        char buffer[BSLS_PLATFORM_CACHE_LINE_SIZE];
+        (void) buffer;
+
+        const int LINE = BSLS_PLATFORM_CACHE_LINE_SIZE;
+
+        if (veryVerbose) cout << "Cache line size: " << LINE << endl;
+
+        ASSERT(0 == (LINE & (LINE - 1)));
+        ASSERT(sizeof(long double) <= static_cast<unsigned>(LINE));
+        ASSERT(sizeof(void *)      <= static_cast<unsigned>(LINE));
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // DUMPING VALUES OF OLD '__' LITERALS
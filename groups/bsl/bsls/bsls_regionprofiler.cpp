@@ -0,0 +1,298 @@
+// bsls_regionprofiler.cpp                                            -*-C++-*-
+#include <bsls_regionprofiler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+
+#include <string.h>              // 'strcmp'
+
+namespace BloombergLP {
+
+namespace {
+
+                             // ================
+                             // class LineWriter
+                             // ================
+
+class LineWriter {
+    // This class appends characters to a fixed-length buffer, counting (but
+    // discarding) those that do not fit, with the semantics of 'snprintf'.
+
+    // DATA
+    char *d_buffer_p;  // output buffer
+    int   d_length;    // length of the output buffer
+    int   d_position;  // length of the complete output so far
+
+  public:
+    // CREATORS
+    LineWriter(char *buffer, int length)
+    : d_buffer_p(buffer)
+    , d_length(length)
+    , d_position(0)
+        // Create a writer to the specified 'buffer' of the specified
+        // 'length'.
+    {
+    }
+
+    // MANIPULATORS
+    void append(char character)
+        // Append the specified 'character' to the output.
+    {
+        if (d_position < d_length - 1) {
+            d_buffer_p[d_position] = character;
+        }
+        ++d_position;
+    }
+
+    void append(const char *string)
+        // Append the specified null-terminated 'string' to the output.
+    {
+        for (; *string; ++string) {
+            append(*string);
+        }
+    }
+
+    void append(bsls::Types::Int64 value)
+        // Append the decimal representation of the specified non-negative
+        // 'value' to the output.
+    {
+        char digits[20];
+        int  numDigits = 0;
+        do {
+            digits[numDigits++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value);
+
+        while (numDigits) {
+            append(digits[--numDigits]);
+        }
+    }
+
+    int finish()
+        // Null-terminate the output, and return the length of the complete
+        // output.
+    {
+        if (d_length > 0) {
+            d_buffer_p[d_position < d_length ? d_position : d_length - 1] =
+                                                                          '\0';
+        }
+        return d_position;
+    }
+};
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                            // --------------------
+                            // class RegionProfiler
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+int RegionProfiler::findOrAddRegion(int parent, const char *name)
+{
+    int child = d_regions[parent].d_firstChild;
+    int last  = -1;
+
+    // Names are usually string literals, so compare by address first.
+
+    for (; 0 <= child; last = child, child = d_regions[child].d_nextSibling) {
+        const char *childName = d_regions[child].d_name_p;
+        if (childName == name || 0 == strcmp(childName, name)) {
+            return child;                                             // RETURN
+        }
+    }
+
+    if (MAX_REGIONS == d_numRegions) {
+        return -1;                                                    // RETURN
+    }
+
+    const int index  = d_numRegions++;
+    Region&   region = d_regions[index];
+    region.d_name_p      = name;
+    region.d_parent      = parent;
+    region.d_firstChild  = -1;
+    region.d_nextSibling = -1;
+    region.d_count       = 0;
+    region.d_wallTime    = 0;
+    region.d_cpuTime     = 0;
+
+    // Append the new node, so that siblings are kept in order of creation.
+
+    if (last < 0) {
+        d_regions[parent].d_firstChild = index;
+    }
+    else {
+        d_regions[last].d_nextSibling = index;
+    }
+    return index;
+}
+
+// CREATORS
+RegionProfiler::RegionProfiler(bool collectThreadCpuTime)
+: d_depth(0)
+, d_numIgnoredFrames(0)
+, d_collectCpuTime(collectThreadCpuTime)
+{
+    reset();
+}
+
+// MANIPULATORS
+void RegionProfiler::add(const RegionProfiler& other)
+{
+    // Every node has a lower index than its children, so a single pass in
+    // index order visits each parent before its children.
+
+    int       map[MAX_REGIONS];  // index in this profiler of each node of
+                                 // 'other', or -1 if it could not be added
+    const int numRegions = other.d_numRegions;
+
+    map[0] = 0;
+    for (int i = 1; i < numRegions; ++i) {
+        const Region& region = other.d_regions[i];
+        const int     parent = map[region.d_parent];
+
+        map[i] = parent < 0 ? -1 : findOrAddRegion(parent, region.d_name_p);
+        if (map[i] < 0) {
+            d_numDropped += region.d_count;
+            continue;
+        }
+
+        Region& target = d_regions[map[i]];
+        target.d_count    += region.d_count;
+        target.d_wallTime += region.d_wallTime;
+        target.d_cpuTime  += region.d_cpuTime;
+    }
+
+    d_numDropped += other.d_numDropped;
+}
+
+void RegionProfiler::reset()
+{
+    BSLS_ASSERT_SAFE(0 == d_depth);
+    BSLS_ASSERT_SAFE(0 == d_numIgnoredFrames);
+
+    Region& root = d_regions[0];
+    root.d_name_p      = "";
+    root.d_parent      = -1;
+    root.d_firstChild  = -1;
+    root.d_nextSibling = -1;
+    root.d_count       = 0;
+    root.d_wallTime    = 0;
+    root.d_cpuTime     = 0;
+
+    d_numRegions = 1;
+    d_numDropped = 0;
+}
+
+// ACCESSORS
+int RegionProfiler::findRegion(int parent, const char *name) const
+{
+    BSLS_ASSERT_SAFE(0 <= parent);
+    BSLS_ASSERT_SAFE(parent < d_numRegions);
+    BSLS_ASSERT_SAFE(name);
+
+    for (int child = d_regions[parent].d_firstChild;
+         0 <= child;
+         child = d_regions[child].d_nextSibling) {
+        const char *childName = d_regions[child].d_name_p;
+        if (childName == name || 0 == strcmp(childName, name)) {
+            return child;                                             // RETURN
+        }
+    }
+    return -1;
+}
+
+int RegionProfiler::printCollapsedStacks(char   *buffer,
+                                         int     length,
+                                         Metric  metric) const
+{
+    BSLS_ASSERT_SAFE(0 <= length);
+    BSLS_ASSERT_SAFE(buffer || 0 == length);
+
+    // Compute the self value of each node by subtracting the (inclusive)
+    // value of each node from that of its parent.  Every node has a lower
+    // index than its children, so the value of a node is still inclusive when
+    // it is subtracted from that of its parent in a pass in index order.
+
+    Types::Int64 values[MAX_REGIONS];
+    for (int i = 0; i < d_numRegions; ++i) {
+        const Region& region = d_regions[i];
+        switch (metric) {
+          case BSLS_WALL_TIME: {
+            values[i] = region.d_wallTime;
+          } break;
+          case BSLS_THREAD_CPU_TIME: {
+            values[i] = region.d_cpuTime;
+          } break;
+          default: {
+            values[i] = region.d_count;
+          } break;
+        }
+    }
+    if (BSLS_CALL_COUNT != metric) {
+        for (int i = 1; i < d_numRegions; ++i) {
+            values[d_regions[i].d_parent] -= values[i];
+        }
+    }
+
+    LineWriter writer(buffer, length);
+
+    for (int i = 1; i < d_numRegions; ++i) {
+        Types::Int64 value = values[i];
+        if (BSLS_CALL_COUNT != metric) {
+            value = (value + 500) / 1000;  // nanoseconds to microseconds
+        }
+        if (value <= 0) {
+            continue;
+        }
+
+        int path[MAX_DEPTH];
+        int depth = 0;
+        for (int node = i; 0 < node; node = d_regions[node].d_parent) {
+            BSLS_ASSERT_SAFE(depth < MAX_DEPTH);
+            path[depth++] = node;
+        }
+
+        writer.append(d_regions[path[--depth]].d_name_p);
+        while (depth) {
+            writer.append(';');
+            writer.append(d_regions[path[--depth]].d_name_p);
+        }
+        writer.append(' ');
+        writer.append(value);
+        writer.append('\n');
+    }
+
+    return writer.finish();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,555 @@
+// bsls_regionprofiler.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLS_REGIONPROFILER
+#define INCLUDED_BSLS_REGIONPROFILER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a per-thread profiler of nested, named code regions.
+//
+//@CLASSES:
+//  bsls::RegionProfiler: aggregates wall and CPU time of nested named regions
+//  bsls::RegionProfilerGuard: scoped guard entering and leaving a region
+//
+//@SEE_ALSO: bsls_stopwatch, bsls_timeutil
+//
+//@DESCRIPTION: This component provides a class, 'bsls::RegionProfiler', that
+// aggregates the time spent in nested, named regions of code executed by a
+// single thread, and a guard, 'bsls::RegionProfilerGuard', that enters a
+// region upon construction and leaves it upon destruction.  A region profiler
+// is, in effect, a tree of stopwatches: each distinct *path* of region names
+// (e.g., "main", "main;parse", "main;parse;lex") is a node of the tree, and
+// each node accumulates the number of times the path was entered, the wall
+// time spent on the path, and, optionally, the CPU time consumed by the
+// thread on the path (see 'bsls::TimeUtil::getThreadCpuTimer').
+//
+// The aggregated tree can be inspected through the accessors of the profiler,
+// or written out in the "collapsed stack" format (one line per path, with the
+// names separated by ';', followed by a space and a value) that is consumed by
+// flame-graph tools such as 'flamegraph.pl' and 'speedscope'.  Thus a program
+// can be profiled in production, for the regions it chooses to instrument,
+// without an external sampling profiler.
+//
+///Region Names
+///------------
+// Region names are not copied: a profiler retains the address of the name
+// supplied the first time a path is entered, and so names must remain valid
+// for the lifetime of the profiler (string literals are ideal).  Names are
+// compared first by address and then, only if the addresses differ, by
+// content, so the same region name spelled at different call sites denotes
+// the same region.  Names must not contain ';', which is the separator of the
+// collapsed-stack format.
+//
+///Capacity
+///--------
+// A 'bsls::RegionProfiler' never allocates memory: it stores at most
+// 'MAX_REGIONS' distinct paths (including the root, which represents the
+// thread outside of any region), and tracks nesting to a depth of at most
+// 'MAX_DEPTH' regions.  A region that is entered when either limit has been
+// reached is not recorded -- nor is any region nested within it -- and is
+// instead counted by 'numDroppedRegions', so that a truncated profile can be
+// recognized as such.
+//
+///Overhead
+///--------
+// Entering and leaving a region reads the 'bsls::TimeUtil' raw wall timer
+// once each, and, if thread CPU time is collected, also the thread CPU timer
+// once each.  The wall timer is inexpensive on most platforms, but the thread
+// CPU timer usually requires a system call (or a virtual system call), so
+// collecting thread CPU time is optional, and disabled by default.  Finding
+// the node of a path that has been entered before requires a scan of the
+// children of the enclosing region, which is short for typical programs.  The
+// overhead of the profiler itself is included in the times it reports, which
+// should be kept in mind when profiling very short regions.
+//
+///Thread Safety
+///-------------
+// 'bsls::RegionProfiler' is *not* thread-safe, and each thread should profile
+// into a profiler of its own (which is also necessary for the thread CPU
+// times to be meaningful).  Profilers of different threads can be combined
+// with 'add' (under whatever synchronization the program uses to hand data
+// between threads) for reporting.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling Nested Regions
+///- - - - - - - - - - - - - - - - - -
+// Suppose that a request handler parses a request and then executes it, and
+// that we want to know how the time spent by the handler is divided among
+// these steps.  First, we instrument the functions performing the steps with
+// 'bsls::RegionProfilerGuard' objects:
+//..
+//  void parseRequest(bsls::RegionProfiler *profiler)
+//      // Parse a request, profiling into the specified 'profiler'.
+//  {
+//      bsls::RegionProfilerGuard guard(profiler, "parse");
+//
+//      // ... (parse the request)
+//  }
+//
+//  void executeRequest(bsls::RegionProfiler *profiler)
+//      // Execute a request, profiling into the specified 'profiler'.
+//  {
+//      bsls::RegionProfilerGuard guard(profiler, "execute");
+//
+//      // ... (execute the request)
+//  }
+//
+//  void handleRequest(bsls::RegionProfiler *profiler)
+//      // Handle a request, profiling into the specified 'profiler'.
+//  {
+//      bsls::RegionProfilerGuard guard(profiler, "handle");
+//
+//      parseRequest(profiler);
+//      executeRequest(profiler);
+//  }
+//..
+// Then, we handle a few requests, collecting thread CPU time as well as wall
+// time:
+//..
+//  bsls::RegionProfiler profiler(true);
+//
+//  for (int i = 0; i < 10; ++i) {
+//      handleRequest(&profiler);
+//  }
+//..
+// Next, we observe that the profiler has recorded one node for each distinct
+// path (plus the root), and we look up the node of the "handle;parse" path:
+//..
+//  assert(4 == profiler.numRegions());
+//
+//  const int handle = profiler.findRegion(0, "handle");
+//  assert(0 < handle);
+//
+//  const int parse = profiler.findRegion(handle, "parse");
+//  assert(0 < parse);
+//  assert(handle == profiler.regionParent(parse));
+//  assert(10     == profiler.regionCount(parse));
+//  assert(profiler.regionWallTime(parse) <= profiler.regionWallTime(handle));
+//..
+// Finally, we write the profile in collapsed-stack format, in which the value
+// of each path is its *self* (or exclusive) time in microseconds, i.e., the
+// time spent on the path less the time spent in its nested regions, and paths
+// having a value of 0 are omitted.  'printCollapsedStacks' returns the length
+// of the complete output, which may be used to size the buffer:
+//..
+//  const bsls::RegionProfiler::Metric metric =
+//                                       bsls::RegionProfiler::BSLS_CALL_COUNT;
+//
+//  char      buffer[1024];
+//  const int length = profiler.printCollapsedStacks(buffer,
+//                                                   sizeof buffer,
+//                                                   metric);
+//  assert(length < static_cast<int>(sizeof buffer));
+//  assert(0 == strcmp(buffer, "handle 10\n"
+//                             "handle;parse 10\n"
+//                             "handle;execute 10\n"));
+//..
+// A file of such lines, typically using the 'BSLS_WALL_TIME' or
+// 'BSLS_THREAD_CPU_TIME' metric, can be passed directly to 'flamegraph.pl'.
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                            // ====================
+                            // class RegionProfiler
+                            // ====================
+
+class RegionProfiler {
+    // This class aggregates the number of entries, wall time, and
+    // (optionally) thread CPU time of nested, named regions of code, keyed by
+    // the path of region names from the outermost region, in a fixed-size
+    // tree of nodes.  Node 0 is the root, representing the thread outside of
+    // any region, and every other node has a lower-numbered parent.  This
+    // class is not thread-safe.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        MAX_DEPTH   = 32,   // maximum nesting depth of recorded regions
+        MAX_REGIONS = 256   // maximum number of nodes, including the root
+    };
+
+    enum Metric {
+        // Enumerate the values that can be written by
+        // 'printCollapsedStacks'.
+
+        BSLS_WALL_TIME,        // self wall time, in microseconds
+        BSLS_THREAD_CPU_TIME,  // self thread CPU time, in microseconds
+        BSLS_CALL_COUNT        // number of times the path was entered
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Region {
+        // A node of the tree of paths.
+
+        const char   *d_name_p;       // name of the innermost region
+        int           d_parent;       // index of the parent, or -1 for root
+        int           d_firstChild;   // index of the first child, or -1
+        int           d_nextSibling;  // index of the next sibling, or -1
+        Types::Int64  d_count;        // number of completed entries
+        Types::Int64  d_wallTime;     // total wall time (nanoseconds)
+        Types::Int64  d_cpuTime;      // total thread CPU time (nanoseconds)
+    };
+
+    struct Frame {
+        // An active (entered but not yet left) region.
+
+        int                        d_region;     // index of the node
+        TimeUtil::OpaqueNativeTime d_startTime;  // raw wall time at entry
+        Types::Int64               d_startCpu;   // thread CPU time at entry
+    };
+
+    // DATA
+    Region       d_regions[MAX_REGIONS];  // tree of paths; 0 is the root
+    int          d_numRegions;            // number of nodes in use
+    Frame        d_frames[MAX_DEPTH];     // stack of active regions
+    int          d_depth;                 // number of recorded active
+                                          // regions
+    int          d_numIgnoredFrames;      // number of active regions, nested
+                                          // within the recorded ones, that
+                                          // are not being recorded
+    Types::Int64 d_numDropped;            // number of regions not recorded
+    bool         d_collectCpuTime;        // collect thread CPU time if 'true'
+
+    // PRIVATE MANIPULATORS
+    int findOrAddRegion(int parent, const char *name);
+        // Return the index of the child of the node having the specified
+        // 'parent' index that has the specified 'name', adding such a child
+        // if there is none, or -1 if there is no such child and the tree is
+        // full.
+
+  private:
+    // NOT IMPLEMENTED
+    RegionProfiler(const RegionProfiler&);
+    RegionProfiler& operator=(const RegionProfiler&);
+
+  public:
+    // CREATORS
+    explicit RegionProfiler(bool collectThreadCpuTime = false);
+        // Create an empty region profiler.  Optionally specify
+        // 'collectThreadCpuTime' to indicate whether the CPU time consumed by
+        // the calling thread in each region is collected in addition to wall
+        // time.  If 'collectThreadCpuTime' is not specified, only wall time
+        // is collected.
+
+    //! ~RegionProfiler() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void add(const RegionProfiler& other);
+        // Add the counts and times recorded in the specified 'other' profiler
+        // to this profiler, matching the nodes of the two profilers by path,
+        // and adding to this profiler any paths it lacks (as capacity
+        // permits; paths that do not fit are counted by
+        // 'numDroppedRegions').  Regions active in 'other' are ignored.
+
+    void enter(const char *name);
+        // Enter the region having the specified 'name', nested within the
+        // innermost active region, if any.  The behavior is undefined unless
+        // 'name' is a null-terminated string that does not contain ';' and
+        // that remains valid for the lifetime of this object (see {Region
+        // Names}), and unless each call to 'enter' is matched by a call to
+        // 'leave' from the same thread.
+
+    void leave();
+        // Leave the innermost active region, adding the time spent in it
+        // since the matching call to 'enter' to the node of its path.  The
+        // behavior is undefined unless there is an active region.
+
+    void reset();
+        // Discard all paths, counts, and times recorded by this profiler.
+        // The behavior is undefined unless there is no active region.
+
+    // ACCESSORS
+    int depth() const;
+        // Return the number of active regions, i.e., the number of calls to
+        // 'enter' that have not been matched by a call to 'leave'.
+
+    int findRegion(int parent, const char *name) const;
+        // Return the index of the child of the node having the specified
+        // 'parent' index that has the specified 'name', or -1 if there is no
+        // such node.  The behavior is undefined unless
+        // '0 <= parent < numRegions()'.
+
+    bool isCollectingThreadCpuTime() const;
+        // Return 'true' if this profiler collects thread CPU time, and
+        // 'false' otherwise.
+
+    Types::Int64 numDroppedRegions() const;
+        // Return the number of entries into regions that were not recorded
+        // because the capacity of this profiler was exceeded (see
+        // {Capacity}).
+
+    int numRegions() const;
+        // Return the number of nodes of this profiler, including the root.
+
+    int printCollapsedStacks(char   *buffer,
+                             int     length,
+                             Metric  metric) const;
+        // Write into the specified 'buffer' of the specified 'length' one
+        // line for each path recorded by this profiler, in the collapsed-
+        // stack format "name1;name2;...;nameN value\n", where 'value' is the
+        // self value (i.e., the value of the path less the values of its
+        // children) of the specified 'metric', omitting paths whose value is
+        // 0 or less, and null-terminate the output.  Return the length of
+        // the complete output (not including the null terminator); if this
+        // is not less than 'length', the output is truncated to
+        // 'length - 1' characters (and nothing is written if 'length' is 0).
+        // Paths are written in the order in which they were first entered.
+        // Note that, for the 'BSLS_CALL_COUNT' metric, the value of a path
+        // is its own count.  The behavior is undefined unless '0 <= length',
+        // and unless 'buffer' is not 0 or 'length' is 0.
+
+    const char *regionName(int index) const;
+        // Return the name of the innermost region of the path of the node
+        // having the specified 'index', or an empty string for the root.  The
+        // behavior is undefined unless '0 <= index < numRegions()'.
+
+    int regionParent(int index) const;
+        // Return the index of the parent of the node having the specified
+        // 'index', or -1 for the root.  The behavior is undefined unless
+        // '0 <= index < numRegions()'.
+
+    Types::Int64 regionCount(int index) const;
+        // Return the number of times the path of the node having the
+        // specified 'index' has been entered and left.  The behavior is
+        // undefined unless '0 <= index < numRegions()'.
+
+    Types::Int64 regionThreadCpuTime(int index) const;
+        // Return the total thread CPU time, in nanoseconds, spent on the path
+        // of the node having the specified 'index' (including the time spent
+        // in nested regions), or 0 if this profiler does not collect thread
+        // CPU time.  The behavior is undefined unless
+        // '0 <= index < numRegions()'.
+
+    Types::Int64 regionWallTime(int index) const;
+        // Return the total wall time, in nanoseconds, spent on the path of
+        // the node having the specified 'index' (including the time spent in
+        // nested regions).  The behavior is undefined unless
+        // '0 <= index < numRegions()'.
+};
+
+                         // =========================
+                         // class RegionProfilerGuard
+                         // =========================
+
+class RegionProfilerGuard {
+    // This class implements a guard that enters a named region of a
+    // 'RegionProfiler' upon construction, and leaves it upon destruction.
+
+    // DATA
+    RegionProfiler *d_profiler_p;  // profiler of the region (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RegionProfilerGuard(const RegionProfilerGuard&);
+    RegionProfilerGuard& operator=(const RegionProfilerGuard&);
+
+  public:
+    // CREATORS
+    RegionProfilerGuard(RegionProfiler *profiler, const char *name);
+        // Create a guard that enters the region having the specified 'name'
+        // of the specified 'profiler', and that leaves it upon destruction.
+        // The behavior is undefined unless 'profiler' is not 0, and 'name'
+        // satisfies the requirements of 'RegionProfiler::enter'.
+
+    ~RegionProfilerGuard();
+        // Destroy this object, leaving the region entered upon construction.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class RegionProfiler
+                            // --------------------
+
+// MANIPULATORS
+inline
+void RegionProfiler::enter(const char *name)
+{
+    BSLS_ASSERT_SAFE(name);
+
+    if (d_numIgnoredFrames || MAX_DEPTH == d_depth) {
+        ++d_numIgnoredFrames;
+        ++d_numDropped;
+        return;                                                       // RETURN
+    }
+
+    const int parent = d_depth ? d_frames[d_depth - 1].d_region : 0;
+    const int region = findOrAddRegion(parent, name);
+    if (region < 0) {
+        ++d_numIgnoredFrames;
+        ++d_numDropped;
+        return;                                                       // RETURN
+    }
+
+    Frame& frame = d_frames[d_depth++];
+    frame.d_region   = region;
+    frame.d_startCpu = d_collectCpuTime ? TimeUtil::getThreadCpuTimer() : 0;
+    TimeUtil::getTimerRaw(&frame.d_startTime);
+}
+
+inline
+void RegionProfiler::leave()
+{
+    BSLS_ASSERT_SAFE(0 < d_depth + d_numIgnoredFrames);
+
+    if (d_numIgnoredFrames) {
+        --d_numIgnoredFrames;
+        return;                                                       // RETURN
+    }
+
+    TimeUtil::OpaqueNativeTime now;
+    TimeUtil::getTimerRaw(&now);
+
+    const Frame&  frame  = d_frames[--d_depth];
+    Region&       region = d_regions[frame.d_region];
+
+    ++region.d_count;
+    region.d_wallTime += TimeUtil::convertRawTime(now)
+                       - TimeUtil::convertRawTime(frame.d_startTime);
+    if (d_collectCpuTime) {
+        region.d_cpuTime += TimeUtil::getThreadCpuTimer() - frame.d_startCpu;
+    }
+}
+
+// ACCESSORS
+inline
+int RegionProfiler::depth() const
+{
+    return d_depth + d_numIgnoredFrames;
+}
+
+inline
+bool RegionProfiler::isCollectingThreadCpuTime() const
+{
+    return d_collectCpuTime;
+}
+
+inline
+Types::Int64 RegionProfiler::numDroppedRegions() const
+{
+    return d_numDropped;
+}
+
+inline
+int RegionProfiler::numRegions() const
+{
+    return d_numRegions;
+}
+
+inline
+const char *RegionProfiler::regionName(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_numRegions);
+
+    return d_regions[index].d_name_p;
+}
+
+inline
+int RegionProfiler::regionParent(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_numRegions);
+
+    return d_regions[index].d_parent;
+}
+
+inline
+Types::Int64 RegionProfiler::regionCount(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_numRegions);
+
+    return d_regions[index].d_count;
+}
+
+inline
+Types::Int64 RegionProfiler::regionThreadCpuTime(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_numRegions);
+
+    return d_regions[index].d_cpuTime;
+}
+
+inline
+Types::Int64 RegionProfiler::regionWallTime(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_numRegions);
+
+    return d_regions[index].d_wallTime;
+}
+
+                         // -------------------------
+                         // class RegionProfilerGuard
+                         // -------------------------
+
+// CREATORS
+inline
+RegionProfilerGuard::RegionProfilerGuard(RegionProfiler *profiler,
+                                         const char     *name)
+: d_profiler_p(profiler)
+{
+    BSLS_ASSERT_SAFE(profiler);
+
+    d_profiler_p->enter(name);
+}
+
+inline
+RegionProfilerGuard::~RegionProfilerGuard()
+{
+    d_profiler_p->leave();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1083 @@
+// bsls_regionprofiler.t.cpp                                          -*-C++-*-
+#include <bsls_regionprofiler.h>
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+#include <bsls_timeutil.h>       // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a profiler, 'bsls::RegionProfiler', that
+// aggregates counts and times of nested, named regions into a tree keyed by
+// path, and a guard, 'bsls::RegionProfilerGuard', that enters and leaves a
+// region.  The structure of the tree and the counts are deterministic, and
+// are verified exactly against the sequence of 'enter' and 'leave' calls.
+// Times are verified to be plausible by timing regions that busy-wait for a
+// known duration, and the collapsed-stack output is verified exactly for call
+// counts and, within tolerances, for self times.
+// ----------------------------------------------------------------------------
+// 'RegionProfiler' class:
+// [ 2] explicit RegionProfiler(bool collectThreadCpuTime = false);
+// [ 2] ~RegionProfiler();
+// [ 5] void add(const RegionProfiler& other);
+// [ 2] void enter(const char *name);
+// [ 2] void leave();
+// [ 2] void reset();
+// [ 2] int depth() const;
+// [ 2] int findRegion(int parent, const char *name) const;
+// [ 2] bool isCollectingThreadCpuTime() const;
+// [ 4] Int64 numDroppedRegions() const;
+// [ 2] int numRegions() const;
+// [ 6] int printCollapsedStacks(char *, int, Metric) const;
+// [ 2] const char *regionName(int index) const;
+// [ 2] int regionParent(int index) const;
+// [ 2] Int64 regionCount(int index) const;
+// [ 3] Int64 regionThreadCpuTime(int index) const;
+// [ 3] Int64 regionWallTime(int index) const;
+//
+// 'RegionProfilerGuard' class:
+// [ 7] RegionProfilerGuard(RegionProfiler *profiler, const char *name);
+// [ 7] ~RegionProfilerGuard();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: cost of entering and leaving a region
+
+// ============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::RegionProfiler      Obj;
+typedef bsls::RegionProfilerGuard Guard;
+typedef bsls::Types::Int64        Int64;
+typedef bsls::TimeUtil            TU;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static void busyWait(Int64 nanoseconds)
+    // Consume at least the specified 'nanoseconds' of the CPU time of the
+    // calling thread (and, therefore, at least as much wall time).
+{
+    const Int64 end = TU::getThreadCpuTimer() + nanoseconds;
+    while (TU::getThreadCpuTimer() < end) {
+    }
+}
+
+static Int64 valueOfPath(const char *output, const char *path)
+    // Return the value of the line of the specified collapsed-stack 'output'
+    // for the specified 'path', or -1 if 'output' has no such line.
+{
+    const size_t length = strlen(path);
+
+    for (const char *line = output; *line; ) {
+        if (0 == strncmp(line, path, length) && ' ' == line[length]) {
+            return atoi(line + length + 1);                           // RETURN
+        }
+        const char *end = strchr(line, '\n');
+        if (!end) {
+            break;
+        }
+        line = end + 1;
+    }
+    return -1;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling Nested Regions
+///- - - - - - - - - - - - - - - - - -
+// Suppose that a request handler parses a request and then executes it, and
+// that we want to know how the time spent by the handler is divided among
+// these steps.  First, we instrument the functions performing the steps with
+// 'bsls::RegionProfilerGuard' objects:
+//..
+    void parseRequest(bsls::RegionProfiler *profiler)
+        // Parse a request, profiling into the specified 'profiler'.
+    {
+        bsls::RegionProfilerGuard guard(profiler, "parse");
+
+        // ... (parse the request)
+    }
+
+    void executeRequest(bsls::RegionProfiler *profiler)
+        // Execute a request, profiling into the specified 'profiler'.
+    {
+        bsls::RegionProfilerGuard guard(profiler, "execute");
+
+        // ... (execute the request)
+    }
+
+    void handleRequest(bsls::RegionProfiler *profiler)
+        // Handle a request, profiling into the specified 'profiler'.
+    {
+        bsls::RegionProfilerGuard guard(profiler, "handle");
+
+        parseRequest(profiler);
+        executeRequest(profiler);
+    }
+//..
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we handle a few requests, collecting thread CPU time as well as wall
+// time:
+//..
+    bsls::RegionProfiler profiler(true);
+
+    for (int i = 0; i < 10; ++i) {
+        handleRequest(&profiler);
+    }
+//..
+// Next, we observe that the profiler has recorded one node for each distinct
+// path (plus the root), and we look up the node of the "handle;parse" path:
+//..
+    ASSERT(4 == profiler.numRegions());
+
+    const int handle = profiler.findRegion(0, "handle");
+    ASSERT(0 < handle);
+
+    const int parse = profiler.findRegion(handle, "parse");
+    ASSERT(0 < parse);
+    ASSERT(handle == profiler.regionParent(parse));
+    ASSERT(10     == profiler.regionCount(parse));
+    ASSERT(profiler.regionWallTime(parse) <= profiler.regionWallTime(handle));
+//..
+// Finally, we write the profile in collapsed-stack format, in which the value
+// of each path is its *self* (or exclusive) time in microseconds, i.e., the
+// time spent on the path less the time spent in its nested regions, and paths
+// having a value of 0 are omitted.  'printCollapsedStacks' returns the length
+// of the complete output, which may be used to size the buffer:
+//..
+    const bsls::RegionProfiler::Metric metric =
+                                         bsls::RegionProfiler::BSLS_CALL_COUNT;
+
+    char      buffer[1024];
+    const int length = profiler.printCollapsedStacks(buffer,
+                                                     sizeof buffer,
+                                                     metric);
+    ASSERT(length < static_cast<int>(sizeof buffer));
+    ASSERT(0 == strcmp(buffer, "handle 10\n"
+                               "handle;parse 10\n"
+                               "handle;execute 10\n"));
+//..
+// A file of such lines, typically using the 'BSLS_WALL_TIME' or
+// 'BSLS_THREAD_CPU_TIME' metric, can be passed directly to 'flamegraph.pl'.
+
+        if (veryVerbose) printf("%s", buffer);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'RegionProfilerGuard'
+        //
+        // Concerns:
+        //: 1 A guard enters the named region upon construction and leaves it
+        //:   upon destruction.
+        //:
+        //: 2 Nested guards produce nested regions.
+        //:
+        //: 3 A null profiler is rejected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Create nested guards in nested scopes, and verify the depth of
+        //:   the profiler in each scope and the recorded tree afterwards.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify, using 'AssertTest', that a null profiler is rejected.
+        //:   (C-3)
+        //
+        // Testing:
+        //   RegionProfilerGuard(RegionProfiler *profiler, const char *name);
+        //   ~RegionProfilerGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'RegionProfilerGuard'"
+                            "\n=====================\n");
+
+        Obj mX;  const Obj& X = mX;
+        {
+            Guard outer(&mX, "outer");
+            ASSERT(1 == X.depth());
+            {
+                Guard inner(&mX, "inner");
+                ASSERT(2 == X.depth());
+            }
+            ASSERT(1 == X.depth());
+            {
+                Guard inner(&mX, "inner");
+                ASSERT(2 == X.depth());
+            }
+        }
+        ASSERT(0 == X.depth());
+        ASSERT(3 == X.numRegions());
+
+        const int outer = X.findRegion(0, "outer");
+        const int inner = X.findRegion(outer, "inner");
+        ASSERT(1 == outer);
+        ASSERT(2 == inner);
+        ASSERT(1 == X.regionCount(outer));
+        ASSERT(2 == X.regionCount(inner));
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mY;
+
+            ASSERT_SAFE_PASS((Guard(&mY, "a")));
+            ASSERT_SAFE_FAIL( Guard(  0, "a"));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'printCollapsedStacks'
+        //
+        // Concerns:
+        //: 1 Each path having a positive self value is written on one line,
+        //:   with the names of its regions separated by ';', followed by a
+        //:   space, the value, and a newline, in order of first entry.
+        //:
+        //: 2 The self value of a path is its value less the values of its
+        //:   children for the time metrics, and its own count for
+        //:   'BSLS_CALL_COUNT'.  Times are written in microseconds.
+        //:
+        //: 3 The return value is the length of the complete output, which is
+        //:   truncated (and null-terminated) to fit the buffer, and nothing is
+        //:   written to a buffer of length 0.
+        //:
+        //: 4 An empty profiler writes an empty string.
+        //:
+        //: 5 Invalid arguments are rejected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Record a tree of regions with known counts and verify the output
+        //:   of the 'BSLS_CALL_COUNT' metric exactly.  (C-1)
+        //:
+        //: 2 Record regions that busy-wait for known durations, and verify
+        //:   the self times written for 'BSLS_WALL_TIME' and
+        //:   'BSLS_THREAD_CPU_TIME' within a tolerance.  (C-2)
+        //:
+        //: 3 Write the output into buffers of every length from 0 to the
+        //:   length of the complete output, and verify the return value and
+        //:   the truncated output against the complete output.  (C-3)
+        //:
+        //: 4 Verify the output of an empty profiler.  (C-4)
+        //:
+        //: 5 Verify, using 'AssertTest', that a negative length, and a null
+        //:   buffer having a positive length, are rejected.  (C-5)
+        //
+        // Testing:
+        //   int printCollapsedStacks(char *, int, Metric) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'printCollapsedStacks'"
+                            "\n======================\n");
+
+        char buffer[1024];
+
+        if (verbose) printf("\nEmpty profiler.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            buffer[0] = 'x';
+            ASSERT(0 == X.printCollapsedStacks(buffer,
+                                               sizeof buffer,
+                                               Obj::BSLS_WALL_TIME));
+            ASSERT('\0' == buffer[0]);
+        }
+
+        if (verbose) printf("\nCall counts.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < 3; ++i) {
+                mX.enter("a");
+                for (int j = 0; j < 2; ++j) {
+                    mX.enter("b");
+                    mX.enter("c");
+                    mX.leave();
+                    mX.leave();
+                }
+                mX.leave();
+            }
+            mX.enter("d");
+            mX.enter("b");
+            mX.leave();
+            mX.leave();
+
+            const char *EXP = "a 3\n"
+                              "a;b 6\n"
+                              "a;b;c 6\n"
+                              "d 1\n"
+                              "d;b 1\n";
+
+            const int length = X.printCollapsedStacks(buffer,
+                                                      sizeof buffer,
+                                                      Obj::BSLS_CALL_COUNT);
+            if (veryVerbose) printf("%s", buffer);
+            ASSERTV(buffer, 0 == strcmp(EXP, buffer));
+            ASSERTV(length, static_cast<int>(strlen(EXP)) == length);
+
+            if (verbose) printf("\nTruncation.\n");
+
+            for (int len = 0; len <= length + 1; ++len) {
+                char truncated[64];
+                memset(truncated, 'x', sizeof truncated);
+
+                ASSERTV(len, length == X.printCollapsedStacks(
+                                                        truncated,
+                                                        len,
+                                                        Obj::BSLS_CALL_COUNT));
+                if (0 == len) {
+                    ASSERTV(len, 'x' == truncated[0]);
+                    continue;
+                }
+                const int written = len <= length ? len - 1 : length;
+                ASSERTV(len, 0 == strncmp(EXP, truncated, written));
+                ASSERTV(len, '\0' == truncated[written]);
+                ASSERTV(len, 'x'  == truncated[written + 1]);
+            }
+            ASSERT(length == X.printCollapsedStacks(0,
+                                                    0,
+                                                    Obj::BSLS_CALL_COUNT));
+        }
+
+        if (verbose) printf("\nSelf times.\n");
+        {
+            const Int64 MS = 1000 * 1000;  // nanoseconds per millisecond
+
+            Obj mX(true);  const Obj& X = mX;
+
+            mX.enter("outer");
+            busyWait(20 * MS);
+            mX.enter("inner");
+            busyWait(30 * MS);
+            mX.leave();
+            mX.leave();
+
+            const Obj::Metric METRICS[] = { Obj::BSLS_WALL_TIME,
+                                            Obj::BSLS_THREAD_CPU_TIME };
+
+            for (int m = 0; m < 2; ++m) {
+                X.printCollapsedStacks(buffer, sizeof buffer, METRICS[m]);
+                if (veryVerbose) printf("%s", buffer);
+
+                const Int64 outer = valueOfPath(buffer, "outer");
+                const Int64 inner = valueOfPath(buffer, "outer;inner");
+
+                // Times are in microseconds; allow for the granularity of the
+                // thread CPU clock.  Wall times have no upper bound, as the
+                // scheduling of other processes may delay this thread
+                // arbitrarily.
+
+                ASSERTV(m, outer, 18000 <= outer);
+                ASSERTV(m, inner, 28000 <= inner);
+                if (Obj::BSLS_THREAD_CPU_TIME == METRICS[m]) {
+                    ASSERTV(m, outer, outer <= 20000 + 50000);
+                    ASSERTV(m, inner, inner <= 30000 + 50000);
+                }
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_SAFE_PASS(X.printCollapsedStacks(buffer,
+                                                    1,
+                                                    Obj::BSLS_WALL_TIME));
+            ASSERT_SAFE_PASS(X.printCollapsedStacks(0,
+                                                    0,
+                                                    Obj::BSLS_WALL_TIME));
+            ASSERT_SAFE_FAIL(X.printCollapsedStacks(buffer,
+                                                    -1,
+                                                    Obj::BSLS_WALL_TIME));
+            ASSERT_SAFE_FAIL(X.printCollapsedStacks(0,
+                                                    1,
+                                                    Obj::BSLS_WALL_TIME));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'add'
+        //
+        // Concerns:
+        //: 1 Nodes of the two profilers are matched by path, regardless of
+        //:   their indices, and their counts and times are added.
+        //:
+        //: 2 Paths present only in the other profiler are added, under the
+        //:   matching parent.
+        //:
+        //: 3 Paths that do not fit are counted as dropped, as are the dropped
+        //:   regions of the other profiler.
+        //:
+        //: 4 The other profiler is not modified.
+        //
+        // Plan:
+        //: 1 Record different, overlapping trees (having different node
+        //:   indices for the same path) into two profilers, add one to the
+        //:   other, and verify the counts and times of every path.  (C-1..2,4)
+        //:
+        //: 2 Add a profiler having more paths than fit into a profiler that
+        //:   is almost full, and verify the number of dropped regions.  (C-3)
+        //
+        // Testing:
+        //   void add(const RegionProfiler& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'add'"
+                            "\n=====\n");
+
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            mX.enter("a");  mX.enter("b");  mX.leave();  mX.leave();
+
+            mY.enter("c");  mY.leave();
+            mY.enter("a");  mY.enter("d");  mY.leave();
+                            mY.enter("b");  mY.leave();  mY.leave();
+
+            const int xa = X.findRegion(0, "a");
+            const int xb = X.findRegion(xa, "b");
+            const int ya = Y.findRegion(0, "a");
+            const int yb = Y.findRegion(ya, "b");
+
+            ASSERT(xa != ya);
+            ASSERT(xb != yb);
+
+            const Int64 XA = X.regionWallTime(xa);
+            const Int64 XB = X.regionWallTime(xb);
+            const Int64 YA = Y.regionWallTime(ya);
+            const Int64 YB = Y.regionWallTime(yb);
+
+            mX.add(Y);
+
+            ASSERT(5 == X.numRegions());
+            ASSERT(5 == Y.numRegions());
+            ASSERT(xa == X.findRegion(0, "a"));
+            ASSERT(xb == X.findRegion(xa, "b"));
+
+            ASSERT(2       == X.regionCount(xa));
+            ASSERT(2       == X.regionCount(xb));
+            ASSERT(XA + YA == X.regionWallTime(xa));
+            ASSERT(XB + YB == X.regionWallTime(xb));
+
+            const int xc = X.findRegion(0, "c");
+            const int xd = X.findRegion(xa, "d");
+            ASSERT(0 < xc);
+            ASSERT(0 < xd);
+            ASSERT(0  == X.regionParent(xc));
+            ASSERT(xa == X.regionParent(xd));
+            ASSERT(1  == X.regionCount(xc));
+            ASSERT(1  == X.regionCount(xd));
+
+            ASSERT(1 == Y.regionCount(ya));
+            ASSERT(1 == Y.regionCount(yb));
+            ASSERT(0 == X.numDroppedRegions());
+        }
+
+        if (verbose) printf("\nDropped paths.\n");
+        {
+            static char names[Obj::MAX_REGIONS][8];
+            for (int i = 0; i < Obj::MAX_REGIONS; ++i) {
+                sprintf(names[i], "r%d", i);
+            }
+
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            for (int i = 0; i < Obj::MAX_REGIONS - 2; ++i) {
+                mX.enter(names[i]);  mX.leave();
+            }
+            ASSERT(Obj::MAX_REGIONS - 1 == X.numRegions());
+
+            // 'Y' has the paths "r0", "x", "x;y", and "z".  Only "x" fits;
+            // its child "x;y", and "z", are dropped.
+
+            mY.enter(names[0]);  mY.leave();
+            mY.enter("x");  mY.enter("y");  mY.leave();  mY.leave();
+            mY.enter("x");  mY.enter("y");  mY.leave();  mY.leave();
+            mY.enter("z");  mY.leave();
+            ASSERT(5 == Y.numRegions());
+
+            mX.add(Y);
+
+            ASSERT(Obj::MAX_REGIONS == X.numRegions());
+            ASSERT(2 == X.regionCount(X.findRegion(0, names[0])));
+            ASSERT(2 == X.regionCount(X.findRegion(0, "x")));
+            ASSERT(3 == X.numDroppedRegions());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CAPACITY
+        //
+        // Concerns:
+        //: 1 Regions nested deeper than 'MAX_DEPTH' are not recorded, and
+        //:   neither are the regions nested within them, but the regions
+        //:   enclosing them are recorded correctly.
+        //:
+        //: 2 Regions for which no node can be added are not recorded, and
+        //:   neither are the regions nested within them, but paths that are
+        //:   already recorded continue to be recorded.
+        //:
+        //: 3 'depth' counts the regions that are not recorded, and every
+        //:   region that is not recorded is counted by 'numDroppedRegions'.
+        //:
+        //: 4 'reset' clears the count of dropped regions.
+        //
+        // Plan:
+        //: 1 Enter 'MAX_DEPTH + 2' nested regions, verify 'depth' and
+        //:   'numDroppedRegions', leave them all, and verify the recorded
+        //:   counts.  (C-1, 3)
+        //:
+        //: 2 Fill the profiler with distinct paths, then enter a new path
+        //:   enclosing an existing one, and an existing path, and verify the
+        //:   recorded counts and 'numDroppedRegions'.  (C-2..3)
+        //:
+        //: 3 Reset the profiler and verify 'numDroppedRegions'.  (C-4)
+        //
+        // Testing:
+        //   Int64 numDroppedRegions() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY"
+                            "\n========\n");
+
+        if (verbose) printf("\nMaximum depth.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < Obj::MAX_DEPTH + 2; ++i) {
+                mX.enter("r");
+                ASSERTV(i, i + 1 == X.depth());
+            }
+            ASSERT(2                 == X.numDroppedRegions());
+            ASSERT(Obj::MAX_DEPTH + 1 == X.numRegions());
+
+            for (int i = Obj::MAX_DEPTH + 2; i > 0; --i) {
+                ASSERTV(i, i == X.depth());
+                mX.leave();
+            }
+            ASSERT(0 == X.depth());
+
+            for (int i = 1; i < X.numRegions(); ++i) {
+                ASSERTV(i, 1     == X.regionCount(i));
+                ASSERTV(i, i - 1 == X.regionParent(i));
+            }
+
+            mX.reset();
+            ASSERT(0 == X.numDroppedRegions());
+        }
+
+        if (verbose) printf("\nMaximum number of regions.\n");
+        {
+            static char names[Obj::MAX_REGIONS][8];
+            for (int i = 0; i < Obj::MAX_REGIONS; ++i) {
+                sprintf(names[i], "r%d", i);
+            }
+
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < Obj::MAX_REGIONS - 1; ++i) {
+                mX.enter(names[i]);  mX.leave();
+            }
+            ASSERT(Obj::MAX_REGIONS == X.numRegions());
+            ASSERT(0                == X.numDroppedRegions());
+
+            mX.enter("new");
+            mX.enter(names[0]);  // nested in a dropped region
+            ASSERT(2 == X.depth());
+            mX.leave();
+            mX.leave();
+            ASSERT(2 == X.numDroppedRegions());
+
+            mX.enter(names[0]);
+            mX.leave();
+            ASSERT(0 > X.findRegion(0, "new"));
+            ASSERT(2 == X.regionCount(X.findRegion(0, names[0])));
+            ASSERT(2 == X.numDroppedRegions());
+            ASSERT(Obj::MAX_REGIONS == X.numRegions());
+
+            mX.reset();
+            ASSERT(1 == X.numRegions());
+            ASSERT(0 == X.numDroppedRegions());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RECORDED TIMES
+        //
+        // Concerns:
+        //: 1 The wall time of a region is at least the time spent in it, and
+        //:   includes the time spent in nested regions.
+        //:
+        //: 2 Thread CPU time is recorded if, and only if, it is collected,
+        //:   and does not exceed the wall time by more than the granularity
+        //:   of the thread CPU clock.
+        //:
+        //: 3 Times accumulate over repeated entries of a path.
+        //
+        // Plan:
+        //: 1 Record nested regions that busy-wait for known durations, with
+        //:   and without collecting thread CPU time, and verify the recorded
+        //:   times against the durations and each other.  (C-1..3)
+        //
+        // Testing:
+        //   Int64 regionThreadCpuTime(int index) const;
+        //   Int64 regionWallTime(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRECORDED TIMES"
+                            "\n==============\n");
+
+        const Int64 MS          = 1000 * 1000;  // nanoseconds per millisecond
+        const Int64 GRANULARITY = 10 * MS;      // of the thread CPU clock
+
+        for (int collect = 0; collect < 2; ++collect) {
+            Obj mX(collect);  const Obj& X = mX;
+
+            for (int i = 0; i < 2; ++i) {
+                mX.enter("outer");
+                busyWait(5 * MS);
+                mX.enter("inner");
+                busyWait(10 * MS);
+                mX.leave();
+                mX.leave();
+            }
+
+            const int outer = X.findRegion(0, "outer");
+            const int inner = X.findRegion(outer, "inner");
+
+            const Int64 outerWall = X.regionWallTime(outer);
+            const Int64 innerWall = X.regionWallTime(inner);
+            const Int64 outerCpu  = X.regionThreadCpuTime(outer);
+            const Int64 innerCpu  = X.regionThreadCpuTime(inner);
+
+            if (veryVerbose) {
+                T_ P_(collect) P_(outerWall) P_(innerWall)
+                P_(outerCpu) P(innerCpu)
+            }
+
+            ASSERTV(collect, innerWall, 20 * MS <= innerWall);
+            ASSERTV(collect, outerWall, innerWall + 10 * MS <= outerWall);
+
+            if (collect) {
+                ASSERTV(innerCpu, 0 < innerCpu);
+                ASSERTV(outerCpu, innerCpu <= outerCpu);
+                ASSERTV(innerCpu, innerCpu <= innerWall + GRANULARITY);
+                ASSERTV(outerCpu, outerCpu <= outerWall + GRANULARITY);
+            }
+            else {
+                ASSERTV(outerCpu, 0 == outerCpu);
+                ASSERTV(innerCpu, 0 == innerCpu);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'enter', 'leave', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed profiler has only the root node, which has
+        //:   an empty name, no parent, and no counts, and does not collect
+        //:   thread CPU time unless so requested.
+        //:
+        //: 2 Each distinct path of region names is recorded in one node,
+        //:   whose parent is the node of the enclosing path, in order of
+        //:   first entry, and whose count is the number of times the path
+        //:   was entered and left.
+        //:
+        //: 3 Region names are compared by content, so that equal names at
+        //:   different addresses denote the same region, and the same name
+        //:   nested in different regions denotes different paths.
+        //:
+        //: 4 'depth' is the number of active regions, and a region is counted
+        //:   only when it is left.
+        //:
+        //: 5 'findRegion' returns -1 for paths that are not recorded.
+        //:
+        //: 6 'reset' discards all paths.
+        //:
+        //: 7 Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Verify the state of default-constructed profilers.  (C-1)
+        //:
+        //: 2 Enter and leave a sequence of nested regions, using names at
+        //:   different addresses, and verify the tree of nodes, the counts,
+        //:   and the depth along the way.  (C-2..5)
+        //:
+        //: 3 Reset the profiler, and verify its state.  (C-6)
+        //:
+        //: 4 Verify, using 'AssertTest', that 'leave' without an active
+        //:   region, 'reset' with an active region, and out-of-range indices
+        //:   are rejected.  (C-7)
+        //
+        // Testing:
+        //   explicit RegionProfiler(bool collectThreadCpuTime = false);
+        //   ~RegionProfiler();
+        //   void enter(const char *name);
+        //   void leave();
+        //   void reset();
+        //   int depth() const;
+        //   int findRegion(int parent, const char *name) const;
+        //   bool isCollectingThreadCpuTime() const;
+        //   int numRegions() const;
+        //   const char *regionName(int index) const;
+        //   int regionParent(int index) const;
+        //   Int64 regionCount(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'enter', 'leave', AND BASIC ACCESSORS"
+                            "\n=====================================\n");
+
+        if (verbose) printf("\nDefault state.\n");
+        {
+            Obj mX;        const Obj& X = mX;
+            Obj mY(true);  const Obj& Y = mY;
+
+            ASSERT(false == X.isCollectingThreadCpuTime());
+            ASSERT(true  == Y.isCollectingThreadCpuTime());
+
+            ASSERT(1  == X.numRegions());
+            ASSERT(0  == X.depth());
+            ASSERT(0  == X.numDroppedRegions());
+            ASSERT(-1 == X.regionParent(0));
+            ASSERT(0  == strcmp("", X.regionName(0)));
+            ASSERT(0  == X.regionCount(0));
+            ASSERT(0  == X.regionWallTime(0));
+            ASSERT(0  == X.regionThreadCpuTime(0));
+            ASSERT(-1 == X.findRegion(0, "a"));
+        }
+
+        if (verbose) printf("\nRecording paths.\n");
+        {
+            char a1[] = "a";  char a2[] = "a";
+            char b1[] = "b";  char b2[] = "b";
+
+            Obj mX;  const Obj& X = mX;
+
+            mX.enter(a1);                        ASSERT(1 == X.depth());
+            ASSERT(2 == X.numRegions());
+            ASSERT(0 == X.regionCount(1));      // counted only when left
+            mX.enter(b1);                        ASSERT(2 == X.depth());
+            mX.leave();                          ASSERT(1 == X.depth());
+            mX.enter(b2);                        ASSERT(2 == X.depth());
+            mX.leave();
+            mX.leave();                          ASSERT(0 == X.depth());
+
+            mX.enter(b1);
+            mX.enter(a2);
+            mX.leave();
+            mX.leave();
+
+            mX.enter(a2);
+            mX.leave();
+
+            ASSERT(5 == X.numRegions());
+
+            const struct {
+                int         d_line;
+                int         d_index;
+                int         d_parent;
+                const char *d_name;
+                int         d_count;
+            } DATA[] = {
+                //LINE  INDEX  PARENT  NAME  COUNT
+                //----  -----  ------  ----  -----
+                { L_,       1,      0,  "a",     2 },  // "a"
+                { L_,       2,      1,  "b",     2 },  // "a;b"
+                { L_,       3,      0,  "b",     1 },  // "b"
+                { L_,       4,      3,  "a",     1 },  // "b;a"
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const int   INDEX  = DATA[ti].d_index;
+                const int   PARENT = DATA[ti].d_parent;
+                const char *NAME   = DATA[ti].d_name;
+                const int   COUNT  = DATA[ti].d_count;
+
+                ASSERTV(LINE, PARENT == X.regionParent(INDEX));
+                ASSERTV(LINE, 0 == strcmp(NAME, X.regionName(INDEX)));
+                ASSERTV(LINE, COUNT == X.regionCount(INDEX));
+                ASSERTV(LINE, INDEX == X.findRegion(PARENT, NAME));
+            }
+
+            // The name supplied on first entry is retained.
+
+            ASSERT(a1 == X.regionName(1));
+            ASSERT(b1 == X.regionName(2));
+
+            ASSERT(-1 == X.findRegion(2, "a"));
+            ASSERT(-1 == X.findRegion(0, "c"));
+
+            mX.reset();
+            ASSERT(1  == X.numRegions());
+            ASSERT(-1 == X.findRegion(0, "a"));
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.leave());
+            ASSERT_SAFE_FAIL(mX.enter(0));
+
+            mX.enter("a");
+            ASSERT_SAFE_FAIL(mX.reset());
+            ASSERT_SAFE_PASS(mX.leave());
+            ASSERT_SAFE_PASS(mX.reset());
+
+            ASSERT_SAFE_FAIL(X.regionCount(-1));
+            ASSERT_SAFE_PASS(X.regionCount( 0));
+            ASSERT_SAFE_FAIL(X.regionCount( 1));
+            ASSERT_SAFE_FAIL(X.regionName( 1));
+            ASSERT_SAFE_FAIL(X.regionParent( 1));
+            ASSERT_SAFE_FAIL(X.regionWallTime( 1));
+            ASSERT_SAFE_FAIL(X.regionThreadCpuTime( 1));
+            ASSERT_SAFE_FAIL(X.findRegion(-1, "a"));
+            ASSERT_SAFE_PASS(X.findRegion( 0, "a"));
+            ASSERT_SAFE_FAIL(X.findRegion( 1, "a"));
+            ASSERT_SAFE_FAIL(X.findRegion( 0,   0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Enter and leave a few nested regions, and verify the recorded
+        //:   tree and the collapsed-stack output.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX(true);  const Obj& X = mX;
+
+        mX.enter("main");
+        mX.enter("work");
+        mX.leave();
+        mX.leave();
+
+        ASSERT(3 == X.numRegions());
+        ASSERT(0 == X.depth());
+
+        const int outer = X.findRegion(0, "main");
+        const int inner = X.findRegion(outer, "work");
+
+        ASSERT(1     == X.regionCount(outer));
+        ASSERT(1     == X.regionCount(inner));
+        ASSERT(outer == X.regionParent(inner));
+        ASSERT(0     <= X.regionWallTime(inner));
+        ASSERT(X.regionWallTime(inner) <= X.regionWallTime(outer));
+
+        char buffer[64];
+        X.printCollapsedStacks(buffer, sizeof buffer, Obj::BSLS_CALL_COUNT);
+        if (veryVerbose) printf("%s", buffer);
+        ASSERT(0 == strcmp("main 1\nmain;work 1\n", buffer));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COST OF ENTERING AND LEAVING A REGION
+        //
+        // Concerns:
+        //: 1 Entering and leaving a region adds little more than the cost of
+        //:   reading the timers.
+        //
+        // Plan:
+        //: 1 Report the average cost of entering and leaving a nested region
+        //:   (below an outer region having several children), without and
+        //:   with thread CPU time collection, and the cost of reading the raw
+        //:   wall timer twice for comparison.  The number of iterations (in
+        //:   millions) may be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: cost of entering and leaving a region
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COST OF ENTERING AND LEAVING"
+                            "\n=========================================\n");
+
+        TU::initialize();
+
+        const int MILLIONS   = verbose ? atoi(argv[2]) : 1;
+        const int ITERATIONS = 1000000 * (MILLIONS > 0 ? MILLIONS : 1);
+
+        static const char *const NAMES[] = { "a", "b", "c", "d" };
+
+        Int64 start = TU::getTimer();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            TU::OpaqueNativeTime t1, t2;
+            TU::getTimerRaw(&t1);
+            TU::getTimerRaw(&t2);
+        }
+        const Int64 timerTime = TU::getTimer() - start;
+
+        printf("two raw timer reads:  %7.2f nsec\n",
+               (double) timerTime / ITERATIONS);
+
+        for (int collect = 0; collect < 2; ++collect) {
+            Obj mX(collect);  const Obj& X = mX;
+
+            mX.enter("outer");
+            start = TU::getTimer();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Guard guard(&mX, NAMES[i & 3]);
+            }
+            const Int64 regionTime = TU::getTimer() - start;
+            mX.leave();
+
+            ASSERT(6 == X.numRegions());
+
+            printf("region (%s): %7.2f nsec\n",
+                   collect ? "wall+cpu" : "wall    ",
+                   (double) regionTime / ITERATIONS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
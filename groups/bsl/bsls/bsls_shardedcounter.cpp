@@ -0,0 +1,120 @@
+// bsls_shardedcounter.cpp                                            -*-C++-*-
+#include <bsls_shardedcounter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_atomic.h>         // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+#include <bsls_timeutil.h>       // for testing only
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+namespace {
+
+enum {
+    // The number of bits needed to represent a shard index.
+
+    k_SHARD_INDEX_BITS = 4
+};
+
+struct ShardedCounter_Assert {
+    // Compile-time check that 'k_SHARD_INDEX_BITS' matches
+    // 'ShardedCounter::NUM_SHARDS'.
+
+    char d_check[ShardedCounter::NUM_SHARDS == 1 << k_SHARD_INDEX_BITS
+                  ? 1
+                  : -1];
+};
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // class ShardedCounter
+                            // --------------------
+
+// PRIVATE CLASS METHODS
+int ShardedCounter::currentShardIndex()
+{
+    // Thread identifiers are frequently addresses of per-thread control
+    // blocks (which share their low-order bits) or small consecutive integers,
+    // so they are folded to 32 bits and mixed using Fibonacci hashing, taking
+    // the high-order bits of the product as the index.
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    const Types::Uint64 id = static_cast<Types::Uint64>(GetCurrentThreadId());
+#else
+    const Types::Uint64 id = (Types::Uint64) pthread_self();
+#endif
+
+    unsigned int hash = static_cast<unsigned int>(id ^ (id >> 32));
+    hash *= 0x9E3779B9U;
+
+    return static_cast<int>(hash >> (32 - k_SHARD_INDEX_BITS));
+}
+
+// CREATORS
+ShardedCounter::ShardedCounter(Types::Int64 initialValue)
+: d_slots_p(d_buffer + AlignmentUtil::calculateAlignmentOffset(
+                                                             d_buffer,
+                                                             CACHE_LINE_SIZE))
+{
+    AtomicOperations::initInt64(slot(0), initialValue);
+    for (int i = 1; i < NUM_SHARDS; ++i) {
+        AtomicOperations::initInt64(slot(i), 0);
+    }
+}
+
+// MANIPULATORS
+void ShardedCounter::reset(Types::Int64 value)
+{
+    AtomicOperations::setInt64Relaxed(slot(0), value);
+    for (int i = 1; i < NUM_SHARDS; ++i) {
+        AtomicOperations::setInt64Relaxed(slot(i), 0);
+    }
+}
+
+// ACCESSORS
+Types::Int64 ShardedCounter::value() const
+{
+    Types::Int64 sum = 0;
+    for (int i = 0; i < NUM_SHARDS; ++i) {
+        sum += AtomicOperations::getInt64Relaxed(slot(i));
+    }
+    return sum;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,429 @@
+// bsls_shardedcounter.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLS_SHARDEDCOUNTER
+#define INCLUDED_BSLS_SHARDEDCOUNTER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide cache-line padded objects and a sharded atomic counter.
+//
+//@CLASSES:
+//  bsls::CacheLinePadded: wrapper placing an object in its own cache line(s)
+//  bsls::ShardedCounter: 64-bit counter striped across per-thread cache lines
+//
+//@SEE_ALSO: bsls_atomic, bsls_alignmentutil, bsls_platform
+//
+//@DESCRIPTION: This component provides two mechanisms that eliminate "false
+// sharing" among frequently-modified statistics: a class template,
+// 'bsls::CacheLinePadded', that holds an object of its parameterized 'TYPE'
+// such that no other object can occupy any cache line touched by the held
+// object, and a class, 'bsls::ShardedCounter', that implements a 64-bit
+// counter whose increments are distributed across a fixed number of
+// cache-line-aligned atomic slots ("shards"), and whose value is obtained by
+// summing the shards.
+//
+///False Sharing
+///-------------
+// Processors maintain cache coherence at the granularity of a cache line
+// (typically 64 or 128 bytes, see 'BSLS_PLATFORM_CACHE_LINE_SIZE' in
+// 'bsls_platform').  When two threads repeatedly modify *different* objects
+// that happen to reside in the same cache line, the line "ping-pongs" between
+// the processors' caches exactly as if the threads were modifying the same
+// object.  A group of 'bsls::AtomicInt64' statistics declared next to each
+// other in a 'struct' and updated by every thread is the canonical example.
+//
+// 'bsls::CacheLinePadded<TYPE>' surrounds the held object with enough padding
+// that, irrespective of the address at which the 'bsls::CacheLinePadded'
+// object itself is placed, the cache lines spanned by the held object contain
+// no other data.  The padding is computed at compile time from
+// 'BSLS_PLATFORM_CACHE_LINE_SIZE' and the alignment requirement of 'TYPE', so
+// no over-aligned allocation is required.
+//
+///Sharded Counters
+///----------------
+// Padding removes contention between *different* counters, but a single
+// counter that is incremented by every thread still serializes all of those
+// threads on one cache line.  'bsls::ShardedCounter' addresses this by
+// maintaining 'ShardedCounter::NUM_SHARDS' independent 64-bit atomic slots,
+// each in its own cache line (aligned within an internal buffer using
+// 'bsls::AlignmentUtil').  The 'add' and 'increment' methods select a slot
+// based on the identity of the calling thread and update it using *relaxed*
+// memory ordering, and the 'value' method sums all slots.  Updates are
+// therefore nearly contention-free, at the cost of a read whose expense is
+// proportional to the number of shards.  Threads that hash to the same slot
+// remain correct, but contend with each other.
+//
+// Note that 'value' is not a linearizable snapshot: increments that are
+// concurrent with a call to 'value' may or may not be reflected in the
+// returned sum.  Once all updating threads have been synchronized with the
+// reading thread (e.g., joined), 'value' returns the exact total.  Also note
+// that, because relaxed ordering is used, a 'ShardedCounter' must not be used
+// to publish other data between threads; it is intended purely for
+// statistics.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Per-Service Message Statistics
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service maintains statistics that are updated by every
+// worker thread for every message processed.  First, we define a 'struct'
+// holding those statistics, using 'bsls::ShardedCounter' for the counters
+// that every thread increments, and 'bsls::CacheLinePadded' for a value that
+// is updated less often but that must not share a cache line with its
+// neighbors:
+//..
+//  struct ServiceStatistics {
+//      // This 'struct' holds the statistics of a message-processing service.
+//
+//      bsls::ShardedCounter                       d_numMessages;
+//      bsls::ShardedCounter                       d_numBytes;
+//      bsls::CacheLinePadded<bsls::AtomicInt64>   d_maxMessageSize;
+//  };
+//..
+// Then, we define a function, invoked by each worker thread for each message,
+// that updates the statistics:
+//..
+//  void recordMessage(ServiceStatistics *stats, int messageSize)
+//      // Update the specified 'stats' to reflect the processing of a message
+//      // having the specified 'messageSize'.
+//  {
+//      stats->d_numMessages.increment();
+//      stats->d_numBytes.add(messageSize);
+//
+//      bsls::AtomicInt64& maxSize = stats->d_maxMessageSize.object();
+//      bsls::Types::Int64 current = maxSize.loadRelaxed();
+//      while (messageSize > current) {
+//          const bsls::Types::Int64 prior =
+//                                      maxSize.testAndSwap(current,
+//                                                          messageSize);
+//          if (prior == current) {
+//              break;
+//          }
+//          current = prior;
+//      }
+//  }
+//..
+// Finally, a reporting thread periodically reads the (approximate, while
+// workers are running) totals:
+//..
+//  ServiceStatistics stats;
+//
+//  recordMessage(&stats, 100);
+//  recordMessage(&stats, 250);
+//
+//  assert(  2 == stats.d_numMessages.value());
+//  assert(350 == stats.d_numBytes.value());
+//  assert(250 == stats.d_maxMessageSize.object().load());
+//..
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // =====================
+                           // class CacheLinePadded
+                           // =====================
+
+template <class TYPE>
+class CacheLinePadded {
+    // This class template holds an object of the parameterized 'TYPE' that is
+    // padded on both sides such that no other object can share a cache line
+    // with the held object, regardless of the address of this wrapper.  The
+    // behavior is undefined unless the alignment of 'TYPE' does not exceed
+    // 'BSLS_PLATFORM_CACHE_LINE_SIZE'.
+
+    // PRIVATE TYPES
+    enum {
+        // The held object starts at an offset that is a multiple of its
+        // alignment, so at most 'CACHE_LINE_SIZE - ALIGNMENT' bytes of the
+        // cache line containing its first byte precede it; the same bound
+        // applies to the bytes following its last byte.
+
+        ALIGNMENT    = AlignmentFromType<TYPE>::VALUE,
+        PADDING_SIZE = BSLS_PLATFORM_CACHE_LINE_SIZE - ALIGNMENT > 0
+                     ? BSLS_PLATFORM_CACHE_LINE_SIZE - ALIGNMENT
+                     : 1
+    };
+
+    // DATA
+    char d_leadingPad[PADDING_SIZE];   // unused padding
+    TYPE d_object;                     // held object
+    char d_trailingPad[PADDING_SIZE];  // unused padding
+
+  private:
+    // NOT IMPLEMENTED
+    CacheLinePadded(const CacheLinePadded&);             // = delete
+    CacheLinePadded& operator=(const CacheLinePadded&);  // = delete
+
+  public:
+    // CREATORS
+    CacheLinePadded();
+        // Create a wrapper holding a default-constructed 'TYPE' object.
+
+    template <class INIT_TYPE>
+    explicit CacheLinePadded(const INIT_TYPE& initialValue);
+        // Create a wrapper holding a 'TYPE' object constructed from the
+        // specified 'initialValue'.
+
+    //! ~CacheLinePadded() = default;
+        // Destroy this object and the held 'TYPE' object.
+
+    // MANIPULATORS
+    TYPE& object();
+        // Return a reference providing modifiable access to the held object.
+
+    TYPE *operator->();
+        // Return the address providing modifiable access to the held object.
+
+    // ACCESSORS
+    const TYPE& object() const;
+        // Return a reference providing non-modifiable access to the held
+        // object.
+
+    const TYPE *operator->() const;
+        // Return the address providing non-modifiable access to the held
+        // object.
+};
+
+                            // ====================
+                            // class ShardedCounter
+                            // ====================
+
+class ShardedCounter {
+    // This class implements a 64-bit integer counter that is safe to update
+    // concurrently from multiple threads, and whose updates are spread across
+    // 'NUM_SHARDS' cache-line-aligned atomic slots to avoid contention.  The
+    // value of the counter is the sum of its slots.  All operations use
+    // relaxed memory ordering.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        NUM_SHARDS = 16  // number of independently-updated slots (a power of
+                         // two)
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef AtomicOperations::AtomicTypes::Int64 Slot;
+
+    enum {
+        CACHE_LINE_SIZE = BSLS_PLATFORM_CACHE_LINE_SIZE,
+
+        // One extra cache line allows the slots to be aligned to a cache line
+        // boundary anywhere within the buffer.
+
+        BUFFER_SIZE     = (NUM_SHARDS + 1) * CACHE_LINE_SIZE
+    };
+
+    // DATA
+    char  d_buffer[BUFFER_SIZE];  // storage for the slots
+    char *d_slots_p;              // first cache-line-aligned address in
+                                  // 'd_buffer'
+
+    // PRIVATE CLASS METHODS
+    static int currentShardIndex();
+        // Return the index, in the range '[0 .. NUM_SHARDS)', of the slot
+        // assigned to the calling thread.  Note that the value returned for a
+        // given thread never changes.
+
+    // PRIVATE MANIPULATORS
+    Slot *slot(int index);
+        // Return the address of the slot having the specified 'index'.
+
+    // PRIVATE ACCESSORS
+    const Slot *slot(int index) const;
+        // Return the address of the slot having the specified 'index'.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCounter(const ShardedCounter&);             // = delete
+    ShardedCounter& operator=(const ShardedCounter&);  // = delete
+
+  public:
+    // CREATORS
+    explicit ShardedCounter(Types::Int64 initialValue = 0);
+        // Create a counter having the optionally specified 'initialValue'.
+        // If 'initialValue' is not specified, the counter has the value 0.
+
+    //! ~ShardedCounter() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void add(Types::Int64 value);
+        // Atomically add the specified 'value' to the slot of this counter
+        // assigned to the calling thread, using relaxed memory ordering.
+
+    void increment();
+        // Atomically add 1 to the slot of this counter assigned to the calling
+        // thread, using relaxed memory ordering.
+
+    void reset(Types::Int64 value = 0);
+        // Set the value of this counter to the optionally specified 'value'.
+        // If 'value' is not specified, set this counter to 0.  The behavior is
+        // undefined if this method is called concurrently with any other
+        // manipulator of this counter.
+
+    // ACCESSORS
+    Types::Int64 shardValue(int index) const;
+        // Return the current value of the slot of this counter having the
+        // specified 'index', using relaxed memory ordering.  The behavior is
+        // undefined unless '0 <= index < NUM_SHARDS'.
+
+    Types::Int64 value() const;
+        // Return the sum of the slots of this counter, each loaded using
+        // relaxed memory ordering.  Note that updates concurrent with this
+        // call may or may not be reflected in the result.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class CacheLinePadded
+                           // ---------------------
+
+// CREATORS
+template <class TYPE>
+inline
+CacheLinePadded<TYPE>::CacheLinePadded()
+: d_object()
+{
+}
+
+template <class TYPE>
+template <class INIT_TYPE>
+inline
+CacheLinePadded<TYPE>::CacheLinePadded(const INIT_TYPE& initialValue)
+: d_object(initialValue)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE& CacheLinePadded<TYPE>::object()
+{
+    return d_object;
+}
+
+template <class TYPE>
+inline
+TYPE *CacheLinePadded<TYPE>::operator->()
+{
+    return &d_object;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& CacheLinePadded<TYPE>::object() const
+{
+    return d_object;
+}
+
+template <class TYPE>
+inline
+const TYPE *CacheLinePadded<TYPE>::operator->() const
+{
+    return &d_object;
+}
+
+                            // --------------------
+                            // class ShardedCounter
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+inline
+ShardedCounter::Slot *ShardedCounter::slot(int index)
+{
+    return reinterpret_cast<Slot *>(d_slots_p + index * CACHE_LINE_SIZE);
+}
+
+// PRIVATE ACCESSORS
+inline
+const ShardedCounter::Slot *ShardedCounter::slot(int index) const
+{
+    return reinterpret_cast<const Slot *>(d_slots_p
+                                                   + index * CACHE_LINE_SIZE);
+}
+
+// MANIPULATORS
+inline
+void ShardedCounter::add(Types::Int64 value)
+{
+    AtomicOperations::addInt64Relaxed(slot(currentShardIndex()), value);
+}
+
+inline
+void ShardedCounter::increment()
+{
+    AtomicOperations::addInt64Relaxed(slot(currentShardIndex()), 1);
+}
+
+// ACCESSORS
+inline
+Types::Int64 ShardedCounter::shardValue(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < NUM_SHARDS);
+
+    return AtomicOperations::getInt64Relaxed(slot(index));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
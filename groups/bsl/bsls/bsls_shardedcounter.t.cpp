@@ -0,0 +1,766 @@
+// bsls_shardedcounter.t.cpp                                          -*-C++-*-
+#include <bsls_shardedcounter.h>
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_atomic.h>         // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+#include <bsls_timeutil.h>       // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// This component provides a padding wrapper, 'bsls::CacheLinePadded', whose
+// only observable property (besides forwarding to the held object) is its
+// layout, and a mechanism, 'bsls::ShardedCounter', whose value is the sum of
+// its shards.  The layout of the wrapper is verified by computing the cache
+// lines spanned by adjacent objects.  The counter is verified first in a
+// single thread, where all updates land in a single shard, and then with many
+// concurrent threads, after which the summed value must be exact.
+// ----------------------------------------------------------------------------
+// 'CacheLinePadded' class:
+// [ 2] CacheLinePadded();
+// [ 2] CacheLinePadded(const INIT_TYPE& initialValue);
+// [ 2] TYPE& object();
+// [ 2] TYPE *operator->();
+// [ 2] const TYPE& object() const;
+// [ 2] const TYPE *operator->() const;
+//
+// 'ShardedCounter' class:
+// [ 3] ShardedCounter(Types::Int64 initialValue = 0);
+// [ 3] void add(Types::Int64 value);
+// [ 3] void increment();
+// [ 3] void reset(Types::Int64 value = 0);
+// [ 3] Types::Int64 shardValue(int index) const;
+// [ 3] Types::Int64 value() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: Concurrent updates are not lost.
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: scaling of counter increments with thread count
+
+// ============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::ShardedCounter Obj;
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+enum { LINE = BSLS_PLATFORM_CACHE_LINE_SIZE };
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+static
+UintPtr firstLine(const void *address)
+    // Return the index of the cache line containing the specified 'address'.
+{
+    return reinterpret_cast<UintPtr>(address) / LINE;
+}
+
+static
+UintPtr lastLine(const void *address, int size)
+    // Return the index of the cache line containing the last byte of the
+    // object of the specified 'size' at the specified 'address'.
+{
+    return (reinterpret_cast<UintPtr>(address) + size - 1) / LINE;
+}
+
+                                // ------
+                                // case 2
+                                // ------
+
+struct Big {
+    // A type larger than a cache line.
+
+    double d_data[LINE / sizeof(double) + 3];
+};
+
+                                // ------
+                                // case 4
+                                // ------
+
+struct IncrementArgs {
+    Obj             *d_counter_p;
+    int              d_iterations;
+    bsls::AtomicInt *d_go_p;
+};
+
+extern "C" void *incrementCounter(void *arg)
+{
+    IncrementArgs *args = static_cast<IncrementArgs *>(arg);
+
+    while (0 == args->d_go_p->load()) {
+        ;
+    }
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        if (i & 1) {
+            args->d_counter_p->add(2);
+        }
+        else {
+            args->d_counter_p->increment();
+        }
+    }
+    return 0;
+}
+
+                                // -------
+                                // case -1
+                                // -------
+
+enum { MAX_THREADS = 64 };
+
+enum CounterKind {
+    SHARED_ATOMIC,    // one 'AtomicInt64' incremented by all threads
+    ADJACENT_ATOMIC,  // one 'AtomicInt64' per thread, packed in an array
+    PADDED_ATOMIC,    // one 'CacheLinePadded<AtomicInt64>' per thread
+    SHARDED_COUNTER   // one 'ShardedCounter' incremented by all threads
+};
+
+struct BenchmarkData {
+    bsls::AtomicInt64                         d_shared;
+    bsls::AtomicInt64                         d_adjacent[MAX_THREADS];
+    bsls::CacheLinePadded<bsls::AtomicInt64>  d_padded[MAX_THREADS];
+    Obj                                       d_sharded;
+};
+
+struct BenchmarkArgs {
+    BenchmarkData   *d_data_p;
+    CounterKind      d_kind;
+    int              d_threadIndex;
+    int              d_iterations;
+    bsls::AtomicInt *d_go_p;
+};
+
+extern "C" void *benchmarkThread(void *arg)
+{
+    BenchmarkArgs *args = static_cast<BenchmarkArgs *>(arg);
+    BenchmarkData *data = args->d_data_p;
+
+    while (0 == args->d_go_p->load()) {
+        ;
+    }
+
+    const int n = args->d_iterations;
+    switch (args->d_kind) {
+      case SHARED_ATOMIC: {
+        for (int i = 0; i < n; ++i) {
+            data->d_shared.addRelaxed(1);
+        }
+      } break;
+      case ADJACENT_ATOMIC: {
+        bsls::AtomicInt64& counter = data->d_adjacent[args->d_threadIndex];
+        for (int i = 0; i < n; ++i) {
+            counter.addRelaxed(1);
+        }
+      } break;
+      case PADDED_ATOMIC: {
+        bsls::AtomicInt64& counter =
+                                 data->d_padded[args->d_threadIndex].object();
+        for (int i = 0; i < n; ++i) {
+            counter.addRelaxed(1);
+        }
+      } break;
+      case SHARDED_COUNTER: {
+        for (int i = 0; i < n; ++i) {
+            data->d_sharded.increment();
+        }
+      } break;
+    }
+    return 0;
+}
+
+static
+double runBenchmark(BenchmarkData *data,
+                    CounterKind    kind,
+                    int            numThreads,
+                    int            iterations)
+    // Run the specified 'numThreads' threads, each performing the specified
+    // 'iterations' increments of the counter(s) of the specified 'kind' in the
+    // specified 'data', and return the wall time per increment per thread in
+    // nanoseconds.
+{
+    bsls::AtomicInt go(0);
+    BenchmarkArgs   args[MAX_THREADS];
+    ThreadId        ids[MAX_THREADS];
+
+    for (int t = 0; t < numThreads; ++t) {
+        args[t].d_data_p      = data;
+        args[t].d_kind        = kind;
+        args[t].d_threadIndex = t;
+        args[t].d_iterations  = iterations;
+        args[t].d_go_p        = &go;
+        ids[t] = createThread(&benchmarkThread, &args[t]);
+    }
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    go = 1;
+    for (int t = 0; t < numThreads; ++t) {
+        joinThread(ids[t]);
+    }
+    const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(elapsed) / iterations;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Per-Service Message Statistics
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service maintains statistics that are updated by every
+// worker thread for every message processed.  First, we define a 'struct'
+// holding those statistics, using 'bsls::ShardedCounter' for the counters
+// that every thread increments, and 'bsls::CacheLinePadded' for a value that
+// is updated less often but that must not share a cache line with its
+// neighbors:
+//..
+    struct ServiceStatistics {
+        // This 'struct' holds the statistics of a message-processing service.
+
+        bsls::ShardedCounter                       d_numMessages;
+        bsls::ShardedCounter                       d_numBytes;
+        bsls::CacheLinePadded<bsls::AtomicInt64>   d_maxMessageSize;
+    };
+//..
+// Then, we define a function, invoked by each worker thread for each message,
+// that updates the statistics:
+//..
+    void recordMessage(ServiceStatistics *stats, int messageSize)
+        // Update the specified 'stats' to reflect the processing of a message
+        // having the specified 'messageSize'.
+    {
+        stats->d_numMessages.increment();
+        stats->d_numBytes.add(messageSize);
+
+        bsls::AtomicInt64& maxSize = stats->d_maxMessageSize.object();
+        bsls::Types::Int64 current = maxSize.loadRelaxed();
+        while (messageSize > current) {
+            const bsls::Types::Int64 prior =
+                                        maxSize.testAndSwap(current,
+                                                            messageSize);
+            if (prior == current) {
+                break;
+            }
+            current = prior;
+        }
+    }
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Finally, a reporting thread periodically reads the (approximate, while
+// workers are running) totals:
+//..
+    ServiceStatistics stats;
+
+    recordMessage(&stats, 100);
+    recordMessage(&stats, 250);
+
+    ASSERT(  2 == stats.d_numMessages.value());
+    ASSERT(350 == stats.d_numBytes.value());
+    ASSERT(250 == stats.d_maxMessageSize.object().load());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 Increments performed concurrently by many threads, some of which
+        //:   map to the same shard, are not lost.
+        //
+        // Plan:
+        //: 1 For a range of thread counts, start that many threads, each of
+        //:   which alternately calls 'increment' and 'add(2)' a fixed number
+        //:   of times.  After joining the threads, verify that 'value'
+        //:   returns the expected total.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Concurrent updates are not lost.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT UPDATES"
+                            "\n==================\n");
+
+        enum { NUM_ITERATIONS = 100000 };
+
+        const int THREAD_COUNTS[] = { 1, 2, 4, 8, 17, 32 };
+        const int NUM_THREAD_COUNTS = sizeof THREAD_COUNTS
+                                    / sizeof *THREAD_COUNTS;
+
+        for (int ti = 0; ti < NUM_THREAD_COUNTS; ++ti) {
+            const int NUM_THREADS = THREAD_COUNTS[ti];
+
+            if (veryVerbose) { T_ P(NUM_THREADS) }
+
+            Obj             mX(7);  const Obj& X = mX;
+            bsls::AtomicInt go(0);
+            IncrementArgs   args[32];
+            ThreadId        ids[32];
+
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                args[t].d_counter_p  = &mX;
+                args[t].d_iterations = NUM_ITERATIONS;
+                args[t].d_go_p       = &go;
+                ids[t] = createThread(&incrementCounter, &args[t]);
+            }
+            go = 1;
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                joinThread(ids[t]);
+            }
+
+            const Int64 EXP = 7 + static_cast<Int64>(NUM_THREADS)
+                                * (NUM_ITERATIONS / 2) * 3;
+
+            LOOP3_ASSERT(NUM_THREADS, EXP, X.value(), EXP == X.value());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'ShardedCounter'
+        //
+        // Concerns:
+        //: 1 A default-constructed counter has value 0; a counter constructed
+        //:   with an initial value has that value.
+        //:
+        //: 2 'add' and 'increment' adjust the value by the supplied amount
+        //:   (including negative amounts) and 1, respectively.
+        //:
+        //: 3 All updates from a single thread are applied to the same shard,
+        //:   and 'value' is the sum of 'shardValue' over all shards.
+        //:
+        //: 4 'reset' sets the value to the supplied amount, or 0.
+        //:
+        //: 5 The shards reside in distinct cache lines that lie within the
+        //:   footprint of the object.
+        //:
+        //: 6 'shardValue' asserts on an out-of-range index.
+        //
+        // Plan:
+        //: 1 Create counters with and without an initial value and verify
+        //:   'value'.  (C-1)
+        //:
+        //: 2 Apply a sequence of 'add' and 'increment' calls, verifying
+        //:   'value' after each, and verify that exactly one shard (other
+        //:   than the one holding the initial value) is modified.  (C-2..3)
+        //:
+        //: 3 Call 'reset' with and without an argument.  (C-4)
+        //:
+        //: 4 Verify that the object is large enough to hold 'NUM_SHARDS'
+        //:   cache lines.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid shard indices.  (C-6)
+        //
+        // Testing:
+        //   ShardedCounter(Types::Int64 initialValue = 0);
+        //   void add(Types::Int64 value);
+        //   void increment();
+        //   void reset(Types::Int64 value = 0);
+        //   Types::Int64 shardValue(int index) const;
+        //   Types::Int64 value() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'ShardedCounter'"
+                            "\n================\n");
+
+        ASSERT(0 == (Obj::NUM_SHARDS & (Obj::NUM_SHARDS - 1)));
+        ASSERT(sizeof(Obj) >= static_cast<unsigned>(Obj::NUM_SHARDS * LINE));
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == X.value());
+            for (int i = 0; i < Obj::NUM_SHARDS; ++i) {
+                LOOP_ASSERT(i, 0 == X.shardValue(i));
+            }
+        }
+
+        {
+            Obj mX(-42);  const Obj& X = mX;
+            ASSERT(-42 == X.value());
+
+            mX.increment();
+            ASSERT(-41 == X.value());
+
+            mX.add(100);
+            ASSERT(59 == X.value());
+
+            mX.add(-9);
+            ASSERT(50 == X.value());
+
+            const Int64 BIG = static_cast<Int64>(1) << 40;
+            mX.add(BIG);
+            ASSERT(BIG + 50 == X.value());
+
+            Int64 sum         = 0;
+            int   numModified = 0;
+            for (int i = 0; i < Obj::NUM_SHARDS; ++i) {
+                sum += X.shardValue(i);
+                if (0 != i && 0 != X.shardValue(i)) {
+                    ++numModified;
+                }
+            }
+            ASSERT(X.value() == sum);
+            LOOP_ASSERT(numModified, numModified <= 1);
+
+            mX.reset(5);
+            ASSERT(5 == X.value());
+
+            mX.reset();
+            ASSERT(0 == X.value());
+            for (int i = 0; i < Obj::NUM_SHARDS; ++i) {
+                LOOP_ASSERT(i, 0 == X.shardValue(i));
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_SAFE_PASS(X.shardValue(0));
+            ASSERT_SAFE_PASS(X.shardValue(Obj::NUM_SHARDS - 1));
+            ASSERT_SAFE_FAIL(X.shardValue(-1));
+            ASSERT_SAFE_FAIL(X.shardValue(Obj::NUM_SHARDS));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'CacheLinePadded'
+        //
+        // Concerns:
+        //: 1 The held object is constructed from the supplied value, or
+        //:   value-initialized.
+        //:
+        //: 2 'object' and 'operator->' provide access to the same object.
+        //:
+        //: 3 The cache lines spanned by the held objects of adjacent wrappers
+        //:   (e.g., elements of an array) are disjoint, irrespective of the
+        //:   alignment of the array, and for held objects smaller and larger
+        //:   than a cache line.
+        //
+        // Plan:
+        //: 1 Construct wrappers with and without an initial value and verify
+        //:   the held value through both accessors.  (C-1..2)
+        //:
+        //: 2 Create arrays of wrappers of 'char', 'AtomicInt64', and a type
+        //:   larger than a cache line, and verify that the last cache line
+        //:   spanned by each held object precedes the first cache line
+        //:   spanned by the next.  (C-3)
+        //
+        // Testing:
+        //   CacheLinePadded();
+        //   CacheLinePadded(const INIT_TYPE& initialValue);
+        //   TYPE& object();
+        //   TYPE *operator->();
+        //   const TYPE& object() const;
+        //   const TYPE *operator->() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'CacheLinePadded'"
+                            "\n=================\n");
+
+        {
+            bsls::CacheLinePadded<int> mX;
+            const bsls::CacheLinePadded<int>& X = mX;
+            ASSERT(0 == X.object());
+
+            mX.object() = 5;
+            ASSERT(5 == X.object());
+            ASSERT(&X.object() == X.operator->());
+            ASSERT(&mX.object() == mX.operator->());
+        }
+        {
+            bsls::CacheLinePadded<bsls::AtomicInt64> mX(17);
+            const bsls::CacheLinePadded<bsls::AtomicInt64>& X = mX;
+            ASSERT(17 == X->load());
+
+            mX->add(3);
+            ASSERT(20 == X.object().load());
+        }
+
+        {
+            bsls::CacheLinePadded<char> a[4];
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, lastLine(&a[i].object(), 1)
+                                             < firstLine(&a[i + 1].object()));
+            }
+        }
+        {
+            bsls::CacheLinePadded<bsls::AtomicInt64> a[4];
+            const int SIZE = sizeof(bsls::AtomicInt64);
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, lastLine(&a[i].object(), SIZE)
+                                             < firstLine(&a[i + 1].object()));
+            }
+            if (veryVerbose) {
+                printf("\tsizeof(CacheLinePadded<AtomicInt64>) = %d\n",
+                       static_cast<int>(sizeof a[0]));
+            }
+        }
+        {
+            bsls::CacheLinePadded<Big> a[4];
+            const int SIZE = sizeof(Big);
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, lastLine(&a[i].object(), SIZE)
+                                             < firstLine(&a[i + 1].object()));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a padded atomic and a sharded counter, update them, and
+        //:   verify their values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bsls::CacheLinePadded<bsls::AtomicInt64> padded;
+        padded->addRelaxed(3);
+        ASSERT(3 == padded->load());
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.value());
+
+        for (int i = 0; i < 10; ++i) {
+            mX.increment();
+        }
+        ASSERT(10 == X.value());
+
+        mX.add(-10);
+        ASSERT(0 == X.value());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SCALING WITH THREAD COUNT
+        //
+        // Concerns:
+        //: 1 Increments of a 'ShardedCounter' and of per-thread
+        //:   'CacheLinePadded' atomics scale with the number of threads,
+        //:   whereas increments of a shared atomic, or of per-thread atomics
+        //:   packed into the same cache lines, do not.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 64 threads, measure the wall time per
+        //:   increment per thread for each of the four counter arrangements,
+        //:   and print the results as a table.  The number of increments per
+        //:   thread may be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: scaling of counter increments with thread count
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: SCALING WITH THREAD COUNT"
+                            "\n======================================\n");
+
+        const int ITERATIONS = verbose ? atoi(argv[2]) : 1000000;
+
+        BenchmarkData *data = new BenchmarkData;
+
+        printf("%8s %14s %14s %14s %14s\n",
+               "threads", "shared", "adjacent", "padded", "sharded");
+        printf("%8s %14s %14s %14s %14s\n",
+               "", "(ns/op)", "(ns/op)", "(ns/op)", "(ns/op)");
+
+        for (int numThreads = 1; numThreads <= MAX_THREADS; numThreads *= 2) {
+            const double shared   = runBenchmark(data,
+                                                 SHARED_ATOMIC,
+                                                 numThreads,
+                                                 ITERATIONS);
+            const double adjacent = runBenchmark(data,
+                                                 ADJACENT_ATOMIC,
+                                                 numThreads,
+                                                 ITERATIONS);
+            const double padded   = runBenchmark(data,
+                                                 PADDED_ATOMIC,
+                                                 numThreads,
+                                                 ITERATIONS);
+            const double sharded  = runBenchmark(data,
+                                                 SHARDED_COUNTER,
+                                                 numThreads,
+                                                 ITERATIONS);
+
+            printf("%8d %14.2f %14.2f %14.2f %14.2f\n",
+                   numThreads, shared, adjacent, padded, sharded);
+        }
+
+        delete data;
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
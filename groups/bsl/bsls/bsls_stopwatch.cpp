@@ -25,7 +25,9 @@ void Stopwatch::updateTimes()
     Types::Int64 userTime;
     TimeUtil::OpaqueNativeTime wallTime;
     accumulatedTimesRaw(&systemTime, &userTime, &wallTime);
+    const Types::Int64 threadCpuTime = TimeUtil::getThreadCpuTimer();
 
+    d_accumulatedThreadCpuTime += threadCpuTime - d_startThreadCpuTime;
     d_accumulatedSystemTime += systemTime - d_startSystemTime;
     d_accumulatedUserTime   += userTime   - d_startUserTime;
     d_accumulatedWallTime   += elapsedWallTime(wallTime);
@@ -12,12 +12,26 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bsls::Stopwatch: accumulates user, system, wall times of current process
 //
+//@SEE_ALSO: bsls_regionprofiler
+//
 //@DESCRIPTION: This component provides a class, 'bsls::Stopwatch', that
 // implements real-time (system clock) interval timers for the system, user,
 // and wall times of the current process.  A 'bsls::Stopwatch' object can
 // accumulate the above values from multiple runs and always presents only the
 // final total (zero if never started or reset to the initial state).
 //
+///Thread CPU Time
+///---------------
+// The system and user times accumulated by a stopwatch are those of the whole
+// process, and so, in a multi-threaded program, include the CPU time consumed
+// by every thread.  When CPU times are collected (see 'start'), a stopwatch
+// also accumulates the CPU time consumed by the *calling* thread (as given by
+// 'bsls::TimeUtil::getThreadCpuTimer'), which is available from the
+// 'accumulatedThreadCpuTime' accessor.  The thread CPU time is meaningful only
+// if the stopwatch is started, stopped, and (while running) queried from the
+// same thread.  See 'bsls_regionprofiler' for attributing time to nested,
+// named regions of code on a per-thread basis.
+//
 ///Accuracy and Precision
 ///----------------------
 // A 'bsls::Stopwatch' object returns its elapsed time intervals in seconds as
@@ -99,11 +113,12 @@ namespace bsls {
 class Stopwatch {
     // The 'class' provides an accumulator for the system, user, and wall times
     // of the current process.  A stopwatch can be in either the STOPPED
-    // (initial) state or the RUNNING state.  It potentially tracks three
-    // values: the accumulated system time, the accumulated user time, and the
-    // accumulated wall time (all in seconds and all initially set to zero).
-    // Whether or not system and user times are accumulated is conditional on
-    // how the stopwatch is started (see the 'start' method).  While in the
+    // (initial) state or the RUNNING state.  It potentially tracks four
+    // values: the accumulated system time, the accumulated user time, the
+    // accumulated CPU time of the starting thread, and the accumulated wall
+    // time (all in seconds and all initially set to zero).  Whether or not
+    // the CPU times (system, user, and thread) are accumulated is conditional
+    // on how the stopwatch is started (see the 'start' method).  While in the
     // RUNNING state, a stopwatch accumulates the above values and it retains
     // the values if put into the STOPPED state (unless 'reset' is called).
     // The accumulated times can be accessed at any time and in either state
@@ -129,6 +144,14 @@ class Stopwatch {
     Types::Int64 d_accumulatedWallTime;    // accumulated wall time
                                            // (nanoseconds)
 
+    Types::Int64 d_startThreadCpuTime;     // CPU time of the starting
+                                           // thread when started
+                                           // (nanoseconds)
+
+    Types::Int64 d_accumulatedThreadCpuTime;
+                                           // accumulated CPU time of the
+                                           // starting thread (nanoseconds)
+
     bool         d_isRunning;              // state flag ('true' if
                                            // RUNNING, 'false' if STOPPED)
 
@@ -181,12 +204,13 @@ class Stopwatch {
     void start(bool collectCpuTimes = false);
         // Place this stopwatch in the RUNNING state and begin accumulating
         // elapsed times if this object was in the STOPPED state.  Optionally
-        // specify a 'collectCpuTimes' flag indicating whether CPU times should
-        // be collected.  If 'collectCpuTimes' is not specified, then CPU times
-        // are *not* collected.  Note that the instantaneous total elapsed
-        // times are available from the RUNNING state.  Also note that
-        // disabling collection of CPU times will result in fewer systems calls
-        // and faster measurements.
+        // specify a 'collectCpuTimes' flag indicating whether CPU times (the
+        // system and user times of the process, and the CPU time of the
+        // calling thread) should be collected.  If 'collectCpuTimes' is not
+        // specified, then CPU times are *not* collected.  Note that the
+        // instantaneous total elapsed times are available from the RUNNING
+        // state.  Also note that disabling collection of CPU times will result
+        // in fewer systems calls and faster measurements.
 
     void stop();
         // Place this stopwatch in the STOPPED state, unconditionally stopping
@@ -208,6 +232,13 @@ class Stopwatch {
         // this method attempts to retrieve all of the values at the same time
         // (atomically), if the underlying platform supports it.
 
+    double accumulatedThreadCpuTime() const;
+        // Return the total (instantaneous and quiescent) CPU time (in seconds)
+        // consumed by the thread that started this stopwatch while it was
+        // running, or 0 if the collection of CPU times is disabled.  The
+        // result is meaningful only if this stopwatch is started, stopped,
+        // and (if running) queried from the same thread.
+
     double accumulatedUserTime() const;
         // Return the total (instantaneous and quiescent) elapsed user time (in
         // seconds) accumulated by this stopwatch, or 0 if the collection of
@@ -260,6 +291,8 @@ Stopwatch::Stopwatch()
 : d_accumulatedSystemTime(0)
 , d_accumulatedUserTime(0)
 , d_accumulatedWallTime(0)
+, d_startThreadCpuTime(0)
+, d_accumulatedThreadCpuTime(0)
 , d_isRunning(false)
 , d_collectCpuTimesFlag(false)
 {
@@ -270,10 +303,11 @@ Stopwatch::Stopwatch()
 inline
 void Stopwatch::reset()
 {
-    d_isRunning             = false;
-    d_accumulatedSystemTime = 0;
-    d_accumulatedUserTime   = 0;
-    d_accumulatedWallTime   = 0;
+    d_isRunning                = false;
+    d_accumulatedSystemTime    = 0;
+    d_accumulatedUserTime      = 0;
+    d_accumulatedWallTime      = 0;
+    d_accumulatedThreadCpuTime = 0;
 }
 
 inline
@@ -282,6 +316,7 @@ void Stopwatch::start(bool collectCpuTimes)
     if (!d_isRunning) {
         d_collectCpuTimesFlag = collectCpuTimes;
         if (d_collectCpuTimesFlag) {
+            d_startThreadCpuTime = TimeUtil::getThreadCpuTimer();
             accumulatedTimesRaw(&d_startSystemTime,
                                 &d_startUserTime,
                                 &d_startWallTime);
@@ -326,6 +361,22 @@ double Stopwatch::accumulatedSystemTime() const
     return (double)d_accumulatedSystemTime / s_nanosecondsPerSecond;
 }
 
+inline
+double Stopwatch::accumulatedThreadCpuTime() const
+{
+    if (!d_collectCpuTimesFlag) {
+        return 0.0;                                                   // RETURN
+    }
+
+    if (d_isRunning) {
+        return (double)(d_accumulatedThreadCpuTime
+                      + TimeUtil::getThreadCpuTimer() - d_startThreadCpuTime)
+                                                      / s_nanosecondsPerSecond;
+                                                                      // RETURN
+    }
+    return (double)d_accumulatedThreadCpuTime / s_nanosecondsPerSecond;
+}
+
 inline
 double Stopwatch::accumulatedUserTime() const
 {
@@ -41,13 +41,15 @@ using namespace BloombergLP;
 // [ 4] double accumulatedSystemTime() const;
 // [ 4] double accumulatedUserTime() const;
 // [ 4] double accumulatedWallTime() const;
+// [ 4] double accumulatedThreadCpuTime() const;
 // [ 5] void accumulatedTimes(double*, double*, double*) const;
 // [ 4] double elapsedTime() const;
 //-----------------------------------------------------------------------------
 // [ 1] Breathing Test
 // [ 2] State Transitions
-// [ 7] USAGE Example
+// [ 8] USAGE Example
 // [ 6] Reproduce bug from test case 
+// [ 7] Thread CPU Time Collection
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -214,6 +216,11 @@ static inline Int64 delaySystem(double delayTime)
     return delay(delayTime, &TU::getProcessSystemTimer, &osSystemCall);
 }
 
+static inline Int64 delayThreadCpu(double delayTime)
+{
+    return delay(delayTime, &TU::getThreadCpuTimer, &osUserCall);
+}
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -243,7 +250,10 @@ int main(int argc, char *argv[])
         { &Obj::accumulatedUserTime,   &delayUser,
                                                  "accumulatedUserTime"   },
         { &Obj::accumulatedWallTime,   &delayWall,
-                                                 "accumulatedWallTime"   }
+                                                 "accumulatedWallTime"   },
+        { &Obj::accumulatedThreadCpuTime,
+                                       &delayThreadCpu,
+                                                 "accumulatedThreadCpuTime" }
     };
 
     size_t const TimeMethodsCount =
@@ -252,7 +262,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -298,6 +308,77 @@ int main(int argc, char *argv[])
         const double t5u = s.accumulatedUserTime();    ASSERT(0.0 == t5u);
         const double t5w = s.accumulatedWallTime();    ASSERT(0.0 == t5w);
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD CPU TIME COLLECTION
+        //   Thread CPU time is collected only when the stopwatch is started
+        //   with 'collectCpuTimes' set, and never exceeds the CPU time
+        //   consumed by the whole process over the same interval.
+        //
+        // Concerns:
+        //: 1 'accumulatedThreadCpuTime' is 0 if the stopwatch was started
+        //:   without CPU time collection.
+        //:
+        //: 2 When collected, the thread CPU time is positive after busy work,
+        //:   and does not exceed the sum of the accumulated user and system
+        //:   times (plus the granularity of the process timers).
+        //:
+        //: 3 'reset' clears the accumulated thread CPU time.
+        //
+        // Plan:
+        //: 1 Start a stopwatch without collecting CPU times, consume CPU, and
+        //:   verify that the thread CPU time is 0.  (C-1)
+        //:
+        //: 2 Start a stopwatch collecting CPU times, consume CPU, and compare
+        //:   the thread CPU time with the process times.  (C-2)
+        //:
+        //: 3 Reset the stopwatch and verify the thread CPU time is 0.  (C-3)
+        //
+        // Testing:
+        //   double accumulatedThreadCpuTime() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING THREAD CPU TIME COLLECTION"
+                            "\n==================================\n");
+
+        const double TIME_STEP   = 0.10;
+        const double GRANULARITY = 0.02;  // process timers may use 'times'
+
+        {
+            Obj x;  const Obj& X = x;
+
+            x.start();
+            delayThreadCpu(TIME_STEP);
+            x.stop();
+
+            if (veryVerbose) { T_; P(X.accumulatedThreadCpuTime()); }
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+            ASSERT(0.0 == X.accumulatedUserTime());
+            ASSERT(0.0 <  X.accumulatedWallTime());
+        }
+
+        {
+            Obj x;  const Obj& X = x;
+
+            x.start(true);
+            delayThreadCpu(TIME_STEP);
+            x.stop();
+
+            const double threadCpu = X.accumulatedThreadCpuTime();
+            const double process   = X.accumulatedUserTime()
+                                   + X.accumulatedSystemTime();
+
+            if (veryVerbose) { T_; P_(threadCpu); P(process); }
+
+            ASSERTV(threadCpu, TIME_STEP <= threadCpu);
+            ASSERTV(threadCpu, process, threadCpu <= process + GRANULARITY);
+            ASSERTV(threadCpu, X.accumulatedWallTime(),
+                    threadCpu <= X.accumulatedWallTime() + GRANULARITY);
+
+            x.reset();
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // ATTEMPT TO REPRODUCE BUG PRODUCING NEGATIVE TIMES
@@ -439,6 +520,7 @@ int main(int argc, char *argv[])
         //   double accumulatedSystemTime() const;
         //   double accumulatedUserTime() const;
         //   double accumulatedWallTime() const;
+        //   double accumulatedThreadCpuTime() const;
         //
         //   Each of the above methods should return a plausible value when
         //   called from either the RUNNING or the STOPPED state.
@@ -453,6 +535,7 @@ int main(int argc, char *argv[])
         //   double accumulatedSystemTime() const;
         //   double accumulatedUserTime() const;
         //   double accumulatedWallTime() const;
+        //   double accumulatedThreadCpuTime() const;
         //   double elapsedTime() const;
         // --------------------------------------------------------------------
 
@@ -27,6 +27,11 @@ BSLS_IDENT("$Id$ $CSID$")
     #include <sys/time.h>  // gettimeofday()
 #endif
 
+#ifdef BSLS_TIMEUTIL_USE_CYCLE_COUNTER
+    #include <fcntl.h>     // open()
+    #include <sched.h>     // sched_yield()
+#endif
+
 namespace BloombergLP {
 
 namespace {
@@ -140,6 +145,323 @@ void UnixTimerUtil::processTimers(bsls::Types::Int64 *systemTimer,
 }
 #endif
 
+#ifdef BSLS_TIMEUTIL_USE_CYCLE_COUNTER
+struct CycleCounterUtil {
+    // Provides access to the x86-64 time-stamp counter (TSC), calibrated
+    // against 'CLOCK_MONOTONIC', with a fallback to 'CLOCK_MONOTONIC' itself
+    // if the TSC is not reliable on the current machine.
+
+  private:
+    // PRIVATE TYPES
+    enum State {
+        e_UNINITIALIZED = 0,  // no source has been selected yet
+        e_CALIBRATING   = 1,  // a thread is selecting the source
+        e_RDTSCP        = 2,  // read the TSC using 'rdtscp'
+        e_RDTSC         = 3,  // read the TSC using 'rdtsc'
+        e_CLOCK         = 4   // read 'CLOCK_MONOTONIC'
+    };
+
+    enum {
+        k_SCALE_SHIFT          = 24,        // fraction bits in
+                                            // 's_nanosecondsPerTick'
+
+        k_CALIBRATION_NSECS    = 10000000,  // duration of calibration
+
+        k_CALIBRATION_SAMPLES  = 5          // attempts per calibration point
+    };
+
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int   s_state;
+                                                // current 'State'
+
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_baseTicks;
+                                                // TSC value at the calibration
+                                                // end point
+
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_baseNanoseconds;
+                                                // 'CLOCK_MONOTONIC' time (in
+                                                // nanoseconds) at the
+                                                // calibration end point
+
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_nanosecondsPerTick;
+                                                // duration of one tick, in
+                                                // units of '2^-k_SCALE_SHIFT'
+                                                // nanoseconds
+
+    static const bsls::Types::Int64                   s_nsecsPerSecond;
+
+    // PRIVATE CLASS METHODS
+    static void cpuid(unsigned int  leaf,
+                      unsigned int *eax,
+                      unsigned int *ebx,
+                      unsigned int *ecx,
+                      unsigned int *edx);
+        // Load into the specified 'eax', 'ebx', 'ecx', and 'edx' the contents
+        // of the corresponding registers after executing the 'cpuid'
+        // instruction for the specified 'leaf'.
+
+    static bool kernelUsesTsc();
+        // Return 'true' if the kernel's current clocksource is the TSC, or if
+        // the clocksource cannot be determined, and 'false' otherwise.
+
+    static bsls::Types::Int64 monotonicNanoseconds();
+        // Return the current value of 'CLOCK_MONOTONIC' in nanoseconds.
+
+    static bsls::Types::Int64 readTsc();
+        // Return the current value of the TSC, read using 'rdtsc'.
+
+    static bsls::Types::Int64 readTscp();
+        // Return the current value of the TSC, read using 'rdtscp', which
+        // does not execute until all preceding instructions have executed.
+
+    static State selectSource();
+        // Select the source of the timer, calibrating the TSC if it is
+        // suitable, and return the selected state.  The behavior is undefined
+        // unless this method is invoked by at most one thread, at most once.
+
+    static void sample(bsls::Types::Int64 *ticks,
+                       bsls::Types::Int64 *nanoseconds);
+        // Load into the specified 'ticks' and 'nanoseconds' a pair of TSC and
+        // 'CLOCK_MONOTONIC' values taken at (nearly) the same instant.
+
+  public:
+    // CLASS METHODS
+    static void initialize();
+        // Ensure that the source of the timer has been selected and, if it is
+        // the TSC, calibrated.
+
+    static bsls::Types::Int64 getTimerRaw();
+        // Return a value representing the current time that must be
+        // converted by 'convertRawTime' to nanoseconds.
+
+    static bsls::Types::Int64 convertRawTime(bsls::Types::Int64 rawTime);
+        // Convert the specified 'rawTime' to a value in nanoseconds,
+        // referenced to an arbitrary but fixed origin, and return the result
+        // of the conversion.  The behavior is undefined unless 'rawTime' was
+        // obtained from 'getTimerRaw'.
+};
+
+bsls::AtomicOperations::AtomicTypes::Int
+                           CycleCounterUtil::s_state = { e_UNINITIALIZED };
+bsls::AtomicOperations::AtomicTypes::Int64
+                                  CycleCounterUtil::s_baseTicks          = {0};
+bsls::AtomicOperations::AtomicTypes::Int64
+                                  CycleCounterUtil::s_baseNanoseconds    = {0};
+bsls::AtomicOperations::AtomicTypes::Int64
+                                  CycleCounterUtil::s_nanosecondsPerTick = {0};
+const bsls::Types::Int64 CycleCounterUtil::s_nsecsPerSecond
+                                                          = 1000 * 1000 * 1000;
+
+inline
+void CycleCounterUtil::cpuid(unsigned int  leaf,
+                             unsigned int *eax,
+                             unsigned int *ebx,
+                             unsigned int *ecx,
+                             unsigned int *edx)
+{
+    asm volatile ("cpuid"
+                  : "=a" (*eax), "=b" (*ebx), "=c" (*ecx), "=d" (*edx)
+                  : "a" (leaf), "c" (0));
+}
+
+bool CycleCounterUtil::kernelUsesTsc()
+{
+    int fd = ::open("/sys/devices/system/clocksource/clocksource0/"
+                    "current_clocksource",
+                    O_RDONLY);
+    if (fd < 0) {
+        return true;                                                  // RETURN
+    }
+
+    char    buffer[16];
+    ssize_t length = ::read(fd, buffer, sizeof buffer);
+    ::close(fd);
+
+    return length >= 3
+        && 't' == buffer[0]
+        && 's' == buffer[1]
+        && 'c' == buffer[2]
+        && (3 == length || '\n' == buffer[3]);
+}
+
+inline
+bsls::Types::Int64 CycleCounterUtil::monotonicNanoseconds()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<bsls::Types::Int64>(ts.tv_sec) * s_nsecsPerSecond
+                                                                 + ts.tv_nsec;
+}
+
+inline
+bsls::Types::Int64 CycleCounterUtil::readTsc()
+{
+    unsigned int low, high;
+    asm volatile ("rdtsc" : "=a" (low), "=d" (high));
+    return static_cast<bsls::Types::Int64>(
+                   (static_cast<bsls::Types::Uint64>(high) << 32) | low);
+}
+
+inline
+bsls::Types::Int64 CycleCounterUtil::readTscp()
+{
+    unsigned int low, high;
+    asm volatile ("rdtscp" : "=a" (low), "=d" (high) : : "ecx");
+    return static_cast<bsls::Types::Int64>(
+                   (static_cast<bsls::Types::Uint64>(high) << 32) | low);
+}
+
+void CycleCounterUtil::sample(bsls::Types::Int64 *ticks,
+                              bsls::Types::Int64 *nanoseconds)
+{
+    // Bracket a read of the TSC between two reads of the clock, and keep the
+    // narrowest of several brackets, so that a preemption or interrupt
+    // between the reads does not skew the calibration.
+
+    bsls::Types::Int64 bestWidth = -1;
+
+    for (int i = 0; i < k_CALIBRATION_SAMPLES; ++i) {
+        const bsls::Types::Int64 before = monotonicNanoseconds();
+        const bsls::Types::Int64 tsc    = readTsc();
+        const bsls::Types::Int64 after  = monotonicNanoseconds();
+
+        if (bestWidth < 0 || after - before < bestWidth) {
+            bestWidth    = after - before;
+            *ticks       = tsc;
+            *nanoseconds = before + (after - before) / 2;
+        }
+    }
+}
+
+CycleCounterUtil::State CycleCounterUtil::selectSource()
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    cpuid(0x80000000U, &eax, &ebx, &ecx, &edx);
+    const unsigned int maxExtendedLeaf = eax;
+    if (maxExtendedLeaf < 0x80000007U) {
+        return e_CLOCK;                                               // RETURN
+    }
+
+    cpuid(0x80000007U, &eax, &ebx, &ecx, &edx);
+    if (0 == (edx & (1U << 8))) {  // invariant TSC
+        return e_CLOCK;                                               // RETURN
+    }
+
+    cpuid(0x80000001U, &eax, &ebx, &ecx, &edx);
+    const bool hasRdtscp = 0 != (edx & (1U << 27));
+
+    if (!kernelUsesTsc()) {
+        return e_CLOCK;                                               // RETURN
+    }
+
+    bsls::Types::Int64 startTicks, startNanoseconds;
+    sample(&startTicks, &startNanoseconds);
+
+    timespec delay = { 0, k_CALIBRATION_NSECS };
+    while (0 != nanosleep(&delay, &delay)) {
+        ;
+    }
+
+    bsls::Types::Int64 endTicks, endNanoseconds;
+    sample(&endTicks, &endNanoseconds);
+
+    const bsls::Types::Int64 elapsedTicks       = endTicks - startTicks;
+    const bsls::Types::Int64 elapsedNanoseconds = endNanoseconds
+                                                - startNanoseconds;
+
+    // Accept only frequencies between 100 MHz and 10 GHz; anything else
+    // indicates a counter that is not running as advertised.
+
+    if (elapsedNanoseconds < k_CALIBRATION_NSECS
+     || elapsedTicks < elapsedNanoseconds / 10
+     || elapsedTicks > elapsedNanoseconds * 10) {
+        return e_CLOCK;                                               // RETURN
+    }
+
+    bsls::AtomicOperations::setInt64Relaxed(&s_baseTicks, endTicks);
+    bsls::AtomicOperations::setInt64Relaxed(&s_baseNanoseconds,
+                                            endNanoseconds);
+    bsls::AtomicOperations::setInt64Relaxed(
+                   &s_nanosecondsPerTick,
+                   (elapsedNanoseconds << k_SCALE_SHIFT) / elapsedTicks);
+
+    return hasRdtscp ? e_RDTSCP : e_RDTSC;
+}
+
+void CycleCounterUtil::initialize()
+{
+    int state = bsls::AtomicOperations::getIntAcquire(&s_state);
+
+    if (e_UNINITIALIZED == state
+     && e_UNINITIALIZED == bsls::AtomicOperations::testAndSwapIntAcqRel(
+                                                             &s_state,
+                                                             e_UNINITIALIZED,
+                                                             e_CALIBRATING)) {
+        bsls::AtomicOperations::setIntRelease(&s_state, selectSource());
+        return;                                                       // RETURN
+    }
+
+    while (e_CALIBRATING == bsls::AtomicOperations::getIntAcquire(&s_state)) {
+        sched_yield();
+    }
+}
+
+inline
+bsls::Types::Int64 CycleCounterUtil::getTimerRaw()
+{
+    for (;;) {
+        switch (bsls::AtomicOperations::getIntAcquire(&s_state)) {
+          case e_RDTSCP: {
+            return readTscp();                                        // RETURN
+          }
+          case e_RDTSC: {
+            return readTsc();                                         // RETURN
+          }
+          case e_CLOCK: {
+            return monotonicNanoseconds();                            // RETURN
+          }
+          default: {
+            initialize();
+          }
+        }
+    }
+}
+
+inline
+bsls::Types::Int64 CycleCounterUtil::convertRawTime(
+                                                    bsls::Types::Int64 rawTime)
+{
+    if (e_CLOCK == bsls::AtomicOperations::getIntAcquire(&s_state)) {
+        return rawTime;                                               // RETURN
+    }
+
+    const bsls::Types::Int64 baseTicks =
+                     bsls::AtomicOperations::getInt64Relaxed(&s_baseTicks);
+    const bsls::Types::Int64 baseNanoseconds =
+               bsls::AtomicOperations::getInt64Relaxed(&s_baseNanoseconds);
+    const bsls::Types::Uint64 nanosecondsPerTick =
+             bsls::AtomicOperations::getInt64Relaxed(&s_nanosecondsPerTick);
+
+    // Scale the high and low 32 bits of the (absolute) distance from the base
+    // separately so that neither product can overflow: the scale factor has
+    // fewer than 32 significant bits for any accepted frequency.
+
+    const bool                negative = rawTime < baseTicks;
+    const bsls::Types::Uint64 delta    = negative ? baseTicks - rawTime
+                                                  : rawTime - baseTicks;
+    const bsls::Types::Uint64 high     = delta >> 32;
+    const bsls::Types::Uint64 low      = delta & 0xffffffffU;
+
+    const bsls::Types::Int64 nanoseconds = static_cast<bsls::Types::Int64>(
+                  ((high * nanosecondsPerTick) << (32 - k_SCALE_SHIFT))
+                + ((low  * nanosecondsPerTick) >> k_SCALE_SHIFT));
+
+    return negative ? baseNanoseconds - nanoseconds
+                    : baseNanoseconds + nanoseconds;
+}
+#endif
+
 #ifdef BSLS_PLATFORM_OS_WINDOWS
 struct WindowsTimerUtil {
     // Provides access to Windows process user and system timers.
@@ -206,6 +528,11 @@ struct WindowsTimerUtil {
         // user times as returned by GetProcessTimes() if the call succeeds,
         // and zero otherwise.
 
+    static bsls::Types::Int64 threadCpuTimer();
+        // Return converted to nanoseconds the sum of the current values of
+        // kernel (system) and user time of the calling thread as returned by
+        // GetThreadTimes() if the call succeeds, and zero otherwise.
+
     static bsls::Types::Int64 wallTimer();
         // Return converted to nanoseconds current value of wall time as per
         // Windows hardware timer, if available, uses ::ftime otherwise.
@@ -329,6 +656,29 @@ void WindowsTimerUtil::processTimers(bsls::Types::Int64 *systemTimer,
                                                               * s_nsecsPerUnit;
 }
 
+inline
+bsls::Types::Int64 WindowsTimerUtil::threadCpuTimer()
+{
+    FILETIME crtnTm, exitTm, krnlTm, userTm;
+
+    if (!::GetThreadTimes(::GetCurrentThread(),
+                          &crtnTm,
+                          &exitTm,
+                          &krnlTm,
+                          &userTm)) {
+        return 0;                                                     // RETURN
+    }
+
+    ULARGE_INTEGER sTimer, uTimer;
+    sTimer.LowPart  = krnlTm.dwLowDateTime;
+    sTimer.HighPart = krnlTm.dwHighDateTime;
+    uTimer.LowPart  = userTm.dwLowDateTime;
+    uTimer.HighPart = userTm.dwHighDateTime;
+
+    return static_cast<bsls::Types::Int64>(sTimer.QuadPart + uTimer.QuadPart)
+                                                              * s_nsecsPerUnit;
+}
+
 inline
 bsls::Types::Int64 WindowsTimerUtil::wallTimer()
 {
@@ -462,6 +812,9 @@ void TimeUtil::initialize()
 {
 #if defined BSLS_PLATFORM_OS_UNIX
     UnixTimerUtil::initialize();
+#if defined BSLS_TIMEUTIL_USE_CYCLE_COUNTER
+    CycleCounterUtil::initialize();
+#endif
 #elif defined BSLS_PLATFORM_OS_WINDOWS
     WindowsTimerUtil::initialize();
 #else
@@ -490,6 +843,10 @@ TimeUtil::convertRawTime(TimeUtil::OpaqueNativeTime rawTime)
 
     return rawTime.d_opaque;
 
+#elif defined BSLS_TIMEUTIL_USE_CYCLE_COUNTER
+
+    return CycleCounterUtil::convertRawTime(rawTime.d_opaque);
+
 #elif defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_CYGWIN)
 
     const Types::Int64 G = 1000000000;
@@ -592,6 +949,14 @@ void TimeUtil::getTimerRaw(TimeUtil::OpaqueNativeTime *timeValue)
     Types::Int64 t2 = (Types::Int64) gethrtime();
     timeValue->d_opaque = t2 > t1 ? t2 : t1;
 
+#elif defined BSLS_TIMEUTIL_USE_CYCLE_COUNTER
+
+    // Reading the time-stamp counter costs a few tens of cycles, compared to
+    // the figures for 'clock_gettime' below.  'CycleCounterUtil' falls back
+    // to 'CLOCK_MONOTONIC' on machines where the counter is not reliable.
+
+    timeValue->d_opaque = CycleCounterUtil::getTimerRaw();
+
 #elif defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_CYGWIN)
 
     // The call to 'clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts)' has never
@@ -642,6 +1007,36 @@ Types::Int64 TimeUtil::getProcessSystemTimer()
 #endif
 }
 
+Types::Int64 TimeUtil::getThreadCpuTimer()
+{
+#if defined BSLS_PLATFORM_OS_UNIX && defined CLOCK_THREAD_CPUTIME_ID
+
+    // 'CLOCK_THREAD_CPUTIME_ID' is not served from the vDSO on Linux, so each
+    // call is a system call (on the order of 100s of nanoseconds).
+
+    const Types::Int64 G = 1000000000;
+
+    timespec ts;
+    if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)) {
+        return 0;                                                     // RETURN
+    }
+    return static_cast<Types::Int64>(ts.tv_sec) * G + ts.tv_nsec;
+
+#elif defined BSLS_PLATFORM_OS_UNIX
+
+    Types::Int64 systemTimer, userTimer;
+    UnixTimerUtil::processTimers(&systemTimer, &userTimer);
+    return systemTimer + userTimer;
+
+#elif defined BSLS_PLATFORM_OS_WINDOWS
+
+    return WindowsTimerUtil::threadCpuTimer();
+
+#else
+    #error "Don't know how to get nanosecond time for this platform"
+#endif
+}
+
 Types::Int64 TimeUtil::getProcessUserTimer()
 {
 #if defined BSLS_PLATFORM_OS_UNIX
@@ -90,6 +90,33 @@ BSLS_IDENT("$Id: $")
 // expressed by the 'QueryPerformanceCounter' interface.  Note that the times
 // will still be monotonically non-decreasing. 
 //
+///Cycle Counter on Linux x86-64
+///------------------------------
+// On Linux x86-64 platforms (compiled with gcc or clang), 'getTimerRaw' reads
+// the processor's time-stamp counter (TSC) using the 'rdtscp' instruction (or
+// 'rdtsc' where 'rdtscp' is not available) instead of calling
+// 'clock_gettime', which makes taking a raw timestamp about as cheap as a
+// (non-inlined) function call; 'convertRawTime' then scales the counter value
+// to nanoseconds with integer multiply-and-shift arithmetic.  'getTimer' is
+// built on these two methods, and so benefits as well.
+//
+// The TSC is used only if the processor reports an *invariant* TSC (one that
+// ticks at a constant rate regardless of frequency scaling and sleep states)
+// and, where the kernel reports its current clocksource, only if the kernel
+// itself is using the TSC (i.e., it has verified that the counters of all
+// processors are synchronized).  The frequency of the counter is calibrated
+// against 'CLOCK_MONOTONIC' once per process, which takes about 10
+// milliseconds, by the first call to 'initialize' (or to any of the wall-time
+// methods, if 'initialize' has not been called).  If the TSC is unsuitable or
+// the calibration produces an implausible frequency, the timer falls back to
+// 'clock_gettime(CLOCK_MONOTONIC)'.  The choice is made once and does not
+// change for the life of the process, so raw values obtained at different
+// times are always comparable.
+//
+// Note that the calibrated frequency is accurate to a few parts per million;
+// interval measurements may therefore differ from 'CLOCK_MONOTONIC' by a
+// corresponding amount, which is well within the accuracy disclaimers above.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use 'bsls::TimeUtil'
@@ -196,6 +223,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 #endif
 
+#if defined(BSLS_PLATFORM_OS_LINUX)                                         \
+ && defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && defined(BSLS_PLATFORM_CMP_GNU)
+    #define BSLS_TIMEUTIL_USE_CYCLE_COUNTER 1
+        // The wall-time timer reads the processor's time-stamp counter, when
+        // it is reliable (see {Cycle Counter on Linux x86-64}).
+#endif
+
 #ifdef BSLS_PLATFORM_OS_UNIX
     #ifndef INCLUDED_TIME
     #include <time.h>
@@ -238,6 +273,8 @@ struct TimeUtil {
     typedef timebasestruct_t                  OpaqueNativeTime;
 #elif defined BSLS_PLATFORM_OS_HPUX
         typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
+#elif defined BSLS_TIMEUTIL_USE_CYCLE_COUNTER
+    typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
 #elif defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_CYGWIN)
         typedef timespec                          OpaqueNativeTime;
 #elif defined BSLS_PLATFORM_OS_UNIX
@@ -273,6 +310,14 @@ struct TimeUtil {
         // an arbitrary but fixed origin.  Note that this method is thread-safe
         // only if 'initialize' has been called before.
 
+    static Types::Int64 getThreadCpuTimer();
+        // Return the instantaneous value of a platform-dependent timer for the
+        // CPU time (user and system) consumed by the calling thread, in
+        // absolute nanoseconds referenced to an arbitrary but fixed origin.
+        // On platforms that provide no per-thread CPU clock, return the
+        // combined system and user time of the current process instead.  Note
+        // that values obtained by different threads are not comparable.
+
     static Types::Int64 getTimer();
         // Return the instantaneous value of a platform-dependent system timer
         // in absolute nanoseconds referenced to an arbitrary but fixed origin.
@@ -291,7 +336,10 @@ struct TimeUtil {
     static void initialize();
         // Do a platform-dependent initialization for the utilities.  Note that
         // only after a call to this method all the following methods are
-        // guaranteed to be thread-safe.
+        // guaranteed to be thread-safe.  Also note that, on platforms where
+        // the wall-time timer uses the processor's cycle counter, the first
+        // call to this method calibrates the counter, which takes about 10
+        // milliseconds; subsequent calls return immediately.
 };
 
 }  // close package namespace
@@ -51,10 +51,11 @@ using namespace BloombergLP;
 // [ 1] void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64);
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getTimer();
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
+// [ 1] bsls::Types::Int64 bsls::TimeUtil::getThreadCpuTimer();
 // [11] OpaqueNativeTime getTimerRaw();
 //-----------------------------------------------------------------------------
 // [XX] Breathing Test -- NOT IMPLEMENTED
-// [ 2] USAGE
+// [13] USAGE
 // [ 3] Performance Test
 // [ 4] Test for unique, monotonically increasing return values (statistical)
 // [ 5] Test correct hooking of methods to underlying OS APIs (approximately)
@@ -63,6 +64,8 @@ using namespace BloombergLP;
 // [ 8] Initialization test: getProcessUserTimer (UNIX only)
 // [ 9] Initialization test: getProcessTimers (UNIX only)
 // [10] Initialization test: getTimer (Windows only)
+// [12] Wall timer agrees with the OS monotonic clock (cycle counter)
+// [-1] Performance test: raw timer overhead
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -196,6 +199,42 @@ double my_Timer::elapsedSystemTime()
                                                  - d_startSystemTime) * 1.0E-9;
 }
 
+//=============================================================================
+//                         HELPER FUNCTIONS FOR CASE 12
+//-----------------------------------------------------------------------------
+
+static void osSleepMilliseconds(int milliseconds)
+    // Suspend the current thread for at least the specified 'milliseconds'.
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    timespec delay = { milliseconds / 1000, (milliseconds % 1000) * 1000000 };
+    while (0 != nanosleep(&delay, &delay)) {
+        ;
+    }
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    Sleep(milliseconds);
+#else
+    #error "Do not know how to sleep on this platform"
+#endif
+}
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+static Int64 monotonicClock()
+    // Return the current value of 'CLOCK_MONOTONIC' (or, where that clock is
+    // not available, of the real-time clock) in nanoseconds.
+{
+#if defined(CLOCK_MONOTONIC)
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Int64) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return ((Int64) tv.tv_sec * 1000000 + tv.tv_usec) * 1000;
+#endif
+}
+#endif
+
 //=============================================================================
 //                         HELPER FUNCTIONS FOR CASE 11
 //-----------------------------------------------------------------------------
@@ -497,7 +536,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header must build and
@@ -538,6 +577,151 @@ int main(int argc, char *argv[])
                        dTw, dTu, dTs);
         }
 
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING WALL TIMER AGAINST THE OS MONOTONIC CLOCK
+        //
+        // Concerns:
+        //: 1 Intervals measured with 'getTimer' (which, on Linux x86-64, reads
+        //:   the calibrated time-stamp counter) agree with intervals measured
+        //:   with the operating system's monotonic clock to within the
+        //:   accuracy of the calibration.
+        //:
+        //: 2 Intervals measured with 'getTimerRaw' and 'convertRawTime' agree
+        //:   with those measured with 'getTimer'.
+        //:
+        //: 3 When the cycle counter is used, 'convertRawTime' is linear and
+        //:   non-decreasing over the full range of raw values likely to be
+        //:   encountered, including values preceding the calibration point
+        //:   and differences that do not fit in 32 bits.
+        //
+        // Plan:
+        //: 1 Bracket a sleep of 200 milliseconds with both timers, and verify
+        //:   that the measured intervals differ by less than 0.1%, allowing
+        //:   for the time taken to read the clocks.  (C-1..2)
+        //:
+        //: 2 On platforms using the cycle counter, convert a table of raw
+        //:   values spread around a current raw value, and verify that the
+        //:   results are non-decreasing and that the conversion of a raw
+        //:   difference is (nearly) proportional to the difference.  (C-3)
+        //
+        // Testing:
+        //   Wall timer agrees with the OS monotonic clock (cycle counter)
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTesting wall timer against the OS clock"
+                            "\n=======================================\n");
+
+        TU::initialize();
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        {
+            const Int64 SLACK = 50 * 1000;  // 50 usec for reading clocks
+
+            const Int64 os1 = monotonicClock();
+            const Int64 wt1 = TU::getTimer();
+            TU::OpaqueNativeTime raw1;
+            TU::getTimerRaw(&raw1);
+
+            osSleepMilliseconds(200);
+
+            TU::OpaqueNativeTime raw2;
+            TU::getTimerRaw(&raw2);
+            const Int64 wt2 = TU::getTimer();
+            const Int64 os2 = monotonicClock();
+
+            const Int64 osElapsed  = os2 - os1;
+            const Int64 wtElapsed  = wt2 - wt1;
+            const Int64 rawElapsed = TU::convertRawTime(raw2)
+                                   - TU::convertRawTime(raw1);
+
+            if (veryVerbose) { P_(osElapsed) P_(wtElapsed) P(rawElapsed) }
+
+            LOOP2_ASSERT(osElapsed, wtElapsed, wtElapsed <= osElapsed);
+            LOOP2_ASSERT(osElapsed, wtElapsed,
+                         wtElapsed >= osElapsed - osElapsed / 1000 - SLACK);
+            LOOP2_ASSERT(wtElapsed, rawElapsed, rawElapsed <= wtElapsed);
+            LOOP2_ASSERT(wtElapsed, rawElapsed,
+                         rawElapsed >= wtElapsed - SLACK);
+        }
+#endif
+
+#ifdef BSLS_TIMEUTIL_USE_CYCLE_COUNTER
+        if (verbose) printf("\nTesting 'convertRawTime' arithmetic.\n");
+        {
+            TU::OpaqueNativeTime now;
+            TU::getTimerRaw(&now);
+
+            const Int64 ONE_DAY_OF_TICKS = 86400LL * 10 * 1000 * 1000 * 1000;
+                                          // at 10 GHz, the highest accepted
+                                          // frequency
+
+            const Int64 OFFSETS[] = {
+                -ONE_DAY_OF_TICKS,
+                -(1LL << 33) - 1,
+                -(1LL << 32),
+                -(1LL << 32) + 1,
+                -1000000,
+                -1,
+                0,
+                1,
+                1000,
+                1000000,
+                (1LL << 32) - 1,
+                (1LL << 32),
+                (1LL << 32) + 1,
+                (1LL << 33) + 12345,
+                ONE_DAY_OF_TICKS,
+            };
+            const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+            // Use a large reference interval, so that the rounding of its
+            // conversion does not affect the precision of the test.
+
+            const Int64 REF_TICKS = 1LL << 40;
+
+            TU::OpaqueNativeTime base = now;
+            TU::OpaqueNativeTime ref  = now;
+            ref.d_opaque += REF_TICKS;
+            const Int64 REF_NS = TU::convertRawTime(ref)
+                               - TU::convertRawTime(base);
+            if (veryVerbose) { T_ P(REF_NS) }
+            ASSERT(REF_TICKS / 10 <= REF_NS);  // 10 GHz
+            ASSERT(REF_TICKS * 10 >= REF_NS);  // 100 MHz
+
+            Int64 previous = 0;
+            for (int i = 0; i < NUM_OFFSETS; ++i) {
+                const Int64 OFFSET = OFFSETS[i];
+
+                TU::OpaqueNativeTime raw = now;
+                raw.d_opaque += OFFSET;
+
+                const Int64 ns      = TU::convertRawTime(raw);
+                const Int64 elapsed = ns - TU::convertRawTime(base);
+
+                // The conversion of 'OFFSET' ticks should be within one part
+                // in 10^6 (and a nanosecond of rounding) of the value
+                // extrapolated from the reference interval.
+
+                const double expected = (double) OFFSET * (double) REF_NS
+                                                          / (double) REF_TICKS;
+                const double error    = (double) elapsed - expected;
+                const double limit    = (expected < 0 ? -expected : expected)
+                                                                     * 1.0e-6
+                                      + 2.0;
+
+                if (veryVerbose) { T_ P_(OFFSET) P_(elapsed) P(error) }
+
+                LOOP3_ASSERT(OFFSET, elapsed, expected,
+                             error <= limit && error >= -limit);
+                if (i > 0) {
+                    LOOP2_ASSERT(OFFSET, ns, previous <= ns);
+                }
+                previous = ns;
+            }
+        }
+#endif
       } break;
       case 11: {
         // --------------------------------------------------------------------
@@ -1590,6 +1774,7 @@ int main(int argc, char *argv[])
         //   bsls::Types::Int64 bsls::TimeUtil::getTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
+        //   bsls::Types::Int64 bsls::TimeUtil::getThreadCpuTimer();
         //   void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64,
         //                                        bsls::Types::Int64);
         // --------------------------------------------------------------------
@@ -1604,6 +1789,7 @@ int main(int argc, char *argv[])
             { TU::getTimer,                 "getTimer",                true  },
             { TU::getProcessSystemTimer,    "getProcessSystemTimer",   false },
             { TU::getProcessUserTimer,      "getProcessUserTimer",     false },
+            { TU::getThreadCpuTimer,        "getThreadCpuTimer",       false },
             { callGetProcessTimersRetSystem,"getProcessTimers(system)",false },
             { callGetProcessTimersRetUser,  "getProcessTimers(user)",  false }
         };
@@ -1683,6 +1869,7 @@ int main(int argc, char *argv[])
         //   bsls::Types::Int64 bsls::TimeUtil::getTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
+        //   bsls::Types::Int64 bsls::TimeUtil::getThreadCpuTimer();
         //   void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64,
         //                                        bsls::Types::Int64);
         // --------------------------------------------------------------------
@@ -1695,6 +1882,7 @@ int main(int argc, char *argv[])
             { TU::getTimer,                  "getTimer"                 },
             { TU::getProcessSystemTimer,     "getProcessSystemTimer"    },
             { TU::getProcessUserTimer,       "getProcessUserTimer"      },
+            { TU::getThreadCpuTimer,         "getThreadCpuTimer"        },
             { callGetProcessTimersRetSystem, "getProcessTimers(system)" },
             { callGetProcessTimersRetUser,   "getProcessTimers(user)"   }
         };
@@ -1755,6 +1943,7 @@ int main(int argc, char *argv[])
         //   bsls::Types::Int64 bsls::TimeUtil::getTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
+        //   bsls::Types::Int64 bsls::TimeUtil::getThreadCpuTimer();
         //   void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64,
         //                                        bsls::Types::Int64);
         // --------------------------------------------------------------------
@@ -1767,6 +1956,7 @@ int main(int argc, char *argv[])
             { TU::getTimer,                  "getTimer"                 },
             { TU::getProcessSystemTimer,     "getProcessSystemTimer"    },
             { TU::getProcessUserTimer,       "getProcessUserTimer"      },
+            { TU::getThreadCpuTimer,         "getThreadCpuTimer"        },
             { callGetProcessTimersRetSystem, "getProcessTimers(system)" },
             { callGetProcessTimersRetUser,   "getProcessTimers(user)"   }
         };
@@ -1817,6 +2007,72 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: RAW TIMER OVERHEAD
+        //   Measure the cost of taking timestamps.
+        //
+        // Plan:
+        //   Time a large number of calls to 'getTimerRaw' alone, to
+        //   'getTimerRaw' followed by 'convertRawTime', and to 'getTimer',
+        //   and (on UNIX platforms) of direct reads of the OS monotonic clock
+        //   for comparison, and print the average cost of each.  The number of
+        //   calls (in millions) may be given as the second argument.
+        //
+        // Testing:
+        //   Performance test: raw timer overhead
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: RAW TIMER OVERHEAD"
+                            "\n====================================\n");
+
+        TU::initialize();
+
+        const int   MILLIONS  = verbose ? atoi(argv[2]) : 1;
+        const Int64 NUM_CALLS = 1000000LL * (MILLIONS > 0 ? MILLIONS : 1);
+
+        Int64 sink = 0;
+
+        Int64 t0 = TU::getTimer();
+        for (Int64 i = 0; i < NUM_CALLS; ++i) {
+            TU::OpaqueNativeTime raw;
+            TU::getTimerRaw(&raw);
+            sink += *(char *)&raw;
+        }
+        Int64 t1 = TU::getTimer();
+        printf("getTimerRaw:                %8.2f nsec/call\n",
+               (double) (t1 - t0) / (double) NUM_CALLS);
+
+        t0 = TU::getTimer();
+        for (Int64 i = 0; i < NUM_CALLS; ++i) {
+            TU::OpaqueNativeTime raw;
+            TU::getTimerRaw(&raw);
+            sink += TU::convertRawTime(raw);
+        }
+        t1 = TU::getTimer();
+        printf("getTimerRaw+convertRawTime: %8.2f nsec/call\n",
+               (double) (t1 - t0) / (double) NUM_CALLS);
+
+        t0 = TU::getTimer();
+        for (Int64 i = 0; i < NUM_CALLS; ++i) {
+            sink += TU::getTimer();
+        }
+        t1 = TU::getTimer();
+        printf("getTimer:                   %8.2f nsec/call\n",
+               (double) (t1 - t0) / (double) NUM_CALLS);
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        t0 = TU::getTimer();
+        for (Int64 i = 0; i < NUM_CALLS; ++i) {
+            sink += monotonicClock();
+        }
+        t1 = TU::getTimer();
+        printf("OS monotonic clock:         %8.2f nsec/call\n",
+               (double) (t1 - t0) / (double) NUM_CALLS);
+#endif
+
+        if (veryVeryVerbose) { P(sink) }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
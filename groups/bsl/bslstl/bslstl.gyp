@@ -1,13 +1,22 @@
 {
   'variables': {
     'bslstl_sources': [
+      'bslstl_addressablepriorityqueue.cpp',
       'bslstl_allocator.cpp',
       'bslstl_allocatortraits.cpp',
       'bslstl_bidirectionaliterator.cpp',
       'bslstl_bidirectionalnodepool.cpp',
       'bslstl_bitset.cpp',
+      'bslstl_btree.cpp',
+      'bslstl_btreemap.cpp',
+      'bslstl_btreeset.cpp',
+      'bslstl_chartraitsutil.cpp',
       'bslstl_deque.cpp',
       'bslstl_equalto.cpp',
+      'bslstl_flatmap.cpp',
+      'bslstl_flatmultimap.cpp',
+      'bslstl_flatset.cpp',
+      'bslstl_flattreeutil.cpp',
       'bslstl_forwarditerator.cpp',
       'bslstl_hash.cpp',
       'bslstl_hashtable.cpp',
@@ -27,17 +36,27 @@
       'bslstl_priorityqueue.cpp',
       'bslstl_queue.cpp',
       'bslstl_randomaccessiterator.cpp',
+      'bslstl_rankedmap.cpp',
+      'bslstl_rankedset.cpp',
+      'bslstl_rankedtree.cpp',
+      'bslstl_ringbuffer.cpp',
+      'bslstl_rope.cpp',
       'bslstl_set.cpp',
       'bslstl_setcomparator.cpp',
+      'bslstl_sharedstring.cpp',
       'bslstl_simplepool.cpp',
+      'bslstl_sortedtag.cpp',
       'bslstl_sstream.cpp',
       'bslstl_stack.cpp',
       'bslstl_stdexceptutil.cpp',
       'bslstl_string.cpp',
       'bslstl_stringbuf.cpp',
+      'bslstl_stringinterntable.cpp',
       'bslstl_stringref.cpp',
       'bslstl_stringrefdata.cpp',
+      'bslstl_stringsearchutil.cpp',
       'bslstl_stringstream.cpp',
+      'bslstl_timingwheel.cpp',
       'bslstl_treeiterator.cpp',
       'bslstl_treenode.cpp',
       'bslstl_treenodepool.cpp',
@@ -50,13 +69,22 @@
       'bslstl_vector.cpp',
     ],
     'bslstl_tests': [
+      'bslstl_addressablepriorityqueue.t',
       'bslstl_allocator.t',
       'bslstl_allocatortraits.t',
       'bslstl_bidirectionaliterator.t',
       'bslstl_bidirectionalnodepool.t',
       'bslstl_bitset.t',
+      'bslstl_btree.t',
+      'bslstl_btreemap.t',
+      'bslstl_btreeset.t',
+      'bslstl_chartraitsutil.t',
       'bslstl_deque.t',
       'bslstl_equalto.t',
+      'bslstl_flatmap.t',
+      'bslstl_flatmultimap.t',
+      'bslstl_flatset.t',
+      'bslstl_flattreeutil.t',
       'bslstl_forwarditerator.t',
       'bslstl_hash.t',
       'bslstl_hashtable.t',
@@ -76,17 +104,27 @@
       'bslstl_priorityqueue.t',
       'bslstl_queue.t',
       'bslstl_randomaccessiterator.t',
+      'bslstl_rankedmap.t',
+      'bslstl_rankedset.t',
+      'bslstl_rankedtree.t',
+      'bslstl_ringbuffer.t',
+      'bslstl_rope.t',
       'bslstl_set.t',
       'bslstl_setcomparator.t',
+      'bslstl_sharedstring.t',
       'bslstl_simplepool.t',
+      'bslstl_sortedtag.t',
       'bslstl_sstream.t',
       'bslstl_stack.t',
       'bslstl_stdexceptutil.t',
       'bslstl_string.t',
       'bslstl_stringbuf.t',
+      'bslstl_stringinterntable.t',
       'bslstl_stringref.t',
       'bslstl_stringrefdata.t',
+      'bslstl_stringsearchutil.t',
       'bslstl_stringstream.t',
+      'bslstl_timingwheel.t',
       'bslstl_treeiterator.t',
       'bslstl_treenode.t',
       'bslstl_treenodepool.t',
@@ -99,13 +137,22 @@
       'bslstl_vector.t',
     ],
     'bslstl_tests_paths': [
+      '<(PRODUCT_DIR)/bslstl_addressablepriorityqueue.t',
       '<(PRODUCT_DIR)/bslstl_allocator.t',
       '<(PRODUCT_DIR)/bslstl_allocatortraits.t',
       '<(PRODUCT_DIR)/bslstl_bidirectionaliterator.t',
       '<(PRODUCT_DIR)/bslstl_bidirectionalnodepool.t',
       '<(PRODUCT_DIR)/bslstl_bitset.t',
+      '<(PRODUCT_DIR)/bslstl_btree.t',
+      '<(PRODUCT_DIR)/bslstl_btreemap.t',
+      '<(PRODUCT_DIR)/bslstl_btreeset.t',
+      '<(PRODUCT_DIR)/bslstl_chartraitsutil.t',
       '<(PRODUCT_DIR)/bslstl_deque.t',
       '<(PRODUCT_DIR)/bslstl_equalto.t',
+      '<(PRODUCT_DIR)/bslstl_flatmap.t',
+      '<(PRODUCT_DIR)/bslstl_flatmultimap.t',
+      '<(PRODUCT_DIR)/bslstl_flatset.t',
+      '<(PRODUCT_DIR)/bslstl_flattreeutil.t',
       '<(PRODUCT_DIR)/bslstl_forwarditerator.t',
       '<(PRODUCT_DIR)/bslstl_hash.t',
       '<(PRODUCT_DIR)/bslstl_hashtable.t',
@@ -125,17 +172,27 @@
       '<(PRODUCT_DIR)/bslstl_priorityqueue.t',
       '<(PRODUCT_DIR)/bslstl_queue.t',
       '<(PRODUCT_DIR)/bslstl_randomaccessiterator.t',
+      '<(PRODUCT_DIR)/bslstl_rankedmap.t',
+      '<(PRODUCT_DIR)/bslstl_rankedset.t',
+      '<(PRODUCT_DIR)/bslstl_rankedtree.t',
+      '<(PRODUCT_DIR)/bslstl_ringbuffer.t',
+      '<(PRODUCT_DIR)/bslstl_rope.t',
       '<(PRODUCT_DIR)/bslstl_set.t',
       '<(PRODUCT_DIR)/bslstl_setcomparator.t',
+      '<(PRODUCT_DIR)/bslstl_sharedstring.t',
       '<(PRODUCT_DIR)/bslstl_simplepool.t',
+      '<(PRODUCT_DIR)/bslstl_sortedtag.t',
       '<(PRODUCT_DIR)/bslstl_sstream.t',
       '<(PRODUCT_DIR)/bslstl_stack.t',
       '<(PRODUCT_DIR)/bslstl_stdexceptutil.t',
       '<(PRODUCT_DIR)/bslstl_string.t',
       '<(PRODUCT_DIR)/bslstl_stringbuf.t',
+      '<(PRODUCT_DIR)/bslstl_stringinterntable.t',
       '<(PRODUCT_DIR)/bslstl_stringref.t',
       '<(PRODUCT_DIR)/bslstl_stringrefdata.t',
+      '<(PRODUCT_DIR)/bslstl_stringsearchutil.t',
       '<(PRODUCT_DIR)/bslstl_stringstream.t',
+      '<(PRODUCT_DIR)/bslstl_timingwheel.t',
       '<(PRODUCT_DIR)/bslstl_treeiterator.t',
       '<(PRODUCT_DIR)/bslstl_treenode.t',
       '<(PRODUCT_DIR)/bslstl_treenodepool.t',
@@ -204,6 +261,14 @@
       'xcode_settings': { 'LD_DYLIB_INSTALL_NAME': '' },
     },
 
+    {
+      'target_name': 'bslstl_addressablepriorityqueue.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_addressablepriorityqueue.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_allocator.t',
       'type': 'executable',
@@ -244,6 +309,38 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_bitset.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_btree.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_btree.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_btreemap.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_btreemap.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_btreeset.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_btreeset.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_chartraitsutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_chartraitsutil.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_deque.t',
       'type': 'executable',
@@ -260,6 +357,38 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_equalto.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_flatmap.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_flatmap.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_flatmultimap.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_flatmultimap.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_flatset.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_flatset.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_flattreeutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_flattreeutil.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_forwarditerator.t',
       'type': 'executable',
@@ -412,6 +541,46 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_randomaccessiterator.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_rankedmap.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_rankedmap.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_rankedset.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_rankedset.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_rankedtree.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_rankedtree.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_ringbuffer.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_ringbuffer.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_rope.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_rope.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_set.t',
       'type': 'executable',
@@ -428,6 +597,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_setcomparator.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_sharedstring.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_sharedstring.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_simplepool.t',
       'type': 'executable',
@@ -436,6 +613,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_simplepool.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_sortedtag.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_sortedtag.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_sstream.t',
       'type': 'executable',
@@ -476,6 +661,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_stringbuf.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_stringinterntable.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_stringinterntable.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_stringref.t',
       'type': 'executable',
@@ -492,6 +685,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_stringrefdata.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_stringsearchutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_stringsearchutil.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_stringstream.t',
       'type': 'executable',
@@ -500,6 +701,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_stringstream.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_timingwheel.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_timingwheel.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_treeiterator.t',
       'type': 'executable',
@@ -0,0 +1,957 @@
+// bslstl_addressablepriorityqueue.h                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_ADDRESSABLEPRIORITYQUEUE
+#define INCLUDED_BSLSTL_ADDRESSABLEPRIORITYQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a priority queue whose elements can be updated and erased.
+//
+//@CLASSES:
+//   bsl::addressable_priority_queue: priority queue addressed through handles
+//
+//@SEE_ALSO: bslstl_priorityqueue, bslalg_daryheaputil
+//
+//@DESCRIPTION: This component defines a class template,
+// 'addressable_priority_queue', implementing a priority queue that, like
+// 'bsl::priority_queue', presents its greatest element, according to a
+// comparator, at its top, and that, unlike 'bsl::priority_queue', returns a
+// *handle* for each element pushed, through which the value of the element
+// can later be accessed or changed, and the element erased, wherever it is in
+// the queue, in logarithmic time.
+//
+// An instantiation of 'addressable_priority_queue' is an allocator-aware type
+// that does not provide equality comparison: two queues holding the same
+// values may hold them in different orders, under different handles.
+//
+///Handles
+///-------
+// A handle, of type 'handle_type', identifies an element of a queue from the
+// 'push' that returned it until the element is removed from the queue, by
+// 'pop', 'erase', or 'clear'.  The handle may then be returned again, for
+// another element, by a later 'push': like an iterator to an erased element
+// of a container, a handle of an element removed from a queue must not be
+// used to access the queue, and 'contains' does not detect such use once the
+// handle has been reused.  The handles of a queue are the small integers
+// '[0 .. N)', where N is the greatest number of elements the queue has held
+// since it was created or last cleared, so that data associated with the
+// elements of a queue can be held in an array indexed by their handles.  A
+// copy of a queue holds the same elements under the same handles.
+//
+///Priority Queues With Cancellation
+///---------------------------------
+// A scheduler holding the deadlines of events in a 'bsl::priority_queue'
+// cannot remove the deadline of an event that is cancelled, or rescheduled,
+// before it is due: it must instead leave the stale deadline in the queue,
+// and discard it when it reaches the top ("lazy deletion"), so that the queue
+// holds (and each operation on the queue pays for) every deadline that has
+// been scheduled and is not yet due, whether or not it is still wanted.  An
+// 'addressable_priority_queue' holds only the wanted deadlines: 'erase'
+// removes a cancelled deadline at once, and 'update' moves a rescheduled
+// deadline to its new place, each in O[log(N)] time, where N is the number of
+// elements in the queue.  The benchmark in the test driver of this component
+// compares both approaches on such a workload.
+//
+// An 'addressable_priority_queue' holds its elements, each paired with its
+// handle, in a 4-ary heap (see 'bslalg_daryheaputil') held in a 'bsl::vector',
+// and, in a second 'bsl::vector' indexed by handle, the position of the
+// element having each handle in the heap, which the heap algorithms keep up
+// to date as they move elements.  The handles of removed elements are kept in
+// a list threaded through the second vector, from which they are reused.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as the 'ALLOCATOR' template parameter of a queue
+// determines how the queue allocates memory.  If the 'ALLOCATOR' is
+// 'bsl::allocator' (the default), then objects of the queue type conform to
+// the standard behavior of a 'bslma'-allocator-enabled type: the queue
+// accepts an optional 'bslma::Allocator' argument at construction, uses it to
+// supply memory for its two arrays, and supplies it to the constructors of
+// the elements it holds if 'VALUE' has the 'bslma::UsesBslmaAllocator' trait.
+// A queue does not return memory to its allocator before it is destroyed,
+// other than by 'swap' or assignment.
+//
+///Exception Safety
+///----------------
+// If an exception is thrown by the allocator or by the copy constructor of
+// 'VALUE' while an element is pushed, the queue is unchanged.  If an
+// exception is thrown by the assignment operator of 'VALUE' while the value of
+// an element is changed, that element has an unspecified value.  If an
+// exception is thrown by the comparator, the queue holds the same elements,
+// under the same handles, but may no longer present them in order.  Elements
+// are moved within the heap by copying their bytes if 'VALUE' is bitwise
+// moveable, and otherwise by 'swap', which must not throw for these
+// guarantees to hold.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'addressable_priority_queue':
+//..
+//  Legend
+//  ------
+//  'V'             - (template parameter) type 'VALUE' of the queue
+//  'a', 'b'        - two distinct objects of type
+//                    'addressable_priority_queue<V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'h'             - a handle of an element of 'a'
+//  'c'             - a comparator
+//  'al'            - an STL-style memory allocator
+//  'v'             - an object of type 'V'
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | addressable_priority_queue<V> a;                   | O[1]               |
+//  | addressable_priority_queue<V> a(al);               |                    |
+//  | addressable_priority_queue<V> a(c, al);            |                    |
+//  +----------------------------------------------------+--------------------+
+//  | addressable_priority_queue<V> a(b);                | O[m]               |
+//  | addressable_priority_queue<V> a(b, al);            |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~addressable_priority_queue<V>();                | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;               (assignment)                  | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.push(v)                                          | Amortized          |
+//  |                                                    | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.pop(), a.erase(h), a.update(h, v)                | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.decrease_key(h, v)                               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.top(), a.top_handle(), a.value(h), a.contains(h) | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty(), a.get_allocator(),            | O[1]               |
+//  | a.value_comp()                                     |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(n)                                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Expiring Orders
+/// - - - - - - - - - - - - -
+// Suppose that a trading gateway expires each resting order at a deadline,
+// and that orders are frequently cancelled, or have their deadlines amended,
+// before they expire.
+//
+// First, we define the type of the queue of deadlines, in milliseconds, the
+// earliest of which is at its top:
+//..
+//  typedef bsl::addressable_priority_queue<int, native_std::greater<int> >
+//                                                                 ExpiryQueue;
+//..
+// Then, we create a queue, and schedule the expiry of three orders, keeping
+// the handle of the deadline of each:
+//..
+//  bslma::TestAllocator allocator;
+//  ExpiryQueue          expiries(&allocator);
+//
+//  const ExpiryQueue::handle_type order1 = expiries.push(1000);
+//  const ExpiryQueue::handle_type order2 = expiries.push(500);
+//  const ExpiryQueue::handle_type order3 = expiries.push(2000);
+//
+//  assert(500    == expiries.top());
+//  assert(order2 == expiries.top_handle());
+//..
+// Next, the second order is cancelled, so that its deadline is removed at
+// once, rather than left in the queue until it is due:
+//..
+//  expiries.erase(order2);
+//
+//  assert(2      == expiries.size());
+//  assert(1000   == expiries.top());
+//  assert(order1 == expiries.top_handle());
+//..
+// Then, the deadline of the third order is brought forward, which moves it
+// towards the top of the queue, as 'decrease_key' requires, and the deadline
+// of the first is extended:
+//..
+//  expiries.decrease_key(order3, 800);
+//  expiries.update(order1, 3000);
+//
+//  assert(800    == expiries.value(order3));
+//  assert(3000   == expiries.value(order1));
+//  assert(order3 == expiries.top_handle());
+//..
+// Finally, when the time is 2500 milliseconds, we expire the orders that are
+// due:
+//..
+//  int numExpired = 0;
+//  while (!expiries.empty() && expiries.top() <= 2500) {
+//      assert(order3 == expiries.top_handle());
+//      expiries.pop();
+//      ++numExpired;
+//  }
+//  assert(1      == numExpired);
+//  assert(1      == expiries.size());
+//  assert(order1 == expiries.top_handle());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_DARYHEAPUTIL
+#include <bslalg_daryheaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>  // 'less'
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                // ==============================================
+                // class AddressablePriorityQueue_EntryComparator
+                // ==============================================
+
+template <class COMPARATOR>
+class AddressablePriorityQueue_EntryComparator {
+    // This class provides a comparator of the entries of an
+    // 'addressable_priority_queue', pairs of a value and a handle, that
+    // orders them by their values using a comparator of the (template
+    // parameter) type 'COMPARATOR'.
+
+    // DATA
+    COMPARATOR d_comparator;  // comparator of values
+
+  public:
+    // CREATORS
+    explicit AddressablePriorityQueue_EntryComparator(
+                                                const COMPARATOR& comparator);
+        // Create a comparator of entries using the specified 'comparator' to
+        // compare their values.
+
+    // MANIPULATORS
+    COMPARATOR& comparator();
+        // Return a reference providing modifiable access to the comparator of
+        // values used by this object.
+
+    // ACCESSORS
+    template <class ENTRY>
+    bool operator()(const ENTRY& lhs, const ENTRY& rhs) const;
+        // Return the result of comparing the values of the specified 'lhs'
+        // and 'rhs' entries.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // comparator of values used by this object.
+};
+
+                  // =======================================
+                  // class AddressablePriorityQueue_Observer
+                  // =======================================
+
+class AddressablePriorityQueue_Observer {
+    // This class provides an observer of the movement of the entries of an
+    // 'addressable_priority_queue' in its heap (see 'bslalg_daryheaputil')
+    // that records the position of each entry in an array indexed by the
+    // handle of the entry.
+
+    // DATA
+    native_std::size_t *d_positions_p;  // position of each entry, by handle
+
+  public:
+    // CREATORS
+    explicit AddressablePriorityQueue_Observer(native_std::size_t *positions);
+        // Create an observer recording positions in the specified
+        // 'positions' array.
+
+    // ACCESSORS
+    template <class ENTRY>
+    void operator()(const ENTRY& entry, native_std::size_t position) const;
+        // Record that the specified 'entry' is at the specified 'position'.
+};
+
+                      // ================================
+                      // class addressable_priority_queue
+                      // ================================
+
+template <class VALUE,
+          class COMPARATOR = native_std::less<VALUE>,
+          class ALLOCATOR  = bsl::allocator<VALUE> >
+class addressable_priority_queue {
+    // This class template implements a priority queue of elements of the
+    // (template parameter) type 'VALUE', ordered by a comparator of the
+    // (template parameter) type 'COMPARATOR', of which the greatest is at the
+    // top, and each of which is identified by a handle through which it can
+    // be updated or erased, using an allocator of the (template parameter)
+    // type 'ALLOCATOR' to supply memory.
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE              value_type;
+    typedef const VALUE&       const_reference;
+    typedef native_std::size_t size_type;
+    typedef native_std::size_t handle_type;
+    typedef COMPARATOR         value_compare;
+    typedef ALLOCATOR          allocator_type;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::pair<VALUE, handle_type>                    Entry;
+
+    typedef typename ALLOCATOR::template rebind<Entry>::other
+                                                             EntryAllocator;
+
+    typedef typename ALLOCATOR::template rebind<size_type>::other
+                                                             PositionAllocator;
+
+    typedef bsl::vector<Entry, EntryAllocator>               Heap;
+
+    typedef bsl::vector<size_type, PositionAllocator>        Positions;
+
+    typedef AddressablePriorityQueue_EntryComparator<COMPARATOR>
+                                                             EntryComparator;
+
+    typedef AddressablePriorityQueue_Observer                Observer;
+
+    typedef BloombergLP::bslalg::DAryHeapUtil<4>             HeapUtil;
+
+    // PRIVATE CLASS DATA
+    static const handle_type k_NO_HANDLE = ~handle_type(0);
+                                               // end of the list of free
+                                               // handles
+
+    // DATA
+    Heap            d_heap;        // entries, arranged as a 4-ary heap
+
+    Positions       d_positions;   // position in 'd_heap' of the entry having
+                                   // each handle, or, for a free handle, the
+                                   // next free handle, or 'k_NO_HANDLE'
+
+    handle_type     d_freeHandle;  // first free handle, or 'k_NO_HANDLE'
+
+    EntryComparator d_comparator;  // comparator of entries
+
+    // PRIVATE MANIPULATORS
+    void privateReleaseHandle(handle_type handle);
+        // Add the specified 'handle' to the list of free handles.
+
+    void privateSwap(addressable_priority_queue& other);
+        // Exchange the value of this object with that of the specified
+        // 'other' object, without exchanging their allocators.  The behavior
+        // is undefined unless this object and 'other' use the same allocator.
+
+  public:
+    // CREATORS
+    explicit addressable_priority_queue(
+                                    const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty queue ordering its elements with a
+        // default-constructed comparator.  Optionally specify an 'allocator'
+        // used to supply memory.  If 'allocator' is not specified, a
+        // default-constructed allocator is used.  Note that no memory is
+        // allocated.
+
+    explicit addressable_priority_queue(
+                                    const COMPARATOR& comparator,
+                                    const ALLOCATOR&  allocator = ALLOCATOR());
+        // Create an empty queue ordering its elements with the specified
+        // 'comparator'.  Optionally specify an 'allocator' used to supply
+        // memory.  If 'allocator' is not specified, a default-constructed
+        // allocator is used.  Note that no memory is allocated.
+
+    addressable_priority_queue(const addressable_priority_queue& original);
+    addressable_priority_queue(const addressable_priority_queue& original,
+                               const ALLOCATOR&                  allocator);
+        // Create a queue holding copies of the elements of the specified
+        // 'original' queue, under the same handles, and a copy of its
+        // comparator.  Optionally specify an 'allocator' used to supply
+        // memory.  If 'allocator' is not specified, the allocator returned by
+        // 'select_on_container_copy_construction' for the allocator of
+        // 'original' is used.
+
+    // ~addressable_priority_queue() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    addressable_priority_queue& operator=(
+                                        const addressable_priority_queue& rhs);
+        // Assign to this object the elements, handles, and comparator of the
+        // specified 'rhs' object, and return a reference providing modifiable
+        // access to this object.  If an exception is thrown, this object is
+        // unchanged.
+
+    handle_type push(const value_type& value);
+        // Add a copy of the specified 'value' to this queue, and return the
+        // handle of the new element.  If an exception is thrown by the
+        // allocator or by the copy constructor of 'VALUE', this queue is
+        // unchanged.  Note that 'value' may be an element of this queue.
+
+    void pop();
+        // Remove the element at the top of this queue, releasing its handle.
+        // The behavior is undefined unless '!empty()'.
+
+    void erase(handle_type handle);
+        // Remove the element having the specified 'handle' from this queue,
+        // releasing the handle.  The behavior is undefined unless
+        // 'contains(handle)'.
+
+    void update(handle_type handle, const value_type& value);
+        // Assign the specified 'value' to the element of this queue having
+        // the specified 'handle', and move the element to its place in the
+        // queue.  The behavior is undefined unless 'contains(handle)'.  Note
+        // that 'value' may be an element of this queue.
+
+    void decrease_key(handle_type handle, const value_type& value);
+        // Assign the specified 'value' to the element of this queue having
+        // the specified 'handle', and move the element towards the top of
+        // the queue to its place.  The behavior is undefined unless
+        // 'contains(handle)', and the comparator does not order 'value'
+        // before the current value of the element.  Note that this operation
+        // compares fewer elements than 'update', and that its name reflects
+        // its use with a comparator, such as 'native_std::greater', for which
+        // the top of the queue is its least element.
+
+    void clear();
+        // Remove all elements from this queue, releasing all handles, without
+        // releasing memory.  Note that the next handle returned by 'push' is
+        // 0.
+
+    void reserve(size_type numElements);
+        // Reserve memory for this queue to hold at least the specified
+        // 'numElements' elements without allocating.
+
+    void swap(addressable_priority_queue& other);
+        // Exchange the elements, handles, and comparator of this object with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee if this object and 'other' use
+        // the same allocator (and swapping their comparators does not throw),
+        // and otherwise copies the elements of each queue using the allocator
+        // of the other.
+
+    // ACCESSORS
+    const_reference top() const;
+        // Return a reference providing non-modifiable access to the greatest
+        // element of this queue.  The behavior is undefined unless
+        // '!empty()'.
+
+    handle_type top_handle() const;
+        // Return the handle of the element at the top of this queue.  The
+        // behavior is undefined unless '!empty()'.
+
+    const_reference value(handle_type handle) const;
+        // Return a reference providing non-modifiable access to the element
+        // of this queue having the specified 'handle'.  The behavior is
+        // undefined unless 'contains(handle)'.
+
+    bool contains(handle_type handle) const;
+        // Return 'true' if this queue holds an element having the specified
+        // 'handle', and 'false' otherwise.  Note that 'true' is returned for
+        // the handle of a removed element once the handle has been reused.
+
+    bool empty() const;
+        // Return 'true' if this queue holds no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this queue.
+
+    allocator_type get_allocator() const;
+        // Return a copy of the allocator used by this queue.
+
+    value_compare value_comp() const;
+        // Return a copy of the comparator used by this queue.
+};
+
+// FREE FUNCTIONS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>& a,
+          addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the elements, handles, and comparators of the specified 'a'
+    // and 'b' objects.  This method provides the no-throw exception-safety
+    // guarantee if 'a' and 'b' use the same allocator.
+
+// ============================================================================
+//                      TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                // ----------------------------------------------
+                // class AddressablePriorityQueue_EntryComparator
+                // ----------------------------------------------
+
+// CREATORS
+template <class COMPARATOR>
+inline
+AddressablePriorityQueue_EntryComparator<COMPARATOR>::
+               AddressablePriorityQueue_EntryComparator(
+                                                  const COMPARATOR& comparator)
+: d_comparator(comparator)
+{
+}
+
+// MANIPULATORS
+template <class COMPARATOR>
+inline
+COMPARATOR& AddressablePriorityQueue_EntryComparator<COMPARATOR>::comparator()
+{
+    return d_comparator;
+}
+
+// ACCESSORS
+template <class COMPARATOR>
+template <class ENTRY>
+inline
+bool AddressablePriorityQueue_EntryComparator<COMPARATOR>::operator()(
+                                                       const ENTRY& lhs,
+                                                       const ENTRY& rhs) const
+{
+    return d_comparator(lhs.first, rhs.first);
+}
+
+template <class COMPARATOR>
+inline
+const COMPARATOR&
+AddressablePriorityQueue_EntryComparator<COMPARATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+                  // ---------------------------------------
+                  // class AddressablePriorityQueue_Observer
+                  // ---------------------------------------
+
+// CREATORS
+inline
+AddressablePriorityQueue_Observer::AddressablePriorityQueue_Observer(
+                                                 native_std::size_t *positions)
+: d_positions_p(positions)
+{
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+void AddressablePriorityQueue_Observer::operator()(
+                                     const ENTRY&       entry,
+                                     native_std::size_t position) const
+{
+    d_positions_p[entry.second] = position;
+}
+
+                      // --------------------------------
+                      // class addressable_priority_queue
+                      // --------------------------------
+
+// PRIVATE CLASS DATA
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+const typename
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::handle_type
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::k_NO_HANDLE;
+
+// PRIVATE MANIPULATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::
+                                   privateReleaseHandle(handle_type handle)
+{
+    d_positions[handle] = d_freeHandle;
+    d_freeHandle        = handle;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::privateSwap(
+                                             addressable_priority_queue& other)
+{
+    d_heap.swap(other.d_heap);
+    d_positions.swap(other.d_positions);
+    native_std::swap(d_freeHandle, other.d_freeHandle);
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator.comparator(),
+                                        &other.d_comparator.comparator());
+}
+
+// CREATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::
+                    addressable_priority_queue(const ALLOCATOR& allocator)
+: d_heap(EntryAllocator(allocator))
+, d_positions(PositionAllocator(allocator))
+, d_freeHandle(k_NO_HANDLE)
+, d_comparator(COMPARATOR())
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::
+                    addressable_priority_queue(const COMPARATOR& comparator,
+                                               const ALLOCATOR&  allocator)
+: d_heap(EntryAllocator(allocator))
+, d_positions(PositionAllocator(allocator))
+, d_freeHandle(k_NO_HANDLE)
+, d_comparator(comparator)
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::
+      addressable_priority_queue(const addressable_priority_queue& original)
+: d_heap(original.d_heap,
+         EntryAllocator(bsl::allocator_traits<ALLOCATOR>::
+                 select_on_container_copy_construction(
+                                                  original.get_allocator())))
+, d_positions(original.d_positions, PositionAllocator(d_heap.get_allocator()))
+, d_freeHandle(original.d_freeHandle)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::
+      addressable_priority_queue(const addressable_priority_queue& original,
+                                 const ALLOCATOR&                  allocator)
+: d_heap(original.d_heap, EntryAllocator(allocator))
+, d_positions(original.d_positions, PositionAllocator(allocator))
+, d_freeHandle(original.d_freeHandle)
+, d_comparator(original.d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>&
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                         const addressable_priority_queue& rhs)
+{
+    if (this != &rhs) {
+        addressable_priority_queue copy(rhs, get_allocator());
+        privateSwap(copy);
+    }
+    return *this;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+typename addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::handle_type
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::push(
+                                                       const value_type& value)
+{
+    if (k_NO_HANDLE == d_freeHandle) {
+        // Add a free handle before adding the element, so that, should
+        // adding the element throw, this queue is unchanged but for the
+        // spare handle.
+
+        d_positions.push_back(k_NO_HANDLE);
+        d_freeHandle = d_positions.size() - 1;
+    }
+
+    const handle_type handle = d_freeHandle;
+
+    d_heap.emplace_back(value, handle);
+
+    d_freeHandle        = d_positions[handle];
+    d_positions[handle] = d_heap.size() - 1;
+
+    Observer observer(&d_positions[0]);
+    HeapUtil::pushHeap(d_heap.begin(), d_heap.end(), d_comparator, observer);
+
+    return handle;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::pop()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    const handle_type handle = d_heap.front().second;
+
+    Observer observer(&d_positions[0]);
+    HeapUtil::popHeap(d_heap.begin(), d_heap.end(), d_comparator, observer);
+
+    d_heap.pop_back();
+    privateReleaseHandle(handle);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::erase(
+                                                            handle_type handle)
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+
+    const size_type position     = d_positions[handle];
+    const size_type lastPosition = d_heap.size() - 1;
+
+    if (position != lastPosition) {
+        // Replace the element by the last element of the heap, and move that
+        // element to its place.
+
+        BloombergLP::bslalg::SwapUtil::swap(&d_heap[position],
+                                            &d_heap[lastPosition]);
+        d_positions[d_heap[position].second] = position;
+
+        d_heap.pop_back();
+        privateReleaseHandle(handle);
+
+        Observer observer(&d_positions[0]);
+        HeapUtil::update(d_heap.begin(),
+                         d_heap.end(),
+                         position,
+                         d_comparator,
+                         observer);
+    }
+    else {
+        d_heap.pop_back();
+        privateReleaseHandle(handle);
+    }
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::update(
+                                                   handle_type       handle,
+                                                   const value_type& value)
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+
+    const size_type position = d_positions[handle];
+
+    d_heap[position].first = value;
+
+    Observer observer(&d_positions[0]);
+    HeapUtil::update(d_heap.begin(),
+                     d_heap.end(),
+                     position,
+                     d_comparator,
+                     observer);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::decrease_key(
+                                                   handle_type       handle,
+                                                   const value_type& value)
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+
+    const size_type position = d_positions[handle];
+
+    BSLS_ASSERT_SAFE(!d_comparator.comparator()(value,
+                                                d_heap[position].first));
+
+    d_heap[position].first = value;
+
+    Observer observer(&d_positions[0]);
+    HeapUtil::siftUp(d_heap.begin(), position, d_comparator, observer);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_heap.clear();
+    d_positions.clear();
+    d_freeHandle = k_NO_HANDLE;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_heap.reserve(numElements);
+    d_positions.reserve(numElements);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                             addressable_priority_queue& other)
+{
+    if (get_allocator() == other.get_allocator()) {
+        privateSwap(other);
+    }
+    else {
+        addressable_priority_queue toOtherCopy(*this, other.get_allocator());
+        addressable_priority_queue toThisCopy(other, get_allocator());
+
+        toOtherCopy.privateSwap(other);
+        toThisCopy.privateSwap(*this);
+    }
+}
+
+// ACCESSORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::const_reference
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::top() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_heap.front().first;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::handle_type
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::top_handle() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_heap.front().second;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::const_reference
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::value(
+                                                      handle_type handle) const
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+
+    return d_heap[d_positions[handle]].first;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                      handle_type handle) const
+{
+    // The position recorded for a free handle is that of the next free
+    // handle, which may be a valid position, but then that of an element
+    // having another handle.
+
+    return handle < d_positions.size()
+        && d_positions[handle] < d_heap.size()
+        && handle == d_heap[d_positions[handle]].second;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_heap.empty();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::size_type
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_heap.size();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return ALLOCATOR(d_heap.get_allocator());
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::value_compare
+addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_comparator.comparator();
+}
+
+}  // close namespace bsl
+
+// FREE FUNCTIONS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>& a,
+               addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ===========================================================================
+//                                TYPE TRAITS
+// ===========================================================================
+
+// Type traits for addressable priority queues:
+//: o An addressable priority queue uses 'bslma' allocators if the
+//:   parameterized 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslma {
+
+template <typename VALUE, typename COMPARATOR, typename ALLOCATOR>
+struct UsesBslmaAllocator<
+               bsl::addressable_priority_queue<VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1301 @@
+// bslstl_addressablepriorityqueue.t.cpp                              -*-C++-*-
+#include <bslstl_addressablepriorityqueue.h>
+
+#include <bslstl_priorityqueue.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_newdeleteallocator.h>      // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bslmf_isbitwisemoveable.h>       // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+#include <bsls_types.h>                    // for testing only
+
+#include <bsltf_templatetestfacility.h>    // for testing only
+#include <bsltf_testvaluesarray.h>         // for testing only
+
+#include <functional>  // 'greater'
+#include <map>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an allocator-aware priority queue whose
+// elements are identified by handles.  We verify the state of a queue after
+// each operation of pseudo-random sequences of 'push', 'pop', 'erase',
+// 'update', and 'decrease_key' by comparing it with a 'std::map' from the
+// handle of each element to its value, checking, through every accessor, that
+// the queue holds exactly the elements of the map under the same handles, and
+// that its top is an element that no other precedes.  We verify that handles
+// are reused, so that they remain less than the greatest number of elements
+// held, for element types that are and are not bitwise moveable and that do
+// and do not allocate memory, and comparators ordering them either way.  We
+// verify that the allocator supplied at construction is used for all memory,
+// that 'push' leaves the queue unchanged if an allocation fails, and that
+// copies, assignment, and 'swap' preserve the handles of elements.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] addressable_priority_queue(const A& allocator = A());
+// [ 3] addressable_priority_queue(const C& comparator, const A& al);
+// [ 4] addressable_priority_queue(const addressable_priority_queue& o);
+// [ 4] addressable_priority_queue(const addressable_pq& o, al);
+// [ 2] ~addressable_priority_queue();
+//
+// MANIPULATORS
+// [ 4] addressable_priority_queue& operator=(const addressable_pq& rhs);
+// [ 2] handle_type push(const value_type& value);
+// [ 2] void pop();
+// [ 3] void erase(handle_type handle);
+// [ 3] void update(handle_type handle, const value_type& value);
+// [ 3] void decrease_key(handle_type handle, const value_type& value);
+// [ 2] void clear();
+// [ 2] void reserve(size_type numElements);
+// [ 4] void swap(addressable_priority_queue& other);
+//
+// ACCESSORS
+// [ 2] const_reference top() const;
+// [ 2] handle_type top_handle() const;
+// [ 2] const_reference value(handle_type handle) const;
+// [ 2] bool contains(handle_type handle) const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] allocator_type get_allocator() const;
+// [ 3] value_compare value_comp() const;
+//
+// FREE FUNCTIONS
+// [ 4] void swap(addressable_priority_queue& a, addressable_pq& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 2] CONCERN: The type has the expected traits.
+// [ 2] CONCERN: Pushing an element of the queue itself is supported.
+// [-1] PERFORMANCE: ORDER-EXPIRY SCHEDULER
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef std::size_t         Handle;
+typedef std::map<Handle, int> Model;
+    // type of the model of a queue, mapping the handle of each element to the
+    // index of its value in a 'bsltf::TestValuesArray'
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class IdentifierOrder {
+    // This class provides a comparator ordering objects of the test types by
+    // their identifiers (see 'bsltf_templatetestfacility'), ascending or
+    // descending as chosen at construction.
+
+    // DATA
+    bool d_descending;  // 'true' if greater identifiers are ordered first
+
+  public:
+    // CREATORS
+    explicit IdentifierOrder(bool descending = false)
+        // Create a comparator ordering objects by ascending identifiers, or,
+        // if the optionally specified 'descending' is 'true', by descending
+        // identifiers.
+    : d_descending(descending)
+    {
+    }
+
+    // ACCESSORS
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        const int lhsId = bsltf::TemplateTestFacility::getIdentifier(lhs);
+        const int rhsId = bsltf::TemplateTestFacility::getIdentifier(rhs);
+
+        return d_descending ? rhsId < lhsId : lhsId < rhsId;
+    }
+
+    bool isDescending() const
+        // Return 'true' if this comparator orders objects by descending
+        // identifiers, and 'false' otherwise.
+    {
+        return d_descending;
+    }
+};
+
+static
+int nextRandom(unsigned *seed)
+    // Return a pseudo-random number in the range '[0 .. 32767]', advancing
+    // the specified 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>(*seed >> 16) & 0x7fff;
+}
+
+static
+Handle pickHandle(const Model& model, unsigned *seed)
+    // Return the handle of a pseudo-random element of the specified 'model',
+    // advancing the specified 'seed'.  The behavior is undefined unless
+    // 'model' is not empty.
+{
+    Model::const_iterator it = model.begin();
+    for (int n = nextRandom(seed) % static_cast<int>(model.size()); n; --n) {
+        ++it;
+    }
+    return it->first;
+}
+
+template <class TYPE>
+bool isConsistent(
+       const bsl::addressable_priority_queue<TYPE, IdentifierOrder>& object,
+       const Model&                                                  model,
+       const bsltf::TestValuesArray<TYPE>&                           values,
+       Handle                                                        limit)
+    // Return 'true' if the specified 'object' holds exactly the elements of
+    // the specified 'values' at the indices held by the specified 'model',
+    // under the handles of the 'model', all of which are less than the
+    // specified 'limit', and has at its top an element that is not ordered
+    // before any other, and 'false' otherwise.
+{
+    if (object.size() != model.size() || object.empty() != model.empty()) {
+        return false;                                                 // RETURN
+    }
+    for (Handle handle = 0; handle <= limit; ++handle) {
+        Model::const_iterator it = model.find(handle);
+        if (object.contains(handle) != (model.end() != it)) {
+            return false;                                             // RETURN
+        }
+        if (model.end() != it) {
+            if (handle >= limit
+             || !(values[it->second] == object.value(handle))) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    if (!model.empty()) {
+        const Handle TOP = object.top_handle();
+        if (!object.contains(TOP) || &object.top() != &object.value(TOP)) {
+            return false;                                             // RETURN
+        }
+        for (Model::const_iterator it = model.begin();
+                                                   it != model.end(); ++it) {
+            if (object.value_comp()(object.top(), values[it->second])) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return true;
+}
+
+                            // ================
+                            // class TestDriver
+                            // ================
+
+template <class TYPE>
+class TestDriver {
+    // This class template provides a namespace for testing
+    // 'addressable_priority_queue' with elements of the (template parameter)
+    // 'TYPE'.
+
+    // PRIVATE TYPES
+    typedef bsl::addressable_priority_queue<TYPE, IdentifierOrder> Obj;
+    typedef bsltf::TestValuesArray<TYPE>                           TestValues;
+
+  public:
+    // TEST CASES
+    static void testCase4();
+        // Test copying, assignment, and 'swap'.
+
+    static void testCase3();
+        // Test 'erase', 'update', and 'decrease_key'.
+
+    static void testCase2();
+        // Test 'push', 'pop', 'clear', and the basic accessors.
+};
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase4()
+{
+    const TestValues VALUES;
+    const int        NUM_VALUES = static_cast<int>(VALUES.size());
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    unsigned seed = 4;
+
+    if (verbose) printf("\tTesting copy constructors and assignment.\n");
+
+    for (int length = 0; length <= 20; ++length) {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+
+        // Create a source with some free handles.
+
+        Obj   mY(IdentifierOrder(true), &sa);  const Obj& Y = mY;
+        Model model;
+        for (int i = 0; i < length + 3; ++i) {
+            const int INDEX = nextRandom(&seed) % NUM_VALUES;
+            model[mY.push(VALUES[INDEX])] = INDEX;
+        }
+        for (int i = 0; i < 3; ++i) {
+            const Handle HANDLE = pickHandle(model, &seed);
+            mY.erase(HANDLE);
+            model.erase(HANDLE);
+        }
+        const Handle LIMIT = length + 3;
+        ASSERTV(length, isConsistent(Y, model, VALUES, LIMIT));
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            const Obj X(Y, &oa);
+            ASSERTV(length, isConsistent(X, model, VALUES, LIMIT));
+            ASSERTV(length, &oa == X.get_allocator());
+            ASSERTV(length, true == X.value_comp().isDescending());
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        ASSERTV(length, 0 == oa.numBlocksInUse());
+
+        {
+            Obj mX(Y);  const Obj& X = mX;
+            ASSERTV(length, isConsistent(X, model, VALUES, LIMIT));
+            ASSERTV(length, &da == X.get_allocator());
+            ASSERTV(length, true == X.value_comp().isDescending());
+
+            // The copy reuses the free handles of the original, in the same
+            // order.
+
+            Obj mZ(Y, &oa);
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(length, i,
+                        mX.push(VALUES[0]) == mZ.push(VALUES[0]));
+            }
+        }
+
+        for (int rhsLength = 0; rhsLength <= 4; ++rhsLength) {
+            Obj   mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < rhsLength; ++i) {
+                mX.push(VALUES[i]);
+            }
+
+            const bsls::Types::Int64 NUM_SOURCE = sa.numBlocksTotal();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj *mR = &(mX = Y);
+                ASSERTV(length, rhsLength, &X == mR);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(length, rhsLength, isConsistent(X, model, VALUES, LIMIT));
+            ASSERTV(length, rhsLength, isConsistent(Y, model, VALUES, LIMIT));
+            ASSERTV(length, rhsLength, &oa == X.get_allocator());
+            ASSERTV(length, rhsLength, true == X.value_comp().isDescending());
+            ASSERTV(length, rhsLength, NUM_SOURCE == sa.numBlocksTotal());
+
+            Obj *mR = &(mX = X);
+            ASSERTV(length, rhsLength, &X == mR);
+            ASSERTV(length, rhsLength, isConsistent(X, model, VALUES, LIMIT));
+        }
+        ASSERTV(length, 0 == oa.numBlocksInUse());
+    }
+
+    if (verbose) printf("\tTesting 'swap'.\n");
+
+    for (int length1 = 0; length1 <= 6; ++length1) {
+        for (int length2 = 0; length2 <= 6; ++length2) {
+            for (int sameAllocator = 0; sameAllocator < 2; ++sameAllocator) {
+                bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+                bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+                bslma::TestAllocator& oaY = sameAllocator ? oa1 : oa2;
+
+                Obj   mX(IdentifierOrder(false), &oa1);  const Obj& X = mX;
+                Model model1;
+                for (int i = 0; i < length1; ++i) {
+                    model1[mX.push(VALUES[i])] = i;
+                }
+
+                Obj   mY(IdentifierOrder(true), &oaY);  const Obj& Y = mY;
+                Model model2;
+                for (int i = 0; i < length2; ++i) {
+                    model2[mY.push(VALUES[i + 1])] = i + 1;
+                }
+
+                const bsls::Types::Int64 NUM_TOTAL = oa1.numBlocksTotal();
+
+                mX.swap(mY);
+                ASSERTV(length1, length2, sameAllocator,
+                        isConsistent(X, model2, VALUES, length2));
+                ASSERTV(length1, length2, sameAllocator,
+                        isConsistent(Y, model1, VALUES, length1));
+                ASSERTV(length1, length2, sameAllocator,
+                        true  == X.value_comp().isDescending());
+                ASSERTV(length1, length2, sameAllocator,
+                        false == Y.value_comp().isDescending());
+                ASSERTV(length1, length2, sameAllocator,
+                        &oa1 == X.get_allocator());
+                ASSERTV(length1, length2, sameAllocator,
+                        &oaY == Y.get_allocator());
+
+                swap(mX, mY);
+                ASSERTV(length1, length2, sameAllocator,
+                        isConsistent(X, model1, VALUES, length1));
+                ASSERTV(length1, length2, sameAllocator,
+                        isConsistent(Y, model2, VALUES, length2));
+                ASSERTV(length1, length2, sameAllocator,
+                        false == X.value_comp().isDescending());
+                ASSERTV(length1, length2, sameAllocator,
+                        !sameAllocator || NUM_TOTAL == oa1.numBlocksTotal());
+            }
+        }
+    }
+    ASSERT(0 == da.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase3()
+{
+    const TestValues VALUES;
+    const int        NUM_VALUES = static_cast<int>(VALUES.size());
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int descending = 0; descending < 2; ++descending) {
+        const IdentifierOrder ORDER(descending);
+
+        if (veryVerbose) { T_ P(descending) }
+
+        for (int maxLength = 1; maxLength <= 40; maxLength += 3) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj   mX(ORDER, &oa);  const Obj& X = mX;
+            Model model;
+            ASSERTV(descending, ORDER.isDescending() ==
+                                              X.value_comp().isDescending());
+
+            unsigned seed     = maxLength + 100 * descending;
+            Handle   limit    = 0;
+            int      numPops  = 0;
+            int      numCalls = 0;
+
+            for (int op = 0; op < 400; ++op) {
+                const int CHOICE = nextRandom(&seed) % 8;
+
+                if (model.empty() || (CHOICE < 2
+                           && static_cast<int>(model.size()) < maxLength)) {
+                    const int    INDEX  = nextRandom(&seed) % NUM_VALUES;
+                    const Handle HANDLE = mX.push(VALUES[INDEX]);
+                    model[HANDLE] = INDEX;
+                    if (HANDLE >= limit) {
+                        limit = HANDLE + 1;
+                    }
+                }
+                else if (CHOICE < 3) {
+                    model.erase(X.top_handle());
+                    mX.pop();
+                    ++numPops;
+                }
+                else if (CHOICE < 5) {
+                    const Handle HANDLE = pickHandle(model, &seed);
+                    mX.erase(HANDLE);
+                    model.erase(HANDLE);
+                    ASSERTV(descending, maxLength, op,
+                            false == X.contains(HANDLE));
+                }
+                else if (CHOICE < 7) {
+                    const Handle HANDLE = pickHandle(model, &seed);
+                    const int    INDEX  = nextRandom(&seed) % NUM_VALUES;
+                    mX.update(HANDLE, VALUES[INDEX]);
+                    model[HANDLE] = INDEX;
+                }
+                else {
+                    // Move an element towards the top, by no more than the
+                    // distance to the greatest or least value.
+
+                    const Handle HANDLE = pickHandle(model, &seed);
+                    const int    OLD    = model[HANDLE];
+                    const int    STEP   = nextRandom(&seed) % 4;
+                    const int    INDEX  = descending
+                                        ? (OLD - STEP < 0 ? 0 : OLD - STEP)
+                                        : (OLD + STEP >= NUM_VALUES
+                                           ? NUM_VALUES - 1
+                                           : OLD + STEP);
+                    mX.decrease_key(HANDLE, VALUES[INDEX]);
+                    model[HANDLE] = INDEX;
+                    ++numCalls;
+                }
+                ASSERTV(descending, maxLength, op,
+                        isConsistent(X, model, VALUES, limit));
+                ASSERTV(descending, maxLength, op,
+                        limit <= static_cast<Handle>(maxLength));
+            }
+            ASSERTV(descending, maxLength, 0 < numPops);
+            ASSERTV(descending, maxLength, 0 < numCalls);
+
+            // Updating an element to the value of another is supported.
+
+            if (!X.empty()) {
+                const Handle HANDLE = pickHandle(model, &seed);
+                mX.update(HANDLE, X.top());
+                model[HANDLE] = model[X.top_handle()];
+                ASSERTV(descending, maxLength,
+                        isConsistent(X, model, VALUES, limit));
+            }
+
+            // Popping every element presents them in order.
+
+            while (!X.empty()) {
+                const Handle HANDLE = X.top_handle();
+                const int    INDEX  = model[HANDLE];
+                model.erase(HANDLE);
+                mX.pop();
+                for (Model::const_iterator it = model.begin();
+                                                   it != model.end(); ++it) {
+                    ASSERTV(descending, maxLength,
+                            !ORDER(VALUES[INDEX], VALUES[it->second]));
+                }
+            }
+        }
+        ASSERTV(descending, 0 == da.numBlocksInUse());
+    }
+
+    if (verbose) printf("\tNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        Obj mX(IdentifierOrder(), &da);
+        const Handle H0 = mX.push(VALUES[1]);
+        const Handle H1 = mX.push(VALUES[2]);
+
+        ASSERT_SAFE_FAIL(mX.decrease_key(H0, VALUES[0]));
+        ASSERT_SAFE_PASS(mX.decrease_key(H0, VALUES[1]));
+        ASSERT_SAFE_PASS(mX.decrease_key(H0, VALUES[3]));
+
+        ASSERT_SAFE_FAIL(mX.update(H1 + 1, VALUES[0]));
+        ASSERT_SAFE_PASS(mX.update(H1,     VALUES[0]));
+
+        ASSERT_SAFE_FAIL(mX.decrease_key(H1 + 1, VALUES[4]));
+
+        ASSERT_SAFE_FAIL(mX.erase(H1 + 1));
+        ASSERT_SAFE_PASS(mX.erase(H1));
+        ASSERT_SAFE_FAIL(mX.erase(H1));
+        ASSERT_SAFE_FAIL(mX.update(H1, VALUES[0]));
+    }
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase2()
+{
+    const TestValues VALUES;
+    const int        NUM_VALUES = static_cast<int>(VALUES.size());
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (verbose) printf("\tTesting 'push', 'pop', and 'clear'.\n");
+
+    for (int maxLength = 1; maxLength <= 40; maxLength += 3) {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERTV(maxLength, &oa == X.get_allocator());
+            ASSERTV(maxLength, 0 == oa.numBlocksTotal());
+
+            Model    model;
+            unsigned seed  = maxLength;
+            Handle   limit = 0;
+
+            for (int op = 0; op < 300; ++op) {
+                if (model.empty() || (nextRandom(&seed) % 2
+                           && static_cast<int>(model.size()) < maxLength)) {
+                    const int    INDEX  = nextRandom(&seed) % NUM_VALUES;
+                    const Handle HANDLE = mX.push(VALUES[INDEX]);
+
+                    ASSERTV(maxLength, op, model.end() == model.find(HANDLE));
+                    model[HANDLE] = INDEX;
+                    if (HANDLE >= limit) {
+                        ASSERTV(maxLength, op, limit == HANDLE);
+                        limit = HANDLE + 1;
+                    }
+                }
+                else {
+                    const Handle HANDLE = X.top_handle();
+                    ASSERTV(maxLength, op, model.end() != model.find(HANDLE));
+                    mX.pop();
+                    model.erase(HANDLE);
+                }
+                ASSERTV(maxLength, op, isConsistent(X, model, VALUES, limit));
+                ASSERTV(maxLength, op,
+                        limit <= static_cast<Handle>(maxLength));
+            }
+            ASSERTV(maxLength, 0 == da.numBlocksInUse());
+
+            // 'clear' releases all handles, but keeps the array of elements,
+            // whose first element is always at the top.
+
+            mX.push(VALUES[0]);
+
+            const TYPE *const FIRST = &X.top();
+
+            mX.clear();
+            model.clear();
+            ASSERTV(maxLength, isConsistent(X, model, VALUES, limit));
+            ASSERTV(maxLength, 0 == mX.push(VALUES[0]));
+            ASSERTV(maxLength, FIRST == &X.top());
+
+            // 'reserve' allows pushing without reallocating that array.
+
+            const int LENGTH = maxLength + 40;
+
+            mX.reserve(LENGTH);
+
+            const TYPE *const RESERVED = &X.top();
+
+            for (int i = 1; i < LENGTH; ++i) {
+                mX.push(VALUES[i % NUM_VALUES]);
+            }
+            ASSERTV(maxLength, RESERVED == &X.top());
+        }
+        ASSERTV(maxLength, 0 == oa.numBlocksInUse());
+    }
+
+    if (verbose) printf("\tTesting exception safety and aliasing.\n");
+
+    const bool SWAP_CAN_THROW = bslma::UsesBslmaAllocator<TYPE>::value
+                             && !bslmf::IsBitwiseMoveable<TYPE>::value;
+
+    for (int length = 0; length <= 12; ++length) {
+        for (int aliased = 0; aliased < 2; ++aliased) {
+            if (aliased && 0 == length) {
+                continue;
+            }
+
+            // Push, onto a queue of 'length' elements some of whose handles
+            // may be free, a new value, or the value at its top.
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj   mX(&oa);  const Obj& X = mX;
+                Model model;
+
+                {
+                    const bsls::Types::Int64 AL = oa.allocationLimit();
+                    oa.setAllocationLimit(-1);
+                    for (int i = 0; i < length + length % 3; ++i) {
+                        model[mX.push(VALUES[i % NUM_VALUES])] =
+                                                              i % NUM_VALUES;
+                    }
+                    for (int i = 0; i < length % 3; ++i) {
+                        model.erase(X.top_handle());
+                        mX.pop();
+                    }
+                    oa.setAllocationLimit(AL);
+                }
+                const Handle LIMIT = length + length % 3 + 1;
+
+                const int   INDEX = aliased ? model[X.top_handle()]
+                                            : NUM_VALUES - 1;
+                const TYPE& VALUE = aliased ? X.top() : VALUES[INDEX];
+
+                Handle handle = LIMIT;
+                try {
+                    handle = mX.push(VALUE);
+                }
+                catch (...) {
+                    // Elements of 'bsltf::AllocTestType', which is neither
+                    // bitwise moveable nor has a 'swap' that cannot throw,
+                    // may be left with unspecified values (see {Exception
+                    // Safety} in the component documentation).
+
+                    ASSERTV(length, aliased, SWAP_CAN_THROW ||
+                                        isConsistent(X, model, VALUES, LIMIT));
+                    throw;
+                }
+                model[handle] = INDEX;
+                ASSERTV(length, aliased,
+                        isConsistent(X, model, VALUES, LIMIT));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(length, aliased, 0 == oa.numBlocksInUse());
+        }
+    }
+    ASSERT(0 == da.numBlocksInUse());
+
+    if (verbose) printf("\tNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        Obj mX(&da);  const Obj& X = mX;
+
+        ASSERT_SAFE_FAIL(X.top());
+        ASSERT_SAFE_FAIL(X.top_handle());
+        ASSERT_SAFE_FAIL(X.value(0));
+        ASSERT_SAFE_FAIL(mX.pop());
+
+        mX.push(VALUES[0]);
+
+        ASSERT_SAFE_PASS(X.top());
+        ASSERT_SAFE_PASS(X.top_handle());
+        ASSERT_SAFE_PASS(X.value(0));
+        ASSERT_SAFE_FAIL(X.value(1));
+        ASSERT_SAFE_PASS(mX.pop());
+        ASSERT_SAFE_FAIL(X.value(0));
+    }
+}
+
+                        // ===========================
+                        // Order-Expiry Benchmark Aids
+                        // ===========================
+
+typedef bsl::pair<bsls::Types::Int64, int> Deadline;
+    // deadline of an order, and the identifier of the order
+
+typedef native_std::greater<Deadline>      EarliestFirst;
+    // comparator placing the earliest deadline at the top of a queue
+
+static
+double runAddressableScheduler(int                 numOrders,
+                               int                 numOps,
+                               int                 amendPercentage,
+                               bsls::Types::Int64 *checksum)
+    // Report the time, in seconds, taken by the specified 'numOps' operations
+    // on a scheduler of the expiry of the specified 'numOrders' orders held
+    // in an 'addressable_priority_queue', each of which either amends the
+    // deadline of a pseudo-random order (with a probability of the specified
+    // 'amendPercentage' percent) or expires the earliest order and replaces
+    // it with a new one, and add the deadlines of the expired orders to the
+    // specified 'checksum'.
+{
+    typedef bsl::addressable_priority_queue<Deadline, EarliestFirst> Queue;
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    Queue                       queue(allocator);
+    bsl::vector<Queue::handle_type> handles(allocator);
+
+    unsigned           seed = 1;
+    bsls::Types::Int64 now  = 0;
+
+    for (int i = 0; i < numOrders; ++i) {
+        handles.push_back(queue.push(Deadline(1 + nextRandom(&seed), i)));
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numOps; ++i) {
+        if (nextRandom(&seed) % 100 < amendPercentage) {
+            const int ORDER = (nextRandom(&seed) << 15 | nextRandom(&seed))
+                                                                 % numOrders;
+            queue.update(handles[ORDER],
+                         Deadline(now + 1 + nextRandom(&seed), ORDER));
+        }
+        else {
+            const Deadline EXPIRED = queue.top();
+            now        = EXPIRED.first;
+            *checksum += now;
+            queue.pop();
+            handles[EXPIRED.second] = queue.push(
+                      Deadline(now + 1 + nextRandom(&seed), EXPIRED.second));
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+static
+double runLazyScheduler(int                 numOrders,
+                        int                 numOps,
+                        int                 amendPercentage,
+                        bsls::Types::Int64 *checksum,
+                        std::size_t        *maxLength)
+    // Report the time, in seconds, taken by the same operations as
+    // 'runAddressableScheduler', for the specified 'numOrders', 'numOps',
+    // and 'amendPercentage', on a scheduler holding its deadlines in a
+    // 'priority_queue', that leaves the previous deadline of an amended order
+    // in the queue, and discards it when it reaches the top, add the
+    // deadlines of the expired orders to the specified 'checksum', and load
+    // into the specified 'maxLength' the greatest length of the queue.
+{
+    typedef bsl::priority_queue<Deadline,
+                                bsl::vector<Deadline>,
+                                EarliestFirst> Queue;
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    Queue                           queue(allocator);
+    bsl::vector<bsls::Types::Int64> current(allocator);
+
+    unsigned           seed = 1;
+    bsls::Types::Int64 now  = 0;
+
+    for (int i = 0; i < numOrders; ++i) {
+        current.push_back(1 + nextRandom(&seed));
+        queue.push(Deadline(current.back(), i));
+    }
+    *maxLength = queue.size();
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numOps; ++i) {
+        if (nextRandom(&seed) % 100 < amendPercentage) {
+            const int ORDER = (nextRandom(&seed) << 15 | nextRandom(&seed))
+                                                                 % numOrders;
+            current[ORDER] = now + 1 + nextRandom(&seed);
+            queue.push(Deadline(current[ORDER], ORDER));
+            if (queue.size() > *maxLength) {
+                *maxLength = queue.size();
+            }
+        }
+        else {
+            while (queue.top().first != current[queue.top().second]) {
+                queue.pop();
+            }
+            const Deadline EXPIRED = queue.top();
+            now        = EXPIRED.first;
+            *checksum += now;
+            queue.pop();
+            current[EXPIRED.second] = now + 1 + nextRandom(&seed);
+            queue.push(Deadline(current[EXPIRED.second], EXPIRED.second));
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Expiring Orders
+/// - - - - - - - - - - - - -
+// Suppose that a trading gateway expires each resting order at a deadline,
+// and that orders are frequently cancelled, or have their deadlines amended,
+// before they expire.
+//
+// First, we define the type of the queue of deadlines, in milliseconds, the
+// earliest of which is at its top:
+//..
+    typedef bsl::addressable_priority_queue<int, native_std::greater<int> >
+                                                                   ExpiryQueue;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a queue, and schedule the expiry of three orders, keeping
+// the handle of the deadline of each:
+//..
+    bslma::TestAllocator allocator;
+    ExpiryQueue          expiries(&allocator);
+
+    const ExpiryQueue::handle_type order1 = expiries.push(1000);
+    const ExpiryQueue::handle_type order2 = expiries.push(500);
+    const ExpiryQueue::handle_type order3 = expiries.push(2000);
+
+    ASSERT(500    == expiries.top());
+    ASSERT(order2 == expiries.top_handle());
+//..
+// Next, the second order is cancelled, so that its deadline is removed at
+// once, rather than left in the queue until it is due:
+//..
+    expiries.erase(order2);
+
+    ASSERT(2      == expiries.size());
+    ASSERT(1000   == expiries.top());
+    ASSERT(order1 == expiries.top_handle());
+//..
+// Then, the deadline of the third order is brought forward, which moves it
+// towards the top of the queue, as 'decrease_key' requires, and the deadline
+// of the first is extended:
+//..
+    expiries.decrease_key(order3, 800);
+    expiries.update(order1, 3000);
+
+    ASSERT(800    == expiries.value(order3));
+    ASSERT(3000   == expiries.value(order1));
+    ASSERT(order3 == expiries.top_handle());
+//..
+// Finally, when the time is 2500 milliseconds, we expire the orders that are
+// due:
+//..
+    int numExpired = 0;
+    while (!expiries.empty() && expiries.top() <= 2500) {
+        ASSERT(order3 == expiries.top_handle());
+        expiries.pop();
+        ++numExpired;
+    }
+    ASSERT(1      == numExpired);
+    ASSERT(1      == expiries.size());
+    ASSERT(order1 == expiries.top_handle());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPYING, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy holds the elements of the original under the same handles,
+        //:   has the same free handles, and a copy of its comparator, and uses
+        //:   the allocator supplied, or the default allocator if none is.
+        //:
+        //: 2 Assignment gives the target the elements, handles, and
+        //:   comparator of the source, which is unchanged, keeps the
+        //:   allocator of the target, and leaves the target unchanged if an
+        //:   exception is thrown.
+        //:
+        //: 3 The member and free 'swap' functions exchange the elements,
+        //:   handles, and comparators of two queues, but not their
+        //:   allocators, without allocating if they use the same allocator.
+        //:
+        //: 4 No memory is leaked if an exception is thrown while copying.
+        //
+        // Plan:
+        //: 1 For queues of various lengths, having free handles, copy them,
+        //:   with and without an allocator, in the presence of injected
+        //:   exceptions, and verify the handles returned by pushing onto the
+        //:   copies.  (C-1, 4)
+        //:
+        //: 2 Assign each queue to queues of various lengths, in the presence
+        //:   of injected exceptions, and to itself.  (C-2, 4)
+        //:
+        //: 3 Swap pairs of queues of various lengths, using the same and
+        //:   different allocators, with the member and the free 'swap'.
+        //:   (C-3)
+        //
+        // Testing:
+        //   addressable_priority_queue(const addressable_priority_queue& o);
+        //   addressable_priority_queue(const addressable_pq& o, al);
+        //   addressable_priority_queue& operator=(const addressable_pq& rhs);
+        //   void swap(addressable_priority_queue& other);
+        //   void swap(addressable_priority_queue& a, addressable_pq& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING COPYING, ASSIGNMENT, AND SWAP"
+                            "\n=====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase4,
+                      int,
+                      bsltf::AllocTestType);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'erase', 'update', AND 'decrease_key'
+        //
+        // Concerns:
+        //: 1 'erase' removes the element having the given handle, wherever it
+        //:   is in the queue, and releases its handle, leaving the other
+        //:   elements under their handles.
+        //:
+        //: 2 'update' changes the value of the element having the given
+        //:   handle, and moves it up or down to its place.
+        //:
+        //: 3 'decrease_key' changes the value of the element having the given
+        //:   handle, and moves it towards the top.
+        //:
+        //: 4 The comparator supplied at construction orders the elements, and
+        //:   is returned by 'value_comp'.
+        //:
+        //: 5 A value that is an element of the queue may be assigned to
+        //:   another element.
+        //:
+        //: 6 No memory is allocated by these operations.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For comparators ordering elements either way, and queues of
+        //:   various maximum lengths, apply pseudo-random sequences of 'push',
+        //:   'pop', 'erase', 'update', and 'decrease_key' to a queue and to a
+        //:   model, and verify that they are consistent after each operation.
+        //:   (C-1..4, 6)
+        //:
+        //: 2 Update an element to the value at the top of the queue, then
+        //:   pop every element, verifying that they are presented in order.
+        //:   (C-4..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //:
+        //: 4 Run the above for 'int', for a type that allocates and is not
+        //:   bitwise moveable, and for a type that allocates and is bitwise
+        //:   moveable.
+        //
+        // Testing:
+        //   addressable_priority_queue(const C& comparator, const A& al);
+        //   void erase(handle_type handle);
+        //   void update(handle_type handle, const value_type& value);
+        //   void decrease_key(handle_type handle, const value_type& value);
+        //   value_compare value_comp() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'erase', 'update', AND 'decrease_key'"
+                            "\n============================================="
+                            "\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase3,
+                      int,
+                      bsltf::AllocTestType,
+                      bsltf::AllocBitwiseMoveableTestType);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'push', 'pop', 'clear', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each sequence of 'push' and 'pop' leaves the queue holding the
+        //:   elements pushed and not popped, each under the handle returned by
+        //:   its 'push', as observed through each accessor, with an element
+        //:   not ordered before any other at its top.
+        //:
+        //: 2 'push' returns the handle of a removed element if there is one,
+        //:   and otherwise the least handle never returned, so that handles
+        //:   are less than the greatest number of elements held.
+        //:
+        //: 3 'clear' removes all elements, and releases all handles, but not
+        //:   memory.
+        //:
+        //: 4 'reserve' allocates memory for the number of elements given.
+        //:
+        //: 5 If an allocation fails while a value is pushed, the queue is
+        //:   unchanged, and no memory is leaked.
+        //:
+        //: 6 A value that is an element of the queue itself is pushed
+        //:   correctly, even if the queue grows.
+        //:
+        //: 7 All memory, including that of the elements, is supplied by the
+        //:   allocator of the queue, and none is allocated at construction.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 9 The type has the expected traits.
+        //
+        // Plan:
+        //: 1 For queues of various maximum lengths, apply a pseudo-random
+        //:   sequence of 'push' and 'pop' to a queue and to a model, and
+        //:   verify that they are consistent after each operation, then clear
+        //:   the queue, and reserve memory.  (C-1..4, 7)
+        //:
+        //: 2 Push a new value, and the value at the top, onto queues of
+        //:   various lengths, having free handles or not, in the presence of
+        //:   injected exceptions, and verify the state of the queue.
+        //:   (C-5..6)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //:
+        //: 4 Run the above for 'int', for a type that allocates and is not
+        //:   bitwise moveable, and for a type that allocates and is bitwise
+        //:   moveable.
+        //:
+        //: 5 Verify the traits directly.  (C-9)
+        //
+        // Testing:
+        //   addressable_priority_queue(const A& allocator = A());
+        //   ~addressable_priority_queue();
+        //   handle_type push(const value_type& value);
+        //   void pop();
+        //   void clear();
+        //   void reserve(size_type numElements);
+        //   const_reference top() const;
+        //   handle_type top_handle() const;
+        //   const_reference value(handle_type handle) const;
+        //   bool contains(handle_type handle) const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   allocator_type get_allocator() const;
+        //   CONCERN: The type has the expected traits.
+        //   CONCERN: Pushing an element of the queue itself is supported.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'push', 'pop', 'clear', AND BASIC"
+                            " ACCESSORS"
+                            "\n=========================================="
+                            "==========\n");
+
+        ASSERT(true == bslma::UsesBslmaAllocator<
+                          bsl::addressable_priority_queue<int> >::value);
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase2,
+                      int,
+                      bsltf::AllocTestType,
+                      bsltf::AllocBitwiseMoveableTestType);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push elements onto a queue, update, erase, and pop them, and copy
+        //:   the queue.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::addressable_priority_queue<int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(true == X.empty());
+        ASSERT(0 == oa.numBlocksTotal());
+
+        const Obj::handle_type H5 = mX.push(5);
+        const Obj::handle_type H3 = mX.push(3);
+        const Obj::handle_type H8 = mX.push(8);
+        ASSERT(0 == H5);
+        ASSERT(1 == H3);
+        ASSERT(2 == H8);
+        ASSERT(3 == X.size());
+        ASSERT(8 == X.top());
+        ASSERT(H8 == X.top_handle());
+        ASSERT(5 == X.value(H5));
+
+        mX.update(H3, 9);
+        ASSERT(9 == X.top());
+        ASSERT(H3 == X.top_handle());
+
+        mX.erase(H3);
+        ASSERT(false == X.contains(H3));
+        ASSERT(8 == X.top());
+
+        mX.decrease_key(H5, 10);
+        ASSERT(H5 == X.top_handle());
+
+        const Obj::handle_type H1 = mX.push(1);
+        ASSERT(H3 == H1);
+        ASSERT(1 == X.value(H1));
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(3 == Y.size());
+        ASSERT(10 == Y.value(H5));
+        ASSERT(8 == Y.value(H8));
+        ASSERT(1 == Y.value(H1));
+
+        mX.pop();
+        ASSERT(false == X.contains(H5));
+        ASSERT(8 == X.top());
+        mX.pop();
+        ASSERT(1 == X.top());
+        mX.pop();
+        ASSERT(true == X.empty());
+        ASSERT(10 == Y.top());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ORDER-EXPIRY SCHEDULER
+        //
+        // Concerns:
+        //   Provide a benchmark of a scheduler of the expiry of orders whose
+        //   deadlines are amended, holding the deadlines in an
+        //   'addressable_priority_queue' and updating them in place, compared
+        //   with one holding them in a 'priority_queue' and discarding the
+        //   stale deadlines of amended orders as they reach the top.
+        //
+        // Plan:
+        //   For various numbers of orders and proportions of amendments among
+        //   (by default) 1 million operations, report the time taken by each
+        //   scheduler, and the greatest length reached by the queue of the
+        //   second, with memory supplied by the 'new'/'delete' allocator.
+        //
+        // Testing:
+        //   PERFORMANCE: ORDER-EXPIRY SCHEDULER
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: ORDER-EXPIRY SCHEDULER"
+                            "\n===================================\n");
+
+        const int NUM_OPS = argc > 2 && atoi(argv[2]) > 0
+                            ? atoi(argv[2])
+                            : 1000 * 1000;
+
+        const int NUM_ORDERS[]     = { 1000, 100 * 1000, 1000 * 1000 };
+        const int NUM_NUM_ORDERS   = sizeof NUM_ORDERS / sizeof *NUM_ORDERS;
+
+        const int AMEND_PERCENTAGES[] = { 0, 50, 90 };
+        const int NUM_PERCENTAGES     = sizeof  AMEND_PERCENTAGES
+                                      / sizeof *AMEND_PERCENTAGES;
+
+        printf("\t%10s %8s %12s %12s %14s\n",
+               "orders", "amended", "addressable", "lazy", "lazy length");
+
+        for (int ti = 0; ti < NUM_NUM_ORDERS; ++ti) {
+            for (int tj = 0; tj < NUM_PERCENTAGES; ++tj) {
+                const int ORDERS     = NUM_ORDERS[ti];
+                const int PERCENTAGE = AMEND_PERCENTAGES[tj];
+
+                bsls::Types::Int64 sums[2] = { 0, 0 };
+                std::size_t        maxLength;
+
+                const double addressableTime =
+                    runAddressableScheduler(ORDERS,
+                                            NUM_OPS,
+                                            PERCENTAGE,
+                                            &sums[0]);
+                const double lazyTime = runLazyScheduler(ORDERS,
+                                                         NUM_OPS,
+                                                         PERCENTAGE,
+                                                         &sums[1],
+                                                         &maxLength);
+                ASSERTV(ORDERS, PERCENTAGE, sums[0] == sums[1]);
+
+                printf("\t%10d %7d%% %11.3fs %11.3fs %14d\n",
+                       ORDERS,
+                       PERCENTAGE,
+                       addressableTime,
+                       lazyTime,
+                       static_cast<int>(maxLength));
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
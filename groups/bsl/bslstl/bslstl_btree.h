@@ -0,0 +1,1989 @@
+// bslstl_btree.h                                                     -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREE
+#define INCLUDED_BSLSTL_BTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a B-tree of unique keys for ordered associative containers.
+//
+//@CLASSES:
+//  bslstl::BTree: ordered sequence of values with unique keys in a B-tree
+//  bslstl::BTreeIterator: bidirectional iterator over the values of a 'BTree'
+//  bslstl::BTree_Node: node of a 'BTree', holding values (a leaf node)
+//  bslstl::BTree_InternalNode: node of a 'BTree' holding values and children
+//
+//@SEE_ALSO: bslstl_btreemap, bslstl_btreeset, bslalg_rbtreeutil
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::BTree',
+// implementing an ordered sequence of values having unique keys held in a
+// B-tree, together with the node types of the tree, 'bslstl::BTree_Node' and
+// 'bslstl::BTree_InternalNode', and a bidirectional iterator over the values,
+// 'bslstl::BTreeIterator'.  'BTree' is the implementation of the ordered
+// associative containers 'bsl::btree_map' and 'bsl::btree_set' (see
+// 'bslstl_btreemap' and 'bslstl_btreeset').
+//
+// The values held by a 'BTree' are ordered by the keys extracted from them by
+// the (template parameter) type 'KEY_CONFIG', which must provide the same
+// interface as 'bslstl::UnorderedMapKeyConfiguration' (for values that are
+// 'pair' objects holding a key and a mapped value) and
+// 'bslstl::UnorderedSetKeyConfiguration' (for values that are their own
+// keys):
+//..
+//  typedef ... ValueType;  // type of the values held by the tree
+//  typedef ... KeyType;    // type of the keys ordering those values
+//
+//  static const KeyType& extractKey(const ValueType& value);
+//..
+//
+///Structure of the Tree
+///---------------------
+// Whereas a red-black tree (see 'bslalg_rbtreeutil') holds each value in its
+// own node, linked to its parent and children by three pointers, a B-tree
+// holds an array of values in each node, and an internal node additionally
+// holds one more child than values, the values of the subtree of the child at
+// index 'i' being ordered between the values at indices 'i - 1' and 'i'.  A
+// node holds at most 'BTree_Node<VALUE>::k_CAPACITY' values, chosen so that a
+// leaf node occupies about 256 bytes (four cache lines on most platforms), and
+// each node other than the root holds at least
+// 'BTree_Node<VALUE>::k_MIN_VALUES' (about half the capacity).  All the leaf
+// nodes are at the same depth, and, as nodes are wide, the tree is shallow:
+// a tree of 'int' values has about 60 values per leaf, and a tree of 50
+// million such values is only five levels deep.  Most of the values, and all
+// the values of a tree smaller than a node, are held in leaf nodes.
+//
+// As a consequence, visiting the values in order touches consecutive memory
+// for all the values of a leaf, and searching for a key requires one node
+// visit (a few adjacent cache lines) per level of the tree, rather than one
+// cache miss per comparison.  A B-tree also uses less memory than a
+// red-black tree: there is no per-value node header or allocation, at the
+// cost of the unused capacity of partially-filled nodes.
+//
+// Inserting a value into a full node splits the node in two, moving the
+// median value into the parent node (and so on up to the root, which may
+// split to create a new root, increasing the depth of the tree).  Erasing a
+// value from a node left with too few values takes a value from a sibling
+// node, through the parent, or merges the node with a sibling (and so on up
+// to the root).  Values are therefore moved between and within nodes, and, as
+// for 'bsl::vector', *any* insertion or erasure invalidates all iterators,
+// pointers, and references to the values of the tree.  For the same reason,
+// values must be copy-constructible, and are moved with 'memmove' if their
+// type is bitwise moveable (see 'bslmf_isbitwisemoveable'), and by copying
+// and destroying them otherwise.
+//
+///Exception Safety
+///----------------
+// Inserting a value allocates, before modifying the tree, any nodes needed to
+// split full nodes, and copies the value to insert into a temporary buffer:
+// if the value type is bitwise moveable, no operation that may throw is
+// performed after that point, and the insertion therefore provides the strong
+// exception-safety guarantee.  Erasing a value neither allocates memory nor,
+// if the value type is bitwise moveable, performs any operation that may
+// throw.  For value types that are not bitwise moveable, an exception thrown
+// by a copy constructor while values are moved between nodes leaves the tree
+// in an unspecified (and possibly invalid) state.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Maintaining an Ordered Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain a set of 'int' values, ordered from the
+// largest to the smallest, in a 'BTree' (which is generally used through
+// 'bsl::btree_set').
+//
+// First, we define the type of the tree:
+//..
+//  typedef bslstl::UnorderedSetKeyConfiguration<int>  IntConfig;
+//  typedef bslstl::BTree<IntConfig,
+//                        std::greater<int>,
+//                        bsl::allocator<int> >       IntTree;
+//..
+// Then, we create a tree and insert enough values to require several nodes:
+//..
+//  bslma::TestAllocator allocator;
+//  IntTree              tree(std::greater<int>(), &allocator);
+//
+//  for (int i = 0; i < 1000; ++i) {
+//      assert(true == tree.insert((i * 7) % 1000).second);
+//  }
+//  assert(false == tree.insert(42).second);
+//  assert(1000  == tree.size());
+//  assert(1     <  allocator.numBlocksInUse());
+//  assert(tree.isWellFormed());
+//..
+// Next, we search for some values:
+//..
+//  assert(500 == *tree.find(500));
+//  assert(tree.end() == tree.find(1000));
+//  assert(499 == *tree.upperBound(500));
+//..
+// Then, we erase the odd values, using the iterator returned by 'erase' to
+// continue the traversal:
+//..
+//  IntTree::Iterator it = tree.begin();
+//  while (it != tree.end()) {
+//      if (*it % 2) {
+//          it = tree.erase(it);
+//      }
+//      else {
+//          ++it;
+//      }
+//  }
+//  assert(500 == tree.size());
+//  assert(tree.isWellFormed());
+//..
+// Finally, we observe that the remaining values are visited from the largest
+// to the smallest:
+//..
+//  int expected = 998;
+//  for (it = tree.begin(); it != tree.end(); ++it, expected -= 2) {
+//      assert(expected == *it);
+//  }
+//  assert(-2 == expected);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_CONTAINERBASE
+#include <bslalg_containerbase.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECV
+#include <bslmf_removecv.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>  // 'memmove'
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <class VALUE>
+struct BTree_InternalNode;
+
+                             // =================
+                             // struct BTree_Node
+                             // =================
+
+template <class VALUE>
+struct BTree_Node {
+    // This 'struct' describes a node of a 'BTree' holding values of the
+    // (template parameter) type 'VALUE', and is the complete type of a leaf
+    // node.  Nodes are allocated as raw memory and their values constructed
+    // in place; the values at indices '[0 .. d_numValues)' are initialized.
+
+    // PUBLIC TYPES
+    enum {
+        k_TARGET_SIZE = 256,
+            // approximate size in bytes of a leaf node
+
+        k_HEADER_SIZE = sizeof(void *) + 2 * sizeof(unsigned short)
+                                                              + sizeof(bool),
+
+        k_FITTING     = (k_TARGET_SIZE - k_HEADER_SIZE) / sizeof(VALUE),
+
+        k_CAPACITY    = k_FITTING < 3
+                        ? 3
+                        : k_FITTING > 255 ? 255 : k_FITTING,
+            // maximum number of values held by a node
+
+        k_MIN_VALUES  = (k_CAPACITY - 1) / 2
+            // minimum number of values held by a node other than the root
+    };
+
+    // PUBLIC DATA
+    BTree_InternalNode<VALUE> *d_parent_p;   // parent, or 0 for the root
+
+    unsigned short             d_position;   // index of this node among the
+                                             // children of its parent
+
+    unsigned short             d_numValues;  // number of values held
+
+    bool                       d_isLeaf;     // 'true' for a leaf node, and
+                                             // 'false' for an internal node
+
+    bsls::ObjectBuffer<VALUE>  d_values[k_CAPACITY];
+                                             // storage for the values
+
+    // MANIPULATORS
+    VALUE *values();
+        // Return the address of the first element of the array of values of
+        // this node.
+
+    // ACCESSORS
+    const VALUE *values() const;
+        // Return the address of the first element of the array of
+        // non-modifiable values of this node.
+};
+
+                         // =========================
+                         // struct BTree_InternalNode
+                         // =========================
+
+template <class VALUE>
+struct BTree_InternalNode : BTree_Node<VALUE> {
+    // This 'struct' describes an internal node of a 'BTree' holding values of
+    // the (template parameter) type 'VALUE', which holds one more child than
+    // values; the children at indices '[0 .. d_numValues]' are valid.
+
+    // PUBLIC DATA
+    BTree_Node<VALUE> *d_children[BTree_Node<VALUE>::k_CAPACITY + 1];
+                                                          // child nodes
+};
+
+                            // ===================
+                            // class BTreeIterator
+                            // ===================
+
+template <class VALUE, class DIFFERENCE_TYPE>
+class BTreeIterator {
+    // This class provides an STL-conforming bidirectional iterator over the
+    // ordered values held by a 'BTree' (see section [24.2.6
+    // bidirectional.iterators] of the C++11 standard), providing access to
+    // values of the (template parameter) type 'VALUE', which may be
+    // 'const'-qualified.  An iterator is a position in a node: the
+    // past-the-end iterator of a non-empty tree is positioned one past the
+    // last value of the rightmost leaf node, and that of an empty tree refers
+    // to no node.
+    // The behavior of the 'operator*' method is undefined unless the iterator
+    // is at a valid position in the tree (i.e., not the 'end') and the tree
+    // has not been modified since the iterator was obtained.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type            NcType;
+    typedef BTreeIterator<NcType, DIFFERENCE_TYPE>          NcIter;
+    typedef BTree_Node<NcType>                              Node;
+    typedef BTree_InternalNode<NcType>                      InternalNode;
+
+    // DATA
+    Node *d_node_p;  // node of the current position
+    int   d_index;   // index of the current position in 'd_node_p'
+
+    // FRIENDS
+    template <class VALUE1, class VALUE2, class DIFF>
+    friend bool operator==(const BTreeIterator<VALUE1, DIFF>&,
+                           const BTreeIterator<VALUE2, DIFF>&);
+
+    template <class OTHER_VALUE, class OTHER_DIFFERENCE_TYPE>
+    friend class BTreeIterator;
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::bidirectional_iterator_tag iterator_category;
+    typedef NcType                          value_type;
+    typedef DIFFERENCE_TYPE                 difference_type;
+    typedef VALUE*                          pointer;
+    typedef VALUE&                          reference;
+        // Standard iterator defined types [24.4.2].
+
+    // CREATORS
+    BTreeIterator();
+        // Create an iterator referring to no node.
+
+    BTreeIterator(const Node *node, int index);
+        // Create an iterator at the specified 'index' in the specified 'node'.
+        // Note that this constructor is an implementation detail and is not
+        // part of the C++ standard.
+
+    BTreeIterator(const NcIter& original);
+        // Create an iterator at the same position as the specified 'original'
+        // iterator.  Note that this constructor enables converting from
+        // modifiable to const iterator types.
+
+    //! BTreeIterator(const BTreeIterator& original) = default;
+        // Create an iterator having the same value as the specified
+        // 'original'.  Note that this operation is either defined by the
+        // constructor taking 'NcIter' (if 'NcType' is the same as 'VALUE'), or
+        // generated automatically by the compiler.
+
+    //! ~BTreeIterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! BTreeIterator& operator=(const BTreeIterator& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // a return a reference providing modifiable access to this object.
+
+    BTreeIterator& operator++();
+        // Move this iterator to the next value in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless the iterator refers to a value in the
+        // tree.
+
+    BTreeIterator& operator--();
+        // Move this iterator to the previous value in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless the iterator refers to the past-the-end
+        // position or a value other than the first in a non-empty tree.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference providing modifiable access to the value (of the
+        // parameterized 'VALUE') at which this iterator is positioned.  The
+        // behavior is undefined unless this iterator is at a valid position in
+        // the tree.
+
+    pointer operator->() const;
+        // Return the address of the value (of the parameterized 'VALUE') at
+        // which this iterator is positioned.  The behavior is undefined unless
+        // this iterator is at a valid position in the tree.
+
+    Node *node() const;
+        // Return the address of the node at which this iterator is
+        // positioned, or 0 if this iterator refers to no node.  Note that this
+        // method is an implementation detail and is not part of the C++
+        // standard.
+
+    int index() const;
+        // Return the index, in its node, of the position of this iterator.
+        // Note that this method is an implementation detail and is not part
+        // of the C++ standard.
+};
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class DIFF>
+bool operator==(const BTreeIterator<VALUE1, DIFF>& lhs,
+                const BTreeIterator<VALUE2, DIFF>& rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // have the same value and 'false' otherwise.  Two iterators have the same
+    // value if they refer to the same position in the same tree.
+
+template <class VALUE1, class VALUE2, class DIFF>
+bool operator!=(const BTreeIterator<VALUE1, DIFF>& lhs,
+                const BTreeIterator<VALUE2, DIFF>& rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // do not have the same value and 'false' otherwise.  Two iterators do not
+    // have the same value if they differ in either the tree to which they
+    // refer or the position in that tree.
+
+template <class VALUE, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE, DIFFERENCE_TYPE>
+operator++(BTreeIterator<VALUE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the next value in the tree and return the
+    // value of 'iter' prior to this call.  The behavior is undefined unless
+    // the iterator refers to a value in the tree.
+
+template <class VALUE, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE, DIFFERENCE_TYPE>
+operator--(BTreeIterator<VALUE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the previous value in the tree and return
+    // the value of 'iter' prior to this call.  The behavior is undefined
+    // unless the iterator refers to the past-the-end position or a value
+    // other than the first in a non-empty tree.
+
+                                // ===========
+                                // class BTree
+                                // ===========
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class BTree : private bslalg::ContainerBase<ALLOCATOR> {
+    // This class template implements an ordered sequence of values, of type
+    // 'KEY_CONFIG::ValueType', having unique keys, of type
+    // 'KEY_CONFIG::KeyType', ordered by the (template parameter) type
+    // 'COMPARATOR', held in a B-tree whose nodes are allocated by the
+    // (template parameter) type 'ALLOCATOR'.  See {Structure of the Tree}.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType                   KeyType;
+    typedef typename KEY_CONFIG::ValueType                 ValueType;
+    typedef bsl::allocator_traits<ALLOCATOR>               AllocatorTraits;
+    typedef typename AllocatorTraits::size_type            SizeType;
+    typedef typename AllocatorTraits::difference_type      DifferenceType;
+    typedef BTreeIterator<ValueType, DifferenceType>       Iterator;
+    typedef BTreeIterator<const ValueType, DifferenceType> ConstIterator;
+    typedef BTree_Node<ValueType>                          Node;
+    typedef BTree_InternalNode<ValueType>                  InternalNode;
+
+  private:
+    // PRIVATE TYPES
+    typedef bslalg::ContainerBase<ALLOCATOR>               Base;
+
+    enum {
+        k_MAX_HEIGHT = 8 * sizeof(SizeType)
+            // upper bound on the number of levels of a tree (every internal
+            // node has at least two children)
+    };
+
+    class NodeProctor;
+    class SpareNodes;
+
+    // DATA
+    Node       *d_root_p;       // root node, or 0 if empty
+    Node       *d_leftmost_p;   // leftmost leaf node, or 0 if empty
+    Node       *d_rightmost_p;  // rightmost leaf node, or 0 if empty
+    SizeType    d_numValues;    // number of values held
+    COMPARATOR  d_comparator;   // key comparator
+
+    // PRIVATE CLASS METHODS
+    static Node *& child(Node *node, int index);
+        // Return a reference providing modifiable access to the child at the
+        // specified 'index' of the specified internal 'node'.
+
+    static void setChild(Node *node, int index, Node *childNode);
+        // Make the specified 'childNode' the child at the specified 'index' of
+        // the specified internal 'node'.
+
+    // PRIVATE MANIPULATORS
+    Node *createNode(bool isLeaf);
+        // Allocate an empty leaf node if the specified 'isLeaf' is 'true', and
+        // an empty internal node otherwise, and return its address.
+
+    void deleteNode(Node *node);
+        // Deallocate the specified 'node', without destroying its values.
+
+    void destroyTree(Node *node);
+        // Destroy the values of, and deallocate, the specified 'node' and
+        // all its descendants.  Children of an internal node that are 0 are
+        // ignored.
+
+    Node *copyTree(const Node *original);
+        // Return the address of a new node holding a copy of the values of
+        // the specified 'original' node, and having children that are copies
+        // of the children of 'original'.
+
+    void moveValues(ValueType *to, ValueType *from, int numValues);
+        // Move the specified 'numValues' values starting at the specified
+        // 'from' address to the (possibly overlapping) array starting at the
+        // specified 'to' address, leaving the elements of the source array
+        // that are not part of the destination array uninitialized.
+
+    void insertIntoNode(Node      *node,
+                        int        index,
+                        ValueType *value,
+                        Node      *rightChild);
+        // Move the specified 'value' to the specified 'index' of the
+        // specified 'node', which must not be full, shifting the following
+        // values, and, if 'node' is internal, make the specified 'rightChild'
+        // the child following 'value'.
+
+    int splitNode(Node       *node,
+                  Node       *sibling,
+                  int         index,
+                  ValueType  *value,
+                  Node       *rightChild,
+                  ValueType  *median);
+        // Split the specified full 'node' into 'node' and the specified empty
+        // 'sibling', inserting the specified 'value', and, if 'node' is
+        // internal, the specified 'rightChild' following it, at the specified
+        // 'index', and moving the median value to the specified 'median'.
+        // Return the index of 'value' in 'node' if it is in 'node', the
+        // negative of one more than its index in 'sibling' if it is in
+        // 'sibling', and 'k_CAPACITY + 1' if 'value' is the median.
+
+    void rebalance(Node *node, Node **trackedNode, int *trackedIndex);
+        // Restore the minimum number of values of the specified 'node' and
+        // its ancestors, by taking values from, or merging with, sibling
+        // nodes, updating the position specified by 'trackedNode' and
+        // 'trackedIndex' as the value at that position (or the past-the-end
+        // position of a node) is moved.
+
+    void quickSwap(BTree& other);
+        // Exchange the value of this tree with that of the specified 'other',
+        // without regard for their allocators.
+
+    void updateExtremes();
+        // Set the leftmost and rightmost leaf nodes of this tree.
+
+    // PRIVATE ACCESSORS
+    int lowerBoundIndex(const Node *node, const KeyType& key) const;
+        // Return the index of the first value of the specified 'node' whose
+        // key is not ordered before the specified 'key', or the number of
+        // values of 'node' if there is no such value.
+
+    int upperBoundIndex(const Node *node, const KeyType& key) const;
+        // Return the index of the first value of the specified 'node' whose
+        // key is ordered after the specified 'key', or the number of values
+        // of 'node' if there is no such value.
+
+    int checkNode(const Node     *node,
+                  const KeyType  *lowerKey,
+                  const KeyType  *upperKey,
+                  SizeType       *numValues) const;
+        // Return the height of the subtree rooted at the specified 'node' if
+        // it is well formed, its keys are ordered after the optionally
+        // specified 'lowerKey' and before the optionally specified 'upperKey'
+        // (each of which is ignored if 0), and add the number of values of
+        // the subtree to the specified 'numValues'; return -1 otherwise.
+
+  private:
+    // NOT IMPLEMENTED
+    BTree(const BTree&);
+
+  public:
+    // CREATORS
+    BTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+        // Create an empty tree ordering its keys with the specified
+        // 'comparator' and using the specified 'allocator' to supply memory.
+
+    BTree(const BTree& original, const ALLOCATOR& allocator);
+        // Create a tree having the same values, and the same structure, as
+        // the specified 'original', ordering its keys with a copy of the
+        // comparator of 'original' and using the specified 'allocator' to
+        // supply memory.
+
+    ~BTree();
+        // Destroy this object.
+
+    // MANIPULATORS
+    BTree& operator=(const BTree& rhs);
+        // Assign to this object the values and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    bsl::pair<Iterator, bool> insert(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if its key is
+        // not already present.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) value having
+        // the key of 'value', and whose 'second' member is 'true' if 'value'
+        // was inserted and 'false' otherwise.  This operation takes O[log(N)]
+        // comparisons and O[k_CAPACITY * log(N)] moves of values in the worst
+        // case, where N is the size of this tree, and invalidates all
+        // iterators to this tree if 'value' is inserted.
+
+    Iterator erase(ConstIterator position);
+        // Remove from this tree the value at the specified 'position', and
+        // return an iterator referring to the value that followed it, or the
+        // past-the-end iterator if it was the last value.  This operation
+        // takes O[k_CAPACITY * log(N)] moves of values in the worst case,
+        // where N is the size of this tree, and invalidates all iterators to
+        // this tree.  The behavior is undefined unless 'position' refers to a
+        // value in this tree.
+
+    void clear();
+        // Remove all values from this tree, and release all its nodes.
+
+    void swap(BTree& other);
+        // Exchange the values and comparator of this tree with those of the
+        // specified 'other'.  This method does not allocate memory (and does
+        // not throw) if both trees use the same allocator, and copies the
+        // values of each tree otherwise.
+
+    Iterator begin();
+        // Return an iterator referring to the first value of this tree, or
+        // the past-the-end iterator if this tree is empty.
+
+    Iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    Iterator find(const KeyType& key);
+        // Return an iterator referring to the value of this tree having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    Iterator lowerBound(const KeyType& key);
+        // Return an iterator referring to the first value of this tree whose
+        // key is not ordered before the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    Iterator upperBound(const KeyType& key);
+        // Return an iterator referring to the first value of this tree whose
+        // key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    // ACCESSORS
+    const ALLOCATOR& allocator() const;
+        // Return a reference providing non-modifiable access to the allocator
+        // of this tree.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // comparator of this tree.
+
+    ConstIterator begin() const;
+        // Return an iterator referring to the first value of this tree, or
+        // the past-the-end iterator if this tree is empty.
+
+    ConstIterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    ConstIterator find(const KeyType& key) const;
+        // Return an iterator referring to the value of this tree having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    ConstIterator lowerBound(const KeyType& key) const;
+        // Return an iterator referring to the first value of this tree whose
+        // key is not ordered before the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    ConstIterator upperBound(const KeyType& key) const;
+        // Return an iterator referring to the first value of this tree whose
+        // key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    SizeType size() const;
+        // Return the number of values held by this tree.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of values that this
+        // tree could hold.
+
+    int height() const;
+        // Return the number of levels of this tree (0 if it is empty).
+
+    bool isWellFormed() const;
+        // Return 'true' if this tree satisfies the invariants of a B-tree:
+        // the keys of the values are ordered, and unique; the nodes other
+        // than the root hold at least 'Node::k_MIN_VALUES' values; all the
+        // leaf nodes are at the same depth; each node refers to its parent
+        // and its position therein; and the size, and the leftmost and
+        // rightmost leaf nodes, of the tree are recorded correctly.  Return
+        // 'false' otherwise.  Note that this method takes linear time, and is
+        // intended for testing.
+};
+
+                       // =============================
+                       // class BTree<...>::NodeProctor
+                       // =============================
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeProctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // been called, destroys a managed (possibly partially built) subtree of a
+    // 'BTree' upon its own destruction.
+
+    // DATA
+    BTree *d_tree_p;  // tree owning the node
+    Node  *d_node_p;  // managed node, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    NodeProctor(const NodeProctor&);
+    NodeProctor& operator=(const NodeProctor&);
+
+  public:
+    // CREATORS
+    NodeProctor(BTree *tree, Node *node)
+        // Create a proctor managing the specified 'node' of the specified
+        // 'tree'.
+    : d_tree_p(tree)
+    , d_node_p(node)
+    {
+    }
+
+    ~NodeProctor()
+        // Destroy the managed subtree, if any, and this object.
+    {
+        if (d_node_p) {
+            d_tree_p->destroyTree(d_node_p);
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release from management the subtree managed by this proctor.
+    {
+        d_node_p = 0;
+    }
+};
+
+                        // ============================
+                        // class BTree<...>::SpareNodes
+                        // ============================
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SpareNodes {
+    // This class holds the empty nodes allocated to split the full nodes on
+    // the path of an insertion, and deallocates those not taken upon its own
+    // destruction.
+
+    // DATA
+    BTree *d_tree_p;                    // tree owning the nodes
+    Node  *d_nodes_p[k_MAX_HEIGHT + 1]; // spare nodes
+    int    d_numNodes;                  // number of spare nodes allocated
+    int    d_numTaken;                  // number of spare nodes taken
+
+  private:
+    // NOT IMPLEMENTED
+    SpareNodes(const SpareNodes&);
+    SpareNodes& operator=(const SpareNodes&);
+
+  public:
+    // CREATORS
+    explicit SpareNodes(BTree *tree)
+        // Create an empty set of spare nodes of the specified 'tree'.
+    : d_tree_p(tree)
+    , d_numNodes(0)
+    , d_numTaken(0)
+    {
+    }
+
+    ~SpareNodes()
+        // Deallocate the nodes that have not been taken, and destroy this
+        // object.
+    {
+        while (d_numTaken < d_numNodes) {
+            d_tree_p->deleteNode(d_nodes_p[d_numTaken++]);
+        }
+    }
+
+    // MANIPULATORS
+    void allocate(bool isLeaf)
+        // Allocate a spare leaf node if the specified 'isLeaf' is 'true', and
+        // a spare internal node otherwise.
+    {
+        d_nodes_p[d_numNodes] = d_tree_p->createNode(isLeaf);
+        ++d_numNodes;
+    }
+
+    Node *take()
+        // Return the address of the next spare node, in the order they were
+        // allocated.  The behavior is undefined unless a node remains.
+    {
+        BSLS_ASSERT_SAFE(d_numTaken < d_numNodes);
+
+        return d_nodes_p[d_numTaken++];
+    }
+};
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                             // -----------------
+                             // struct BTree_Node
+                             // -----------------
+
+// MANIPULATORS
+template <class VALUE>
+inline
+VALUE *BTree_Node<VALUE>::values()
+{
+    return &d_values[0].object();
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+const VALUE *BTree_Node<VALUE>::values() const
+{
+    return &d_values[0].object();
+}
+
+                            // -------------------
+                            // class BTreeIterator
+                            // -------------------
+
+// CREATORS
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::BTreeIterator()
+: d_node_p(0)
+, d_index(0)
+{
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::BTreeIterator(const Node *node,
+                                                     int         index)
+: d_node_p(const_cast<Node *>(node))
+, d_index(index)
+{
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::BTreeIterator(const NcIter& original)
+: d_node_p(original.d_node_p)
+, d_index(original.d_index)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE, DIFFERENCE_TYPE>&
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_index < d_node_p->d_numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_node_p->d_isLeaf)) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                      ++d_index < d_node_p->d_numValues)) {
+            return *this;                                             // RETURN
+        }
+
+        // Past the last value of a leaf: the next value is in the nearest
+        // ancestor of which this leaf is not in the last subtree, and, if
+        // there is none, this iterator is at the past-the-end position.
+
+        for (Node *node = d_node_p; node->d_parent_p; ) {
+            const int position = node->d_position;
+            node = node->d_parent_p;
+            if (position < node->d_numValues) {
+                d_node_p = node;
+                d_index  = position;
+                return *this;                                         // RETURN
+            }
+        }
+        return *this;                                                 // RETURN
+    }
+
+    Node *node = static_cast<InternalNode *>(d_node_p)->d_children[
+                                                                 d_index + 1];
+    while (!node->d_isLeaf) {
+        node = static_cast<InternalNode *>(node)->d_children[0];
+    }
+    d_node_p = node;
+    d_index  = 0;
+    return *this;
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE, DIFFERENCE_TYPE>&
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_node_p->d_isLeaf)) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 < d_index)) {
+            --d_index;
+            return *this;                                             // RETURN
+        }
+
+        Node *node = d_node_p;
+        while (0 == node->d_position) {
+            BSLS_ASSERT_SAFE(node->d_parent_p);
+
+            node = node->d_parent_p;
+        }
+        d_index  = node->d_position - 1;
+        d_node_p = node->d_parent_p;
+        return *this;                                                 // RETURN
+    }
+
+    Node *node = static_cast<InternalNode *>(d_node_p)->d_children[d_index];
+    while (!node->d_isLeaf) {
+        node = static_cast<InternalNode *>(node)->d_children[
+                                                            node->d_numValues];
+    }
+    d_node_p = node;
+    d_index  = node->d_numValues - 1;
+    return *this;
+}
+
+// ACCESSORS
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+typename BTreeIterator<VALUE, DIFFERENCE_TYPE>::reference
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_index < d_node_p->d_numValues);
+
+    return d_node_p->values()[d_index];
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+typename BTreeIterator<VALUE, DIFFERENCE_TYPE>::pointer
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_index < d_node_p->d_numValues);
+
+    return d_node_p->values() + d_index;
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+typename BTreeIterator<VALUE, DIFFERENCE_TYPE>::Node *
+BTreeIterator<VALUE, DIFFERENCE_TYPE>::node() const
+{
+    return d_node_p;
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+int BTreeIterator<VALUE, DIFFERENCE_TYPE>::index() const
+{
+    return d_index;
+}
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class DIFF>
+inline
+bool operator==(const BTreeIterator<VALUE1, DIFF>& lhs,
+                const BTreeIterator<VALUE2, DIFF>& rhs)
+{
+    return lhs.d_node_p == rhs.d_node_p && lhs.d_index == rhs.d_index;
+}
+
+template <class VALUE1, class VALUE2, class DIFF>
+inline
+bool operator!=(const BTreeIterator<VALUE1, DIFF>& lhs,
+                const BTreeIterator<VALUE2, DIFF>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, DIFFERENCE_TYPE>
+operator++(BTreeIterator<VALUE, DIFFERENCE_TYPE>& iter, int)
+{
+    BTreeIterator<VALUE, DIFFERENCE_TYPE> temp = iter;
+    ++iter;
+    return temp;
+}
+
+template <class VALUE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, DIFFERENCE_TYPE>
+operator--(BTreeIterator<VALUE, DIFFERENCE_TYPE>& iter, int)
+{
+    BTreeIterator<VALUE, DIFFERENCE_TYPE> temp = iter;
+    --iter;
+    return temp;
+}
+
+                                // -----------
+                                // class BTree
+                                // -----------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Node *&
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::child(Node *node, int index)
+{
+    BSLS_ASSERT_SAFE(!node->d_isLeaf);
+
+    return static_cast<InternalNode *>(node)->d_children[index];
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::setChild(Node *node,
+                                                        int   index,
+                                                        Node *childNode)
+{
+    child(node, index)       = childNode;
+    childNode->d_parent_p    = static_cast<InternalNode *>(node);
+    childNode->d_position    = static_cast<unsigned short>(index);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Node *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::createNode(bool isLeaf)
+{
+    Node *node = isLeaf
+               ? this->allocateN(static_cast<Node *>(0), 1)
+               : this->allocateN(static_cast<InternalNode *>(0), 1);
+    node->d_parent_p  = 0;
+    node->d_position  = 0;
+    node->d_numValues = 0;
+    node->d_isLeaf    = isLeaf;
+    return node;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deleteNode(Node *node)
+{
+    if (node->d_isLeaf) {
+        this->deallocateN(node, 1);
+    }
+    else {
+        this->deallocateN(static_cast<InternalNode *>(node), 1);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::destroyTree(Node *node)
+{
+    if (!node->d_isLeaf) {
+        for (int i = 0; i <= node->d_numValues; ++i) {
+            if (child(node, i)) {
+                destroyTree(child(node, i));
+            }
+        }
+    }
+    bslalg::ArrayDestructionPrimitives::destroy(
+                                        node->values(),
+                                        node->values() + node->d_numValues);
+    deleteNode(node);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Node *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::copyTree(const Node *original)
+{
+    Node        *node = createNode(original->d_isLeaf);
+    NodeProctor  proctor(this, node);
+
+    const int numValues = original->d_numValues;
+    if (!node->d_isLeaf) {
+        for (int i = 0; i <= numValues; ++i) {
+            child(node, i) = 0;
+        }
+    }
+    for (int i = 0; i < numValues; ++i) {
+        bslalg::ScalarPrimitives::copyConstruct(node->values() + i,
+                                                original->values()[i],
+                                                this->bslmaAllocator());
+        ++node->d_numValues;
+    }
+    if (!node->d_isLeaf) {
+        for (int i = 0; i <= numValues; ++i) {
+            setChild(node,
+                     i,
+                     copyTree(child(const_cast<Node *>(original), i)));
+        }
+    }
+    proctor.release();
+    return node;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::moveValues(
+                                                        ValueType *to,
+                                                        ValueType *from,
+                                                        int        numValues)
+{
+    if (bslmf::IsBitwiseMoveable<ValueType>::value) {
+        std::memmove(static_cast<void *>(to),
+                     static_cast<const void *>(from),
+                     numValues * sizeof(ValueType));
+    }
+    else if (to < from) {
+        for (int i = 0; i < numValues; ++i) {
+            bslalg::ScalarPrimitives::destructiveMove(to + i,
+                                                      from + i,
+                                                      this->bslmaAllocator());
+        }
+    }
+    else {
+        for (int i = numValues - 1; i >= 0; --i) {
+            bslalg::ScalarPrimitives::destructiveMove(to + i,
+                                                      from + i,
+                                                      this->bslmaAllocator());
+        }
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIntoNode(
+                                                        Node      *node,
+                                                        int        index,
+                                                        ValueType *value,
+                                                        Node      *rightChild)
+{
+    BSLS_ASSERT_SAFE(node->d_numValues < Node::k_CAPACITY);
+
+    const int  numValues = node->d_numValues;
+    ValueType *values    = node->values();
+
+    moveValues(values + index + 1, values + index, numValues - index);
+    moveValues(values + index, value, 1);
+
+    if (!node->d_isLeaf) {
+        for (int i = numValues; i > index; --i) {
+            setChild(node, i + 1, child(node, i));
+        }
+        setChild(node, index + 1, rightChild);
+    }
+    ++node->d_numValues;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::splitNode(
+                                                       Node       *node,
+                                                       Node       *sibling,
+                                                       int         index,
+                                                       ValueType  *value,
+                                                       Node       *rightChild,
+                                                       ValueType  *median)
+{
+    BSLS_ASSERT_SAFE(Node::k_CAPACITY == node->d_numValues);
+    BSLS_ASSERT_SAFE(0 == sibling->d_numValues);
+    BSLS_ASSERT_SAFE(node->d_isLeaf == sibling->d_isLeaf);
+
+    // Consider the sequence of 'k_CAPACITY + 1' values formed by inserting
+    // 'value' at 'index': the first 'MIDDLE' values remain in 'node', the
+    // next is the median, and the rest move to 'sibling'.
+
+    const int  CAPACITY = Node::k_CAPACITY;
+    const int  MIDDLE   = (CAPACITY + 1) / 2;
+    ValueType *values   = node->values();
+    int        result;
+
+    if (index < MIDDLE) {
+        moveValues(sibling->values(), values + MIDDLE, CAPACITY - MIDDLE);
+        moveValues(median, values + MIDDLE - 1, 1);
+        moveValues(values + index + 1, values + index, MIDDLE - 1 - index);
+        moveValues(values + index, value, 1);
+        result = index;
+    }
+    else if (index == MIDDLE) {
+        moveValues(sibling->values(), values + MIDDLE, CAPACITY - MIDDLE);
+        moveValues(median, value, 1);
+        result = CAPACITY + 1;
+    }
+    else {
+        ValueType *siblingValues = sibling->values();
+        moveValues(siblingValues, values + MIDDLE + 1, index - MIDDLE - 1);
+        moveValues(siblingValues + index - MIDDLE - 1, value, 1);
+        moveValues(siblingValues + index - MIDDLE,
+                   values + index,
+                   CAPACITY - index);
+        moveValues(median, values + MIDDLE, 1);
+        result = -(index - MIDDLE);
+    }
+    node->d_numValues    = static_cast<unsigned short>(MIDDLE);
+    sibling->d_numValues = static_cast<unsigned short>(CAPACITY - MIDDLE);
+
+    if (!node->d_isLeaf) {
+        // Distribute the 'k_CAPACITY + 2' children, including 'rightChild'
+        // following 'value', likewise.
+
+        Node *children[Node::k_CAPACITY + 2];
+        for (int i = 0; i <= CAPACITY; ++i) {
+            children[i < index + 1 ? i : i + 1] = child(node, i);
+        }
+        children[index + 1] = rightChild;
+
+        for (int i = 0; i <= MIDDLE; ++i) {
+            setChild(node, i, children[i]);
+        }
+        for (int i = 0; i <= CAPACITY - MIDDLE; ++i) {
+            setChild(sibling, i, children[MIDDLE + 1 + i]);
+        }
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::rebalance(
+                                                       Node  *node,
+                                                       Node **trackedNode,
+                                                       int   *trackedIndex)
+{
+    const int MIN_VALUES = Node::k_MIN_VALUES;
+
+    while (node != d_root_p && node->d_numValues < MIN_VALUES) {
+        Node      *parent   = node->d_parent_p;
+        const int  position = node->d_position;
+
+        Node *left  = 0 < position ? child(parent, position - 1) : 0;
+        Node *right = position < parent->d_numValues
+                    ? child(parent, position + 1)
+                    : 0;
+
+        if (left && MIN_VALUES < left->d_numValues) {
+            // Rotate the last value of 'left' into 'parent', and the
+            // separating value of 'parent' into 'node'.
+
+            const int  numLeft   = left->d_numValues;
+            const int  numValues = node->d_numValues;
+            ValueType *values    = node->values();
+
+            moveValues(values + 1, values, numValues);
+            moveValues(values, parent->values() + position - 1, 1);
+            moveValues(parent->values() + position - 1,
+                       left->values() + numLeft - 1,
+                       1);
+            if (!node->d_isLeaf) {
+                for (int i = numValues; i >= 0; --i) {
+                    setChild(node, i + 1, child(node, i));
+                }
+                setChild(node, 0, child(left, numLeft));
+            }
+            --left->d_numValues;
+            ++node->d_numValues;
+
+            if (*trackedNode == node) {
+                ++*trackedIndex;
+            }
+            else if (*trackedNode == parent && *trackedIndex == position - 1) {
+                *trackedNode  = node;
+                *trackedIndex = 0;
+            }
+            else if (*trackedNode == left && *trackedIndex == numLeft - 1) {
+                *trackedNode  = parent;
+                *trackedIndex = position - 1;
+            }
+            return;                                                   // RETURN
+        }
+
+        if (right && MIN_VALUES < right->d_numValues) {
+            // Rotate the separating value of 'parent' into 'node', and the
+            // first value of 'right' into 'parent'.
+
+            const int  numRight  = right->d_numValues;
+            const int  numValues = node->d_numValues;
+            ValueType *values    = right->values();
+
+            moveValues(node->values() + numValues,
+                       parent->values() + position,
+                       1);
+            moveValues(parent->values() + position, values, 1);
+            moveValues(values, values + 1, numRight - 1);
+            if (!node->d_isLeaf) {
+                setChild(node, numValues + 1, child(right, 0));
+                for (int i = 0; i < numRight; ++i) {
+                    setChild(right, i, child(right, i + 1));
+                }
+            }
+            ++node->d_numValues;
+            --right->d_numValues;
+
+            if (*trackedNode == parent && *trackedIndex == position) {
+                *trackedNode  = node;
+                *trackedIndex = numValues;
+            }
+            else if (*trackedNode == right) {
+                if (0 == *trackedIndex) {
+                    *trackedNode  = parent;
+                    *trackedIndex = position;
+                }
+                else {
+                    --*trackedIndex;
+                }
+            }
+            return;                                                   // RETURN
+        }
+
+        // Merge 'node' with a sibling, and the separating value of 'parent',
+        // into the left one of the two.
+
+        const int separator = left ? position - 1 : position;
+        if (left) {
+            right = node;
+        }
+        else {
+            left = node;
+        }
+
+        const int numLeft   = left->d_numValues;
+        const int numRight  = right->d_numValues;
+        const int numParent = parent->d_numValues;
+
+        moveValues(left->values() + numLeft, parent->values() + separator, 1);
+        moveValues(left->values() + numLeft + 1, right->values(), numRight);
+        if (!left->d_isLeaf) {
+            for (int i = 0; i <= numRight; ++i) {
+                setChild(left, numLeft + 1 + i, child(right, i));
+            }
+        }
+        left->d_numValues = static_cast<unsigned short>(
+                                                    numLeft + 1 + numRight);
+        right->d_numValues = 0;
+
+        moveValues(parent->values() + separator,
+                   parent->values() + separator + 1,
+                   numParent - separator - 1);
+        for (int i = separator + 1; i < numParent; ++i) {
+            setChild(parent, i, child(parent, i + 1));
+        }
+        --parent->d_numValues;
+        deleteNode(right);
+
+        if (*trackedNode == parent) {
+            if (*trackedIndex == separator) {
+                *trackedNode  = left;
+                *trackedIndex = numLeft;
+            }
+            else if (*trackedIndex > separator) {
+                --*trackedIndex;
+            }
+        }
+        else if (*trackedNode == right) {
+            *trackedNode   = left;
+            *trackedIndex += numLeft + 1;
+        }
+
+        node = parent;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::quickSwap(BTree& other)
+{
+    bslalg::SwapUtil::swap(&d_root_p,      &other.d_root_p);
+    bslalg::SwapUtil::swap(&d_leftmost_p,  &other.d_leftmost_p);
+    bslalg::SwapUtil::swap(&d_rightmost_p, &other.d_rightmost_p);
+    bslalg::SwapUtil::swap(&d_numValues,   &other.d_numValues);
+    bslalg::SwapUtil::swap(&d_comparator,  &other.d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::updateExtremes()
+{
+    if (!d_root_p) {
+        d_leftmost_p = d_rightmost_p = 0;
+        return;                                                       // RETURN
+    }
+
+    Node *node = d_root_p;
+    while (!node->d_isLeaf) {
+        node = child(node, 0);
+    }
+    d_leftmost_p = node;
+
+    node = d_root_p;
+    while (!node->d_isLeaf) {
+        node = child(node, node->d_numValues);
+    }
+    d_rightmost_p = node;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBoundIndex(
+                                                  const Node     *node,
+                                                  const KeyType&  key) const
+{
+    const ValueType *values = node->values();
+    int              first  = 0;
+    int              count  = node->d_numValues;
+
+    while (0 < count) {
+        const int half = count / 2;
+        if (d_comparator(KEY_CONFIG::extractKey(values[first + half]), key)) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBoundIndex(
+                                                  const Node     *node,
+                                                  const KeyType&  key) const
+{
+    const ValueType *values = node->values();
+    int              first  = 0;
+    int              count  = node->d_numValues;
+
+    while (0 < count) {
+        const int half = count / 2;
+        if (!d_comparator(key,
+                          KEY_CONFIG::extractKey(values[first + half]))) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::checkNode(
+                                               const Node     *node,
+                                               const KeyType  *lowerKey,
+                                               const KeyType  *upperKey,
+                                               SizeType       *numValues) const
+{
+    const int numNodeValues = node->d_numValues;
+
+    if (numNodeValues > Node::k_CAPACITY
+     || (node != d_root_p && numNodeValues < Node::k_MIN_VALUES)
+     || 0 == numNodeValues) {
+        return -1;                                                    // RETURN
+    }
+
+    const ValueType *values = node->values();
+    for (int i = 0; i < numNodeValues; ++i) {
+        const KeyType& key = KEY_CONFIG::extractKey(values[i]);
+        if ((0 < i
+          && !d_comparator(KEY_CONFIG::extractKey(values[i - 1]), key))
+         || (lowerKey && !d_comparator(*lowerKey, key))
+         || (upperKey && !d_comparator(key, *upperKey))) {
+            return -1;                                                // RETURN
+        }
+    }
+    *numValues += numNodeValues;
+
+    if (node->d_isLeaf) {
+        return 1;                                                     // RETURN
+    }
+
+    int height = -1;
+    for (int i = 0; i <= numNodeValues; ++i) {
+        const Node *childNode = child(const_cast<Node *>(node), i);
+        if (childNode->d_parent_p != node || childNode->d_position != i) {
+            return -1;                                                // RETURN
+        }
+        const int childHeight = checkNode(
+                    childNode,
+                    0 < i ? &KEY_CONFIG::extractKey(values[i - 1]) : lowerKey,
+                    i < numNodeValues
+                    ? &KEY_CONFIG::extractKey(values[i])
+                    : upperKey,
+                    numValues);
+        if (childHeight < 0 || (0 < i && childHeight != height)) {
+            return -1;                                                // RETURN
+        }
+        height = childHeight;
+    }
+    return height + 1;
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::BTree(const COMPARATOR& comparator,
+                                                const ALLOCATOR&  allocator)
+: Base(allocator)
+, d_root_p(0)
+, d_leftmost_p(0)
+, d_rightmost_p(0)
+, d_numValues(0)
+, d_comparator(comparator)
+{
+    BSLMF_ASSERT(sizeof(bsls::ObjectBuffer<ValueType>) == sizeof(ValueType));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::BTree(const BTree&     original,
+                                                const ALLOCATOR& allocator)
+: Base(allocator)
+, d_root_p(0)
+, d_leftmost_p(0)
+, d_rightmost_p(0)
+, d_numValues(0)
+, d_comparator(original.d_comparator)
+{
+    if (original.d_root_p) {
+        d_root_p    = copyTree(original.d_root_p);
+        d_numValues = original.d_numValues;
+        updateExtremes();
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::~BTree()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const BTree& rhs)
+{
+    if (this != &rhs) {
+        BTree other(rhs, Base::allocator());
+        quickSwap(other);
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(const ValueType& value)
+{
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    if (!d_root_p) {
+        Node        *leaf = createNode(true);
+        NodeProctor  proctor(this, leaf);
+
+        bslalg::ScalarPrimitives::copyConstruct(leaf->values(),
+                                                value,
+                                                this->bslmaAllocator());
+        leaf->d_numValues = 1;
+        proctor.release();
+
+        d_root_p = d_leftmost_p = d_rightmost_p = leaf;
+        d_numValues = 1;
+        return bsl::pair<Iterator, bool>(Iterator(leaf, 0), true);    // RETURN
+    }
+
+    // Find the leaf, and the index in that leaf, at which to insert 'value',
+    // unless its key is already present.
+
+    Node *node = d_root_p;
+    int   index;
+    for (;;) {
+        index = lowerBoundIndex(node, key);
+        if (index < node->d_numValues
+         && !d_comparator(key,
+                          KEY_CONFIG::extractKey(node->values()[index]))) {
+            return bsl::pair<Iterator, bool>(Iterator(node, index),
+                                             false);                  // RETURN
+        }
+        if (node->d_isLeaf) {
+            break;
+        }
+        node = child(node, index);
+    }
+
+    // Allocate the nodes needed to split the full nodes on the path from the
+    // leaf, and a new root if all of them are full, and copy 'value', before
+    // modifying the tree.
+
+    SpareNodes spares(this);
+    {
+        const Node *full = node;
+        while (full && Node::k_CAPACITY == full->d_numValues) {
+            spares.allocate(full->d_isLeaf);
+            full = full->d_parent_p;
+        }
+        if (!full) {
+            spares.allocate(false);
+        }
+    }
+
+    bsls::ObjectBuffer<ValueType> buffers[2];
+    ValueType *inHand = &buffers[0].object();
+    ValueType *median = &buffers[1].object();
+
+    bslalg::ScalarPrimitives::copyConstruct(inHand,
+                                            value,
+                                            this->bslmaAllocator());
+
+    // Insert the value in hand, splitting full nodes and moving their median
+    // values up the tree, while tracking the position of 'value'.
+
+    Node *rightChild  = 0;
+    Node *trackedNode = 0;
+    int   trackedIndex = 0;
+    bool  isTracking   = true;
+
+    for (;;) {
+        if (node->d_numValues < Node::k_CAPACITY) {
+            insertIntoNode(node, index, inHand, rightChild);
+            if (isTracking) {
+                trackedNode  = node;
+                trackedIndex = index;
+            }
+            break;
+        }
+
+        Node      *sibling  = spares.take();
+        const int  location = splitNode(node,
+                                        sibling,
+                                        index,
+                                        inHand,
+                                        rightChild,
+                                        median);
+        if (isTracking) {
+            if (Node::k_CAPACITY + 1 == location) {
+                // 'value' is the median: keep tracking it up the tree
+            }
+            else if (0 <= location) {
+                trackedNode  = node;
+                trackedIndex = location;
+                isTracking   = false;
+            }
+            else {
+                trackedNode  = sibling;
+                trackedIndex = -location - 1;
+                isTracking   = false;
+            }
+        }
+        if (node == d_rightmost_p) {
+            d_rightmost_p = sibling;
+        }
+
+        bslalg::SwapUtil::swap(&inHand, &median);
+        rightChild = sibling;
+
+        if (!node->d_parent_p) {
+            Node *root = spares.take();
+            moveValues(root->values(), inHand, 1);
+            root->d_numValues = 1;
+            setChild(root, 0, node);
+            setChild(root, 1, rightChild);
+            d_root_p = root;
+            if (isTracking) {
+                trackedNode  = root;
+                trackedIndex = 0;
+            }
+            break;
+        }
+        index = node->d_position;
+        node  = node->d_parent_p;
+    }
+    ++d_numValues;
+
+    return bsl::pair<Iterator, bool>(Iterator(trackedNode, trackedIndex),
+                                     true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(position.node());
+    BSLS_ASSERT_SAFE(position.index() < position.node()->d_numValues);
+
+    Node      *node   = position.node();
+    const int  index  = position.index();
+    ValueType *values = node->values();
+
+    bslalg::ScalarDestructionPrimitives::destroy(values + index);
+
+    // Fill the hole in a leaf by shifting the following values, and in an
+    // internal node with the successor of the erased value, the first value
+    // of the leftmost leaf of the following subtree.  In either case, the
+    // position of the erased value is that of the value that followed it.
+
+    Node *leaf = node;
+    if (node->d_isLeaf) {
+        moveValues(values + index,
+                   values + index + 1,
+                   node->d_numValues - index - 1);
+    }
+    else {
+        leaf = child(node, index + 1);
+        while (!leaf->d_isLeaf) {
+            leaf = child(leaf, 0);
+        }
+        moveValues(values + index, leaf->values(), 1);
+        moveValues(leaf->values(), leaf->values() + 1, leaf->d_numValues - 1);
+    }
+    --leaf->d_numValues;
+    --d_numValues;
+
+    Node *trackedNode  = node;
+    int   trackedIndex = index;
+
+    rebalance(leaf, &trackedNode, &trackedIndex);
+
+    if (0 == d_root_p->d_numValues) {
+        Node *root = d_root_p;
+        if (root->d_isLeaf) {
+            d_root_p = 0;
+        }
+        else {
+            d_root_p = child(root, 0);
+            d_root_p->d_parent_p = 0;
+            d_root_p->d_position = 0;
+        }
+        deleteNode(root);
+    }
+    updateExtremes();
+
+    if (!d_root_p) {
+        return end();                                                 // RETURN
+    }
+
+    // The tracked position may be past the last value of its (leaf) node, in
+    // which case the value that followed the erased one is the first value
+    // not in a last subtree among the ancestors of the node, if any.
+
+    Iterator result(trackedNode, trackedIndex);
+    if (trackedIndex == trackedNode->d_numValues) {
+        for (Node *ancestor = trackedNode; ancestor->d_parent_p; ) {
+            const int childPosition = ancestor->d_position;
+            ancestor = ancestor->d_parent_p;
+            if (childPosition < ancestor->d_numValues) {
+                return Iterator(ancestor, childPosition);             // RETURN
+            }
+        }
+        return end();                                                 // RETURN
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::clear()
+{
+    if (d_root_p) {
+        destroyTree(d_root_p);
+        d_root_p = d_leftmost_p = d_rightmost_p = 0;
+        d_numValues = 0;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(BTree& other)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                               Base::allocator() == other.Base::allocator())) {
+        quickSwap(other);
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BTree thisCopy(*this, other.Base::allocator());
+        BTree otherCopy(other, Base::allocator());
+
+        quickSwap(otherCopy);
+        other.quickSwap(thisCopy);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return Iterator(d_leftmost_p, 0);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_rightmost_p ? Iterator(d_rightmost_p, d_rightmost_p->d_numValues)
+                         : Iterator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key)
+{
+    ConstIterator it = static_cast<const BTree *>(this)->find(key);
+    return Iterator(it.node(), it.index());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key)
+{
+    ConstIterator it = static_cast<const BTree *>(this)->lowerBound(key);
+    return Iterator(it.node(), it.index());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key)
+{
+    ConstIterator it = static_cast<const BTree *>(this)->upperBound(key);
+    return Iterator(it.node(), it.index());
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const ALLOCATOR& BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return Base::allocator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return ConstIterator(d_leftmost_p, 0);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_rightmost_p
+           ? ConstIterator(d_rightmost_p, d_rightmost_p->d_numValues)
+           : ConstIterator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    const Node *node = d_root_p;
+    while (node) {
+        const int index = lowerBoundIndex(node, key);
+        if (index < node->d_numValues
+         && !d_comparator(key,
+                          KEY_CONFIG::extractKey(node->values()[index]))) {
+            return ConstIterator(node, index);                        // RETURN
+        }
+        node = node->d_isLeaf ? 0 : child(const_cast<Node *>(node), index);
+    }
+    return end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key) const
+{
+    // The lower bound is the first value not ordered before 'key' in the
+    // deepest node, on the search path, having such a value.
+
+    ConstIterator result = end();
+    const Node *node = d_root_p;
+    while (node) {
+        const int index = lowerBoundIndex(node, key);
+        if (index < node->d_numValues) {
+            result = ConstIterator(node, index);
+        }
+        node = node->d_isLeaf ? 0 : child(const_cast<Node *>(node), index);
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key) const
+{
+    ConstIterator result = end();
+    const Node *node = d_root_p;
+    while (node) {
+        const int index = upperBoundIndex(node, key);
+        if (index < node->d_numValues) {
+            result = ConstIterator(node, index);
+        }
+        node = node->d_isLeaf ? 0 : child(const_cast<Node *>(node), index);
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_numValues;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return AllocatorTraits::max_size(Base::allocator());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::height() const
+{
+    int result = 0;
+    for (const Node *node = d_root_p;
+         node;
+         node = node->d_isLeaf ? 0 : child(const_cast<Node *>(node), 0)) {
+        ++result;
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isWellFormed() const
+{
+    if (!d_root_p) {
+        return 0 == d_numValues && !d_leftmost_p && !d_rightmost_p;   // RETURN
+    }
+    if (d_root_p->d_parent_p) {
+        return false;                                                 // RETURN
+    }
+
+    SizeType numValues = 0;
+    if (checkNode(d_root_p, 0, 0, &numValues) < 0
+     || numValues != d_numValues) {
+        return false;                                                 // RETURN
+    }
+
+    const Node *leftmost  = d_root_p;
+    const Node *rightmost = d_root_p;
+    while (!leftmost->d_isLeaf) {
+        leftmost  = child(const_cast<Node *>(leftmost), 0);
+        rightmost = child(const_cast<Node *>(rightmost),
+                          rightmost->d_numValues);
+    }
+    return leftmost == d_leftmost_p && rightmost == d_rightmost_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1311 @@
+// bslstl_btree.t.cpp                                                 -*-C++-*-
+#include <bslstl_btree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_set.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a B-tree whose invariants can be verified by
+// its 'isWellFormed' method.  We exercise the tree through sequences of
+// insertions and erasures, chosen to split and merge nodes at every level of
+// trees several levels deep, and verify after each operation that the tree is
+// well formed and holds the same values as a 'bsl::set' subjected to the same
+// operations, and that the iterators returned by the operations are at the
+// positions returned by the model.  Trees of 'int' values have about 60
+// values per node; to obtain deep trees with few values, we also use a large
+// value type, 'BigValue', for which nodes have the minimum capacity of 3
+// values, and which is not bitwise moveable, so that both ways of moving
+// values are exercised.  'BigValue' counts its live instances, so that we can
+// verify that every value constructed by the tree is destroyed.
+//-----------------------------------------------------------------------------
+// bslstl::BTreeIterator
+// [ 3] BTreeIterator();
+// [ 3] BTreeIterator(const Node *node, int index);
+// [ 3] BTreeIterator(const NcIter& original);
+// [ 3] BTreeIterator& operator++();
+// [ 3] BTreeIterator& operator--();
+// [ 3] reference operator*() const;
+// [ 3] pointer operator->() const;
+// [ 3] Node *node() const;
+// [ 3] int index() const;
+// [ 3] bool operator==(const BTreeIterator&, const BTreeIterator&);
+// [ 3] bool operator!=(const BTreeIterator&, const BTreeIterator&);
+// [ 3] BTreeIterator operator++(BTreeIterator& iter, int);
+// [ 3] BTreeIterator operator--(BTreeIterator& iter, int);
+//
+// bslstl::BTree
+// [ 2] BTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+// [ 6] BTree(const BTree& original, const ALLOCATOR& allocator);
+// [ 2] ~BTree();
+// [ 6] BTree& operator=(const BTree& rhs);
+// [ 2] pair<Iterator, bool> insert(const ValueType& value);
+// [ 4] Iterator erase(ConstIterator position);
+// [ 6] void clear();
+// [ 6] void swap(BTree& other);
+// [ 2] Iterator begin();
+// [ 2] Iterator end();
+// [ 5] Iterator find(const KeyType& key);
+// [ 5] Iterator lowerBound(const KeyType& key);
+// [ 5] Iterator upperBound(const KeyType& key);
+// [ 2] const ALLOCATOR& allocator() const;
+// [ 2] const COMPARATOR& comparator() const;
+// [ 2] ConstIterator begin() const;
+// [ 2] ConstIterator end() const;
+// [ 5] ConstIterator find(const KeyType& key) const;
+// [ 5] ConstIterator lowerBound(const KeyType& key) const;
+// [ 5] ConstIterator upperBound(const KeyType& key) const;
+// [ 2] SizeType size() const;
+// [ 2] SizeType maxSize() const;
+// [ 2] int height() const;
+// [ 2] bool isWellFormed() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 2] CONCERN: Nodes hold values in about 256 bytes.
+// [ 7] CONCERN: Insertion is exception neutral with the strong guarantee.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+                               // ==============
+                               // class BigValue
+                               // ==============
+
+class BigValue {
+    // This class provides a value type whose size exceeds that of a node of
+    // the target size, so that 'BTree' nodes of this type have the minimum
+    // capacity, and which is not bitwise moveable.  The number of live
+    // objects of this class is counted.
+
+    // DATA
+    int  d_key;        // key of the value
+    char d_pad[252];   // padding
+
+  public:
+    // CLASS DATA
+    static int s_numObjects;  // number of live objects
+
+    // CREATORS
+    explicit BigValue(int key)
+        // Create an object having the specified 'key'.
+    : d_key(key)
+    {
+        d_pad[0] = static_cast<char>(key);
+        ++s_numObjects;
+    }
+
+    BigValue(const BigValue& original)
+        // Create an object having the value of the specified 'original'.
+    : d_key(original.d_key)
+    {
+        d_pad[0] = original.d_pad[0];
+        ++s_numObjects;
+    }
+
+    ~BigValue()
+        // Destroy this object.
+    {
+        ASSERT(static_cast<char>(d_key) == d_pad[0]);
+        d_key = -1;
+        --s_numObjects;
+    }
+
+    // ACCESSORS
+    const int& key() const
+        // Return a reference providing non-modifiable access to the key of
+        // this object.
+    {
+        return d_key;
+    }
+};
+
+int BigValue::s_numObjects = 0;
+
+struct BigValueConfig {
+    // This 'struct' provides the key configuration of 'BigValue' objects.
+
+    typedef BigValue ValueType;
+    typedef int      KeyType;
+
+    static const int& extractKey(const BigValue& value)
+        // Return the key of the specified 'value'.
+    {
+        return value.key();
+    }
+};
+
+typedef bslstl::UnorderedSetKeyConfiguration<int>          IntConfig;
+typedef bslstl::BTree<IntConfig,
+                      std::less<int>,
+                      bsl::allocator<int> >                Obj;
+typedef bslstl::BTree<BigValueConfig,
+                      std::less<int>,
+                      bsl::allocator<BigValue> >           BigObj;
+typedef bsl::pair<bsl::string, bsl::string>                StringPair;
+typedef bslstl::UnorderedMapKeyConfiguration<StringPair>   StringConfig;
+typedef bslstl::BTree<StringConfig,
+                      std::less<bsl::string>,
+                      bsl::allocator<StringPair> >         StringObj;
+typedef bsl::set<int>                                      Model;
+
+BSLMF_ASSERT(3 == BigObj::Node::k_CAPACITY);
+BSLMF_ASSERT(!bslmf::IsBitwiseMoveable<BigValue>::value);
+BSLMF_ASSERT( bslmf::IsBitwiseMoveable<StringPair>::value);
+
+struct DefaultDataRow {
+    int d_line;       // source line number
+    int d_numValues;  // number of values to insert
+    int d_stride;     // step between consecutive values inserted
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  values  stride
+    //----  ------  ------
+    { L_,        0,      1 },
+    { L_,        1,      1 },
+    { L_,        3,      1 },
+    { L_,        4,      1 },
+    { L_,        7,     -1 },
+    { L_,       10,      3 },
+    { L_,       40,      7 },
+    { L_,       63,     -1 },
+    { L_,      100,      1 },
+    { L_,      500,     11 },
+    { L_,     2000,     -1 },
+    { L_,     5000,     17 },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+int keyOf(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+int keyOf(const BigValue& value)
+    // Return the key of the specified 'value'.
+{
+    return value.key();
+}
+
+int valueAt(int row, int index)
+    // Return the value at the specified 'index' in the sequence of values of
+    // the specified 'row' of 'DEFAULT_DATA'.  Values are even so that the
+    // odd keys between them can be searched for.
+{
+    const DefaultDataRow& ROW = DEFAULT_DATA[row];
+
+    // Multiplying by a stride that is coprime with the number of values
+    // visits every value exactly once.
+
+    const int n     = ROW.d_numValues;
+    const int slot  = ROW.d_stride < 0
+                    ? n - 1 - index
+                    : static_cast<int>(
+                         (static_cast<long long>(index) * ROW.d_stride) % n);
+    return 2 * slot;
+}
+
+template <class TREE>
+bool isEqual(const TREE& tree, const Model& model)
+    // Return 'true' if the specified 'tree' holds values having the same keys
+    // as the specified 'model', in the same order, when iterated both forward
+    // and backward, and 'false' otherwise.
+{
+    if (tree.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+    Model::const_iterator it = model.begin();
+    for (typename TREE::ConstIterator jt = tree.begin();
+         jt != tree.end();
+         ++jt, ++it) {
+        if (keyOf(*jt) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    typename TREE::ConstIterator jt = tree.end();
+    while (it != model.begin()) {
+        --it;
+        --jt;
+        if (keyOf(*jt) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return jt == tree.begin();
+}
+
+template <class TREE>
+int offsetOf(const TREE& tree, typename TREE::ConstIterator position)
+    // Return the number of values of the specified 'tree' preceding the
+    // specified 'position'.
+{
+    int result = 0;
+    for (typename TREE::ConstIterator it = tree.begin();
+         it != position;
+         ++it) {
+        ++result;
+    }
+    return result;
+}
+
+int offsetOf(const Model& model, Model::const_iterator position)
+    // Return the number of values of the specified 'model' preceding the
+    // specified 'position'.
+{
+    return static_cast<int>(bsl::distance(model.begin(), position));
+}
+
+template <class TREE, class VALUE>
+void testInsertAndErase(int row)
+    // Insert into a tree of the specified (template parameter) type 'TREE' the
+    // values of the specified 'row' of 'DEFAULT_DATA', converted to the
+    // (template parameter) type 'VALUE', and then erase them in a different
+    // order, verifying after each operation that the tree is well formed and
+    // holds the same values as a model, and that the positions returned are
+    // correct.
+{
+    const int LINE = DEFAULT_DATA[row].d_line;
+    const int N    = DEFAULT_DATA[row].d_numValues;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    {
+        TREE  mX(std::less<int>(), &oa);  const TREE& X = mX;
+        Model model(&sa);
+
+        for (int i = 0; i < N; ++i) {
+            const int KEY = valueAt(row, i);
+
+            bsl::pair<typename TREE::Iterator, bool> result =
+                                                        mX.insert(VALUE(KEY));
+            model.insert(KEY);
+
+            ASSERTV(LINE, i, result.second);
+            ASSERTV(LINE, i, KEY == keyOf(*result.first));
+            ASSERTV(LINE, i, X.isWellFormed());
+            ASSERTV(LINE, i, offsetOf(model, model.find(KEY))
+                                                 == offsetOf(X, result.first));
+
+            if (N <= 100 || 0 == i % 97) {
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            // Inserting a duplicate key does not modify the tree.
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            result = mX.insert(VALUE(KEY));
+            ASSERTV(LINE, i, !result.second);
+            ASSERTV(LINE, i, KEY == keyOf(*result.first));
+            ASSERTV(LINE, i, NUM_BLOCKS == oa.numBlocksTotal());
+            ASSERTV(LINE, i, X.size() == model.size());
+        }
+        ASSERTV(LINE, isEqual(X, model));
+        if (veryVerbose) { T_ P_(N) P(X.height()) }
+
+        // Erase every third value in increasing order, then the rest in
+        // decreasing order of position, comparing the returned position with
+        // the one following the erased value in the model.
+
+        for (int pass = 0; pass < 2; ++pass) {
+            int i = 0;
+            while (0 < X.size()) {
+                int offset;
+                if (0 == pass) {
+                    offset = 2 * i;
+                    if (offset >= static_cast<int>(X.size())) {
+                        break;
+                    }
+                }
+                else {
+                    offset = (i * 7) % static_cast<int>(X.size());
+                }
+
+                typename TREE::ConstIterator position = X.begin();
+                for (int j = 0; j < offset; ++j) {
+                    ++position;
+                }
+                const int KEY = keyOf(*position);
+
+                typename TREE::Iterator result = mX.erase(position);
+                Model::iterator         modelResult =
+                                                model.erase(model.find(KEY));
+
+                ASSERTV(LINE, pass, i, X.isWellFormed());
+                ASSERTV(LINE, pass, i, X.end() == X.find(KEY));
+                ASSERTV(LINE, pass, i, offsetOf(model, modelResult)
+                                                     == offsetOf(X, result));
+                if (N <= 100 || 0 == i % 97) {
+                    ASSERTV(LINE, pass, i, isEqual(X, model));
+                }
+                ++i;
+            }
+            ASSERTV(LINE, pass, isEqual(X, model));
+        }
+        ASSERTV(LINE, 0 == X.size());
+        ASSERTV(LINE, 0 == X.height());
+        ASSERTV(LINE, X.begin() == X.end());
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+    }
+    ASSERTV(LINE, 0 == oa.numBlocksInUse());
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Maintaining an Ordered Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain a set of 'int' values, ordered from the
+// largest to the smallest, in a 'BTree' (which is generally used through
+// 'bsl::btree_set').
+//
+// First, we define the type of the tree:
+//..
+    typedef bslstl::UnorderedSetKeyConfiguration<int>  IntConfig;
+    typedef bslstl::BTree<IntConfig,
+                          std::greater<int>,
+                          bsl::allocator<int> >       IntTree;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a tree and insert enough values to require several nodes:
+//..
+    bslma::TestAllocator allocator;
+    IntTree              tree(std::greater<int>(), &allocator);
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT(true == tree.insert((i * 7) % 1000).second);
+    }
+    ASSERT(false == tree.insert(42).second);
+    ASSERT(1000  == tree.size());
+    ASSERT(1     <  allocator.numBlocksInUse());
+    ASSERT(tree.isWellFormed());
+//..
+// Next, we search for some values:
+//..
+    ASSERT(500 == *tree.find(500));
+    ASSERT(tree.end() == tree.find(1000));
+    ASSERT(499 == *tree.upperBound(500));
+//..
+// Then, we erase the odd values, using the iterator returned by 'erase' to
+// continue the traversal:
+//..
+    IntTree::Iterator it = tree.begin();
+    while (it != tree.end()) {
+        if (*it % 2) {
+            it = tree.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    ASSERT(500 == tree.size());
+    ASSERT(tree.isWellFormed());
+//..
+// Finally, we observe that the remaining values are visited from the largest
+// to the smallest:
+//..
+    int expected = 998;
+    for (it = tree.begin(); it != tree.end(); ++it, expected -= 2) {
+        ASSERT(expected == *it);
+    }
+    ASSERT(-2 == expected);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING EXCEPTION SAFETY OF 'insert'
+        //
+        // Concerns:
+        //: 1 If an allocation fails during an insertion, whether of a node or
+        //:   of memory for the copy of the value, the tree is unchanged, and
+        //:   no memory is leaked.
+        //:
+        //: 2 Insertions that split nodes at several levels, and create a new
+        //:   root, are covered.
+        //
+        // Plan:
+        //: 1 Insert, in the presence of injected exceptions, each of a
+        //:   sequence of 'bsl::string' pairs having long (allocated) keys into
+        //:   a tree, and verify after each exception that the tree is well
+        //:   formed and unchanged.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for 'BigValue' objects, whose copy constructor does
+        //:   not allocate, so that the node allocations fail.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Insertion is exception neutral with the strong guarantee.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING EXCEPTION SAFETY OF 'insert'"
+                            "\n====================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        const int N = 400;
+
+        if (verbose) printf("\nInserting 'bsl::string' pairs.\n");
+        {
+            StringObj mX(std::less<bsl::string>(), &oa);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                char buffer[64];
+                sprintf(buffer,
+                        "a key long enough to be allocated: %05d",
+                        (i * 37) % N);
+                const StringPair VALUE(bsl::string(buffer, &sa),
+                                       bsl::string("value", &sa),
+                                       &sa);
+
+                const StringObj::SizeType SIZE = X.size();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, SIZE == X.size());
+                    ASSERTV(i, X.end() == X.find(VALUE.first));
+                    ASSERTV(i, X.isWellFormed());
+
+                    ASSERTV(i, mX.insert(VALUE).second);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, SIZE + 1 == X.size());
+                ASSERTV(i, X.isWellFormed());
+                ASSERTV(i, VALUE == *X.find(VALUE.first));
+            }
+            if (veryVerbose) { T_ P(X.height()) }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nInserting 'BigValue' objects.\n");
+        {
+            BigObj mX(std::less<int>(), &oa);  const BigObj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                const BigValue VALUE((i * 37) % N);
+
+                const BigObj::SizeType SIZE = X.size();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, SIZE == X.size());
+                    ASSERTV(i, X.isWellFormed());
+                    ASSERTV(i, static_cast<int>(SIZE + 1)
+                                                   == BigValue::s_numObjects);
+
+                    ASSERTV(i, mX.insert(VALUE).second);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, SIZE + 1 == X.size());
+                ASSERTV(i, X.isWellFormed());
+            }
+            if (veryVerbose) { T_ P(X.height()) }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(BigValue::s_numObjects, 0 == BigValue::s_numObjects);
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND CLEAR
+        //
+        // Concerns:
+        //: 1 A copy has the values, and the structure, of the original, and
+        //:   uses the allocator supplied to it.
+        //:
+        //: 2 The assignment operator gives the target the values of the
+        //:   source, using the allocator of the target, and self-assignment
+        //:   has no effect.
+        //:
+        //: 3 'swap' exchanges the values of two trees, without allocating if
+        //:   they use the same allocator.
+        //:
+        //: 4 'clear' removes all values and releases all nodes.
+        //:
+        //: 5 The copy constructor is exception neutral, and leaks no memory.
+        //
+        // Plan:
+        //: 1 For each row of the table, build a tree of 'BigValue' objects,
+        //:   copy it with and without injected exceptions, and compare the
+        //:   copy with the model.  (C-1, 5)
+        //:
+        //: 2 For each pair of rows of the table, assign, and swap, trees
+        //:   using the same and different allocators, and compare them with
+        //:   the models.  (C-2..3)
+        //:
+        //: 3 Clear each tree and verify that its allocator has no memory in
+        //:   use.  (C-4)
+        //
+        // Testing:
+        //   BTree(const BTree& original, const ALLOCATOR& allocator);
+        //   BTree& operator=(const BTree& rhs);
+        //   void swap(BTree& other);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING COPY, ASSIGNMENT, SWAP, AND CLEAR"
+                            "\n=========================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+
+        const int NUM_DATA = 9;  // rows of at most 500 values
+
+        if (verbose) printf("\nTesting copy construction.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            bslma::TestAllocator ya("original", veryVeryVeryVerbose);
+
+            BigObj mY(std::less<int>(), &ya);  const BigObj& Y = mY;
+            Model  model(&sa);
+            for (int i = 0; i < N; ++i) {
+                mY.insert(BigValue(valueAt(ti, i)));
+                model.insert(valueAt(ti, i));
+            }
+
+            {
+                BigObj mX(Y, &oa);  const BigObj& X = mX;
+
+                ASSERTV(LINE, X.isWellFormed());
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, Y.height() == X.height());
+                ASSERTV(LINE, ya.numBlocksInUse() == oa.numBlocksInUse());
+                ASSERTV(LINE, &oa == X.allocator().mechanism());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                BigObj mX(Y, &oa);  const BigObj& X = mX;
+                ASSERTV(LINE, isEqual(X, model));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+            ASSERTV(LINE, static_cast<int>(Y.size())
+                                                   == BigValue::s_numObjects);
+        }
+
+        if (verbose) printf("\nTesting assignment and 'swap'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int ILINE = DEFAULT_DATA[ti].d_line;
+                const int JLINE = DEFAULT_DATA[tj].d_line;
+
+                Obj   mX(std::less<int>(), &oa);  const Obj& X = mX;
+                Obj   mY(std::less<int>(), &oa);  const Obj& Y = mY;
+                Obj   mZ(std::less<int>(), &za);  const Obj& Z = mZ;
+                Model modelX(&sa);
+                Model modelY(&sa);
+                for (int i = 0; i < DEFAULT_DATA[ti].d_numValues; ++i) {
+                    mX.insert(valueAt(ti, i));
+                    modelX.insert(valueAt(ti, i));
+                }
+                for (int i = 0; i < DEFAULT_DATA[tj].d_numValues; ++i) {
+                    mY.insert(valueAt(tj, i) + 1);
+                    mZ.insert(valueAt(tj, i) + 1);
+                    modelY.insert(valueAt(tj, i) + 1);
+                }
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+                mX.swap(mY);
+                ASSERTV(ILINE, JLINE, NUM_BLOCKS == oa.numBlocksTotal());
+                ASSERTV(ILINE, JLINE, isEqual(X, modelY));
+                ASSERTV(ILINE, JLINE, isEqual(Y, modelX));
+                ASSERTV(ILINE, JLINE, X.isWellFormed() && Y.isWellFormed());
+
+                mX.swap(mZ);
+                ASSERTV(ILINE, JLINE, isEqual(X, modelY));
+                ASSERTV(ILINE, JLINE, isEqual(Z, modelY));
+                ASSERTV(ILINE, JLINE, &oa == X.allocator().mechanism());
+                ASSERTV(ILINE, JLINE, &za == Z.allocator().mechanism());
+
+                mZ = Y;
+                ASSERTV(ILINE, JLINE, isEqual(Z, modelX));
+                ASSERTV(ILINE, JLINE, Z.isWellFormed());
+                ASSERTV(ILINE, JLINE, &za == Z.allocator().mechanism());
+
+                mZ = Z;
+                ASSERTV(ILINE, JLINE, isEqual(Z, modelX));
+
+                mX.clear();
+                mY.clear();
+                ASSERTV(ILINE, JLINE, 0 == X.size() && X.isWellFormed());
+                ASSERTV(ILINE, JLINE, 0 == oa.numBlocksInUse());
+
+                mZ.clear();
+                ASSERTV(ILINE, JLINE, 0 == za.numBlocksInUse());
+                mZ.clear();
+                ASSERTV(ILINE, JLINE, Z.begin() == Z.end());
+            }
+        }
+        ASSERTV(BigValue::s_numObjects, 0 == BigValue::s_numObjects);
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCHES
+        //
+        // Concerns:
+        //: 1 'find', 'lowerBound', and 'upperBound' return the same positions
+        //:   as the corresponding methods of 'bsl::set', for keys present in
+        //:   the tree, and for keys ordered before, between, and after them,
+        //:   including keys whose bound is in an internal node.
+        //:
+        //: 2 The manipulators return the same positions as the accessors.
+        //
+        // Plan:
+        //: 1 For each row of the table, build trees of 'int' and 'BigValue'
+        //:   objects holding the even values of the row, and compare the
+        //:   results of searching for each key from -1 to one more than the
+        //:   largest value with those of a model.  (C-1..2)
+        //
+        // Testing:
+        //   Iterator find(const KeyType& key);
+        //   Iterator lowerBound(const KeyType& key);
+        //   Iterator upperBound(const KeyType& key);
+        //   ConstIterator find(const KeyType& key) const;
+        //   ConstIterator lowerBound(const KeyType& key) const;
+        //   ConstIterator upperBound(const KeyType& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCHES"
+                            "\n================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int NUM_DATA = 11;  // rows of at most 2000 values
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            Obj    mX(std::less<int>(), &oa);  const Obj&    X = mX;
+            BigObj mB(std::less<int>(), &oa);  const BigObj& B = mB;
+            Model  model(&oa);
+            for (int i = 0; i < N; ++i) {
+                mX.insert(valueAt(ti, i));
+                mB.insert(BigValue(valueAt(ti, i)));
+                model.insert(valueAt(ti, i));
+            }
+            const Model& M = model;
+
+            for (int key = -1; key <= 2 * N; ++key) {
+                if (veryVeryVerbose) { T_ P_(N) P(key) }
+
+                const int FIND  = offsetOf(M, M.find(key));
+                const int LOWER = offsetOf(M, M.lower_bound(key));
+                const int UPPER = offsetOf(M, M.upper_bound(key));
+
+                ASSERTV(LINE, key, FIND  == offsetOf(X, X.find(key)));
+                ASSERTV(LINE, key, LOWER == offsetOf(X, X.lowerBound(key)));
+                ASSERTV(LINE, key, UPPER == offsetOf(X, X.upperBound(key)));
+
+                ASSERTV(LINE, key, FIND  == offsetOf(B, B.find(key)));
+                ASSERTV(LINE, key, LOWER == offsetOf(B, B.lowerBound(key)));
+                ASSERTV(LINE, key, UPPER == offsetOf(B, B.upperBound(key)));
+
+                ASSERTV(LINE, key, X.find(key)       == mX.find(key));
+                ASSERTV(LINE, key, X.lowerBound(key) == mX.lowerBound(key));
+                ASSERTV(LINE, key, X.upperBound(key) == mX.upperBound(key));
+                ASSERTV(LINE, key, B.find(key)       == mB.find(key));
+                ASSERTV(LINE, key, B.lowerBound(key) == mB.lowerBound(key));
+                ASSERTV(LINE, key, B.upperBound(key) == mB.upperBound(key));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'erase'
+        //
+        // Concerns:
+        //: 1 Erasing a value from a leaf node, and from an internal node,
+        //:   removes only that value, and leaves the tree well formed.
+        //:
+        //: 2 Erasures that take a value from the left or right sibling of a
+        //:   node, or merge it with either sibling, at every level, and that
+        //:   remove the root, leave the tree well formed.
+        //:
+        //: 3 'erase' returns the position of the value that followed the
+        //:   erased one, or the past-the-end position.
+        //:
+        //: 4 Erasing all values releases all nodes and destroys all values.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, build trees of 'int' and 'BigValue'
+        //:   objects, and erase every third value in increasing order, and
+        //:   then the remaining values at varying positions, comparing with a
+        //:   model after each erasure.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   Iterator erase(ConstIterator position);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'erase'"
+                            "\n===============\n");
+
+        // 'testInsertAndErase' checks the results of 'insert' as well as
+        // those of 'erase'; 'insert' is tested (with less coverage) in case 2.
+
+        for (int ti = 0; ti < DEFAULT_NUM_DATA; ++ti) {
+            if (veryVerbose) { T_ P(DEFAULT_DATA[ti].d_numValues) }
+
+            testInsertAndErase<Obj, int>(ti);
+            testInsertAndErase<BigObj, BigValue>(ti);
+        }
+        ASSERTV(BigValue::s_numObjects, 0 == BigValue::s_numObjects);
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            mX.insert(1);
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(Obj::ConstIterator()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING ITERATORS
+        //
+        // Concerns:
+        //: 1 Incrementing an iterator from 'begin' visits every value in order
+        //:   and reaches 'end', and decrementing from 'end' visits them in
+        //:   reverse order, through leaf and internal nodes.
+        //:
+        //: 2 The post-increment and post-decrement operators return the
+        //:   previous position.
+        //:
+        //: 3 An iterator converts to a const iterator at the same position,
+        //:   and iterators compare equal only at the same position.
+        //:
+        //: 4 'operator->' and 'operator*' refer to the same value.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, build trees of 'int' and 'BigValue'
+        //:   objects, and iterate over them in both directions with each
+        //:   operator, comparing with a model.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   BTreeIterator();
+        //   BTreeIterator(const Node *node, int index);
+        //   BTreeIterator(const NcIter& original);
+        //   BTreeIterator& operator++();
+        //   BTreeIterator& operator--();
+        //   reference operator*() const;
+        //   pointer operator->() const;
+        //   Node *node() const;
+        //   int index() const;
+        //   bool operator==(const BTreeIterator&, const BTreeIterator&);
+        //   bool operator!=(const BTreeIterator&, const BTreeIterator&);
+        //   BTreeIterator operator++(BTreeIterator& iter, int);
+        //   BTreeIterator operator--(BTreeIterator& iter, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ITERATORS"
+                            "\n=================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            const Obj::Iterator      ITER;
+            const Obj::ConstIterator CITER(ITER);
+            ASSERT(0 == ITER.node());
+            ASSERT(0 == ITER.index());
+            ASSERT(CITER == ITER);
+            ASSERT(!(CITER != ITER));
+        }
+
+        for (int ti = 0; ti < DEFAULT_NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            Obj    mX(std::less<int>(), &oa);  const Obj&    X = mX;
+            BigObj mB(std::less<int>(), &oa);  const BigObj& B = mB;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(valueAt(ti, i));
+                mB.insert(BigValue(valueAt(ti, i)));
+            }
+
+            Obj::Iterator      it  = mX.begin();
+            Obj::ConstIterator cit = X.begin();
+            BigObj::ConstIterator bit = B.begin();
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(LINE, i, 2 * i == *it);
+                ASSERTV(LINE, i, 2 * i == bit->key());
+                ASSERTV(LINE, i, &*bit == bit.operator->());
+                ASSERTV(LINE, i, cit == it);
+                ASSERTV(LINE, i, it.node() == cit.node());
+                ASSERTV(LINE, i, it.index() == cit.index());
+                ASSERTV(LINE, i, Obj::ConstIterator(it.node(), it.index())
+                                                                       == it);
+
+                *it = 2 * i;  // modifiable access
+
+                const Obj::Iterator PREV = it++;
+                ASSERTV(LINE, i, PREV == cit);
+                ASSERTV(LINE, i, PREV != it);
+                ASSERTV(LINE, i, ++cit == it);
+                ++bit;
+            }
+            ASSERTV(LINE, X.end() == it);
+            ASSERTV(LINE, X.end() == cit);
+            ASSERTV(LINE, B.end() == bit);
+
+            for (int i = N - 1; i >= 0; --i) {
+                const Obj::ConstIterator PREV = cit--;
+                ASSERTV(LINE, i, PREV == it);
+                ASSERTV(LINE, i, --it == cit);
+                ASSERTV(LINE, i, 2 * i == *cit);
+                --bit;
+                ASSERTV(LINE, i, 2 * i == bit->key());
+            }
+            ASSERTV(LINE, X.begin() == it);
+            ASSERTV(LINE, B.begin() == bit);
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            mX.insert(1);
+
+            Obj::ConstIterator it = X.end();
+            ASSERT_SAFE_FAIL(*it);
+            ASSERT_SAFE_FAIL(++it);
+            ASSERT_SAFE_PASS(--it);
+            ASSERT_SAFE_PASS(*it);
+            ASSERT_SAFE_FAIL(Obj::ConstIterator().operator->());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed tree is empty and well formed, uses the
+        //:   supplied comparator and allocator, and allocates no memory.
+        //:
+        //: 2 'insert' adds a value whose key is not present, returning its
+        //:   position and 'true', and leaves the tree unchanged, returning the
+        //:   position of the existing value and 'false', otherwise.
+        //:
+        //: 3 Insertions that split leaf and internal nodes, and the root,
+        //:   leave the tree well formed, and the height of the tree grows
+        //:   logarithmically with its size.
+        //:
+        //: 4 All memory comes from the supplied allocator, and is released by
+        //:   the destructor, which destroys every value.
+        //:
+        //: 5 The capacity of a node is chosen so that a leaf node occupies
+        //:   about 256 bytes, within the limits of 3 and 255 values.
+        //
+        // Plan:
+        //: 1 Create trees with different comparators and allocators, and
+        //:   verify the basic accessors.  (C-1)
+        //:
+        //: 2 For each row of the table, insert the values of the row into
+        //:   trees of 'int' and 'BigValue' objects, and verify the result of
+        //:   each insertion, the values of the tree, and its height.  (C-2..4)
+        //:
+        //: 3 Verify the capacity and size of the nodes of several value
+        //:   types.  (C-5)
+        //
+        // Testing:
+        //   BTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+        //   ~BTree();
+        //   pair<Iterator, bool> insert(const ValueType& value);
+        //   Iterator begin();
+        //   Iterator end();
+        //   const ALLOCATOR& allocator() const;
+        //   const COMPARATOR& comparator() const;
+        //   ConstIterator begin() const;
+        //   ConstIterator end() const;
+        //   SizeType size() const;
+        //   SizeType maxSize() const;
+        //   int height() const;
+        //   bool isWellFormed() const;
+        //   CONCERN: Nodes hold values in about 256 bytes.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          "\n================================================"
+                          "\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting default state.\n");
+        {
+            const Obj X(std::less<int>(), &oa);
+
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.height());
+            ASSERT(0 <  X.maxSize());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.isWellFormed());
+            ASSERT(&oa == X.allocator().mechanism());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            typedef bslstl::BTree<IntConfig,
+                                  std::greater<int>,
+                                  bsl::allocator<int> > GreaterObj;
+
+            const std::greater<int>   COMPARATOR;
+            const bsl::allocator<int> ALLOCATOR;
+
+            GreaterObj mY(COMPARATOR, ALLOCATOR);
+            const GreaterObj& Y = mY;
+            ASSERT(Y.comparator()(2, 1));
+            ASSERT(&da == Y.allocator().mechanism());
+
+            mY.insert(1);
+            mY.insert(3);
+            mY.insert(2);
+            ASSERT(3 == *Y.begin());
+            ASSERT(0 <  da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        if (verbose) printf("\nTesting 'insert'.\n");
+
+        for (int ti = 0; ti < DEFAULT_NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            {
+                Obj    mX(std::less<int>(), &oa);  const Obj&    X = mX;
+                BigObj mB(std::less<int>(), &oa);  const BigObj& B = mB;
+                Model  model(&sa);
+
+                for (int i = 0; i < N; ++i) {
+                    const int KEY = valueAt(ti, i);
+
+                    bsl::pair<Obj::Iterator, bool> result = mX.insert(KEY);
+                    ASSERTV(LINE, i, result.second);
+                    ASSERTV(LINE, i, KEY == *result.first);
+
+                    bsl::pair<BigObj::Iterator, bool> bigResult =
+                                                      mB.insert(BigValue(KEY));
+                    ASSERTV(LINE, i, bigResult.second);
+                    ASSERTV(LINE, i, KEY == bigResult.first->key());
+
+                    model.insert(KEY);
+
+                    result = mX.insert(KEY);
+                    ASSERTV(LINE, i, !result.second);
+                    ASSERTV(LINE, i, KEY == *result.first);
+
+                    ASSERTV(LINE, i, i + 1 == static_cast<int>(X.size()));
+                    ASSERTV(LINE, i, i + 1 == static_cast<int>(B.size()));
+                    if (N <= 100) {
+                        ASSERTV(LINE, i, X.isWellFormed());
+                        ASSERTV(LINE, i, B.isWellFormed());
+                    }
+                }
+                ASSERTV(LINE, X.isWellFormed());
+                ASSERTV(LINE, B.isWellFormed());
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, isEqual(B, model));
+                ASSERTV(LINE, N == BigValue::s_numObjects);
+
+                // A tree of N values has at most 1 + log_{m+1}((N+1)/2)
+                // levels, where m is the minimum number of values in a node.
+
+                int maxHeight = 0;
+                for (long long capacity = 1;
+                     capacity < N + 1;
+                     capacity *= BigObj::Node::k_MIN_VALUES + 1) {
+                    ++maxHeight;
+                }
+                ASSERTV(LINE, B.height(), maxHeight + 1 >= B.height());
+                ASSERTV(LINE, X.height(), B.height() >= X.height());
+                ASSERTV(LINE, X.height(), N <= Obj::Node::k_CAPACITY
+                                          ? (0 < N) == X.height()
+                                          : 1 < X.height());
+                if (veryVerbose) { T_ P_(N) P_(X.height()) P(B.height()) }
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+            ASSERTV(LINE, 0 == BigValue::s_numObjects);
+        }
+        ASSERTV(da.numBlocksTotal(),
+                NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+        if (verbose) printf("\nTesting node capacity.\n");
+        {
+            typedef bslstl::BTree_Node<int>         IntNode;
+            typedef bslstl::BTree_Node<StringPair>  StringNode;
+            typedef bslstl::BTree_Node<char>        CharNode;
+
+            ASSERTV(IntNode::k_CAPACITY, 50 < IntNode::k_CAPACITY);
+            ASSERTV(sizeof(IntNode), sizeof(IntNode) <= 256);
+            ASSERTV(sizeof(IntNode), sizeof(IntNode) > 256 - sizeof(int));
+            ASSERTV(IntNode::k_MIN_VALUES,
+                    (IntNode::k_CAPACITY - 1) / 2 == IntNode::k_MIN_VALUES);
+
+            ASSERTV(StringNode::k_CAPACITY, 3 == StringNode::k_CAPACITY
+                                         || sizeof(StringNode) <= 256);
+            ASSERTV(CharNode::k_CAPACITY, 255 >= CharNode::k_CAPACITY);
+            ASSERTV(BigObj::Node::k_MIN_VALUES,
+                    1 == BigObj::Node::k_MIN_VALUES);
+            ASSERT(sizeof(IntNode) < sizeof(bslstl::BTree_InternalNode<int>));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, iterate over, and erase values of a tree large
+        //:   enough to have several levels.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(X.isWellFormed());
+            ASSERT(X.begin() == X.end());
+
+            const int N = 10000;
+            for (int i = 0; i < N; ++i) {
+                ASSERT(mX.insert((i * 7919) % N).second);
+            }
+            ASSERT(N == static_cast<int>(X.size()));
+            ASSERT(X.isWellFormed());
+            ASSERT(3 <= X.height());
+            if (verbose) { T_ P(X.height()) }
+
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, i == *X.find(i));
+            }
+            ASSERT(X.end() == X.find(N));
+
+            int expected = 0;
+            for (Obj::ConstIterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(expected, expected == *it);
+                ++expected;
+            }
+            ASSERT(N == expected);
+
+            for (int i = 0; i < N; i += 2) {
+                Obj::Iterator it = mX.erase(X.find(i));
+                ASSERTV(i, i + 1 == *it);
+            }
+            ASSERT(N / 2 == static_cast<int>(X.size()));
+            ASSERT(X.isWellFormed());
+
+            Obj::Iterator it = mX.begin();
+            while (it != X.end()) {
+                it = mX.erase(it);
+            }
+            ASSERT(0 == X.size());
+            ASSERT(X.isWellFormed());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1302 @@
+// bslstl_btreemap.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREEMAP
+#define INCLUDED_BSLSTL_BTREEMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map of unique keys held in a B-tree.
+//
+//@CLASSES:
+//   bsl::btree_map: ordered key-value map held in cache-friendly B-tree nodes
+//
+//@SEE_ALSO: bslstl_btree, bslstl_btreeset, bslstl_map, bslstl_flatmap
+//
+//@DESCRIPTION: This component defines a single class template, 'btree_map',
+// implementing a container holding an ordered sequence of key-value pairs
+// having unique keys, with the interface of 'bsl::map', whose pairs are held
+// in the nodes of a B-tree (see 'bslstl_btree') rather than in a red-black
+// tree of one node per pair.
+//
+// An instantiation of 'btree_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of key-value pairs the 'btree_map' contains.  The requirements on
+// the 'KEY' and 'VALUE' types are those of 'bsl::map' (see 'bslstl_map').
+//
+// Since the pairs are moved between and within the nodes of the B-tree as
+// pairs are inserted and erased, the 'value_type' of a 'btree_map' is
+// 'bsl::pair<KEY, VALUE>', and not 'bsl::pair<const KEY, VALUE>' as for
+// 'bsl::map' (as for 'bsl::flat_map').  The key of a pair can therefore be
+// modified through an 'iterator'; the behavior is undefined if a key is so
+// modified while the pair is held by a 'btree_map'.
+//
+///Choosing Between 'map', 'btree_map', and 'flat_map'
+///---------------------------------------------------
+// A 'bsl::map' allocates a node for each pair, holding the pair, three
+// pointers, and a color.  A 'btree_map' holds its pairs in nodes of about 256
+// bytes (four cache lines) holding tens of pairs each (for small keys and
+// mapped values), so that it allocates roughly one node per tens of pairs,
+// uses less memory per pair, and, as it is only a few levels deep, looks up a
+// key with one node visit per level, rather than one cache miss per
+// comparison.  Iterating over the pairs visits consecutive memory within
+// each node.  Unlike a 'flat_map', inserting or erasing a pair takes
+// logarithmic time (moving at most a few nodes' worth of pairs), so that a
+// 'btree_map' is well suited to large maps that are both searched and
+// modified.
+//
+// On the other hand, as pairs are moved between nodes, *any* insertion or
+// erasure invalidates all iterators, pointers, and references to the pairs
+// of a 'btree_map', which 'bsl::map' never does except for the erased pair.
+// Code that holds iterators (or references) across modifications of a map
+// must use 'bsl::map'.  'erase' returns an iterator to the pair that followed
+// the erased one, so that pairs can be erased during a traversal.  The
+// benchmark in case -1 of the test driver of this component compares
+// 'btree_map' with 'bsl::map' for point lookups, range scans, and memory use.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a B-tree map's 'ALLOCATOR' template parameter
+// determines how that map will allocate memory.  If the 'ALLOCATOR' is
+// 'bsl::allocator' (the default), then objects of the B-tree map type conform
+// to the standard behavior of a 'bslma'-allocator-enabled type: the map
+// accepts an optional 'bslma::Allocator' argument at construction, uses it to
+// supply memory for its nodes throughout its lifetime, and supplies it to the
+// constructors of the keys and mapped values it holds if they have the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'btree_map':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the B-tree map
+//  'V'             - (template parameter) type 'VALUE' of the B-tree map
+//  'a', 'b'        - two distinct objects of type 'btree_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'btree_map<K, V>::value_type'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | btree_map<K, V> a;    (default construction)       | O[1]               |
+//  | btree_map<K, V> a(al);                             |                    |
+//  | btree_map<K, V> a(c, al);                          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_map<K, V> a(b); (copy construction)          | O[n]               |
+//  | btree_map<K, V> a(b, al);                          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_map<K, V> a(i1, i2);                         | O[N * log(N)]      |
+//  | btree_map<K, V> a(i1, i2, c, al);                  |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~btree_map<K, V>(); (destruction)                | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;                (assignment)                 | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty()                                | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k], a.at(k)                                      | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v)                                        | O[log(n)]          |
+//  | a.insert(p1, v)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N * log(n + N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[log(n)]          |
+//  | a.erase(k)                                         |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1, p2)                                    | O[distance(p1, p2) |
+//  |                                                    |   * log(n)]        |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.value_comp()                                     | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.contains(k)                           | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.count(k)                                         | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.upper_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Maintaining an Order Book
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain the quantities offered at each price level of
+// one side of an order book, which is updated frequently, and from which we
+// frequently need the total quantity available up to a given price.
+//
+// First, we define the type of the book, mapping a price, in ticks, to the
+// quantity offered at that price:
+//..
+//  typedef bsl::btree_map<int, int> PriceLevels;
+//..
+// Then, we create a book, and add quantities at a few prices, using
+// 'operator[]', which inserts a level with a zero quantity the first time a
+// price is used:
+//..
+//  bslma::TestAllocator allocator;
+//  PriceLevels          book(&allocator);
+//
+//  book[1005] += 300;
+//  book[1002] += 100;
+//  book[1010] += 500;
+//  book[1002] += 200;
+//  assert(3 == book.size());
+//..
+// Next, we remove a level whose quantity has been fully executed:
+//..
+//  assert(1 == book.erase(1005));
+//  assert(2 == book.size());
+//..
+// Finally, we compute the quantity available at prices up to 1009 by scanning
+// the levels below the upper bound of that price:
+//..
+//  int total = 0;
+//  for (PriceLevels::const_iterator it = book.begin();
+//       it != book.upper_bound(1009);
+//       ++it) {
+//      total += it->second;
+//  }
+//  assert(300 == total);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_BTREE
+#include <bslstl_btree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'equal', 'lexicographical_compare'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                              // ===============
+                              // class btree_map
+                              // ===============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR  = std::less<KEY>,
+          class ALLOCATOR   = bsl::allocator<bsl::pair<KEY, VALUE> > >
+class btree_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys (of the
+    // template parameter type, 'KEY') in a B-tree.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<KEY, VALUE>                      value_type;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<value_type>
+                                                                    KeyConfig;
+        // This 'typedef' is an alias for the policy extracting the key of a
+        // pair held by this map.
+
+    typedef BloombergLP::bslstl::BTree<KeyConfig, COMPARATOR, ALLOCATOR>
+                                                                    Tree;
+        // This 'typedef' is an alias for the B-tree holding the pairs of this
+        // map.
+
+    typedef bsl::allocator_traits<ALLOCATOR>           AllocatorTraits;
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::Iterator                    iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by their keys, using the (template parameter) type
+        // 'COMPARATOR', as for 'bsl::map::value_compare'.
+
+        // FRIENDS
+        friend class btree_map;
+
+      protected:
+        COMPARATOR comp;  // key comparator
+
+        value_compare(COMPARATOR comparator) : comp(comparator) {}
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to
+            // the overload of 'operator()' (the comparison function) provided
+            // by a 'btree_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    Tree d_tree;  // pairs, ordered by key, and key comparator
+
+  public:
+    // CREATORS
+    explicit btree_map(const COMPARATOR& comparator = COMPARATOR(),
+                       const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct an empty map.  Optionally specify a 'comparator' used to
+        // order key-value pairs contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not supplied,
+        // a default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'allocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator' and
+        // 'allocator' is not supplied, the currently installed default
+        // allocator is used to supply memory.
+
+    explicit btree_map(const ALLOCATOR& allocator);
+        // Construct an empty map that will use the specified 'allocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the key-value pairs contained
+        // in this map.  If the template parameter 'ALLOCATOR' argument is of
+        // type 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    btree_map(const btree_map& original);
+        // Construct a map having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the key-value pairs
+        // contained in this map.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) types 'KEY' and 'VALUE' both be "copy-constructible"
+        // (see {Requirements on 'KEY' and 'VALUE'} in 'bslstl_map').
+
+    btree_map(const btree_map& original, const ALLOCATOR& allocator);
+        // Construct a map having the same value as that of the specified
+        // 'original' that will use the specified 'allocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the key-value pairs
+        // contained in this map.  This method requires that the (template
+        // parameter) types 'KEY' and 'VALUE' both be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    btree_map(INPUT_ITERATOR    first,
+              INPUT_ITERATOR    last,
+              const COMPARATOR& comparator = COMPARATOR(),
+              const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those pairs having a
+        // key equivalent to that of a pair appearing earlier in the sequence.
+        // Optionally specify a 'comparator' used to order key-value pairs
+        // contained in this object, and an 'allocator' used to supply memory,
+        // as for the default constructor.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  This method requires
+        // that the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible".
+
+    ~btree_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    btree_map& operator=(const btree_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  This method requires that the (template parameter)
+        // types 'KEY' and 'VALUE' both be "copy-constructible".
+
+    VALUE& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key'; if this map does not already
+        // contain a 'value_type' object with 'key', first insert a new
+        // 'value_type' object having 'key' and a default-constructed 'VALUE'
+        // object, and return a reference to the mapped value.  This method
+        // requires that the (template parameter) types 'KEY' and 'VALUE' both
+        // be "default-constructible".  Note that the returned reference is
+        // invalidated by any subsequent insertion into, or erasure from, this
+        // map.
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise throw an 'std::out_of_range' exception.  Note that this
+        // method is not exception agnostic.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // if a key equivalent to that of 'value' already exists in this map,
+        // this method has no effect.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is equivalent to that of 'value', and
+        // whose 'second' member is 'true' if a new pair was inserted, and
+        // 'false' if the key was already present.  If a pair is inserted, all
+        // iterators and references to the pairs of this map are invalidated.
+        // This method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible".
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this map whose key is equivalent to
+        // that of 'value'.  The specified 'hint' is ignored: this method takes
+        // O[log(N)] time, where N is the size of this map, as does the
+        // descent of a B-tree from a position in a leaf node.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this map.  This
+        // method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this map (nor equivalent to that of a pair
+        // preceding it in the range).  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // providing access to values of a type convertible to 'value_type'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last', and they are not iterators into this map.  This method
+        // requires that the (template parameter) types 'KEY' and 'VALUE' both
+        // be "copy-constructible".
+
+    iterator erase(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  All
+        // other iterators and references to the pairs of this map are
+        // invalidated.  The behavior is undefined unless 'position' refers to
+        // a 'value_type' object in this map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object whose key is equivalent
+        // to the specified 'key', if such an entry exists, and return 1;
+        // otherwise, if there is no 'value_type' object having an equivalent
+        // key, return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return an iterator referring to the element
+        // that was at the 'last' position (which is itself invalidated).  The
+        // behavior is undefined unless 'first' and 'last' either refer to
+        // elements in this map or are the 'end' iterator, and the 'first'
+        // position is at or before the 'last' position in the ordered sequence
+        // provided by this container.
+
+    void swap(btree_map& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if this object and 'other' use the same
+        // allocator, and otherwise copies the pairs of each map using the
+        // allocator of the other.
+
+    void clear();
+        // Remove all entries from this map, and release all its nodes.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map whose key is equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain a 'value_type' object whose key is greater than
+        // 'key'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second is positioned
+        // one past the end of the sequence.  Note that since a map maintains
+        // unique keys, the range will contain at most one element.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'cend' iterator if this map is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'crend' if this map is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key', if such an entry
+        // exists; otherwise throw an 'std::out_of_range' exception.  Note
+        // that this method is not exception agnostic.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this map contains a 'value_type' object whose key
+        // is equivalent to the specified 'key', and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this map.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this map; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+        // Note that this comparator compares objects of type 'KEY', which is
+        // the key part of the 'value_type' objects contained in this map.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this map whose keys
+        // are equivalent to the specified 'key'.  Note that since a map
+        // maintains unique keys, the returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain a 'value_type' object whose key is greater
+        // than 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second is positioned
+        // one past the end of the sequence.  Note that since a map maintains
+        // unique keys, the range will contain at most one element.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'btree_map' objects have the same
+    // value if they have the same number of key-value pairs, and each pair in
+    // the ordered sequence of pairs of one object is equal to the pair at the
+    // same position in the other.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than that of the specified 'rhs' map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  This method
+    // provides the no-throw exception-safety guarantee if 'a' and 'b' use the
+    // same allocator.
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                              // ---------------
+                              // class btree_map
+                              // ---------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                   const ALLOCATOR& allocator)
+: d_tree(COMPARATOR(), allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                    const btree_map& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                original.d_tree.allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                  const btree_map& original,
+                                                  const ALLOCATOR& allocator)
+: d_tree(original.d_tree, allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                 INPUT_ITERATOR    first,
+                                                 INPUT_ITERATOR    last,
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~btree_map()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const btree_map& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
+{
+    iterator position = find(key);
+    if (position == end()) {
+        position = d_tree.insert(value_type(key, VALUE())).first;
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator position = find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "btree_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_tree.insert(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator,
+                                                     const value_type& value)
+{
+    return d_tree.insert(value).first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_tree.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_tree.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == cend()) {
+        return 0;                                                     // RETURN
+    }
+    d_tree.erase(position);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                    const_iterator last)
+{
+    // Each erasure invalidates 'last', but returns the position following the
+    // erased pair, so count the pairs to erase before erasing them.
+
+    difference_type numPairs = bsl::distance(first, last);
+
+    iterator position(first.node(), first.index());
+    while (0 < numPairs--) {
+        position = d_tree.erase(position);
+    }
+    return position;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(btree_map& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator first = lower_bound(key);
+    iterator last  = first;
+    if (last != end() && !key_comp()(key, last->first)) {
+        ++last;
+    }
+    return pair<iterator, iterator>(first, last);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const VALUE&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "btree_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_tree.comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != end() ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                    const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                    const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    const_iterator first = lower_bound(key);
+    const_iterator last  = first;
+    if (last != end() && !key_comp()(key, last->first)) {
+        ++last;
+    }
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+                                // ===========
+                                // TYPE TRAITS
+                                // ===========
+
+// Type traits for B-tree maps:
+//: o A B-tree map defines STL iterators.
+//: o A B-tree map uses 'bslma' allocators if the parameterized 'ALLOCATOR' is
+//:     convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <typename KEY,
+          typename VALUE,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct HasStlIterators<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <typename KEY,
+          typename VALUE,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct UsesBslmaAllocator<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1004 @@
+// bslstl_btreeset.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREESET
+#define INCLUDED_BSLSTL_BTREESET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set of unique keys held in a B-tree.
+//
+//@CLASSES:
+//   bsl::btree_set: ordered set of unique keys held in cache-friendly nodes
+//
+//@SEE_ALSO: bslstl_btree, bslstl_btreemap, bslstl_set, bslstl_flatset
+//
+//@DESCRIPTION: This component defines a single class template, 'btree_set',
+// implementing a container holding an ordered sequence of unique keys, with
+// the interface of 'bsl::set', whose keys are held in the nodes of a B-tree
+// (see 'bslstl_btree') rather than in a red-black tree of one node per key.
+//
+// An instantiation of 'btree_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'btree_set' contains.  The requirements on the 'KEY'
+// type are those of 'bsl::set' (see 'bslstl_set').
+//
+///Choosing Between 'set', 'btree_set', and 'flat_set'
+///---------------------------------------------------
+// A 'btree_set' holds its keys in nodes of about 256 bytes (four cache lines)
+// holding tens of keys each (for small keys), rather than in one node per
+// key holding three pointers and a color, as does 'bsl::set'.  It therefore
+// allocates and uses less memory, looks up a key with one node visit per
+// (of few) levels, and iterates over consecutive memory within each node.
+// Unlike a 'flat_set', inserting or erasing a key takes logarithmic time.
+// As keys are moved between nodes, *any* insertion or erasure invalidates
+// all iterators and references to the keys of a 'btree_set'.  See
+// 'bslstl_btreemap' for a discussion and a benchmark.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a B-tree set's 'ALLOCATOR' template parameter
+// determines how that set will allocate memory.  If the 'ALLOCATOR' is
+// 'bsl::allocator' (the default), then objects of the B-tree set type conform
+// to the standard behavior of a 'bslma'-allocator-enabled type: the set
+// accepts an optional 'bslma::Allocator' argument at construction, uses it to
+// supply memory for its nodes throughout its lifetime, and supplies it to the
+// constructors of the keys it holds if 'KEY' has the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'btree_set':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the B-tree set
+//  'a', 'b'        - two distinct objects of type 'btree_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | btree_set<K> a;    (default construction)          | O[1]               |
+//  | btree_set<K> a(al);                                |                    |
+//  | btree_set<K> a(c, al);                             |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_set<K> a(b); (copy construction)             | O[n]               |
+//  | btree_set<K> a(b, al);                             |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_set<K> a(i1, i2);                            | O[N * log(N)]      |
+//  | btree_set<K> a(i1, i2, c, al);                     |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~btree_set<K>(); (destruction)                   | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;             (assignment)                    | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty()                                | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k)                                        | O[log(n)]          |
+//  | a.insert(p1, k)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N * log(n + N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[log(n)]          |
+//  | a.erase(k)                                         |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1, p2)                                    | O[distance(p1, p2) |
+//  |                                                    |   * log(n)]        |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp(), a.value_comp()                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.contains(k), a.count(k)               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k), a.upper_bound(k)                 | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Tracking Active Session Identifiers
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to track the identifiers of the sessions active on a
+// server, which are frequently opened and closed, and to find the sessions
+// having identifiers in a given range.
+//
+// First, we define the type of the set of identifiers:
+//..
+//  typedef bsl::btree_set<int> SessionIds;
+//..
+// Then, we open a number of sessions:
+//..
+//  bslma::TestAllocator allocator;
+//  SessionIds           sessions(&allocator);
+//
+//  for (int id = 1000; id < 2000; id += 3) {
+//      assert(true == sessions.insert(id).second);
+//  }
+//  assert(334 == sessions.size());
+//..
+// Next, we close the sessions having identifiers in '[1100, 1200)':
+//..
+//  sessions.erase(sessions.lower_bound(1100), sessions.lower_bound(1200));
+//  assert(301 == sessions.size());
+//  assert(false == sessions.contains(1102));
+//..
+// Finally, we observe that the first session at or after 1100 is now 1201:
+//..
+//  assert(1201 == *sessions.lower_bound(1100));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_BTREE
+#include <bslstl_btree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'equal', 'lexicographical_compare'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                              // ===============
+                              // class btree_set
+                              // ===============
+
+template <class KEY,
+          class COMPARATOR  = std::less<KEY>,
+          class ALLOCATOR   = bsl::allocator<KEY> >
+class btree_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY') in a B-tree.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY> KeyConfig;
+        // This 'typedef' is an alias for the policy extracting the key of a
+        // key held by this set (i.e., the key itself).
+
+    typedef BloombergLP::bslstl::BTree<KeyConfig, COMPARATOR, ALLOCATOR>
+                                                                   Tree;
+        // This 'typedef' is an alias for the B-tree holding the keys of this
+        // set.
+
+    typedef bsl::allocator_traits<ALLOCATOR>           AllocatorTraits;
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::ConstIterator               iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    Tree d_tree;  // keys, in order, and key comparator
+
+  public:
+    // CREATORS
+    explicit btree_set(const COMPARATOR& comparator = COMPARATOR(),
+                       const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify an 'allocator' used
+        // to supply memory.  If 'allocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'allocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator' and
+        // 'allocator' is not supplied, the currently installed default
+        // allocator is used to supply memory.
+
+    explicit btree_set(const ALLOCATOR& allocator);
+        // Construct an empty set that will use the specified 'allocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // set.  If the template parameter 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    btree_set(const btree_set& original);
+        // Construct a set having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible".
+
+    btree_set(const btree_set& original, const ALLOCATOR& allocator);
+        // Construct a set having the same value as that of the specified
+        // 'original' that will use the specified 'allocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  This method requires that the (template parameter) type
+        // 'KEY' be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    btree_set(INPUT_ITERATOR    first,
+              INPUT_ITERATOR    last,
+              const COMPARATOR& comparator = COMPARATOR(),
+              const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those keys equivalent
+        // to a key appearing earlier in the sequence.  Optionally specify a
+        // 'comparator' used to order keys contained in this object, and an
+        // 'allocator' used to supply memory, as for the default constructor.
+        // The (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible".
+
+    ~btree_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    btree_set& operator=(const btree_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  This method requires that the (template parameter)
+        // type 'KEY' be "copy-constructible".
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, this method
+        // has no effect.  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) key in this set
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // key was inserted, and 'false' if the key was already present.  If a
+        // key is inserted, all iterators and references to the keys of this
+        // set are invalidated.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible".
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, this method
+        // has no effect.  Return an iterator referring to the (possibly newly
+        // inserted) key in this set equivalent to 'value'.  The specified
+        // 'hint' is ignored: this method takes O[log(N)] time, where N is the
+        // size of this set.  The behavior is undefined unless 'hint' is a
+        // valid iterator into this set.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to the object is not already contained in this set (nor
+        // preceding it in the range).  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // providing access to values of a type convertible to 'value_type'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last', and they are not iterators into this set.  This method
+        // requires that the (template parameter) type 'KEY' be
+        // "copy-constructible".
+
+    iterator erase(const_iterator position);
+        // Remove from this set the key at the specified 'position', and return
+        // an iterator referring to the element immediately following the
+        // removed element, or to the past-the-end position if the removed
+        // element was the last in the sequence.  All other iterators and
+        // references to the keys of this set are invalidated.  The behavior
+        // is undefined unless 'position' refers to a key in this set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the key equivalent to the specified 'key', if
+        // such a key exists, and return 1; otherwise, return 0 with no other
+        // effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the keys starting at the specified 'first'
+        // position up to, but not including the specified 'last' position,
+        // and return an iterator referring to the element that was at the
+        // 'last' position (which is itself invalidated).  The behavior is
+        // undefined unless 'first' and 'last' either refer to elements in this
+        // set or are the 'end' iterator, and the 'first' position is at or
+        // before the 'last' position in the ordered sequence provided by this
+        // container.
+
+    void swap(btree_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if this object and 'other' use the same
+        // allocator, and otherwise copies the keys of each set using the
+        // allocator of the other.
+
+    void clear();
+        // Remove all keys from this set, and release all its nodes.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first key
+        // in the ordered sequence of keys maintained by this set, or the 'end'
+        // iterator if this set is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in the ordered sequence of keys maintained by this set, or
+        // 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this set.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first key
+        // in the ordered sequence of keys maintained by this set, or the
+        // 'cend' iterator if this set is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in the ordered sequence of keys maintained by this set, or
+        // 'crend' if this set is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this set.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this set contains a key equivalent to the specified
+        // 'key', and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this set; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this set.  Note that the keys of a set are its values.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the key in
+        // this set equivalent to the specified 'key', if such a key exists,
+        // and the past-the-end ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys within this set equivalent to the
+        // specified 'key'.  Note that since a set maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set greater-than or equal-to the
+        // specified 'key', and the past-the-end iterator if this set does not
+        // contain such a key.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set greater than the specified
+        // 'key', and the past-the-end iterator if this set does not contain
+        // such a key.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence
+        // and the second is positioned one past the end of the sequence.  Note
+        // that since a set maintains unique keys, the range will contain at
+        // most one element.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'btree_set' objects have the same
+    // value if they have the same number of keys, and each key in the ordered
+    // sequence of keys of one object is equal to the key at the same position
+    // in the other.  This method requires that the (template parameter) type
+    // 'KEY' be "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  This method requires that the
+    // (template parameter) type 'KEY' be "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than that of the specified 'rhs' set, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'KEY'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(btree_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          btree_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  This method
+    // provides the no-throw exception-safety guarantee if 'a' and 'b' use the
+    // same allocator.
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                              // ---------------
+                              // class btree_set
+                              // ---------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(const ALLOCATOR& allocator)
+: d_tree(COMPARATOR(), allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(const btree_set& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                original.d_tree.allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(const btree_set& original,
+                                                 const ALLOCATOR& allocator)
+: d_tree(original.d_tree, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(INPUT_ITERATOR    first,
+                                                 INPUT_ITERATOR    last,
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::~btree_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>&
+btree_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const btree_set& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    pair<typename Tree::Iterator, bool> result = d_tree.insert(value);
+    return pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator,
+                                              const value_type& value)
+{
+    return d_tree.insert(value).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                   INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_tree.insert(*first);
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_tree.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == cend()) {
+        return 0;                                                     // RETURN
+    }
+    d_tree.erase(position);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                             const_iterator last)
+{
+    // Each erasure invalidates 'last', but returns the position following the
+    // erased key, so count the keys to erase before erasing them.
+
+    difference_type numKeys = bsl::distance(first, last);
+
+    iterator position = first;
+    while (0 < numKeys--) {
+        position = d_tree.erase(position);
+    }
+    return position;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::swap(btree_set& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.clear();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_set<KEY, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+btree_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+btree_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != end() ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator first = lower_bound(key);
+    const_iterator last  = first;
+    if (last != end() && !key_comp()(key, *last)) {
+        ++last;
+    }
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+                                // ===========
+                                // TYPE TRAITS
+                                // ===========
+
+// Type traits for B-tree sets:
+//: o A B-tree set defines STL iterators.
+//: o A B-tree set uses 'bslma' allocators if the parameterized 'ALLOCATOR' is
+//:     convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <typename KEY, typename COMPARATOR, typename ALLOCATOR>
+struct HasStlIterators<bsl::btree_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <typename KEY, typename COMPARATOR, typename ALLOCATOR>
+struct UsesBslmaAllocator<bsl::btree_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
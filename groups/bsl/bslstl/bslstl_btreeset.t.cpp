@@ -0,0 +1,983 @@
+// bslstl_btreeset.t.cpp                                              -*-C++-*-
+#include <bslstl_btreeset.h>
+
+#include <bslstl_set.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapting a 'bslstl::BTree', whose
+// algorithms are thoroughly tested by 'bslstl_btree'.  We therefore verify
+// that each method of 'btree_set' forwards to the appropriate method of the
+// tree, by comparing the state of a 'btree_set' with that of a 'bsl::set'
+// subjected to the same operations, for each sequence of keys described in a
+// table (including sequences long enough to split the root node), and that
+// the allocator supplied at construction is used for all memory, in the
+// presence of injected exceptions where an operation allocates.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] btree_set(const C& comparator = C(), const A& allocator = A());
+// [ 2] btree_set(const A& allocator);
+// [ 4] btree_set(const btree_set& original);
+// [ 4] btree_set(const btree_set& original, const A& allocator);
+// [ 3] btree_set(ITER first, ITER last, const C& comp, const A& alloc);
+// [ 2] ~btree_set();
+//
+// MANIPULATORS
+// [ 4] btree_set& operator=(const btree_set& rhs);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 5] iterator insert(const_iterator hint, const value_type& value);
+// [ 3] void insert(ITER first, ITER last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(btree_set& other);
+// [ 5] void clear();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 6] bool contains(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 6] const_iterator find(const key_type& key) const;
+// [ 6] size_type count(const key_type& key) const;
+// [ 6] const_iterator lower_bound(const key_type& key) const;
+// [ 6] const_iterator upper_bound(const key_type& key) const;
+// [ 6] pair<const_iterator, const_iterator> equal_range(const key_type&);
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const btree_set& lhs, const btree_set& rhs);
+// [ 4] bool operator!=(const btree_set& lhs, const btree_set& rhs);
+// [ 4] bool operator<(const btree_set& lhs, const btree_set& rhs);
+// [ 4] bool operator>(const btree_set& lhs, const btree_set& rhs);
+// [ 4] bool operator<=(const btree_set& lhs, const btree_set& rhs);
+// [ 4] bool operator>=(const btree_set& lhs, const btree_set& rhs);
+// [ 4] void swap(btree_set& a, btree_set& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 2] CONCERN: The type has the expected traits.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::btree_set<char> Obj;
+typedef bsl::set<char>       Model;
+
+struct DefaultDataRow {
+    int         d_line;  // source line number
+    const char *d_spec;  // keys of the sequence, in order
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  spec
+    //----  ------------------------------------------------------------------
+    { L_,   ""                                                               },
+    { L_,   "A"                                                              },
+    { L_,   "AA"                                                             },
+    { L_,   "AB"                                                             },
+    { L_,   "BA"                                                             },
+    { L_,   "ACE"                                                            },
+    { L_,   "BDF"                                                            },
+    { L_,   "ABB"                                                            },
+    { L_,   "CAB"                                                            },
+    { L_,   "FGH"                                                            },
+    { L_,   "ECAC"                                                           },
+    { L_,   "ABCDEFGH"                                                       },
+    { L_,   "HGFEDCBA"                                                       },
+    { L_,   "DADBDCDD"                                                       },
+    { L_,   "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz" },
+    { L_,   "zyxwvutsrqponmlkjihgfedcbaZYXWVUTSRQPONMLKJIHGFEDCBA9876543210" },
+    { L_,   "0a1b2c3d4e5f6g7h8i9jAkBlCmDnEoFpGqHrIsJtKuLvMwNxOyPzQRSTUVWXYZ" },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool isEqual(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of keys
+    // as the specified 'model', and 'false' otherwise.
+{
+    return object.size() == model.size()
+        && std::equal(object.begin(), object.end(), model.begin());
+}
+
+template <class ITERATOR>
+ITERATOR nth(ITERATOR first, int n)
+    // Return an iterator to the position the specified 'n' positions after
+    // the specified 'first'.
+{
+    bsl::advance(first, n);
+    return first;
+}
+
+void loadModel(Model *result, const char *spec)
+    // Insert into the specified 'result' each key of the specified 'spec'.
+{
+    result->insert(spec, spec + strlen(spec));
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Tracking Active Session Identifiers
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to track the identifiers of the sessions active on a
+// server, which are frequently opened and closed, and to find the sessions
+// having identifiers in a given range.
+//
+// First, we define the type of the set of identifiers:
+//..
+    typedef bsl::btree_set<int> SessionIds;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we open a number of sessions:
+//..
+    bslma::TestAllocator allocator;
+    SessionIds           sessions(&allocator);
+
+    for (int id = 1000; id < 2000; id += 3) {
+        ASSERT(true == sessions.insert(id).second);
+    }
+    ASSERT(334 == sessions.size());
+//..
+// Next, we close the sessions having identifiers in '[1100, 1200)':
+//..
+    sessions.erase(sessions.lower_bound(1100), sessions.lower_bound(1200));
+    ASSERT(301 == sessions.size());
+    ASSERT(false == sessions.contains(1102));
+//..
+// Finally, we observe that the first session at or after 1100 is now 1201:
+//..
+    ASSERT(1201 == *sessions.lower_bound(1100));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCHES
+        //
+        // Concerns:
+        //: 1 Each search method returns the same position as the
+        //:   corresponding method of 'bsl::set', for keys present in the
+        //:   B-tree set, and for keys ordered before, between, and after them.
+        //:
+        //: 2 'count' and 'contains' report whether the key is present.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a B-tree set and a model from
+        //:   the keys of the row, and for each key from '@' to 'I' compare the
+        //:   results of the searches, as offsets from 'begin'.  (C-1..2)
+        //
+        // Testing:
+        //   bool contains(const key_type& key) const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCHES"
+                            "\n================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            const Obj X(SPEC, SPEC + strlen(SPEC));
+            Model     model;
+            loadModel(&model, SPEC);
+            const Model& M = model;
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                const bool FOUND = M.end() != M.find(key);
+
+                ASSERTV(LINE, key, FOUND == X.contains(key));
+                ASSERTV(LINE, key, M.count(key) == X.count(key));
+
+                ASSERTV(LINE, key, bsl::distance(M.begin(), M.find(key))
+                == bsl::distance(X.begin(), X.find(key)));
+                ASSERTV(LINE, key, bsl::distance(M.begin(), M.lower_bound(key))
+                == bsl::distance(X.begin(), X.lower_bound(key)));
+                ASSERTV(LINE, key, bsl::distance(M.begin(), M.upper_bound(key))
+                == bsl::distance(X.begin(), X.upper_bound(key)));
+
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                           X.equal_range(key);
+                ASSERTV(LINE, key, X.lower_bound(key) == R.first);
+                ASSERTV(LINE, key, X.upper_bound(key) == R.second);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING HINTED INSERT, ERASE, AND CLEAR
+        //
+        // Concerns:
+        //: 1 Inserting with a hint inserts the key at its ordered position,
+        //:   whatever the hint, and returns an iterator to the (possibly
+        //:   existing) equivalent key.
+        //:
+        //: 2 Each 'erase' overload removes the same keys as the corresponding
+        //:   method of 'bsl::set', and returns the position following them.
+        //:
+        //: 3 'clear' removes all keys and releases all memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, and each key from '@' to 'I', insert
+        //:   the key into a copy of the B-tree set of the row with every
+        //:   possible hint, and compare with the model.  (C-1)
+        //:
+        //: 2 For each row of the table, erase each key, each position, and
+        //:   each range of positions of a copy of the B-tree set of the row,
+        //:   and compare with the model.  (C-2)
+        //:
+        //: 3 Call 'clear' on B-tree sets of one and several nodes, and verify
+        //:   the value and the memory in use.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING HINTED INSERT, ERASE, AND CLEAR"
+                            "\n=======================================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting hinted 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            const Obj Y(SPEC, SPEC + strlen(SPEC), std::less<char>(), &oa);
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                Model model(&sa);
+                loadModel(&model, SPEC);
+                model.insert(key);
+
+                for (int hi = 0; hi <= static_cast<int>(Y.size()); ++hi) {
+                    if (veryVerbose) { T_ P_(SPEC) P_(key) P(hi) }
+
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    Obj::iterator it = mX.insert(nth(X.begin(), hi), key);
+                    ASSERTV(LINE, key, hi, X.end() != it);
+                    ASSERTV(LINE, key, hi, key == *it);
+                    ASSERTV(LINE, key, hi, isEqual(X, model));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'erase'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            const Obj Y(SPEC, SPEC + strlen(SPEC), std::less<char>(), &oa);
+            const int SIZE = static_cast<int>(Y.size());
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                ASSERTV(LINE, key, model.erase(key) == mX.erase(key));
+                ASSERTV(LINE, key, isEqual(X, model));
+            }
+
+            for (int i = 0; i < SIZE; ++i) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                model.erase(*nth(Y.begin(), i));
+                Obj::iterator it = mX.erase(nth(X.begin(), i));
+                ASSERTV(LINE, i, nth(X.begin(), i) == it);
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            for (int i = 0; i <= SIZE; ++i) {
+                for (int j = i; j <= SIZE; ++j) {
+                    Obj   mX(Y, &oa);  const Obj& X = mX;
+                    Model model(&sa);
+                    loadModel(&model, SPEC);
+
+                    Model::iterator first = model.begin();
+                    bsl::advance(first, i);
+                    Model::iterator last = model.begin();
+                    bsl::advance(last, j);
+                    model.erase(first, last);
+
+                    Obj::iterator it = mX.erase(nth(X.begin(), i),
+                                                nth(X.begin(), j));
+                    ASSERTV(LINE, i, j, nth(X.begin(), i) == it);
+                    ASSERTV(LINE, i, j, isEqual(X, model));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'clear'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Obj mX(SPEC, SPEC + strlen(SPEC), std::less<char>(), &oa);
+            const Obj& X = mX;
+
+            mX.clear();
+            ASSERTV(LINE, X.empty());
+            ASSERTV(LINE, X.begin() == X.end());
+            ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            mX.insert(SPEC[0]);
+            ASSERTV(LINE, 1 == X.size());
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            const char SPEC[] = "AB";
+
+            Obj mX(SPEC, SPEC + 2);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   allocator supplied, or the default allocator if none is.
+        //:
+        //: 2 Assignment gives the target the value of the source, which is
+        //:   unchanged.
+        //:
+        //: 3 Two B-tree sets compare equal if and only if they hold the same
+        //:   keys, and are ordered lexicographically otherwise.
+        //:
+        //: 4 The member and free 'swap' functions exchange the values of two
+        //:   B-tree sets, without allocating if they use the same allocator.
+        //:
+        //: 5 No memory is leaked if an exception is thrown while copying.
+        //
+        // Plan:
+        //: 1 For each row of the table, copy a B-tree set holding the keys of
+        //:   the row, with and without an allocator, in the presence of
+        //:   injected exceptions.  (C-1, 5)
+        //:
+        //: 2 For each pair of rows of the table, create a B-tree set from each
+        //:   row, and compare them with each other operator, checking the
+        //:   result against that of the model.  (C-3)
+        //:
+        //: 3 Assign and swap the B-tree sets, and verify their values and the
+        //:   use of memory.  (C-2, 4)
+        //
+        // Testing:
+        //   btree_set(const btree_set& original);
+        //   btree_set(const btree_set& original, const A& allocator);
+        //   btree_set& operator=(const btree_set& rhs);
+        //   void swap(btree_set& other);
+        //   bool operator==(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator!=(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator<(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator>(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator<=(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator>=(const btree_set& lhs, const btree_set& rhs);
+        //   void swap(btree_set& a, btree_set& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING VALUE-SEMANTIC OPERATIONS"
+                            "\n=================================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\nTesting copy constructors.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+
+            const Obj Y(SPEC, SPEC + strlen(SPEC), std::less<char>(), &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(Y, &oa);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &oa == X.get_allocator());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            {
+                const Obj X(Y);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &da == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting comparison, assignment, and swap.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            Model model1;
+            loadModel(&model1, SPEC1);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2 = DATA[tj].d_line;
+                const char *const SPEC2 = DATA[tj].d_spec;
+
+                if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+                Model model2;
+                loadModel(&model2, SPEC2);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(SPEC1, SPEC1 + strlen(SPEC1), std::less<char>(), &oa);
+                const Obj& X = mX;
+                Obj mY(SPEC2, SPEC2 + strlen(SPEC2), std::less<char>(), &oa);
+                const Obj& Y = mY;
+
+                ASSERTV(LINE1, LINE2, (model1 == model2) == (X == Y));
+                ASSERTV(LINE1, LINE2, (model1 != model2) == (X != Y));
+                ASSERTV(LINE1, LINE2, (model1 <  model2) == (X <  Y));
+                ASSERTV(LINE1, LINE2, (model1 >  model2) == (X >  Y));
+                ASSERTV(LINE1, LINE2, (model1 <= model2) == (X <= Y));
+                ASSERTV(LINE1, LINE2, (model1 >= model2) == (X >= Y));
+
+                const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+                mX.swap(mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model1));
+
+                swap(mX, mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model1));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, NUM_TOTAL == oa.numBlocksTotal());
+
+                Obj *mR = &(mX = Y);
+                ASSERTV(LINE1, LINE2, &X == mR);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, &oa == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting swap with different allocators.\n");
+        {
+            bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+            bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+            const char SPEC1[] = "ACE";
+            const char SPEC2[] = "BD";
+
+            Obj mX(SPEC1, SPEC1 + 3, std::less<char>(), &oa1);
+            const Obj& X = mX;
+            Obj mY(SPEC2, SPEC2 + 2, std::less<char>(), &oa2);
+            const Obj& Y = mY;
+
+            const Obj XX(X), YY(Y);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+            ASSERT(&oa1 == X.get_allocator());
+            ASSERT(&oa2 == Y.get_allocator());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE CONSTRUCTORS AND RANGE 'insert'
+        //
+        // Concerns:
+        //: 1 A B-tree set created from, or inserted with, a range holds the
+        //:   same keys as a 'bsl::set' created from, or inserted with, the
+        //:   same range.
+        //:
+        //: 2 All memory comes from the allocator of the B-tree set, and no
+        //:   memory is leaked if an exception is thrown while inserting a
+        //:   range.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a B-tree set from the keys of
+        //:   the row, and compare with the model.  (C-1..2)
+        //:
+        //: 2 For each pair of rows of the table, insert the keys of the
+        //:   second row into a B-tree set created from the first, in the
+        //:   presence of injected exceptions, restoring the B-tree set at the
+        //:   start of each attempt, and compare with the model.  (C-1..2)
+        //
+        // Testing:
+        //   btree_set(ITER first, ITER last, const C& comp, const A& alloc);
+        //   void insert(ITER first, ITER last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING RANGE CONSTRUCTORS AND RANGE 'insert'"
+                            "\n============================================="
+                            "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting range constructor.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Model model(&sa);
+            loadModel(&model, SPEC);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(SPEC, SPEC + LENGTH, std::less<char>(), &oa);
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, &oa == X.get_allocator());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting range 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2 = DATA[tj].d_line;
+                const char *const SPEC2 = DATA[tj].d_spec;
+
+                if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Model model(&sa);
+                loadModel(&model, SPEC1);
+                loadModel(&model, SPEC2);
+
+                {
+                    const Obj  ORIGINAL(SPEC1,
+                                        SPEC1 + strlen(SPEC1),
+                                        std::less<char>(),
+                                        &sa);
+                    Obj        mX(&oa);
+                    const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        mX = ORIGINAL;
+                        mX.insert(SPEC2, SPEC2 + strlen(SPEC2));
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(LINE1, LINE2, isEqual(X, model));
+                }
+                ASSERTV(LINE1, LINE2, 0 == oa.numBlocksInUse());
+            }
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed B-tree set is empty, and uses the allocator
+        //:   and comparator supplied, or default ones if none is.
+        //:
+        //: 2 Inserting a key that is not present adds it at its ordered
+        //:   position, and inserting a key that is present has no effect;
+        //:   both return an iterator to the equivalent key, and whether it
+        //:   was inserted.
+        //:
+        //: 3 The iterators traverse the keys in order, forwards or backwards.
+        //:
+        //: 4 All memory comes from the allocator of the B-tree set, and no
+        //:   memory is leaked if an exception is thrown.
+        //:
+        //: 5 The type has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For each row of the table, insert the keys of the row one at a
+        //:   time into a B-tree set and a model, in the presence of injected
+        //:   exceptions, and compare the results and the state of the B-tree
+        //:   set with those of the model using every accessor.  (C-1..4)
+        //:
+        //: 2 Verify the traits of the type.  (C-5)
+        //
+        // Testing:
+        //   btree_set(const C& comparator = C(), const A& allocator = A());
+        //   btree_set(const A& allocator);
+        //   ~btree_set();
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   allocator_type get_allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type has the expected traits.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          "\n================================================"
+                          "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting default constructors.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const Obj W;
+            ASSERT(W.empty());
+            ASSERT(&da == W.get_allocator());
+
+            const Obj X(&oa);
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&oa == X.get_allocator());
+
+            const Obj Y(std::less<char>(), &oa);
+            ASSERT(Y.empty());
+            ASSERT(&oa == Y.get_allocator());
+            ASSERT(Y.key_comp()('A', 'B'));
+            ASSERT(!Y.value_comp()('B', 'A'));
+            ASSERT(0 < Y.max_size());
+
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) printf("\nTesting 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model model(&sa);
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const char KEY = SPEC[i];
+
+                const bsl::pair<Model::iterator, bool> EXP =
+                                                          model.insert(KEY);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const Obj ORIGINAL(X, &sa);
+
+                    const bsl::pair<Obj::iterator, bool> R = mX.insert(KEY);
+
+                    ASSERTV(LINE, i, EXP.second == R.second);
+                    ASSERTV(LINE, i, KEY == *R.first);
+                    ASSERTV(LINE, i, bsl::distance(model.begin(), EXP.first)
+                                      == bsl::distance(X.begin(), R.first));
+                    ASSERTV(LINE, i, EXP.second || ORIGINAL == X);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            ASSERTV(LINE, model.size() == X.size());
+            ASSERTV(LINE, model.empty() == X.empty());
+
+            ASSERTV(LINE, X.cbegin() == X.begin());
+            ASSERTV(LINE, X.cend() == X.end());
+            ASSERTV(LINE, X.crbegin() == X.rbegin());
+            ASSERTV(LINE, X.crend() == X.rend());
+            ASSERTV(LINE, std::equal(X.rbegin(), X.rend(), model.rbegin()));
+            ASSERTV(LINE, static_cast<Obj::difference_type>(X.size())
+                                   == bsl::distance(X.rbegin(), X.rend()));
+            ASSERTV(LINE, (0 == X.size()) == (0 == oa.numBlocksInUse()));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a B-tree set of 'int', insert a few keys one at a time and
+        //:   as a range, search for some keys, and erase some keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bsl::btree_set<int> mX;  const bsl::btree_set<int>& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT(true  == mX.insert(3).second);
+        ASSERT(true  == mX.insert(1).second);
+        ASSERT(false == mX.insert(3).second);
+        ASSERT(2 == X.size());
+        ASSERT(1 == *X.begin());
+
+        const int VALUES[] = { 5, 2, 4, 1 };
+        mX.insert(VALUES, VALUES + 4);
+        ASSERT(5 == X.size());
+        for (int i = 0; i < 5; ++i) {
+            ASSERTV(i, *nth(X.begin(), i), i + 1 == *nth(X.begin(), i));
+        }
+
+        ASSERT(X.contains(4));
+        ASSERT(!X.contains(6));
+        ASSERT(nth(X.begin(), 2) == X.find(3));
+        ASSERT(X.end()       == X.find(0));
+
+        ASSERT(1 == mX.erase(3));
+        ASSERT(0 == mX.erase(3));
+        ASSERT(4 == X.size());
+
+        bsl::btree_set<int> mY(X);  const bsl::btree_set<int>& Y = mY;
+        ASSERT(X == Y);
+        mY.insert(6);
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
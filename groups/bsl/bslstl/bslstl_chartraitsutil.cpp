@@ -0,0 +1,657 @@
+// bslstl_chartraitsutil.cpp                                          -*-C++-*-
+#include <bslstl_chartraitsutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+    #include <emmintrin.h>
+#endif
+
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)                                   \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+    #define BSLSTL_CHARTRAITSUTIL_USE_AVX2 1
+    #include <immintrin.h>
+
+    #define BSLSTL_CHARTRAITSUTIL_AVX2_TARGET __attribute__((target("avx2")))
+        // Enable the use of AVX2 instructions in the function being declared,
+        // regardless of the target of the rest of this file.
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    #include <intrin.h>
+#endif
+
+// IMPLEMENTATION NOTES: Each kernel has a scalar, an SSE2, and an AVX2
+// implementation, and 'CharTraitsUtil_Imp' dispatches to one of them
+// according to 's_instructionSet', which is initialized (during the dynamic
+// initialization of this file) to the most capable instruction set supported
+// by the CPU.  Kernels called before that initialization see the value 0
+// ('e_SCALAR'), so they are correct, if slower, regardless of the order of
+// initialization.
+//
+// The 'find', 'mismatch', and 'assign' kernels process whole blocks (of 16 or
+// 32 bytes) using unaligned loads and stores, and the remaining characters
+// one at a time.  The 'length' kernel, which does not know the extent of its
+// argument, first examines characters one at a time until the address is
+// aligned to the block size, and then loads aligned blocks: an aligned block
+// containing at least one character of the string never crosses a page
+// boundary, so loading it cannot fault even if it extends past the
+// terminating null character.  (The AVX2 kernel, which examines two blocks per
+// iteration, aligns the pair of blocks to 64 bytes for the same reason.)
+// Characters of the types supported are aligned to their size, so the lanes
+// of an aligned block coincide with characters.
+
+namespace BloombergLP {
+
+namespace {
+
+typedef native_std::size_t SizeType;
+
+typedef bslstl::CharTraitsUtil_InstructionSet InstructionSet;
+
+                          // ------------------------
+                          // local functions: bit ops
+                          // ------------------------
+
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+
+inline
+int lowestBit(unsigned int mask)
+    // Return the index of the least-significant set bit of the specified
+    // 'mask'.  The behavior is undefined unless '0 != mask'.
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+#endif
+
+                            // ===================
+                            // struct ScalarKernel
+                            // ===================
+
+template <class CHAR_TYPE>
+struct ScalarKernel {
+    // This 'struct' template provides a namespace for the portable
+    // implementations of the kernels of 'CharTraitsUtil_Imp'.
+
+    static SizeType length(const CHAR_TYPE *string)
+        // Return the length of the specified null-terminated 'string'.
+    {
+        const CHAR_TYPE *end = string;
+        while (0 != *end) {
+            ++end;
+        }
+        return end - string;
+    }
+
+    static const CHAR_TYPE *find(const CHAR_TYPE *string,
+                                 SizeType         length,
+                                 CHAR_TYPE        character)
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' equal to the specified
+        // 'character', or 0 if there is none.
+    {
+        for (const CHAR_TYPE *end = string + length; string != end; ++string) {
+            if (*string == character) {
+                return string;                                        // RETURN
+            }
+        }
+        return 0;
+    }
+
+    static SizeType mismatch(const CHAR_TYPE *lhs,
+                             const CHAR_TYPE *rhs,
+                             SizeType         length)
+        // Return the index of the first difference between the specified
+        // 'lhs' and 'rhs' arrays of the specified 'length', or 'length'.
+    {
+        SizeType index = 0;
+        while (index < length && lhs[index] == rhs[index]) {
+            ++index;
+        }
+        return index;
+    }
+
+    static void assign(CHAR_TYPE *string,
+                       SizeType   length,
+                       CHAR_TYPE  character)
+        // Assign the specified 'character' to the specified 'length'
+        // characters of the specified 'string'.
+    {
+        for (CHAR_TYPE *end = string + length; string != end; ++string) {
+            *string = character;
+        }
+    }
+};
+
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+
+                              // ================
+                              // struct Sse2Lanes
+                              // ================
+
+template <int CHAR_SIZE>
+struct Sse2Lanes;
+    // This 'struct' template provides the SSE2 operations on characters of
+    // the (template parameter) 'CHAR_SIZE' bytes.
+
+template <>
+struct Sse2Lanes<2> {
+    static __m128i splat(unsigned int character)
+        // Return a block each character of which is the specified
+        // 'character'.
+    {
+        return _mm_set1_epi16(static_cast<short>(character));
+    }
+
+    static __m128i equal(__m128i lhs, __m128i rhs)
+        // Return a block whose characters are all ones where the specified
+        // 'lhs' and 'rhs' are equal, and zero elsewhere.
+    {
+        return _mm_cmpeq_epi16(lhs, rhs);
+    }
+};
+
+template <>
+struct Sse2Lanes<4> {
+    static __m128i splat(unsigned int character)
+        // Return a block each character of which is the specified
+        // 'character'.
+    {
+        return _mm_set1_epi32(static_cast<int>(character));
+    }
+
+    static __m128i equal(__m128i lhs, __m128i rhs)
+        // Return a block whose characters are all ones where the specified
+        // 'lhs' and 'rhs' are equal, and zero elsewhere.
+    {
+        return _mm_cmpeq_epi32(lhs, rhs);
+    }
+};
+
+                             // =================
+                             // struct Sse2Kernel
+                             // =================
+
+template <class CHAR_TYPE>
+struct Sse2Kernel {
+    // This 'struct' template provides a namespace for the SSE2
+    // implementations of the kernels of 'CharTraitsUtil_Imp'.
+
+    // TYPES
+    typedef Sse2Lanes<sizeof(CHAR_TYPE)> Lanes;
+    typedef const __m128i               *BlockPtr;
+
+    enum { k_BLOCK = 16 / sizeof(CHAR_TYPE) };  // characters per block
+
+    static SizeType length(const CHAR_TYPE *string)
+        // Return the length of the specified null-terminated 'string'.
+    {
+        const CHAR_TYPE *current = string;
+        while (reinterpret_cast<native_std::size_t>(current) & 15) {
+            if (0 == *current) {
+                return current - string;                              // RETURN
+            }
+            ++current;
+        }
+
+        const __m128i zero = _mm_setzero_si128();
+        for (;; current += k_BLOCK) {
+            const unsigned int mask = _mm_movemask_epi8(Lanes::equal(
+                       _mm_load_si128(reinterpret_cast<BlockPtr>(current)),
+                       zero));
+            if (mask) {
+                return current - string
+                                  + lowestBit(mask) / sizeof(CHAR_TYPE);
+                                                                      // RETURN
+            }
+        }
+    }
+
+    static const CHAR_TYPE *find(const CHAR_TYPE *string,
+                                 SizeType         length,
+                                 CHAR_TYPE        character)
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' equal to the specified
+        // 'character', or 0 if there is none.
+    {
+        const __m128i value = Lanes::splat(character);
+
+        for (; k_BLOCK <= length; length -= k_BLOCK, string += k_BLOCK) {
+            const unsigned int mask = _mm_movemask_epi8(Lanes::equal(
+                       _mm_loadu_si128(reinterpret_cast<BlockPtr>(string)),
+                       value));
+            if (mask) {
+                return string + lowestBit(mask) / sizeof(CHAR_TYPE);
+                                                                      // RETURN
+            }
+        }
+        return ScalarKernel<CHAR_TYPE>::find(string, length, character);
+    }
+
+    static SizeType mismatch(const CHAR_TYPE *lhs,
+                             const CHAR_TYPE *rhs,
+                             SizeType         length)
+        // Return the index of the first difference between the specified
+        // 'lhs' and 'rhs' arrays of the specified 'length', or 'length'.
+    {
+        SizeType index = 0;
+        for (; index + k_BLOCK <= length; index += k_BLOCK) {
+            const unsigned int mask = _mm_movemask_epi8(Lanes::equal(
+                  _mm_loadu_si128(reinterpret_cast<BlockPtr>(lhs + index)),
+                  _mm_loadu_si128(reinterpret_cast<BlockPtr>(rhs + index))));
+            if (0xffff != mask) {
+                return index + lowestBit(~mask) / sizeof(CHAR_TYPE);
+                                                                      // RETURN
+            }
+        }
+        return index + ScalarKernel<CHAR_TYPE>::mismatch(lhs + index,
+                                                         rhs + index,
+                                                         length - index);
+    }
+
+    static void assign(CHAR_TYPE *string,
+                       SizeType   length,
+                       CHAR_TYPE  character)
+        // Assign the specified 'character' to the specified 'length'
+        // characters of the specified 'string'.
+    {
+        const __m128i value = Lanes::splat(character);
+
+        for (; k_BLOCK <= length; length -= k_BLOCK, string += k_BLOCK) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(string), value);
+        }
+        ScalarKernel<CHAR_TYPE>::assign(string, length, character);
+    }
+};
+
+#endif
+
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_AVX2)
+
+                              // ================
+                              // struct Avx2Lanes
+                              // ================
+
+template <int CHAR_SIZE>
+struct Avx2Lanes;
+    // This 'struct' template provides the AVX2 operations on characters of
+    // the (template parameter) 'CHAR_SIZE' bytes.
+
+template <>
+struct Avx2Lanes<2> {
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static __m256i splat(unsigned int character)
+        // Return a block each character of which is the specified
+        // 'character'.
+    {
+        return _mm256_set1_epi16(static_cast<short>(character));
+    }
+
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static __m256i equal(__m256i lhs, __m256i rhs)
+        // Return a block whose characters are all ones where the specified
+        // 'lhs' and 'rhs' are equal, and zero elsewhere.
+    {
+        return _mm256_cmpeq_epi16(lhs, rhs);
+    }
+};
+
+template <>
+struct Avx2Lanes<4> {
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static __m256i splat(unsigned int character)
+        // Return a block each character of which is the specified
+        // 'character'.
+    {
+        return _mm256_set1_epi32(static_cast<int>(character));
+    }
+
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static __m256i equal(__m256i lhs, __m256i rhs)
+        // Return a block whose characters are all ones where the specified
+        // 'lhs' and 'rhs' are equal, and zero elsewhere.
+    {
+        return _mm256_cmpeq_epi32(lhs, rhs);
+    }
+};
+
+                             // =================
+                             // struct Avx2Kernel
+                             // =================
+
+template <class CHAR_TYPE>
+struct Avx2Kernel {
+    // This 'struct' template provides a namespace for the AVX2
+    // implementations of the kernels of 'CharTraitsUtil_Imp'.  The loops of
+    // 'length', 'find', and 'mismatch' examine two blocks per iteration.
+
+    // TYPES
+    typedef Avx2Lanes<sizeof(CHAR_TYPE)> Lanes;
+    typedef const __m256i               *BlockPtr;
+
+    enum { k_BLOCK = 32 / sizeof(CHAR_TYPE) };  // characters per block
+
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static unsigned int equalMask(const CHAR_TYPE *block, __m256i value)
+        // Return a mask having bit 'i' set if byte 'i' of the (unaligned)
+        // block at the specified 'block' address is part of a character equal
+        // to the corresponding character of the specified 'value'.
+    {
+        return static_cast<unsigned int>(_mm256_movemask_epi8(Lanes::equal(
+                        _mm256_loadu_si256(reinterpret_cast<BlockPtr>(block)),
+                        value)));
+    }
+
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static SizeType length(const CHAR_TYPE *string)
+        // Return the length of the specified null-terminated 'string'.
+    {
+        const CHAR_TYPE *current = string;
+        while (reinterpret_cast<native_std::size_t>(current) & 31) {
+            if (0 == *current) {
+                return current - string;                              // RETURN
+            }
+            ++current;
+        }
+
+        const __m256i zero = _mm256_setzero_si256();
+        if (reinterpret_cast<native_std::size_t>(current) & 63) {
+            const unsigned int mask = equalMask(current, zero);
+            if (mask) {
+                return current - string
+                                  + lowestBit(mask) / sizeof(CHAR_TYPE);
+                                                                      // RETURN
+            }
+            current += k_BLOCK;
+        }
+
+        for (;; current += 2 * k_BLOCK) {
+            const __m256i first  = Lanes::equal(
+                     _mm256_load_si256(reinterpret_cast<BlockPtr>(current)),
+                     zero);
+            const __m256i second = Lanes::equal(
+                     _mm256_load_si256(reinterpret_cast<BlockPtr>(current
+                                                                + k_BLOCK)),
+                     zero);
+            const __m256i either = _mm256_or_si256(first, second);
+            if (!_mm256_testz_si256(either, either)) {
+                unsigned int mask = _mm256_movemask_epi8(first);
+                if (!mask) {
+                    current += k_BLOCK;
+                    mask     = _mm256_movemask_epi8(second);
+                }
+                return current - string
+                                  + lowestBit(mask) / sizeof(CHAR_TYPE);
+                                                                      // RETURN
+            }
+        }
+    }
+
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static const CHAR_TYPE *find(const CHAR_TYPE *string,
+                                 SizeType         length,
+                                 CHAR_TYPE        character)
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' equal to the specified
+        // 'character', or 0 if there is none.
+    {
+        const __m256i value = Lanes::splat(character);
+
+        for (; 2 * k_BLOCK <= length;
+                               length -= 2 * k_BLOCK, string += 2 * k_BLOCK) {
+            const __m256i first  = Lanes::equal(
+                      _mm256_loadu_si256(reinterpret_cast<BlockPtr>(string)),
+                      value);
+            const __m256i second = Lanes::equal(
+                      _mm256_loadu_si256(reinterpret_cast<BlockPtr>(string
+                                                                + k_BLOCK)),
+                      value);
+            const __m256i either = _mm256_or_si256(first, second);
+            if (!_mm256_testz_si256(either, either)) {
+                break;
+            }
+        }
+        for (; k_BLOCK <= length; length -= k_BLOCK, string += k_BLOCK) {
+            const unsigned int mask = equalMask(string, value);
+            if (mask) {
+                return string + lowestBit(mask) / sizeof(CHAR_TYPE);
+                                                                      // RETURN
+            }
+        }
+        return ScalarKernel<CHAR_TYPE>::find(string, length, character);
+    }
+
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static SizeType mismatch(const CHAR_TYPE *lhs,
+                             const CHAR_TYPE *rhs,
+                             SizeType         length)
+        // Return the index of the first difference between the specified
+        // 'lhs' and 'rhs' arrays of the specified 'length', or 'length'.
+    {
+        SizeType index = 0;
+        for (; index + k_BLOCK <= length; index += k_BLOCK) {
+            const unsigned int mask = equalMask(
+                     lhs + index,
+                     _mm256_loadu_si256(reinterpret_cast<BlockPtr>(rhs
+                                                                  + index)));
+            if (0xffffffffu != mask) {
+                return index + lowestBit(~mask) / sizeof(CHAR_TYPE);
+                                                                      // RETURN
+            }
+        }
+        return index + ScalarKernel<CHAR_TYPE>::mismatch(lhs + index,
+                                                         rhs + index,
+                                                         length - index);
+    }
+
+    BSLSTL_CHARTRAITSUTIL_AVX2_TARGET
+    static void assign(CHAR_TYPE *string,
+                       SizeType   length,
+                       CHAR_TYPE  character)
+        // Assign the specified 'character' to the specified 'length'
+        // characters of the specified 'string'.
+    {
+        const __m256i value = Lanes::splat(character);
+
+        for (; k_BLOCK <= length; length -= k_BLOCK, string += k_BLOCK) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(string), value);
+        }
+        ScalarKernel<CHAR_TYPE>::assign(string, length, character);
+    }
+};
+
+#endif
+
+                       // ------------------------------
+                       // local functions: CPU detection
+                       // ------------------------------
+
+InstructionSet::Enum detectInstructionSet()
+    // Return the most capable instruction set supported by this compilation
+    // and by the CPU.
+{
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return InstructionSet::e_AVX2;                                // RETURN
+    }
+#endif
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+    return InstructionSet::e_SSE2;
+#else
+    return InstructionSet::e_SCALAR;
+#endif
+}
+
+const InstructionSet::Enum s_supported = detectInstructionSet();
+    // most capable instruction set available
+
+InstructionSet::Enum s_instructionSet = s_supported;
+    // instruction set in use (see {IMPLEMENTATION NOTES})
+
+}  // close unnamed namespace
+
+namespace bslstl {
+
+                    // ------------------------------------
+                    // struct CharTraitsUtil_InstructionSet
+                    // ------------------------------------
+
+// CLASS METHODS
+CharTraitsUtil_InstructionSet::Enum
+CharTraitsUtil_InstructionSet::select(Enum instructionSet)
+{
+    s_instructionSet = instructionSet < supported() ? instructionSet
+                                                    : supported();
+    return s_instructionSet;
+}
+
+CharTraitsUtil_InstructionSet::Enum CharTraitsUtil_InstructionSet::selected()
+{
+    return s_instructionSet;
+}
+
+CharTraitsUtil_InstructionSet::Enum CharTraitsUtil_InstructionSet::supported()
+{
+    // 's_supported' is not used, as it may not yet be initialized.
+
+    return detectInstructionSet();
+}
+
+                         // -------------------------
+                         // struct CharTraitsUtil_Imp
+                         // -------------------------
+
+// CLASS METHODS
+template <class CHAR_TYPE>
+typename CharTraitsUtil_Imp<CHAR_TYPE>::SizeType
+CharTraitsUtil_Imp<CHAR_TYPE>::length(const CHAR_TYPE *string)
+{
+    switch (s_instructionSet) {
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_AVX2)
+      case InstructionSet::e_AVX2: {
+        return Avx2Kernel<CHAR_TYPE>::length(string);                 // RETURN
+      }
+#endif
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+      case InstructionSet::e_SSE2: {
+        return Sse2Kernel<CHAR_TYPE>::length(string);                 // RETURN
+      }
+#endif
+      default: {
+        return ScalarKernel<CHAR_TYPE>::length(string);               // RETURN
+      }
+    }
+}
+
+template <class CHAR_TYPE>
+const CHAR_TYPE *
+CharTraitsUtil_Imp<CHAR_TYPE>::find(const CHAR_TYPE *string,
+                                    SizeType         length,
+                                    CHAR_TYPE        character)
+{
+    switch (s_instructionSet) {
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_AVX2)
+      case InstructionSet::e_AVX2: {
+        return Avx2Kernel<CHAR_TYPE>::find(string, length, character);
+                                                                      // RETURN
+      }
+#endif
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+      case InstructionSet::e_SSE2: {
+        return Sse2Kernel<CHAR_TYPE>::find(string, length, character);
+                                                                      // RETURN
+      }
+#endif
+      default: {
+        return ScalarKernel<CHAR_TYPE>::find(string, length, character);
+                                                                      // RETURN
+      }
+    }
+}
+
+template <class CHAR_TYPE>
+typename CharTraitsUtil_Imp<CHAR_TYPE>::SizeType
+CharTraitsUtil_Imp<CHAR_TYPE>::mismatch(const CHAR_TYPE *lhs,
+                                        const CHAR_TYPE *rhs,
+                                        SizeType         length)
+{
+    switch (s_instructionSet) {
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_AVX2)
+      case InstructionSet::e_AVX2: {
+        return Avx2Kernel<CHAR_TYPE>::mismatch(lhs, rhs, length);     // RETURN
+      }
+#endif
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+      case InstructionSet::e_SSE2: {
+        return Sse2Kernel<CHAR_TYPE>::mismatch(lhs, rhs, length);     // RETURN
+      }
+#endif
+      default: {
+        return ScalarKernel<CHAR_TYPE>::mismatch(lhs, rhs, length);   // RETURN
+      }
+    }
+}
+
+template <class CHAR_TYPE>
+void CharTraitsUtil_Imp<CHAR_TYPE>::assign(CHAR_TYPE *string,
+                                           SizeType   length,
+                                           CHAR_TYPE  character)
+{
+    switch (s_instructionSet) {
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_AVX2)
+      case InstructionSet::e_AVX2: {
+        Avx2Kernel<CHAR_TYPE>::assign(string, length, character);
+      } break;
+#endif
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2)
+      case InstructionSet::e_SSE2: {
+        Sse2Kernel<CHAR_TYPE>::assign(string, length, character);
+      } break;
+#endif
+      default: {
+        ScalarKernel<CHAR_TYPE>::assign(string, length, character);
+      }
+    }
+}
+
+template struct CharTraitsUtil_Imp<wchar_t>;
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+template struct CharTraitsUtil_Imp<char16_t>;
+template struct CharTraitsUtil_Imp<char32_t>;
+#endif
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,490 @@
+// bslstl_chartraitsutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_CHARTRAITSUTIL
+#define INCLUDED_BSLSTL_CHARTRAITSUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectorized bulk operations on arrays of wide characters.
+//
+//@CLASSES:
+//  bslstl::CharTraitsUtil: namespace for bulk character-traits operations
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref, bslstl_stringsearchutil
+//
+//@DESCRIPTION: This component provides a 'struct' template,
+// 'bslstl::CharTraitsUtil', parameterized by a character traits type, that
+// serves as a namespace for the operations of the traits type that process
+// arrays of characters: 'length', 'find', 'compare', and the filling overload
+// of 'assign'.  Each function has the same contract as the function of the
+// same name in the traits type, and 'bsl::basic_string' and
+// 'bslstl::StringRef' perform these operations through 'CharTraitsUtil'
+// rather than directly through their traits type.
+//
+// The primary template forwards each function to the traits type (but see
+// {Platform Notes}).  The specializations for the traits types of wide
+// characters ('native_std::char_traits<wchar_t>' and, where the compiler
+// supports them, 'native_std::char_traits<char16_t>' and
+// 'native_std::char_traits<char32_t>') implement the functions using SIMD
+// instructions that process 16 or 32 bytes at a time, relying on the fact
+// that these traits compare characters by value, so that equality is bitwise
+// equality.  The instruction set is selected at run-time:
+//
+//: o AVX2 (32 bytes at a time) if the CPU supports it, the compiler is GCC
+//:   (4.9 or later) or Clang, and the target is x86.
+//:
+//: o SSE2 (16 bytes at a time) on all other x86 targets supported by GCC,
+//:   Clang, or MSVC.
+//:
+//: o Portable scalar loops elsewhere.
+//
+// Note that the results of the functions do not depend on the instruction set
+// used, so the specializations are transparent to clients.
+//
+///Platform Notes
+///--------------
+// The GNU C library already implements the functions used by
+// 'native_std::char_traits<wchar_t>' ('wcslen', 'wmemchr', 'wmemcmp', and
+// 'wmemset') with SIMD instructions selected at run-time, and these are as
+// fast as the kernels of this component for strings of more than a few dozen
+// characters.  On platforms using the GNU C library,
+// 'CharTraitsUtil<native_std::char_traits<wchar_t> >' is therefore the
+// primary template; the 'char16_t' and 'char32_t' traits, which the
+// standard libraries implement as scalar loops, use the kernels on all
+// platforms.
+//
+// The 'find' function of the native 'char_traits' on Sun and HP returns
+// incorrect results for character types other than 'char'; the primary
+// template implements 'find' using 'eq' on those platforms.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Comparing Wide Strings
+///- - - - - - - - - - - - - - - - -
+// Suppose that we need to compare two wide character arrays, which are not
+// necessarily null-terminated, in the same way as 'bsl::wstring' does.
+// First, we define the arrays:
+//..
+//  const wchar_t lhs[] = L"wide characters, first";
+//  const wchar_t rhs[] = L"wide characters, second";
+//..
+// Then, we find their lengths, and compare them using the traits of
+// 'bsl::wstring':
+//..
+//  typedef bslstl::CharTraitsUtil<std::char_traits<wchar_t> > Util;
+//
+//  const std::size_t lhsLength = Util::length(lhs);
+//  const std::size_t rhsLength = Util::length(rhs);
+//  assert(22 == lhsLength);
+//  assert(23 == rhsLength);
+//
+//  assert(0 > Util::compare(lhs, rhs, lhsLength));
+//..
+// Next, we locate the comma in 'lhs':
+//..
+//  assert(lhs + 15 == Util::find(lhs, lhsLength, L','));
+//..
+// Finally, we overwrite the characters following the comma with spaces:
+//..
+//  wchar_t buffer[sizeof lhs / sizeof *lhs];
+//  std::memcpy(buffer, lhs, sizeof lhs);
+//
+//  Util::assign(buffer + 16, lhsLength - 16, L' ');
+//  assert(0 == Util::compare(buffer, L"wide characters,      ", lhsLength));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_string.h> instead of <bslstl_chartraitsutil.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_STRING
+#include <string>  // for 'native_std::char_traits'
+#define INCLUDED_STRING
+#endif
+
+#if (defined(BSLS_PLATFORM_CPU_X86_64)                                       \
+  || defined(__SSE2__)                                                        \
+  || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))                                \
+ && (defined(BSLS_PLATFORM_CMP_GNU)                                           \
+  || defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || defined(BSLS_PLATFORM_CMP_MSVC))
+    #define BSLSTL_CHARTRAITSUTIL_USE_SSE2 1
+#endif
+
+#if defined(BSLSTL_CHARTRAITSUTIL_USE_SSE2) && !defined(__GLIBC__)
+    #define BSLSTL_CHARTRAITSUTIL_VECTORIZE_WCHAR 1
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                    // ====================================
+                    // struct CharTraitsUtil_InstructionSet
+                    // ====================================
+
+struct CharTraitsUtil_InstructionSet {
+    // [!PRIVATE!] This 'struct' provides a namespace for the enumeration of
+    // the instruction sets used by the kernels of this component, and for
+    // functions to query and (for testing and benchmarking) select the
+    // instruction set in use.
+
+    // TYPES
+    enum Enum {
+        e_SCALAR = 0,  // portable scalar loops
+        e_SSE2   = 1,  // 16 bytes at a time
+        e_AVX2   = 2   // 32 bytes at a time
+    };
+
+    // CLASS METHODS
+    static Enum select(Enum instructionSet);
+        // Use the specified 'instructionSet' for subsequent operations if it
+        // is supported, and the most capable supported instruction set that
+        // is less capable than 'instructionSet' otherwise, and return the
+        // instruction set that is selected.  Note that this function is
+        // intended for testing and benchmarking only, and must not be called
+        // while any other thread is using this component.
+
+    static Enum selected();
+        // Return the instruction set in use.
+
+    static Enum supported();
+        // Return the most capable instruction set supported by the compiler
+        // and by the CPU.  Note that this is the instruction set in use
+        // unless 'select' has been called.
+};
+
+                         // =========================
+                         // struct CharTraitsUtil_Imp
+                         // =========================
+
+template <class CHAR_TYPE>
+struct CharTraitsUtil_Imp {
+    // [!PRIVATE!] This 'struct' template provides a namespace for the
+    // kernels, operating on arrays of the (template parameter) 'CHAR_TYPE',
+    // that compare characters bitwise.  The functions are defined (and
+    // instantiated) in the '.cpp' file for 'wchar_t' and, where supported,
+    // 'char16_t' and 'char32_t'.
+
+    // PUBLIC TYPES
+    typedef native_std::size_t SizeType;
+
+    // CLASS METHODS
+    static SizeType length(const CHAR_TYPE *string);
+        // Return the number of characters in the specified null-terminated
+        // 'string', not including the terminating null character.
+
+    static const CHAR_TYPE *find(const CHAR_TYPE *string,
+                                 SizeType         length,
+                                 CHAR_TYPE        character);
+        // Return the address of the first character in the specified 'string'
+        // of the specified 'length' that is equal to the specified
+        // 'character', or 0 if there is none.
+
+    static SizeType mismatch(const CHAR_TYPE *lhs,
+                             const CHAR_TYPE *rhs,
+                             SizeType         length);
+        // Return the index of the first position at which the specified
+        // 'lhs' and 'rhs' arrays of the specified 'length' differ, or
+        // 'length' if they are equal.
+
+    static void assign(CHAR_TYPE *string,
+                       SizeType   length,
+                       CHAR_TYPE  character);
+        // Assign the specified 'character' to each of the specified 'length'
+        // characters of the specified 'string'.
+};
+
+                           // =====================
+                           // struct CharTraitsUtil
+                           // =====================
+
+template <class CHAR_TRAITS>
+struct CharTraitsUtil {
+    // This 'struct' template provides a namespace for the operations of the
+    // (template parameter) 'CHAR_TRAITS' type that process arrays of
+    // characters.  Each function has the contract of the function of the same
+    // name in 'CHAR_TRAITS'.
+
+    // PUBLIC TYPES
+    typedef typename CHAR_TRAITS::char_type CharType;
+    typedef native_std::size_t              SizeType;
+
+    // CLASS METHODS
+    static SizeType length(const CharType *string);
+        // Return the number of characters in the specified null-terminated
+        // 'string', not including the terminating null character.
+
+    static const CharType *find(const CharType  *string,
+                                SizeType         length,
+                                const CharType&  character);
+        // Return the address of the first character in the specified 'string'
+        // of the specified 'length' that is equal to the specified
+        // 'character', or 0 if there is none.
+
+    static int compare(const CharType *lhs,
+                       const CharType *rhs,
+                       SizeType        length);
+        // Lexicographically compare the specified 'lhs' and 'rhs' arrays of
+        // the specified 'length', and return a negative value if 'lhs' is
+        // less than 'rhs', 0 if they are equal, and a positive value
+        // otherwise.
+
+    static CharType *assign(CharType        *string,
+                            SizeType         length,
+                            const CharType&  character);
+        // Assign the specified 'character' to each of the specified 'length'
+        // characters of the specified 'string', and return 'string'.
+};
+
+                         // ==========================
+                         // struct CharTraitsUtil_Wide
+                         // ==========================
+
+template <class CHAR_TRAITS>
+struct CharTraitsUtil_Wide {
+    // [!PRIVATE!] This 'struct' template implements the functions of
+    // 'CharTraitsUtil' for the (template parameter) 'CHAR_TRAITS' type in
+    // terms of the kernels of 'CharTraitsUtil_Imp'.  The behavior is
+    // undefined unless 'CHAR_TRAITS::eq' is bitwise equality.
+
+    // PUBLIC TYPES
+    typedef typename CHAR_TRAITS::char_type CharType;
+    typedef native_std::size_t              SizeType;
+
+  private:
+    // PRIVATE TYPES
+    typedef CharTraitsUtil_Imp<CharType> Imp;
+
+  public:
+    // CLASS METHODS
+    static SizeType length(const CharType *string);
+        // Return the number of characters in the specified null-terminated
+        // 'string', not including the terminating null character.
+
+    static const CharType *find(const CharType  *string,
+                                SizeType         length,
+                                const CharType&  character);
+        // Return the address of the first character in the specified 'string'
+        // of the specified 'length' that is equal to the specified
+        // 'character', or 0 if there is none.
+
+    static int compare(const CharType *lhs,
+                       const CharType *rhs,
+                       SizeType        length);
+        // Lexicographically compare the specified 'lhs' and 'rhs' arrays of
+        // the specified 'length' using 'CHAR_TRAITS::lt', and return a
+        // negative value if 'lhs' is less than 'rhs', 0 if they are equal,
+        // and a positive value otherwise.
+
+    static CharType *assign(CharType        *string,
+                            SizeType         length,
+                            const CharType&  character);
+        // Assign the specified 'character' to each of the specified 'length'
+        // characters of the specified 'string', and return 'string'.
+};
+
+#if defined(BSLSTL_CHARTRAITSUTIL_VECTORIZE_WCHAR)
+
+          // ========================================================
+          // struct CharTraitsUtil<native_std::char_traits<wchar_t> >
+          // ========================================================
+
+template <>
+struct CharTraitsUtil<native_std::char_traits<wchar_t> >
+    : CharTraitsUtil_Wide<native_std::char_traits<wchar_t> > {
+    // This specialization of 'CharTraitsUtil' for 'wchar_t' strings provides
+    // the functions of the primary template, implemented using SIMD kernels.
+};
+
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+
+         // =========================================================
+         // struct CharTraitsUtil<native_std::char_traits<char16_t> >
+         // =========================================================
+
+template <>
+struct CharTraitsUtil<native_std::char_traits<char16_t> >
+    : CharTraitsUtil_Wide<native_std::char_traits<char16_t> > {
+    // This specialization of 'CharTraitsUtil' for 'char16_t' strings
+    // provides the functions of the primary template, implemented using SIMD
+    // kernels.
+};
+
+         // =========================================================
+         // struct CharTraitsUtil<native_std::char_traits<char32_t> >
+         // =========================================================
+
+template <>
+struct CharTraitsUtil<native_std::char_traits<char32_t> >
+    : CharTraitsUtil_Wide<native_std::char_traits<char32_t> > {
+    // This specialization of 'CharTraitsUtil' for 'char32_t' strings
+    // provides the functions of the primary template, implemented using SIMD
+    // kernels.
+};
+
+#endif
+
+// ============================================================================
+//                      TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // struct CharTraitsUtil
+                           // ---------------------
+
+// CLASS METHODS
+template <class CHAR_TRAITS>
+inline
+typename CharTraitsUtil<CHAR_TRAITS>::SizeType
+CharTraitsUtil<CHAR_TRAITS>::length(const CharType *string)
+{
+    return CHAR_TRAITS::length(string);
+}
+
+template <class CHAR_TRAITS>
+inline
+const typename CharTraitsUtil<CHAR_TRAITS>::CharType *
+CharTraitsUtil<CHAR_TRAITS>::find(const CharType  *string,
+                                  SizeType         length,
+                                  const CharType&  character)
+{
+#if defined(BSLS_PLATFORM_CMP_SUN) || defined(BSLS_PLATFORM_CMP_HP)
+    // Sun's and HP's 'char_traits::find' return incorrect results for
+    // character types other than 'char'.
+
+    if (sizeof(CharType) != 1) {
+        for (; 0 < length; --length, ++string) {
+            if (CHAR_TRAITS::eq(*string, character)) {
+                return string;                                        // RETURN
+            }
+        }
+        return 0;                                                     // RETURN
+    }
+#endif
+    return CHAR_TRAITS::find(string, length, character);
+}
+
+template <class CHAR_TRAITS>
+inline
+int CharTraitsUtil<CHAR_TRAITS>::compare(const CharType *lhs,
+                                         const CharType *rhs,
+                                         SizeType        length)
+{
+    return CHAR_TRAITS::compare(lhs, rhs, length);
+}
+
+template <class CHAR_TRAITS>
+inline
+typename CharTraitsUtil<CHAR_TRAITS>::CharType *
+CharTraitsUtil<CHAR_TRAITS>::assign(CharType        *string,
+                                    SizeType         length,
+                                    const CharType&  character)
+{
+    return CHAR_TRAITS::assign(string, length, character);
+}
+
+                         // --------------------------
+                         // struct CharTraitsUtil_Wide
+                         // --------------------------
+
+// CLASS METHODS
+template <class CHAR_TRAITS>
+inline
+typename CharTraitsUtil_Wide<CHAR_TRAITS>::SizeType
+CharTraitsUtil_Wide<CHAR_TRAITS>::length(const CharType *string)
+{
+    return Imp::length(string);
+}
+
+template <class CHAR_TRAITS>
+inline
+const typename CharTraitsUtil_Wide<CHAR_TRAITS>::CharType *
+CharTraitsUtil_Wide<CHAR_TRAITS>::find(const CharType  *string,
+                                       SizeType         length,
+                                       const CharType&  character)
+{
+    return Imp::find(string, length, character);
+}
+
+template <class CHAR_TRAITS>
+inline
+int CharTraitsUtil_Wide<CHAR_TRAITS>::compare(const CharType *lhs,
+                                              const CharType *rhs,
+                                              SizeType        length)
+{
+    const SizeType index = Imp::mismatch(lhs, rhs, length);
+    if (index == length) {
+        return 0;                                                     // RETURN
+    }
+    return CHAR_TRAITS::lt(lhs[index], rhs[index]) ? -1 : 1;
+}
+
+template <class CHAR_TRAITS>
+inline
+typename CharTraitsUtil_Wide<CHAR_TRAITS>::CharType *
+CharTraitsUtil_Wide<CHAR_TRAITS>::assign(CharType        *string,
+                                         SizeType         length,
+                                         const CharType&  character)
+{
+    Imp::assign(string, length, character);
+    return string;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
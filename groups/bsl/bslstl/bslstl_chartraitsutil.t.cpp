@@ -0,0 +1,873 @@
+// bslstl_chartraitsutil.t.cpp                                        -*-C++-*-
+
+#include <bslstl_chartraitsutil.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+
+#include <cstring>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::CharTraitsUtil' is a utility 'struct' template whose functions
+// have the contracts of the functions of the same name in the traits type.
+// The primary template forwards to the traits type, and the specializations
+// for wide characters are implemented by 'CharTraitsUtil_Wide' using the
+// kernels of 'CharTraitsUtil_Imp', which select an implementation according to
+// 'CharTraitsUtil_InstructionSet'.  Since the specializations that are
+// enabled depend on the platform, 'CharTraitsUtil_Wide' is tested directly,
+// for every instruction set supported, by comparing its results with those of
+// the native traits type, for every length up to a few blocks, every
+// alignment of the arguments within a block, and every position of the
+// character or difference sought (and for characters whose values are
+// negative when 'wchar_t' is signed).  The kernels must also not access
+// characters beyond the arrays that they are given (except that 'length' may
+// read the remainder of an aligned block), which is checked by placing
+// sentinels after the arrays.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] SizeType length(const CharType *string);
+// [ 3] const CharType *find(string, length, character);
+// [ 4] int compare(lhs, rhs, length);
+// [ 5] CharType *assign(string, length, character);
+// [ 2] CharTraitsUtil_InstructionSet::select(Enum);
+// [ 2] CharTraitsUtil_InstructionSet::selected();
+// [ 2] CharTraitsUtil_InstructionSet::supported();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: WIDE-CHARACTER PRIMITIVES
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::CharTraitsUtil_InstructionSet InstructionSet;
+
+typedef native_std::char_traits<wchar_t>                   WTraits;
+typedef bslstl::CharTraitsUtil<WTraits>                    WObj;
+typedef bslstl::CharTraitsUtil_Wide<WTraits>               WWide;
+
+const int MAX_LENGTH = 200;  // maximum length of an array under test
+const int MAX_OFFSET = 16;   // number of alignments tested within a block
+
+namespace {
+
+                        // ==========================
+                        // reference implementations
+                        // ==========================
+
+template <class CHAR_TYPE>
+const CHAR_TYPE *naiveFind(const CHAR_TYPE *string,
+                           size_t           length,
+                           CHAR_TYPE        character)
+    // Return the address of the first character in the specified 'string' of
+    // the specified 'length' equal to the specified 'character', or 0 if
+    // there is none.
+{
+    for (size_t i = 0; i < length; ++i) {
+        if (string[i] == character) {
+            return string + i;                                        // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE>
+int sign(CHAR_TYPE lhs, CHAR_TYPE rhs)
+    // Return -1, 0, or 1 according to whether the specified 'lhs' is less
+    // than, equal to, or greater than the specified 'rhs'.
+{
+    return lhs < rhs ? -1 : rhs < lhs ? 1 : 0;
+}
+
+int sign(int value)
+    // Return -1, 0, or 1 according to whether the specified 'value' is
+    // negative, zero, or positive.
+{
+    return value < 0 ? -1 : 0 < value ? 1 : 0;
+}
+
+                        // ===========================
+                        // struct InstructionSetGuard
+                        // ===========================
+
+struct InstructionSetGuard {
+    // This 'struct' restores, on destruction, the instruction set that was
+    // selected on construction.
+
+    // DATA
+    InstructionSet::Enum d_saved;  // instruction set to restore
+
+    // CREATORS
+    InstructionSetGuard()
+    : d_saved(InstructionSet::selected())
+    {
+    }
+
+    ~InstructionSetGuard()
+    {
+        InstructionSet::select(d_saved);
+    }
+};
+
+const char *name(int instructionSet)
+    // Return the name of the specified 'instructionSet'.
+{
+    switch (instructionSet) {
+      case InstructionSet::e_SCALAR: return "scalar";                 // RETURN
+      case InstructionSet::e_SSE2:   return "SSE2";                   // RETURN
+      case InstructionSet::e_AVX2:   return "AVX2";                   // RETURN
+    }
+    return "(* UNKNOWN *)";
+}
+
+                        // ======================
+                        // verification functions
+                        // ======================
+
+template <class CHAR_TYPE>
+CHAR_TYPE character(int index)
+    // Return a character, distinct for each of the specified 'index' values
+    // in the range '[1, 256)', whose value is not a (7-bit) ASCII character,
+    // and which is negative for odd 'index' values if 'CHAR_TYPE' is signed.
+    // The result is 0 if 'index' is 0.
+{
+    if (0 == index) {
+        return 0;                                                     // RETURN
+    }
+    const CHAR_TYPE value = static_cast<CHAR_TYPE>(0x80 + index);
+    return index & 1 ? static_cast<CHAR_TYPE>(~value) : value;
+}
+
+template <class CHAR_TRAITS>
+void testLength(int instructionSet)
+    // Verify 'CharTraitsUtil_Wide<CHAR_TRAITS>::length' with the specified
+    // 'instructionSet' selected.
+{
+    typedef typename CHAR_TRAITS::char_type              CharType;
+    typedef bslstl::CharTraitsUtil_Wide<CHAR_TRAITS>     Util;
+
+    CharType buffer[MAX_OFFSET + MAX_LENGTH + 64];
+    for (size_t i = 0; i < sizeof buffer / sizeof *buffer; ++i) {
+        buffer[i] = character<CharType>(1 + i % 255);
+    }
+
+    // Place the array at every offset from a 64-byte boundary.
+
+    CharType *base = buffer;
+    while (reinterpret_cast<size_t>(base) % 64) {
+        ++base;
+    }
+
+    for (int offset = 0; offset < MAX_OFFSET; ++offset) {
+        CharType *string = base + offset;
+        for (int length = 0; length < MAX_LENGTH; ++length) {
+            string[length] = 0;
+            ASSERTV(instructionSet, offset, length,
+                    static_cast<size_t>(length) == Util::length(string));
+            ASSERTV(instructionSet, offset, length,
+                    CHAR_TRAITS::length(string) == Util::length(string));
+            string[length] = character<CharType>(1 + length % 255);
+        }
+    }
+}
+
+template <class CHAR_TRAITS>
+void testFind(int instructionSet)
+    // Verify 'CharTraitsUtil_Wide<CHAR_TRAITS>::find' with the specified
+    // 'instructionSet' selected.
+{
+    typedef typename CHAR_TRAITS::char_type              CharType;
+    typedef bslstl::CharTraitsUtil_Wide<CHAR_TRAITS>     Util;
+
+    const CharType TARGET = character<CharType>(255);
+    const CharType OTHER  = character<CharType>(254);
+
+    CharType buffer[MAX_OFFSET + MAX_LENGTH + 1];
+
+    for (int offset = 0; offset < MAX_OFFSET; ++offset) {
+        CharType *string = buffer + offset;
+        for (int length = 0; length < MAX_LENGTH; ++length) {
+            for (int position = 0; position <= length; ++position) {
+                // 'position == length' places the target just past the end
+                // of the array, where it must not be found.
+
+                for (int i = 0; i < MAX_OFFSET + MAX_LENGTH + 1; ++i) {
+                    buffer[i] = OTHER;
+                }
+                string[position] = TARGET;
+
+                const CharType *EXP    = naiveFind(string, length, TARGET);
+                const CharType *result = Util::find(string, length, TARGET);
+
+                ASSERTV(instructionSet, offset, length, position,
+                        EXP == result);
+
+                if (position < length) {
+                    // A second occurrence does not affect the result.
+
+                    string[length - 1] = TARGET;
+                    ASSERTV(instructionSet, offset, length, position,
+                            string + position
+                                       == Util::find(string, length, TARGET));
+                }
+            }
+            ASSERTV(instructionSet, offset, length,
+                    0 == Util::find(string, length, CharType()));
+        }
+    }
+}
+
+template <class CHAR_TRAITS>
+void testCompare(int instructionSet)
+    // Verify 'CharTraitsUtil_Wide<CHAR_TRAITS>::compare' with the specified
+    // 'instructionSet' selected.
+{
+    typedef typename CHAR_TRAITS::char_type              CharType;
+    typedef bslstl::CharTraitsUtil_Wide<CHAR_TRAITS>     Util;
+
+    CharType lhsBuffer[MAX_OFFSET + MAX_LENGTH + 1];
+    CharType rhsBuffer[MAX_OFFSET + MAX_LENGTH + 1];
+
+    for (int offset = 0; offset < MAX_OFFSET; ++offset) {
+        // Misalign the arguments with respect to each other as well.
+
+        CharType *lhs = lhsBuffer + offset;
+        CharType *rhs = rhsBuffer + (offset * 3) % MAX_OFFSET;
+
+        for (int length = 0; length < MAX_LENGTH; ++length) {
+            for (int i = 0; i <= length; ++i) {
+                lhs[i] = rhs[i] = character<CharType>(1 + i % 255);
+            }
+
+            // A difference just past the end of the arrays is ignored.
+
+            rhs[length] = character<CharType>(0x7f);
+            ASSERTV(instructionSet, offset, length,
+                    0 == Util::compare(lhs, rhs, length));
+
+            for (int position = 0; position < length; ++position) {
+                const CharType SAVED = rhs[position];
+
+                // Differ in the sign bit, and in the low-order bits only.
+
+                const CharType VALUES[] = {
+                    static_cast<CharType>(~SAVED),
+                    static_cast<CharType>(SAVED ^ 1),
+                };
+                for (int vi = 0; vi < 2; ++vi) {
+                    rhs[position] = VALUES[vi];
+
+                    const int EXP = sign(CHAR_TRAITS::compare(lhs,
+                                                              rhs,
+                                                              length));
+                    ASSERTV(instructionSet, offset, length, position, vi,
+                            EXP == sign(lhs[position], rhs[position]));
+                    ASSERTV(instructionSet, offset, length, position, vi,
+                            EXP == sign(Util::compare(lhs, rhs, length)));
+                    ASSERTV(instructionSet, offset, length, position, vi,
+                            -EXP == sign(Util::compare(rhs, lhs, length)));
+                }
+                rhs[position] = SAVED;
+            }
+        }
+    }
+}
+
+template <class CHAR_TRAITS>
+void testAssign(int instructionSet)
+    // Verify 'CharTraitsUtil_Wide<CHAR_TRAITS>::assign' with the specified
+    // 'instructionSet' selected.
+{
+    typedef typename CHAR_TRAITS::char_type              CharType;
+    typedef bslstl::CharTraitsUtil_Wide<CHAR_TRAITS>     Util;
+
+    const CharType SENTINEL = character<CharType>(1);
+    const CharType VALUE    = character<CharType>(3);
+
+    CharType buffer[MAX_OFFSET + MAX_LENGTH + 1];
+
+    for (int offset = 0; offset < MAX_OFFSET; ++offset) {
+        CharType *string = buffer + offset;
+        for (int length = 0; length < MAX_LENGTH; ++length) {
+            for (int i = 0; i < MAX_OFFSET + MAX_LENGTH + 1; ++i) {
+                buffer[i] = SENTINEL;
+            }
+
+            ASSERTV(instructionSet, offset, length,
+                    string == Util::assign(string, length, VALUE));
+
+            for (int i = 0; i < MAX_OFFSET + MAX_LENGTH + 1; ++i) {
+                const bool INSIDE = offset <= i && i < offset + length;
+                ASSERTV(instructionSet, offset, length, i,
+                        (INSIDE ? VALUE : SENTINEL) == buffer[i]);
+            }
+        }
+    }
+}
+
+void testAll(void (*function)(int))
+    // Call the specified 'function' with each instruction set supported
+    // selected in turn.
+{
+    InstructionSetGuard guard;
+
+    for (int is = InstructionSet::e_SCALAR;
+         is <= InstructionSet::supported();
+         ++is) {
+        ASSERTV(is, is == InstructionSet::select(
+                                     static_cast<InstructionSet::Enum>(is)));
+        function(is);
+    }
+}
+
+                        // ===================
+                        // benchmark functions
+                        // ===================
+
+volatile size_t benchmarkSink;  // result of the most recent benchmark
+
+template <class CHAR_TYPE>
+struct ScalarLoops {
+    // This 'struct' provides a namespace for straightforward loops
+    // implementing the operations benchmarked, as a baseline.
+
+    static size_t length(const CHAR_TYPE *string)
+    {
+        const CHAR_TYPE *end = string;
+        while (*end) {
+            ++end;
+        }
+        return end - string;
+    }
+
+    static const CHAR_TYPE *find(const CHAR_TYPE *string,
+                                 size_t           length,
+                                 CHAR_TYPE        character)
+    {
+        return naiveFind(string, length, character);
+    }
+
+    static int compare(const CHAR_TYPE *lhs,
+                       const CHAR_TYPE *rhs,
+                       size_t           length)
+    {
+        for (size_t i = 0; i < length; ++i) {
+            if (lhs[i] != rhs[i]) {
+                return lhs[i] < rhs[i] ? -1 : 1;                      // RETURN
+            }
+        }
+        return 0;
+    }
+
+    static CHAR_TYPE *assign(CHAR_TYPE *string,
+                             size_t     length,
+                             CHAR_TYPE  character)
+    {
+        for (size_t i = 0; i < length; ++i) {
+            string[i] = character;
+        }
+        return string;
+    }
+};
+
+template <class UTIL, class CHAR_TYPE>
+double benchmark(int              operation,
+                 CHAR_TYPE       *lhs,
+                 const CHAR_TYPE *rhs,
+                 size_t           length,
+                 int              numIterations)
+    // Return the time taken to perform the specified 'operation' ('length',
+    // 'find', 'compare', or 'assign' for values 0 to 3) using 'UTIL' on the
+    // specified 'lhs' and 'rhs' arrays of the specified 'length' the
+    // specified 'numIterations' times.  The behavior is undefined unless
+    // 'lhs' and 'rhs' are equal and terminated by a null character, and do
+    // not contain the character 0x7f.
+{
+    size_t checksum = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numIterations; ++i) {
+        switch (operation) {
+          case 0: {
+            checksum += UTIL::length(lhs);
+          } break;
+          case 1: {
+            checksum += !UTIL::find(lhs, length, static_cast<CHAR_TYPE>(0x7f));
+          } break;
+          case 2: {
+            checksum += UTIL::compare(lhs, rhs, length);
+          } break;
+          default: {
+            checksum += !!UTIL::assign(lhs, length, lhs[i % length]);
+          } break;
+        }
+    }
+    timer.stop();
+
+    benchmarkSink = checksum;  // prevent the loop from being optimized away
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Comparing Wide Strings
+///- - - - - - - - - - - - - - - - -
+// Suppose that we need to compare two wide character arrays, which are not
+// necessarily null-terminated, in the same way as 'bsl::wstring' does.
+// First, we define the arrays:
+//..
+    const wchar_t lhs[] = L"wide characters, first";
+    const wchar_t rhs[] = L"wide characters, second";
+//..
+// Then, we find their lengths, and compare them using the traits of
+// 'bsl::wstring':
+//..
+    typedef bslstl::CharTraitsUtil<std::char_traits<wchar_t> > Util;
+
+    const std::size_t lhsLength = Util::length(lhs);
+    const std::size_t rhsLength = Util::length(rhs);
+    ASSERT(22 == lhsLength);
+    ASSERT(23 == rhsLength);
+
+    ASSERT(0 > Util::compare(lhs, rhs, lhsLength));
+//..
+// Next, we locate the comma in 'lhs':
+//..
+    ASSERT(lhs + 15 == Util::find(lhs, lhsLength, L','));
+//..
+// Finally, we overwrite the characters following the comma with spaces:
+//..
+    wchar_t buffer[sizeof lhs / sizeof *lhs];
+    std::memcpy(buffer, lhs, sizeof lhs);
+
+    Util::assign(buffer + 16, lhsLength - 16, L' ');
+    ASSERT(0 == Util::compare(buffer, L"wide characters,      ", lhsLength));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'assign'
+        //
+        // Concerns:
+        //: 1 'assign' assigns the character to every element of the array, for
+        //:   every length, alignment, and instruction set.
+        //:
+        //: 2 'assign' does not modify any character outside the array.
+        //:
+        //: 3 'assign' returns the address of the array.
+        //
+        // Plan:
+        //: 1 For each instruction set supported, for each offset within a
+        //:   block and each length up to 'MAX_LENGTH', fill a buffer with a
+        //:   sentinel, 'assign' a value to the array at the offset, and verify
+        //:   the result and the contents of the whole buffer.  (C-1..3)
+        //
+        // Testing:
+        //   CharType *assign(string, length, character);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'assign'"
+                            "\n========\n");
+
+        testAll(&testAssign<WTraits>);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+        testAll(&testAssign<native_std::char_traits<char16_t> >);
+        testAll(&testAssign<native_std::char_traits<char32_t> >);
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'compare'
+        //
+        // Concerns:
+        //: 1 'compare' returns a value having the same sign as the value
+        //:   returned by the traits type, for every length, alignment (of
+        //:   each argument), position of the first difference, and
+        //:   instruction set.
+        //:
+        //: 2 The first difference is ordered by 'lt', including when
+        //:   characters differ in their sign bit.
+        //:
+        //: 3 'compare' does not examine characters beyond the arrays.
+        //
+        // Plan:
+        //: 1 For each instruction set supported, for each offset within a
+        //:   block and each length up to 'MAX_LENGTH', compare equal arrays
+        //:   followed by different characters.  (C-3)
+        //:
+        //: 2 Change each character of one array in turn, both by inverting it
+        //:   (changing its sign) and by changing its low-order bit, and
+        //:   verify the result of 'compare' in each direction against the
+        //:   traits type and against the order of the characters.  (C-1..2)
+        //
+        // Testing:
+        //   int compare(lhs, rhs, length);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'compare'"
+                            "\n=========\n");
+
+        testAll(&testCompare<WTraits>);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+        testAll(&testCompare<native_std::char_traits<char16_t> >);
+        testAll(&testCompare<native_std::char_traits<char32_t> >);
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'find'
+        //
+        // Concerns:
+        //: 1 'find' returns the address of the first occurrence of the
+        //:   character, or 0 if there is none, for every length, alignment,
+        //:   position of the character, and instruction set.
+        //:
+        //: 2 'find' does not examine characters beyond the array.
+        //
+        // Plan:
+        //: 1 For each instruction set supported, for each offset within a
+        //:   block, each length up to 'MAX_LENGTH', and each position in the
+        //:   array and just past its end, place the character sought at the
+        //:   position and verify that the result of 'find' matches a
+        //:   reference implementation, also with a second occurrence of the
+        //:   character at the end of the array.  (C-1..2)
+        //
+        // Testing:
+        //   const CharType *find(string, length, character);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'find'"
+                            "\n======\n");
+
+        testAll(&testFind<WTraits>);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+        testAll(&testFind<native_std::char_traits<char16_t> >);
+        testAll(&testFind<native_std::char_traits<char32_t> >);
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'length' AND INSTRUCTION SET SELECTION
+        //
+        // Concerns:
+        //: 1 'length' returns the number of characters preceding the first
+        //:   null character, for every length, alignment, and instruction
+        //:   set.
+        //:
+        //: 2 'select' selects the instruction set requested if it is
+        //:   supported, and the most capable supported one otherwise, and
+        //:   'selected' reports the selection.
+        //:
+        //: 3 Initially, the most capable supported instruction set is
+        //:   selected.
+        //
+        // Plan:
+        //: 1 Verify that 'selected' initially returns 'supported', and select
+        //:   each instruction set in turn, verifying the result of 'select'
+        //:   and 'selected'.  (C-2..3)
+        //:
+        //: 2 For each instruction set supported, for each offset from a
+        //:   64-byte boundary and each length up to 'MAX_LENGTH', terminate
+        //:   an array of non-null characters and verify the result of
+        //:   'length' against the length and against the traits type.  (C-1)
+        //
+        // Testing:
+        //   SizeType length(const CharType *string);
+        //   CharTraitsUtil_InstructionSet::select(Enum);
+        //   CharTraitsUtil_InstructionSet::selected();
+        //   CharTraitsUtil_InstructionSet::supported();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'length' AND INSTRUCTION SET SELECTION"
+                            "\n======================================\n");
+
+        const InstructionSet::Enum SUPPORTED = InstructionSet::supported();
+
+        if (verbose) { T_ P(name(SUPPORTED)) }
+
+        ASSERTV(SUPPORTED, SUPPORTED == InstructionSet::selected());
+        {
+            InstructionSetGuard guard;
+
+            for (int is = InstructionSet::e_SCALAR;
+                 is <= InstructionSet::e_AVX2;
+                 ++is) {
+                const int EXP = is <= SUPPORTED ? is : SUPPORTED;
+
+                ASSERTV(is, EXP == InstructionSet::select(
+                                     static_cast<InstructionSet::Enum>(is)));
+                ASSERTV(is, EXP == InstructionSet::selected());
+            }
+        }
+        ASSERTV(SUPPORTED, SUPPORTED == InstructionSet::selected());
+
+        testAll(&testLength<WTraits>);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_UNICODE_CHAR_TYPES)
+        testAll(&testLength<native_std::char_traits<char16_t> >);
+        testAll(&testLength<native_std::char_traits<char32_t> >);
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Apply each function of 'CharTraitsUtil' and of
+        //:   'CharTraitsUtil_Wide' for 'wchar_t' to a short string.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const wchar_t S[] = L"the quick brown fox jumps over the lazy dog";
+        const size_t  N   = sizeof S / sizeof *S - 1;
+
+        ASSERT(N == WObj::length(S));
+        ASSERT(N == WWide::length(S));
+
+        ASSERT(S + 16 == WObj::find(S, N, L'f'));
+        ASSERT(S + 16 == WWide::find(S, N, L'f'));
+        ASSERT(0      == WObj::find(S, N, L'!'));
+        ASSERT(0      == WWide::find(S, N, L'!'));
+
+        const wchar_t T[] = L"the quick brown fox jumps over the lazy cat";
+
+        ASSERT(0 == WObj::compare(S, T, N - 3));
+        ASSERT(0 == WWide::compare(S, T, N - 3));
+        ASSERT(0 <  WObj::compare(S, T, N));
+        ASSERT(0 <  WWide::compare(S, T, N));
+        ASSERT(0 >  WWide::compare(T, S, N));
+
+        wchar_t buffer[64];
+        ASSERT(buffer == WObj::assign(buffer, 64, L'x'));
+        ASSERT(buffer == WWide::assign(buffer, 63, L'y'));
+        ASSERT(L'y' == buffer[62]);
+        ASSERT(L'x' == buffer[63]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: WIDE-CHARACTER PRIMITIVES
+        //
+        // Concerns:
+        //: 1 The kernels are faster than scalar loops, and comparable to the
+        //:   native traits type, for arrays of typical lengths.
+        //
+        // Plan:
+        //: 1 For a range of lengths, time 'length', 'find' (of an absent
+        //:   character), 'compare' (of equal arrays), and 'assign' for
+        //:   'wchar_t' using the native traits type, scalar loops, and
+        //:   'CharTraitsUtil_Wide' with each instruction set supported, and
+        //:   report the throughput in characters per nanosecond.  The
+        //:   optional second argument specifies the total number of
+        //:   characters processed per measurement (in millions).
+        //
+        // Testing:
+        //   PERFORMANCE: WIDE-CHARACTER PRIMITIVES
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: WIDE-CHARACTER PRIMITIVES"
+                            "\n======================================\n");
+
+        const double TOTAL = (argc > 2 && atoi(argv[2]) > 0 ? atoi(argv[2])
+                                                             : 200) * 1e6;
+
+        const size_t LENGTHS[] = { 8, 32, 128, 1024, 16384 };
+        const int    NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const char *OPERATIONS[] = { "length", "find", "compare", "assign" };
+
+        const size_t MAX = LENGTHS[NUM_LENGTHS - 1];
+
+        wchar_t *lhs = static_cast<wchar_t *>(malloc((MAX + 1)
+                                                          * sizeof(wchar_t)));
+        wchar_t *rhs = static_cast<wchar_t *>(malloc((MAX + 1)
+                                                          * sizeof(wchar_t)));
+
+        InstructionSetGuard guard;
+
+        printf("%-8s %6s %8s %8s", "op", "length", "native", "scalar");
+        for (int is = 0; is <= InstructionSet::supported(); ++is) {
+            printf(" %8s", name(is));
+        }
+        printf("   (characters/ns)\n");
+
+        for (int op = 0; op < 4; ++op) {
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const size_t LENGTH     = LENGTHS[li];
+                const int    ITERATIONS = static_cast<int>(TOTAL / LENGTH);
+
+                for (size_t i = 0; i < LENGTH; ++i) {
+                    lhs[i] = rhs[i] = static_cast<wchar_t>(L'a' + i % 26);
+                }
+                lhs[LENGTH] = rhs[LENGTH] = 0;
+
+                const double RATE = LENGTH * ITERATIONS / 1e9;
+
+                printf("%-8s %6d %8.2f",
+                       OPERATIONS[op],
+                       static_cast<int>(LENGTH),
+                       RATE / benchmark<WTraits>(op,
+                                                 lhs,
+                                                 rhs,
+                                                 LENGTH,
+                                                 ITERATIONS));
+                printf(" %8.2f",
+                       RATE / benchmark<ScalarLoops<wchar_t> >(op,
+                                                               lhs,
+                                                               rhs,
+                                                               LENGTH,
+                                                               ITERATIONS));
+                for (int is = 0; is <= InstructionSet::supported(); ++is) {
+                    InstructionSet::select(
+                                       static_cast<InstructionSet::Enum>(is));
+                    printf(" %8.2f",
+                           RATE / benchmark<WWide>(op,
+                                                   lhs,
+                                                   rhs,
+                                                   LENGTH,
+                                                   ITERATIONS));
+                }
+                printf("\n");
+            }
+        }
+
+        free(rhs);
+        free(lhs);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
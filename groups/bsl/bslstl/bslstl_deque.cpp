@@ -71,6 +71,10 @@ BSLS_IDENT("$Id$ $CSID$")
 //     and/or end.  The closed range,
 //     '[d_start.d_blockPtr_p, d_finish.d_blockPtr_p]', is the range of
 //     valid pointers within the 'd_blocks' array.
+//   - 'd_spareBlocks' is a singly-linked list of 'd_numSpareBlocks' (at most
+//     'MAX_SPARE_BLOCKS') blocks holding no elements, which are reused before
+//     any new block is allocated.  The address of the next block of the list
+//     is stored at the start of each block.
 //
 // For deques constructed with the 'RAW_INIT' argument ("raw" deques), the
 // above invariants do not apply.  The following invariants do apply:
@@ -79,7 +83,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //   - A raw deque has in constructed with 'd_blocks == 0' and
 //     'd_blocksLength == 0'.
 //   - 'd_blocks' and 'd_blocksLength' may be set to valid values, but no
-//     blocks are allocated.
+//     blocks are allocated, other than spare blocks.
 //   - Once one or more blocks are allocated and 'd_start' and 'd_finish'
 //     set to point into those blocks, the deque is no longer raw and must
 //     adhere to the normal deque invariants, above.
@@ -111,10 +115,12 @@ struct Deque_Imp {
     };
 
     // DATA
-    void          *d_blocks;        // array of pointer to blocks
-    std::size_t    d_blocksLength;  // length of d_blocks array
-    IteratorImp    d_start;         // iterator to first element
-    IteratorImp    d_finish;        // iterator to one past last element
+    void          *d_blocks;          // array of pointer to blocks
+    std::size_t    d_blocksLength;    // length of d_blocks array
+    IteratorImp    d_start;           // iterator to first element
+    IteratorImp    d_finish;          // iterator to one past last element
+    void          *d_spareBlocks;     // list of blocks retained for reuse
+    int            d_numSpareBlocks;  // length of d_spareBlocks list
 };
 
 // MANIPULATORS
@@ -126,12 +132,16 @@ void Deque_Util::move(void *dst, void *src)
     Deque_Imp& dstDeque     = *static_cast<Deque_Imp *>(dst);
     Deque_Imp& srcDeque     = *static_cast<Deque_Imp *>(src);
 
-    dstDeque.d_blocks       = srcDeque.d_blocks;
-    dstDeque.d_blocksLength = srcDeque.d_blocksLength;
-    dstDeque.d_start        = srcDeque.d_start;
-    dstDeque.d_finish       = srcDeque.d_finish;
+    dstDeque.d_blocks         = srcDeque.d_blocks;
+    dstDeque.d_blocksLength   = srcDeque.d_blocksLength;
+    dstDeque.d_start          = srcDeque.d_start;
+    dstDeque.d_finish         = srcDeque.d_finish;
+    dstDeque.d_spareBlocks    = srcDeque.d_spareBlocks;
+    dstDeque.d_numSpareBlocks = srcDeque.d_numSpareBlocks;
 
-    srcDeque.d_blocks       = 0;  // put back in a raw state
+    srcDeque.d_blocks         = 0;  // put back in a raw state
+    srcDeque.d_spareBlocks    = 0;
+    srcDeque.d_numSpareBlocks = 0;
 }
 
 void Deque_Util::swap(void *a, void *b)
@@ -143,20 +153,26 @@ void Deque_Util::swap(void *a, void *b)
     Deque_Imp& bDeque     = *static_cast<Deque_Imp *>(b);
 
     Deque_Imp temp;
-    temp.d_blocks         = bDeque.d_blocks;
-    temp.d_blocksLength   = bDeque.d_blocksLength;
-    temp.d_start          = bDeque.d_start;
-    temp.d_finish         = bDeque.d_finish;
-
-    bDeque.d_blocks       = aDeque.d_blocks;
-    bDeque.d_blocksLength = aDeque.d_blocksLength;
-    bDeque.d_start        = aDeque.d_start;
-    bDeque.d_finish       = aDeque.d_finish;
-
-    aDeque.d_blocks       = temp.d_blocks;
-    aDeque.d_blocksLength = temp.d_blocksLength;
-    aDeque.d_start        = temp.d_start;
-    aDeque.d_finish       = temp.d_finish;
+    temp.d_blocks           = bDeque.d_blocks;
+    temp.d_blocksLength     = bDeque.d_blocksLength;
+    temp.d_start            = bDeque.d_start;
+    temp.d_finish           = bDeque.d_finish;
+    temp.d_spareBlocks      = bDeque.d_spareBlocks;
+    temp.d_numSpareBlocks   = bDeque.d_numSpareBlocks;
+
+    bDeque.d_blocks         = aDeque.d_blocks;
+    bDeque.d_blocksLength   = aDeque.d_blocksLength;
+    bDeque.d_start          = aDeque.d_start;
+    bDeque.d_finish         = aDeque.d_finish;
+    bDeque.d_spareBlocks    = aDeque.d_spareBlocks;
+    bDeque.d_numSpareBlocks = aDeque.d_numSpareBlocks;
+
+    aDeque.d_blocks         = temp.d_blocks;
+    aDeque.d_blocksLength   = temp.d_blocksLength;
+    aDeque.d_start          = temp.d_start;
+    aDeque.d_finish         = temp.d_finish;
+    aDeque.d_spareBlocks    = temp.d_spareBlocks;
+    aDeque.d_numSpareBlocks = temp.d_numSpareBlocks;
 }
 
 }  // close namespace bsl
@@ -357,10 +357,13 @@ class Deque_Base {
 
   protected:
     // DATA
-    BlockPtr    *d_blocks;       // array of pointer to blocks (owned)
-    std::size_t  d_blocksLength; // length of d_blocks array
-    IteratorImp  d_start;        // iterator to first element
-    IteratorImp  d_finish;       // iterator to one past last element
+    BlockPtr    *d_blocks;          // array of pointer to blocks (owned)
+    std::size_t  d_blocksLength;    // length of d_blocks array
+    IteratorImp  d_start;           // iterator to first element
+    IteratorImp  d_finish;          // iterator to one past last element
+    Block       *d_spareBlocks;     // list of blocks retained for reuse
+                                    // (owned)
+    int          d_numSpareBlocks;  // length of d_spareBlocks list
 
   public:
     // MANIPULATORS
@@ -505,7 +508,8 @@ class deque : public  Deque_Base<VALUE_TYPE>
 
     // PRIVATE TYPES
     enum {
-        BLOCK_LENGTH = Deque_BlockLengthCalcUtil<VALUE_TYPE>::BLOCK_LENGTH
+        BLOCK_LENGTH     = Deque_BlockLengthCalcUtil<VALUE_TYPE>::BLOCK_LENGTH,
+        MAX_SPARE_BLOCKS = 2  // maximum number of blocks retained for reuse
     };
 
     typedef Deque_Base<VALUE_TYPE>                             Base;
@@ -579,6 +583,23 @@ class deque : public  Deque_Base<VALUE_TYPE>
         // provide an exception-safe repository for intermediate calculations.
 
     // PRIVATE MANIPULATORS
+    Block *allocateBlock();
+        // Return the address of a block for use by this deque, taken from the
+        // spare blocks retained by this deque if there are any, and allocated
+        // otherwise.
+
+    void deallocateBlock(Block *block);
+        // Return the specified 'block', which is no longer used by this deque,
+        // to the spare blocks retained by this deque for reuse if there are
+        // fewer than 'MAX_SPARE_BLOCKS' of them, and deallocate it otherwise.
+        // Note that, as blocks are released at the front of a deque used as a
+        // FIFO queue at the same rate as they are needed at its back,
+        // retaining them avoids an allocation for each block of elements that
+        // passes through the queue.
+
+    void releaseSpareBlocks();
+        // Deallocate the spare blocks retained by this deque.
+
     template <class INPUT_ITER>
     size_type privateAppend(INPUT_ITER                     first,
                             INPUT_ITER                     last,
@@ -1370,10 +1391,55 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(RawInit, const ALLOCATOR& allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
 {
-    this->d_blocks = 0;
+    this->d_blocks         = 0;
+    this->d_spareBlocks    = 0;
+    this->d_numSpareBlocks = 0;
 }
 
 // PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename deque<VALUE_TYPE,ALLOCATOR>::Block *
+deque<VALUE_TYPE,ALLOCATOR>::allocateBlock()
+{
+    if (this->d_spareBlocks) {
+        // The address of the next spare block is stored at the start of each
+        // spare block.
+
+        Block *block = this->d_spareBlocks;
+        this->d_spareBlocks = *reinterpret_cast<Block **>(block);
+        --this->d_numSpareBlocks;
+        return block;                                                 // RETURN
+    }
+
+    return this->allocateN((Block *) 0, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void deque<VALUE_TYPE,ALLOCATOR>::deallocateBlock(Block *block)
+{
+    if (this->d_numSpareBlocks < MAX_SPARE_BLOCKS) {
+        *reinterpret_cast<Block **>(block) = this->d_spareBlocks;
+        this->d_spareBlocks = block;
+        ++this->d_numSpareBlocks;
+        return;                                                       // RETURN
+    }
+
+    this->deallocateN(block, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void deque<VALUE_TYPE,ALLOCATOR>::releaseSpareBlocks()
+{
+    while (this->d_spareBlocks) {
+        Block *block = this->d_spareBlocks;
+        this->d_spareBlocks = *reinterpret_cast<Block **>(block);
+        this->deallocateN(block, 1);
+    }
+    this->d_numSpareBlocks = 0;
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITER>
 typename deque<VALUE_TYPE,ALLOCATOR>::size_type
@@ -1499,7 +1565,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateInit(size_type numElements)
     // little room at the front and back of the array for growth.
 
     BlockPtr *firstBlockPtr = &this->d_blocks[Imp::BLOCK_ARRAY_PADDING];
-    *firstBlockPtr = this->allocateN((Block*) 0, 1);
+    *firstBlockPtr = allocateBlock();
 
     // Calculate the offset into the first block such that 'n' elements will
     // leave equal space at the front of the first block and at the end of the
@@ -1674,7 +1740,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateSplit(
 
     // Good time to allocate block for exception safety.
 
-    Block *newBlock = this->allocateN((Block*) 0, 1);
+    Block *newBlock = allocateBlock();
 
     // The following chunk of code will never throw an exception.  Move unsplit
     // blocks from 'this' to 'other', then adjust the iterators.
@@ -2075,8 +2141,9 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE,ALLOCATOR>::~deque()
 {
     if (0 == this->d_blocks) {
-        // Nothing to do when destroying raw deques.
+        // Raw deques own no blocks other than spare ones.
 
+        releaseSpareBlocks();
         return;                                                       // RETURN
     }
 
@@ -2090,8 +2157,9 @@ deque<VALUE_TYPE,ALLOCATOR>::~deque()
         this->deallocateN(*this->d_start.blockPtr(), 1);
     }
 
-    // Deallocate the array of block pointers.
+    // Deallocate the spare blocks and the array of block pointers.
 
+    releaseSpareBlocks();
     this->deallocateN(this->d_blocks, this->d_blocksLength);
 }
 
@@ -2483,7 +2551,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_front()
                                                      this->d_start.valuePtr());
 
     if (1 == this->d_start.remainingInBlock()) {
-        this->deallocateN(*this->d_start.blockPtr(), 1);
+        deallocateBlock(*this->d_start.blockPtr());
         this->d_start.nextBlock();
         return;                                                       // RETURN
     }
@@ -2500,7 +2568,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_back()
         --this->d_finish;
         BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(
                                                     this->d_finish.valuePtr());
-        this->deallocateN(this->d_finish.blockPtr()[1], 1);
+        deallocateBlock(this->d_finish.blockPtr()[1]);
         return;                                                       // RETURN
     }
 
@@ -2535,11 +2603,11 @@ deque<VALUE_TYPE,ALLOCATOR>::erase(const_iterator first,
 
     for ( ; oldStart.imp().blockPtr() != this->d_start.blockPtr();
                                                   oldStart.imp().nextBlock()) {
-        this->deallocateN(oldStart.imp().blockPtr()[0], 1);
+        deallocateBlock(oldStart.imp().blockPtr()[0]);
     }
     for ( ; oldFinish.imp().blockPtr() != this->d_finish.blockPtr();
                                              oldFinish.imp().previousBlock()) {
-        this->deallocateN(oldFinish.imp().blockPtr()[0], 1);
+        deallocateBlock(oldFinish.imp().blockPtr()[0]);
     }
     return result;
 }
@@ -2595,7 +2663,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::clear()
     BlockPtr *startBlock = this->d_start.blockPtr();
     BlockPtr *finishBlock = this->d_finish.blockPtr();
     for ( ; startBlock != finishBlock; ++startBlock) {
-        this->deallocateN(*startBlock, 1);
+        deallocateBlock(*startBlock);
     }
 
     // Reposition in the middle.
@@ -2739,7 +2807,7 @@ Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::~Deque_BlockCreator()
         for (; delFirst != delLast; ++delFirst) {
             // Deallocate the block that '*d_start' points to.
 
-            d_deque_p->deallocateN(*delFirst, 1);
+            d_deque_p->deallocateBlock(*delFirst);
         }
     }
 }
@@ -2750,7 +2818,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtFront(size_type n)
 {
     d_boundary = reserveBlockSlots(n, true);
     for ( ; n > 0; --n) {
-        d_boundary[-1] = d_deque_p->allocateN((Block*) 0, 1);
+        d_boundary[-1] = d_deque_p->allocateBlock();
         --d_boundary;
     }
 }
@@ -2760,7 +2828,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtBack(size_type n)
 {
     d_boundary = reserveBlockSlots(n, false);
     for ( ; n > 0; --n) {
-        *d_boundary = d_deque_p->allocateN((Block*) 0, 1);
+        *d_boundary = d_deque_p->allocateBlock();
         ++d_boundary;
     }
 }
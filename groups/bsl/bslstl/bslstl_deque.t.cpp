@@ -147,6 +147,7 @@ using namespace bsl;
 // [11] ALLOCATOR-RELATED CONCERNS
 // [18] USAGE EXAMPLE
 // [22] CONCERN: 'std::length_error' is used properly
+// [25] CONCERN: Blocks released by 'pop_front' are reused by 'push_back'.
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(deque<T,A> *object, const char *spec, int vF = 1);
@@ -1406,6 +1407,9 @@ struct TestDriver {
     static void testCaseM1();
         // Performance test.
 
+    static void testCase23();
+        // Test reuse of blocks.
+
     static void testCase22();
         // Test proper use of 'std::length_error'.
 
@@ -2277,6 +2281,148 @@ void TestDriver<TYPE,ALLOC>::testCaseM1()
     }
 }
 
+template <class TYPE, class ALLOC>
+void TestDriver<TYPE,ALLOC>::testCase23()
+{
+    // --------------------------------------------------------------------
+    // TESTING BLOCK REUSE
+    //
+    // Concerns:
+    //   1) That a deque used as a FIFO queue, through 'push_back' and
+    //      'pop_front' (or 'push_front' and 'pop_back'), allocates no
+    //      memory once it has released a block at one end for each block
+    //      needed at the other, whatever the length of the queue.
+    //   2) That the values passing through the queue are not affected.
+    //   3) That at most two of the blocks released by 'pop_front',
+    //      'pop_back', 'erase' and 'clear' are retained, and that all the
+    //      memory is returned to the allocator when the deque is destroyed.
+    //
+    // Plan:
+    //   For concerns 1 and 2, for each of a set of queue lengths, create a
+    //   deque of that length, then push values at one end and pop them at
+    //   the other through two blocks, and verify that doing so through
+    //   'NUM_BLOCKS' more blocks allocates no memory and pops the values in
+    //   the order they were pushed.  Repeat in the other direction.
+    //
+    //   For concern 3, create a deque spanning 'NUM_BLOCKS' blocks, and
+    //   empty it with each of 'pop_front', 'pop_back', 'erase' and 'clear'.
+    //   Verify that only the array of block pointers, one block, and two
+    //   spare blocks remain in use, and that no memory is in use after the
+    //   deque is destroyed.
+    //
+    // Testing:
+    //   CONCERN: Blocks released by 'pop_front' are reused by 'push_back'.
+    // --------------------------------------------------------------------
+
+    const TYPE *values     = 0;
+    const int   NUM_VALUES = getValues(&values);
+
+    const int BLOCK_LENGTH = Deque_BlockLengthCalcUtil<TYPE>::BLOCK_LENGTH;
+    const int NUM_BLOCKS   = 8;
+
+    const int LENGTHS[] = {
+        0, 1, 2, BLOCK_LENGTH - 1, BLOCK_LENGTH, BLOCK_LENGTH + 1,
+        3 * BLOCK_LENGTH + 5
+    };
+    const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    if (verbose) printf("\tUsing a deque as a FIFO queue.\n");
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const int LENGTH = LENGTHS[ti];
+
+        for (int atBack = 0; atBack < 2; ++atBack) {
+            bslma::TestAllocator testAllocator(veryVeryVerbose);
+
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            int head = 0;  // index of the next value to be popped
+            int tail = 0;  // index of the next value to be pushed
+
+            for (; tail < LENGTH; ++tail) {
+                if (atBack) {
+                    mX.push_back(values[tail % NUM_VALUES]);
+                }
+                else {
+                    mX.push_front(values[tail % NUM_VALUES]);
+                }
+            }
+
+            for (int pass = 0; pass < 2; ++pass) {
+                const Int64 NUM_TOTAL = testAllocator.numBlocksTotal();
+
+                for (int i = 0; i < NUM_BLOCKS * BLOCK_LENGTH; ++i) {
+                    if (atBack) {
+                        mX.push_back(values[tail++ % NUM_VALUES]);
+                        LOOP3_ASSERT(LENGTH, atBack, i,
+                                     values[head++ % NUM_VALUES] == X.front());
+                        mX.pop_front();
+                    }
+                    else {
+                        mX.push_front(values[tail++ % NUM_VALUES]);
+                        LOOP3_ASSERT(LENGTH, atBack, i,
+                                     values[head++ % NUM_VALUES] == X.back());
+                        mX.pop_back();
+                    }
+                }
+                LOOP2_ASSERT(LENGTH, atBack, (int) X.size() == LENGTH);
+
+                if (pass) {
+                    LOOP4_ASSERT(LENGTH, atBack,
+                                 NUM_TOTAL, testAllocator.numBlocksTotal(),
+                                 NUM_TOTAL == testAllocator.numBlocksTotal());
+                }
+            }
+        }
+    }
+
+    if (verbose) printf("\tRetaining at most two spare blocks.\n");
+
+    for (int method = 0; method < 4; ++method) {
+        bslma::TestAllocator testAllocator(veryVeryVerbose);
+
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_BLOCKS * BLOCK_LENGTH; ++i) {
+                mX.push_back(values[i % NUM_VALUES]);
+            }
+
+            switch (method) {
+              case 0: {
+                while (!X.empty()) {
+                    mX.pop_front();
+                }
+              } break;
+              case 1: {
+                while (!X.empty()) {
+                    mX.pop_back();
+                }
+              } break;
+              case 2: {
+                mX.erase(X.begin(), X.end());
+              } break;
+              case 3: {
+                mX.clear();
+              } break;
+            }
+
+            LOOP2_ASSERT(method, testAllocator.numBlocksInUse(),
+                         4 == testAllocator.numBlocksInUse());
+
+            for (int i = 0; i < 2 * BLOCK_LENGTH; ++i) {
+                mX.push_back(values[i % NUM_VALUES]);
+            }
+
+            LOOP2_ASSERT(method, testAllocator.numBlocksInUse(),
+                         4 == testAllocator.numBlocksInUse());
+        }
+
+        LOOP2_ASSERT(method, testAllocator.numBlocksInUse(),
+                     0 == testAllocator.numBlocksInUse());
+    }
+}
+
 template <class TYPE, class ALLOC>
 void TestDriver<TYPE,ALLOC>::testCase22()
 {
@@ -7916,7 +8062,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -8122,7 +8268,7 @@ int main(int argc, char *argv[])
         }
 //..
       } break;
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -8189,6 +8335,27 @@ int main(int argc, char *argv[])
         // Next: Wally Walters
         // Next: Fred Flintstone
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK REUSE
+        //
+        // Testing:
+        //   CONCERN: Blocks released by 'pop_front' are reused by 'push_back'.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTesting reuse of blocks"
+                            "\n=======================\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testCase23();
+
+        if (verbose) printf("\n... with 'SmallTestTypeNoAlloc'.\n");
+        TestDriver<S>::testCase23();
+
+        if (verbose) printf("\n... with 'LargeTestTypeNoAlloc'.\n");
+        TestDriver<L>::testCase23();
+
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // TESTING EXCEPTIONS
@@ -9038,6 +9205,74 @@ int main(int argc, char *argv[])
         TestDriver<BCT>::testCaseM1Range(CharArray<BCT>());
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: FIFO QUEUE
+        //
+        // Concerns:
+        //   Provide a benchmark of the throughput of a deque used as a FIFO
+        //   queue, through 'push_back' and 'pop_front', in steady state.
+        //
+        // Plan:
+        //   For queues of various lengths, report the time taken to push and
+        //   pop (by default) 10 million 'int' values, and the number of
+        //   allocations made, with memory supplied by the 'new'/'delete'
+        //   allocator and by a test allocator (whose allocations are more
+        //   costly).
+        //
+        // Testing:
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: FIFO QUEUE"
+                            "\n============================\n");
+
+        const int NUM_OPS = argc > 2 && atoi(argv[2]) > 0
+                            ? atoi(argv[2])
+                            : 10 * 1000 * 1000;
+
+        const int LENGTHS[]   = { 1, 100, 10 * 1000, 1000 * 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int useTestAllocator = 0; useTestAllocator < 2;
+                                                          ++useTestAllocator) {
+            printf("\tUsing %s:\n", useTestAllocator
+                                     ? "'bslma::TestAllocator'"
+                                     : "'bslma::NewDeleteAllocator'");
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                bslma::TestAllocator ta(veryVeryVerbose);
+
+                bsl::deque<int> mX(useTestAllocator
+                                   ? static_cast<bslma::Allocator *>(&ta)
+                                   : &bslma::NewDeleteAllocator::singleton());
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX.push_back(i);
+                }
+
+                const Int64 NUM_TOTAL = ta.numBlocksTotal();
+                unsigned    sum       = 0;
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < NUM_OPS; ++i) {
+                    mX.push_back(i);
+                    sum += mX.front();
+                    mX.pop_front();
+                }
+                timer.stop();
+
+                ASSERT(LENGTH == (int) mX.size());
+                printf("\t\tlength %7d: %8.3fs", LENGTH, timer.elapsedTime());
+                if (useTestAllocator) {
+                    printf(", %lld allocations",
+                           ta.numBlocksTotal() - NUM_TOTAL);
+                }
+                printf(" (checksum %u)\n", sum);
+            }
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -0,0 +1,1450 @@
+// bslstl_flatmap.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAP
+#define INCLUDED_BSLSTL_FLATMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map of unique keys held in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_map: ordered key-value map held in contiguous storage
+//
+//@SEE_ALSO: bslstl_map, bslstl_flatmultimap, bslstl_flatset
+//
+//@DESCRIPTION: This component defines a single class template, 'flat_map',
+// implementing a container holding an ordered sequence of key-value pairs
+// having unique keys, with the interface of 'bsl::map', whose pairs are held
+// in a 'bsl::vector' sorted by key rather than in a tree of nodes.  The
+// interface follows the C++23 'std::flat_map', except that the keys and
+// mapped values are held together, in a single (not user-supplied) container
+// of 'bsl::pair<KEY, VALUE>' objects, and that interfaces requiring C++11
+// language features are omitted.
+//
+// An instantiation of 'flat_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of key-value pairs the 'flat_map' contains.  The requirements on
+// the 'KEY' and 'VALUE' types are those of 'bsl::map' (see 'bslstl_map'), and
+// in addition both must be copy-assignable.
+//
+// Since the pairs are held in a vector, which requires its elements to be
+// assignable, the 'value_type' of a 'flat_map' is 'bsl::pair<KEY, VALUE>',
+// and not 'bsl::pair<const KEY, VALUE>' as for 'bsl::map'.  The key of a pair
+// can therefore be modified through an 'iterator'; the behavior is undefined
+// if a key is so modified while the pair is held by a 'flat_map'.
+//
+///Choosing Between 'map' and 'flat_map'
+///-------------------------------------
+// A 'flat_map' holds its pairs contiguously, without the per-pair node
+// allocation and the three pointers and color of a 'bsl::map' node.  Looking
+// up a key is a binary search over contiguous memory, and iterating over the
+// pairs a linear scan, both of which make much better use of the processor
+// caches than traversing the nodes of a tree.  On the other hand, inserting
+// or erasing a single pair takes time linear in the number of pairs following
+// it, and invalidates all iterators and references to the pairs following it
+// (or to all pairs, if the vector grows).  A 'flat_map' is therefore best
+// suited to maps that are built once (or in large batches) and then mostly
+// searched; batches of pairs should be inserted by the range 'insert' method,
+// which merges the whole batch in a single pass.  The benchmark in case -1 of
+// the test driver of this component compares 'flat_map' with 'bsl::map'.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a flat map's 'ALLOCATOR' template parameter determines
+// how that flat map will allocate memory, as for 'bsl::vector'.  If the
+// 'ALLOCATOR' is 'bsl::allocator' (the default), then objects of the flat map
+// type conform to the standard behavior of a 'bslma'-allocator-enabled type:
+// the flat map accepts an optional 'bslma::Allocator' argument at
+// construction, uses it to supply memory for its vector throughout its
+// lifetime, and supplies it to the constructors of the keys and mapped values
+// it holds if they have the 'bslma::UsesBslmaAllocator' trait.  In
+// particular, each pair inserted into a flat map, even by a range 'insert',
+// is created by the allocator of the flat map, and no temporary copy of a
+// pair is made with another allocator.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_map':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the flat map
+//  'V'             - (template parameter) type 'VALUE' of the flat map
+//  'a', 'b'        - two distinct objects of type 'flat_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'flat_map<K, V>::value_type'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_map<K, V> a;    (default construction)        | O[1]               |
+//  | flat_map<K, V> a(al);                              |                    |
+//  | flat_map<K, V> a(c, al);                           |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(b); (copy construction)           | O[n]               |
+//  | flat_map<K, V> a(b, al);                           |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(i1, i2);                          | O[N] if [i1, i2)   |
+//  | flat_map<K, V> a(i1, i2, c, al);                   | is sorted,         |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(sorted_unique, i1, i2);           | O[N]               |
+//  | flat_map<K, V> a(sorted_unique, i1, i2, c, al);    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_map<K, V>(); (destruction)                 | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;               (assignment)                  | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty(), a.capacity()                  | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k]                                               | O[log(n)] if 'k'   |
+//  |                                                    | is in 'a', O[n]    |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.at(k)                                            | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v)                                        | O[n]               |
+//  | a.insert(p1, v)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)], |
+//  |                                                    | or O[N] if 'a' is  |
+//  |                                                    | empty, or [i1, i2) |
+//  |                                                    | is ordered after   |
+//  |                                                    | 'a', and sorted    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[n + N]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[n]               |
+//  | a.erase(k)                                         |                    |
+//  | a.erase(p1, p2)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(m), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.value_comp()                                     | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.contains(k)                           | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.count(k)                                         | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.upper_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Looking Up Currency Precisions
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to look up the number of decimal places used to quote each
+// currency, from a table that is loaded at start-up and then only read.
+//
+// First, we define the type of the table, mapping an ISO currency code to its
+// number of decimal places:
+//..
+//  typedef bsl::flat_map<bsl::string, int> PrecisionTable;
+//..
+// Then, we load the table in a single batch, from an array of pairs in no
+// particular order:
+//..
+//  typedef PrecisionTable::value_type Entry;
+//
+//  const Entry ENTRIES[] = {
+//      Entry("USD", 2), Entry("JPY", 0), Entry("EUR", 2), Entry("KWD", 3)
+//  };
+//  const int NUM_ENTRIES = sizeof ENTRIES / sizeof *ENTRIES;
+//
+//  bslma::TestAllocator allocator;
+//  PrecisionTable       table(ENTRIES,
+//                             ENTRIES + NUM_ENTRIES,
+//                             std::less<bsl::string>(),
+//                             &allocator);
+//  assert(4 == table.size());
+//..
+// Next, we look up the precision of a few currencies:
+//..
+//  assert(0 == table.at("JPY"));
+//  assert(3 == table.at("KWD"));
+//  assert(table.end() == table.find("GBP"));
+//..
+// Then, we add a currency, using 'operator[]':
+//..
+//  table["GBP"] = 2;
+//  assert(5 == table.size());
+//..
+// Finally, we observe that the entries are iterated in order of their keys:
+//..
+//  PrecisionTable::const_iterator it = table.begin();
+//  assert("EUR" == it->first);
+//  ++it;
+//  assert("GBP" == it->first);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATTREEUTIL
+#include <bslstl_flattreeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SORTEDTAG
+#include <bslstl_sortedtag.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'equal', 'lexicographical_compare'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                               // ==============
+                               // class flat_map
+                               // ==============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR  = std::less<KEY>,
+          class ALLOCATOR   = bsl::allocator<bsl::pair<KEY, VALUE> > >
+class flat_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys (of the
+    // template parameter type, 'KEY') in a 'bsl::vector'.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<KEY, VALUE>                      value_type;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<value_type>
+                                                                    KeyConfig;
+        // This 'typedef' is an alias for the policy extracting the key of a
+        // pair held by this flat map.
+
+    typedef BloombergLP::bslstl::FlatTreeUtil<KeyConfig>           Util;
+        // This 'typedef' is an alias for the utility implementing the
+        // algorithms of this flat map.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef bsl::vector<value_type, ALLOCATOR>         container_type;
+
+    typedef typename container_type::size_type         size_type;
+    typedef typename container_type::difference_type   difference_type;
+    typedef typename container_type::pointer           pointer;
+    typedef typename container_type::const_pointer     const_pointer;
+
+    typedef typename container_type::iterator          iterator;
+    typedef typename container_type::const_iterator    const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by their keys, using the (template parameter) type
+        // 'COMPARATOR', as for 'bsl::map::value_compare'.
+
+        // FRIENDS
+        friend class flat_map;
+
+      protected:
+        COMPARATOR comp;  // key comparator
+
+        value_compare(COMPARATOR comparator) : comp(comparator) {}
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to
+            // the overload of 'operator()' (the comparison function) provided
+            // by a 'flat_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_map::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    container_type d_container;   // pairs, sorted by key
+    COMPARATOR     d_comparator;  // key comparator
+
+  public:
+    // CREATORS
+    explicit flat_map(const COMPARATOR& comparator = COMPARATOR(),
+                      const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct an empty flat map.  Optionally specify a 'comparator'
+        // used to order key-value pairs contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // an 'allocator' used to supply memory.  If 'allocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator'
+        // (the default), then 'allocator', if supplied, shall be convertible
+        // to 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator' and
+        // 'allocator' is not supplied, the currently installed default
+        // allocator is used to supply memory.
+
+    explicit flat_map(const ALLOCATOR& allocator);
+        // Construct an empty flat map that will use the specified 'allocator'
+        // to supply memory.  Use a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' to order the key-value pairs
+        // contained in this flat map.  If the template parameter 'ALLOCATOR'
+        // argument is of type 'bsl::allocator' (the default), then
+        // 'allocator' shall be convertible to 'bslma::Allocator *'.
+
+    flat_map(const flat_map& original);
+        // Construct a flat map having the same value as the specified
+        // 'original'.  Use a copy of 'original.key_comp()' to order the
+        // key-value pairs contained in this flat map.  Use the allocator
+        // returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) types 'KEY' and 'VALUE' both be "copy-constructible"
+        // (see {Requirements on 'KEY' and 'VALUE'} in 'bslstl_map').
+
+    flat_map(const flat_map& original, const ALLOCATOR& allocator);
+        // Construct a flat map having the same value as that of the specified
+        // 'original' that will use the specified 'allocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the key-value pairs
+        // contained in this flat map.  This method requires that the
+        // (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a flat map, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element, ignoring those
+        // pairs having a key equivalent to that of a pair appearing earlier
+        // in the sequence.  Optionally specify a 'comparator' used to order
+        // key-value pairs contained in this object, and an 'allocator' used
+        // to supply memory, as for the default constructor.  If the sequence
+        // is ordered according to 'comparator', this operation takes O[N]
+        // time, where N is the number of pairs in the sequence, and
+        // O[N * log(N)] time otherwise.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values
+        // of a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  This method requires
+        // that the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a flat map holding the pairs in the sequence starting at
+        // the specified 'first' element, and ending immediately before the
+        // specified 'last' element, whose keys must be unique and ordered
+        // according to the comparator of this flat map, in O[N] time, where N
+        // is the number of pairs in the sequence, without comparing the keys
+        // (except to verify their order in safe build modes).  Optionally
+        // specify a 'comparator' used to order key-value pairs contained in
+        // this object, and an 'allocator' used to supply memory, as for the
+        // default constructor.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // providing access to values of a type convertible to 'value_type'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or
+        // before 'last', and the key of each pair in the sequence is ordered
+        // after that of the pair preceding it.
+
+    ~flat_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_map& operator=(const flat_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // This method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" and "copy-assignable".
+
+    VALUE& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key'; if this flat map does not
+        // already contain a 'value_type' object with 'key', first insert a
+        // new 'value_type' object having 'key' and a default-constructed
+        // 'VALUE' object, and return a reference to the mapped value.  This
+        // method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "default-constructible".
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise throw an 'std::out_of_range' exception.  Note that this
+        // method is not exception agnostic.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this flat map, or the 'end' iterator if this flat map
+        // is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this flat map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this flat map, or 'rend' if this flat map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this flat map.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this flat map if the key (the
+        // 'first' element) of 'value' does not already exist in this flat
+        // map; otherwise, if a key equivalent to that of 'value' already
+        // exists in this flat map, this method has no effect.  Return a pair
+        // whose 'first' member is an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this flat map whose key is
+        // equivalent to that of 'value', and whose 'second' member is 'true'
+        // if a new pair was inserted, and 'false' if the key was already
+        // present.  This operation takes time linear in the number of pairs
+        // ordered after 'value', and invalidates the iterators and references
+        // to those pairs (and to all pairs, if the capacity of this flat map
+        // grows).  This method requires that the (template parameter) types
+        // 'KEY' and 'VALUE' both be "copy-constructible" and
+        // "copy-assignable".
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this flat map (in constant time
+        // plus the time to move the pairs ordered after 'value', if the
+        // specified 'hint' is a valid immediate successor to the key of
+        // 'value'), if the key of 'value' does not already exist in this flat
+        // map; otherwise, this method has no effect.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this flat map whose key is equivalent to that of 'value'.  If
+        // 'hint' is not a valid immediate successor to the key of 'value',
+        // this operation requires O[log(N)] additional comparisons, where N is
+        // the size of this flat map.  The behavior is undefined unless 'hint'
+        // is a valid iterator into this flat map.  This method requires that
+        // the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" and "copy-assignable".
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat map the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this flat map (nor equivalent to that of a
+        // pair preceding it in the range).  The pairs are merged into this
+        // flat map in a single batch, in O[n + N * log(N)] time, where n is
+        // the size of this flat map and N the length of the range, or O[N]
+        // time if the range is ordered and this flat map is empty or holds
+        // only keys ordered before those of the range.  If an exception is
+        // thrown, this flat map is unchanged.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // providing access to values of a type convertible to 'value_type'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or
+        // before 'last'.  This method requires that the (template parameter)
+        // types 'KEY' and 'VALUE' both be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat map the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this flat map, in O[n + N] time, where n is the
+        // size of this flat map and N the length of the range.  If an
+        // exception is thrown, this flat map is unchanged.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last', and the key of each pair in the sequence is
+        // ordered after that of the pair preceding it.  This method requires
+        // that the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible".
+
+    iterator erase(const_iterator position);
+        // Remove from this flat map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  The
+        // behavior is undefined unless 'position' refers to a 'value_type'
+        // object in this flat map.
+
+    size_type erase(const key_type& key);
+        // Remove from this flat map the 'value_type' object whose key is
+        // equivalent to the specified 'key', if such an entry exists, and
+        // return 1; otherwise, if there is no 'value_type' object having an
+        // equivalent key, return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this flat map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this flat map
+        // or are the 'end' iterator, and the 'first' position is at or before
+        // the 'last' position in the ordered sequence provided by this
+        // container.
+
+    void swap(flat_map& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if this object and 'other' use the same
+        // allocator (as for 'bsl::vector').
+
+    void clear();
+        // Remove all entries from this flat map.  Note that the flat map is
+        // empty after this call, but allocated memory may be retained for
+        // future use.
+
+    void reserve(size_type numPairs);
+        // Change the capacity of this flat map, so that it can hold at least
+        // the specified 'numPairs' without reallocating its storage.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this flat map to its size, releasing unused
+        // memory.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this flat map whose key is equivalent to the specified
+        // 'key', if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this flat map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this flat map does not contain a 'value_type' object
+        // whose key is greater-than or equal-to 'key'.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this flat map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this flat map does not contain a 'value_type' object whose key is
+        // greater than 'key'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this flat map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second is
+        // positioned one past the end of the sequence.  Note that since a
+        // flat map maintains unique keys, the range will contain at most one
+        // element.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // flat map.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this flat map, or the 'end' iterator if this flat map
+        // is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this flat map.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this flat map, or 'rend' if this flat map is
+        // empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this flat map.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this flat map, or the 'cend' iterator if this flat
+        // map is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this flat map.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this flat map, or 'crend' if this flat map is
+        // empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this flat map.
+
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key', if such an entry
+        // exists; otherwise throw an 'std::out_of_range' exception.  Note
+        // that this method is not exception agnostic.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this flat map contains a 'value_type' object whose
+        // key is equivalent to the specified 'key', and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this flat map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this flat map.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this flat map could possibly hold.  Note that there is no
+        // guarantee that the flat map can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of elements this flat map can hold without
+        // reallocating its storage.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this flat map; if a comparator was supplied at construction, return
+        // its value, otherwise return a default constructed 'key_compare'
+        // object.  Note that this comparator compares objects of type 'KEY',
+        // which is the key part of the 'value_type' objects contained in this
+        // flat map.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this flat map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this flat map whose
+        // keys are equivalent to the specified 'key'.  Note that since a flat
+        // map maintains unique keys, the returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this flat map whose key
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this flat map does not contain a
+        // 'value_type' object whose key is greater-than or equal-to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this flat map whose key
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this flat map does not contain a 'value_type' object whose key is
+        // greater than 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this flat map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second is
+        // positioned one past the end of the sequence.  Note that since a
+        // flat map maintains unique keys, the range will contain at most one
+        // element.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_map' objects have the same
+    // value if they have the same number of key-value pairs, and each pair in
+    // the ordered sequence of pairs of one object is equal to the pair at the
+    // same position in the other.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically less than that of the specified 'rhs' flat map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically greater than that of the specified 'rhs' flat map,
+    // and 'false' otherwise.  This method requires that 'operator<', inducing
+    // a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // flat map, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // flat map, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  This method
+    // provides the no-throw exception-safety guarantee if 'a' and 'b' use the
+    // same allocator.
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                               // --------------
+                               // class flat_map
+                               // --------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_container(allocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                   const ALLOCATOR& allocator)
+: d_container(allocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                     const flat_map& original)
+: d_container(original.d_container)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                  const flat_map&  original,
+                                                  const ALLOCATOR& allocator)
+: d_container(original.d_container, allocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                 INPUT_ITERATOR    first,
+                                                 INPUT_ITERATOR    last,
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_container(allocator)
+, d_comparator(comparator)
+{
+    Util::insertRange(&d_container, first, last, d_comparator, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                 sorted_unique_t,
+                                                 INPUT_ITERATOR    first,
+                                                 INPUT_ITERATOR    last,
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_container(first, last, allocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSorted(d_container.begin(),
+                                    d_container.end(),
+                                    d_comparator,
+                                    true));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~flat_map()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const flat_map& rhs)
+{
+    d_container  = rhs.d_container;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
+{
+    iterator position = lower_bound(key);
+    if (position == end() || d_comparator(key, position->first)) {
+        position = d_container.insert(position, value_type(key, VALUE()));
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator position = find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_container.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_container.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    iterator position = lower_bound(value.first);
+    if (position != end() && !d_comparator(value.first, position->first)) {
+        return pair<iterator, bool>(position, false);                 // RETURN
+    }
+    return pair<iterator, bool>(d_container.insert(position, value), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                    const value_type& value)
+{
+    if ((hint == d_container.cbegin()
+                         || d_comparator((hint - 1)->first, value.first))
+     && (hint == d_container.cend()
+                         || d_comparator(value.first, hint->first))) {
+        return d_container.insert(hint, value);                       // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    Util::insertRange(&d_container, first, last, d_comparator, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    Util::insertSortedRange(&d_container, first, last, d_comparator, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_container.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == cend()) {
+        return 0;                                                     // RETURN
+    }
+    d_container.erase(position);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    return d_container.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(flat_map& other)
+{
+    d_container.swap(other.d_container);
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_container.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(size_type numPairs)
+{
+    d_container.reserve(numPairs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_container.shrink_to_fit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return Util::find(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return Util::lowerBound(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return Util::upperBound(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator first = lower_bound(key);
+    iterator last  = first;
+    if (last != end() && !d_comparator(key, last->first)) {
+        ++last;
+    }
+    return pair<iterator, iterator>(first, last);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_container.get_allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_container.cbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_container.cend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const VALUE&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_container.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_container.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_container.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_container.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return Util::find(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != end() ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                    const key_type& key) const
+{
+    return Util::lowerBound(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                    const key_type& key) const
+{
+    return Util::upperBound(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    const_iterator first = lower_bound(key);
+    const_iterator last  = first;
+    if (last != end() && !d_comparator(key, last->first)) {
+        ++last;
+    }
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+                                // ===========
+                                // TYPE TRAITS
+                                // ===========
+
+// Type traits for flat maps:
+//: o A flat map defines STL iterators.
+//: o A flat map uses 'bslma' allocators if the parameterized 'ALLOCATOR' is
+//:     convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <typename KEY,
+          typename VALUE,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct HasStlIterators<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <typename KEY,
+          typename VALUE,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1413 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_sortedtag.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_mallocfreeallocator.h>     // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapting a sorted 'bsl::vector',
+// whose algorithms are provided (and thoroughly tested) by
+// 'bslstl_flattreeutil'.  We therefore verify that each method of 'flat_map'
+// forwards to the appropriate algorithm, by comparing the state of a
+// 'flat_map' with that of a 'bsl::map' subjected to the same operations, for
+// each sequence of keys described in a table, and that the allocator supplied
+// at construction is used for all memory, in the presence of injected
+// exceptions where an operation allocates.  The mapped value of each pair
+// identifies the position of the pair in the sequence it was created from, so
+// that the retention of the first of several pairs having equivalent keys can
+// be observed.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map(const C& comparator = C(), const A& allocator = A());
+// [ 2] flat_map(const A& allocator);
+// [ 4] flat_map(const flat_map& original);
+// [ 4] flat_map(const flat_map& original, const A& allocator);
+// [ 3] flat_map(ITER first, ITER last, const C& comp, const A& alloc);
+// [ 3] flat_map(sorted_unique_t, ITER, ITER, const C& c, const A& a);
+// [ 2] ~flat_map();
+//
+// MANIPULATORS
+// [ 4] flat_map& operator=(const flat_map& rhs);
+// [ 5] VALUE& operator[](const key_type& key);
+// [ 5] VALUE& at(const key_type& key);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 5] iterator insert(const_iterator hint, const value_type& value);
+// [ 3] void insert(ITER first, ITER last);
+// [ 3] void insert(sorted_unique_t, ITER first, ITER last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(flat_map& other);
+// [ 5] void clear();
+// [ 5] void reserve(size_type numPairs);
+// [ 5] void shrink_to_fit();
+// [ 6] iterator find(const key_type& key);
+// [ 6] iterator lower_bound(const key_type& key);
+// [ 6] iterator upper_bound(const key_type& key);
+// [ 6] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 5] const VALUE& at(const key_type& key) const;
+// [ 6] bool contains(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 5] size_type capacity() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 6] const_iterator find(const key_type& key) const;
+// [ 6] size_type count(const key_type& key) const;
+// [ 6] const_iterator lower_bound(const key_type& key) const;
+// [ 6] const_iterator upper_bound(const key_type& key) const;
+// [ 6] pair<const_iterator, const_iterator> equal_range(const key_type&);
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_map& lhs, const flat_map& rhs);
+// [ 4] bool operator!=(const flat_map& lhs, const flat_map& rhs);
+// [ 4] bool operator<(const flat_map& lhs, const flat_map& rhs);
+// [ 4] bool operator>(const flat_map& lhs, const flat_map& rhs);
+// [ 4] bool operator<=(const flat_map& lhs, const flat_map& rhs);
+// [ 4] bool operator>=(const flat_map& lhs, const flat_map& rhs);
+// [ 4] void swap(flat_map& a, flat_map& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 2] CONCERN: The type has the expected traits.
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::map'
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::flat_map<char, int>  Obj;
+typedef Obj::value_type           Value;
+typedef bsl::map<char, int>       Model;
+typedef bsl::vector<Value>        Vector;
+
+struct DefaultDataRow {
+    int         d_line;      // source line number
+    const char *d_spec;      // keys of the sequence, in order
+    bool        d_isUnique;  // 'true' if 'd_spec' is sorted and unique
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  spec                 unique
+    //----  -------------------  ------
+    { L_,   "",                  true  },
+    { L_,   "A",                 true  },
+    { L_,   "AA",                false },
+    { L_,   "AB",                true  },
+    { L_,   "BA",                false },
+    { L_,   "ACE",               true  },
+    { L_,   "BDF",               true  },
+    { L_,   "ABB",               false },
+    { L_,   "CAB",               false },
+    { L_,   "FGH",               true  },
+    { L_,   "ECAC",              false },
+    { L_,   "ABCDEFGH",          true  },
+    { L_,   "HGFEDCBA",          false },
+    { L_,   "DADBDCDD",          false },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+volatile size_t benchmarkSink;
+    // Receives a result of each benchmark so that it is not optimized away.
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool isEqual(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // key-value pairs as the specified 'model', and 'false' otherwise.
+{
+    if (object.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+    Model::const_iterator it = model.begin();
+    for (Obj::const_iterator jt = object.begin(); jt != object.end(); ++jt) {
+        if (jt->first != it->first || jt->second != it->second) {
+            return false;                                             // RETURN
+        }
+        ++it;
+    }
+    return true;
+}
+
+void load(Vector *result, const char *spec, int base = 0)
+    // Append to the specified 'result' a pair for each key of the specified
+    // 'spec', in order, whose mapped value is the position of the key in
+    // 'spec' plus the optionally specified 'base'.
+{
+    for (int i = 0; spec[i]; ++i) {
+        result->push_back(Value(spec[i], base + i));
+    }
+}
+
+void loadModel(Model *result, const char *spec, int base = 0)
+    // Insert into the specified 'result' a pair for each key of the specified
+    // 'spec', in order, whose mapped value is the position of the key in
+    // 'spec' plus the optionally specified 'base'.
+{
+    for (int i = 0; spec[i]; ++i) {
+        result->insert(Model::value_type(spec[i], base + i));
+    }
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Looking Up Currency Precisions
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to look up the number of decimal places used to quote each
+// currency, from a table that is loaded at start-up and then only read.
+//
+// First, we define the type of the table, mapping an ISO currency code to its
+// number of decimal places:
+//..
+    typedef bsl::flat_map<bsl::string, int> PrecisionTable;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we load the table in a single batch, from an array of pairs in no
+// particular order:
+//..
+    typedef PrecisionTable::value_type Entry;
+
+    const Entry ENTRIES[] = {
+        Entry("USD", 2), Entry("JPY", 0), Entry("EUR", 2), Entry("KWD", 3)
+    };
+    const int NUM_ENTRIES = sizeof ENTRIES / sizeof *ENTRIES;
+
+    bslma::TestAllocator allocator;
+    PrecisionTable       table(ENTRIES,
+                               ENTRIES + NUM_ENTRIES,
+                               std::less<bsl::string>(),
+                               &allocator);
+    ASSERT(4 == table.size());
+//..
+// Next, we look up the precision of a few currencies:
+//..
+    ASSERT(0 == table.at("JPY"));
+    ASSERT(3 == table.at("KWD"));
+    ASSERT(table.end() == table.find("GBP"));
+//..
+// Then, we add a currency, using 'operator[]':
+//..
+    table["GBP"] = 2;
+    ASSERT(5 == table.size());
+//..
+// Finally, we observe that the entries are iterated in order of their keys:
+//..
+    PrecisionTable::const_iterator it = table.begin();
+    ASSERT("EUR" == it->first);
+    ++it;
+    ASSERT("GBP" == it->first);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCHES
+        //
+        // Concerns:
+        //: 1 Each search method returns the same position as the
+        //:   corresponding method of 'bsl::map', for keys present in the
+        //:   flat map, and for keys ordered before, between, and after them.
+        //:
+        //: 2 'count' and 'contains' report whether the key is present.
+        //:
+        //: 3 The manipulators return the same positions as the accessors.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a flat map and a model from
+        //:   the keys of the row, and for each key from '@' to 'I' compare the
+        //:   results of the searches, as offsets from 'begin'.  (C-1..3)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   bool contains(const key_type& key) const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCHES"
+                            "\n================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values;
+            load(&values, SPEC);
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+            Model model;
+            loadModel(&model, SPEC);
+            const Model& M = model;
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                const bool FOUND = M.end() != M.find(key);
+
+                ASSERTV(LINE, key, FOUND == X.contains(key));
+                ASSERTV(LINE, key, M.count(key) == X.count(key));
+
+                ASSERTV(LINE, key, bsl::distance(M.begin(), M.find(key))
+                                == bsl::distance(X.begin(), X.find(key)));
+                ASSERTV(LINE, key,
+                        bsl::distance(M.begin(), M.lower_bound(key))
+                              == bsl::distance(X.begin(), X.lower_bound(key)));
+                ASSERTV(LINE, key,
+                        bsl::distance(M.begin(), M.upper_bound(key))
+                              == bsl::distance(X.begin(), X.upper_bound(key)));
+
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                           X.equal_range(key);
+                ASSERTV(LINE, key, X.lower_bound(key) == R.first);
+                ASSERTV(LINE, key, X.upper_bound(key) == R.second);
+
+                const bsl::pair<Obj::iterator, Obj::iterator> MR =
+                                                          mX.equal_range(key);
+                ASSERTV(LINE, key, X.find(key)        == mX.find(key));
+                ASSERTV(LINE, key, X.lower_bound(key) == mX.lower_bound(key));
+                ASSERTV(LINE, key, X.upper_bound(key) == mX.upper_bound(key));
+                ASSERTV(LINE, key, R.first  == MR.first);
+                ASSERTV(LINE, key, R.second == MR.second);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ELEMENT ACCESS, HINTED INSERT, AND ERASE
+        //
+        // Concerns:
+        //: 1 'operator[]' returns the mapped value of the key, inserting a
+        //:   default-constructed mapped value at the ordered position of the
+        //:   key if it is not present.
+        //:
+        //: 2 'at' returns the mapped value of the key, and throws
+        //:   'std::out_of_range' if it is not present.
+        //:
+        //: 3 Inserting with a hint inserts the pair at the same position
+        //:   whether or not the hint is correct, and returns an iterator to
+        //:   the (possibly existing) pair having an equivalent key.
+        //:
+        //: 4 Each 'erase' overload removes the same pairs as the corresponding
+        //:   method of 'bsl::map', and returns the position following them.
+        //:
+        //: 5 'clear' removes all pairs, retaining the capacity, and 'reserve'
+        //:   and 'shrink_to_fit' change only the capacity.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, and each key from '@' to 'I', access
+        //:   the key with 'operator[]' and 'at' on copies of the flat map of
+        //:   the row, and compare with the model.  (C-1..2)
+        //:
+        //: 2 For each row of the table, and each key from '@' to 'I', insert
+        //:   a pair into a copy of the flat map of the row with every
+        //:   possible hint, and compare with the model.  (C-3)
+        //:
+        //: 3 For each row of the table, erase each key, each position, and
+        //:   each range of positions of a copy of the flat map of the row, and
+        //:   compare with the model.  (C-4)
+        //:
+        //: 4 Call 'clear', 'reserve', and 'shrink_to_fit' and verify the size,
+        //:   capacity, and value.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type& key);
+        //   VALUE& at(const key_type& key);
+        //   const VALUE& at(const key_type& key) const;
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        //   void reserve(size_type numPairs);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING ELEMENT ACCESS, HINTED INSERT, AND ERASE"
+                          "\n================================================"
+                          "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'operator[]' and 'at'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                Model model(&sa);
+                loadModel(&model, SPEC);
+                const bool FOUND = model.end() != model.find(key);
+
+                {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE, key, model[key] == mX[key]);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                    ASSERTV(LINE, key, isEqual(X, model));
+
+                    mX[key] = 42;
+                    ASSERTV(LINE, key, 42 == X.find(key)->second);
+                }
+                {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    bool caught = false;
+                    try {
+                        ASSERTV(LINE, key, &mX.at(key) == &X.at(key));
+                        ASSERTV(LINE, key, X.find(key)->second == X.at(key));
+                    }
+                    catch (const std::out_of_range&) {
+                        caught = true;
+                    }
+                    ASSERTV(LINE, key, FOUND != caught);
+                    ASSERTV(LINE, key, Y == X);
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting hinted 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                Model model(&sa);
+                loadModel(&model, SPEC);
+                model.insert(Model::value_type(key, 99));
+
+                for (int hi = 0; hi <= static_cast<int>(Y.size()); ++hi) {
+                    if (veryVerbose) { T_ P_(SPEC) P_(key) P(hi) }
+
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    Obj::iterator it = mX.insert(X.begin() + hi,
+                                                 Value(key, 99));
+                    ASSERTV(LINE, key, hi, X.end() != it);
+                    ASSERTV(LINE, key, hi, key == it->first);
+                    ASSERTV(LINE, key, hi, isEqual(X, model));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'erase'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+            const int SIZE = static_cast<int>(Y.size());
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                ASSERTV(LINE, key, model.erase(key) == mX.erase(key));
+                ASSERTV(LINE, key, isEqual(X, model));
+            }
+
+            for (int i = 0; i < SIZE; ++i) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                model.erase(Y.begin()[i].first);
+                Obj::iterator it = mX.erase(X.begin() + i);
+                ASSERTV(LINE, i, X.begin() + i == it);
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            for (int i = 0; i <= SIZE; ++i) {
+                for (int j = i; j <= SIZE; ++j) {
+                    Obj   mX(Y, &oa);  const Obj& X = mX;
+                    Model model(&sa);
+                    loadModel(&model, SPEC);
+
+                    Model::iterator first = model.begin();
+                    bsl::advance(first, i);
+                    Model::iterator last = model.begin();
+                    bsl::advance(last, j);
+                    model.erase(first, last);
+
+                    Obj::iterator it = mX.erase(X.begin() + i, X.begin() + j);
+                    ASSERTV(LINE, i, j, X.begin() + i == it);
+                    ASSERTV(LINE, i, j, isEqual(X, model));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'clear', 'reserve', and "
+                            "'shrink_to_fit'.\n");
+        {
+            Vector values(&sa);
+            load(&values, "ACEG");
+
+            Obj mX(values.begin(), values.end(), std::less<char>(), &oa);
+            const Obj& X = mX;
+            const Obj  Y(X, &oa);
+
+            mX.reserve(100);
+            ASSERTV(X.capacity(), 100 <= X.capacity());
+            ASSERT(Y == X);
+
+            mX.shrink_to_fit();
+            ASSERTV(X.capacity(), 4 == X.capacity());
+            ASSERT(Y == X);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERTV(X.capacity(), 4 == X.capacity());
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Vector values(&sa);
+            load(&values, "AB");
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   allocator supplied, or the default allocator if none is.
+        //:
+        //: 2 Assignment gives the target the value of the source, which is
+        //:   unchanged.
+        //:
+        //: 3 Two flat maps compare equal if and only if they hold the same
+        //:   pairs, and are ordered lexicographically otherwise.
+        //:
+        //: 4 The member and free 'swap' functions exchange the values of two
+        //:   flat maps, without allocating if they use the same allocator.
+        //:
+        //: 5 No memory is leaked if an exception is thrown while copying.
+        //
+        // Plan:
+        //: 1 For each row of the table, copy a flat map holding the keys of
+        //:   the row, with and without an allocator, in the presence of
+        //:   injected exceptions.  (C-1, 5)
+        //:
+        //: 2 For each pair of rows of the table, create a flat map from each
+        //:   row, and compare them with each operator, checking the result
+        //:   against that of the model.  (C-3)
+        //:
+        //: 3 Assign and swap the flat maps, and verify their values and the
+        //:   use of memory.  (C-2, 4)
+        //
+        // Testing:
+        //   flat_map(const flat_map& original);
+        //   flat_map(const flat_map& original, const A& allocator);
+        //   flat_map& operator=(const flat_map& rhs);
+        //   void swap(flat_map& other);
+        //   bool operator==(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator!=(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator<(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator>(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator<=(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator>=(const flat_map& lhs, const flat_map& rhs);
+        //   void swap(flat_map& a, flat_map& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING VALUE-SEMANTIC OPERATIONS"
+                            "\n=================================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting copy constructors.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(Y, &oa);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &oa == X.get_allocator());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            {
+                const Obj X(Y);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &da == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting comparison, assignment, and swap.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            Vector values1(&sa);
+            load(&values1, SPEC1);
+
+            Model model1(&sa);
+            loadModel(&model1, SPEC1);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2 = DATA[tj].d_line;
+                const char *const SPEC2 = DATA[tj].d_spec;
+
+                if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+                Vector values2(&sa);
+                load(&values2, SPEC2);
+
+                Model model2(&sa);
+                loadModel(&model2, SPEC2);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(values1.begin(),
+                       values1.end(),
+                       std::less<char>(),
+                       &oa);
+                const Obj& X = mX;
+                Obj mY(values2.begin(),
+                       values2.end(),
+                       std::less<char>(),
+                       &oa);
+                const Obj& Y = mY;
+
+                ASSERTV(LINE1, LINE2, (model1 == model2) == (X == Y));
+                ASSERTV(LINE1, LINE2, (model1 != model2) == (X != Y));
+                ASSERTV(LINE1, LINE2, (model1 <  model2) == (X <  Y));
+                ASSERTV(LINE1, LINE2, (model1 >  model2) == (X >  Y));
+                ASSERTV(LINE1, LINE2, (model1 <= model2) == (X <= Y));
+                ASSERTV(LINE1, LINE2, (model1 >= model2) == (X >= Y));
+
+                const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+                mX.swap(mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model1));
+
+                swap(mX, mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model1));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, NUM_TOTAL == oa.numBlocksTotal());
+
+                Obj *mR = &(mX = Y);
+                ASSERTV(LINE1, LINE2, &X == mR);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, &oa == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting swap with different allocators.\n");
+        {
+            bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+            bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+            Vector values1(&sa);
+            load(&values1, "ACE");
+            Vector values2(&sa);
+            load(&values2, "BD");
+
+            Obj mX(values1.begin(), values1.end(), std::less<char>(), &oa1);
+            const Obj& X = mX;
+            Obj mY(values2.begin(), values2.end(), std::less<char>(), &oa2);
+            const Obj& Y = mY;
+
+            const Obj XX(X, &sa), YY(Y, &sa);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+            ASSERT(&oa1 == X.get_allocator());
+            ASSERT(&oa2 == Y.get_allocator());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE CONSTRUCTORS AND RANGE 'insert'
+        //
+        // Concerns:
+        //: 1 A flat map created from, or inserted with, a range holds the
+        //:   same pairs as a 'bsl::map' created from, or inserted with, the
+        //:   same range; in particular, of several pairs having equivalent
+        //:   keys, the first is retained.
+        //:
+        //: 2 The 'sorted_unique' overloads accept ranges sorted by unique
+        //:   keys, and produce the same result as the other overloads.
+        //:
+        //: 3 All memory comes from the allocator of the flat map, and if an
+        //:   exception is thrown while inserting a range, the flat map is
+        //:   unchanged.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a flat map from the pairs of
+        //:   the row (using the 'sorted_unique' overload if the keys are
+        //:   sorted and unique), and compare with the model.  (C-1..3)
+        //:
+        //: 2 For each pair of rows of the table, the first sorted and unique,
+        //:   insert the pairs of the second row into a flat map created from
+        //:   the first in the presence of injected exceptions, verifying that
+        //:   the flat map is unchanged at the start of each attempt, and
+        //:   compare with the model.  (C-1..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for ranges that are not sorted by unique keys.  (C-4)
+        //
+        // Testing:
+        //   flat_map(ITER first, ITER last, const C& comp, const A& alloc);
+        //   flat_map(sorted_unique_t, ITER, ITER, const C& c, const A& a);
+        //   void insert(ITER first, ITER last);
+        //   void insert(sorted_unique_t, ITER first, ITER last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING RANGE CONSTRUCTORS AND RANGE 'insert'"
+                            "\n============================================="
+                            "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting range constructors.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const bool        UNIQUE = DATA[ti].d_isUnique;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            Model model(&sa);
+            loadModel(&model, SPEC);
+
+            {
+                const Obj X(values.begin(),
+                            values.end(),
+                            std::less<char>(),
+                            &oa);
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, &oa == X.get_allocator());
+            }
+            if (UNIQUE) {
+                const Obj X(bsl::sorted_unique,
+                            values.begin(),
+                            values.end(),
+                            std::less<char>(),
+                            &oa);
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, &oa == X.get_allocator());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting range 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            if (!DATA[ti].d_isUnique) {
+                continue;
+            }
+
+            Vector values1(&sa);
+            load(&values1, SPEC1);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2   = DATA[tj].d_line;
+                const char *const SPEC2   = DATA[tj].d_spec;
+                const bool        UNIQUE2 = DATA[tj].d_isUnique;
+
+                Vector values2(&sa);
+                load(&values2, SPEC2, 100);
+
+                for (int sorted = 0; sorted < 2; ++sorted) {
+                    if (sorted && !UNIQUE2) {
+                        continue;
+                    }
+
+                    if (veryVerbose) { T_ P_(SPEC1) P_(SPEC2) P(sorted) }
+
+                    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                    Model model(&sa);
+                    loadModel(&model, SPEC1);
+                    loadModel(&model, SPEC2, 100);
+
+                    Obj mX(bsl::sorted_unique,
+                           values1.begin(),
+                           values1.end(),
+                           std::less<char>(),
+                           &oa);
+                    const Obj& X = mX;
+                    const Obj  ORIGINAL(X, &sa);
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE1, LINE2, sorted, ORIGINAL == X);
+
+                        if (sorted) {
+                            mX.insert(bsl::sorted_unique,
+                                      values2.begin(),
+                                      values2.end());
+                        }
+                        else {
+                            mX.insert(values2.begin(), values2.end());
+                        }
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(LINE1, LINE2, sorted, isEqual(X, model));
+                }
+            }
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Vector sorted(&sa);    load(&sorted,   "ABC");
+            Vector unsorted(&sa);  load(&unsorted, "BAC");
+            Vector equal(&sa);     load(&equal,    "ABB");
+
+            ASSERT_SAFE_PASS(Obj(bsl::sorted_unique,
+                                 sorted.begin(),
+                                 sorted.end()));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique,
+                                 unsorted.begin(),
+                                 unsorted.end()));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique,
+                                 equal.begin(),
+                                 equal.end()));
+
+            // The order of an inserted range is verified by
+            // 'bslstl::FlatTreeUtil'.
+
+            Obj mX;
+            ASSERT_SAFE_FAIL_RAW(mX.insert(bsl::sorted_unique,
+                                           unsorted.begin(),
+                                           unsorted.end()));
+            ASSERT_SAFE_FAIL_RAW(mX.insert(bsl::sorted_unique,
+                                           equal.begin(),
+                                           equal.end()));
+            ASSERT_SAFE_PASS_RAW(mX.insert(bsl::sorted_unique,
+                                           sorted.begin(),
+                                           sorted.end()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed flat map is empty, and uses the allocator
+        //:   and comparator supplied, or default ones if none is.
+        //:
+        //: 2 Inserting a pair whose key is not present adds it at its ordered
+        //:   position, and inserting a pair whose key is present has no
+        //:   effect; both return an iterator to the pair having the key, and
+        //:   whether it was inserted.
+        //:
+        //: 3 The iterators traverse the pairs in order, forwards or backwards,
+        //:   and the modifiable iterators refer to the same pairs as the
+        //:   non-modifiable ones.
+        //:
+        //: 4 All memory comes from the allocator of the flat map, and no
+        //:   memory is leaked if an exception is thrown.
+        //:
+        //: 5 The type has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For each row of the table, insert the pairs of the row one at a
+        //:   time into a flat map and a model, in the presence of injected
+        //:   exceptions, and compare the results and the state of the flat map
+        //:   with those of the model using every accessor.  (C-1..4)
+        //:
+        //: 2 Verify the traits of the type.  (C-5)
+        //
+        // Testing:
+        //   flat_map(const C& comparator = C(), const A& allocator = A());
+        //   flat_map(const A& allocator);
+        //   ~flat_map();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   allocator_type get_allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type has the expected traits.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          "\n================================================"
+                          "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting default constructors.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const Obj W;
+            ASSERT(W.empty());
+            ASSERT(&da == W.get_allocator());
+
+            const Obj X(&oa);
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&oa == X.get_allocator());
+
+            const Obj Y(std::less<char>(), &oa);
+            ASSERT(Y.empty());
+            ASSERT(&oa == Y.get_allocator());
+            ASSERT(Y.key_comp()('A', 'B'));
+            ASSERT(Y.value_comp()(Value('A', 2), Value('B', 1)));
+            ASSERT(!Y.value_comp()(Value('A', 1), Value('A', 2)));
+            ASSERT(0 < Y.max_size());
+
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) printf("\nTesting 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model model(&sa);
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const Value VALUE(SPEC[i], i);
+
+                const bsl::pair<Model::iterator, bool> EXP = model.insert(
+                                 Model::value_type(VALUE.first, VALUE.second));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const Obj ORIGINAL(X, &sa);
+
+                    const bsl::pair<Obj::iterator, bool> R = mX.insert(VALUE);
+
+                    ASSERTV(LINE, i, EXP.second == R.second);
+                    ASSERTV(LINE, i, EXP.first->second == R.first->second);
+                    ASSERTV(LINE, i, bsl::distance(model.begin(), EXP.first)
+                                      == bsl::distance(mX.begin(), R.first));
+                    ASSERTV(LINE, i, EXP.second || ORIGINAL == X);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            ASSERTV(LINE, model.size() == X.size());
+            ASSERTV(LINE, model.empty() == X.empty());
+
+            ASSERTV(LINE, X.cbegin() == X.begin());
+            ASSERTV(LINE, X.cend() == X.end());
+            ASSERTV(LINE, X.crbegin() == X.rbegin());
+            ASSERTV(LINE, X.crend() == X.rend());
+            ASSERTV(LINE, X.begin() == mX.begin());
+            ASSERTV(LINE, X.end() == mX.end());
+            ASSERTV(LINE, X.rbegin() == Obj::const_reverse_iterator(
+                                                                mX.rbegin()));
+            ASSERTV(LINE, X.rend() == Obj::const_reverse_iterator(mX.rend()));
+            ASSERTV(LINE, static_cast<Obj::difference_type>(X.size())
+                                   == bsl::distance(X.rbegin(), X.rend()));
+            ASSERTV(LINE, (0 == X.size()) == (0 == oa.numBlocksInUse()));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a flat map of 'int' to 'int', insert a few pairs one at a
+        //:   time and as a range, search for some keys, and erase some keys.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::flat_map<int, int> IntMap;
+        typedef IntMap::value_type      IntPair;
+
+        IntMap mX;  const IntMap& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT(true  == mX.insert(IntPair(3, 30)).second);
+        ASSERT(true  == mX.insert(IntPair(1, 10)).second);
+        ASSERT(false == mX.insert(IntPair(3, 99)).second);
+        ASSERT(2  == X.size());
+        ASSERT(30 == X.at(3));
+
+        const IntPair VALUES[] = {
+            IntPair(5, 50), IntPair(2, 20), IntPair(4, 40), IntPair(1, 99)
+        };
+        mX.insert(VALUES, VALUES + 4);
+        ASSERT(5 == X.size());
+        for (int i = 0; i < 5; ++i) {
+            ASSERTV(i, X.begin()[i].first, i + 1 == X.begin()[i].first);
+            ASSERTV(i, X.begin()[i].second,
+                    10 * (i + 1) == X.begin()[i].second);
+        }
+
+        mX[6] = 60;
+        ++mX[1];
+        ASSERT(6  == X.size());
+        ASSERT(11 == X.at(1));
+
+        ASSERT(X.contains(4));
+        ASSERT(!X.contains(7));
+        ASSERT(X.begin() + 2 == X.find(3));
+        ASSERT(X.end()       == X.find(0));
+
+        ASSERT(1 == mX.erase(3));
+        ASSERT(0 == mX.erase(3));
+        ASSERT(5 == X.size());
+
+        IntMap mY(X);  const IntMap& Y = mY;
+        ASSERT(X == Y);
+        mY[7] = 70;
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::map'
+        //
+        // Concerns:
+        //: 1 Looking up keys in, and iterating over, a flat map is faster than
+        //:   in a 'bsl::map' holding the same pairs, and the flat map uses
+        //:   less memory.
+        //
+        // Plan:
+        //: 1 Create a 'bsl::map' and a flat map holding (by default) 1 million
+        //:   pairs of 'int' values having random keys, and report the time
+        //:   taken to build them, to look up each key in random order, and to
+        //:   iterate over the pairs, and the memory they use.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::map'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COMPARISON WITH 'bsl::map'"
+                            "\n=======================================\n");
+
+        typedef bsl::map<int, int>      IntMap;
+        typedef bsl::flat_map<int, int> IntFlatMap;
+        typedef bsl::pair<int, int>     IntPair;
+
+        const int NUM_VALUES = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 1000 * 1000;
+        const int NUM_PASSES = 10;
+
+        bslma::MallocFreeAllocator& ma =
+                                      bslma::MallocFreeAllocator::singleton();
+
+        bsl::vector<IntPair> values(&ma);
+        bsl::vector<int>     keys(&ma);
+        values.reserve(NUM_VALUES);
+        keys.reserve(NUM_VALUES);
+        srand(1);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const int key = rand();
+            values.push_back(IntPair(key, i));
+            keys.push_back(key);
+        }
+        std::random_shuffle(keys.begin(), keys.end());
+
+        printf("\t%d pairs\n", NUM_VALUES);
+
+        bsls::Stopwatch timer;
+        size_t          sum = 0;
+
+        {
+            IntMap mX(&ma);  const IntMap& X = mX;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(values[i]);
+            }
+            timer.stop();
+            printf("\tmap,      build one at a time: %8.3fs\n",
+                   timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                sum += X.find(keys[i])->second;
+            }
+            timer.stop();
+            printf("\tmap,      find:                %8.3fs\n",
+                   timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int pass = 0; pass < NUM_PASSES; ++pass) {
+                for (IntMap::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it) {
+                    sum += it->second;
+                }
+            }
+            timer.stop();
+            printf("\tmap,      iterate (%d passes): %8.3fs\n",
+                   NUM_PASSES,
+                   timer.elapsedTime());
+        }
+        {
+            timer.reset();
+            timer.start();
+            IntFlatMap mX(values.begin(),
+                          values.end(),
+                          std::less<int>(),
+                          &ma);
+            const IntFlatMap& X = mX;
+            timer.stop();
+            printf("\tflat_map, build by range:      %8.3fs\n",
+                   timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                sum += X.find(keys[i])->second;
+            }
+            timer.stop();
+            printf("\tflat_map, find:                %8.3fs\n",
+                   timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int pass = 0; pass < NUM_PASSES; ++pass) {
+                for (IntFlatMap::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it) {
+                    sum += it->second;
+                }
+            }
+            timer.stop();
+            printf("\tflat_map, iterate (%d passes): %8.3fs\n",
+                   NUM_PASSES,
+                   timer.elapsedTime());
+        }
+        benchmarkSink = sum;
+
+        {
+            bslma::TestAllocator ta("memory", veryVeryVeryVerbose);
+
+            {
+                const IntMap X(values.begin(),
+                               values.end(),
+                               std::less<int>(),
+                               &ta);
+                printf("\tmap,      memory: %10lld bytes in %lld blocks\n",
+                       ta.numBytesInUse(),
+                       ta.numBlocksInUse());
+            }
+            {
+                IntFlatMap mX(values.begin(),
+                              values.end(),
+                              std::less<int>(),
+                              &ta);
+                mX.shrink_to_fit();
+                printf("\tflat_map, memory: %10lld bytes in %lld blocks\n",
+                       ta.numBytesInUse(),
+                       ta.numBlocksInUse());
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
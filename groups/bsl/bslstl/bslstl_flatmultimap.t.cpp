@@ -0,0 +1,1211 @@
+// bslstl_flatmultimap.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_multimap.h>
+#include <bslstl_sortedtag.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapting a sorted 'bsl::vector',
+// whose algorithms are provided (and thoroughly tested) by
+// 'bslstl_flattreeutil'.  We therefore verify that each method of
+// 'flat_multimap' forwards to the appropriate algorithm, by comparing the
+// state of a 'flat_multimap' with that of a 'bsl::multimap' subjected to the
+// same operations, for each sequence of keys described in a table, and that
+// the allocator supplied at construction is used for all memory, in the
+// presence of injected exceptions where an operation allocates.  The mapped
+// value of each pair identifies the position of the pair in the sequence it
+// was created from, so that the relative order of pairs having equivalent
+// keys can be observed.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multimap(const C& comparator = C(), const A& alloc = A());
+// [ 2] flat_multimap(const A& allocator);
+// [ 4] flat_multimap(const flat_multimap& original);
+// [ 4] flat_multimap(const flat_multimap& original, const A& allocator);
+// [ 3] flat_multimap(ITER first, ITER last, const C& c, const A& a);
+// [ 3] flat_multimap(sorted_equivalent_t, ITER, ITER, const C&, A&);
+// [ 2] ~flat_multimap();
+//
+// MANIPULATORS
+// [ 4] flat_multimap& operator=(const flat_multimap& rhs);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] iterator insert(const value_type& value);
+// [ 5] iterator insert(const_iterator hint, const value_type& value);
+// [ 3] void insert(ITER first, ITER last);
+// [ 3] void insert(sorted_equivalent_t, ITER first, ITER last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(flat_multimap& other);
+// [ 5] void clear();
+// [ 5] void reserve(size_type numPairs);
+// [ 5] void shrink_to_fit();
+// [ 6] iterator find(const key_type& key);
+// [ 6] iterator lower_bound(const key_type& key);
+// [ 6] iterator upper_bound(const key_type& key);
+// [ 6] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 6] bool contains(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 5] size_type capacity() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 6] const_iterator find(const key_type& key) const;
+// [ 6] size_type count(const key_type& key) const;
+// [ 6] const_iterator lower_bound(const key_type& key) const;
+// [ 6] const_iterator upper_bound(const key_type& key) const;
+// [ 6] pair<const_iterator, const_iterator> equal_range(const key_type&);
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 4] bool operator!=(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 4] bool operator<(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 4] bool operator>(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 4] bool operator<=(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 4] bool operator>=(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 4] void swap(flat_multimap& a, flat_multimap& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 2] CONCERN: The type has the expected traits.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::flat_multimap<char, int>  Obj;
+typedef Obj::value_type                Value;
+typedef bsl::multimap<char, int>       Model;
+typedef bsl::vector<Value>             Vector;
+
+struct DefaultDataRow {
+    int         d_line;      // source line number
+    const char *d_spec;      // keys of the sequence, in order
+    bool        d_isSorted;  // 'true' if 'd_spec' is sorted
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  spec                 sorted
+    //----  -------------------  ------
+    { L_,   "",                  true  },
+    { L_,   "A",                 true  },
+    { L_,   "AA",                true  },
+    { L_,   "AB",                true  },
+    { L_,   "BA",                false },
+    { L_,   "ACE",               true  },
+    { L_,   "BDF",               true  },
+    { L_,   "ABB",               true  },
+    { L_,   "CAB",               false },
+    { L_,   "FGH",               true  },
+    { L_,   "ECAC",              false },
+    { L_,   "AACCC",             true  },
+    { L_,   "ABCDEFGH",          true  },
+    { L_,   "HGFEDCBA",          false },
+    { L_,   "DADBDCDD",          false },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool isEqual(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // key-value pairs as the specified 'model', and 'false' otherwise.
+{
+    if (object.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+    Model::const_iterator it = model.begin();
+    for (Obj::const_iterator jt = object.begin(); jt != object.end(); ++jt) {
+        if (jt->first != it->first || jt->second != it->second) {
+            return false;                                             // RETURN
+        }
+        ++it;
+    }
+    return true;
+}
+
+void load(Vector *result, const char *spec, int base = 0)
+    // Append to the specified 'result' a pair for each key of the specified
+    // 'spec', in order, whose mapped value is the position of the key in
+    // 'spec' plus the optionally specified 'base'.
+{
+    for (int i = 0; spec[i]; ++i) {
+        result->push_back(Value(spec[i], base + i));
+    }
+}
+
+void loadModel(Model *result, const char *spec, int base = 0)
+    // Insert into the specified 'result' a pair for each key of the specified
+    // 'spec', in order, whose mapped value is the position of the key in
+    // 'spec' plus the optionally specified 'base'.
+{
+    for (int i = 0; spec[i]; ++i) {
+        result->insert(Model::value_type(spec[i], base + i));
+    }
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: An Index of Trades by Instrument
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to index the trades of a day by the identifier of their
+// instrument, where the trades arrive in batches.
+//
+// First, we define the type of the index, mapping an instrument identifier to
+// a trade quantity:
+//..
+    typedef bsl::flat_multimap<int, int> TradeIndex;
+    typedef TradeIndex::value_type       Trade;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we load the first batch of trades, in the order they were executed:
+//..
+    const Trade BATCH1[] = { Trade(7, 100), Trade(3, 50), Trade(7, 200) };
+
+    bslma::TestAllocator allocator;
+    TradeIndex           index(BATCH1,
+                               BATCH1 + 3,
+                               std::less<int>(),
+                               &allocator);
+    ASSERT(3 == index.size());
+//..
+// Next, we merge the second batch, and observe that the trades of each
+// instrument are held in the order they were executed:
+//..
+    const Trade BATCH2[] = { Trade(3, 75), Trade(7, 300) };
+
+    index.insert(BATCH2, BATCH2 + 2);
+    ASSERT(5 == index.size());
+    ASSERT(3 == index.count(7));
+
+    bsl::pair<TradeIndex::const_iterator,
+              TradeIndex::const_iterator> trades = index.equal_range(7);
+    ASSERT(100 == trades.first->second);
+    ++trades.first;
+    ASSERT(200 == trades.first->second);
+    ++trades.first;
+    ASSERT(300 == trades.first->second);
+//..
+// Finally, we remove all the trades of instrument 3:
+//..
+    ASSERT(2 == index.erase(3));
+    ASSERT(3 == index.size());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCHES
+        //
+        // Concerns:
+        //: 1 Each search method returns the same position as the
+        //:   corresponding method of 'bsl::multimap', for keys present in the
+        //:   flat multimap, and for keys ordered before, between, and after
+        //:   them.
+        //:
+        //: 2 'find' returns the first of several pairs having the key.
+        //:
+        //: 3 'count' returns the number of pairs having the key, and
+        //:   'contains' whether there are any.
+        //:
+        //: 4 The manipulators return the same positions as the accessors.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a flat multimap and a model
+        //:   from the keys of the row, and for each key from '@' to 'I'
+        //:   compare the results of the searches, as offsets from 'begin'.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   bool contains(const key_type& key) const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCHES"
+                            "\n================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values;
+            load(&values, SPEC);
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+            Model model;
+            loadModel(&model, SPEC);
+            const Model& M = model;
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                const bool FOUND = M.end() != M.find(key);
+
+                ASSERTV(LINE, key, FOUND == X.contains(key));
+                ASSERTV(LINE, key, M.count(key) == X.count(key));
+
+                ASSERTV(LINE, key,
+                        bsl::distance(M.begin(), M.lower_bound(key))
+                              == bsl::distance(X.begin(), X.lower_bound(key)));
+                ASSERTV(LINE, key,
+                        bsl::distance(M.begin(), M.upper_bound(key))
+                              == bsl::distance(X.begin(), X.upper_bound(key)));
+                ASSERTV(LINE, key,
+                        (FOUND ? X.lower_bound(key) : X.end()) == X.find(key));
+
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                           X.equal_range(key);
+                ASSERTV(LINE, key, X.lower_bound(key) == R.first);
+                ASSERTV(LINE, key, X.upper_bound(key) == R.second);
+
+                const bsl::pair<Obj::iterator, Obj::iterator> MR =
+                                                          mX.equal_range(key);
+                ASSERTV(LINE, key, X.find(key)        == mX.find(key));
+                ASSERTV(LINE, key, X.lower_bound(key) == mX.lower_bound(key));
+                ASSERTV(LINE, key, X.upper_bound(key) == mX.upper_bound(key));
+                ASSERTV(LINE, key, R.first  == MR.first);
+                ASSERTV(LINE, key, R.second == MR.second);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING HINTED INSERT AND ERASE
+        //
+        // Concerns:
+        //: 1 Inserting with a hint inserts the pair immediately before the
+        //:   hint if the key of the pair may be held there, and after the
+        //:   pairs having an equivalent key otherwise, and returns an
+        //:   iterator to the inserted pair.
+        //:
+        //: 2 Each 'erase' overload removes the same pairs as the corresponding
+        //:   method of 'bsl::multimap', and returns the position following
+        //:   them.
+        //:
+        //: 3 'clear' removes all pairs, retaining the capacity, and 'reserve'
+        //:   and 'shrink_to_fit' change only the capacity.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, and each key from '@' to 'I', insert
+        //:   a pair into a copy of the flat multimap of the row with every
+        //:   possible hint, in the presence of injected exceptions, and
+        //:   verify the position of the inserted pair and that the other
+        //:   pairs are unchanged.  (C-1)
+        //:
+        //: 2 For each row of the table, erase each key, each position, and
+        //:   each range of positions of a copy of the flat multimap of the
+        //:   row, and compare with the model.  (C-2)
+        //:
+        //: 3 Call 'clear', 'reserve', and 'shrink_to_fit' and verify the size,
+        //:   capacity, and value.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        //   void reserve(size_type numPairs);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING HINTED INSERT AND ERASE"
+                            "\n===============================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting hinted 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+            const int SIZE = static_cast<int>(Y.size());
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                for (int hi = 0; hi <= SIZE; ++hi) {
+                    if (veryVerbose) { T_ P_(SPEC) P_(key) P(hi) }
+
+                    const bool VALID = (0 == hi
+                                          || Y.begin()[hi - 1].first <= key)
+                                    && (SIZE == hi
+                                          || key <= Y.begin()[hi].first);
+                    const int  EXP   = VALID
+                                     ? hi
+                                     : static_cast<int>(
+                                            Y.upper_bound(key) - Y.begin());
+
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE, key, hi, Y == X);
+
+                        Obj::iterator it = mX.insert(X.begin() + hi,
+                                                     Value(key, 99));
+                        ASSERTV(LINE, key, hi, X.begin() + EXP == it);
+                        ASSERTV(LINE, key, hi, key == it->first);
+                        ASSERTV(LINE, key, hi, 99  == it->second);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    mX.erase(X.begin() + EXP);
+                    ASSERTV(LINE, key, hi, Y == X);
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'erase'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+            const int SIZE = static_cast<int>(Y.size());
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                ASSERTV(LINE, key, model.erase(key) == mX.erase(key));
+                ASSERTV(LINE, key, isEqual(X, model));
+            }
+
+            for (int i = 0; i < SIZE; ++i) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                Model::iterator position = model.begin();
+                bsl::advance(position, i);
+                model.erase(position);
+
+                Obj::iterator it = mX.erase(X.begin() + i);
+                ASSERTV(LINE, i, X.begin() + i == it);
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            for (int i = 0; i <= SIZE; ++i) {
+                for (int j = i; j <= SIZE; ++j) {
+                    Obj   mX(Y, &oa);  const Obj& X = mX;
+                    Model model(&sa);
+                    loadModel(&model, SPEC);
+
+                    Model::iterator first = model.begin();
+                    bsl::advance(first, i);
+                    Model::iterator last = model.begin();
+                    bsl::advance(last, j);
+                    model.erase(first, last);
+
+                    Obj::iterator it = mX.erase(X.begin() + i, X.begin() + j);
+                    ASSERTV(LINE, i, j, X.begin() + i == it);
+                    ASSERTV(LINE, i, j, isEqual(X, model));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'clear', 'reserve', and "
+                            "'shrink_to_fit'.\n");
+        {
+            Vector values(&sa);
+            load(&values, "ACCG");
+
+            Obj mX(values.begin(), values.end(), std::less<char>(), &oa);
+            const Obj& X = mX;
+            const Obj  Y(X, &oa);
+
+            mX.reserve(100);
+            ASSERTV(X.capacity(), 100 <= X.capacity());
+            ASSERT(Y == X);
+
+            mX.shrink_to_fit();
+            ASSERTV(X.capacity(), 4 == X.capacity());
+            ASSERT(Y == X);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERTV(X.capacity(), 4 == X.capacity());
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Vector values(&sa);
+            load(&values, "AA");
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   allocator supplied, or the default allocator if none is.
+        //:
+        //: 2 Assignment gives the target the value of the source, which is
+        //:   unchanged.
+        //:
+        //: 3 Two flat multimaps compare equal if and only if they hold the
+        //:   same pairs in the same order, and are ordered lexicographically
+        //:   otherwise.
+        //:
+        //: 4 The member and free 'swap' functions exchange the values of two
+        //:   flat multimaps, without allocating if they use the same
+        //:   allocator.
+        //:
+        //: 5 No memory is leaked if an exception is thrown while copying.
+        //
+        // Plan:
+        //: 1 For each row of the table, copy a flat multimap holding the keys
+        //:   of the row, with and without an allocator, in the presence of
+        //:   injected exceptions.  (C-1, 5)
+        //:
+        //: 2 For each pair of rows of the table, create a flat multimap from
+        //:   each row, and compare them with each operator, checking the
+        //:   result against that of the model.  (C-3)
+        //:
+        //: 3 Assign and swap the flat multimaps, and verify their values and
+        //:   the use of memory.  (C-2, 4)
+        //
+        // Testing:
+        //   flat_multimap(const flat_multimap& original);
+        //   flat_multimap(const flat_multimap& original, const A& allocator);
+        //   flat_multimap& operator=(const flat_multimap& rhs);
+        //   void swap(flat_multimap& other);
+        //   bool operator==(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator!=(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator<(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator>(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator<=(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator>=(const flat_multimap& lhs, const flat_multimap&);
+        //   void swap(flat_multimap& a, flat_multimap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING VALUE-SEMANTIC OPERATIONS"
+                            "\n=================================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting copy constructors.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(Y, &oa);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &oa == X.get_allocator());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            {
+                const Obj X(Y);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &da == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting comparison, assignment, and swap.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            Vector values1(&sa);
+            load(&values1, SPEC1);
+
+            Model model1(&sa);
+            loadModel(&model1, SPEC1);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2 = DATA[tj].d_line;
+                const char *const SPEC2 = DATA[tj].d_spec;
+
+                if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+                Vector values2(&sa);
+                load(&values2, SPEC2);
+
+                Model model2(&sa);
+                loadModel(&model2, SPEC2);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(values1.begin(),
+                       values1.end(),
+                       std::less<char>(),
+                       &oa);
+                const Obj& X = mX;
+                Obj mY(values2.begin(),
+                       values2.end(),
+                       std::less<char>(),
+                       &oa);
+                const Obj& Y = mY;
+
+                ASSERTV(LINE1, LINE2, (model1 == model2) == (X == Y));
+                ASSERTV(LINE1, LINE2, (model1 != model2) == (X != Y));
+                ASSERTV(LINE1, LINE2, (model1 <  model2) == (X <  Y));
+                ASSERTV(LINE1, LINE2, (model1 >  model2) == (X >  Y));
+                ASSERTV(LINE1, LINE2, (model1 <= model2) == (X <= Y));
+                ASSERTV(LINE1, LINE2, (model1 >= model2) == (X >= Y));
+
+                const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+                mX.swap(mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model1));
+
+                swap(mX, mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model1));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, NUM_TOTAL == oa.numBlocksTotal());
+
+                Obj *mR = &(mX = Y);
+                ASSERTV(LINE1, LINE2, &X == mR);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, &oa == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting swap with different allocators.\n");
+        {
+            bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+            bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+            Vector values1(&sa);
+            load(&values1, "ACCE");
+            Vector values2(&sa);
+            load(&values2, "BD");
+
+            Obj mX(values1.begin(), values1.end(), std::less<char>(), &oa1);
+            const Obj& X = mX;
+            Obj mY(values2.begin(), values2.end(), std::less<char>(), &oa2);
+            const Obj& Y = mY;
+
+            const Obj XX(X, &sa), YY(Y, &sa);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+            ASSERT(&oa1 == X.get_allocator());
+            ASSERT(&oa2 == Y.get_allocator());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE CONSTRUCTORS AND RANGE 'insert'
+        //
+        // Concerns:
+        //: 1 A flat multimap created from, or inserted with, a range holds the
+        //:   same pairs as a 'bsl::multimap' created from, or inserted with,
+        //:   the same range; in particular, pairs having equivalent keys
+        //:   retain their relative order, after any already held.
+        //:
+        //: 2 The 'sorted_equivalent' overloads accept ranges sorted by
+        //:   (possibly equivalent) keys, and produce the same result as the
+        //:   other overloads.
+        //:
+        //: 3 All memory comes from the allocator of the flat multimap, and if
+        //:   an exception is thrown while inserting a range, the flat multimap
+        //:   is unchanged.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a flat multimap from the pairs
+        //:   of the row (using the 'sorted_equivalent' overload if the keys
+        //:   are sorted), and compare with the model.  (C-1..3)
+        //:
+        //: 2 For each pair of rows of the table, the first sorted, insert the
+        //:   pairs of the second row into a flat multimap created from the
+        //:   first in the presence of injected exceptions, verifying that the
+        //:   flat multimap is unchanged at the start of each attempt, and
+        //:   compare with the model.  (C-1..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for ranges that are not sorted.  (C-4)
+        //
+        // Testing:
+        //   flat_multimap(ITER first, ITER last, const C& c, const A& a);
+        //   flat_multimap(sorted_equivalent_t, ITER, ITER, const C&, A&);
+        //   void insert(ITER first, ITER last);
+        //   void insert(sorted_equivalent_t, ITER first, ITER last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING RANGE CONSTRUCTORS AND RANGE 'insert'"
+                            "\n============================================="
+                            "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting range constructors.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const bool        SORTED = DATA[ti].d_isSorted;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            Model model(&sa);
+            loadModel(&model, SPEC);
+
+            {
+                const Obj X(values.begin(),
+                            values.end(),
+                            std::less<char>(),
+                            &oa);
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, &oa == X.get_allocator());
+            }
+            if (SORTED) {
+                const Obj X(bsl::sorted_equivalent,
+                            values.begin(),
+                            values.end(),
+                            std::less<char>(),
+                            &oa);
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, &oa == X.get_allocator());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting range 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            if (!DATA[ti].d_isSorted) {
+                continue;
+            }
+
+            Vector values1(&sa);
+            load(&values1, SPEC1);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2   = DATA[tj].d_line;
+                const char *const SPEC2   = DATA[tj].d_spec;
+                const bool        SORTED2 = DATA[tj].d_isSorted;
+
+                Vector values2(&sa);
+                load(&values2, SPEC2, 100);
+
+                for (int sorted = 0; sorted < 2; ++sorted) {
+                    if (sorted && !SORTED2) {
+                        continue;
+                    }
+
+                    if (veryVerbose) { T_ P_(SPEC1) P_(SPEC2) P(sorted) }
+
+                    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                    Model model(&sa);
+                    loadModel(&model, SPEC1);
+                    loadModel(&model, SPEC2, 100);
+
+                    Obj mX(bsl::sorted_equivalent,
+                           values1.begin(),
+                           values1.end(),
+                           std::less<char>(),
+                           &oa);
+                    const Obj& X = mX;
+                    const Obj  ORIGINAL(X, &sa);
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE1, LINE2, sorted, ORIGINAL == X);
+
+                        if (sorted) {
+                            mX.insert(bsl::sorted_equivalent,
+                                      values2.begin(),
+                                      values2.end());
+                        }
+                        else {
+                            mX.insert(values2.begin(), values2.end());
+                        }
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(LINE1, LINE2, sorted, isEqual(X, model));
+                }
+            }
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Vector sorted(&sa);    load(&sorted,   "ABB");
+            Vector unsorted(&sa);  load(&unsorted, "BAC");
+
+            ASSERT_SAFE_PASS(Obj(bsl::sorted_equivalent,
+                                 sorted.begin(),
+                                 sorted.end()));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_equivalent,
+                                 unsorted.begin(),
+                                 unsorted.end()));
+
+            // The order of an inserted range is verified by
+            // 'bslstl::FlatTreeUtil'.
+
+            Obj mX;
+            ASSERT_SAFE_FAIL_RAW(mX.insert(bsl::sorted_equivalent,
+                                           unsorted.begin(),
+                                           unsorted.end()));
+            ASSERT_SAFE_PASS_RAW(mX.insert(bsl::sorted_equivalent,
+                                           sorted.begin(),
+                                           sorted.end()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed flat multimap is empty, and uses the
+        //:   allocator and comparator supplied, or default ones if none is.
+        //:
+        //: 2 Inserting a pair adds it after any pairs having an equivalent
+        //:   key, and returns an iterator to it.
+        //:
+        //: 3 The iterators traverse the pairs in order, forwards or backwards,
+        //:   and the modifiable iterators refer to the same pairs as the
+        //:   non-modifiable ones.
+        //:
+        //: 4 All memory comes from the allocator of the flat multimap, and no
+        //:   memory is leaked if an exception is thrown.
+        //:
+        //: 5 The type has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For each row of the table, insert the pairs of the row one at a
+        //:   time into a flat multimap and a model, in the presence of
+        //:   injected exceptions, and compare the results and the state of the
+        //:   flat multimap with those of the model using every accessor.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify the traits of the type.  (C-5)
+        //
+        // Testing:
+        //   flat_multimap(const C& comparator = C(), const A& alloc = A());
+        //   flat_multimap(const A& allocator);
+        //   ~flat_multimap();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   iterator insert(const value_type& value);
+        //   allocator_type get_allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type has the expected traits.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          "\n================================================"
+                          "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting default constructors.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const Obj W;
+            ASSERT(W.empty());
+            ASSERT(&da == W.get_allocator());
+
+            const Obj X(&oa);
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&oa == X.get_allocator());
+
+            const Obj Y(std::less<char>(), &oa);
+            ASSERT(Y.empty());
+            ASSERT(&oa == Y.get_allocator());
+            ASSERT(Y.key_comp()('A', 'B'));
+            ASSERT(Y.value_comp()(Value('A', 2), Value('B', 1)));
+            ASSERT(!Y.value_comp()(Value('A', 1), Value('A', 2)));
+            ASSERT(0 < Y.max_size());
+
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) printf("\nTesting 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model model(&sa);
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const Value VALUE(SPEC[i], i);
+
+                const Model::iterator EXP = model.insert(
+                                 Model::value_type(VALUE.first, VALUE.second));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const Obj ORIGINAL(X, &sa);
+
+                    const Obj::iterator R = mX.insert(VALUE);
+
+                    ASSERTV(LINE, i, VALUE == *R);
+                    ASSERTV(LINE, i, bsl::distance(model.begin(), EXP)
+                                         == bsl::distance(mX.begin(), R));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            ASSERTV(LINE, model.size() == X.size());
+            ASSERTV(LINE, model.empty() == X.empty());
+
+            ASSERTV(LINE, X.cbegin() == X.begin());
+            ASSERTV(LINE, X.cend() == X.end());
+            ASSERTV(LINE, X.crbegin() == X.rbegin());
+            ASSERTV(LINE, X.crend() == X.rend());
+            ASSERTV(LINE, X.begin() == mX.begin());
+            ASSERTV(LINE, X.end() == mX.end());
+            ASSERTV(LINE, X.rbegin() == Obj::const_reverse_iterator(
+                                                                mX.rbegin()));
+            ASSERTV(LINE, X.rend() == Obj::const_reverse_iterator(mX.rend()));
+            ASSERTV(LINE, static_cast<Obj::difference_type>(X.size())
+                                   == bsl::distance(X.rbegin(), X.rend()));
+            ASSERTV(LINE, (0 == X.size()) == (0 == oa.numBlocksInUse()));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a flat multimap of 'int' to 'int', insert a few pairs one
+        //:   at a time and as a range, search for some keys, and erase some
+        //:   keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::flat_multimap<int, int> IntMultimap;
+        typedef IntMultimap::value_type      IntPair;
+
+        IntMultimap mX;  const IntMultimap& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT(30 == mX.insert(IntPair(3, 30))->second);
+        ASSERT(10 == mX.insert(IntPair(1, 10))->second);
+        IntMultimap::iterator it = mX.insert(IntPair(3, 31));
+        ASSERT(X.begin() + 2 == it);
+        ASSERT(3 == X.size());
+        ASSERT(2 == X.count(3));
+
+        const IntPair VALUES[] = {
+            IntPair(5, 50), IntPair(2, 20), IntPair(3, 32), IntPair(1, 11)
+        };
+        mX.insert(VALUES, VALUES + 4);
+        ASSERT(7 == X.size());
+
+        const int EXP[][2] = {
+            { 1, 10 }, { 1, 11 }, { 2, 20 }, { 3, 30 }, { 3, 31 }, { 3, 32 },
+            { 5, 50 }
+        };
+        for (int i = 0; i < 7; ++i) {
+            ASSERTV(i, X.begin()[i].first,  EXP[i][0] == X.begin()[i].first);
+            ASSERTV(i, X.begin()[i].second, EXP[i][1] == X.begin()[i].second);
+        }
+
+        ASSERT(X.contains(5));
+        ASSERT(!X.contains(4));
+        ASSERT(X.begin() + 3 == X.find(3));
+        ASSERT(X.end()       == X.find(0));
+
+        ASSERT(3 == mX.erase(3));
+        ASSERT(0 == mX.erase(3));
+        ASSERT(4 == X.size());
+
+        IntMultimap mY(X);  const IntMultimap& Y = mY;
+        ASSERT(X == Y);
+        mY.insert(IntPair(5, 51));
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1212 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set of unique keys held in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_set: ordered set of unique keys held in contiguous storage
+//
+//@SEE_ALSO: bslstl_set, bslstl_flatmap, bslstl_flattreeutil
+//
+//@DESCRIPTION: This component defines a single class template, 'flat_set',
+// implementing a container holding an ordered sequence of unique keys, with
+// the interface of 'bsl::set', whose keys are held in a 'bsl::vector' sorted
+// by key rather than in a tree of nodes.  The interface follows the C++23
+// 'std::flat_set', except that the keys are held in a single (not
+// user-supplied) container, and that interfaces requiring C++11 language
+// features are omitted.
+//
+// An instantiation of 'flat_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'flat_set' contains.  The requirements on the 'KEY'
+// type are those of 'bsl::set' (see 'bslstl_set'), and in addition 'KEY' must
+// be copy-assignable.
+//
+///Choosing Between 'set' and 'flat_set'
+///-------------------------------------
+// A 'flat_set' holds its keys contiguously, without the per-key node
+// allocation and the three pointers and color of a 'bsl::set' node.  Looking
+// up a key is a binary search over contiguous memory, and iterating over the
+// keys a linear scan, both of which make much better use of the processor
+// caches than traversing the nodes of a tree.  On the other hand, inserting
+// or erasing a single key takes time linear in the number of keys following
+// it, and invalidates all iterators and references to the keys following it
+// (or to all keys, if the vector grows).  A 'flat_set' is therefore best
+// suited to sets that are built once (or in large batches) and then mostly
+// searched; batches of keys should be inserted by the range 'insert' method,
+// which merges the whole batch in a single pass.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a flat set's 'ALLOCATOR' template parameter determines
+// how that flat set will allocate memory, as for 'bsl::vector'.  If the
+// 'ALLOCATOR' is 'bsl::allocator' (the default), then objects of the flat set
+// type conform to the standard behavior of a 'bslma'-allocator-enabled type:
+// the flat set accepts an optional 'bslma::Allocator' argument at
+// construction, uses it to supply memory for its vector throughout its
+// lifetime, and supplies it to the constructors of the keys it holds if 'KEY'
+// has the 'bslma::UsesBslmaAllocator' trait.  In particular, each key inserted
+// into a flat set, even by a range 'insert', is created by the allocator of
+// the flat set, and no temporary copy of a key is made with another allocator.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_set':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the flat set
+//  'a', 'b'        - two distinct objects of type 'flat_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_set<K> a;    (default construction)           | O[1]               |
+//  | flat_set<K> a(al);                                 |                    |
+//  | flat_set<K> a(c, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(b); (copy construction)              | O[n]               |
+//  | flat_set<K> a(b, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(i1, i2);                             | O[N] if [i1, i2)   |
+//  | flat_set<K> a(i1, i2, c, al);                      | is sorted,         |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(sorted_unique, i1, i2);              | O[N]               |
+//  | flat_set<K> a(sorted_unique, i1, i2, c, al);       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_set<K>(); (destruction)                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;            (assignment)                     | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty(), a.capacity()                  | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k)                                        | O[n]               |
+//  | a.insert(p1, k)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)], |
+//  |                                                    | or O[N] if 'a' is  |
+//  |                                                    | empty, or [i1, i2) |
+//  |                                                    | is ordered after   |
+//  |                                                    | 'a', and sorted    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[n + N]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[n]               |
+//  | a.erase(k)                                         |                    |
+//  | a.erase(p1, p2)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(m), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.value_comp()                                     | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.contains(k)                           | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.count(k)                                         | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.upper_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: A Holiday Calendar
+///- - - - - - - - - - - - - - -
+// Suppose we want to determine whether a date is a business day, given a
+// calendar of holidays that is loaded once and then queried often.
+//
+// First, we define a class holding the holidays, represented (for the
+// purpose of this example) as 'int' values of the form 'YYYYMMDD', in a
+// 'bsl::flat_set':
+//..
+//  class HolidayCalendar {
+//      // This class provides a calendar of holidays.
+//
+//      // DATA
+//      bsl::flat_set<int> d_holidays;  // holidays, as 'YYYYMMDD' values
+//
+//    public:
+//      // CREATORS
+//      template <class INPUT_ITERATOR>
+//      HolidayCalendar(INPUT_ITERATOR    first,
+//                      INPUT_ITERATOR    last,
+//                      bslma::Allocator *basicAllocator = 0)
+//          // Create a calendar holding the holidays in the specified range
+//          // '[first, last)', in any order.  Optionally specify a
+//          // 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+//          // 0, the currently installed default allocator is used.
+//      : d_holidays(first, last, std::less<int>(), basicAllocator)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      template <class INPUT_ITERATOR>
+//      void addHolidays(INPUT_ITERATOR first, INPUT_ITERATOR last)
+//          // Add to this calendar the holidays in the specified range
+//          // '[first, last)', in any order.
+//      {
+//          d_holidays.insert(first, last);
+//      }
+//
+//      // ACCESSORS
+//      bool isHoliday(int date) const
+//          // Return 'true' if the specified 'date' is a holiday in this
+//          // calendar, and 'false' otherwise.
+//      {
+//          return d_holidays.contains(date);
+//      }
+//
+//      int numHolidays() const
+//          // Return the number of holidays in this calendar.
+//      {
+//          return static_cast<int>(d_holidays.size());
+//      }
+//  };
+//..
+// Then, we create a calendar from a list of holidays:
+//..
+//  const int HOLIDAYS[] = { 20131225, 20130101, 20130704, 20131128 };
+//
+//  bslma::TestAllocator  allocator;
+//  HolidayCalendar       calendar(HOLIDAYS, HOLIDAYS + 4, &allocator);
+//
+//  assert(4 == calendar.numHolidays());
+//  assert(true  == calendar.isHoliday(20130704));
+//  assert(false == calendar.isHoliday(20130705));
+//..
+// Finally, we add the holidays of the following year in a single batch, and
+// observe that the calendar holds all of them in a single block of memory:
+//..
+//  const int MORE_HOLIDAYS[] = { 20140101, 20140704, 20131225 };
+//
+//  calendar.addHolidays(MORE_HOLIDAYS, MORE_HOLIDAYS + 3);
+//
+//  assert(6 == calendar.numHolidays());
+//  assert(true == calendar.isHoliday(20140101));
+//  assert(1    == allocator.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATTREEUTIL
+#include <bslstl_flattreeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SORTEDTAG
+#include <bslstl_sortedtag.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'equal', 'lexicographical_compare'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                               // ==============
+                               // class flat_set
+                               // ==============
+
+template <class KEY,
+          class COMPARATOR  = std::less<KEY>,
+          class ALLOCATOR   = bsl::allocator<KEY> >
+class flat_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY') in a 'bsl::vector'.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY> KeyConfig;
+        // This 'typedef' is an alias for the policy extracting the key of a
+        // value held by this flat set, which is the value itself.
+
+    typedef BloombergLP::bslstl::FlatTreeUtil<KeyConfig>           Util;
+        // This 'typedef' is an alias for the utility implementing the
+        // algorithms of this flat set.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef bsl::vector<KEY, ALLOCATOR>                container_type;
+
+    typedef typename container_type::size_type         size_type;
+    typedef typename container_type::difference_type   difference_type;
+    typedef typename container_type::pointer           pointer;
+    typedef typename container_type::const_pointer     const_pointer;
+
+    typedef typename container_type::const_iterator    iterator;
+    typedef typename container_type::const_iterator    const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    container_type d_container;   // sorted keys
+    COMPARATOR     d_comparator;  // key comparator
+
+  public:
+    // CREATORS
+    explicit flat_set(const COMPARATOR& comparator = COMPARATOR(),
+                      const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct an empty flat set.  Optionally specify a 'comparator'
+        // used to order keys contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not supplied,
+        // a default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'allocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator' and
+        // 'allocator' is not supplied, the currently installed default
+        // allocator is used to supply memory.
+
+    explicit flat_set(const ALLOCATOR& allocator);
+        // Construct an empty flat set that will use the specified 'allocator'
+        // to supply memory.  Use a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' to order the keys contained
+        // in this flat set.  If the template parameter 'ALLOCATOR' argument is
+        // of type 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_set(const flat_set& original);
+        // Construct a flat set having the same value as the specified
+        // 'original'.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this flat set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible" (see {Requirements on
+        // 'KEY'} in 'bslstl_set').
+
+    flat_set(const flat_set& original, const ALLOCATOR& allocator);
+        // Construct a flat set having the same value as that of the specified
+        // 'original' that will use the specified 'allocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this flat set.  This method requires that the (template parameter)
+        // type 'KEY' be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a flat set, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element, ignoring those
+        // objects having a value equivalent to that which appears earlier in
+        // the sequence.  Optionally specify a 'comparator' used to order keys
+        // contained in this object, and an 'allocator' used to supply memory,
+        // as for the default constructor.  If the sequence is ordered
+        // according to 'comparator', this operation takes O[N] time, where N
+        // is the number of values in the sequence, and O[N * log(N)] time
+        // otherwise.  The (template parameter) type 'INPUT_ITERATOR' shall
+        // meet the requirements of an input iterator defined in the C++11
+        // standard [24.2.3] providing access to values of a type convertible
+        // to 'value_type'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a flat set holding the values in the sequence starting at
+        // the specified 'first' element, and ending immediately before the
+        // specified 'last' element, which must be unique and ordered according
+        // to the comparator of this flat set, in O[N] time, where N is the
+        // number of values in the sequence, without comparing the values
+        // (except to verify their order in safe build modes).  Optionally
+        // specify a 'comparator' used to order keys contained in this object,
+        // and an 'allocator' used to supply memory, as for the default
+        // constructor.  The (template parameter) type 'INPUT_ITERATOR' shall
+        // meet the requirements of an input iterator providing access to
+        // values of a type convertible to 'value_type'.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last', and each
+        // value in the sequence is ordered after the value preceding it.
+
+    ~flat_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_set& operator=(const flat_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // This method requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" and "copy-assignable".
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this flat set if a key equivalent
+        // to 'value' does not already exist in this flat set; otherwise, if a
+        // key equivalent to 'value' already exists in this flat set, this
+        // method has no effect.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) key in this
+        // flat set that is equivalent to 'value', and whose 'second' member
+        // is 'true' if a new key was inserted, and 'false' if the key was
+        // already present.  This operation takes time linear in the number of
+        // keys ordered after 'value', and invalidates the iterators and
+        // references to those keys (and to all keys, if the capacity of this
+        // flat set grows).  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible" and
+        // "copy-assignable".
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this flat set (in constant time
+        // plus the time to move the keys ordered after 'value', if the
+        // specified 'hint' is a valid immediate successor to 'value'), if a
+        // key equivalent to 'value' does not already exist in this flat set;
+        // otherwise, this method has no effect.  Return an iterator referring
+        // to the (possibly newly inserted) key in this flat set that is
+        // equivalent to 'value'.  If 'hint' is not a valid immediate
+        // successor to 'value', this operation requires O[log(N)] additional
+        // comparisons, where N is the size of this flat set.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this flat set.
+        // This method requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" and "copy-assignable".
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat set the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this flat set (nor equivalent to a value
+        // preceding it in the range).  The values are merged into this flat
+        // set in a single batch, in O[n + N * log(N)] time, where n is the
+        // size of this flat set and N the length of the range, or O[N] time if
+        // the range is ordered and this flat set is empty or holds only keys
+        // ordered before those of the range.  If an exception is thrown, this
+        // flat set is unchanged.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // providing access to values of a type convertible to 'value_type'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or
+        // before 'last'.  This method requires that the (template parameter)
+        // type 'KEY' be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat set the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this flat set, in O[n + N] time, where n is
+        // the size of this flat set and N the length of the range.  If an
+        // exception is thrown, this flat set is unchanged.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last', and each value in the sequence is ordered
+        // after the value preceding it.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible".
+
+    iterator erase(const_iterator position);
+        // Remove from this flat set the key at the specified 'position', and
+        // return an iterator referring to the key immediately following the
+        // removed key, or to the past-the-end position if the removed key was
+        // the last in the sequence.  The behavior is undefined unless
+        // 'position' refers to a key in this flat set.
+
+    size_type erase(const key_type& key);
+        // Remove from this flat set the key equivalent to the specified
+        // 'key', if such a key exists, and return 1; otherwise, if there is no
+        // key equivalent to 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this flat set the keys starting at the specified
+        // 'first' position up to, but not including the specified 'last'
+        // position, and return 'last'.  The behavior is undefined unless
+        // 'first' and 'last' either refer to keys in this flat set or are the
+        // 'end' iterator, and the 'first' position is at or before the 'last'
+        // position in the ordered sequence provided by this container.
+
+    void swap(flat_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if this object and 'other' use the same
+        // allocator (as for 'bsl::vector').
+
+    void clear();
+        // Remove all entries from this flat set.  Note that the flat set is
+        // empty after this call, but allocated memory may be retained for
+        // future use.
+
+    void reserve(size_type numKeys);
+        // Change the capacity of this flat set, so that it can hold at least
+        // the specified 'numKeys' without reallocating its storage.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this flat set to its size, releasing unused
+        // memory.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // flat set.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this flat set, or the 'end' iterator if this flat set
+        // is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this flat set.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this flat set, or 'rend' if this flat set is
+        // empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this flat set.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this flat set, or the 'cend' iterator if this flat
+        // set is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this flat set.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this flat set, or 'crend' if this flat set is
+        // empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this flat set.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this flat set contains a key equivalent to the
+        // specified 'key', and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this flat set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this flat set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this flat set could possibly hold.  Note that there is no
+        // guarantee that the flat set can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of elements this flat set can hold without
+        // reallocating its storage.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this flat set; if a comparator was supplied at construction, return
+        // its value, otherwise return a default constructed 'key_compare'
+        // object.  Note that this comparator compares objects of type 'KEY',
+        // which is the type of the 'value_type' objects contained by this
+        // flat set.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their keys using 'key_comp()'.  Note that since
+        // 'value_type' is an alias to 'KEY' for 'flat_set', this method
+        // returns the same functor as 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this flat set equivalent to the specified
+        // 'key', if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this flat set
+        // equivalent to the specified 'key'.  Note that since a flat set
+        // maintains unique keys, the returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this flat set greater
+        // than or equal to the specified 'key', and the past-the-end
+        // iterator if this flat set does not contain a 'value_type' object
+        // greater than or equal to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this flat set greater
+        // than the specified 'key', and the past-the-end iterator if this
+        // flat set does not contain a 'value_type' object greater than
+        // 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this flat set equivalent to the
+        // specified 'key', where the first iterator is positioned at the
+        // start of the sequence and the second is positioned one past the end
+        // of the sequence.  Note that since a flat set maintains unique keys,
+        // the range will contain at most one element.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_set' objects have the same
+    // value if they have the same number of keys, and each key in the ordered
+    // sequence of keys of one object is equal to the key at the same position
+    // in the other.  This method requires that the (template parameter) type
+    // 'KEY' be "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  This method requires that the
+    // (template parameter) type 'KEY' be "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically less than that of the specified 'rhs' flat set, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically greater than that of the specified 'rhs' flat set,
+    // and 'false' otherwise.  This method requires that 'operator<', inducing
+    // a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // flat set, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // flat set, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  This method
+    // provides the no-throw exception-safety guarantee if 'a' and 'b' use the
+    // same allocator.
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                               // --------------
+                               // class flat_set
+                               // --------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const COMPARATOR& comparator,
+                                               const ALLOCATOR&  allocator)
+: d_container(allocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const ALLOCATOR& allocator)
+: d_container(allocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const flat_set& original)
+: d_container(original.d_container)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const flat_set&  original,
+                                               const ALLOCATOR& allocator)
+: d_container(original.d_container, allocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(INPUT_ITERATOR    first,
+                                               INPUT_ITERATOR    last,
+                                               const COMPARATOR& comparator,
+                                               const ALLOCATOR&  allocator)
+: d_container(allocator)
+, d_comparator(comparator)
+{
+    Util::insertRange(&d_container, first, last, d_comparator, true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(sorted_unique_t,
+                                               INPUT_ITERATOR    first,
+                                               INPUT_ITERATOR    last,
+                                               const COMPARATOR& comparator,
+                                               const ALLOCATOR&  allocator)
+: d_container(first, last, allocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSorted(d_container.begin(),
+                                    d_container.end(),
+                                    d_comparator,
+                                    true));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::~flat_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_set& rhs)
+{
+    d_container  = rhs.d_container;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const_iterator position = Util::lowerBound(d_container.cbegin(),
+                                               d_container.cend(),
+                                               value,
+                                               d_comparator);
+    if (position != d_container.cend() && !d_comparator(value, *position)) {
+        return pair<iterator, bool>(position, false);                 // RETURN
+    }
+    return pair<iterator, bool>(d_container.insert(position, value), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                             const value_type& value)
+{
+    if ((hint == d_container.cbegin() || d_comparator(*(hint - 1), value))
+     && (hint == d_container.cend()   || d_comparator(value, *hint))) {
+        return d_container.insert(hint, value);                       // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    Util::insertRange(&d_container, first, last, d_comparator, true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                  INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    Util::insertSortedRange(&d_container, first, last, d_comparator, true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_container.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_container.erase(position);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_container.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::swap(flat_set& other)
+{
+    d_container.swap(other.d_container);
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_container.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numKeys)
+{
+    d_container.reserve(numKeys);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_container.shrink_to_fit();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_container.get_allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_container.cbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_container.cend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_container.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_container.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_container.max_size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_container.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return Util::find(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != end() ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return Util::lowerBound(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return Util::upperBound(begin(), end(), key, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator first = lower_bound(key);
+    const_iterator last  = first;
+    if (last != end() && !d_comparator(key, *last)) {
+        ++last;
+    }
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+                                // ===========
+                                // TYPE TRAITS
+                                // ===========
+
+// Type traits for flat sets:
+//: o A flat set defines STL iterators.
+//: o A flat set uses 'bslma' allocators if the parameterized 'ALLOCATOR' is
+//:     convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <typename KEY,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct HasStlIterators<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <typename KEY,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
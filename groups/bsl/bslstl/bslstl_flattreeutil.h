@@ -0,0 +1,610 @@
+// bslstl_flattreeutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREEUTIL
+#define INCLUDED_BSLSTL_FLATTREEUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide algorithms to maintain a sorted vector of values.
+//
+//@CLASSES:
+//  bslstl::FlatTreeUtil: namespace for sorted-vector algorithms
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatmultimap, bslstl_flatset
+//
+//@DESCRIPTION: This component provides a 'struct' template,
+// 'bslstl::FlatTreeUtil', serving as a namespace for the algorithms used to
+// implement the "flat" associative containers ('bsl::flat_map',
+// 'bsl::flat_multimap', and 'bsl::flat_set'), which hold their values in a
+// 'bsl::vector' sorted by key rather than in a tree of nodes.
+//
+// The values held by the vector are ordered by the keys extracted from them
+// by the (template parameter) type 'KEY_CONFIG', which must provide the same
+// interface as 'bslstl::UnorderedMapKeyConfiguration' (for values that are
+// 'pair' objects holding a key and a mapped value) and
+// 'bslstl::UnorderedSetKeyConfiguration' (for values that are their own
+// keys):
+//..
+//  typedef ... ValueType;  // type of the values held by the vector
+//  typedef ... KeyType;    // type of the keys ordering those values
+//
+//  static const KeyType& extractKey(const ValueType& value);
+//..
+// The keys are compared with a functor (or function pointer), supplied to
+// each algorithm, that can be called as if it had the following signature:
+//..
+//  bool operator()(const KeyType& lhs, const KeyType& rhs);
+//..
+//
+///Searching
+///---------
+// 'lowerBound', 'upperBound', and 'find' perform a binary search, requiring
+// O[log(N)] comparisons for a sequence of length N.
+//
+///Inserting a Range
+///-----------------
+// 'insertRange' inserts a sequence of values, in any order, into a vector in
+// a single batch, requiring O[N + M * log(M)] operations to insert M values
+// into a vector of N values (rather than the O[M * N] operations required to
+// insert the values one at a time).  The values to insert are first copied
+// into a new vector, then ordered by sorting an array of pointers to them
+// (unless they are found to be ordered already), so that no temporary copy of
+// a value is made, and finally merged with the values of the vector into a
+// third vector, which replaces the original one.  Each value held by the
+// resulting vector is therefore created by the allocator of the vector.  The
+// insertion provides the strong exception-safety guarantee.
+//
+// When the values to insert are known to be sorted, 'insertSortedRange'
+// avoids the sort.  Two cases commonly arising when loading data, which
+// 'insertRange' detects as well, take linear time in the number of values
+// inserted: inserting into an empty vector, and inserting values ordered after
+// the values already held by the vector.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Maintaining a Sorted Vector of Pairs
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain a table of tick sizes, mapping the lowest price
+// of each band to the tick size of that band, in a sorted vector.
+//
+// First, we define the type of the table, and of the key configuration
+// extracting a price from an element of the table:
+//..
+//  typedef bsl::pair<int, int>                                  Band;
+//  typedef bsl::vector<Band>                                    Table;
+//  typedef bslstl::UnorderedMapKeyConfiguration<Band>           BandConfig;
+//  typedef bslstl::FlatTreeUtil<BandConfig>                     BandUtil;
+//..
+// Then, we insert a batch of bands, in no particular order, into an empty
+// table:
+//..
+//  Table          table;
+//  std::less<int> comparator;
+//
+//  const Band BANDS[] = { Band(1000, 5), Band(0, 1), Band(100, 2) };
+//
+//  BandUtil::insertRange(&table, BANDS, BANDS + 3, comparator, true);
+//  assert(3    == table.size());
+//  assert(0    == table[0].first);
+//  assert(100  == table[1].first);
+//  assert(1000 == table[2].first);
+//..
+// Next, we insert a second batch, holding a band whose price is already in
+// the table, and observe that the value already held is retained:
+//..
+//  const Band MORE_BANDS[] = { Band(500, 3), Band(100, 99) };
+//
+//  BandUtil::insertRange(&table,
+//                        MORE_BANDS,
+//                        MORE_BANDS + 2,
+//                        comparator,
+//                        true);
+//  assert(4 == table.size());
+//  assert(2 == table[1].second);
+//  assert(3 == table[2].second);
+//..
+// Finally, we look up the tick size for a price of 750, by finding the last
+// band whose lowest price is not greater than 750:
+//..
+//  const Band *band = BandUtil::upperBound(table.data(),
+//                                          table.data() + table.size(),
+//                                          750,
+//                                          comparator);
+//  assert(table.data() != band);
+//  assert(3 == (band - 1)->second);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'sort'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                      // ================================
+                      // class FlatTreeUtil_PtrComparator
+                      // ================================
+
+template <class KEY_CONFIG, class COMPARATOR>
+class FlatTreeUtil_PtrComparator {
+    // This class provides a functor comparing two pointers to values of the
+    // type 'KEY_CONFIG::ValueType' by the keys of the values they address,
+    // using a comparator of the (template parameter) type 'COMPARATOR', and
+    // ordering pointers to values having equivalent keys by address.  This
+    // class is an implementation detail of 'FlatTreeUtil', and should not be
+    // used outside of this component.
+
+    // PRIVATE TYPES
+    typedef typename KEY_CONFIG::ValueType ValueType;
+
+    // DATA
+    COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatTreeUtil_PtrComparator(COMPARATOR *comparator);
+        // Create a functor comparing keys using the specified 'comparator'.
+
+    // ACCESSORS
+    bool operator()(const ValueType *lhs, const ValueType *rhs) const;
+        // Return 'true' if the key of the specified '*lhs' value is ordered
+        // before the key of the specified '*rhs' value, or if the keys are
+        // equivalent and 'lhs < rhs', and 'false' otherwise.
+};
+
+                            // ===================
+                            // struct FlatTreeUtil
+                            // ===================
+
+template <class KEY_CONFIG>
+struct FlatTreeUtil {
+    // This 'struct' provides a namespace for algorithms maintaining a vector
+    // of values of the type 'KEY_CONFIG::ValueType', sorted by the keys (of
+    // the type 'KEY_CONFIG::KeyType') extracted from them by the (template
+    // parameter) type 'KEY_CONFIG'.  The 'COMPARATOR' type of each algorithm
+    // shall be a functor (or function pointer) providing a strict weak
+    // ordering on keys.
+
+    // TYPES
+    typedef typename KEY_CONFIG::ValueType ValueType;
+        // This 'typedef' is an alias for the type of the values held by the
+        // vectors maintained by this utility.
+
+    typedef typename KEY_CONFIG::KeyType   KeyType;
+        // This 'typedef' is an alias for the type of the keys ordering those
+        // values.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class ALLOCATOR, class COMPARATOR>
+    static void mergeValues(bsl::vector<ValueType, ALLOCATOR> *container,
+                            bsl::vector<ValueType, ALLOCATOR> *values,
+                            COMPARATOR&                        comparator,
+                            bool                               uniqueFlag,
+                            bool                               sortedFlag);
+        // Insert into the specified 'container' the values held by the
+        // specified 'values', ordering them with the specified 'comparator'.
+        // If the specified 'uniqueFlag' is 'true', insert only the values
+        // whose key is not equivalent to the key of a value already held by
+        // 'container', or of a value preceding it in 'values'.  If the
+        // specified 'sortedFlag' is 'true', the values are known to be sorted
+        // (and have unique keys if 'uniqueFlag' is 'true').  'values' may be
+        // left with any value.  The behavior is undefined unless 'container'
+        // is sorted (and holds values having unique keys if 'uniqueFlag' is
+        // 'true'), and 'values' uses the same allocator as 'container'.
+
+  public:
+    // CLASS METHODS
+    template <class ITERATOR, class COMPARATOR>
+    static ITERATOR lowerBound(ITERATOR       first,
+                               ITERATOR       last,
+                               const KeyType& key,
+                               COMPARATOR&    comparator);
+        // Return the position of the first value in the sorted sequence
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position whose key is not ordered before
+        // the specified 'key' by the specified 'comparator', or 'last' if
+        // there is no such value.  The behavior is undefined unless the
+        // sequence is sorted by 'comparator', and 'ITERATOR' is a random
+        // access iterator to 'ValueType'.
+
+    template <class ITERATOR, class COMPARATOR>
+    static ITERATOR upperBound(ITERATOR       first,
+                               ITERATOR       last,
+                               const KeyType& key,
+                               COMPARATOR&    comparator);
+        // Return the position of the first value in the sorted sequence
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position whose key is ordered after the
+        // specified 'key' by the specified 'comparator', or 'last' if there is
+        // no such value.  The behavior is undefined unless the sequence is
+        // sorted by 'comparator', and 'ITERATOR' is a random access iterator
+        // to 'ValueType'.
+
+    template <class ITERATOR, class COMPARATOR>
+    static ITERATOR find(ITERATOR       first,
+                         ITERATOR       last,
+                         const KeyType& key,
+                         COMPARATOR&    comparator);
+        // Return the position of the first value in the sorted sequence
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position whose key is equivalent to the
+        // specified 'key' according to the specified 'comparator', or 'last'
+        // if there is no such value.  The behavior is undefined unless the
+        // sequence is sorted by 'comparator', and 'ITERATOR' is a random
+        // access iterator to 'ValueType'.
+
+    template <class ITERATOR, class COMPARATOR>
+    static bool isSorted(ITERATOR    first,
+                         ITERATOR    last,
+                         COMPARATOR& comparator,
+                         bool        uniqueFlag);
+        // Return 'true' if the keys of the values in the sequence starting at
+        // the specified 'first' position and ending immediately before the
+        // specified 'last' position are sorted by the specified 'comparator'
+        // (i.e., no key is ordered before the key preceding it) and, if the
+        // specified 'uniqueFlag' is 'true', unique (i.e., each key is ordered
+        // after the key preceding it), and 'false' otherwise.  'ITERATOR'
+        // shall be a forward iterator to 'ValueType'.
+
+    template <class ALLOCATOR, class INPUT_ITERATOR, class COMPARATOR>
+    static void insertRange(bsl::vector<ValueType, ALLOCATOR> *container,
+                            INPUT_ITERATOR                     first,
+                            INPUT_ITERATOR                     last,
+                            COMPARATOR&                        comparator,
+                            bool                               uniqueFlag);
+        // Insert into the specified 'container', sorted by the specified
+        // 'comparator', the values in the sequence starting at the specified
+        // 'first' position and ending immediately before the specified 'last'
+        // position, in any order, so that 'container' remains sorted.  If the
+        // specified 'uniqueFlag' is 'true', insert only the values whose key
+        // is not equivalent to the key of a value held by 'container' or of a
+        // value preceding it in the sequence.  Values having keys equivalent
+        // to the key of a value held by 'container' are placed after that
+        // value, and values having equivalent keys retain their relative
+        // order.  This operation requires O[N + M * log(M)] operations, where
+        // N is the length of 'container' and M the length of the sequence,
+        // and O[M] operations if 'container' is empty or the keys of the
+        // values in the sequence are ordered after the keys of the values in
+        // 'container', and the values are already sorted.  If an exception is
+        // thrown, 'container' is unchanged.  The behavior is undefined unless
+        // 'container' is sorted by 'comparator' (and holds values having
+        // unique keys if 'uniqueFlag' is 'true'), and 'INPUT_ITERATOR' is an
+        // input iterator to values convertible to 'ValueType'.  Note that each
+        // value inserted is created by the allocator of 'container'.
+
+    template <class ALLOCATOR, class INPUT_ITERATOR, class COMPARATOR>
+    static void insertSortedRange(
+                                bsl::vector<ValueType, ALLOCATOR> *container,
+                                INPUT_ITERATOR                     first,
+                                INPUT_ITERATOR                     last,
+                                COMPARATOR&                        comparator,
+                                bool                               uniqueFlag);
+        // Insert into the specified 'container', sorted by the specified
+        // 'comparator', the values in the sorted sequence starting at the
+        // specified 'first' position and ending immediately before the
+        // specified 'last' position, so that 'container' remains sorted.  If
+        // the specified 'uniqueFlag' is 'true', insert only the values whose
+        // key is not equivalent to the key of a value held by 'container'.
+        // Values having keys equivalent to the key of a value held by
+        // 'container' are placed after that value.  This operation requires
+        // O[N + M] operations, where N is the length of 'container' and M the
+        // length of the sequence, and O[M] operations if 'container' is empty
+        // or the keys of the values in the sequence are ordered after the keys
+        // of the values in 'container'.  If an exception is thrown,
+        // 'container' is unchanged.  The behavior is undefined unless
+        // 'container' and the sequence are sorted by 'comparator' (and hold
+        // values having unique keys if 'uniqueFlag' is 'true'), and
+        // 'INPUT_ITERATOR' is an input iterator to values convertible to
+        // 'ValueType'.  Note that each value inserted is created by the
+        // allocator of 'container'.
+};
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                      // --------------------------------
+                      // class FlatTreeUtil_PtrComparator
+                      // --------------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+FlatTreeUtil_PtrComparator<KEY_CONFIG, COMPARATOR>::FlatTreeUtil_PtrComparator(
+                                                        COMPARATOR *comparator)
+: d_comparator_p(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+bool FlatTreeUtil_PtrComparator<KEY_CONFIG, COMPARATOR>::operator()(
+                                                  const ValueType *lhs,
+                                                  const ValueType *rhs) const
+{
+    if ((*d_comparator_p)(KEY_CONFIG::extractKey(*lhs),
+                          KEY_CONFIG::extractKey(*rhs))) {
+        return true;                                                  // RETURN
+    }
+    return lhs < rhs && !(*d_comparator_p)(KEY_CONFIG::extractKey(*rhs),
+                                           KEY_CONFIG::extractKey(*lhs));
+}
+
+                            // -------------------
+                            // struct FlatTreeUtil
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG>
+template <class ALLOCATOR, class COMPARATOR>
+void FlatTreeUtil<KEY_CONFIG>::mergeValues(
+                                bsl::vector<ValueType, ALLOCATOR> *container,
+                                bsl::vector<ValueType, ALLOCATOR> *values,
+                                COMPARATOR&                        comparator,
+                                bool                               uniqueFlag,
+                                bool                               sortedFlag)
+{
+    typedef bsl::vector<ValueType, ALLOCATOR> Vector;
+
+    typedef typename ALLOCATOR::template rebind<const ValueType *>::other
+                                                              PointerAllocator;
+
+    if (values->empty()) {
+        return;                                                       // RETURN
+    }
+
+    if (!sortedFlag) {
+        sortedFlag = isSorted(values->begin(),
+                              values->end(),
+                              comparator,
+                              uniqueFlag);
+    }
+
+    if (sortedFlag) {
+        if (container->empty()) {
+            container->swap(*values);
+            return;                                                   // RETURN
+        }
+        if (comparator(KEY_CONFIG::extractKey(container->back()),
+                       KEY_CONFIG::extractKey(values->front()))) {
+            container->insert(container->end(),
+                              values->begin(),
+                              values->end());
+            return;                                                   // RETURN
+        }
+    }
+
+    // Order the values to insert through an array of pointers, so that the
+    // values themselves are never copied (nor assigned) before being merged.
+
+    bsl::vector<const ValueType *, PointerAllocator> order(
+                               PointerAllocator(container->get_allocator()));
+    order.reserve(values->size());
+    for (typename Vector::const_iterator it = values->begin();
+         it != values->end();
+         ++it) {
+        order.push_back(&*it);
+    }
+    if (!sortedFlag) {
+        std::sort(order.begin(),
+                  order.end(),
+                  FlatTreeUtil_PtrComparator<KEY_CONFIG, COMPARATOR>(
+                                                                &comparator));
+    }
+
+    Vector result(container->get_allocator());
+    result.reserve(container->size() + values->size());
+
+    typename Vector::const_iterator current = container->begin();
+    typename Vector::const_iterator end     = container->end();
+
+    for (typename bsl::vector<const ValueType *,
+                              PointerAllocator>::const_iterator it =
+                                                                order.begin();
+         it != order.end();
+         ++it) {
+        const KeyType& key = KEY_CONFIG::extractKey(**it);
+
+        // Copy the values held by 'container' that are not ordered after the
+        // value to insert.
+
+        while (current != end
+            && !comparator(key, KEY_CONFIG::extractKey(*current))) {
+            result.push_back(*current);
+            ++current;
+        }
+
+        if (uniqueFlag
+         && !result.empty()
+         && !comparator(KEY_CONFIG::extractKey(result.back()), key)) {
+            continue;
+        }
+        result.push_back(**it);
+    }
+    result.insert(result.end(), current, end);
+
+    container->swap(result);
+}
+
+// CLASS METHODS
+template <class KEY_CONFIG>
+template <class ITERATOR, class COMPARATOR>
+ITERATOR FlatTreeUtil<KEY_CONFIG>::lowerBound(ITERATOR       first,
+                                              ITERATOR       last,
+                                              const KeyType& key,
+                                              COMPARATOR&    comparator)
+{
+    std::ptrdiff_t length = last - first;
+
+    while (0 < length) {
+        const std::ptrdiff_t half   = length / 2;
+        ITERATOR             middle = first + half;
+
+        if (comparator(KEY_CONFIG::extractKey(*middle), key)) {
+            first   = middle + 1;
+            length -= half + 1;
+        }
+        else {
+            length  = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG>
+template <class ITERATOR, class COMPARATOR>
+ITERATOR FlatTreeUtil<KEY_CONFIG>::upperBound(ITERATOR       first,
+                                              ITERATOR       last,
+                                              const KeyType& key,
+                                              COMPARATOR&    comparator)
+{
+    std::ptrdiff_t length = last - first;
+
+    while (0 < length) {
+        const std::ptrdiff_t half   = length / 2;
+        ITERATOR             middle = first + half;
+
+        if (!comparator(key, KEY_CONFIG::extractKey(*middle))) {
+            first   = middle + 1;
+            length -= half + 1;
+        }
+        else {
+            length  = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG>
+template <class ITERATOR, class COMPARATOR>
+inline
+ITERATOR FlatTreeUtil<KEY_CONFIG>::find(ITERATOR       first,
+                                        ITERATOR       last,
+                                        const KeyType& key,
+                                        COMPARATOR&    comparator)
+{
+    ITERATOR position = lowerBound(first, last, key, comparator);
+    return position == last
+        || comparator(key, KEY_CONFIG::extractKey(*position))
+           ? last
+           : position;
+}
+
+template <class KEY_CONFIG>
+template <class ITERATOR, class COMPARATOR>
+bool FlatTreeUtil<KEY_CONFIG>::isSorted(ITERATOR    first,
+                                        ITERATOR    last,
+                                        COMPARATOR& comparator,
+                                        bool        uniqueFlag)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    ITERATOR previous = first;
+    for (++first; first != last; ++first, ++previous) {
+        const KeyType& previousKey = KEY_CONFIG::extractKey(*previous);
+        const KeyType& key         = KEY_CONFIG::extractKey(*first);
+
+        if (uniqueFlag ? !comparator(previousKey, key)
+                       : comparator(key, previousKey)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_CONFIG>
+template <class ALLOCATOR, class INPUT_ITERATOR, class COMPARATOR>
+inline
+void FlatTreeUtil<KEY_CONFIG>::insertRange(
+                                bsl::vector<ValueType, ALLOCATOR> *container,
+                                INPUT_ITERATOR                     first,
+                                INPUT_ITERATOR                     last,
+                                COMPARATOR&                        comparator,
+                                bool                               uniqueFlag)
+{
+    BSLS_ASSERT_SAFE(container);
+
+    bsl::vector<ValueType, ALLOCATOR> values(first,
+                                             last,
+                                             container->get_allocator());
+    mergeValues(container, &values, comparator, uniqueFlag, false);
+}
+
+template <class KEY_CONFIG>
+template <class ALLOCATOR, class INPUT_ITERATOR, class COMPARATOR>
+inline
+void FlatTreeUtil<KEY_CONFIG>::insertSortedRange(
+                                bsl::vector<ValueType, ALLOCATOR> *container,
+                                INPUT_ITERATOR                     first,
+                                INPUT_ITERATOR                     last,
+                                COMPARATOR&                        comparator,
+                                bool                               uniqueFlag)
+{
+    BSLS_ASSERT_SAFE(container);
+
+    bsl::vector<ValueType, ALLOCATOR> values(first,
+                                             last,
+                                             container->get_allocator());
+
+    BSLS_ASSERT_SAFE(isSorted(values.begin(),
+                              values.end(),
+                              comparator,
+                              uniqueFlag));
+
+    mergeValues(container, &values, comparator, uniqueFlag, true);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
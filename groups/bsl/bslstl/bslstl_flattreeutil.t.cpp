@@ -0,0 +1,842 @@
+// bslstl_flattreeutil.t.cpp                                          -*-C++-*-
+#include <bslstl_flattreeutil.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility of algorithms on sorted vectors.  The
+// search algorithms are verified against a linear search over every sorted
+// sequence described in a table, for every key.  The insertion algorithms are
+// verified against a model inserting the values one at a time, for every pair
+// of rows of a table of sequences, with values identifying their position in
+// their sequence so that the stability of the insertion can be observed.
+// Insertions are performed in the presence of injected exceptions to verify
+// the strong exception-safety guarantee.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] ITERATOR lowerBound(ITERATOR, ITERATOR, const KeyType&, COMP&);
+// [ 2] ITERATOR upperBound(ITERATOR, ITERATOR, const KeyType&, COMP&);
+// [ 2] ITERATOR find(ITERATOR, ITERATOR, const KeyType&, COMP&);
+// [ 3] bool isSorted(ITERATOR, ITERATOR, COMP&, bool);
+// [ 4] void insertRange(vector *, ITER, ITER, COMP&, bool);
+// [ 5] void insertSortedRange(vector *, ITER, ITER, COMP&, bool);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::pair<char, int>                          Value;
+    // A value whose key is a letter, and whose mapped value identifies the
+    // position of the value in the sequence it was created from.
+
+typedef bslstl::UnorderedMapKeyConfiguration<Value>   KeyConfig;
+typedef bslstl::FlatTreeUtil<KeyConfig>               Util;
+typedef bsl::vector<Value>                            Vector;
+
+typedef bslstl::UnorderedSetKeyConfiguration<int>     IntKeyConfig;
+typedef bslstl::FlatTreeUtil<IntKeyConfig>            IntUtil;
+
+struct DefaultDataRow {
+    int         d_line;      // source line number
+    const char *d_spec;      // keys of the sequence, in order
+    bool        d_isSorted;  // 'true' if 'd_spec' is sorted
+    bool        d_isUnique;  // 'true' if 'd_spec' is sorted and unique
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  spec                 sorted  unique
+    //----  -------------------  ------  ------
+    { L_,   "",                  true,   true  },
+    { L_,   "A",                 true,   true  },
+    { L_,   "AA",                true,   false },
+    { L_,   "AB",                true,   true  },
+    { L_,   "BA",                false,  false },
+    { L_,   "ACE",               true,   true  },
+    { L_,   "BDF",               true,   true  },
+    { L_,   "ABB",               true,   false },
+    { L_,   "CAB",               false,  false },
+    { L_,   "FGH",               true,   true  },
+    { L_,   "AACE",              true,   false },
+    { L_,   "ECAC",              false,  false },
+    { L_,   "BBBB",              true,   false },
+    { L_,   "ABCDEFGH",          true,   true  },
+    { L_,   "HGFEDCBA",          false,  false },
+    { L_,   "DADBDCDD",          false,  false },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                             // ==================
+                             // class CountingLess
+                             // ==================
+
+class CountingLess {
+    // This class provides a comparator of 'char' keys counting the number of
+    // comparisons it performs.  Note that the function-call operator is not
+    // 'const', to verify that the algorithms accept such comparators.
+
+    // DATA
+    int d_count;  // number of comparisons performed
+
+  public:
+    // CREATORS
+    CountingLess() : d_count(0) {}
+        // Create a comparator having performed no comparisons.
+
+    // MANIPULATORS
+    bool operator()(char lhs, char rhs)
+        // Return 'lhs < rhs', and increment the count of comparisons.
+    {
+        ++d_count;
+        return lhs < rhs;
+    }
+
+    // ACCESSORS
+    int count() const { return d_count; }
+        // Return the number of comparisons performed by this object.
+};
+
+void load(Vector *result, const char *spec, int base = 0)
+    // Append to the specified 'result' a value for each key of the specified
+    // 'spec', in order, whose mapped value is the position of the key in
+    // 'spec' plus the optionally specified 'base'.
+{
+    for (int i = 0; spec[i]; ++i) {
+        result->push_back(Value(spec[i], base + i));
+    }
+}
+
+void modelInsert(Vector *result, const Value& value, bool uniqueFlag)
+    // Insert the specified 'value' into the specified sorted 'result',
+    // immediately after the values whose keys are not ordered after the key of
+    // 'value', unless the specified 'uniqueFlag' is 'true' and 'result' holds
+    // a value having the same key.
+{
+    Vector::iterator it = result->begin();
+    while (it != result->end() && !(value.first < it->first)) {
+        ++it;
+    }
+    if (uniqueFlag
+     && it != result->begin()
+     && (it - 1)->first == value.first) {
+        return;                                                       // RETURN
+    }
+    result->insert(it, value);
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Maintaining a Sorted Vector of Pairs
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain a table of tick sizes, mapping the lowest price
+// of each band to the tick size of that band, in a sorted vector.
+//
+// First, we define the type of the table, and of the key configuration
+// extracting a price from an element of the table:
+//..
+    typedef bsl::pair<int, int>                                  Band;
+    typedef bsl::vector<Band>                                    Table;
+    typedef bslstl::UnorderedMapKeyConfiguration<Band>           BandConfig;
+    typedef bslstl::FlatTreeUtil<BandConfig>                     BandUtil;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we insert a batch of bands, in no particular order, into an empty
+// table:
+//..
+    Table          table;
+    std::less<int> comparator;
+
+    const Band BANDS[] = { Band(1000, 5), Band(0, 1), Band(100, 2) };
+
+    BandUtil::insertRange(&table, BANDS, BANDS + 3, comparator, true);
+    ASSERT(3    == table.size());
+    ASSERT(0    == table[0].first);
+    ASSERT(100  == table[1].first);
+    ASSERT(1000 == table[2].first);
+//..
+// Next, we insert a second batch, holding a band whose price is already in
+// the table, and observe that the value already held is retained:
+//..
+    const Band MORE_BANDS[] = { Band(500, 3), Band(100, 99) };
+
+    BandUtil::insertRange(&table,
+                          MORE_BANDS,
+                          MORE_BANDS + 2,
+                          comparator,
+                          true);
+    ASSERT(4 == table.size());
+    ASSERT(2 == table[1].second);
+    ASSERT(3 == table[2].second);
+//..
+// Finally, we look up the tick size for a price of 750, by finding the last
+// band whose lowest price is not greater than 750:
+//..
+    const Band *band = BandUtil::upperBound(table.data(),
+                                            table.data() + table.size(),
+                                            750,
+                                            comparator);
+    ASSERT(table.data() != band);
+    ASSERT(3 == (band - 1)->second);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'insertSortedRange'
+        //
+        // Concerns:
+        //: 1 Inserting a sorted range produces the same sequence as inserting
+        //:   the values one at a time.
+        //:
+        //: 2 Each value is created by the allocator of the vector, and the
+        //:   default allocator is not used.
+        //:
+        //: 3 If an exception is thrown, the vector is unchanged.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each pair of sorted rows (unique rows when inserting unique
+        //:   values), insert the second row into a vector holding the first
+        //:   in the presence of injected exceptions, verifying that the
+        //:   vector is unchanged at the start of each attempt, and finally
+        //:   holds the same values as the model.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a range that is not sorted (or not unique, when
+        //:   inserting unique values).  (C-4)
+        //
+        // Testing:
+        //   void insertSortedRange(vector *, ITER, ITER, COMP&, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'insertSortedRange'"
+                            "\n===========================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int unique = 0; unique < 2; ++unique) {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE1 = DATA[ti].d_line;
+                const char *const SPEC1 = DATA[ti].d_spec;
+
+                if (unique ? !DATA[ti].d_isUnique : !DATA[ti].d_isSorted) {
+                    continue;
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const int         LINE2 = DATA[tj].d_line;
+                    const char *const SPEC2 = DATA[tj].d_spec;
+
+                    if (unique ? !DATA[tj].d_isUnique
+                               : !DATA[tj].d_isSorted) {
+                        continue;
+                    }
+
+                    if (veryVerbose) { T_ P_(unique) P_(SPEC1) P(SPEC2) }
+
+                    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+                    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+                    Vector values(&sa);
+                    load(&values, SPEC2, 100);
+
+                    Vector mExp(&sa);  const Vector& EXP = mExp;
+                    load(&mExp, SPEC1);
+                    const Vector ORIGINAL(EXP, &sa);
+                    for (Vector::const_iterator it = values.begin();
+                         it != values.end();
+                         ++it) {
+                        modelInsert(&mExp, *it, unique);
+                    }
+
+                    Vector mX(&oa);  const Vector& X = mX;
+                    load(&mX, SPEC1);
+
+                    CountingLess comparator;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE1, LINE2, unique, ORIGINAL == X);
+
+                        Util::insertSortedRange(&mX,
+                                                values.begin(),
+                                                values.end(),
+                                                comparator,
+                                                unique);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(LINE1, LINE2, unique, EXP == X);
+                    ASSERTV(LINE1, LINE2, da.numBlocksTotal(),
+                            0 == da.numBlocksTotal());
+                }
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Vector       mX;
+            Vector       values;
+            CountingLess comparator;
+
+            load(&values, "ABBA");
+
+            ASSERT_SAFE_PASS(Util::insertSortedRange(&mX,
+                                                     values.begin(),
+                                                     values.begin() + 2,
+                                                     comparator,
+                                                     true));
+            ASSERT_SAFE_PASS(Util::insertSortedRange(&mX,
+                                                     values.begin(),
+                                                     values.begin() + 3,
+                                                     comparator,
+                                                     false));
+            ASSERT_SAFE_FAIL(Util::insertSortedRange(&mX,
+                                                     values.begin(),
+                                                     values.begin() + 3,
+                                                     comparator,
+                                                     true));
+            ASSERT_SAFE_FAIL(Util::insertSortedRange(&mX,
+                                                     values.begin() + 1,
+                                                     values.end(),
+                                                     comparator,
+                                                     false));
+            ASSERT_SAFE_FAIL(Util::insertSortedRange(static_cast<Vector *>(0),
+                                                     values.begin(),
+                                                     values.end(),
+                                                     comparator,
+                                                     false));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'insertRange'
+        //
+        // Concerns:
+        //: 1 Inserting a range produces the same sequence as inserting the
+        //:   values one at a time: values with keys equivalent to those
+        //:   already held are placed after them (or discarded, when inserting
+        //:   unique values), and values with equivalent keys retain their
+        //:   relative order (or only the first is kept).
+        //:
+        //: 2 Each value is created by the allocator of the vector, and the
+        //:   default allocator is not used.
+        //:
+        //: 3 If an exception is thrown, the vector is unchanged.
+        //:
+        //: 4 Inserting a sorted range into an empty vector, or after its
+        //:   values, requires a number of comparisons linear in the length of
+        //:   the range.
+        //
+        // Plan:
+        //: 1 For each pair of rows, the first sorted (and unique when
+        //:   inserting unique values), insert the second row into a vector
+        //:   holding the first in the presence of injected exceptions,
+        //:   verifying that the vector is unchanged at the start of each
+        //:   attempt, and finally holds the same values as the model.
+        //:   (C-1..3)
+        //:
+        //: 2 Insert sorted ranges into an empty vector, and into a vector
+        //:   holding smaller keys, and verify the number of comparisons.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void insertRange(vector *, ITER, ITER, COMP&, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'insertRange'"
+                            "\n=====================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int unique = 0; unique < 2; ++unique) {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE1 = DATA[ti].d_line;
+                const char *const SPEC1 = DATA[ti].d_spec;
+
+                if (unique ? !DATA[ti].d_isUnique : !DATA[ti].d_isSorted) {
+                    continue;
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const int         LINE2 = DATA[tj].d_line;
+                    const char *const SPEC2 = DATA[tj].d_spec;
+
+                    if (veryVerbose) { T_ P_(unique) P_(SPEC1) P(SPEC2) }
+
+                    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+                    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+                    Vector values(&sa);
+                    load(&values, SPEC2, 100);
+
+                    Vector mExp(&sa);  const Vector& EXP = mExp;
+                    load(&mExp, SPEC1);
+                    const Vector ORIGINAL(EXP, &sa);
+                    for (Vector::const_iterator it = values.begin();
+                         it != values.end();
+                         ++it) {
+                        modelInsert(&mExp, *it, unique);
+                    }
+
+                    Vector mX(&oa);  const Vector& X = mX;
+                    load(&mX, SPEC1);
+
+                    CountingLess comparator;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE1, LINE2, unique, ORIGINAL == X);
+
+                        Util::insertRange(&mX,
+                                          values.begin(),
+                                          values.end(),
+                                          comparator,
+                                          unique);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(LINE1, LINE2, unique, EXP == X);
+                    ASSERTV(LINE1, LINE2, da.numBlocksTotal(),
+                            0 == da.numBlocksTotal());
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting comparisons for appended ranges.\n");
+
+        for (int unique = 0; unique < 2; ++unique) {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const SPEC   = DATA[ti].d_spec;
+                const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+                if (unique ? !DATA[ti].d_isUnique : !DATA[ti].d_isSorted) {
+                    continue;
+                }
+
+                Vector values;
+                load(&values, SPEC);
+
+                // Checking the order of the range requires one comparison per
+                // pair of adjacent values, and appending it one more.
+
+                {
+                    CountingLess comparator;
+                    Vector       mX;  const Vector& X = mX;
+
+                    Util::insertRange(&mX,
+                                      values.begin(),
+                                      values.end(),
+                                      comparator,
+                                      unique);
+                    ASSERTV(LINE, unique, values == X);
+                    ASSERTV(LINE, unique, comparator.count(),
+                            comparator.count() <= LENGTH);
+                }
+                {
+                    CountingLess comparator;
+                    Vector       mX;  const Vector& X = mX;
+                    mX.push_back(Value('@', 0));
+
+                    Util::insertRange(&mX,
+                                      values.begin(),
+                                      values.end(),
+                                      comparator,
+                                      unique);
+                    ASSERTV(LINE, unique, values.size() + 1 == X.size());
+                    ASSERTV(LINE, unique, comparator.count(),
+                            comparator.count() <= LENGTH + 1);
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'isSorted'
+        //
+        // Concerns:
+        //: 1 'isSorted' returns 'true' if and only if no key is ordered before
+        //:   the key preceding it, and, when 'uniqueFlag' is 'true', each key
+        //:   is ordered after the key preceding it.
+        //:
+        //: 2 'isSorted' accepts forward iterators.
+        //
+        // Plan:
+        //: 1 For each row of a table of sequences, verify the result of
+        //:   'isSorted' on a vector of values, and on a vector of keys
+        //:   (compared by a 'std::less' functor), with each 'uniqueFlag'.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   bool isSorted(ITERATOR, ITERATOR, COMP&, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'isSorted'"
+                            "\n==================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const bool        SORTED = DATA[ti].d_isSorted;
+            const bool        UNIQUE = DATA[ti].d_isUnique;
+
+            if (veryVerbose) { T_ P_(SPEC) P_(SORTED) P(UNIQUE) }
+
+            Vector values;
+            load(&values, SPEC);
+
+            CountingLess comparator;
+
+            ASSERTV(LINE, SORTED == Util::isSorted(values.begin(),
+                                                   values.end(),
+                                                   comparator,
+                                                   false));
+            ASSERTV(LINE, UNIQUE == Util::isSorted(values.begin(),
+                                                   values.end(),
+                                                   comparator,
+                                                   true));
+
+            bsl::vector<int> keys(SPEC, SPEC + strlen(SPEC));
+
+            const std::less<int> less = std::less<int>();
+
+            ASSERTV(LINE, SORTED == IntUtil::isSorted(keys.begin(),
+                                                      keys.end(),
+                                                      less,
+                                                      false));
+            ASSERTV(LINE, UNIQUE == IntUtil::isSorted(keys.begin(),
+                                                      keys.end(),
+                                                      less,
+                                                      true));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCHES
+        //
+        // Concerns:
+        //: 1 'lowerBound' returns the position of the first value whose key is
+        //:   not ordered before the searched key, 'upperBound' that of the
+        //:   first value whose key is ordered after it, and 'find' that of
+        //:   the first value whose key is equivalent to it (or the end of the
+        //:   sequence).
+        //:
+        //: 2 The searches accept both modifiable and non-modifiable
+        //:   iterators, and return the same type of iterator.
+        //:
+        //: 3 The searches require a logarithmic number of comparisons.
+        //
+        // Plan:
+        //: 1 For each sorted row of a table of sequences, and for each key
+        //:   in a range covering the keys of the sequences, compare the
+        //:   result of each search with the result of a linear search.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that the number of comparisons is at most one more than
+        //:   the binary logarithm of the length of the sequence (two more for
+        //:   'find').  (C-3)
+        //
+        // Testing:
+        //   ITERATOR lowerBound(ITERATOR, ITERATOR, const KeyType&, COMP&);
+        //   ITERATOR upperBound(ITERATOR, ITERATOR, const KeyType&, COMP&);
+        //   ITERATOR find(ITERATOR, ITERATOR, const KeyType&, COMP&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCHES"
+                            "\n================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+            if (!DATA[ti].d_isSorted) {
+                continue;
+            }
+
+            int maxComparisons = 1;
+            while ((1 << (maxComparisons - 1)) <= LENGTH) {
+                ++maxComparisons;
+            }
+
+            Vector mX;  const Vector& X = mX;
+            load(&mX, SPEC);
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                int expLower = 0;
+                while (expLower < LENGTH && SPEC[expLower] < key) {
+                    ++expLower;
+                }
+                int expUpper = expLower;
+                while (expUpper < LENGTH && SPEC[expUpper] == key) {
+                    ++expUpper;
+                }
+                const int expFind = expLower == expUpper ? LENGTH : expLower;
+
+                {
+                    CountingLess comparator;
+
+                    Vector::const_iterator it =
+                         Util::lowerBound(X.begin(), X.end(), key, comparator);
+                    ASSERTV(LINE, key, expLower == it - X.begin());
+                    ASSERTV(LINE, key, comparator.count(),
+                            comparator.count() <= maxComparisons);
+                }
+                {
+                    CountingLess comparator;
+
+                    Vector::const_iterator it =
+                         Util::upperBound(X.begin(), X.end(), key, comparator);
+                    ASSERTV(LINE, key, expUpper == it - X.begin());
+                    ASSERTV(LINE, key, comparator.count(),
+                            comparator.count() <= maxComparisons);
+                }
+                {
+                    CountingLess comparator;
+
+                    Vector::const_iterator it =
+                               Util::find(X.begin(), X.end(), key, comparator);
+                    ASSERTV(LINE, key, expFind == it - X.begin());
+                    ASSERTV(LINE, key, comparator.count(),
+                            comparator.count() <= maxComparisons + 1);
+                }
+                {
+                    CountingLess comparator;
+
+                    Vector::iterator it =
+                             Util::find(mX.begin(), mX.end(), key, comparator);
+                    ASSERTV(LINE, key, expFind == it - mX.begin());
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert a few ranges of 'int' values into a vector, and search
+        //:   for some keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bsl::vector<int>     mX;  const bsl::vector<int>& X = mX;
+        const std::less<int> less = std::less<int>();
+
+        const int VALUES1[] = { 5, 1, 3 };
+        const int VALUES2[] = { 2, 3, 4, 6 };
+
+        IntUtil::insertRange(&mX, VALUES1, VALUES1 + 3, less, true);
+        ASSERT(3 == X.size());
+        ASSERT(1 == X[0]);  ASSERT(3 == X[1]);  ASSERT(5 == X[2]);
+
+        IntUtil::insertSortedRange(&mX, VALUES2, VALUES2 + 4, less, true);
+        ASSERT(6 == X.size());
+        for (int i = 0; i < 6; ++i) {
+            ASSERTV(i, X[i], i + 1 == X[i]);
+        }
+
+        IntUtil::insertSortedRange(&mX, VALUES2, VALUES2 + 4, less, false);
+        ASSERT(10 == X.size());
+        ASSERT(IntUtil::isSorted(X.begin(), X.end(), less, false));
+        ASSERT(!IntUtil::isSorted(X.begin(), X.end(), less, true));
+
+        ASSERT(X.begin() + 1 == IntUtil::lowerBound(X.begin(),
+                                                    X.end(),
+                                                    2,
+                                                    less));
+        ASSERT(X.begin() + 3 == IntUtil::upperBound(X.begin(),
+                                                    X.end(),
+                                                    2,
+                                                    less));
+        ASSERT(X.end()       == IntUtil::find(X.begin(), X.end(), 7, less));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
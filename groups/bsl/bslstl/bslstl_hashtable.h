@@ -1474,6 +1474,10 @@ BSLS_IDENT("$Id: $")
 #include <bslalg_bidirectionallink.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALLINKLISTUTIL
+#include <bslalg_bidirectionallinklistutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_BIDIRECTIONALNODE
 #include <bslalg_bidirectionalnode.h>
 #endif
@@ -2281,6 +2285,15 @@ class HashTable {
         // requirements might simplify in the future, if the standard is
         // updated.
 
+    void compact();
+        // Reallocate the nodes of this hash-table contiguously, in the order
+        // of the list of elements, and release all the memory previously used
+        // for nodes.  Each element is copied into its new node, and the
+        // original element destroyed.  The number of buckets is not reduced.
+        // All pointers to nodes of this hash-table are invalidated.  This
+        // operation provides the strong exception guarantee (see
+        // {'bsldoc_glossary'}).
+
     template <class SOURCE_TYPE>
     bslalg::BidirectionalLink *insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this hash-table, and return the
@@ -2478,6 +2491,19 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    void findBatch(bslalg::BidirectionalLink **results,
+                   const KeyType *const       *keys,
+                   int                         numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array the address that 'find' would return for the key
+        // referred to by the corresponding element of the specified 'keys'
+        // array.  The buckets, and the first link of each bucket, searched for
+        // a group of keys are prefetched before any key of the group is
+        // compared, so that looking up many keys in a table larger than the
+        // processor caches does not wait on each cache miss in turn.  The
+        // behavior is undefined unless '0 <= numKeys', and both arrays have at
+        // least 'numKeys' elements.
+
     void findRange(bslalg::BidirectionalLink **first,
                    bslalg::BidirectionalLink **last,
                    const KeyType&              key) const;
@@ -3520,6 +3546,63 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
     return *this;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::compact()
+{
+    if (0 < d_size) {
+        typedef bslalg::HashTableImpUtil ImpUtil;
+
+        // With the same number of buckets, each node is appended to the back
+        // of the same bucket as in this hash-table.  A node starting a new
+        // bucket is appended to the back of the list (rather than the front,
+        // as 'insertAtBackOfBucket' would do), so that the new list has the
+        // same order as this one and, as the nodes are reserved in a single
+        // chunk, follows the order of their addresses.
+
+        HashTable other(d_parameters.originalHasher(),
+                        d_parameters.originalComparator(),
+                        this->numBuckets(),
+                        d_maxLoadFactor,
+                        this->allocator());
+        other.d_parameters.nodeFactory().reserveNodes(d_size);
+
+        bslalg::BidirectionalLink *last = 0;
+        for (bslalg::BidirectionalLink *cursor = d_anchor.listRootAddress();
+             cursor;
+             cursor = cursor->nextLink()) {
+            bslalg::HashTableBucket *bucket =
+                        &other.d_anchor.bucketArrayAddress()[
+                                  ImpUtil::computeBucketIndex(
+                                          this->hashCodeForNode(cursor),
+                                          other.d_anchor.bucketArraySize())];
+            bslalg::BidirectionalLink *newNode =
+                           other.d_parameters.nodeFactory().cloneNode(*cursor);
+
+            if (bucket->first()) {
+                BSLS_ASSERT_SAFE(bucket->last() == last);
+
+                bucket->setLast(newNode);
+            }
+            else {
+                bucket->setFirstAndLast(newNode, newNode);
+            }
+            if (last) {
+                bslalg::BidirectionalLinkListUtil::insertLinkAfterTarget(
+                                                                      newNode,
+                                                                      last);
+            }
+            else {
+                newNode->reset();
+                other.d_anchor.setListRootAddress(newNode);
+            }
+            last = newNode;
+            ++other.d_size;
+        }
+
+        quickSwapRetainAllocators(&other);
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class SOURCE_TYPE>
 bslalg::BidirectionalLink *
@@ -3928,6 +4011,40 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                              d_parameters.hashCodeForKey(key));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findBatch(
+                                   bslalg::BidirectionalLink **results,
+                                   const KeyType *const       *keys,
+                                   int                         numKeys) const
+{
+    BSLS_ASSERT_SAFE(results);
+    BSLS_ASSERT_SAFE(keys);
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    enum { k_BATCH_SIZE = 16 };
+
+    native_std::size_t hashCodes[k_BATCH_SIZE];
+
+    for (int base = 0; base < numKeys; base += k_BATCH_SIZE) {
+        const int numInBatch = numKeys - base < k_BATCH_SIZE
+                             ? numKeys - base
+                             : k_BATCH_SIZE;
+
+        for (int i = 0; i < numInBatch; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(*keys[base + i]);
+        }
+
+        bslalg::HashTableImpUtil::findBatch<KEY_CONFIG>(
+                                                    results + base,
+                                                    d_anchor,
+                                                    keys + base,
+                                                    hashCodes,
+                                                    numInBatch,
+                                                    d_parameters.comparator());
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 void
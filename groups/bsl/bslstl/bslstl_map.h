@@ -104,6 +104,8 @@ BSLS_IDENT("$Id: $")
 //  'c'             - comparator providing an ordering for objects of type 'K'
 //  'al             - an STL-style memory allocator
 //  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'j1', 'j2'      - two iterators defining a sequence of 'K' objects
+//  'o'             - an output iterator
 //  'k'             - an object of type 'K'
 //  'v'             - an object of type 'V'
 //  'p1', 'p2'      - two iterators belonging to 'a'
@@ -126,6 +128,9 @@ BSLS_IDENT("$Id: $")
 //  |                                                    | otherwise, where N |
 //  |                                                    | is distance(i1,i2) |
 //  +----------------------------------------------------+--------------------+
+//  | map<K, V> a(sorted_unique, i1, i2);                | O[N]               |
+//  | map<K, V> a(sorted_unique, i1, i2, c, al);         |                    |
+//  +----------------------------------------------------+--------------------+
 //  | a.~map<K, V>(); (destruction)                      | O[n]               |
 //  +----------------------------------------------------+--------------------+
 //  | a = b;          (assignment)                       | O[n]               |
@@ -168,6 +173,16 @@ BSLS_IDENT("$Id: $")
 //  |                                                    |                    |
 //  |                                                    | where N is         |
 //  |                                                    | n + distance(i1,i2)|
+//  |                                                    | or O[N] if [i1,i2) |
+//  |                                                    | is sorted with     |
+//  |                                                    | 'a.value_comp()'   |
+//  |                                                    | and that is less   |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[min(N, log(N) *  |
+//  |                                                    |   distance(i1,i2))]|
+//  |                                                    |                    |
+//  |                                                    | where N is         |
+//  |                                                    | n + distance(i1,i2)|
 //  +----------------------------------------------------+--------------------+
 //  | a.erase(p1)                                        | amortized constant |
 //  +----------------------------------------------------+--------------------+
@@ -182,12 +197,17 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.key_comp()                                       | O[1]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.value_comp()                                     | O[1]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.find(k)                                          | O[log(n)]          |
 //  +----------------------------------------------------+--------------------+
+//  | a.find(j1, j2, o)                                  | O[log(n) *         |
+//  |                                                    |   distance(j1,j2)] |
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | O[log(n) +         |
 //  |                                                    | a.count(k)]        |
 //  +----------------------------------------------------+--------------------+
@@ -417,6 +437,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_mapcomparator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_SORTEDTAG
+#include <bslstl_sortedtag.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
 #include <bslstl_stdexceptutil.h>
 #endif
@@ -457,6 +481,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -620,6 +652,52 @@ class map {
         // Return a reference providing modifiable access to the
         // comparator for this map.
 
+    template <class INPUT_ITERATOR>
+    void buildSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Append to this map, which is empty, a newly created node holding
+        // each 'value_type' object in the ordered prefix of the sequence
+        // starting at the specified '*first' element and ending immediately
+        // before the specified 'last' element, skipping those having the same
+        // key as the previous object, and rebuild the resulting vine (see
+        // 'bslalg_rbtreeutil') into a balanced tree; then insert the value of
+        // the object ending that prefix (if any), and load into '*first' the
+        // position following that object.  Each object in the prefix except
+        // the first requires two comparisons.  The behavior is undefined
+        // unless this map is empty and '*first != last'.  Note that if an
+        // exception is thrown, the tree of this map may be left as a vine,
+        // which can only be destroyed (e.g., by a
+        // 'bslalg::RbTreeUtilTreeProctor').
+
+    template <class INPUT_ITERATOR>
+    void insertSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // ordered prefix of the sequence starting at the specified '*first'
+        // element and ending immediately before the specified 'last' element,
+        // whose key is not already contained in this map, followed by the
+        // value of the object ending that prefix (if any), and load into
+        // '*first' the position following the last object inserted.  Each
+        // value in the prefix is inserted immediately before the first node
+        // that is not ordered before it, found by walking forward from the
+        // position of the previous value, and falling back on a search from
+        // the root if that walk exceeds 'log(n)' steps, so that the prefix is
+        // inserted in O[min(n + N, N * log(n))] time, where n is the size of
+        // this map and N the length of the prefix.  A node is created only for
+        // a value that is inserted.  The behavior is undefined if '*first ==
+        // last'.  Note that each object in the sequence is accessed only once,
+        // as required for an input iterator.
+
+    template <class INPUT_ITERATOR>
+    void appendSortedRange(BloombergLP::bslalg::RbTreeAnchor *vine,
+                           INPUT_ITERATOR                     first,
+                           INPUT_ITERATOR                     last);
+        // Append to the specified 'vine' (see 'bslalg_rbtreeutil') a newly
+        // created node holding each 'value_type' object in the sequence
+        // starting at the specified 'first' element and ending immediately
+        // before the specified 'last' element, without comparing their keys.
+        // The behavior is undefined unless the keys of the objects in the
+        // sequence are unique and ordered, and ordered after the key of the
+        // last node of 'vine'.
+
     void quickSwap(map& other);
         // Efficiently exchange the value and comparator of this object with
         // the value of the specified 'other' object.  This method provides
@@ -723,6 +801,40 @@ class map {
         // 'VALUE' both be "copy-constructible" (see {Requirements on 'KEY' and
         // 'VALUE'}).
 
+    template <class INPUT_ITERATOR>
+    map(sorted_unique_t,
+        INPUT_ITERATOR    first,
+        INPUT_ITERATOR    last,
+        const COMPARATOR& comparator = COMPARATOR(),
+        const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, whose keys are (as asserted by
+        // passing 'bsl::sorted_unique') unique and ordered according to the
+        // identified 'comparator'.  Optionally specify a 'comparator' used to
+        // order key-value pairs contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify a
+        // 'allocator' used to supply memory.  If 'allocator' is not supplied,
+        // a default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // (the default) then 'allocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'allocator' is not supplied, the currently installed default
+        // allocator will be used to supply memory.  This operation has O[N]
+        // complexity, where N is the number of elements between 'first' and
+        // 'last', and does not compare keys (except to verify their order in
+        // safe build modes).  The (template parameter) type 'INPUT_ITERATOR'
+        // shall meet the requirements of an input iterator defined in the
+        // C++11 standard [24.2.3] providing access to values of a type
+        // convertible to 'value_type'.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last', and the keys of the values in
+        // that sequence are unique and ordered according to 'comparator'.
+        // This method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" (see {Requirements on 'KEY' and
+        // 'VALUE'}).
+
     ~map();
         // Destroy this object.
 
@@ -806,13 +918,38 @@ class map {
         // Insert into this map the value of each 'value_type' object in the
         // range starting at the specified 'first' iterator and ending
         // immediately before the specified 'last' iterator, whose key is not
-        // already contained in this map.  The (template parameter) type
+        // already contained in this map (nor appears earlier in the range).
+        // If the range is ordered according to the comparator of this map,
+        // this operation has O[N] complexity if this map is empty, and O[min(n
+        // + N, N * log(n))] complexity otherwise, where n is the size of this
+        // map and N is the number of elements in the range; otherwise it has
+        // O[N * log(n + N)] complexity.  The (template parameter) type
         // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
         // defined in the C++11 standard [24.2.3] providing access to values of
-        // a type convertible to 'value_type'.  This method requires that the
+        // a type convertible to 'value_type'. This method requires that the
         // (template parameter) types 'KEY' and 'VALUE' both be
         // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
 
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose keys are (as
+        // asserted by passing 'bsl::sorted_unique') unique and ordered
+        // according to the comparator of this map, and whose key is not
+        // already contained in this map.  If this map is empty, this operation
+        // has O[N] complexity, where N is the number of elements in the range,
+        // and does not compare keys (except to verify their order in safe
+        // build modes); otherwise it has O[min(n + N, N * log(n))] complexity,
+        // where n is the size of this map.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless the keys of the values in the range are unique and ordered
+        // according to the comparator of this map.  This method requires that
+        // the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
     iterator erase(const_iterator position);
         // Remove from this map the 'value_type' object at the specified
         // 'position', and return an iterator referring to the element
@@ -851,11 +988,42 @@ class map {
         // Remove all entries from this map.  Note that the map is empty after
         // this call, but allocated memory may be retained for future use.
 
+    void compact();
+        // Reallocate the nodes of this map contiguously, in the order of
+        // iteration, and release all the memory previously used for nodes.
+        // Each element is copied into its new node, and the original element
+        // destroyed.  All iterators, pointers, and references to elements of
+        // this map are invalidated.  If an exception is thrown, this map is
+        // not modified.  Note that, after a long sequence of insertions and
+        // removals, the nodes visited by iterating over a map are typically
+        // scattered across memory, and that this method restores the locality
+        // of iteration, at the cost of temporarily allocating memory for a
+        // second copy of the elements.
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the 'value_type'
         // object in this map having the specified 'key', if such an entry
         // exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find(FORWARD_ITERATOR first,
+                         FORWARD_ITERATOR last,
+                         OUTPUT_ITERATOR  result);
+        // Write to the specified 'result', in order, for each key in the range
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position, an iterator providing
+        // modifiable access to the 'value_type' object in this map having
+        // that key, if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise; return 'result' advanced past the last iterator
+        // written.  The tree is searched for a batch of keys at a time,
+        // overlapping the cache misses incurred by the keys of each batch
+        // (see 'bslalg_rbtreeutil'), which is substantially faster than
+        // calling 'find' for each key when this map is larger than the
+        // processor caches.  'FORWARD_ITERATOR' shall be a forward iterator
+        // whose 'operator*' returns a reference to a 'key_type' object, and
+        // 'iterator' shall be assignable to '*result'.  The behavior is
+        // undefined unless '[first, last)' is a valid range.
+
     iterator lower_bound(const key_type& key);
         // Return an iterator providing modifiable access to the first (i.e.,
         // ordered least) 'value_type' object in this map whose key is
@@ -970,6 +1138,23 @@ class map {
         // 'value_type' object in this map having the specified 'key', if such
         // an entry exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find(FORWARD_ITERATOR first,
+                         FORWARD_ITERATOR last,
+                         OUTPUT_ITERATOR  result) const;
+        // Write to the specified 'result', in order, for each key in the range
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position, an iterator providing
+        // non-modifiable access to the 'value_type' object in this map having
+        // that key, if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise; return 'result' advanced past the last iterator
+        // written.  The tree is searched for a batch of keys at a time, as for
+        // the manipulator of the same name.  'FORWARD_ITERATOR' shall be a
+        // forward iterator whose 'operator*' returns a reference to a
+        // 'key_type' object, and 'const_iterator' shall be assignable to
+        // '*result'.  The behavior is undefined unless '[first, last)' is a
+        // valid range.
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this map having the
         // specified 'key'.  Note that since a map maintains unique keys,
@@ -1185,6 +1370,127 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::comparator()
     return d_compAndAlloc;
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::buildSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(0 == d_tree.numNodes());
+    BSLS_ASSERT_SAFE(*first != last);
+
+    BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                            &d_tree,
+                                            nodeFactory().createNode(**first));
+    for (++*first; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (this->comparator()(value.first, *d_tree.rootNode())) {
+            // 'value' ends the ordered prefix, so build the tree before
+            // inserting 'value' normally.
+
+            BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+            insert(value);
+            ++*first;
+            return;                                                   // RETURN
+        }
+        if (this->comparator()(*d_tree.rootNode(), value.first)) {
+            BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                             &d_tree,
+                                             nodeFactory().createNode(value));
+        }
+    }
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insertSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(*first != last);
+
+    // 'hint' tracks the first node not ordered before the current value, and
+    // (while the values are ordered) only moves forward.  Nodes are inserted
+    // one at a time (rather than merged as a vine) so that no node is created
+    // for a value whose key is already present, and so that the values
+    // inserted remain in this map if an exception is thrown.
+
+    int maxSteps = 0;
+    for (int n = d_tree.numNodes(); n; n >>= 1) {
+        ++maxSteps;
+    }
+
+    BloombergLP::bslalg::RbTreeNode *hint     = 0;
+    BloombergLP::bslalg::RbTreeNode *prevNode = 0;
+    for (; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (0 == prevNode) {
+            hint = BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            value.first);
+        }
+        else {
+            if (this->comparator()(value.first, *prevNode)) {
+                // 'value' ends the ordered prefix, so insert it normally.
+
+                insert(value);
+                ++*first;
+                return;                                               // RETURN
+            }
+            for (int steps = 0;
+                 d_tree.sentinel() != hint
+                                    && this->comparator()(*hint, value.first);
+                 ++steps) {
+                if (maxSteps == steps) {
+                    hint = BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            value.first);
+                    break;
+                }
+                hint = BloombergLP::bslalg::RbTreeUtil::next(hint);
+            }
+        }
+
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+                BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                           &comparisonResult,
+                                                           &d_tree,
+                                                           this->comparator(),
+                                                           value.first,
+                                                           hint);
+        if (!comparisonResult) {
+            prevNode = insertLocation;
+            continue;
+        }
+        prevNode = nodeFactory().createNode(value);
+        BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                  insertLocation,
+                                                  comparisonResult < 0,
+                                                  prevNode);
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::appendSortedRange(
+                                    BloombergLP::bslalg::RbTreeAnchor *vine,
+                                    INPUT_ITERATOR                     first,
+                                    INPUT_ITERATOR                     last)
+{
+    for (; first != last; ++first) {
+        BloombergLP::bslalg::RbTreeNode *node =
+                                              nodeFactory().createNode(*first);
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(vine, node);
+
+        BSLS_ASSERT_SAFE(!node->leftChild()
+                      || this->comparator()(*node->leftChild(), *node));
+    }
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::quickSwap(map& other)
@@ -1272,38 +1578,42 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::map(INPUT_ITERATOR    first,
                                                                &d_tree,
                                                                &nodeFactory());
 
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inseted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
+        // The following guarantees linear time to insert an ordered sequence
+        // of values (as required by the standard).  The nodes for the ordered
+        // prefix of the sequence are appended to a vine (see
+        // 'bslalg_rbtreeutil') without rebalancing, and the vine is then
+        // rebuilt into a balanced tree in a single pass.
 
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
+        buildSortedPrefix(&first, last);
 
-            const value_type& value = *first;
-            if (this->comparator()(value.first, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
+        // The remaining values are not in order, so insert them normally.
 
-            if (this->comparator()(*prevNode, value.first)) {
-                BloombergLP::bslalg::RbTreeNode *node =
-                                               nodeFactory().createNode(value);
-                BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                          prevNode,
-                                                          false,
-                                                          node);
-                prevNode = node;
-            }
+        for (; first != last; ++first) {
+            insert(*first);
         }
         proctor.release();
     }
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::map(sorted_unique_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  allocator)
+: d_compAndAlloc(comparator, allocator)
+, d_tree()
+{
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &d_tree,
+                                                               &nodeFactory());
+    appendSortedRange(&d_tree, first, last);
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+    proctor.release();
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~map()
@@ -1418,13 +1728,41 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 template <class INPUT_ITERATOR>
-inline
 void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                                     INPUT_ITERATOR last)
 {
-    while (first != last) {
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    // The values in the ordered prefix of the range are merged into this
+    // map in a single forward pass.
+
+    insertSortedPrefix(&first, last);
+
+    // The remaining values are not in order, so insert them normally.
+
+    for (; first != last; ++first) {
         insert(*first);
-        ++first;
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                    INPUT_ITERATOR first,
+                                                    INPUT_ITERATOR last)
+{
+    if (0 == d_tree.numNodes()) {
+        BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &d_tree,
+                                                               &nodeFactory());
+        appendSortedRange(&d_tree, first, last);
+        BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+        proctor.release();
+    }
+    else {
+        insert(first, last);
     }
 }
 
@@ -1546,6 +1884,23 @@ void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
 #endif
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::compact()
+{
+    if (0 < size()) {
+        map other(this->comparator().keyComparator(),
+                  nodeFactory().allocator());
+
+        // Reserve the nodes in a single chunk, handing them out in address
+        // order, and append them to a vine in the order of this object.
+
+        other.nodeFactory().reserveNodes(size());
+        other.appendSortedRange(&other.d_tree, cbegin(), cend());
+        BloombergLP::bslalg::RbTreeUtil::vineToTree(&other.d_tree);
+        quickSwap(other);
+    }
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
@@ -1556,6 +1911,39 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
                                                           key));
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(FORWARD_ITERATOR first,
+                                             FORWARD_ITERATOR last,
+                                             OUTPUT_ITERATOR  result)
+{
+    enum { k_BATCH_SIZE = 16 };
+
+    const key_type                        *keys[k_BATCH_SIZE];
+    const BloombergLP::bslalg::RbTreeNode *nodes[k_BATCH_SIZE];
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            keys[numKeys] = BSLS_UTIL_ADDRESSOF(*first);
+            ++numKeys;
+            ++first;
+        } while (numKeys < k_BATCH_SIZE && first != last);
+
+        BloombergLP::bslalg::RbTreeUtil::findBatch(nodes,
+                                                   d_tree,
+                                                   this->comparator(),
+                                                   keys,
+                                                   numKeys);
+
+        for (int i = 0; i < numKeys; ++i, ++result) {
+            *result = iterator(nodes[i]);
+        }
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
@@ -1730,6 +2118,39 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
        BloombergLP::bslalg::RbTreeUtil::find(d_tree, this->comparator(), key));
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(FORWARD_ITERATOR first,
+                                             FORWARD_ITERATOR last,
+                                             OUTPUT_ITERATOR  result) const
+{
+    enum { k_BATCH_SIZE = 16 };
+
+    const key_type                        *keys[k_BATCH_SIZE];
+    const BloombergLP::bslalg::RbTreeNode *nodes[k_BATCH_SIZE];
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            keys[numKeys] = BSLS_UTIL_ADDRESSOF(*first);
+            ++numKeys;
+            ++first;
+        } while (numKeys < k_BATCH_SIZE && first != last);
+
+        BloombergLP::bslalg::RbTreeUtil::findBatch(nodes,
+                                                   d_tree,
+                                                   this->comparator(),
+                                                   keys,
+                                                   numKeys);
+
+        for (int i = 0; i < numKeys; ++i, ++result) {
+            *result = const_iterator(nodes[i]);
+        }
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
@@ -21,6 +21,8 @@
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_util.h>
 
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_templatetestfacility.h>
@@ -96,6 +98,7 @@ using namespace bsl;
 // 23.4.6.2, construct/copy/destroy:
 // [19] map(const C& comparator, const A& allocator);
 // [12] map(ITER first, ITER last, const C& comparator, const A& allocator);
+// [27] map(sorted_unique_t, ITER first, ITER last, const C&, const A&);
 // [ 7] map(const map& original);
 // [ 2] explicit map(const A& allocator);
 // [ 7] map(const map& original, const A& allocator);
@@ -131,12 +134,14 @@ using namespace bsl;
 // [15] bsl::pair<iterator, bool> insert(const value_type& value);
 // [16] iterator insert(const_iterator position, const value_type& value);
 // [17] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [27] void insert(sorted_unique_t, INPUT_ITERATOR first, ITER last);
 //
 // [18] iterator erase(const_iterator position);
 // [18] size_type erase(const key_type& key);
 // [18] iterator erase(const_iterator first, const_iterator last);
 // [ 8] void swap(map& other);
 // [ 2] void clear();
+// [29] void compact();
 //
 // observers:
 // [21] key_compare key_comp() const;
@@ -145,6 +150,8 @@ using namespace bsl;
 // map operations:
 // [13] iterator find(const key_type& key);
 // [13] const_iterator find(const key_type& key) const;
+// [28] OUTPUT_ITERATOR find(FORWARD_ITERATOR, FORWARD_ITERATOR, OUTPUT_IT);
+// [28] OUTPUT_ITERATOR find(FORWARD_ITER, FORWARD_ITER, OUTPUT_IT) const;
 // [13] size_type count(const key_type& key) const;
 // [13] iterator lower_bound(const key_type& key);
 // [13] const_iterator lower_bound(const key_type& key) const;
@@ -165,7 +172,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(map<T,A> *object, const char *spec, int verbose = 1);
@@ -175,6 +182,7 @@ using namespace bsl;
 // [22] CONCERN: The type is compatible with STL allocator.
 // [23] CONCERN: The type has the necessary type traits.
 // [25] CONCERN: The type provides the full interface defined by the standard.
+// [27] CONCERN: Range 'insert' merges an ordered range in linear time.
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -245,6 +253,8 @@ static bool         veryVerbose;
 static bool     veryVeryVerbose;
 static bool veryVeryVeryVerbose;
 
+volatile size_t benchmarkSink;  // size of the most recent benchmarked map
+
 //=============================================================================
 //                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -930,6 +940,15 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase29();
+        // Test 'compact'.
+
+    static void testCase28();
+        // Test batched search.
+
+    static void testCase27();
+        // Test sorted-range construction and insertion.
+
     static void testCase26();
         // Test standard interface coverage.
 
@@ -1078,6 +1097,415 @@ bsl::map<KEY, VALUE, COMP, ALLOC> TestDriver<KEY, VALUE, COMP, ALLOC>::g(
     return gg(&object, spec);
 }
 
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase29()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'compact'
+    //
+    // Concerns:
+    //: 1 'compact' does not change the value of the object, nor the order in
+    //:   which its elements are iterated over.
+    //:
+    //: 2 After 'compact', the addresses of the elements increase in the order
+    //:   of iteration.
+    //:
+    //: 3 After 'compact', the object uses the same number of blocks of memory
+    //:   as a copy of it, the memory released by erased elements having been
+    //:   returned to the allocator.
+    //:
+    //: 4 Any memory allocation is from the object allocator.
+    //:
+    //: 5 'compact' provides the strong exception guarantee.
+    //
+    // Plan:
+    //: 1 For each length up to 16, create an object by inserting twice as
+    //:   many values, erasing every other value and inserting back half of
+    //:   them in reverse order.  Call 'compact' in the presence of injected
+    //:   exceptions, and verify that the value of the object is that of a
+    //:   copy made before the call.  (C-1, 5)
+    //:
+    //: 2 Verify that the addresses of the elements increase in the order of
+    //:   iteration, that the object allocator has as many blocks in use as
+    //:   that of a copy of the object, and that no memory is allocated from
+    //:   the default allocator.  (C-2..4)
+    //
+    // Testing:
+    //   void compact();
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;  // contains 52 distinct increasing values
+
+    const int MAX_LENGTH = 16;
+
+    if (verbose) printf("\nTesting 'compact'.\n");
+
+    for (int ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const int LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 2 * LENGTH; ++i) {
+            mX.insert(VALUES[i]);
+        }
+        for (int i = 0; i < 2 * LENGTH; i += 2) {
+            mX.erase(VALUES[i].first);
+        }
+        for (int i = 2 * LENGTH - 2; i >= 0; i -= 4) {
+            mX.insert(VALUES[i]);
+        }
+
+        const Obj W(X, &sa);
+
+        const bsls::Types::Int64 NUM_IN_USE = oa.numBlocksInUse();
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            ASSERTV(ti, W == X);
+
+            mX.compact();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERTV(ti, W == X);
+
+        CIter prev = X.end();
+        for (CIter it = X.begin(); it != X.end(); prev = it, ++it) {
+            if (prev != X.end()) {
+                ASSERTV(ti, bsls::Util::addressOf(*prev)
+                                                < bsls::Util::addressOf(*it));
+            }
+        }
+
+        {
+            bslma::TestAllocator ca("copy", veryVeryVeryVerbose);
+
+            const Obj Y(X, &ca);
+
+            ASSERTV(ti, ca.numBlocksInUse(), oa.numBlocksInUse(),
+                    ca.numBlocksInUse() == oa.numBlocksInUse());
+        }
+
+        ASSERTV(ti, NUM_IN_USE, oa.numBlocksInUse(),
+                NUM_IN_USE >= oa.numBlocksInUse());
+
+        ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase28()
+{
+    // ------------------------------------------------------------------------
+    // BATCHED SEARCH
+    //
+    // Concerns:
+    //: 1 The range 'find' writes, for each key of the range, the iterator that
+    //:   'find' returns for that key, in the order of the range, whether or
+    //:   not the key is in the container.
+    //:
+    //: 2 The range 'find' returns the output iterator advanced past the last
+    //:   iterator written.
+    //:
+    //: 3 Keys are found correctly whatever their number, in particular when
+    //:   it is not a multiple of the size of the batches searched for
+    //:   together.
+    //:
+    //: 4 Both the 'const' and non-'const' versions write the same iterators.
+    //:
+    //: 5 No memory is allocated.
+    //
+    // Plan:
+    //: 1 For each length up to 25, create an object holding every other
+    //:   value of 'VALUES', and search it, in a single call of each version
+    //:   of the range 'find', for the keys of all the values of 'VALUES' up
+    //:   to twice the length.  Verify each iterator written against 'find',
+    //:   and verify the iterators returned.  (C-1..4)
+    //:
+    //: 2 Verify no memory is allocated from the object or default allocators
+    //:   by the searches.  (C-5)
+    //
+    // Testing:
+    //   OUTPUT_ITERATOR find(FORWARD_ITERATOR, FORWARD_ITERATOR, OUTPUT_IT);
+    //   OUTPUT_ITERATOR find(FORWARD_ITER, FORWARD_ITER, OUTPUT_IT) const;
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;  // contains 52 distinct increasing values
+
+    const int MAX_LENGTH = 25;
+
+    if (verbose) printf("\nTesting batched search.\n");
+
+    for (int ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const int LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < LENGTH; ++i) {
+            mX.insert(VALUES[2 * i + 1]);
+        }
+
+        bsl::vector<KEY> keys(&sa);
+        for (int tj = 0; tj <= 2 * LENGTH; ++tj) {
+            keys.push_back(VALUES[tj].first);
+        }
+
+        bsl::vector<Iter>  iters(keys.size(), Iter(), &sa);
+        bsl::vector<CIter> citers(keys.size(), CIter(), &sa);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        typedef typename bsl::vector<Iter>::iterator  IterIter;
+        typedef typename bsl::vector<CIter>::iterator CIterIter;
+
+        const IterIter  ITEND  = mX.find(keys.begin(),
+                                         keys.end(),
+                                         iters.begin());
+        const CIterIter CITEND =  X.find(keys.begin(),
+                                         keys.end(),
+                                         citers.begin());
+
+        ASSERTV(ti, oam.isTotalSame());
+        ASSERTV(ti, dam.isTotalSame());
+
+        ASSERTV(ti, iters.end()  == ITEND);
+        ASSERTV(ti, citers.end() == CITEND);
+
+        for (int tj = 0; tj <= 2 * LENGTH; ++tj) {
+            ASSERTV(ti, tj, mX.find(keys[tj]) == iters[tj]);
+            ASSERTV(ti, tj,  X.find(keys[tj]) == citers[tj]);
+            ASSERTV(ti, tj, (X.end() == citers[tj]) == (0 == tj % 2));
+        }
+    }
+}
+
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase27()
+{
+    // ------------------------------------------------------------------------
+    // TESTING SORTED-RANGE CONSTRUCTION AND INSERTION
+    //
+    // Concerns:
+    //: 1 Constructing from a range passed with 'sorted_unique' creates the
+    //:   same value as the range constructor, and compares no keys (except to
+    //:   verify their order in safe build modes).
+    //:
+    //: 2 Inserting an ordered range into a map, with or without
+    //:   'sorted_unique', creates the same value as inserting each element
+    //:   individually, ignoring the values whose key is already present.
+    //:
+    //: 3 Inserting an ordered range requires a number of comparisons linear
+    //:   in the sizes of the map and the range.
+    //:
+    //: 4 Each iterator is dereferenced only once.
+    //:
+    //: 5 Any memory allocation is from the object allocator, and no
+    //:   temporary memory is allocated.
+    //:
+    //: 6 Any memory allocation is exception neutral.
+    //:
+    //: 7 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 Using the table-driven technique, select the rows of the default
+    //:   data whose specification is ordered and has no duplicates.
+    //:
+    //: 2 For each such row, create an object with the sorted-range
+    //:   constructor, and verify its value, its allocations, and the number
+    //:   of comparisons made.  (C-1, 4..5)
+    //:
+    //: 3 For each pair of such rows, 'R1' and 'R2', create an object having
+    //:   the value of 'R1', and insert the values of 'R2' (with and without
+    //:   'sorted_unique') in the presence of injected exceptions.  Verify
+    //:   that the object has the same value as one created by inserting the
+    //:   values of 'R1' and then those of 'R2' one at a time, the number of
+    //:   comparisons made, and that no temporary memory is allocated.
+    //:   (C-2..6)
+    //:
+    //: 4 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered for a range passed with 'sorted_unique' that is not ordered
+    //:   or holds duplicate keys.  (C-7)
+    //
+    // Testing:
+    //   map(sorted_unique_t, ITER first, ITER last, const C&, const A&);
+    //   void insert(sorted_unique_t, INPUT_ITERATOR first, ITER last);
+    //   CONCERN: Range 'insert' merges an ordered range in linear time.
+    // ------------------------------------------------------------------------
+
+    const size_t NUM_DATA                  = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    if (verbose) printf("\nTesting sorted-range constructor.\n");
+
+    for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE   = DATA[ti].d_line;
+        const char *const SPEC   = DATA[ti].d_spec;
+        const size_t      LENGTH = strlen(DATA[ti].d_results);
+
+        if (0 != strcmp(SPEC, DATA[ti].d_results)) {
+            continue;
+        }
+
+        TestValues CONT(SPEC);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(bsl::sorted_unique, CONT.begin(), CONT.end(), COMP(), &oa);
+        const Obj& X = mX;
+
+        CONT.resetIterators();
+
+        const Obj Y(CONT.begin(), CONT.end(), COMP(), &oa);
+
+        ASSERTV(LINE, X == Y);
+        ASSERTV(LINE, LENGTH == X.size());
+        ASSERTV(LINE, 0 == verifyContainer(X, TestValues(SPEC), LENGTH));
+
+#ifndef BSLS_ASSERT_SAFE_IS_ACTIVE
+        ASSERTV(LINE, X.key_comp().count(), 0 == X.key_comp().count());
+#endif
+
+        ASSERTV(LINE, oa.numBlocksTotal(), oa.numBlocksInUse(),
+                oa.numBlocksTotal() == oa.numBlocksInUse());
+        ASSERTV(LINE, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+
+    if (verbose) printf("\nTesting insertion of ordered ranges.\n");
+
+    for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE1   = DATA[ti].d_line;
+        const char *const SPEC1   = DATA[ti].d_spec;
+        const size_t      LENGTH1 = strlen(SPEC1);
+
+        if (0 != strcmp(SPEC1, DATA[ti].d_results)) {
+            continue;
+        }
+
+        for (size_t tj = 0; tj < NUM_DATA; ++tj) {
+            const int         LINE2   = DATA[tj].d_line;
+            const char *const SPEC2   = DATA[tj].d_spec;
+            const size_t      LENGTH2 = strlen(SPEC2);
+
+            if (0 != strcmp(SPEC2, DATA[tj].d_results)) {
+                continue;
+            }
+
+            if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+            char expSpec[2 * DEFAULT_MAX_LENGTH + 1];
+            strcpy(expSpec, SPEC1);
+            strcat(expSpec, SPEC2);
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Obj mE(&sa);  const Obj& E = gg(&mE, expSpec);
+
+            TestValues CONT(SPEC2);
+
+            for (int tagged = 0; tagged < 2; ++tagged) {
+                bslma::TestAllocator da("default", veryVeryVeryVerbose);
+                bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC1);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    CONT.resetIterators();
+
+                    if (tagged) {
+                        mX.insert(bsl::sorted_unique,
+                                  CONT.begin(),
+                                  CONT.end());
+                    }
+                    else {
+                        mX.insert(CONT.begin(), CONT.end());
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE1, LINE2, tagged, E == X);
+
+                ASSERTV(LINE1, LINE2, da.numBlocksTotal(),
+                        0 == da.numBlocksTotal());
+
+                // Without injected exceptions, the insertion requires (at
+                // most) one comparison to find each value's position in the
+                // range, one per node passed over, and three more per value.
+
+                mX.clear();
+                gg(&mX, SPEC1);
+
+                const int numBefore = X.key_comp().count();
+
+                const bsls::Types::Int64 NUM_TOTAL  = oa.numBlocksTotal();
+                const bsls::Types::Int64 NUM_IN_USE = oa.numBlocksInUse();
+
+                CONT.resetIterators();
+                if (tagged) {
+                    mX.insert(bsl::sorted_unique, CONT.begin(), CONT.end());
+                }
+                else {
+                    mX.insert(CONT.begin(), CONT.end());
+                }
+
+                const int NUM_CMP = X.key_comp().count() - numBefore;
+                const int MAX_CMP = static_cast<int>(LENGTH1 + 4 * LENGTH2);
+                ASSERTV(LINE1, LINE2, tagged, NUM_CMP, MAX_CMP,
+                        NUM_CMP <= MAX_CMP);
+                ASSERTV(LINE1, LINE2, tagged, E == X);
+
+                ASSERTV(LINE1, LINE2, tagged,
+                        oa.numBlocksTotal() - NUM_TOTAL
+                                        == oa.numBlocksInUse() - NUM_IN_USE);
+            }
+        }
+    }
+
+    if (verbose) printf("\nNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        TestValues CONT("ABCCBA");
+
+        ASSERT_SAFE_PASS(Obj(bsl::sorted_unique,
+                             CONT.index(0),
+                             CONT.index(0)));
+        CONT.resetIterators();
+        ASSERT_SAFE_PASS(Obj(bsl::sorted_unique,
+                             CONT.index(0),
+                             CONT.index(3)));
+        CONT.resetIterators();
+        ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique,
+                             CONT.index(2),
+                             CONT.index(4)));
+        CONT.resetIterators();
+        ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique,
+                             CONT.index(3),
+                             CONT.index(6)));
+
+        Obj mX;
+        CONT.resetIterators();
+        ASSERT_SAFE_FAIL(mX.insert(bsl::sorted_unique,
+                                   CONT.index(1),
+                                   CONT.index(4)));
+        ASSERT(mX.empty());
+    }
+}
+
 template <class KEY, class VALUE, class COMP, class ALLOC>
 void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase26()
 {
@@ -6578,7 +7006,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 27: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6621,6 +7049,33 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING 'compact'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase29,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+        TestDriver<TestKeyType, TestValueType>::testCase29();
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING BATCHED SEARCH
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase28,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+        TestDriver<TestKeyType, TestValueType>::testCase28();
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING SORTED-RANGE CONSTRUCTION AND INSERTION
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase27,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+        TestDriver<TestKeyType, TestValueType>::testCase27();
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
@@ -6924,6 +7379,267 @@ int main(int argc, char *argv[])
                                                              NUM_INT_VALUES);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LOADING SORTED SNAPSHOTS
+        //
+        // Concerns:
+        //: 1 Constructing a map from a sorted range, and inserting a sorted
+        //:   range into a map, take time linear in the number of values, and
+        //:   are faster than inserting the values one at a time.
+        //
+        // Plan:
+        //: 1 Create a sorted snapshot of (by default) 10 million values, and
+        //:   report the time taken to load it into a map by inserting the
+        //:   values one at a time, by the range constructor, and by the
+        //:   constructor taking 'sorted_unique'.
+        //:
+        //: 2 Report the time taken to insert a second sorted snapshot, whose
+        //:   keys interleave those of the first, into the loaded map, one
+        //:   value at a time and by range 'insert'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: LOADING SORTED SNAPSHOTS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: LOADING SORTED SNAPSHOTS"
+                            "\n=====================================\n");
+
+        typedef bsl::map<int, int>  IntMap;
+        typedef bsl::pair<int, int> IntPair;
+
+        const int NUM_VALUES = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 10 * 1000 * 1000;
+
+        bslma::MallocFreeAllocator& ma =
+                                      bslma::MallocFreeAllocator::singleton();
+
+        // The first snapshot holds the even keys, and the second the odd
+        // keys.
+
+        bsl::vector<IntPair> snapshot(&ma);
+        bsl::vector<IntPair> update(&ma);
+        snapshot.reserve(NUM_VALUES);
+        update.reserve(NUM_VALUES);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            snapshot.push_back(IntPair(2 * i, i));
+            update.push_back(IntPair(2 * i + 1, i));
+        }
+
+        bsls::Stopwatch timer;
+
+        {
+            IntMap mX(&ma);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(snapshot[i]);
+            }
+            timer.stop();
+            benchmarkSink = mX.size();
+            printf("\tload, one at a time:     %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(update[i]);
+            }
+            timer.stop();
+            benchmarkSink = mX.size();
+            printf("\tupdate, one at a time:   %8.3fs\n", timer.elapsedTime());
+        }
+        {
+            timer.reset();
+            timer.start();
+            IntMap mX(snapshot.begin(), snapshot.end(), std::less<int>(), &ma);
+            timer.stop();
+            benchmarkSink = mX.size();
+            printf("\tload, range constructor: %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            mX.insert(update.begin(), update.end());
+            timer.stop();
+            benchmarkSink = mX.size();
+            printf("\tupdate, range 'insert':  %8.3fs\n", timer.elapsedTime());
+        }
+        {
+            timer.reset();
+            timer.start();
+            IntMap mX(bsl::sorted_unique,
+                      snapshot.begin(),
+                      snapshot.end(),
+                      std::less<int>(),
+                      &ma);
+            timer.stop();
+            benchmarkSink = mX.size();
+            printf("\tload, 'sorted_unique':   %8.3fs\n", timer.elapsedTime());
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCHED SEARCH
+        //
+        // Concerns:
+        //: 1 Searching a map larger than the processor caches for a sequence
+        //:   of keys with the range 'find' is faster than calling 'find' for
+        //:   each key.
+        //
+        // Plan:
+        //: 1 Create a map of (by default) 4 million values, and report the
+        //:   time taken to search it for 1 million random keys (half of which
+        //:   are present), calling 'find' for each key, and calling the range
+        //:   'find' once.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCHED SEARCH
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: BATCHED SEARCH"
+                            "\n===========================\n");
+
+        typedef bsl::map<int, int> IntMap;
+
+        const int NUM_VALUES = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 4 * 1000 * 1000;
+        const int NUM_KEYS   = 1000 * 1000;
+
+        bslma::MallocFreeAllocator& ma =
+                                      bslma::MallocFreeAllocator::singleton();
+
+        // The map holds the even keys in '[0 .. 2 * NUM_VALUES)'.
+
+        IntMap mX(&ma);  const IntMap& X = mX;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.insert(mX.end(), bsl::pair<int, int>(2 * i, i));
+        }
+
+        bsl::vector<int> keys(&ma);
+        keys.reserve(NUM_KEYS);
+        srand(1);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys.push_back((rand() * (RAND_MAX + 1.0) + rand())
+                         / ((RAND_MAX + 1.0) * (RAND_MAX + 1.0))
+                         * 2 * NUM_VALUES);
+        }
+
+        bsl::vector<IntMap::const_iterator> results(NUM_KEYS,
+                                                    X.end(),
+                                                    &ma);
+
+        bsls::Stopwatch timer;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            results[i] = X.find(keys[i]);
+        }
+        timer.stop();
+        benchmarkSink = results[NUM_KEYS - 1] != X.end();
+        printf("\t'find', one key at a time: %8.3fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        X.find(keys.begin(), keys.end(), results.begin());
+        timer.stop();
+        benchmarkSink = results[NUM_KEYS - 1] != X.end();
+        printf("\trange 'find':              %8.3fs\n", timer.elapsedTime());
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ITERATION AFTER 'compact'
+        //
+        // Concerns:
+        //: 1 Iterating over a map whose nodes have been scattered in memory by
+        //:   insertions and erasures is faster after 'compact'.
+        //
+        // Plan:
+        //: 1 Create a map of (by default) 4 million values, and churn it by
+        //:   erasing all of them and inserting as many new ones, in random
+        //:   orders.
+        //:   Report the time taken to iterate over the map before and after
+        //:   calling 'compact', and the time taken by 'compact'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ITERATION AFTER 'compact'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: ITERATION AFTER 'compact'"
+                            "\n======================================\n");
+
+        typedef bsl::map<int, int> IntMap;
+
+        const int NUM_VALUES = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 4 * 1000 * 1000;
+
+        bslma::MallocFreeAllocator& ma =
+                                      bslma::MallocFreeAllocator::singleton();
+
+        IntMap mX(&ma);  const IntMap& X = mX;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.insert(mX.end(), bsl::pair<int, int>(2 * i, i));
+        }
+
+        // Erase the even keys, in a random order, and insert the odd keys,
+        // in another random order, so that nodes are reused in an order
+        // unrelated to that of the keys.
+
+        bsl::vector<int> order(&ma);
+        order.reserve(NUM_VALUES);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            order.push_back(i);
+        }
+        srand(1);
+        for (int pass = 0; pass < 2; ++pass) {
+            for (int i = NUM_VALUES - 1; i > 0; --i) {
+                const int j = static_cast<int>(
+                                  (rand() * (RAND_MAX + 1.0) + rand())
+                                / ((RAND_MAX + 1.0) * (RAND_MAX + 1.0))
+                                * (i + 1));
+                std::swap(order[i], order[j]);
+            }
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                if (0 == pass) {
+                    mX.erase(2 * order[i]);
+                }
+                else {
+                    mX.insert(bsl::pair<int, int>(2 * order[i] + 1, i));
+                }
+            }
+        }
+
+        bsls::Stopwatch timer;
+        long long       sum = 0;
+
+        timer.reset();
+        timer.start();
+        for (IntMap::const_iterator it = X.begin(); it != X.end(); ++it) {
+            sum += it->second;
+        }
+        timer.stop();
+        benchmarkSink = static_cast<size_t>(sum);
+        printf("\titerate, after churn:     %8.3fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        mX.compact();
+        timer.stop();
+        printf("\t'compact':                %8.3fs\n", timer.elapsedTime());
+
+        sum = 0;
+        timer.reset();
+        timer.start();
+        for (IntMap::const_iterator it = X.begin(); it != X.end(); ++it) {
+            sum += it->second;
+        }
+        timer.stop();
+        benchmarkSink = static_cast<size_t>(sum);
+        printf("\titerate, after 'compact': %8.3fs\n", timer.elapsedTime());
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -208,6 +208,15 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs);
+        // Return 'true' if 'value().first' of the specified 'lhs' after being
+        // cast to 'NodeType' is less than (ordered before, according to the
+        // comparator held by this object) 'value().first' of the specified
+        // 'rhs' after being cast to 'NodeType', and 'false' otherwise.  The
+        // behavior is undefined unless 'lhs' and 'rhs' can be safely cast to
+        // 'NodeType'.
+
     void swap(MapComparator& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -230,6 +239,15 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+        // Return 'true' if 'value().first' of the specified 'lhs' after being
+        // cast to 'NodeType' is less than (ordered before, according to the
+        // comparator held by this object) 'value().first' of the specified
+        // 'rhs' after being cast to 'NodeType', and 'false' otherwise.  The
+        // behavior is undefined unless 'lhs' and 'rhs' can be safely cast to
+        // 'NodeType'.
+
     COMPARATOR& keyComparator();
         // Return a reference providing modifiable access to the function
         // pointer or functor to which this comparator delegates comparison
@@ -326,6 +344,26 @@ bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
                            rhs);
 }
 
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                                 const bslalg::RbTreeNode& lhs,
+                                                 const bslalg::RbTreeNode& rhs)
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const bslalg::RbTreeNode& rhs) const
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
 template <class KEY, class VALUE, class COMPARATOR>
 inline
 COMPARATOR&
@@ -79,6 +79,7 @@ using namespace bslstl;
 // ACCESSORS
 // [ 3] bool operator()(const KEY& lhs, const bslalg::RbTreeNode& rhs) const;
 // [ 3] bool operator()(const bslalg::RbTreeNode& rhs, const KEY& lhs) const;
+// [ 3] bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const;
 // [ 2] COMPARATOR keyComparator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -483,6 +484,7 @@ void TestDriver<TYPE>::test3()
     //   explicit MapComparator(const COMPARATOR& keyComparator);
     //   bool operator()(const KEY& lhs, const bslalg::RbTreeNode& rhs) const;
     //   bool operator()(const bslalg::RbTreeNode& rhs, const KEY& lhs) const;
+    //   bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const;
     // --------------------------------------------------------------------
 
     if (verbose)
@@ -529,6 +531,25 @@ void TestDriver<TYPE>::test3()
         ASSERTV(ncComp.keyComparator().numCalls(),
                 2 == ncComp.keyComparator().numCalls());
 
+        Node *n0Ptr = AllocTraits::allocate(allocator, 1);
+
+        Node& mN0 = *n0Ptr; const Node& N0 = mN0;
+        AllocTraits::construct(allocator, &mN0.value(),
+                               bsltf::TemplateTestFacility::create<Key>(0), 0);
+
+        ASSERTV(N0.value().first, N1.value().first, comp(N0, N1));
+        ASSERTV(N1.value().first, N0.value().first, !comp(N1, N0));
+        ASSERTV(comp.keyComparator().numCalls(),
+                4 == comp.keyComparator().numCalls());
+
+        ASSERTV(N0.value().first, N1.value().first, ncComp(N0, N1));
+        ASSERTV(N1.value().first, N0.value().first, !ncComp(N1, N0));
+        ASSERTV(ncComp.keyComparator().numCalls(),
+                4 == ncComp.keyComparator().numCalls());
+
+        AllocTraits::destroy(allocator, &mN0.value());
+        AllocTraits::deallocate(allocator, n0Ptr, 1);
+
         AllocTraits::destroy(allocator, &mN1.value());
         AllocTraits::deallocate(allocator, n1Ptr, 1);
     }
@@ -129,6 +129,10 @@ BSLS_IDENT("$Id: $")
 //  |                                                    | otherwise, where N |
 //  |                                                    | is distance(i1,i2) |
 //  +----------------------------------------------------+--------------------+
+//  | multimap<K, V> a(sorted_equivalent, i1, i2);       | O[N]               |
+//  | multimap<K, V> a(sorted_equivalent, i1, i2,        |                    |
+//  |                  c, al);                           |                    |
+//  +----------------------------------------------------+--------------------+
 //  | a.~multimap<K, V>(); (destruction)                 | O[n]               |
 //  +----------------------------------------------------+--------------------+
 //  | a = b;          (assignment)                       | O[n]               |
@@ -167,6 +171,16 @@ BSLS_IDENT("$Id: $")
 //  |                                                    |                    |
 //  |                                                    | where N is         |
 //  |                                                    | n + distance(i1,i2)|
+//  |                                                    | or O[N] if [i1,i2) |
+//  |                                                    | is sorted with     |
+//  |                                                    | 'a.value_comp()'   |
+//  |                                                    | and that is less   |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_equivalent, i1, i2)                | O[min(N, log(N) *  |
+//  |                                                    |   distance(i1,i2))]|
+//  |                                                    |                    |
+//  |                                                    | where N is         |
+//  |                                                    | n + distance(i1,i2)|
 //  +----------------------------------------------------+--------------------+
 //  | a.erase(p1)                                        | amortized constant |
 //  +----------------------------------------------------+--------------------+
@@ -181,6 +195,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.key_comp()                                       | O[1]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.value_comp()                                     | O[1]               |
@@ -491,6 +507,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_mapcomparator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_SORTEDTAG
+#include <bslstl_sortedtag.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
 #include <bslstl_stdexceptutil.h>
 #endif
@@ -532,6 +552,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -620,6 +644,46 @@ class multimap {
         // Return a reference providing modifiable access to the
         // comparator for this tree.
 
+    template <class INPUT_ITERATOR>
+    void buildSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Append to this multimap, which is empty, a newly created node
+        // holding each 'value_type' object in the ordered prefix of the
+        // sequence starting at the specified '*first' element and ending
+        // immediately before the specified 'last' element, and rebuild the
+        // resulting vine (see 'bslalg_rbtreeutil') into a balanced tree; then
+        // insert the value of the object ending that prefix (if any), and load
+        // into '*first' the position following that object.  Each object in
+        // the prefix except the first requires one comparison.  The behavior
+        // is undefined unless this multimap is empty and '*first != last'.
+        // Note that if an exception is thrown, the tree of this multimap may
+        // be left as a vine, which can only be destroyed (e.g., by a
+        // 'bslalg::RbTreeUtilTreeProctor').
+
+    template <class INPUT_ITERATOR>
+    void insertSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the ordered prefix of the sequence starting at the specified
+        // '*first' element and ending immediately before the specified 'last'
+        // element, followed by the value of the object ending that prefix (if
+        // any), and load into '*first' the position following the last object
+        // inserted.  The nodes for the prefix are created as a vine (see
+        // 'bslalg_rbtreeutil'), requiring one comparison for each object
+        // except the first, and the vine is then merged into this multimap.
+        // The behavior is undefined if '*first == last'.  Note that each
+        // object in the sequence is accessed only once, as required for an
+        // input iterator.
+
+    template <class INPUT_ITERATOR>
+    void appendSortedRange(BloombergLP::bslalg::RbTreeAnchor *vine,
+                           INPUT_ITERATOR                     first,
+                           INPUT_ITERATOR                     last);
+        // Append to the specified 'vine' (see 'bslalg_rbtreeutil') a newly
+        // created node holding each 'value_type' object in the sequence
+        // starting at the specified 'first' element and ending immediately
+        // before the specified 'last' element, without comparing them.  The
+        // behavior is undefined unless the objects in the sequence are
+        // ordered, and none is ordered before the last node of 'vine'.
+
     void quickSwap(multimap& other);
         // Efficiently exchange the value and comparator of this object with
         // the value of the specified 'other' object.  This method provides
@@ -792,6 +856,40 @@ class multimap {
         // (template parameter) types 'KEY' and 'VALUE' both be
         // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
 
+    template <class INPUT_ITERATOR>
+    multimap(sorted_equivalent_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a multimap, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element, which are (as
+        // asserted by passing 'bsl::sorted_equivalent') ordered according to
+        // the identified 'comparator'.  Optionally specify a 'comparator' used
+        // to order the key-value pairs contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'allocator' used to supply memory.  If 'allocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the template parameter 'ALLOCATOR'
+        // argument is of type 'bsl::allocator' (the default) then 'allocator',
+        // if supplied, shall be convertible to 'bslma::Allocator *'.  If the
+        // template parameter 'ALLOCATOR' argument is of type 'bsl::allocator'
+        // and 'allocator' is not supplied, the currently installed default
+        // allocator will be used to supply memory.  This operation has O[N]
+        // complexity, where N is the number of elements between 'first' and
+        // 'last', and does not compare keys (except to verify their order in
+        // safe build modes).  The (template parameter) type 'INPUT_ITERATOR'
+        // shall meet the requirements of an input iterator defined in the
+        // C++11 standard [24.2.3] providing access to values of a type
+        // convertible to 'value_type'.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last', and the values in that
+        // sequence are ordered according to 'comparator'.  This method
+        // requires that the (template parameter) types 'KEY' and 'VALUE' both
+        // be "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
     ~multimap();
         // Destroy this object;
 
@@ -850,12 +948,38 @@ class multimap {
     void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
         // Insert into this multimap the value of each 'value_type' object in
         // the range starting at the specified 'first' iterator and ending
-        // immediately before the specified 'last' iterator.  The (template
-        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
-        // input iterator defined in the C++11 standard [24.2.3] providing
-        // access to values of a type convertible to 'value_type'.  This method
-        // requires that the (template parameter) types 'KEY' and 'VALUE' both
-        // be "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+        // immediately before the specified 'last' iterator.  If the range is
+        // ordered according to the comparator of this multimap, this operation
+        // has O[n + N] complexity if 'N * log(n + N)' is at least 'n + N', and
+        // O[N * log(n + N)] complexity otherwise, where n is the size of this
+        // multimap and N is the number of elements in the range; otherwise it
+        // has O[N * log(n + N)] complexity.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  This method requires that the
+        // (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, which are (as
+        // asserted by passing 'bsl::sorted_equivalent') ordered according to
+        // the comparator of this multimap.  This operation has O[n + N]
+        // complexity if 'N * log(n + N)' is at least 'n + N', and
+        // O[N * log(n + N)] complexity otherwise, where n is the size of this
+        // multimap and N is the number of elements in the range.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless the values in the
+        // range are ordered according to the comparator of this multimap.
+        // This method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" (see {Requirements on 'KEY' and
+        // 'VALUE'}).
 
     iterator erase(const_iterator position);
         // Remove from this multimap the 'value_type' object at the specified
@@ -895,6 +1019,18 @@ class multimap {
         // empty after this call, but allocated memory may be retained for
         // future use.
 
+    void compact();
+        // Reallocate the nodes of this multimap contiguously, in the order of
+        // iteration, and release all the memory previously used for nodes.
+        // Each element is copied into its new node, and the original element
+        // destroyed.  All iterators, pointers, and references to elements of
+        // this multimap are invalidated.  If an exception is thrown, this
+        // multimap is not modified.  Note that, after a long sequence of
+        // insertions and removals, the nodes visited by iterating over a
+        // multimap are typically scattered across memory, and that this method
+        // restores the locality of iteration, at the cost of temporarily
+        // allocating memory for a second copy of the elements.
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the first
         // 'value_type' object having the specified 'key' in ordered sequence
@@ -1208,6 +1344,93 @@ multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::comparator()
     return d_compAndAlloc;
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::buildSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(0 == d_tree.numNodes());
+    BSLS_ASSERT_SAFE(*first != last);
+
+    BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                            &d_tree,
+                                            nodeFactory().createNode(**first));
+    for (++*first; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (this->comparator()(value.first, *d_tree.rootNode())) {
+            // 'value' ends the ordered prefix, so build the tree before
+            // inserting 'value' normally.
+
+            BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+            insert(value);
+            ++*first;
+            return;                                                   // RETURN
+        }
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                             &d_tree,
+                                             nodeFactory().createNode(value));
+    }
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insertSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(*first != last);
+
+    BloombergLP::bslalg::RbTreeAnchor                       newNodes;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &newNodes,
+                                                               &nodeFactory());
+
+    BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                            &newNodes,
+                                            nodeFactory().createNode(**first));
+    for (++*first; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (this->comparator()(value.first, *newNodes.rootNode())) {
+            // 'value' ends the ordered prefix, so merge the prefix before
+            // inserting 'value' normally.
+
+            BloombergLP::bslalg::RbTreeUtil::merge(&d_tree,
+                                                   &newNodes,
+                                                   this->comparator(),
+                                                   false);
+            insert(value);
+            ++*first;
+            return;                                                   // RETURN
+        }
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                             &newNodes,
+                                             nodeFactory().createNode(value));
+    }
+    BloombergLP::bslalg::RbTreeUtil::merge(&d_tree,
+                                           &newNodes,
+                                           this->comparator(),
+                                           false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::appendSortedRange(
+                                    BloombergLP::bslalg::RbTreeAnchor *vine,
+                                    INPUT_ITERATOR                     first,
+                                    INPUT_ITERATOR                     last)
+{
+    for (; first != last; ++first) {
+        BloombergLP::bslalg::RbTreeNode *node =
+                                              nodeFactory().createNode(*first);
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(vine, node);
+
+        BSLS_ASSERT_SAFE(!node->leftChild()
+                      || !this->comparator()(*node, *node->leftChild()));
+    }
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::quickSwap(multimap& other)
@@ -1257,35 +1480,44 @@ multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::multimap(
                                                                &d_tree,
                                                                &nodeFactory());
 
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inseted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
+        // The following guarantees linear time to insert an ordered sequence
+        // of values (as required by the standard).  The nodes for the ordered
+        // prefix of the sequence are appended to a vine (see
+        // 'bslalg_rbtreeutil') without rebalancing, and the vine is then
+        // rebuilt into a balanced tree in a single pass.
 
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
-
-            const value_type& value = *first;
-            if (this->comparator()(value.first, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
-            BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
-                                                                        value);
-            BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                      prevNode,
-                                                      false,
-                                                      node);
-            prevNode = node;
+        buildSortedPrefix(&first, last);
+
+        // The remaining values are not in order, so insert them normally.
+
+        for (; first != last; ++first) {
+            insert(*first);
         }
+
         proctor.release();
     }
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::multimap(
+                                           sorted_equivalent_t,
+                                           INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           const COMPARATOR& comparator,
+                                           const ALLOCATOR&  allocator)
+: d_compAndAlloc(comparator, allocator)
+, d_tree()
+{
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &d_tree,
+                                                               &nodeFactory());
+    appendSortedRange(&d_tree, first, last);
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+    proctor.release();
+}
+
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1411,16 +1643,43 @@ multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 template <class INPUT_ITERATOR>
-inline
 void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                                          INPUT_ITERATOR last)
 {
-    while (first != last) {
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    // The values in the ordered prefix of the range are merged into this
+    // multimap in linear time (or inserted one at a time, if they are few).
+
+    insertSortedPrefix(&first, last);
+
+    // The remaining values are not in order, so insert them normally.
+
+    for (; first != last; ++first) {
         insert(*first);
-        ++first;
     }
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                     sorted_equivalent_t,
+                                                     INPUT_ITERATOR      first,
+                                                     INPUT_ITERATOR      last)
+{
+    BloombergLP::bslalg::RbTreeAnchor                       newNodes;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &newNodes,
+                                                               &nodeFactory());
+    appendSortedRange(&newNodes, first, last);
+    BloombergLP::bslalg::RbTreeUtil::merge(&d_tree,
+                                           &newNodes,
+                                           this->comparator(),
+                                           false);
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
@@ -1537,6 +1796,23 @@ void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
 #endif
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::compact()
+{
+    if (0 < size()) {
+        multimap other(this->comparator().keyComparator(),
+                       nodeFactory().allocator());
+
+        // Reserve the nodes in a single chunk, handing them out in address
+        // order, and append them to a vine in the order of this object.
+
+        other.nodeFactory().reserveNodes(size());
+        other.appendSortedRange(&other.d_tree, cbegin(), cend());
+        BloombergLP::bslalg::RbTreeUtil::vineToTree(&other.d_tree);
+        quickSwap(other);
+    }
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
@@ -19,6 +19,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_util.h>
 
 #include <limits.h>
 
@@ -93,6 +94,7 @@ using namespace bsl;
 // 23.4.6.2, construct/copy/destroy:
 // [19] multimap(const C& comparator, const A& allocator);
 // [12] multimap(ITER first, ITER last, const C& comp, const A& alloc);
+// [26] multimap(sorted_equivalent_t, ITER, ITER, const C&, const A&);
 // [ 7] multimap(const multimap& original);
 // [ 2] explicit multimap(const A& allocator);
 // [ 7] multimap(const multimap& original, const A& allocator);
@@ -123,12 +125,14 @@ using namespace bsl;
 // [15] bsl::pair<iterator, bool> insert(const value_type& value);
 // [16] iterator insert(const_iterator position, const value_type& value);
 // [17] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [26] void insert(sorted_equivalent_t, INPUT_ITERATOR first, ITER last);
 //
 // [18] iterator erase(const_iterator position);
 // [18] size_type erase(const key_type& key);
 // [18] iterator erase(const_iterator first, const_iterator last);
 // [ 8] void swap(multimap& other);
 // [ 2] void clear();
+// [27] void compact();
 //
 // observers:
 // [21] key_compare key_comp() const;
@@ -157,7 +161,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [25] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multimap<T,A> *object, const char *spec, int verbose = 1);
@@ -167,6 +171,7 @@ using namespace bsl;
 // [22] CONCERN: The object is compatible with STL allocators.
 // [23] CONCERN: The object has the necessary type traits
 // [24] CONCERN: The type provides the full interface defined by the standard.
+// [26] CONCERN: Range 'insert' merges an ordered range in linear time.
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -926,6 +931,12 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase27();
+        // Test 'compact'.
+
+    static void testCase26();
+        // Test sorted-range construction and insertion.
+
     static void testCase25();
         // Test standard interface coverage.
 
@@ -1072,6 +1083,328 @@ bsl::multimap<KEY, VALUE, COMP, ALLOC> TestDriver<KEY, VALUE, COMP, ALLOC>::g(
 }
 
 
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase27()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'compact'
+    //
+    // Concerns:
+    //: 1 'compact' does not change the value of the object, nor the order in
+    //:   which its elements, including those having equivalent keys, are
+    //:   iterated over.
+    //:
+    //: 2 After 'compact', the addresses of the elements increase in the order
+    //:   of iteration.
+    //:
+    //: 3 After 'compact', the object uses the same number of blocks of memory
+    //:   as a copy of it, the memory released by erased elements having been
+    //:   returned to the allocator.
+    //:
+    //: 4 Any memory allocation is from the object allocator.
+    //:
+    //: 5 'compact' provides the strong exception guarantee.
+    //
+    // Plan:
+    //: 1 For each length up to 16, create an object by inserting twice as
+    //:   many values, erasing every other value and inserting back half of
+    //:   them, twice each, in reverse order.  Call 'compact' in the presence
+    //:   of injected exceptions, and verify that the value of the object is
+    //:   that of a copy made before the call.  (C-1, 5)
+    //:
+    //: 2 Verify that the addresses of the elements increase in the order of
+    //:   iteration, that the object allocator has as many blocks in use as
+    //:   that of a copy of the object, and that no memory is allocated from
+    //:   the default allocator.  (C-2..4)
+    //
+    // Testing:
+    //   void compact();
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;  // contains 52 distinct increasing values
+
+    const int MAX_LENGTH = 16;
+
+    if (verbose) printf("\nTesting 'compact'.\n");
+
+    for (int ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const int LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 2 * LENGTH; ++i) {
+            mX.insert(VALUES[i]);
+        }
+        for (int i = 0; i < 2 * LENGTH; i += 2) {
+            mX.erase(VALUES[i].first);
+        }
+        for (int i = 2 * LENGTH - 2; i >= 0; i -= 4) {
+            mX.insert(VALUES[i]);
+            mX.insert(VALUES[i]);
+        }
+
+        const Obj W(X, &sa);
+
+        const bsls::Types::Int64 NUM_IN_USE = oa.numBlocksInUse();
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            ASSERTV(ti, W == X);
+
+            mX.compact();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERTV(ti, W == X);
+
+        CIter prev = X.end();
+        for (CIter it = X.begin(); it != X.end(); prev = it, ++it) {
+            if (prev != X.end()) {
+                ASSERTV(ti, bsls::Util::addressOf(*prev)
+                                                < bsls::Util::addressOf(*it));
+            }
+        }
+
+        {
+            bslma::TestAllocator ca("copy", veryVeryVeryVerbose);
+
+            const Obj Y(X, &ca);
+
+            ASSERTV(ti, ca.numBlocksInUse(), oa.numBlocksInUse(),
+                    ca.numBlocksInUse() == oa.numBlocksInUse());
+        }
+
+        ASSERTV(ti, NUM_IN_USE, oa.numBlocksInUse(),
+                NUM_IN_USE >= oa.numBlocksInUse());
+
+        ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase26()
+{
+    // ------------------------------------------------------------------------
+    // TESTING SORTED-RANGE CONSTRUCTION AND INSERTION
+    //
+    // Concerns:
+    //: 1 Constructing from a range passed with 'sorted_equivalent' creates
+    //:   the same value as the range constructor, and compares no keys (except
+    //:   to verify their order in safe build modes).
+    //:
+    //: 2 Inserting an ordered range into a multimap, with or without
+    //:   'sorted_equivalent', creates the same value as inserting each element
+    //:   individually.
+    //:
+    //: 3 Inserting an ordered range requires a number of comparisons linear
+    //:   in the sizes of the multimap and the range.
+    //:
+    //: 4 Each iterator is dereferenced only once.
+    //:
+    //: 5 Any memory allocation is from the object allocator, and no
+    //:   temporary memory is allocated.
+    //:
+    //: 6 Any memory allocation is exception neutral.
+    //:
+    //: 7 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 Using the table-driven technique, select the rows of the default
+    //:   data whose specification is ordered.
+    //:
+    //: 2 For each such row, create an object with the sorted-range
+    //:   constructor, and verify its value, its allocations, and the number
+    //:   of comparisons made.  (C-1, 4..5)
+    //:
+    //: 3 For each pair of such rows, 'R1' and 'R2', create an object having
+    //:   the value of 'R1', and insert the values of 'R2' (with and without
+    //:   'sorted_equivalent') in the presence of injected exceptions.  Verify
+    //:   that the object has the same value as one created by inserting the
+    //:   values of 'R1' and then those of 'R2' one at a time, the number of
+    //:   comparisons made, and that no temporary memory is allocated.
+    //:   (C-2..6)
+    //:
+    //: 4 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered for a range passed with 'sorted_equivalent' that is not
+    //:   ordered.  (C-7)
+    //
+    // Testing:
+    //   multimap(sorted_equivalent_t, ITER, ITER, const C&, const A&);
+    //   void insert(sorted_equivalent_t, INPUT_ITERATOR first, ITER last);
+    //   CONCERN: Range 'insert' merges an ordered range in linear time.
+    // ------------------------------------------------------------------------
+
+    const size_t NUM_DATA                  = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    if (verbose) printf("\nTesting sorted-range constructor.\n");
+
+    for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE   = DATA[ti].d_line;
+        const char *const SPEC   = DATA[ti].d_spec;
+        const size_t      LENGTH = strlen(DATA[ti].d_results);
+
+        if (0 != strcmp(SPEC, DATA[ti].d_results)) {
+            continue;
+        }
+
+        TestValues CONT(SPEC);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(bsl::sorted_equivalent, CONT.begin(), CONT.end(), COMP(), &oa);
+        const Obj& X = mX;
+
+        CONT.resetIterators();
+
+        const Obj Y(CONT.begin(), CONT.end(), COMP(), &oa);
+
+        ASSERTV(LINE, X == Y);
+        ASSERTV(LINE, LENGTH == X.size());
+        ASSERTV(LINE, 0 == verifyContainer(X, TestValues(SPEC), LENGTH));
+
+#ifndef BSLS_ASSERT_SAFE_IS_ACTIVE
+        ASSERTV(LINE, X.key_comp().count(), 0 == X.key_comp().count());
+#endif
+
+        ASSERTV(LINE, oa.numBlocksTotal(), oa.numBlocksInUse(),
+                oa.numBlocksTotal() == oa.numBlocksInUse());
+        ASSERTV(LINE, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+
+    if (verbose) printf("\nTesting insertion of ordered ranges.\n");
+
+    for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE1   = DATA[ti].d_line;
+        const char *const SPEC1   = DATA[ti].d_spec;
+        const size_t      LENGTH1 = strlen(SPEC1);
+
+        if (0 != strcmp(SPEC1, DATA[ti].d_results)) {
+            continue;
+        }
+
+        for (size_t tj = 0; tj < NUM_DATA; ++tj) {
+            const int         LINE2   = DATA[tj].d_line;
+            const char *const SPEC2   = DATA[tj].d_spec;
+            const size_t      LENGTH2 = strlen(SPEC2);
+
+            if (0 != strcmp(SPEC2, DATA[tj].d_results)) {
+                continue;
+            }
+
+            if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+            char expSpec[2 * DEFAULT_MAX_LENGTH + 1];
+            strcpy(expSpec, SPEC1);
+            strcat(expSpec, SPEC2);
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Obj mE(&sa);  const Obj& E = gg(&mE, expSpec);
+
+            TestValues CONT(SPEC2);
+
+            for (int tagged = 0; tagged < 2; ++tagged) {
+                bslma::TestAllocator da("default", veryVeryVeryVerbose);
+                bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPEC1);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    CONT.resetIterators();
+
+                    if (tagged) {
+                        mX.insert(bsl::sorted_equivalent,
+                                  CONT.begin(),
+                                  CONT.end());
+                    }
+                    else {
+                        mX.insert(CONT.begin(), CONT.end());
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE1, LINE2, tagged, E == X);
+
+                ASSERTV(LINE1, LINE2, da.numBlocksTotal(),
+                        0 == da.numBlocksTotal());
+
+                // Without injected exceptions, the insertion requires one
+                // comparison per value to verify the order of the range, and
+                // the merge (at most) one comparison per node passed over and
+                // three more per value.
+
+                mX.clear();
+                gg(&mX, SPEC1);
+
+                const int numBefore = X.key_comp().count();
+
+                const bsls::Types::Int64 NUM_TOTAL  = oa.numBlocksTotal();
+                const bsls::Types::Int64 NUM_IN_USE = oa.numBlocksInUse();
+
+                CONT.resetIterators();
+                if (tagged) {
+                    mX.insert(bsl::sorted_equivalent,
+                              CONT.begin(),
+                              CONT.end());
+                }
+                else {
+                    mX.insert(CONT.begin(), CONT.end());
+                }
+
+                const int NUM_CMP = X.key_comp().count() - numBefore;
+                const int MAX_CMP = static_cast<int>(LENGTH1 + 4 * LENGTH2);
+                ASSERTV(LINE1, LINE2, tagged, NUM_CMP, MAX_CMP,
+                        NUM_CMP <= MAX_CMP);
+                ASSERTV(LINE1, LINE2, tagged, E == X);
+
+                ASSERTV(LINE1, LINE2, tagged,
+                        oa.numBlocksTotal() - NUM_TOTAL
+                                        == oa.numBlocksInUse() - NUM_IN_USE);
+            }
+        }
+    }
+
+    if (verbose) printf("\nNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        TestValues CONT("ABCCBA");
+
+        ASSERT_SAFE_PASS(Obj(bsl::sorted_equivalent,
+                             CONT.index(0),
+                             CONT.index(0)));
+        CONT.resetIterators();
+        ASSERT_SAFE_PASS(Obj(bsl::sorted_equivalent,
+                             CONT.index(0),
+                             CONT.index(4)));
+        CONT.resetIterators();
+        ASSERT_SAFE_FAIL(Obj(bsl::sorted_equivalent,
+                             CONT.index(2),
+                             CONT.index(5)));
+        CONT.resetIterators();
+        ASSERT_SAFE_FAIL(Obj(bsl::sorted_equivalent,
+                             CONT.index(3),
+                             CONT.index(6)));
+
+        Obj mX;
+        CONT.resetIterators();
+        ASSERT_SAFE_FAIL(mX.insert(bsl::sorted_equivalent,
+                                   CONT.index(1),
+                                   CONT.index(5)));
+        ASSERT(mX.empty());
+    }
+}
+
+
 template <class KEY, class VALUE, class COMP, class ALLOC>
 void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase25()
 {
@@ -6513,7 +6846,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6588,6 +6921,24 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'compact'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase27,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+        TestDriver<TestKeyType, TestValueType>::testCase27();
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING SORTED-RANGE CONSTRUCTION AND INSERTION
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase26,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+        TestDriver<TestKeyType, TestValueType>::testCase26();
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
@@ -121,6 +121,9 @@ BSLS_IDENT("$Id: $")
 //  |                                                    | otherwise, where N |
 //  |                                                    | is distance(i1,i2) |
 //  +----------------------------------------------------+--------------------+
+//  | multiset<K> a(sorted_equivalent, i1, i2);          | O[N]               |
+//  | multiset<K> a(sorted_equivalent, i1, i2, c, al);   |                    |
+//  +----------------------------------------------------+--------------------+
 //  | a.~multiset<K>(); (destruction)                    | O[n]               |
 //  +----------------------------------------------------+--------------------+
 //  | a = b;            (assignment)                     | O[n]               |
@@ -159,6 +162,16 @@ BSLS_IDENT("$Id: $")
 //  |                                                    |                    |
 //  |                                                    | where N is         |
 //  |                                                    | n + distance(i1,i2)|
+//  |                                                    | or O[N] if [i1,i2) |
+//  |                                                    | is sorted with     |
+//  |                                                    | 'a.value_comp()'   |
+//  |                                                    | and that is less   |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_equivalent, i1, i2)                | O[min(N, log(N) *  |
+//  |                                                    |   distance(i1,i2))]|
+//  |                                                    |                    |
+//  |                                                    | where N is         |
+//  |                                                    | n + distance(i1,i2)|
 //  +----------------------------------------------------+--------------------+
 //  | a.erase(p1)                                        | amortized constant |
 //  +----------------------------------------------------+--------------------+
@@ -173,6 +186,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.key_comp()                                       | O[1]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.value_comp()                                     | O[1]               |
@@ -423,6 +438,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_setcomparator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_SORTEDTAG
+#include <bslstl_sortedtag.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
 #include <bslstl_stdexceptutil.h>
 #endif
@@ -463,6 +482,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -570,6 +593,46 @@ class multiset {
         // Return a reference providing modifiable access to the
         // comparator for this tree.
 
+    template <class INPUT_ITERATOR>
+    void buildSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Append to this multiset, which is empty, a newly created node
+        // holding each 'value_type' object in the ordered prefix of the
+        // sequence starting at the specified '*first' element and ending
+        // immediately before the specified 'last' element, and rebuild the
+        // resulting vine (see 'bslalg_rbtreeutil') into a balanced tree; then
+        // insert the value of the object ending that prefix (if any), and load
+        // into '*first' the position following that object.  Each object in
+        // the prefix except the first requires one comparison.  The behavior
+        // is undefined unless this multiset is empty and '*first != last'.
+        // Note that if an exception is thrown, the tree of this multiset may
+        // be left as a vine, which can only be destroyed (e.g., by a
+        // 'bslalg::RbTreeUtilTreeProctor').
+
+    template <class INPUT_ITERATOR>
+    void insertSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the ordered prefix of the sequence starting at the specified
+        // '*first' element and ending immediately before the specified 'last'
+        // element, followed by the value of the object ending that prefix (if
+        // any), and load into '*first' the position following the last object
+        // inserted.  The nodes for the prefix are created as a vine (see
+        // 'bslalg_rbtreeutil'), requiring one comparison for each object
+        // except the first, and the vine is then merged into this multiset.
+        // The behavior is undefined if '*first == last'.  Note that each
+        // object in the sequence is accessed only once, as required for an
+        // input iterator.
+
+    template <class INPUT_ITERATOR>
+    void appendSortedRange(BloombergLP::bslalg::RbTreeAnchor *vine,
+                           INPUT_ITERATOR                     first,
+                           INPUT_ITERATOR                     last);
+        // Append to the specified 'vine' (see 'bslalg_rbtreeutil') a newly
+        // created node holding each 'value_type' object in the sequence
+        // starting at the specified 'first' element and ending immediately
+        // before the specified 'last' element, without comparing them.  The
+        // behavior is undefined unless the objects in the sequence are
+        // ordered, and none is ordered before the last node of 'vine'.
+
     void quickSwap(multiset& other);
         // Efficiently exchange the value and comparator of this object with
         // the value of the specified 'other' object.  This method provides
@@ -673,6 +736,40 @@ class multiset {
         // that the (template parameter) type 'KEY' be "copy-constructible"
         // (see {Requirements on 'KEY'}).
 
+    template <class INPUT_ITERATOR>
+    multiset(sorted_equivalent_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a multiset, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element, which are (as
+        // asserted by passing 'bsl::sorted_equivalent') ordered according to
+        // the identified 'comparator'.  Optionally specify a 'comparator' used
+        // to order the keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'allocator' used to
+        // supply memory.  If 'allocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the template parameter 'ALLOCATOR' argument
+        // is of type 'bsl::allocator' (the default) then 'allocator', if
+        // supplied, shall be convertible to 'bslma::Allocator *'.  If the
+        // template parameter 'ALLOCATOR' argument is of type 'bsl::allocator'
+        // and 'allocator' is not supplied, the currently installed default
+        // allocator will be used to supply memory.  This operation has O[N]
+        // complexity, where N is the number of elements between 'first' and
+        // 'last', and does not compare keys (except to verify their order in
+        // safe build modes).  The (template parameter) type 'INPUT_ITERATOR'
+        // shall meet the requirements of an input iterator defined in the
+        // C++11 standard [24.2.3] providing access to values of a type
+        // convertible to 'value_type'.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last', and the values in that
+        // sequence are ordered according to 'comparator'.  This method
+        // requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" (see {Requirements on 'KEY'}).
+
     ~multiset();
         // Destroy this object.
 
@@ -725,15 +822,40 @@ class multiset {
         // (template parameter) type 'KEY' be "copy-constructible" (see
         // {Requirements on 'KEY'}).
 
-    template <class InputIterator>
-    void insert(InputIterator first, InputIterator last);
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
         // Insert into this multiset the value of each 'value_type' object in
         // the range starting at the specified 'first' iterator and ending
-        // immediately before the specified 'last' iterator.  The (template
-        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
-        // input iterator defined in the C++11 standard [24.2.3] providing
-        // access to values of a type convertible to 'value_type'.  This method
-        // requires that the (template parameter) type 'KEY' be
+        // immediately before the specified 'last' iterator.  If the range is
+        // ordered according to the comparator of this multiset, this operation
+        // has O[n + N] complexity if 'N * log(n + N)' is at least 'n + N', and
+        // O[N * log(n + N)] complexity otherwise, where n is the size of this
+        // multiset and N is the number of elements in the range; otherwise it
+        // has O[N * log(n + N)] complexity.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible" (see
+        // {Requirements on 'KEY'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, which are (as
+        // asserted by passing 'bsl::sorted_equivalent') ordered according to
+        // the comparator of this multiset.  This operation has O[n + N]
+        // complexity if 'N * log(n + N)' is at least 'n + N', and
+        // O[N * log(n + N)] complexity otherwise, where n is the size of this
+        // multiset and N is the number of elements in the range.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless the values in the
+        // range are ordered according to the comparator of this multiset.
+        // This method requires that the (template parameter) type 'KEY' be
         // "copy-constructible" (see {Requirements on 'KEY'}).
 
     iterator erase(const_iterator position);
@@ -774,6 +896,18 @@ class multiset {
         // empty after this call, but allocated memory may be retained for
         // future use.
 
+    void compact();
+        // Reallocate the nodes of this multiset contiguously, in the order of
+        // iteration, and release all the memory previously used for nodes.
+        // Each element is copied into its new node, and the original element
+        // destroyed.  All iterators, pointers, and references to elements of
+        // this multiset are invalidated.  If an exception is thrown, this
+        // multiset is not modified.  Note that, after a long sequence of
+        // insertions and removals, the nodes visited by iterating over a
+        // multiset are typically scattered across memory, and that this method
+        // restores the locality of iteration, at the cost of temporarily
+        // allocating memory for a second copy of the elements.
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the first
         // 'value_type' object that is the same as 'key' in ordered sequence
@@ -1072,6 +1206,93 @@ multiset<KEY, COMPARATOR, ALLOCATOR>::comparator()
     return d_compAndAlloc;
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::buildSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(0 == d_tree.numNodes());
+    BSLS_ASSERT_SAFE(*first != last);
+
+    BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                            &d_tree,
+                                            nodeFactory().createNode(**first));
+    for (++*first; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (this->comparator()(value, *d_tree.rootNode())) {
+            // 'value' ends the ordered prefix, so build the tree before
+            // inserting 'value' normally.
+
+            BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+            insert(value);
+            ++*first;
+            return;                                                   // RETURN
+        }
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                             &d_tree,
+                                             nodeFactory().createNode(value));
+    }
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::insertSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(*first != last);
+
+    BloombergLP::bslalg::RbTreeAnchor                       newNodes;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &newNodes,
+                                                               &nodeFactory());
+
+    BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                            &newNodes,
+                                            nodeFactory().createNode(**first));
+    for (++*first; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (this->comparator()(value, *newNodes.rootNode())) {
+            // 'value' ends the ordered prefix, so merge the prefix before
+            // inserting 'value' normally.
+
+            BloombergLP::bslalg::RbTreeUtil::merge(&d_tree,
+                                                   &newNodes,
+                                                   this->comparator(),
+                                                   false);
+            insert(value);
+            ++*first;
+            return;                                                   // RETURN
+        }
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                             &newNodes,
+                                             nodeFactory().createNode(value));
+    }
+    BloombergLP::bslalg::RbTreeUtil::merge(&d_tree,
+                                           &newNodes,
+                                           this->comparator(),
+                                           false);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::appendSortedRange(
+                                    BloombergLP::bslalg::RbTreeAnchor *vine,
+                                    INPUT_ITERATOR                     first,
+                                    INPUT_ITERATOR                     last)
+{
+    for (; first != last; ++first) {
+        BloombergLP::bslalg::RbTreeNode *node =
+                                              nodeFactory().createNode(*first);
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(vine, node);
+
+        BSLS_ASSERT_SAFE(!node->leftChild()
+                      || !this->comparator()(*node, *node->leftChild()));
+    }
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 void multiset<KEY, COMPARATOR, ALLOCATOR>::quickSwap(multiset& other)
@@ -1120,36 +1341,44 @@ multiset<KEY, COMPARATOR, ALLOCATOR>::multiset(INPUT_ITERATOR    first,
                                                                &d_tree,
                                                                &nodeFactory());
 
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inseted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
+        // The following guarantees linear time to insert an ordered sequence
+        // of values (as required by the standard).  The nodes for the ordered
+        // prefix of the sequence are appended to a vine (see
+        // 'bslalg_rbtreeutil') without rebalancing, and the vine is then
+        // rebuilt into a balanced tree in a single pass.
 
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
-
-            const value_type& value = *first;
-            if (this->comparator()(value, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
-            BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
-                                                                        value);
-            BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                      prevNode,
-                                                      false,
-                                                      node);
-            prevNode = node;
+        buildSortedPrefix(&first, last);
+
+        // The remaining values are not in order, so insert them normally.
+
+        for (; first != last; ++first) {
+            insert(*first);
         }
 
         proctor.release();
     }
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+multiset<KEY, COMPARATOR, ALLOCATOR>::multiset(
+                                           sorted_equivalent_t,
+                                           INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           const COMPARATOR& comparator,
+                                           const ALLOCATOR&  allocator)
+: d_compAndAlloc(comparator, allocator)
+, d_tree()
+{
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &d_tree,
+                                                               &nodeFactory());
+    appendSortedRange(&d_tree, first, last);
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+    proctor.release();
+}
+
 
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1299,16 +1528,43 @@ multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
 
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 template <class INPUT_ITERATOR>
-inline
 void multiset<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                                   INPUT_ITERATOR last)
 {
-    while (first != last) {
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    // The values in the ordered prefix of the range are merged into this
+    // multiset in linear time (or inserted one at a time, if they are few).
+
+    insertSortedPrefix(&first, last);
+
+    // The remaining values are not in order, so insert them normally.
+
+    for (; first != last; ++first) {
         insert(*first);
-        ++first;
     }
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                                     sorted_equivalent_t,
+                                                     INPUT_ITERATOR      first,
+                                                     INPUT_ITERATOR      last)
+{
+    BloombergLP::bslalg::RbTreeAnchor                       newNodes;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &newNodes,
+                                                               &nodeFactory());
+    appendSortedRange(&newNodes, first, last);
+    BloombergLP::bslalg::RbTreeUtil::merge(&d_tree,
+                                           &newNodes,
+                                           this->comparator(),
+                                           false);
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
@@ -1402,6 +1658,23 @@ void multiset<KEY, COMPARATOR, ALLOCATOR>::clear()
 #endif
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::compact()
+{
+    if (0 < size()) {
+        multiset other(this->comparator().keyComparator(),
+                       nodeFactory().allocator());
+
+        // Reserve the nodes in a single chunk, handing them out in address
+        // order, and append them to a vine in the order of this object.
+
+        other.nodeFactory().reserveNodes(size());
+        other.appendSortedRange(&other.d_tree, cbegin(), cend());
+        BloombergLP::bslalg::RbTreeUtil::vineToTree(&other.d_tree);
+        quickSwap(other);
+    }
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
@@ -57,6 +57,18 @@ BSLS_IDENT("$Id: $")
 // otherwise, the string-stream will use the default allocator installed at the
 // time of the string-stream's construction (see 'bslma_default').
 //
+///Accessing the Buffered Sequence Without Copying
+///-----------------------------------------------
+// The standard 'str' accessor returns a copy of the characters written to the
+// string-stream.  A client that builds a large message in a string-stream can
+// avoid that copy using the non-standard methods 'view', which returns a
+// 'bslstl::StringRefImp' referring to the buffered characters in place,
+// 'release', which moves the buffered characters out of the string-stream
+// into a 'basic_string', and 'reserve', which sets aside capacity for a
+// message of known (or estimated) length.  These methods forward to the
+// methods of the same names of 'bsl::basic_stringbuf' (see
+// 'bslstl_stringbuf').
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -109,6 +121,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_stringbuf.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_TYPETRAITS
 #include <bslalg_typetraits.h>
 #endif
@@ -117,6 +133,11 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraitusesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>       // for 'std::size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
 #ifndef INCLUDED_IOS
 #include <ios>
 #define INCLUDED_IOS
@@ -147,6 +168,7 @@ class basic_ostringstream
     typedef StringBufContainer<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>
                                                                  BaseType;
     typedef bsl::basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> StringType;
+    typedef BloombergLP::bslstl::StringRefImp<CHAR_TYPE>         StringRefType;
     typedef native_std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>    BaseStream;
     typedef native_std::ios_base                                 ios_base;
 
@@ -201,11 +223,32 @@ class basic_ostringstream
         // Reset the internally buffered sequence of characters maintained by
         // this stream object to the specified 'value'.
 
+    void release(StringType *result);
+        // Load into the specified 'result' the sequence of characters
+        // maintained by this stream object, and reset that sequence to the
+        // empty sequence.  Note that the characters are not copied if
+        // 'result' uses the same allocator as this stream object.
+
+    StringType release();
+        // Return the sequence of characters maintained by this stream object,
+        // and reset that sequence to the empty sequence.  Note that the
+        // characters are not copied.
+
+    void reserve(native_std::size_t numCharacters);
+        // Ensure that this stream object can buffer a sequence of at least
+        // the specified 'numCharacters' characters without reallocating.
+
     // ACCESSORS
     StringType str() const;
         // Return the sequence of characters that have been written to this
         // stream object.
 
+    StringRefType view() const;
+        // Return a reference to the sequence of characters maintained by this
+        // stream object.  The returned reference is invalidated by any
+        // operation that modifies this stream object (including output).
+        // Note that, unlike 'str', this method does not copy the characters.
+
     StreamBufType *rdbuf() const;
         // Return an address providing modifiable access to the
         // 'basic_stringbuf' object that is internally used by this string
@@ -293,6 +336,30 @@ void basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::str(
     this->rdbuf()->str(value);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+void basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::release(
+                                                            StringType *result)
+{
+    this->rdbuf()->release(result);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+typename basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringType
+basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::release()
+{
+    return this->rdbuf()->release();
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+void basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::reserve(
+                                              native_std::size_t numCharacters)
+{
+    this->rdbuf()->reserve(numCharacters);
+}
+
 // ACCESSORS
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 inline
@@ -302,6 +369,14 @@ basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::str() const
     return this->rdbuf()->str();
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+typename basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringRefType
+basic_ostringstream<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::view() const
+{
+    return this->rdbuf()->view();
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 inline
 typename
@@ -14,6 +14,7 @@
 
 #include <bsls_bsltestutil.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsltf_stdtestallocator.h>
 
@@ -49,13 +50,17 @@
 //
 // MANIPULATORS
 // [ 3] void str(const StringType& value);
+// [ 8] void release(StringType *result);
+// [ 8] StringType release();
+// [ 8] void reserve(size_t numCharacters);
 //
 // ACCESSORS
 // [ 3] StringType str() const;
+// [ 8] StringRefType view() const;
 // [ 2] StreamBufType *rdbuf() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 7] CONCERN: Standard allocator can be used
 // [ *] CONCERN: In no case does memory come from the global allocator.
 
@@ -1087,6 +1092,106 @@ void testCase7()
     }
 }
 
+template <class StreamT, class BaseT, class StringT, class CharT>
+void testCase8()
+{
+    // ------------------------------------------------------------------------
+    // 'view', 'release', AND 'reserve'
+    //   Ensure that the non-standard methods providing access to the buffered
+    //   characters without copying them work as expected.
+    //
+    // Concerns:
+    //: 1 'view' refers to the sequence of characters written to the stream.
+    //:
+    //: 2 'release' loads the buffered characters into the target string, and
+    //:   leaves the stream empty, without allocating memory if the target
+    //:   string uses the same allocator as the stream.
+    //:
+    //: 3 The string returned by 'release()' has the value of the buffered
+    //:   characters, and uses the allocator of the stream.
+    //:
+    //: 4 After 'reserve(N)', 'N' characters can be written to the stream
+    //:   without allocating memory.
+    //:
+    //: 5 None of these methods allocates memory from the default allocator.
+    //
+    // Plan:
+    //   The table-driven technique is used.
+    //
+    //: 1 For each value, 'S', in a small set of string values:  (C-1..5)
+    //:
+    //:   1 Create an object using the default constructor, and 'reserve'
+    //:     capacity for 'S'.
+    //:
+    //:   2 Write 'S' to the stream, and verify that no memory was allocated.
+    //:     (C-4)
+    //:
+    //:   3 Verify that 'view' refers to 'S'.  (C-1)
+    //:
+    //:   4 'release' the buffered characters into a string using the same
+    //:     allocator, and verify the value of the string, that no memory was
+    //:     allocated, and that 'view' is empty.  (C-2)
+    //:
+    //:   5 Write 'S' to the stream again, call 'release()', and verify the
+    //:     value and allocator of the returned string.  (C-3)
+    //:
+    //:   6 Verify that no memory was allocated from the default allocator.
+    //:     (C-5)
+    //
+    // Testing:
+    //   void release(StringType *result);
+    //   StringType release();
+    //   void reserve(size_t numCharacters);
+    //   StringRefType view() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\n'view', 'release', AND 'reserve'"
+                        "\n================================\n");
+
+    using namespace BloombergLP;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_STRLEN_DATA; ++ti) {
+        const int LENGTH = STRLEN_DATA[ti].d_length;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        StringT mS(&sa);  const StringT& S = mS;
+        loadString(&mS, LENGTH);
+
+        StreamT mX(&sa);  const StreamT& X = mX;
+
+        mX.reserve(LENGTH);
+        bsls::Types::Int64 numAllocations = sa.numAllocations();
+
+        mX.write(S.data(), LENGTH);
+        ASSERTV(ti, numAllocations == sa.numAllocations());
+        ASSERTV(ti, S == X.view());
+
+        StringT mR(&sa);  const StringT& R = mR;
+
+        numAllocations = sa.numAllocations();
+
+        mX.release(&mR);
+        ASSERTV(ti, numAllocations == sa.numAllocations());
+        ASSERTV(ti, S == R);
+        ASSERTV(ti, X.view().isEmpty());
+
+        mX.write(S.data(), LENGTH);
+
+        const StringT T = mX.release();
+        ASSERTV(ti, S == T);
+        ASSERTV(ti,
+                T.get_allocator() == typename StringT::allocator_type(&sa));
+        ASSERTV(ti, X.view().isEmpty());
+
+        ASSERTV(ti, 0 == da.numBlocksTotal());
+    }
+}
+
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -1145,7 +1250,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1177,6 +1282,10 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 8: {
+        testCase8<Obj,  std::ostream,  bsl::string,  char>();
+        testCase8<WObj, std::wostream, bsl::wstring, wchar_t>();
+      } break;
       case 7: {
         testCase7<char>();
         testCase7<wchar_t>();
@@ -12,8 +12,9 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //   bslstl::priority_queue: template of highest-priority-first data structure
+//   bsl::dary_priority_queue: 'priority_queue' held as a d-ary heap
 //
-//@SEE_ALSO: bslstl_queue, bslstl_stack
+//@SEE_ALSO: bslstl_queue, bslstl_stack, bslstl_addressablepriorityqueue
 //
 //@DESCRIPTION: This component defines a class template, 'bsl::priority_queue',
 // holding a container (of a parameterized type 'CONTAINER' containing elements
@@ -67,6 +68,26 @@ BSLS_IDENT("$Id: $")
 //  | const_reference top() const;         | c.front();                |
 //  +--------------------------------------+---------------------------+
 //
+///D-ary Priority Queues
+///---------------------
+// 'priority_queue' holds its elements as a binary heap, maintained by the
+// 'native_std::push_heap' and 'native_std::pop_heap' algorithms.  This
+// component also defines a class template, 'bsl::dary_priority_queue', having
+// the same interface as 'priority_queue', and an additional (template
+// parameter) 'ARITY', defaulting to 4, that holds its elements as a heap in
+// which each element has up to 'ARITY' children, maintained by the algorithms
+// of 'bslalg::DAryHeapUtil'.  A 4-ary heap has half the height of a binary
+// heap, so that 'push' and 'pop' move half as many elements, at the cost of
+// more comparisons in 'pop' (see {'bslalg_daryheaputil'|Choosing an Arity}).
+// Elements of bitwise moveable types are moved by copying their bytes, and
+// elements of other types by swapping them, so that elements of
+// allocator-aware types having an efficient 'swap' are not copied.
+//
+// A 'dary_priority_queue' presents its elements in the same order as a
+// 'priority_queue', but its container holds them in a different order, so
+// that 'c' (or a container supplied at construction) must not be manipulated
+// as a binary heap.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -316,6 +337,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_vector.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_DARYHEAPUTIL
+#include <bslalg_daryheaputil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_SWAPUTIL
 #include <bslalg_swaputil.h>
 #endif
@@ -532,6 +557,193 @@ template <class VALUE, class CONTAINER, class COMPARATOR>
 void swap(priority_queue<VALUE, CONTAINER, COMPARATOR>& lhs,
           priority_queue<VALUE, CONTAINER, COMPARATOR>& rhs);
 
+                       // =========================
+                       // class dary_priority_queue
+                       // =========================
+
+template <class VALUE,
+          class CONTAINER  = vector<VALUE>,
+          class COMPARATOR = native_std::less<typename CONTAINER::value_type>,
+          int   ARITY      = 4>
+class dary_priority_queue
+    // This class is a value-semantic class template, having the same
+    // interface as 'priority_queue', adapting a container of the
+    // parameterized 'CONTAINER' type that holds elements of the parameterized
+    // 'VALUE' type, arranged as a heap in which each element has up to the
+    // (template parameter) 'ARITY' children, to provide a
+    // highest-priority-first priority queue data structure, where the
+    // priorities of elements are compared by a comparator of the parameterized
+    // 'COMPARATOR' type.  'CONTAINER' must provide random-access iterators.
+    // The container object held by a 'dary_priority_queue' class object is
+    // referenced as 'c' in the following documentation.
+{
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::DAryHeapUtil<ARITY> HeapUtil;
+
+  protected:
+    // DATA
+    CONTAINER c;        // container for elements in the
+                        // 'dary_priority_queue', held as a d-ary heap
+
+    COMPARATOR comp;    // comparator that defines the priority order of
+                        // elements in the 'dary_priority_queue'
+
+  public:
+    // PUBLIC TYPES
+    typedef typename CONTAINER::value_type      value_type;
+    typedef typename CONTAINER::reference       reference;
+    typedef typename CONTAINER::const_reference const_reference;
+    typedef typename CONTAINER::size_type       size_type;
+    typedef          CONTAINER                  container_type;
+
+    // CREATORS
+    dary_priority_queue(const COMPARATOR& comparator,
+                        const CONTAINER&  container);
+        // Create a priority queue, adapting the specified 'container' of the
+        // (template parameter) type 'CONTAINER', and having the specified
+        // 'comparator' of the (template parameter) type 'COMPARATOR' to order
+        // priorities of elements held in 'container'.
+
+    explicit dary_priority_queue();
+        // Create an empty priority queue, adapting a default-constructed
+        // container of the (template parameter) type 'CONTAINER'.  Use a
+        // default-constructed comparator of the (template parameter) type
+        // 'COMPARATOR' to order priorities of elements.
+
+    explicit dary_priority_queue(const COMPARATOR& comparator);
+        // Create an empty priority queue, adapting a default-constructed
+        // container of the parameterized 'CONTAINER' type, and having the
+        // specified 'comparator' of the (template parameter) type 'COMPARATOR'
+        // to order priorities of elements in 'container'.
+
+    template <class INPUT_ITERATOR>
+    dary_priority_queue(INPUT_ITERATOR first,
+                        INPUT_ITERATOR last);
+        // Create a priority queue, adapting a default-constructed container of
+        // the (template parameter) type 'CONTAINER', and inserting into the
+        // container a sequence of 'value_type' elements that starts at the
+        // specified 'first' and ends immediately before the specified 'last'.
+        // Use a default-constructed comparator of the parameterized
+        // 'COMPARATOR' type to order the priorities of elements.
+
+    template <class INPUT_ITERATOR>
+    dary_priority_queue(INPUT_ITERATOR    first,
+                        INPUT_ITERATOR    last,
+                        const COMPARATOR& comparator,
+                        const CONTAINER&  container);
+        // Create a priority queue, adapting the specified 'container', having
+        // the specified 'comparator' to order the priorities of elements,
+        // including those originally existed in 'container', and those
+        // inserted into the 'container' from a sequence of 'value_type'
+        // elements starting at the specified 'first', and ending immediately
+        // before the specified 'last'.
+
+    dary_priority_queue(const dary_priority_queue& original);
+        // Create a priority queue having the same value as the specified
+        // 'original'.  Use the comparator from 'original' to order the
+        // priorities of elements.
+
+    template <class ALLOCATOR>
+    explicit dary_priority_queue(
+                           const ALLOCATOR& allocator,
+                           typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                               CONTAINER,
+                                               ALLOCATOR>::VALUE>::type * = 0);
+        // Create an empty priority queue that adapts a default-constructed
+        // container of the parameterized 'CONTAINER' type and will use the
+        // specified 'allocator' to supply memory.  Use a default-constructed
+        // comparator of the parameterized 'COMPARATOR' type to order the
+        // priorities of elements.  Note that the 'ALLOCATOR' parameter type
+        // has to be convertible to the allocator of the 'CONTAINER' parameter
+        // type, 'CONTAINER::allocator_type'.  Otherwise this constructor is
+        // disabled.
+
+    template <class ALLOCATOR>
+    dary_priority_queue(const COMPARATOR& comparator,
+                        const ALLOCATOR&  allocator,
+                        typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                               CONTAINER,
+                                               ALLOCATOR>::VALUE>::type * = 0);
+        // Create an empty priority queue that adapts a default-constructed
+        // container of the parameterized 'CONTAINER' type and will use the
+        // specified 'allocator' to supply memory, and the specified
+        // 'comparator' to order priorities of elements.  Note that the
+        // 'ALLOCATOR' parameter type has to be convertible to the allocator of
+        // the 'CONTAINER' parameter type, 'CONTAINER::allocator_type'.
+        // Otherwise this constructor is disabled.
+
+    template <class ALLOCATOR>
+    dary_priority_queue(const COMPARATOR& comparator,
+                        const CONTAINER&  container,
+                        const ALLOCATOR&  allocator,
+                        typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                               CONTAINER,
+                                               ALLOCATOR>::VALUE>::type * = 0);
+        // Create a priority queue that will use the specified 'allocator' to
+        // supply memory, and the specified 'comparator' to order priorities of
+        // elements in the specified 'container'.  Note that the 'ALLOCATOR'
+        // parameter type has to be convertible to the allocator of the
+        // 'CONTAINER' parameter type, 'CONTAINER::allocator_type'.  Otherwise
+        // this constructor is disabled.
+
+    template <class ALLOCATOR>
+    dary_priority_queue(const dary_priority_queue& original,
+                        const ALLOCATOR&           allocator,
+                        typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                               CONTAINER,
+                                               ALLOCATOR>::VALUE>::type * = 0);
+        // Create a priority queue having the same value as the specified
+        // 'original' that will use the specified 'allocator' to supply memory.
+        // Use the comparator from 'original' to order the priorities of
+        // elements.  Note that the 'ALLOCATOR' parameter type has to be
+        // convertible to the allocator of the 'CONTAINER' parameter type,
+        // 'CONTAINER::allocator_type'.  Otherwise this constructor is
+        // disabled.
+
+    // MANIPULATORS
+    void push(const value_type& value);
+        // Insert a new element having the specified priority 'value' into this
+        // 'dary_priority_queue' object.  In effect, performs
+        // 'c.push_back(value);'.
+
+    void pop();
+        // Remove the top element from this 'dary_priority_queue' object that
+        // has the highest priority.  In effect, performs 'c.pop_back();'.  The
+        // behavior is undefined if there is currently no elements in this
+        // object.
+
+    void swap(dary_priority_queue& other);
+        // Efficiently exchange the value of this object with the value of the
+        // specified 'other' object.  In effect, performs
+        // 'using bsl::swap; swap(c, other.c);'.
+
+    // ACCESSORS
+    bool empty() const;
+        // Return 'true' if this 'dary_priority_queue' object contains no
+        // elements, and 'false' otherwise.  In effect, performs
+        // 'return c.empty();'.
+
+    size_type size() const;
+        // Return the number of elements in this 'dary_priority_queue' object.
+        // In effect, performs 'return c.size()'.
+
+    const_reference top() const;
+        // Return the immutable element having the highest priority in this
+        // 'dary_priority_queue' object.  In effect, performs
+        // 'return c.front()'.  The behavior is undefined if there is
+        // currently no elements in this object.
+};
+
+// FREE FUNCTIONS
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+void swap(dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>& lhs,
+          dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>& rhs);
+
 // ===========================================================================
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ===========================================================================
@@ -722,6 +934,192 @@ void swap(priority_queue<VALUE, CONTAINER, COMPARATOR>& lhs,
     lhs.swap(rhs);
 }
 
+                       // -------------------------
+                       // class dary_priority_queue
+                       // -------------------------
+
+// CREATORS
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                                                  const COMPARATOR& comparator,
+                                                  const CONTAINER&  container)
+: c(container)
+, comp(comparator)
+{
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue()
+{
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                                                  const COMPARATOR& comparator)
+: comp(comparator)
+{
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+template <class INPUT_ITERATOR>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                                                       INPUT_ITERATOR    first,
+                                                       INPUT_ITERATOR    last)
+{
+    c.insert(c.end(), first, last);
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+template <class INPUT_ITERATOR>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                                                  INPUT_ITERATOR    first,
+                                                  INPUT_ITERATOR    last,
+                                                  const COMPARATOR& comparator,
+                                                  const CONTAINER&  container)
+: c(container)
+, comp(comparator)
+{
+    c.insert(c.end(), first, last);
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                                           const dary_priority_queue& original)
+: c(original.c)
+, comp(original.comp)
+{
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+template <class ALLOCATOR>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                           const ALLOCATOR& allocator,
+                           typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                                    CONTAINER,
+                                                    ALLOCATOR>::VALUE>::type *)
+: c(allocator)
+, comp(COMPARATOR())
+{
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+template <class ALLOCATOR>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                           const COMPARATOR& comparator,
+                           const ALLOCATOR&  allocator,
+                           typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                                    CONTAINER,
+                                                    ALLOCATOR>::VALUE>::type *)
+: c(allocator)
+, comp(comparator)
+{
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+template <class ALLOCATOR>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                           const COMPARATOR& comparator,
+                           const CONTAINER&  container,
+                           const ALLOCATOR&  allocator,
+                           typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                                    CONTAINER,
+                                                    ALLOCATOR>::VALUE>::type *)
+: c(container, allocator)
+, comp(comparator)
+{
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+template <class ALLOCATOR>
+inline
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::dary_priority_queue(
+                           const dary_priority_queue& original,
+                           const ALLOCATOR&           allocator,
+                           typename enable_if<
+                           BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
+                                                    CONTAINER,
+                                                    ALLOCATOR>::VALUE>::type *)
+: c(original.c, allocator)
+, comp(original.comp)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+void dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::push(
+                                                       const value_type& value)
+{
+    c.push_back(value);
+    HeapUtil::pushHeap(c.begin(), c.end(), comp);
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+void dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::pop()
+{
+    HeapUtil::popHeap(c.begin(), c.end(), comp);
+    c.pop_back();
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+void dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::swap(
+                                                    dary_priority_queue& other)
+{
+    BloombergLP::bslalg::SwapUtil::swap(&c   , &other.c   );
+    BloombergLP::bslalg::SwapUtil::swap(&comp, &other.comp);
+}
+
+// ACCESSORS
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+bool dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::empty() const
+{
+    return c.empty();
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+typename dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::size_type
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::size() const
+{
+    return c.size();
+}
+
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+inline
+typename dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::
+                                                                const_reference
+dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>::top() const
+{
+    return c.front();
+}
+
+// FREE FUNCTIONS
+template <class VALUE, class CONTAINER, class COMPARATOR, int ARITY>
+void swap(dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>& lhs,
+          dary_priority_queue<VALUE, CONTAINER, COMPARATOR, ARITY>& rhs)
+{
+    lhs.swap(rhs);
+}
+
 }  // close namespace bsl
 
 #endif
@@ -110,7 +110,9 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [14] TESTING NON ALLOCATOR SUPPORTING TYPE
-// [15] USAGE EXAMPLE
+// [15] CLASS 'bsl::dary_priority_queue'
+// [16] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'dary_priority_queue' VS. 'priority_queue'
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] ggg(queue<V,C> *object, const char *spec, int verbose = 1);
@@ -2797,6 +2799,236 @@ void TestDriver<VALUE, CONTAINER, COMPARATOR>::testCase1(
     ASSERT(testValues[maxIndex] == X4.top  ());
 }
 
+                         // --------------------
+                         // class DAryTestDriver
+                         // --------------------
+
+template <class VALUE, int ARITY>
+class DAryTestDriver {
+    // Test driver class for 'dary_priority_queue', using a 'priority_queue'
+    // having the same comparator as a model.
+
+    // TYPES
+    typedef bsl::dary_priority_queue<VALUE,
+                                     vector<VALUE>,
+                                     TestComparator<VALUE>,
+                                     ARITY>                  Obj;
+        // type under testing
+
+    typedef bsl::priority_queue<VALUE, vector<VALUE>, TestComparator<VALUE> >
+                                                             Model;
+        // model of the type under testing
+
+    typedef bsltf::TestValuesArray<VALUE>                    TestValues;
+
+    // TEST APPARATUS
+    static bool popsAsModel(Obj *object, Model *model);
+        // Pop every element of the specified 'object' and of the specified
+        // 'model', and return 'true' if they have the same size and their
+        // elements are popped in the same order, and 'false' otherwise.
+
+  public:
+    // TEST CASES
+    static void testCase15();
+        // Test 'dary_priority_queue'.
+};
+
+template <class VALUE, int ARITY>
+bool DAryTestDriver<VALUE, ARITY>::popsAsModel(Obj *object, Model *model)
+{
+    if (object->size() != model->size()) {
+        return false;                                                 // RETURN
+    }
+    while (!model->empty()) {
+        if (!(object->top() == model->top())) {
+            return false;                                             // RETURN
+        }
+        object->pop();
+        model->pop();
+    }
+    return object->empty();
+}
+
+template <class VALUE, int ARITY>
+void DAryTestDriver<VALUE, ARITY>::testCase15()
+{
+    if (verbose) printf("\tARITY = %d\n", ARITY);
+
+    const TestValues VALUES;
+    const int        NUM_VALUES = static_cast<int>(VALUES.size());
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator ma("model",   veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (verbose) printf("\t'push' and 'pop' agree with 'priority_queue'.\n");
+    {
+        Obj   mX(&oa);  const Obj& X = mX;
+        Model mM(&ma);
+
+        ASSERTV(ARITY, 0 == oa.numBlocksTotal());
+        ASSERTV(ARITY, X.empty());
+        ASSERTV(ARITY, 0 == X.size());
+
+        unsigned seed = ARITY;
+        for (int i = 0; i < 2000; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            if (0 == (seed >> 16) % 3 && !X.empty()) {
+                mX.pop();
+                mM.pop();
+            }
+            else {
+                const int INDEX = (seed >> 8) % NUM_VALUES;
+                mX.push(VALUES[INDEX]);
+                mM.push(VALUES[INDEX]);
+            }
+            ASSERTV(ARITY, i, mM.size() == X.size());
+            ASSERTV(ARITY, i, mM.empty() == X.empty());
+            if (!X.empty()) {
+                ASSERTV(ARITY, i, mM.top() == X.top());
+            }
+        }
+        ASSERTV(ARITY, 0 < oa.numBlocksInUse());
+        ASSERTV(ARITY, popsAsModel(&mX, &mM));
+    }
+    ASSERTV(ARITY, 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\tValue constructors.\n");
+    {
+        for (int length = 0; length <= NUM_VALUES; length += 3) {
+            vector<VALUE> values(&za);
+            for (int i = 0; i < length; ++i) {
+                values.push_back(VALUES[(i * 7) % NUM_VALUES]);
+            }
+            vector<VALUE> prefix(values.begin(),
+                                 values.begin() + length / 2,
+                                 &za);
+
+            const TestComparator<VALUE> LESS;
+            const TestComparator<VALUE> GREATER(1, false);
+
+            {
+                Obj   mX(values.begin(), values.end());
+                Model mM(values.begin(), values.end());
+                ASSERTV(ARITY, length, popsAsModel(&mX, &mM));
+            }
+            {
+                Obj   mX(GREATER, values);
+                Model mM(GREATER, values);
+                ASSERTV(ARITY, length, popsAsModel(&mX, &mM));
+            }
+            {
+                Obj   mX(values.begin() + length / 2,
+                         values.end(),
+                         LESS,
+                         prefix);
+                Model mM(values.begin(), values.end());
+                ASSERTV(ARITY, length, popsAsModel(&mX, &mM));
+            }
+            {
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                Obj   mX(GREATER, values, &oa);
+                Model mM(GREATER, values, &ma);
+                ASSERTV(ARITY, length,
+                        (0 < length) == (NUM_BLOCKS < oa.numBlocksTotal()));
+                ASSERTV(ARITY, length, popsAsModel(&mX, &mM));
+            }
+            {
+                Obj   mX(GREATER, &oa);
+                Model mM(GREATER, &ma);
+                for (int i = 0; i < length; ++i) {
+                    mX.push(values[i]);
+                    mM.push(values[i]);
+                }
+                ASSERTV(ARITY, length, popsAsModel(&mX, &mM));
+            }
+        }
+    }
+    ASSERTV(ARITY, 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\tCopy constructors and 'swap'.\n");
+    {
+        Obj   mX(&oa);  const Obj& X = mX;
+        Obj   mY(&oa);  const Obj& Y = mY;
+        Model mM(&ma);
+        Model mN(&ma);
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.push(VALUES[(i * 5) % NUM_VALUES]);
+            mM.push(VALUES[(i * 5) % NUM_VALUES]);
+            if (i % 2) {
+                mY.push(VALUES[i]);
+                mN.push(VALUES[i]);
+            }
+        }
+
+        {
+            Obj   mZ(X);
+            Model mL(mM);
+            ASSERTV(ARITY, popsAsModel(&mZ, &mL));
+        }
+        {
+            const bsls::Types::Int64 NUM_BLOCKS = za.numBlocksTotal();
+
+            Obj   mZ(X, &za);
+            Model mL(mM, &ma);
+            ASSERTV(ARITY, NUM_BLOCKS < za.numBlocksTotal());
+            ASSERTV(ARITY, popsAsModel(&mZ, &mL));
+        }
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+        mX.swap(mY);
+        mM.swap(mN);
+        ASSERTV(ARITY, NUM_BLOCKS == oa.numBlocksTotal());
+        ASSERTV(ARITY, mM.size() == X.size() && mN.size() == Y.size());
+
+        invokeAdlSwap(mX, mY);
+        invokeAdlSwap(mM, mN);
+        ASSERTV(ARITY, NUM_BLOCKS == oa.numBlocksTotal());
+        ASSERTV(ARITY, popsAsModel(&mX, &mM));
+        ASSERTV(ARITY, popsAsModel(&mY, &mN));
+    }
+    ASSERTV(ARITY, 0 == oa.numBlocksInUse());
+    ASSERTV(ARITY, 0 == za.numBlocksInUse());
+    ASSERTV(ARITY, 0 == da.numBlocksInUse());
+}
+
+template <class QUEUE>
+double holdBenchmark(QUEUE              *queue,
+                     int                 length,
+                     int                 numOps,
+                     bsls::Types::Int64 *checksum)
+    // Report the time, in seconds, taken by the specified 'numOps' "hold"
+    // operations (removing the earliest deadline, and scheduling a
+    // pseudo-random later one) on the specified 'queue', holding the
+    // specified 'length' deadlines, and add the deadlines removed to the
+    // specified 'checksum'.  The behavior is undefined unless 'queue' orders
+    // its elements by ascending deadline.
+{
+    unsigned seed = 1;
+    for (int i = 0; i < length; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        queue->push(seed >> 12);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numOps; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const bsls::Types::Int64 deadline = queue->top();
+        *checksum += deadline;
+        queue->pop();
+        queue->push(deadline + (seed >> 12));
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
 // ============================================================================
 //                                  USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -3071,7 +3303,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator ta(veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         // --------------------------------------------------------------------
@@ -3109,6 +3341,90 @@ int main(int argc, char *argv[])
         }
         taskScheduler.processTasks(veryVerbose);
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // CLASS 'bsl::dary_priority_queue'
+        //
+        // Concerns:
+        //: 1 A 'dary_priority_queue' of any arity presents its elements in the
+        //:   same order as a 'priority_queue' having the same comparator,
+        //:   under any sequence of 'push' and 'pop', including duplicate
+        //:   values.
+        //:
+        //: 2 Each constructor arranges the elements it is given as a heap, and
+        //:   uses the supplied comparator and allocator.
+        //:
+        //: 3 The copy constructors copy the elements and the comparator, and
+        //:   'swap' exchanges them without allocating.
+        //:
+        //: 4 All memory is supplied by the object allocator, and is released
+        //:   at destruction.
+        //:
+        //: 5 A container that is not allocator-aware, and a comparator that is
+        //:   a function pointer, are supported.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, and 8, and for 'int' and allocating test
+        //:   types that are and are not bitwise moveable, apply a
+        //:   pseudo-random sequence of 'push' and 'pop' to an object and to a
+        //:   'priority_queue' model, verifying 'top' and 'size' after each
+        //:   operation.  (C-1, 4)
+        //:
+        //: 2 Construct objects, and models, with each value constructor, from
+        //:   sequences of increasing length, and verify that they pop the same
+        //:   elements in the same order.  (C-2, 4)
+        //:
+        //: 3 Copy objects, with and without an allocator, and swap them, with
+        //:   the member and free 'swap', verifying the allocations and the
+        //:   order in which the results pop their elements.  (C-3..4)
+        //:
+        //: 4 Instantiate a 'dary_priority_queue' over 'NonAllocCont', and one
+        //:   with a comparator of type 'bool (*)(int, int)'.  (C-5)
+        //
+        // Testing:
+        //   CLASS 'bsl::dary_priority_queue'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS 'bsl::dary_priority_queue'"
+                            "\n================================\n");
+
+        DAryTestDriver<int, 2>::testCase15();
+        DAryTestDriver<int, 3>::testCase15();
+        DAryTestDriver<int, 4>::testCase15();
+        DAryTestDriver<int, 8>::testCase15();
+        DAryTestDriver<TestValueType, 2>::testCase15();
+        DAryTestDriver<TestValueType, 4>::testCase15();
+        DAryTestDriver<bsltf::AllocBitwiseMoveableTestType, 4>::testCase15();
+
+        {
+            typedef dary_priority_queue<int, NonAllocCont<int> > NonAllocObj;
+
+            NonAllocObj mX;  const NonAllocObj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX.push((i * 7) % 20);
+            }
+            for (int i = 19; i >= 0; --i) {
+                ASSERTV(i, i == X.top());
+                mX.pop();
+            }
+            ASSERT(X.empty());
+        }
+        {
+            typedef bool (*Comparator)(int, int);
+            typedef dary_priority_queue<int, vector<int>, Comparator, 3>
+                                                                  FunctionObj;
+
+            FunctionObj mX(&intLessThan, &ta);  const FunctionObj& X = mX;
+
+            for (int i = 0; i < NUM_SPECIAL_INT_VALUES; ++i) {
+                mX.push(SPECIAL_INT_VALUES[i]);
+            }
+            ASSERT(INT_MAX == X.top());
+            mX.pop();
+            ASSERT(2 == X.top());
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING NON ALLOCATOR SUPPORTING TYPE
@@ -3291,6 +3607,80 @@ int main(int argc, char *argv[])
                                                        SPECIAL_INT_VALUES,
                                                        NUM_SPECIAL_INT_VALUES);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'dary_priority_queue' VS. 'priority_queue'
+        //
+        // Concerns:
+        //   Provide a benchmark of a scheduler-style workload on a
+        //   'dary_priority_queue' of several arities, compared with a
+        //   'priority_queue'.
+        //
+        // Plan:
+        //   For queues holding various numbers of 64-bit deadlines, report the
+        //   time taken by (by default) 10 million "hold" operations, each
+        //   removing the earliest deadline and scheduling a later one, with
+        //   memory supplied by the 'new'/'delete' allocator.
+        //
+        // Testing:
+        //   PERFORMANCE: 'dary_priority_queue' VS. 'priority_queue'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'dary_priority_queue' VS."
+                            " 'priority_queue'"
+                            "\n======================================"
+                            "=================\n");
+
+        typedef bsls::Types::Int64                   Deadline;
+        typedef vector<Deadline>                     Container;
+        typedef native_std::greater<Deadline>        Earliest;
+
+        typedef priority_queue<Deadline, Container, Earliest>         Binary;
+        typedef dary_priority_queue<Deadline, Container, Earliest, 2> DAry2;
+        typedef dary_priority_queue<Deadline, Container, Earliest, 4> DAry4;
+        typedef dary_priority_queue<Deadline, Container, Earliest, 8> DAry8;
+
+        const int NUM_OPS = argc > 2 && atoi(argv[2]) > 0
+                            ? atoi(argv[2])
+                            : 10 * 1000 * 1000;
+
+        const int LENGTHS[]   = { 100, 10 * 1000, 1000 * 1000, 10000 * 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        printf("\t%10s %14s %10s %10s %10s\n",
+               "length", "priority_queue", "2-ary", "4-ary", "8-ary");
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsls::Types::Int64 sums[4] = { 0, 0, 0, 0 };
+            double             times[4];
+            {
+                Binary queue(allocator);
+                times[0] = holdBenchmark(&queue, LENGTH, NUM_OPS, &sums[0]);
+            }
+            {
+                DAry2 queue(allocator);
+                times[1] = holdBenchmark(&queue, LENGTH, NUM_OPS, &sums[1]);
+            }
+            {
+                DAry4 queue(allocator);
+                times[2] = holdBenchmark(&queue, LENGTH, NUM_OPS, &sums[2]);
+            }
+            {
+                DAry8 queue(allocator);
+                times[3] = holdBenchmark(&queue, LENGTH, NUM_OPS, &sums[3]);
+            }
+            ASSERTV(LENGTH, sums[0] == sums[1]);
+            ASSERTV(LENGTH, sums[0] == sums[2]);
+            ASSERTV(LENGTH, sums[0] == sums[3]);
+
+            printf("\t%10d %14.3f %10.3f %10.3f %10.3f\n",
+                   LENGTH, times[0], times[1], times[2], times[3]);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
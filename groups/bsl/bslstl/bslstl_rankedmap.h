@@ -0,0 +1,1378 @@
+// bslstl_rankedmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLSTL_RANKEDMAP
+#define INCLUDED_BSLSTL_RANKEDMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map of unique keys indexable by position.
+//
+//@CLASSES:
+//   bsl::ranked_map: ordered key-value map with O[log(n)] rank and selection
+//
+//@SEE_ALSO: bslstl_rankedtree, bslstl_rankedset, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template, 'ranked_map',
+// implementing a container holding an ordered sequence of key-value pairs
+// having unique keys, with the interface of 'bsl::map', extended with
+// operations on the positions of the pairs in the sequence: 'rank', returning
+// the number of keys ordered before a given key, 'nth', returning the
+// iterator to the pair at a given position, and 'index_of', returning the
+// position of the pair referred to by an iterator.  Each of these takes
+// O[log(n)] time, where 'n' is the size of the map, whereas finding them
+// with the iterators of a 'bsl::map' (e.g., with 'bsl::distance' or
+// 'bsl::advance') takes O[n] time.  The pairs of a 'ranked_map' are held in
+// a red-black tree whose nodes record the sizes of their subtrees (see
+// 'bslstl_rankedtree').
+//
+// An instantiation of 'ranked_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of key-value pairs the 'ranked_map' contains.  The requirements on
+// the 'KEY' and 'VALUE' types are those of 'bsl::map' (see 'bslstl_map').
+//
+// As for 'bsl::map', the 'value_type' of a 'ranked_map' is
+// 'bsl::pair<const KEY, VALUE>', and inserting a pair does not invalidate any
+// iterator, pointer, or reference to the pairs of the map, and erasing a
+// pair invalidates only those referring to that pair.  Note that the *rank*
+// of a pair (its position in the sequence) changes as pairs ordered before
+// it are inserted and erased.
+//
+///Choosing Between 'map' and 'ranked_map'
+///---------------------------------------
+// Each node of a 'ranked_map' records, besides the pair and the links of a
+// 'bsl::map' node, the number of nodes in the subtree it roots, which every
+// insertion and erasure updates along the path from the modified node to the
+// root.  A 'ranked_map' therefore uses one 'int' more per pair than a
+// 'bsl::map' (often absorbed by padding), and its insertions and erasures
+// take slightly longer, and it holds at most 'INT_MAX' pairs.  It should be
+// used when the positions of keys, or the distances between iterators, are
+// needed, as, for example, to report the position of a price level in an
+// order book, or to find its k-th best level.  The benchmark in case -1 of
+// the test driver of this component compares 'rank', 'nth' and 'index_of'
+// with the equivalent walks of the iterators of a 'bsl::map'.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a ranked map's 'ALLOCATOR' template parameter
+// determines how that map will allocate memory.  If the 'ALLOCATOR' is
+// 'bsl::allocator' (the default), then objects of the ranked map type conform
+// to the standard behavior of a 'bslma'-allocator-enabled type: the map
+// accepts an optional 'bslma::Allocator' argument at construction, uses it to
+// supply memory for its nodes throughout its lifetime, and supplies it to the
+// constructors of the keys and mapped values it holds if they have the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'ranked_map':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the ranked map
+//  'V'             - (template parameter) type 'VALUE' of the ranked map
+//  'a', 'b'        - two distinct objects of type 'ranked_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'x'             - an index in the range '[0 .. n]'
+//  'v'             - an object of type 'ranked_map<K, V>::value_type'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | ranked_map<K, V> a;   (default construction)       | O[1]               |
+//  | ranked_map<K, V> a(al);                            |                    |
+//  | ranked_map<K, V> a(c, al);                         |                    |
+//  +----------------------------------------------------+--------------------+
+//  | ranked_map<K, V> a(b); (copy construction)         | O[n]               |
+//  | ranked_map<K, V> a(b, al);                         |                    |
+//  +----------------------------------------------------+--------------------+
+//  | ranked_map<K, V> a(i1, i2);                        | O[N * log(N)]      |
+//  | ranked_map<K, V> a(i1, i2, c, al);                 |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~ranked_map<K, V>(); (destruction)               | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;                (assignment)                 | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty()                                | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k], a.at(k)                                      | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v)                                        | O[log(n)]          |
+//  | a.insert(p1, v)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N * log(n + N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[log(n)]          |
+//  | a.erase(k)                                         |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1, p2)                                    | O[distance(p1, p2) |
+//  |                                                    |   * log(n)]        |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.value_comp()                                     | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.contains(k)                           | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.count(k)                                         | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.upper_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.rank(k)                                          | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.nth(x)                                           | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.index_of(p1)                                     | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Ranking the Price Levels of an Order Book
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the quantities offered at each price level of the
+// selling side of an order book, and frequently need the position of a price
+// level in the book (its distance from the best price), and the k-th best
+// price level, while levels are added and removed.
+//
+// First, we define the type of the book, mapping a price, in ticks, to the
+// quantity offered at that price, the best (lowest) offer being first:
+//..
+//  typedef bsl::ranked_map<int, int> PriceLevels;
+//..
+// Then, we create a book, and add quantities at a few prices:
+//..
+//  bslma::TestAllocator allocator;
+//  PriceLevels          book(&allocator);
+//
+//  book[1005] += 300;
+//  book[1002] += 100;
+//  book[1010] += 500;
+//  book[1007] += 200;
+//  book[1002] += 200;
+//  assert(4 == book.size());
+//..
+// Next, we find the position of the level at 1007, which is the number of
+// better levels, and the number of levels better than a price that has no
+// level:
+//..
+//  assert(2 == book.rank(1007));
+//  assert(3 == book.rank(1008));
+//..
+// Then, we find the second best level (at index 1):
+//..
+//  PriceLevels::const_iterator level = book.nth(1);
+//  assert(1005 == level->first);
+//  assert(1    == book.index_of(level));
+//..
+// Now, we remove the best level, which has been fully executed, and observe
+// that the iterator 'level' remains valid, and that its position has
+// changed:
+//..
+//  assert(1 == book.erase(1002));
+//  assert(0 == book.index_of(level));
+//  assert(1005 == book.nth(0)->first);
+//..
+// Finally, we find the number of levels between two iterators without
+// visiting them:
+//..
+//  PriceLevels::const_iterator first = book.find(1005);
+//  PriceLevels::const_iterator last  = book.end();
+//  assert(3 == book.index_of(last) - book.index_of(first));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_RANKEDTREE
+#include <bslstl_rankedtree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'equal', 'lexicographical_compare'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                              // ================
+                              // class ranked_map
+                              // ================
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR  = std::less<KEY>,
+          class ALLOCATOR   = bsl::allocator<bsl::pair<const KEY, VALUE> > >
+class ranked_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys (of the
+    // template parameter type, 'KEY'), providing the position of each pair in
+    // logarithmic time.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<const KEY, VALUE>                value_type;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<value_type>
+                                                                    KeyConfig;
+        // This 'typedef' is an alias for the policy extracting the key of a
+        // pair held by this map.
+
+    typedef BloombergLP::bslstl::RankedTree<KeyConfig, COMPARATOR, ALLOCATOR>
+                                                                    Tree;
+        // This 'typedef' is an alias for the order-statistic tree holding the
+        // pairs of this map.
+
+    typedef bsl::allocator_traits<ALLOCATOR>           AllocatorTraits;
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::Iterator                    iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by their keys, using the (template parameter) type
+        // 'COMPARATOR', as for 'bsl::map::value_compare'.
+
+        // FRIENDS
+        friend class ranked_map;
+
+      protected:
+        COMPARATOR comp;  // key comparator
+
+        value_compare(COMPARATOR comparator) : comp(comparator) {}
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to
+            // the overload of 'operator()' (the comparison function) provided
+            // by a 'ranked_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'ranked_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'ranked_map::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    Tree d_tree;  // pairs, ordered by key, and key comparator
+
+  public:
+    // CREATORS
+    explicit ranked_map(const COMPARATOR& comparator = COMPARATOR(),
+                        const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct an empty map.  Optionally specify a 'comparator' used to
+        // order key-value pairs contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not supplied,
+        // a default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'allocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator' and
+        // 'allocator' is not supplied, the currently installed default
+        // allocator is used to supply memory.
+
+    explicit ranked_map(const ALLOCATOR& allocator);
+        // Construct an empty map that will use the specified 'allocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the key-value pairs contained
+        // in this map.  If the template parameter 'ALLOCATOR' argument is of
+        // type 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    ranked_map(const ranked_map& original);
+        // Construct a map having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the key-value pairs
+        // contained in this map.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) types 'KEY' and 'VALUE' both be "copy-constructible"
+        // (see {Requirements on 'KEY' and 'VALUE'} in 'bslstl_map').
+
+    ranked_map(const ranked_map& original, const ALLOCATOR& allocator);
+        // Construct a map having the same value as that of the specified
+        // 'original' that will use the specified 'allocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the key-value pairs
+        // contained in this map.  This method requires that the (template
+        // parameter) types 'KEY' and 'VALUE' both be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    ranked_map(INPUT_ITERATOR    first,
+               INPUT_ITERATOR    last,
+               const COMPARATOR& comparator = COMPARATOR(),
+               const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those pairs having a
+        // key equivalent to that of a pair appearing earlier in the sequence.
+        // Optionally specify a 'comparator' used to order key-value pairs
+        // contained in this object, and an 'allocator' used to supply memory,
+        // as for the default constructor.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  This method requires
+        // that the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible".
+
+    ~ranked_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    ranked_map& operator=(const ranked_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  This method requires that the (template parameter)
+        // types 'KEY' and 'VALUE' both be "copy-constructible".
+
+    VALUE& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key'; if this map does not already
+        // contain a 'value_type' object with 'key', first insert a new
+        // 'value_type' object having 'key' and a default-constructed 'VALUE'
+        // object, and return a reference to the mapped value.  This method
+        // requires that the (template parameter) types 'KEY' and 'VALUE' both
+        // be "default-constructible".
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise throw an 'std::out_of_range' exception.  Note that this
+        // method is not exception agnostic.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // if a key equivalent to that of 'value' already exists in this map,
+        // this method has no effect.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is equivalent to that of 'value', and
+        // whose 'second' member is 'true' if a new pair was inserted, and
+        // 'false' if the key was already present.  This method requires that
+        // the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible".
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this map whose key is equivalent to
+        // that of 'value'.  The specified 'hint' is ignored: this method takes
+        // O[log(N)] time, where N is the size of this map, as a new node must
+        // update the subtree sizes of all its ancestors.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this map.  This
+        // method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this map (nor equivalent to that of a pair
+        // preceding it in the range).  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // providing access to values of a type convertible to 'value_type'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last', and they are not iterators into this map.  This method
+        // requires that the (template parameter) types 'KEY' and 'VALUE' both
+        // be "copy-constructible".
+
+    iterator erase(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  The
+        // behavior is undefined unless 'position' refers to a 'value_type'
+        // object in this map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object whose key is equivalent
+        // to the specified 'key', if such an entry exists, and return 1;
+        // otherwise, if there is no 'value_type' object having an equivalent
+        // key, return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return an iterator referring to the element
+        // at the 'last' position.  The behavior is undefined unless 'first'
+        // and 'last' either refer to elements in this map or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the ordered sequence provided by this container.
+
+    void swap(ranked_map& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if this object and 'other' use the same
+        // allocator, and otherwise copies the pairs of each map using the
+        // allocator of the other.
+
+    void clear();
+        // Remove all entries from this map.  Note that the nodes of the
+        // removed entries are retained for reuse by subsequent insertions.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map whose key is equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain a 'value_type' object whose key is greater than
+        // 'key'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second is positioned
+        // one past the end of the sequence.  Note that since a map maintains
+        // unique keys, the range will contain at most one element.
+
+    iterator nth(size_type index);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object at the specified 'index' in the ordered sequence of
+        // 'value_type' objects maintained by this map, or the past-the-end
+        // iterator if 'size() == index'.  The behavior is undefined unless
+        // 'index <= size()'.  Note that this method takes O[log(n)] time.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'cend' iterator if this map is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'crend' if this map is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key', if such an entry
+        // exists; otherwise throw an 'std::out_of_range' exception.  Note
+        // that this method is not exception agnostic.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this map contains a 'value_type' object whose key
+        // is equivalent to the specified 'key', and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this map.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this map; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+        // Note that this comparator compares objects of type 'KEY', which is
+        // the key part of the 'value_type' objects contained in this map.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this map whose keys
+        // are equivalent to the specified 'key'.  Note that since a map
+        // maintains unique keys, the returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain a 'value_type' object whose key is greater
+        // than 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second is positioned
+        // one past the end of the sequence.  Note that since a map maintains
+        // unique keys, the range will contain at most one element.
+
+    const_iterator nth(size_type index) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object at the specified 'index' in the ordered sequence
+        // of 'value_type' objects maintained by this map, or the past-the-end
+        // iterator if 'size() == index'.  The behavior is undefined unless
+        // 'index <= size()'.  Note that this method takes O[log(n)] time.
+
+    size_type rank(const key_type& key) const;
+        // Return the number of 'value_type' objects in this map whose keys
+        // are ordered before the specified 'key'.  Note that the returned
+        // value is the index of the object whose key is equivalent to 'key',
+        // if such an entry exists, and the index at which it would be inserted
+        // otherwise.
+
+    size_type index_of(const_iterator position) const;
+        // Return the index of the 'value_type' object at the specified
+        // 'position' in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'size()' if 'position' is the
+        // past-the-end iterator.  The behavior is undefined unless 'position'
+        // is a valid iterator into this map.  Note that this method takes
+        // O[log(n)] time, and that 'index_of(last) - index_of(first)' is
+        // 'bsl::distance(first, last)'.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'ranked_map' objects have the same
+    // value if they have the same number of key-value pairs, and each pair in
+    // the ordered sequence of pairs of one object is equal to the pair at the
+    // same position in the other.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than that of the specified 'rhs' map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  This method
+    // provides the no-throw exception-safety guarantee if 'a' and 'b' use the
+    // same allocator.
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                              // ----------------
+                              // class ranked_map
+                              // ----------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::ranked_map(
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::ranked_map(
+                                                   const ALLOCATOR& allocator)
+: d_tree(COMPARATOR(), allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::ranked_map(
+                                                    const ranked_map& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                original.d_tree.allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::ranked_map(
+                                                  const ranked_map& original,
+                                                  const ALLOCATOR& allocator)
+: d_tree(original.d_tree, allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::ranked_map(
+                                                 INPUT_ITERATOR    first,
+                                                 INPUT_ITERATOR    last,
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~ranked_map()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const ranked_map& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE&
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
+{
+    iterator position = find(key);
+    if (position == end()) {
+        position = d_tree.insert(value_type(key, VALUE())).first;
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator position = find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "ranked_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_tree.insert(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator,
+                                                      const value_type& value)
+{
+    return d_tree.insert(value).first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_tree.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_tree.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == cend()) {
+        return 0;                                                     // RETURN
+    }
+    d_tree.erase(position);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                     const_iterator last)
+{
+    while (first != last) {
+        first = d_tree.erase(first);
+    }
+    return iterator(first.node());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(ranked_map& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator first = lower_bound(key);
+    iterator last  = first;
+    if (last != end() && !key_comp()(key, last->first)) {
+        ++last;
+    }
+    return pair<iterator, iterator>(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::nth(size_type index)
+{
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return d_tree.select(index);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const VALUE&
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "ranked_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_tree.comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != end() ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                    const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                    const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    const_iterator first = lower_bound(key);
+    const_iterator last  = first;
+    if (last != end() && !key_comp()(key, last->first)) {
+        ++last;
+    }
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::nth(size_type index) const
+{
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return d_tree.select(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rank(const key_type& key) const
+{
+    return d_tree.rank(d_tree.lowerBound(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::index_of(
+                                            const_iterator position) const
+{
+    return d_tree.rank(position);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+                                // ===========
+                                // TYPE TRAITS
+                                // ===========
+
+// Type traits for ranked maps:
+//: o A ranked map defines STL iterators.
+//: o A ranked map uses 'bslma' allocators if the parameterized 'ALLOCATOR' is
+//:     convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <typename KEY,
+          typename VALUE,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct HasStlIterators<bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <typename KEY,
+          typename VALUE,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct UsesBslmaAllocator<bsl::ranked_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1519 @@
+// bslstl_rankedmap.t.cpp                                             -*-C++-*-
+#include <bslstl_rankedmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_mallocfreeallocator.h>     // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapting a 'bslstl::RankedTree',
+// whose algorithms are thoroughly tested by 'bslstl_rankedtree' and
+// 'bslalg_rankedrbtreeutil'.  We therefore verify that each method of
+// 'ranked_map' forwards to the appropriate method of the tree, by comparing
+// the state of a 'ranked_map' with that of a 'bsl::map' subjected to the same
+// operations, for each sequence of keys described in a table, that the
+// positions reported by 'rank', 'nth', and 'index_of' are those found by
+// walking the iterators of the model, and that the allocator supplied at
+// construction is used for all memory, in the presence of injected exceptions
+// where an operation allocates.  The mapped
+// value of each pair identifies the position of the pair in the sequence it
+// was created from, so that the retention of the first of several pairs
+// having equivalent keys can be observed.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ranked_map(const C& comparator = C(), const A& allocator = A());
+// [ 2] ranked_map(const A& allocator);
+// [ 4] ranked_map(const ranked_map& original);
+// [ 4] ranked_map(const ranked_map& original, const A& allocator);
+// [ 3] ranked_map(ITER first, ITER last, const C& comp, const A& alloc);
+// [ 2] ~ranked_map();
+//
+// MANIPULATORS
+// [ 4] ranked_map& operator=(const ranked_map& rhs);
+// [ 5] VALUE& operator[](const key_type& key);
+// [ 5] VALUE& at(const key_type& key);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 5] iterator insert(const_iterator hint, const value_type& value);
+// [ 3] void insert(ITER first, ITER last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(ranked_map& other);
+// [ 5] void clear();
+// [ 6] iterator find(const key_type& key);
+// [ 6] iterator lower_bound(const key_type& key);
+// [ 6] iterator upper_bound(const key_type& key);
+// [ 6] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 7] iterator nth(size_type index);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 5] const VALUE& at(const key_type& key) const;
+// [ 6] bool contains(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 6] const_iterator find(const key_type& key) const;
+// [ 6] size_type count(const key_type& key) const;
+// [ 6] const_iterator lower_bound(const key_type& key) const;
+// [ 6] const_iterator upper_bound(const key_type& key) const;
+// [ 6] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 7] const_iterator nth(size_type index) const;
+// [ 7] size_type rank(const key_type& key) const;
+// [ 7] size_type index_of(const_iterator position) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const ranked_map& lhs, const ranked_map& rhs);
+// [ 4] bool operator!=(const ranked_map& lhs, const ranked_map& rhs);
+// [ 4] bool operator<(const ranked_map& lhs, const ranked_map& rhs);
+// [ 4] bool operator>(const ranked_map& lhs, const ranked_map& rhs);
+// [ 4] bool operator<=(const ranked_map& lhs, const ranked_map& rhs);
+// [ 4] bool operator>=(const ranked_map& lhs, const ranked_map& rhs);
+// [ 4] void swap(ranked_map& a, ranked_map& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 2] CONCERN: The type has the expected traits.
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::map'
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::ranked_map<char, int> Obj;
+typedef Obj::value_type            Value;
+typedef bsl::map<char, int>        Model;
+typedef bsl::vector<Value>         Vector;
+
+struct DefaultDataRow {
+    int         d_line;  // source line number
+    const char *d_spec;  // keys of the sequence, in order
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  spec
+    //----  ------------------------------------------------------------------
+    { L_,   ""                                                               },
+    { L_,   "A"                                                              },
+    { L_,   "AA"                                                             },
+    { L_,   "AB"                                                             },
+    { L_,   "BA"                                                             },
+    { L_,   "ACE"                                                            },
+    { L_,   "BDF"                                                            },
+    { L_,   "ABB"                                                            },
+    { L_,   "CAB"                                                            },
+    { L_,   "FGH"                                                            },
+    { L_,   "ECAC"                                                           },
+    { L_,   "ABCDEFGH"                                                       },
+    { L_,   "HGFEDCBA"                                                       },
+    { L_,   "DADBDCDD"                                                       },
+    { L_,   "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz" },
+    { L_,   "zyxwvutsrqponmlkjihgfedcbaZYXWVUTSRQPONMLKJIHGFEDCBA9876543210" },
+    { L_,   "0a1b2c3d4e5f6g7h8i9jAkBlCmDnEoFpGqHrIsJtKuLvMwNxOyPzQRSTUVWXYZ" },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+volatile size_t benchmarkSink;
+    // Receives a result of each benchmark so that it is not optimized away.
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool isEqual(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // key-value pairs as the specified 'model', and 'false' otherwise.
+{
+    if (object.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+    Model::const_iterator it = model.begin();
+    for (Obj::const_iterator jt = object.begin(); jt != object.end(); ++jt) {
+        if (jt->first != it->first || jt->second != it->second) {
+            return false;                                             // RETURN
+        }
+        ++it;
+    }
+    return true;
+}
+
+template <class ITERATOR>
+ITERATOR nth(ITERATOR first, int n)
+    // Return an iterator to the position the specified 'n' positions after
+    // the specified 'first'.
+{
+    bsl::advance(first, n);
+    return first;
+}
+
+void load(Vector *result, const char *spec, int base = 0)
+    // Append to the specified 'result' a pair for each key of the specified
+    // 'spec', in order, whose mapped value is the position of the key in
+    // 'spec' plus the optionally specified 'base'.
+{
+    for (int i = 0; spec[i]; ++i) {
+        result->push_back(Value(spec[i], base + i));
+    }
+}
+
+void loadModel(Model *result, const char *spec, int base = 0)
+    // Insert into the specified 'result' a pair for each key of the specified
+    // 'spec', in order, whose mapped value is the position of the key in
+    // 'spec' plus the optionally specified 'base'.
+{
+    for (int i = 0; spec[i]; ++i) {
+        result->insert(Model::value_type(spec[i], base + i));
+    }
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Ranking the Price Levels of an Order Book
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the quantities offered at each price level of the
+// selling side of an order book, and frequently need the position of a price
+// level in the book (its distance from the best price), and the k-th best
+// price level, while levels are added and removed.
+//
+// First, we define the type of the book, mapping a price, in ticks, to the
+// quantity offered at that price, the best (lowest) offer being first:
+//..
+    typedef bsl::ranked_map<int, int> PriceLevels;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a book, and add quantities at a few prices:
+//..
+    bslma::TestAllocator allocator;
+    PriceLevels          book(&allocator);
+
+    book[1005] += 300;
+    book[1002] += 100;
+    book[1010] += 500;
+    book[1007] += 200;
+    book[1002] += 200;
+    ASSERT(4 == book.size());
+//..
+// Next, we find the position of the level at 1007, which is the number of
+// better levels, and the number of levels better than a price that has no
+// level:
+//..
+    ASSERT(2 == book.rank(1007));
+    ASSERT(3 == book.rank(1008));
+//..
+// Then, we find the second best level (at index 1):
+//..
+    PriceLevels::const_iterator level = book.nth(1);
+    ASSERT(1005 == level->first);
+    ASSERT(1    == book.index_of(level));
+//..
+// Now, we remove the best level, which has been fully executed, and observe
+// that the iterator 'level' remains valid, and that its position has
+// changed:
+//..
+    ASSERT(1 == book.erase(1002));
+    ASSERT(0 == book.index_of(level));
+    ASSERT(1005 == book.nth(0)->first);
+//..
+// Finally, we find the number of levels between two iterators without
+// visiting them:
+//..
+    PriceLevels::const_iterator first = book.find(1005);
+    PriceLevels::const_iterator last  = book.end();
+    ASSERT(3 == book.index_of(last) - book.index_of(first));
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'rank', 'nth', AND 'index_of'
+        //
+        // Concerns:
+        //: 1 'rank' returns the number of keys ordered before the key, whether
+        //:   or not the key is present.
+        //:
+        //: 2 'nth' returns the iterator at the position, or the past-the-end
+        //:   iterator for the position 'size()', and the manipulator returns
+        //:   the same position as the accessor.
+        //:
+        //: 3 'index_of' returns the position of the iterator, and is the
+        //:   inverse of 'nth'.
+        //:
+        //: 4 The positions remain correct after insertions and erasures, and
+        //:   iterators to pairs that are not erased remain valid.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a ranked map and a model from
+        //:   the keys of the row, and for each key from '@' to 'I' compare the
+        //:   rank of the key with the offset from 'begin' of the lower bound
+        //:   of the key in the model.  (C-1)
+        //:
+        //: 2 For each position, compare the results of 'nth' and 'index_of'
+        //:   with the iterators found by advancing from 'begin'.  (C-2..3)
+        //:
+        //: 3 For each row of the table, retain an iterator to the last pair,
+        //:   erase the pairs at alternate positions, then insert them again,
+        //:   verifying the positions of all pairs, and of the retained
+        //:   iterator, after each operation.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   iterator nth(size_type index);
+        //   const_iterator nth(size_type index) const;
+        //   size_type rank(const key_type& key) const;
+        //   size_type index_of(const_iterator position) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'rank', 'nth', AND 'index_of'"
+                            "\n=====================================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        if (verbose) printf("\nTesting 'rank'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values;
+            load(&values, SPEC);
+
+            const Obj X(values.begin(), values.end());
+            Model     model;
+            loadModel(&model, SPEC);
+            const Model& M = model;
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                const Obj::size_type EXP = bsl::distance(M.begin(),
+                                                         M.lower_bound(key));
+                ASSERTV(LINE, key, EXP == X.rank(key));
+            }
+        }
+
+        if (verbose) printf("\nTesting 'nth' and 'index_of'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values;
+            load(&values, SPEC);
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+            const int SIZE = static_cast<int>(X.size());
+
+            for (int i = 0; i <= SIZE; ++i) {
+                if (veryVerbose) { T_ P_(SPEC) P(i) }
+
+                const Obj::const_iterator EXP = nth(X.begin(), i);
+
+                ASSERTV(LINE, i, EXP == X.nth(i));
+                ASSERTV(LINE, i, EXP == mX.nth(i));
+                ASSERTV(LINE, i, i == static_cast<int>(X.index_of(EXP)));
+                if (i < SIZE) {
+                    ASSERTV(LINE, i, i == static_cast<int>(
+                                                   X.rank(X.nth(i)->first)));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting positions after modifications.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values;
+            load(&values, SPEC);
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+            if (X.empty()) {
+                continue;
+            }
+
+            const Vector ORIGINAL(X.begin(), X.end());
+            const int    SIZE = static_cast<int>(ORIGINAL.size());
+
+            const Obj::const_iterator LAST = nth(X.begin(), SIZE - 1);
+
+            for (int i = SIZE - 2; 0 <= i; i -= 2) {
+                mX.erase(mX.nth(i));
+                ASSERTV(LINE, i, SIZE - 1 - (SIZE - i) / 2
+                                    == static_cast<int>(X.index_of(LAST)));
+            }
+            for (int i = 0; i <= static_cast<int>(X.size()); ++i) {
+                ASSERTV(LINE, i, nth(X.begin(), i) == X.nth(i));
+                ASSERTV(LINE, i, i == static_cast<int>(
+                                              X.index_of(nth(X.begin(), i))));
+            }
+
+            for (int i = SIZE % 2; i < SIZE - 1; i += 2) {
+                mX.insert(ORIGINAL[i]);
+                ASSERTV(LINE, i, i == static_cast<int>(
+                                                X.rank(ORIGINAL[i].first)));
+            }
+            ASSERTV(LINE, SIZE - 1 == static_cast<int>(X.index_of(LAST)));
+            for (int i = 0; i < SIZE; ++i) {
+                ASSERTV(LINE, i, ORIGINAL[i].first == X.nth(i)->first);
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Vector values;
+            load(&values, "AB");
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+
+            ASSERT_SAFE_PASS(X.nth(2));
+            ASSERT_SAFE_FAIL(X.nth(3));
+            ASSERT_SAFE_PASS(mX.nth(2));
+            ASSERT_SAFE_FAIL(mX.nth(3));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCHES
+        //
+        // Concerns:
+        //: 1 Each search method returns the same position as the
+        //:   corresponding method of 'bsl::map', for keys present in the
+        //:   ranked map, and for keys ordered before, between, and after them.
+        //:
+        //: 2 'count' and 'contains' report whether the key is present.
+        //:
+        //: 3 The manipulators return the same positions as the accessors.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a ranked map and a model from
+        //:   the keys of the row, and for each key from '@' to 'I' compare the
+        //:   results of the searches, as offsets from 'begin'.  (C-1..3)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   bool contains(const key_type& key) const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCHES"
+                            "\n================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values;
+            load(&values, SPEC);
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+            Model model;
+            loadModel(&model, SPEC);
+            const Model& M = model;
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                const bool FOUND = M.end() != M.find(key);
+
+                ASSERTV(LINE, key, FOUND == X.contains(key));
+                ASSERTV(LINE, key, M.count(key) == X.count(key));
+
+                ASSERTV(LINE, key, bsl::distance(M.begin(), M.find(key))
+                                == bsl::distance(X.begin(), X.find(key)));
+                ASSERTV(LINE, key,
+                        bsl::distance(M.begin(), M.lower_bound(key))
+                              == bsl::distance(X.begin(), X.lower_bound(key)));
+                ASSERTV(LINE, key,
+                        bsl::distance(M.begin(), M.upper_bound(key))
+                              == bsl::distance(X.begin(), X.upper_bound(key)));
+
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                           X.equal_range(key);
+                ASSERTV(LINE, key, X.lower_bound(key) == R.first);
+                ASSERTV(LINE, key, X.upper_bound(key) == R.second);
+
+                const bsl::pair<Obj::iterator, Obj::iterator> MR =
+                                                          mX.equal_range(key);
+                ASSERTV(LINE, key, X.find(key)        == mX.find(key));
+                ASSERTV(LINE, key, X.lower_bound(key) == mX.lower_bound(key));
+                ASSERTV(LINE, key, X.upper_bound(key) == mX.upper_bound(key));
+                ASSERTV(LINE, key, R.first  == MR.first);
+                ASSERTV(LINE, key, R.second == MR.second);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ELEMENT ACCESS, HINTED INSERT, AND ERASE
+        //
+        // Concerns:
+        //: 1 'operator[]' returns the mapped value of the key, inserting a
+        //:   default-constructed mapped value at the ordered position of the
+        //:   key if it is not present.
+        //:
+        //: 2 'at' returns the mapped value of the key, and throws
+        //:   'std::out_of_range' if it is not present.
+        //:
+        //: 3 Inserting with a hint inserts the pair at its ordered position,
+        //:   whatever the hint, and returns an iterator to the (possibly
+        //:   existing) pair having an equivalent key.
+        //:
+        //: 4 Each 'erase' overload removes the same pairs as the corresponding
+        //:   method of 'bsl::map', and returns the position following them.
+        //:
+        //: 5 'clear' removes all pairs, retaining their nodes for reuse.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, and each key from '@' to 'I', access
+        //:   the key with 'operator[]' and 'at' on copies of the ranked map of
+        //:   the row, and compare with the model.  (C-1..2)
+        //:
+        //: 2 For each row of the table, and each key from '@' to 'I', insert
+        //:   a pair into a copy of the ranked map of the row with every
+        //:   possible hint, and compare with the model.  (C-3)
+        //:
+        //: 3 For each row of the table, erase each key, each position, and
+        //:   each range of positions of a copy of the ranked map of the row,
+        //:   and compare with the model.  (C-4)
+        //:
+        //: 4 Call 'clear' on the ranked map of each row of the table, verify
+        //:   its value, and that inserting a pair allocates no memory.
+        //:   (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type& key);
+        //   VALUE& at(const key_type& key);
+        //   const VALUE& at(const key_type& key) const;
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING ELEMENT ACCESS, HINTED INSERT, AND ERASE"
+                          "\n================================================"
+                          "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'operator[]' and 'at'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                if (veryVerbose) { T_ P_(SPEC) P(key) }
+
+                Model model(&sa);
+                loadModel(&model, SPEC);
+                const bool FOUND = model.end() != model.find(key);
+
+                {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE, key, model[key] == mX[key]);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                    ASSERTV(LINE, key, isEqual(X, model));
+
+                    mX[key] = 42;
+                    ASSERTV(LINE, key, 42 == X.find(key)->second);
+                }
+                {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    bool caught = false;
+                    try {
+                        ASSERTV(LINE, key, &mX.at(key) == &X.at(key));
+                        ASSERTV(LINE, key, X.find(key)->second == X.at(key));
+                    }
+                    catch (const std::out_of_range&) {
+                        caught = true;
+                    }
+                    ASSERTV(LINE, key, FOUND != caught);
+                    ASSERTV(LINE, key, Y == X);
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting hinted 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                Model model(&sa);
+                loadModel(&model, SPEC);
+                model.insert(Model::value_type(key, 99));
+
+                for (int hi = 0; hi <= static_cast<int>(Y.size()); ++hi) {
+                    if (veryVerbose) { T_ P_(SPEC) P_(key) P(hi) }
+
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    Obj::iterator it = mX.insert(nth(X.begin(), hi),
+                                                 Value(key, 99));
+                    ASSERTV(LINE, key, hi, X.end() != it);
+                    ASSERTV(LINE, key, hi, key == it->first);
+                    ASSERTV(LINE, key, hi, isEqual(X, model));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'erase'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &oa);
+            const int SIZE = static_cast<int>(Y.size());
+
+            for (char key = '@'; key <= 'I'; ++key) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                ASSERTV(LINE, key, model.erase(key) == mX.erase(key));
+                ASSERTV(LINE, key, isEqual(X, model));
+            }
+
+            for (int i = 0; i < SIZE; ++i) {
+                Obj   mX(Y, &oa);  const Obj& X = mX;
+                Model model(&sa);
+                loadModel(&model, SPEC);
+
+                model.erase(nth(Y.begin(), i)->first);
+                Obj::iterator it = mX.erase(nth(X.begin(), i));
+                ASSERTV(LINE, i, nth(X.begin(), i) == it);
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            for (int i = 0; i <= SIZE; ++i) {
+                for (int j = i; j <= SIZE; ++j) {
+                    Obj   mX(Y, &oa);  const Obj& X = mX;
+                    Model model(&sa);
+                    loadModel(&model, SPEC);
+
+                    Model::iterator first = model.begin();
+                    bsl::advance(first, i);
+                    Model::iterator last = model.begin();
+                    bsl::advance(last, j);
+                    model.erase(first, last);
+
+                    Obj::iterator it = mX.erase(nth(X.begin(), i),
+                                                nth(X.begin(), j));
+                    ASSERTV(LINE, i, j, nth(X.begin(), i) == it);
+                    ASSERTV(LINE, i, j, isEqual(X, model));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'clear'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            Obj mX(values.begin(), values.end(), std::less<char>(), &oa);
+            const Obj& X = mX;
+
+            mX.clear();
+            ASSERTV(LINE, X.empty());
+            ASSERTV(LINE, X.begin() == X.end());
+
+            const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+            mX[SPEC[0]] = 1;
+            ASSERTV(LINE, 1 == X.size());
+            ASSERTV(LINE, !SPEC[0] || NUM_TOTAL == oa.numBlocksTotal());
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Vector values(&sa);
+            load(&values, "AB");
+
+            Obj mX(values.begin(), values.end());  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   allocator supplied, or the default allocator if none is.
+        //:
+        //: 2 Assignment gives the target the value of the source, which is
+        //:   unchanged.
+        //:
+        //: 3 Two ranked maps compare equal if and only if they hold the same
+        //:   pairs, and are ordered lexicographically otherwise.
+        //:
+        //: 4 The member and free 'swap' functions exchange the values of two
+        //:   ranked maps, without allocating if they use the same allocator.
+        //:
+        //: 5 No memory is leaked if an exception is thrown while copying.
+        //
+        // Plan:
+        //: 1 For each row of the table, copy a ranked map holding the keys of
+        //:   the row, with and without an allocator, in the presence of
+        //:   injected exceptions.  (C-1, 5)
+        //:
+        //: 2 For each pair of rows of the table, create a ranked map from each
+        //:   row, and compare them with each operator, checking the result
+        //:   against that of the model.  (C-3)
+        //:
+        //: 3 Assign and swap the ranked maps, and verify their values and the
+        //:   use of memory.  (C-2, 4)
+        //
+        // Testing:
+        //   ranked_map(const ranked_map& original);
+        //   ranked_map(const ranked_map& original, const A& allocator);
+        //   ranked_map& operator=(const ranked_map& rhs);
+        //   void swap(ranked_map& other);
+        //   bool operator==(const ranked_map& lhs, const ranked_map& rhs);
+        //   bool operator!=(const ranked_map& lhs, const ranked_map& rhs);
+        //   bool operator<(const ranked_map& lhs, const ranked_map& rhs);
+        //   bool operator>(const ranked_map& lhs, const ranked_map& rhs);
+        //   bool operator<=(const ranked_map& lhs, const ranked_map& rhs);
+        //   bool operator>=(const ranked_map& lhs, const ranked_map& rhs);
+        //   void swap(ranked_map& a, ranked_map& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING VALUE-SEMANTIC OPERATIONS"
+                            "\n=================================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting copy constructors.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            const Obj Y(values.begin(), values.end(), std::less<char>(), &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(Y, &oa);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &oa == X.get_allocator());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            {
+                const Obj X(Y);
+                ASSERTV(LINE, Y == X);
+                ASSERTV(LINE, &da == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting comparison, assignment, and swap.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            Vector values1(&sa);
+            load(&values1, SPEC1);
+
+            Model model1(&sa);
+            loadModel(&model1, SPEC1);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2 = DATA[tj].d_line;
+                const char *const SPEC2 = DATA[tj].d_spec;
+
+                if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+                Vector values2(&sa);
+                load(&values2, SPEC2);
+
+                Model model2(&sa);
+                loadModel(&model2, SPEC2);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(values1.begin(),
+                       values1.end(),
+                       std::less<char>(),
+                       &oa);
+                const Obj& X = mX;
+                Obj mY(values2.begin(),
+                       values2.end(),
+                       std::less<char>(),
+                       &oa);
+                const Obj& Y = mY;
+
+                ASSERTV(LINE1, LINE2, (model1 == model2) == (X == Y));
+                ASSERTV(LINE1, LINE2, (model1 != model2) == (X != Y));
+                ASSERTV(LINE1, LINE2, (model1 <  model2) == (X <  Y));
+                ASSERTV(LINE1, LINE2, (model1 >  model2) == (X >  Y));
+                ASSERTV(LINE1, LINE2, (model1 <= model2) == (X <= Y));
+                ASSERTV(LINE1, LINE2, (model1 >= model2) == (X >= Y));
+
+                const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+                mX.swap(mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model1));
+
+                swap(mX, mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model1));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, NUM_TOTAL == oa.numBlocksTotal());
+
+                Obj *mR = &(mX = Y);
+                ASSERTV(LINE1, LINE2, &X == mR);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2));
+                ASSERTV(LINE1, LINE2, &oa == X.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\nTesting swap with different allocators.\n");
+        {
+            bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+            bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+            Vector values1(&sa);
+            load(&values1, "ACE");
+            Vector values2(&sa);
+            load(&values2, "BD");
+
+            Obj mX(values1.begin(), values1.end(), std::less<char>(), &oa1);
+            const Obj& X = mX;
+            Obj mY(values2.begin(), values2.end(), std::less<char>(), &oa2);
+            const Obj& Y = mY;
+
+            const Obj XX(X, &sa), YY(Y, &sa);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+            ASSERT(&oa1 == X.get_allocator());
+            ASSERT(&oa2 == Y.get_allocator());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE CONSTRUCTORS AND RANGE 'insert'
+        //
+        // Concerns:
+        //: 1 A ranked map created from, or inserted with, a range holds the
+        //:   same pairs as a 'bsl::map' created from, or inserted with, the
+        //:   same range; in particular, of several pairs having equivalent
+        //:   keys, the first is retained.
+        //:
+        //: 2 All memory comes from the allocator of the ranked map, and no
+        //:   memory is leaked if an exception is thrown while inserting a
+        //:   range.
+        //
+        // Plan:
+        //: 1 For each row of the table, create a ranked map from the pairs of
+        //:   the row, and compare with the model.  (C-1..2)
+        //:
+        //: 2 For each pair of rows of the table, insert the pairs of the
+        //:   second row into a ranked map created from the first, in the
+        //:   presence of injected exceptions, restoring the ranked map at the
+        //:   start of each attempt, and compare with the model.  (C-1..2)
+        //
+        // Testing:
+        //   ranked_map(ITER first, ITER last, const C& comp, const A& alloc);
+        //   void insert(ITER first, ITER last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING RANGE CONSTRUCTORS AND RANGE 'insert'"
+                            "\n============================================="
+                            "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting range constructor.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Vector values(&sa);
+            load(&values, SPEC);
+
+            Model model(&sa);
+            loadModel(&model, SPEC);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(values.begin(),
+                            values.end(),
+                            std::less<char>(),
+                            &oa);
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, &oa == X.get_allocator());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting range 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            Vector values1(&sa);
+            load(&values1, SPEC1);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2 = DATA[tj].d_line;
+                const char *const SPEC2 = DATA[tj].d_spec;
+
+                if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+                Vector values2(&sa);
+                load(&values2, SPEC2, 100);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Model model(&sa);
+                loadModel(&model, SPEC1);
+                loadModel(&model, SPEC2, 100);
+
+                {
+                    const Obj  ORIGINAL(values1.begin(),
+                                        values1.end(),
+                                        std::less<char>(),
+                                        &sa);
+                    Obj        mX(&oa);
+                    const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        mX = ORIGINAL;
+                        mX.insert(values2.begin(), values2.end());
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(LINE1, LINE2, isEqual(X, model));
+                }
+                ASSERTV(LINE1, LINE2, 0 == oa.numBlocksInUse());
+            }
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed ranked map is empty, and uses the allocator
+        //:   and comparator supplied, or default ones if none is.
+        //:
+        //: 2 Inserting a pair whose key is not present adds it at its ordered
+        //:   position, and inserting a pair whose key is present has no
+        //:   effect; both return an iterator to the pair having the key, and
+        //:   whether it was inserted.
+        //:
+        //: 3 The iterators traverse the pairs in order, forwards or backwards,
+        //:   and the modifiable iterators refer to the same pairs as the
+        //:   non-modifiable ones.
+        //:
+        //: 4 All memory comes from the allocator of the ranked map, and no
+        //:   memory is leaked if an exception is thrown.
+        //:
+        //: 5 The type has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For each row of the table, insert the pairs of the row one at a
+        //:   time into a ranked map and a model, in the presence of injected
+        //:   exceptions, and compare the results and the state of the ranked
+        //:   map with those of the model using every accessor.  (C-1..4)
+        //:
+        //: 2 Verify the traits of the type.  (C-5)
+        //
+        // Testing:
+        //   ranked_map(const C& comparator = C(), const A& allocator = A());
+        //   ranked_map(const A& allocator);
+        //   ~ranked_map();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   allocator_type get_allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type has the expected traits.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          "\n================================================"
+                          "\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting default constructors.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const Obj W;
+            ASSERT(W.empty());
+            ASSERT(&da == W.get_allocator());
+
+            const Obj X(&oa);
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&oa == X.get_allocator());
+
+            const Obj Y(std::less<char>(), &oa);
+            ASSERT(Y.empty());
+            ASSERT(&oa == Y.get_allocator());
+            ASSERT(Y.key_comp()('A', 'B'));
+            ASSERT(Y.value_comp()(Value('A', 2), Value('B', 1)));
+            ASSERT(!Y.value_comp()(Value('A', 1), Value('A', 2)));
+            ASSERT(0 < Y.max_size());
+
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) printf("\nTesting 'insert'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model model(&sa);
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const Value VALUE(SPEC[i], i);
+
+                const bsl::pair<Model::iterator, bool> EXP = model.insert(
+                                 Model::value_type(VALUE.first, VALUE.second));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const Obj ORIGINAL(X, &sa);
+
+                    const bsl::pair<Obj::iterator, bool> R = mX.insert(VALUE);
+
+                    ASSERTV(LINE, i, EXP.second == R.second);
+                    ASSERTV(LINE, i, EXP.first->second == R.first->second);
+                    ASSERTV(LINE, i, bsl::distance(model.begin(), EXP.first)
+                                      == bsl::distance(mX.begin(), R.first));
+                    ASSERTV(LINE, i, EXP.second || ORIGINAL == X);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            ASSERTV(LINE, model.size() == X.size());
+            ASSERTV(LINE, model.empty() == X.empty());
+
+            ASSERTV(LINE, X.cbegin() == X.begin());
+            ASSERTV(LINE, X.cend() == X.end());
+            ASSERTV(LINE, X.crbegin() == X.rbegin());
+            ASSERTV(LINE, X.crend() == X.rend());
+            ASSERTV(LINE, X.begin() == mX.begin());
+            ASSERTV(LINE, X.end() == mX.end());
+            ASSERTV(LINE, X.rbegin() == Obj::const_reverse_iterator(
+                                                                mX.rbegin()));
+            ASSERTV(LINE, X.rend() == Obj::const_reverse_iterator(mX.rend()));
+            ASSERTV(LINE, static_cast<Obj::difference_type>(X.size())
+                                   == bsl::distance(X.rbegin(), X.rend()));
+            ASSERTV(LINE, (0 == X.size()) == (0 == oa.numBlocksInUse()));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a ranked map of 'int' to 'int', insert a few pairs one at
+        //:   a time and as a range, search for some keys, and erase some keys.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::ranked_map<int, int> IntMap;
+        typedef IntMap::value_type        IntPair;
+
+        IntMap mX;  const IntMap& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT(true  == mX.insert(IntPair(3, 30)).second);
+        ASSERT(true  == mX.insert(IntPair(1, 10)).second);
+        ASSERT(false == mX.insert(IntPair(3, 99)).second);
+        ASSERT(2  == X.size());
+        ASSERT(30 == X.at(3));
+
+        const IntPair VALUES[] = {
+            IntPair(5, 50), IntPair(2, 20), IntPair(4, 40), IntPair(1, 99)
+        };
+        mX.insert(VALUES, VALUES + 4);
+        ASSERT(5 == X.size());
+        for (int i = 0; i < 5; ++i) {
+            IntMap::const_iterator it = nth(X.begin(), i);
+            ASSERTV(i, it->first,  i + 1        == it->first);
+            ASSERTV(i, it->second, 10 * (i + 1) == it->second);
+        }
+
+        mX[6] = 60;
+        ++mX[1];
+        ASSERT(6  == X.size());
+        ASSERT(11 == X.at(1));
+
+        ASSERT(X.contains(4));
+        ASSERT(!X.contains(7));
+        ASSERT(nth(X.begin(), 2) == X.find(3));
+        ASSERT(X.end()       == X.find(0));
+
+        ASSERT(1 == mX.erase(3));
+        ASSERT(0 == mX.erase(3));
+        ASSERT(5 == X.size());
+
+        IntMap mY(X);  const IntMap& Y = mY;
+        ASSERT(X == Y);
+        mY[7] = 70;
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::map'
+        //
+        // Concerns:
+        //: 1 Finding the rank of a key, the pair at a position, and the
+        //:   position of an iterator in a ranked map takes logarithmic time,
+        //:   and is much faster than walking the iterators of a 'bsl::map'
+        //:   holding the same pairs.
+        //:
+        //: 2 Building and searching a ranked map is not much slower than for
+        //:   a 'bsl::map'.
+        //
+        // Plan:
+        //: 1 Create a 'bsl::map' and a ranked map holding (by default) 1
+        //:   million pairs of 'int' values having random keys, and report the
+        //:   time taken to build them, to look up each key in random order,
+        //:   and to find the rank of, the pair at the position of, and the
+        //:   position of an iterator to, (by default) 100 random keys, using
+        //:   'bsl::distance' and 'bsl::advance' for the 'bsl::map'.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::map'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COMPARISON WITH 'bsl::map'"
+                            "\n=======================================\n");
+
+        typedef bsl::map<int, int>        IntMap;
+        typedef bsl::ranked_map<int, int> IntRankedMap;
+        typedef bsl::pair<int, int>       IntPair;
+
+        const int NUM_VALUES  = argc > 2 && atoi(argv[2]) > 0
+                                ? atoi(argv[2])
+                                : 1000 * 1000;
+        const int NUM_QUERIES = argc > 3 && atoi(argv[3]) > 0
+                                ? atoi(argv[3])
+                                : 100;
+
+        bslma::MallocFreeAllocator& ma =
+                                      bslma::MallocFreeAllocator::singleton();
+
+        bsl::vector<IntPair> values(&ma);
+        bsl::vector<int>     keys(&ma);
+        values.reserve(NUM_VALUES);
+        keys.reserve(NUM_VALUES);
+        srand(1);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const int key = rand();
+            values.push_back(IntPair(key, i));
+            keys.push_back(key);
+        }
+        std::random_shuffle(keys.begin(), keys.end());
+
+        printf("\t%d pairs, %d positional queries\n",
+               NUM_VALUES,
+               NUM_QUERIES);
+
+        bsls::Stopwatch timer;
+        size_t          sum = 0;
+
+        {
+            IntMap mX(&ma);  const IntMap& X = mX;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(values[i]);
+            }
+            timer.stop();
+            printf("\tmap,        build:    %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                sum += X.find(keys[i])->second;
+            }
+            timer.stop();
+            printf("\tmap,        find:     %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                sum += bsl::distance(X.begin(), X.lower_bound(keys[i]));
+            }
+            timer.stop();
+            printf("\tmap,        rank:     %8.3fs\n", timer.elapsedTime());
+
+            const int SIZE = static_cast<int>(X.size());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                sum += nth(X.begin(), keys[i] % SIZE)->second;
+            }
+            timer.stop();
+            printf("\tmap,        nth:      %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                sum += bsl::distance(X.begin(), X.find(keys[i]));
+            }
+            timer.stop();
+            printf("\tmap,        index_of: %8.3fs\n", timer.elapsedTime());
+        }
+        {
+            IntRankedMap mX(&ma);  const IntRankedMap& X = mX;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(values[i]);
+            }
+            timer.stop();
+            printf("\tranked_map, build:    %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                sum += X.find(keys[i])->second;
+            }
+            timer.stop();
+            printf("\tranked_map, find:     %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                sum += X.rank(keys[i]);
+            }
+            timer.stop();
+            printf("\tranked_map, rank:     %8.3fs\n", timer.elapsedTime());
+
+            const int SIZE = static_cast<int>(X.size());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                sum += X.nth(keys[i] % SIZE)->second;
+            }
+            timer.stop();
+            printf("\tranked_map, nth:      %8.3fs\n", timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                sum += X.index_of(X.find(keys[i]));
+            }
+            timer.stop();
+            printf("\tranked_map, index_of: %8.3fs\n", timer.elapsedTime());
+        }
+        benchmarkSink = sum;
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
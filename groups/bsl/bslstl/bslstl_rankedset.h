@@ -0,0 +1,1064 @@
+// bslstl_rankedset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLSTL_RANKEDSET
+#define INCLUDED_BSLSTL_RANKEDSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set of unique keys indexable by position.
+//
+//@CLASSES:
+//   bsl::ranked_set: ordered set of unique keys with O[log(n)] rank and select
+//
+//@SEE_ALSO: bslstl_rankedtree, bslstl_rankedmap, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template, 'ranked_set',
+// implementing a container holding an ordered sequence of unique keys, with
+// the interface of 'bsl::set', extended with operations on the positions of
+// the keys in the sequence: 'rank', returning the number of keys ordered
+// before a given key, 'nth', returning the iterator to the key at a given
+// position, and 'index_of', returning the position of the key referred to by
+// an iterator.  Each of these takes O[log(n)] time, where 'n' is the size of
+// the set, whereas finding them with the iterators of a 'bsl::set' takes O[n]
+// time.  The keys of a 'ranked_set' are held in a red-black tree whose nodes
+// record the sizes of their subtrees (see 'bslstl_rankedtree').
+//
+// An instantiation of 'ranked_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'ranked_set' contains.  The requirements on the 'KEY'
+// type are those of 'bsl::set' (see 'bslstl_set').
+//
+// As for 'bsl::set', inserting a key does not invalidate any iterator,
+// pointer, or reference to the keys of the set, and erasing a key
+// invalidates only those referring to that key.  See 'bslstl_rankedmap' for
+// a discussion of the costs of maintaining positions, and a benchmark.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a ranked set's 'ALLOCATOR' template parameter
+// determines how that set will allocate memory.  If the 'ALLOCATOR' is
+// 'bsl::allocator' (the default), then objects of the ranked set type conform
+// to the standard behavior of a 'bslma'-allocator-enabled type: the set
+// accepts an optional 'bslma::Allocator' argument at construction, uses it to
+// supply memory for its nodes throughout its lifetime, and supplies it to the
+// constructors of the keys it holds if 'KEY' has the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'ranked_set':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the ranked set
+//  'a', 'b'        - two distinct objects of type 'ranked_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'x'             - an index in the range '[0 .. n]'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | ranked_set<K> a;    (default construction)         | O[1]               |
+//  | ranked_set<K> a(al);                               |                    |
+//  | ranked_set<K> a(c, al);                            |                    |
+//  +----------------------------------------------------+--------------------+
+//  | ranked_set<K> a(b); (copy construction)            | O[n]               |
+//  | ranked_set<K> a(b, al);                            |                    |
+//  +----------------------------------------------------+--------------------+
+//  | ranked_set<K> a(i1, i2);                           | O[N * log(N)]      |
+//  | ranked_set<K> a(i1, i2, c, al);                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~ranked_set<K>(); (destruction)                  | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;             (assignment)                    | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty()                                | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k)                                        | O[log(n)]          |
+//  | a.insert(p1, k)                                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N * log(n + N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[log(n)]          |
+//  | a.erase(k)                                         |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1, p2)                                    | O[distance(p1, p2) |
+//  |                                                    |   * log(n)]        |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp(), a.value_comp()                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.contains(k), a.count(k)               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k), a.upper_bound(k)                 | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.rank(k), a.nth(x), a.index_of(p1)                | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Computing Percentiles of a Sliding Window
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we measure the latencies of requests, each tagged with a unique
+// sequence number, and need the median, or any other percentile, of the
+// latencies measured in a sliding window of recent requests.
+//
+// First, we define the type of the set of measurements, each a latency, in
+// microseconds, paired with the sequence number of its request so that equal
+// latencies are distinct keys:
+//..
+//  typedef bsl::pair<int, int>          Measurement;  // latency, sequence
+//  typedef bsl::ranked_set<Measurement> Window;
+//..
+// Then, we record the measurements of the first five requests:
+//..
+//  bslma::TestAllocator allocator;
+//  Window               window(&allocator);
+//
+//  const int LATENCIES[] = { 250, 120, 900, 120, 300, 180 };
+//
+//  for (int i = 0; i < 5; ++i) {
+//      window.insert(Measurement(LATENCIES[i], i));
+//  }
+//..
+// Next, we find the median latency, the key at index 2, and the number of
+// measurements below 200 microseconds:
+//..
+//  assert(250 == window.nth(2)->first);
+//  assert(2   == window.rank(Measurement(200, 0)));
+//..
+// Now, we slide the window by one request, removing the oldest measurement
+// and adding the newest:
+//..
+//  assert(1 == window.erase(Measurement(LATENCIES[0], 0)));
+//  window.insert(Measurement(LATENCIES[5], 5));
+//  assert(5 == window.size());
+//..
+// Finally, we observe the new median, and that the position of the
+// measurement of request 4 has not changed:
+//..
+//  assert(180 == window.nth(2)->first);
+//  assert(3   == window.index_of(window.find(Measurement(300, 4))));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_RANKEDTREE
+#include <bslstl_rankedtree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'equal', 'lexicographical_compare'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                              // ================
+                              // class ranked_set
+                              // ================
+
+template <class KEY,
+          class COMPARATOR  = std::less<KEY>,
+          class ALLOCATOR   = bsl::allocator<KEY> >
+class ranked_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY'), providing the position of each key in logarithmic time.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY> KeyConfig;
+        // This 'typedef' is an alias for the policy extracting the key of a
+        // key held by this set (i.e., the key itself).
+
+    typedef BloombergLP::bslstl::RankedTree<KeyConfig, COMPARATOR, ALLOCATOR>
+                                                                   Tree;
+        // This 'typedef' is an alias for the order-statistic tree holding the
+        // keys of this
+        // set.
+
+    typedef bsl::allocator_traits<ALLOCATOR>           AllocatorTraits;
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::ConstIterator               iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    Tree d_tree;  // keys, in order, and key comparator
+
+  public:
+    // CREATORS
+    explicit ranked_set(const COMPARATOR& comparator = COMPARATOR(),
+                        const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify an 'allocator' used
+        // to supply memory.  If 'allocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'allocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator' and
+        // 'allocator' is not supplied, the currently installed default
+        // allocator is used to supply memory.
+
+    explicit ranked_set(const ALLOCATOR& allocator);
+        // Construct an empty set that will use the specified 'allocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // set.  If the template parameter 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    ranked_set(const ranked_set& original);
+        // Construct a set having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible".
+
+    ranked_set(const ranked_set& original, const ALLOCATOR& allocator);
+        // Construct a set having the same value as that of the specified
+        // 'original' that will use the specified 'allocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  This method requires that the (template parameter) type
+        // 'KEY' be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    ranked_set(INPUT_ITERATOR    first,
+               INPUT_ITERATOR    last,
+               const COMPARATOR& comparator = COMPARATOR(),
+               const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those keys equivalent
+        // to a key appearing earlier in the sequence.  Optionally specify a
+        // 'comparator' used to order keys contained in this object, and an
+        // 'allocator' used to supply memory, as for the default constructor.
+        // The (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible".
+
+    ~ranked_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    ranked_set& operator=(const ranked_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  This method requires that the (template parameter)
+        // type 'KEY' be "copy-constructible".
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, this method
+        // has no effect.  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) key in this set
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // key was inserted, and 'false' if the key was already present.  This
+        // method requires that the (template parameter) type 'KEY' be
+        // "copy-constructible".
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, this method
+        // has no effect.  Return an iterator referring to the (possibly newly
+        // inserted) key in this set equivalent to 'value'.  The specified
+        // 'hint' is ignored: this method takes O[log(N)] time, where N is the
+        // size of this set.  The behavior is undefined unless 'hint' is a
+        // valid iterator into this set.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible".
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to the object is not already contained in this set (nor
+        // preceding it in the range).  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // providing access to values of a type convertible to 'value_type'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last', and they are not iterators into this set.  This method
+        // requires that the (template parameter) type 'KEY' be
+        // "copy-constructible".
+
+    iterator erase(const_iterator position);
+        // Remove from this set the key at the specified 'position', and return
+        // an iterator referring to the element immediately following the
+        // removed element, or to the past-the-end position if the removed
+        // element was the last in the sequence.  The behavior is undefined
+        // unless 'position' refers to a key in this set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the key equivalent to the specified 'key', if
+        // such a key exists, and return 1; otherwise, return 0 with no other
+        // effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the keys starting at the specified 'first'
+        // position up to, but not including the specified 'last' position,
+        // and return an iterator referring to the element at the 'last'
+        // position.  The behavior is undefined unless 'first' and 'last'
+        // either refer to elements in this set or are the 'end' iterator, and
+        // the 'first' position is at or before the 'last' position in the
+        // ordered sequence provided by this container.
+
+    void swap(ranked_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if this object and 'other' use the same
+        // allocator, and otherwise copies the keys of each set using the
+        // allocator of the other.
+
+    void clear();
+        // Remove all keys from this set.  Note that the nodes of the removed
+        // keys are retained for reuse by subsequent insertions.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first key
+        // in the ordered sequence of keys maintained by this set, or the 'end'
+        // iterator if this set is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in the ordered sequence of keys maintained by this set, or
+        // 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this set.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first key
+        // in the ordered sequence of keys maintained by this set, or the
+        // 'cend' iterator if this set is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in the ordered sequence of keys maintained by this set, or
+        // 'crend' if this set is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this set.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this set contains a key equivalent to the specified
+        // 'key', and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this set; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this set.  Note that the keys of a set are its values.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the key in
+        // this set equivalent to the specified 'key', if such a key exists,
+        // and the past-the-end ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys within this set equivalent to the
+        // specified 'key'.  Note that since a set maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set greater-than or equal-to the
+        // specified 'key', and the past-the-end iterator if this set does not
+        // contain such a key.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set greater than the specified
+        // 'key', and the past-the-end iterator if this set does not contain
+        // such a key.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence
+        // and the second is positioned one past the end of the sequence.  Note
+        // that since a set maintains unique keys, the range will contain at
+        // most one element.
+
+    const_iterator nth(size_type index) const;
+        // Return an iterator providing non-modifiable access to the key at the
+        // specified 'index' in the ordered sequence of keys maintained by this
+        // set, or the past-the-end iterator if 'size() == index'.  The
+        // behavior is undefined unless 'index <= size()'.  Note that this
+        // method takes O[log(n)] time.
+
+    size_type rank(const key_type& key) const;
+        // Return the number of keys in this set ordered before the specified
+        // 'key'.  Note that the returned value is the index of the key
+        // equivalent to 'key', if such a key exists, and the index at which it
+        // would be inserted otherwise.
+
+    size_type index_of(const_iterator position) const;
+        // Return the index of the key at the specified 'position' in the
+        // ordered sequence of keys maintained by this set, or 'size()' if
+        // 'position' is the past-the-end iterator.  The behavior is undefined
+        // unless 'position' is a valid iterator into this set.  Note that this
+        // method takes O[log(n)] time, and that
+        // 'index_of(last) - index_of(first)' is 'bsl::distance(first, last)'.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'ranked_set' objects have the same
+    // value if they have the same number of keys, and each key in the ordered
+    // sequence of keys of one object is equal to the key at the same position
+    // in the other.  This method requires that the (template parameter) type
+    // 'KEY' be "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  This method requires that the
+    // (template parameter) type 'KEY' be "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than that of the specified 'rhs' set, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'KEY'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(ranked_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          ranked_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  This method
+    // provides the no-throw exception-safety guarantee if 'a' and 'b' use the
+    // same allocator.
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                              // ----------------
+                              // class ranked_set
+                              // ----------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::ranked_set(
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::ranked_set(const ALLOCATOR& allocator)
+: d_tree(COMPARATOR(), allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::ranked_set(const ranked_set& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                original.d_tree.allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::ranked_set(
+                                                  const ranked_set& original,
+                                                  const ALLOCATOR&  allocator)
+: d_tree(original.d_tree, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::ranked_set(
+                                                 INPUT_ITERATOR    first,
+                                                 INPUT_ITERATOR    last,
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_tree(comparator, allocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::~ranked_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ranked_set<KEY, COMPARATOR, ALLOCATOR>&
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const ranked_set& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    pair<typename Tree::Iterator, bool> result = d_tree.insert(value);
+    return pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator,
+                                               const value_type& value)
+{
+    return d_tree.insert(value).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void ranked_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                    INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_tree.insert(*first);
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_tree.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == cend()) {
+        return 0;                                                     // RETURN
+    }
+    d_tree.erase(position);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                              const_iterator last)
+{
+    while (first != last) {
+        first = d_tree.erase(first);
+    }
+    return first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void ranked_set<KEY, COMPARATOR, ALLOCATOR>::swap(ranked_set& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void ranked_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.clear();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool ranked_set<KEY, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool ranked_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != end() ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator first = lower_bound(key);
+    const_iterator last  = first;
+    if (last != end() && !key_comp()(key, *last)) {
+        ++last;
+    }
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::nth(size_type index) const
+{
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return d_tree.select(index);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::rank(const key_type& key) const
+{
+    return d_tree.rank(d_tree.lowerBound(key));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename ranked_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+ranked_set<KEY, COMPARATOR, ALLOCATOR>::index_of(
+                                                const_iterator position) const
+{
+    return d_tree.rank(position);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+                                // ===========
+                                // TYPE TRAITS
+                                // ===========
+
+// Type traits for ranked sets:
+//: o A ranked set defines STL iterators.
+//: o A ranked set uses 'bslma' allocators if the parameterized 'ALLOCATOR' is
+//:     convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <typename KEY, typename COMPARATOR, typename ALLOCATOR>
+struct HasStlIterators<bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <typename KEY, typename COMPARATOR, typename ALLOCATOR>
+struct UsesBslmaAllocator<bsl::ranked_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,962 @@
+// bslstl_rankedtree.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_RANKEDTREE
+#define INCLUDED_BSLSTL_RANKEDTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an order-statistic tree of unique keys for containers.
+//
+//@CLASSES:
+//  bslstl::RankedTree: ordered sequence of unique-key values, indexable
+//  bslstl::RankedTreeNode: node of a 'RankedTree', holding a value
+//
+//@SEE_ALSO: bslstl_rankedmap, bslstl_rankedset, bslalg_rankedrbtreeutil
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::RankedTree', implementing an ordered sequence of values having
+// unique keys held in a red-black tree whose nodes record the sizes of their
+// subtrees (an "order-statistic tree"), together with the node type of the
+// tree, 'bslstl::RankedTreeNode'.  'RankedTree' is the implementation of the
+// ordered associative containers 'bsl::ranked_map' and 'bsl::ranked_set' (see
+// 'bslstl_rankedmap' and 'bslstl_rankedset').
+//
+// The values held by a 'RankedTree' are ordered by the keys extracted from
+// them by the (template parameter) type 'KEY_CONFIG', which must provide the
+// same interface as 'bslstl::UnorderedMapKeyConfiguration' (for values that
+// are 'pair' objects holding a key and a mapped value) and
+// 'bslstl::UnorderedSetKeyConfiguration' (for values that are their own
+// keys):
+//..
+//  typedef ... ValueType;  // type of the values held by the tree
+//  typedef ... KeyType;    // type of the keys ordering those values
+//
+//  static const KeyType& extractKey(const ValueType& value);
+//..
+//
+///Ranks and Indices
+///-----------------
+// In addition to the operations of the red-black tree underlying 'bsl::map'
+// and 'bsl::set' (each taking O[log(N)] operations, where N is the size of
+// the tree), a 'RankedTree' provides, also in O[log(N)] operations, the
+// position (or "rank") of the value referred to by an iterator, that is, the
+// number of values of the tree ordered before it, and the iterator referring
+// to the value at a given position.  Finding these with the iterators of a
+// 'bsl::map' requires walking the values one at a time (e.g., with
+// 'bsl::distance' and 'bsl::advance'), in O[N] operations.  The distance
+// between two iterators of a 'RankedTree' is the difference of their ranks.
+//
+// Each node of a 'RankedTree' is a 'bslalg::RankedRbTreeNode', recording the
+// number of nodes of the subtree it roots, and the tree is modified by the
+// functions of 'bslalg::RankedRbTreeUtil' that maintain those sizes.  The
+// additional cost of an insertion or erasure, compared to 'bsl::map', is the
+// update of the sizes along the path from the modified node to the root,
+// and the additional memory used is one 'int' per node (which on 64-bit
+// platforms occupies space otherwise used for padding by many value types).
+// As the node count of the underlying 'bslalg::RbTreeAnchor' is an 'int', a
+// 'RankedTree' holds at most 'INT_MAX' values.
+//
+// As for 'bsl::map', the nodes of a 'RankedTree' are allocated from a pool,
+// and insertions and erasures do not invalidate iterators, pointers, or
+// references to values other than those erased.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Finding the Median of a Changing Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain a set of 'int' values, and to find the median
+// value (and the number of values less than a given one) as values are added
+// and removed, using a 'RankedTree' (which is generally used through
+// 'bsl::ranked_set').
+//
+// First, we define the type of the tree:
+//..
+//  typedef bslstl::UnorderedSetKeyConfiguration<int>  IntConfig;
+//  typedef bslstl::RankedTree<IntConfig,
+//                             std::less<int>,
+//                             bsl::allocator<int> >  IntTree;
+//..
+// Then, we create a tree and insert the odd values in '[1 .. 99]':
+//..
+//  bslma::TestAllocator allocator;
+//  IntTree              tree(std::less<int>(), &allocator);
+//
+//  for (int i = 0; i < 50; ++i) {
+//      assert(true == tree.insert((i * 7) % 50 * 2 + 1).second);
+//  }
+//  assert(false == tree.insert(49).second);
+//  assert(50    == tree.size());
+//  assert(tree.isWellFormed());
+//..
+// Next, we find the median, the value at index 25, and the number of values
+// less than 50, the rank of the first value not less than 50:
+//..
+//  assert(51 == *tree.select(25));
+//  assert(25 == tree.rank(tree.lowerBound(50)));
+//..
+// Then, we erase the values less than 20, and observe that the median and
+// ranks have changed accordingly:
+//..
+//  IntTree::Iterator it = tree.begin();
+//  while (*it < 20) {
+//      it = tree.erase(it);
+//  }
+//  assert(40 == tree.size());
+//  assert(61 == *tree.select(20));
+//  assert(15 == tree.rank(tree.lowerBound(50)));
+//..
+// Finally, we find the distance between two iterators from their ranks,
+// without visiting the values between them:
+//..
+//  IntTree::ConstIterator first = tree.find(21);
+//  IntTree::ConstIterator last  = tree.find(81);
+//  assert(30 == tree.rank(last) - tree.rank(first));
+//  assert(tree.size() == tree.rank(tree.end()));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SIMPLEPOOL
+#include <bslstl_simplepool.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_TREEITERATOR
+#include <bslstl_treeiterator.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANKEDRBTREEUTIL
+#include <bslalg_rankedrbtreeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEANCHOR
+#include <bslalg_rbtreeanchor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREENODE
+#include <bslalg_rbtreenode.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEUTIL
+#include <bslalg_rbtreeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_LIMITS_H
+#include <limits.h>
+#define INCLUDED_LIMITS_H
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                            // ====================
+                            // class RankedTreeNode
+                            // ====================
+
+template <class VALUE>
+class RankedTreeNode : public bslalg::RankedRbTreeNode {
+    // This POD-like 'class' describes a node suitable for use in a red-black
+    // binary search tree, recording the size of its subtree, of values of the
+    // (template parameter) type 'VALUE'.  As for 'TreeNode', this class does
+    // not define a constructor or destructor, and the 'd_value' member is
+    // constructed in place, and destroyed, by an appropriate
+    // 'bsl::allocator_traits' object.
+
+    // DATA
+    VALUE d_value;  // payload value
+
+  private:
+    // The following functions are not defined because a 'RankedTreeNode'
+    // should never be constructed, destructed, or assigned.
+
+    RankedTreeNode();                                  // Declared but not
+                                                       // defined
+    RankedTreeNode(const RankedTreeNode&);             // Declared but not
+                                                       // defined
+    RankedTreeNode& operator=(const RankedTreeNode&);  // Declared but not
+                                                       // defined
+    ~RankedTreeNode();                                 // Declared but not
+                                                       // defined
+
+  public:
+    // MANIPULATORS
+    VALUE& value();
+        // Return a reference providing modifiable access to the 'value' of
+        // this object.
+
+    // ACCESSORS
+    const VALUE& value() const;
+        // Return a reference providing non-modifiable access to the 'value' of
+        // this object.
+};
+
+                              // ================
+                              // class RankedTree
+                              // ================
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class RankedTree {
+    // This class template implements an ordered sequence of values, of type
+    // 'KEY_CONFIG::ValueType', having unique keys, of type
+    // 'KEY_CONFIG::KeyType', ordered by the (template parameter) type
+    // 'COMPARATOR', held in a red-black tree whose nodes record the sizes of
+    // their subtrees, and are allocated by the (template parameter) type
+    // 'ALLOCATOR'.  See {Ranks and Indices}.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType                   KeyType;
+    typedef typename KEY_CONFIG::ValueType                 ValueType;
+    typedef bsl::allocator_traits<ALLOCATOR>               AllocatorTraits;
+    typedef typename AllocatorTraits::size_type            SizeType;
+    typedef typename AllocatorTraits::difference_type      DifferenceType;
+    typedef RankedTreeNode<ValueType>                      Node;
+    typedef TreeIterator<ValueType, Node, DifferenceType>  Iterator;
+    typedef TreeIterator<const ValueType, Node, DifferenceType>
+                                                           ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef SimplePool<Node, ALLOCATOR>                    Pool;
+    typedef typename Pool::AllocatorTraits                 NodeTraits;
+
+    class NodeComparator;
+    class NodeFactory;
+
+    // DATA
+    bslalg::RbTreeAnchor d_tree;        // root, first node, and node count
+    Pool                 d_pool;        // pool of nodes
+    COMPARATOR           d_comparator;  // key comparator
+
+    // FRIENDS
+    friend class NodeFactory;
+
+    // PRIVATE MANIPULATORS
+    Node *createNode(const ValueType& value);
+        // Return the address of a new node holding a copy of the specified
+        // 'value', whose links and subtree size are uninitialized.
+
+    void deleteNode(bslalg::RbTreeNode *node);
+        // Destroy the value of, and release, the specified 'node'.
+
+    void quickSwap(RankedTree& other);
+        // Exchange the value of this tree with that of the specified 'other',
+        // without regard for their allocators.
+
+  private:
+    // NOT IMPLEMENTED
+    RankedTree(const RankedTree&);
+
+  public:
+    // CREATORS
+    RankedTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+        // Create an empty tree ordering its keys with the specified
+        // 'comparator' and using the specified 'allocator' to supply memory.
+
+    RankedTree(const RankedTree& original, const ALLOCATOR& allocator);
+        // Create a tree having the same values, and the same structure, as
+        // the specified 'original', ordering its keys with a copy of the
+        // comparator of 'original' and using the specified 'allocator' to
+        // supply memory.
+
+    ~RankedTree();
+        // Destroy this object.
+
+    // MANIPULATORS
+    RankedTree& operator=(const RankedTree& rhs);
+        // Assign to this object the values and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    bsl::pair<Iterator, bool> insert(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if its key is
+        // not already present.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) value having
+        // the key of 'value', and whose 'second' member is 'true' if 'value'
+        // was inserted and 'false' otherwise.  This operation takes O[log(N)]
+        // operations, where N is the size of this tree.  The behavior is
+        // undefined if 'value' is inserted and this tree already holds
+        // 'INT_MAX' values.
+
+    Iterator erase(ConstIterator position);
+        // Remove from this tree the value at the specified 'position', and
+        // return an iterator referring to the value that followed it, or the
+        // past-the-end iterator if it was the last value.  This operation
+        // takes O[log(N)] operations, where N is the size of this tree.  The
+        // behavior is undefined unless 'position' refers to a value in this
+        // tree.
+
+    void clear();
+        // Remove all values from this tree, retaining their nodes for reuse
+        // by subsequent insertions.
+
+    void swap(RankedTree& other);
+        // Exchange the values and comparator of this tree with those of the
+        // specified 'other'.  This method does not allocate memory (and does
+        // not throw) if both trees use the same allocator, and copies the
+        // values of each tree otherwise.
+
+    Iterator begin();
+        // Return an iterator referring to the first value of this tree, or
+        // the past-the-end iterator if this tree is empty.
+
+    Iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    Iterator find(const KeyType& key);
+        // Return an iterator referring to the value of this tree having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    Iterator lowerBound(const KeyType& key);
+        // Return an iterator referring to the first value of this tree whose
+        // key is not ordered before the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    Iterator upperBound(const KeyType& key);
+        // Return an iterator referring to the first value of this tree whose
+        // key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    Iterator select(SizeType index);
+        // Return an iterator referring to the value at the specified 'index'
+        // in this tree (i.e., the value preceded by 'index' values), or the
+        // past-the-end iterator if 'index' is the size of this tree.  This
+        // operation takes O[log(N)] operations, where N is the size of this
+        // tree.  The behavior is undefined unless 'index <= size()'.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator of this tree.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // comparator of this tree.
+
+    ConstIterator begin() const;
+        // Return an iterator referring to the first value of this tree, or
+        // the past-the-end iterator if this tree is empty.
+
+    ConstIterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    ConstIterator find(const KeyType& key) const;
+        // Return an iterator referring to the value of this tree having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    ConstIterator lowerBound(const KeyType& key) const;
+        // Return an iterator referring to the first value of this tree whose
+        // key is not ordered before the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    ConstIterator upperBound(const KeyType& key) const;
+        // Return an iterator referring to the first value of this tree whose
+        // key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    ConstIterator select(SizeType index) const;
+        // Return an iterator referring to the value at the specified 'index'
+        // in this tree (i.e., the value preceded by 'index' values), or the
+        // past-the-end iterator if 'index' is the size of this tree.  This
+        // operation takes O[log(N)] operations, where N is the size of this
+        // tree.  The behavior is undefined unless 'index <= size()'.
+
+    SizeType rank(ConstIterator position) const;
+        // Return the number of values of this tree preceding the specified
+        // 'position', that is, the index of the value at 'position', or the
+        // size of this tree if 'position' is the past-the-end iterator.  This
+        // operation takes O[log(N)] operations, where N is the size of this
+        // tree.  The behavior is undefined unless 'position' is a valid
+        // iterator of this tree.
+
+    SizeType size() const;
+        // Return the number of values held by this tree.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of values that this
+        // tree could hold.
+
+    bool isWellFormed() const;
+        // Return 'true' if this tree is a well-formed red-black tree (see
+        // 'bslalg::RbTreeUtil::isWellFormed') whose keys are ordered, and
+        // unique, and whose nodes record the sizes of their subtrees, and
+        // 'false' otherwise.  Note that this method takes linear time, and is
+        // intended for testing.
+};
+
+                   // =====================================
+                   // class RankedTree<...>::NodeComparator
+                   // =====================================
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeComparator {
+    // This class adapts the key comparator of a 'RankedTree' to compare the
+    // values of nodes with keys, and with the values of other nodes, as
+    // required by the functions of 'bslalg::RbTreeUtil'.
+
+    // DATA
+    const COMPARATOR& d_comparator;  // key comparator
+
+  private:
+    // NOT IMPLEMENTED
+    NodeComparator& operator=(const NodeComparator&);
+
+  public:
+    // CREATORS
+    explicit NodeComparator(const COMPARATOR& comparator);
+        // Create a comparator adapting the specified 'comparator'.
+
+    // ACCESSORS
+    bool operator()(const bslalg::RbTreeNode& lhs, const KeyType& rhs) const;
+        // Return 'true' if the key of the value of the specified 'lhs' node
+        // is ordered before the specified 'rhs' key, and 'false' otherwise.
+
+    bool operator()(const KeyType& lhs, const bslalg::RbTreeNode& rhs) const;
+        // Return 'true' if the specified 'lhs' key is ordered before the key
+        // of the value of the specified 'rhs' node, and 'false' otherwise.
+
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+        // Return 'true' if the key of the value of the specified 'lhs' node
+        // is ordered before that of the specified 'rhs' node, and 'false'
+        // otherwise.
+};
+
+                     // ==================================
+                     // class RankedTree<...>::NodeFactory
+                     // ==================================
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeFactory {
+    // This class provides the node factory interface required by
+    // 'bslalg::RbTreeUtil::copyTree' and 'bslalg::RbTreeUtil::deleteTree',
+    // creating and deleting the nodes of a 'RankedTree'.
+
+    // DATA
+    RankedTree *d_tree_p;  // tree whose nodes are created (held, not owned)
+
+  public:
+    // CREATORS
+    explicit NodeFactory(RankedTree *tree);
+        // Create a factory for the nodes of the specified 'tree'.
+
+    // MANIPULATORS
+    bslalg::RbTreeNode *createNode(const bslalg::RbTreeNode& original);
+        // Return the address of a new node holding a copy of the value, and
+        // having the subtree size, of the specified 'original' node.
+
+    void deleteNode(bslalg::RbTreeNode *node);
+        // Destroy the value of, and release, the specified 'node'.
+};
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                            // --------------------
+                            // class RankedTreeNode
+                            // --------------------
+
+// MANIPULATORS
+template <class VALUE>
+inline
+VALUE& RankedTreeNode<VALUE>::value()
+{
+    return d_value;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+const VALUE& RankedTreeNode<VALUE>::value() const
+{
+    return d_value;
+}
+
+                   // -------------------------------------
+                   // class RankedTree<...>::NodeComparator
+                   // -------------------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeComparator::NodeComparator(
+                                                 const COMPARATOR& comparator)
+: d_comparator(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeComparator::operator()(
+                                          const bslalg::RbTreeNode& lhs,
+                                          const KeyType&            rhs) const
+{
+    return d_comparator(
+              KEY_CONFIG::extractKey(static_cast<const Node&>(lhs).value()),
+              rhs);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeComparator::operator()(
+                                          const KeyType&            lhs,
+                                          const bslalg::RbTreeNode& rhs) const
+{
+    return d_comparator(
+              lhs,
+              KEY_CONFIG::extractKey(static_cast<const Node&>(rhs).value()));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeComparator::operator()(
+                                          const bslalg::RbTreeNode& lhs,
+                                          const bslalg::RbTreeNode& rhs) const
+{
+    return d_comparator(
+              KEY_CONFIG::extractKey(static_cast<const Node&>(lhs).value()),
+              KEY_CONFIG::extractKey(static_cast<const Node&>(rhs).value()));
+}
+
+                     // ----------------------------------
+                     // class RankedTree<...>::NodeFactory
+                     // ----------------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeFactory::NodeFactory(
+                                                             RankedTree *tree)
+: d_tree_p(tree)
+{
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::RbTreeNode *
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeFactory::createNode(
+                                            const bslalg::RbTreeNode& original)
+{
+    const Node& originalNode = static_cast<const Node&>(original);
+
+    Node *node = d_tree_p->createNode(originalNode.value());
+    node->setSubtreeSize(originalNode.subtreeSize());
+    return node;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeFactory::deleteNode(
+                                                     bslalg::RbTreeNode *node)
+{
+    d_tree_p->deleteNode(node);
+}
+
+                              // ----------------
+                              // class RankedTree
+                              // ----------------
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Node *
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::createNode(
+                                                       const ValueType& value)
+{
+    Node *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    NodeTraits::construct(d_pool.allocator(),
+                          BSLS_UTIL_ADDRESSOF(node->value()),
+                          value);
+    proctor.release();
+    return node;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deleteNode(
+                                                     bslalg::RbTreeNode *node)
+{
+    Node *rankedNode = static_cast<Node *>(node);
+    NodeTraits::destroy(d_pool.allocator(),
+                        BSLS_UTIL_ADDRESSOF(rankedNode->value()));
+    d_pool.deallocate(rankedNode);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::quickSwap(
+                                                            RankedTree& other)
+{
+    bslalg::RbTreeUtil::swap(&d_tree, &other.d_tree);
+    d_pool.swap(other.d_pool);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::RankedTree(
+                                                const COMPARATOR& comparator,
+                                                const ALLOCATOR&  allocator)
+: d_tree()
+, d_pool(allocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::RankedTree(
+                                                const RankedTree& original,
+                                                const ALLOCATOR&  allocator)
+: d_tree()
+, d_pool(allocator)
+, d_comparator(original.d_comparator)
+{
+    if (0 < original.d_tree.numNodes()) {
+        d_pool.reserve(original.d_tree.numNodes());
+
+        NodeFactory factory(this);
+        bslalg::RbTreeUtil::copyTree(&d_tree, original.d_tree, &factory);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::~RankedTree()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(
+                                                        const RankedTree& rhs)
+{
+    if (this != &rhs) {
+        RankedTree other(rhs, allocator());
+        quickSwap(other);
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator,
+          bool>
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(const ValueType& value)
+{
+    BSLS_ASSERT_SAFE(INT_MAX > d_tree.numNodes());
+
+    NodeComparator comparator(d_comparator);
+
+    int                 comparisonResult;
+    bslalg::RbTreeNode *insertLocation =
+                     bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                            &comparisonResult,
+                                            &d_tree,
+                                            comparator,
+                                            KEY_CONFIG::extractKey(value));
+    if (!comparisonResult) {
+        return bsl::pair<Iterator, bool>(Iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+
+    Node *node = createNode(value);
+    bslalg::RankedRbTreeUtil::insertAt(&d_tree,
+                                       insertLocation,
+                                       comparisonResult < 0,
+                                       node);
+    return bsl::pair<Iterator, bool>(Iterator(node), true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(position.node());
+    BSLS_ASSERT_SAFE(position != end());
+
+    Node *node = static_cast<Node *>(
+                         const_cast<bslalg::RbTreeNode *>(position.node()));
+    bslalg::RbTreeNode *result = bslalg::RbTreeUtil::next(node);
+
+    bslalg::RankedRbTreeUtil::remove(&d_tree, node);
+    deleteNode(node);
+    return Iterator(result);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::clear()
+{
+    if (d_tree.rootNode()) {
+        NodeFactory factory(this);
+        bslalg::RbTreeUtil::deleteTree(&d_tree, &factory);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(RankedTree& other)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                             d_pool.allocator() == other.d_pool.allocator())) {
+        quickSwap(other);
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        RankedTree thisCopy(*this, other.allocator());
+        RankedTree otherCopy(other, allocator());
+
+        quickSwap(otherCopy);
+        other.quickSwap(thisCopy);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return Iterator(d_tree.firstNode());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return Iterator(d_tree.sentinel());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key)
+{
+    NodeComparator comparator(d_comparator);
+    return Iterator(bslalg::RbTreeUtil::find(d_tree, comparator, key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key)
+{
+    NodeComparator comparator(d_comparator);
+    return Iterator(bslalg::RbTreeUtil::lowerBound(d_tree, comparator, key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key)
+{
+    NodeComparator comparator(d_comparator);
+    return Iterator(bslalg::RbTreeUtil::upperBound(d_tree, comparator, key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::select(SizeType index)
+{
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return Iterator(bslalg::RankedRbTreeUtil::select(d_tree,
+                                                     static_cast<int>(index)));
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return ALLOCATOR(d_pool.allocator());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return ConstIterator(d_tree.firstNode());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return ConstIterator(d_tree.sentinel());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    NodeComparator comparator(d_comparator);
+    return ConstIterator(bslalg::RbTreeUtil::find(d_tree, comparator, key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                     const KeyType& key) const
+{
+    NodeComparator comparator(d_comparator);
+    return ConstIterator(
+                    bslalg::RbTreeUtil::lowerBound(d_tree, comparator, key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(
+                                                     const KeyType& key) const
+{
+    NodeComparator comparator(d_comparator);
+    return ConstIterator(
+                    bslalg::RbTreeUtil::upperBound(d_tree, comparator, key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::select(SizeType index) const
+{
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return ConstIterator(bslalg::RankedRbTreeUtil::select(
+                                                     d_tree,
+                                                     static_cast<int>(index)));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::rank(
+                                                ConstIterator position) const
+{
+    BSLS_ASSERT_SAFE(position.node());
+
+    return static_cast<SizeType>(
+                  bslalg::RankedRbTreeUtil::rank(d_tree, position.node()));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return static_cast<SizeType>(d_tree.numNodes());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    const SizeType maxNodes = NodeTraits::max_size(d_pool.allocator());
+    return maxNodes < static_cast<SizeType>(INT_MAX)
+           ? maxNodes
+           : static_cast<SizeType>(INT_MAX);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool RankedTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isWellFormed() const
+{
+    NodeComparator comparator(d_comparator);
+
+    if (!bslalg::RbTreeUtil::isWellFormed(d_tree, comparator)
+     || !bslalg::RankedRbTreeUtil::hasValidSubtreeSizes(d_tree)) {
+        return false;                                                 // RETURN
+    }
+
+    // 'RbTreeUtil::isWellFormed' permits equal keys: verify that each key is
+    // ordered before the next.
+
+    const bslalg::RbTreeNode *node = d_tree.firstNode();
+    while (d_tree.sentinel() != node) {
+        const bslalg::RbTreeNode *nextNode = bslalg::RbTreeUtil::next(node);
+        if (d_tree.sentinel() != nextNode && !comparator(*node, *nextNode)) {
+            return false;                                             // RETURN
+        }
+        node = nextNode;
+    }
+    return true;
+}
+
+}  // close namespace bslstl
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
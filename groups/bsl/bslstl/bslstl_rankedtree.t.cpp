@@ -0,0 +1,1256 @@
+// bslstl_rankedtree.t.cpp                                            -*-C++-*-
+#include <bslstl_rankedtree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_set.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+
+#include <algorithm>
+#include <functional>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an order-statistic red-black tree whose
+// invariants, including the subtree size recorded by each node, can be
+// verified by its 'isWellFormed' method.  We exercise the tree through
+// sequences of insertions and erasures, and verify after each operation that
+// the tree is well formed and holds the same values as a 'bsl::set' subjected
+// to the same operations, and that the iterators returned by the operations,
+// and the ranks of those iterators, are at the positions returned by the
+// model.  Besides 'int', we use a value type, 'BigValue', that counts its
+// live instances, so that we can verify that every value constructed by the
+// tree is destroyed.  'rank' and 'select' are verified against walks of the
+// tree from its first value.
+//-----------------------------------------------------------------------------
+// bslstl::RankedTree
+// [ 2] RankedTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+// [ 6] RankedTree(const RankedTree& original, const ALLOCATOR& allocator);
+// [ 2] ~RankedTree();
+// [ 6] RankedTree& operator=(const RankedTree& rhs);
+// [ 2] pair<Iterator, bool> insert(const ValueType& value);
+// [ 4] Iterator erase(ConstIterator position);
+// [ 6] void clear();
+// [ 6] void swap(RankedTree& other);
+// [ 2] Iterator begin();
+// [ 2] Iterator end();
+// [ 5] Iterator find(const KeyType& key);
+// [ 5] Iterator lowerBound(const KeyType& key);
+// [ 5] Iterator upperBound(const KeyType& key);
+// [ 3] Iterator select(SizeType index);
+// [ 2] ALLOCATOR allocator() const;
+// [ 2] const COMPARATOR& comparator() const;
+// [ 2] ConstIterator begin() const;
+// [ 2] ConstIterator end() const;
+// [ 5] ConstIterator find(const KeyType& key) const;
+// [ 5] ConstIterator lowerBound(const KeyType& key) const;
+// [ 5] ConstIterator upperBound(const KeyType& key) const;
+// [ 3] ConstIterator select(SizeType index) const;
+// [ 3] SizeType rank(ConstIterator position) const;
+// [ 2] SizeType size() const;
+// [ 2] SizeType maxSize() const;
+// [ 2] bool isWellFormed() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 7] CONCERN: Insertion is exception neutral with the strong guarantee.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+                               // ==============
+                               // class BigValue
+                               // ==============
+
+class BigValue {
+    // This class provides a value type larger than the links of a node, and
+    // which is not bitwise moveable.  The number of live objects of this
+    // class is counted.
+
+    // DATA
+    int  d_key;        // key of the value
+    char d_pad[252];   // padding
+
+  public:
+    // CLASS DATA
+    static int s_numObjects;  // number of live objects
+
+    // CREATORS
+    explicit BigValue(int key)
+        // Create an object having the specified 'key'.
+    : d_key(key)
+    {
+        d_pad[0] = static_cast<char>(key);
+        ++s_numObjects;
+    }
+
+    BigValue(const BigValue& original)
+        // Create an object having the value of the specified 'original'.
+    : d_key(original.d_key)
+    {
+        d_pad[0] = original.d_pad[0];
+        ++s_numObjects;
+    }
+
+    ~BigValue()
+        // Destroy this object.
+    {
+        ASSERT(static_cast<char>(d_key) == d_pad[0]);
+        d_key = -1;
+        --s_numObjects;
+    }
+
+    // ACCESSORS
+    const int& key() const
+        // Return a reference providing non-modifiable access to the key of
+        // this object.
+    {
+        return d_key;
+    }
+};
+
+int BigValue::s_numObjects = 0;
+
+struct BigValueConfig {
+    // This 'struct' provides the key configuration of 'BigValue' objects.
+
+    typedef BigValue ValueType;
+    typedef int      KeyType;
+
+    static const int& extractKey(const BigValue& value)
+        // Return the key of the specified 'value'.
+    {
+        return value.key();
+    }
+};
+
+typedef bslstl::UnorderedSetKeyConfiguration<int>          IntConfig;
+typedef bslstl::RankedTree<IntConfig,
+                           std::less<int>,
+                           bsl::allocator<int> >           Obj;
+typedef bslstl::RankedTree<BigValueConfig,
+                           std::less<int>,
+                           bsl::allocator<BigValue> >      BigObj;
+typedef bsl::pair<bsl::string, bsl::string>                StringPair;
+typedef bslstl::UnorderedMapKeyConfiguration<StringPair>   StringConfig;
+typedef bslstl::RankedTree<StringConfig,
+                           std::less<bsl::string>,
+                           bsl::allocator<StringPair> >    StringObj;
+typedef bsl::set<int>                                      Model;
+
+struct DefaultDataRow {
+    int d_line;       // source line number
+    int d_numValues;  // number of values to insert
+    int d_stride;     // step between consecutive values inserted
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  values  stride
+    //----  ------  ------
+    { L_,        0,      1 },
+    { L_,        1,      1 },
+    { L_,        3,      1 },
+    { L_,        4,      1 },
+    { L_,        7,     -1 },
+    { L_,       10,      3 },
+    { L_,       40,      7 },
+    { L_,       63,     -1 },
+    { L_,      100,      1 },
+    { L_,      500,     11 },
+    { L_,     2000,     -1 },
+    { L_,     5000,     17 },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+int keyOf(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+int keyOf(const BigValue& value)
+    // Return the key of the specified 'value'.
+{
+    return value.key();
+}
+
+int valueAt(int row, int index)
+    // Return the value at the specified 'index' in the sequence of values of
+    // the specified 'row' of 'DEFAULT_DATA'.  Values are even so that the
+    // odd keys between them can be searched for.
+{
+    const DefaultDataRow& ROW = DEFAULT_DATA[row];
+
+    // Multiplying by a stride that is coprime with the number of values
+    // visits every value exactly once.
+
+    const int n     = ROW.d_numValues;
+    const int slot  = ROW.d_stride < 0
+                    ? n - 1 - index
+                    : static_cast<int>(
+                         (static_cast<long long>(index) * ROW.d_stride) % n);
+    return 2 * slot;
+}
+
+template <class TREE>
+bool isEqual(const TREE& tree, const Model& model)
+    // Return 'true' if the specified 'tree' holds values having the same keys
+    // as the specified 'model', in the same order, when iterated both forward
+    // and backward, and 'false' otherwise.
+{
+    if (tree.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+    Model::const_iterator it = model.begin();
+    for (typename TREE::ConstIterator jt = tree.begin();
+         jt != tree.end();
+         ++jt, ++it) {
+        if (keyOf(*jt) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    typename TREE::ConstIterator jt = tree.end();
+    while (it != model.begin()) {
+        --it;
+        --jt;
+        if (keyOf(*jt) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return jt == tree.begin();
+}
+
+template <class TREE>
+int offsetOf(const TREE& tree, typename TREE::ConstIterator position)
+    // Return the number of values of the specified 'tree' preceding the
+    // specified 'position'.
+{
+    int result = 0;
+    for (typename TREE::ConstIterator it = tree.begin();
+         it != position;
+         ++it) {
+        ++result;
+    }
+    return result;
+}
+
+int offsetOf(const Model& model, Model::const_iterator position)
+    // Return the number of values of the specified 'model' preceding the
+    // specified 'position'.
+{
+    return static_cast<int>(bsl::distance(model.begin(), position));
+}
+
+template <class TREE, class VALUE>
+void testInsertAndErase(int row)
+    // Insert into a tree of the specified (template parameter) type 'TREE' the
+    // values of the specified 'row' of 'DEFAULT_DATA', converted to the
+    // (template parameter) type 'VALUE', and then erase them in a different
+    // order, verifying after each operation that the tree is well formed and
+    // holds the same values as a model, and that the positions returned are
+    // correct.
+{
+    const int LINE = DEFAULT_DATA[row].d_line;
+    const int N    = DEFAULT_DATA[row].d_numValues;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    {
+        TREE  mX(std::less<int>(), &oa);  const TREE& X = mX;
+        Model model(&sa);
+
+        for (int i = 0; i < N; ++i) {
+            const int KEY = valueAt(row, i);
+
+            bsl::pair<typename TREE::Iterator, bool> result =
+                                                        mX.insert(VALUE(KEY));
+            model.insert(KEY);
+
+            ASSERTV(LINE, i, result.second);
+            ASSERTV(LINE, i, KEY == keyOf(*result.first));
+            ASSERTV(LINE, i, X.isWellFormed());
+            ASSERTV(LINE, i, offsetOf(model, model.find(KEY))
+                                                 == offsetOf(X, result.first));
+            ASSERTV(LINE, i, offsetOf(model, model.find(KEY))
+                                  == static_cast<int>(X.rank(result.first)));
+
+            if (N <= 100 || 0 == i % 97) {
+                ASSERTV(LINE, i, isEqual(X, model));
+            }
+
+            // Inserting a duplicate key does not modify the tree.
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            result = mX.insert(VALUE(KEY));
+            ASSERTV(LINE, i, !result.second);
+            ASSERTV(LINE, i, KEY == keyOf(*result.first));
+            ASSERTV(LINE, i, NUM_BLOCKS == oa.numBlocksTotal());
+            ASSERTV(LINE, i, X.size() == model.size());
+        }
+        ASSERTV(LINE, isEqual(X, model));
+
+        // Erase every third value in increasing order, then the rest in
+        // decreasing order of position, comparing the returned position with
+        // the one following the erased value in the model.
+
+        for (int pass = 0; pass < 2; ++pass) {
+            int i = 0;
+            while (0 < X.size()) {
+                int offset;
+                if (0 == pass) {
+                    offset = 2 * i;
+                    if (offset >= static_cast<int>(X.size())) {
+                        break;
+                    }
+                }
+                else {
+                    offset = (i * 7) % static_cast<int>(X.size());
+                }
+
+                typename TREE::ConstIterator position = X.select(offset);
+                ASSERTV(LINE, pass, i, offset == offsetOf(X, position));
+
+                const int KEY = keyOf(*position);
+
+                typename TREE::Iterator result = mX.erase(position);
+                Model::iterator         modelResult =
+                                                model.erase(model.find(KEY));
+
+                ASSERTV(LINE, pass, i, X.isWellFormed());
+                ASSERTV(LINE, pass, i, X.end() == X.find(KEY));
+                ASSERTV(LINE, pass, i, offsetOf(model, modelResult)
+                                                     == offsetOf(X, result));
+                ASSERTV(LINE, pass, i, offsetOf(model, modelResult)
+                                        == static_cast<int>(X.rank(result)));
+                if (N <= 100 || 0 == i % 97) {
+                    ASSERTV(LINE, pass, i, isEqual(X, model));
+                }
+                ++i;
+            }
+            ASSERTV(LINE, pass, isEqual(X, model));
+        }
+        ASSERTV(LINE, 0 == X.size());
+        ASSERTV(LINE, X.begin() == X.end());
+
+        // Erased nodes are retained for reuse: reinserting allocates nothing.
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+        for (int i = 0; i < N; ++i) {
+            mX.insert(VALUE(valueAt(row, i)));
+        }
+        ASSERTV(LINE, NUM_BLOCKS == oa.numBlocksTotal());
+        ASSERTV(LINE, N == static_cast<int>(X.size()));
+    }
+    ASSERTV(LINE, 0 == oa.numBlocksInUse());
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Finding the Median of a Changing Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain a set of 'int' values, and to find the median
+// value (and the number of values less than a given one) as values are added
+// and removed, using a 'RankedTree' (which is generally used through
+// 'bsl::ranked_set').
+//
+// First, we define the type of the tree:
+//..
+    typedef bslstl::UnorderedSetKeyConfiguration<int>  IntConfig;
+    typedef bslstl::RankedTree<IntConfig,
+                               std::less<int>,
+                               bsl::allocator<int> >  IntTree;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a tree and insert the odd values in '[1 .. 99]':
+//..
+    bslma::TestAllocator allocator;
+    IntTree              tree(std::less<int>(), &allocator);
+
+    for (int i = 0; i < 50; ++i) {
+        ASSERT(true == tree.insert((i * 7) % 50 * 2 + 1).second);
+    }
+    ASSERT(false == tree.insert(49).second);
+    ASSERT(50    == tree.size());
+    ASSERT(tree.isWellFormed());
+//..
+// Next, we find the median, the value at index 25, and the number of values
+// less than 50, the rank of the first value not less than 50:
+//..
+    ASSERT(51 == *tree.select(25));
+    ASSERT(25 == tree.rank(tree.lowerBound(50)));
+//..
+// Then, we erase the values less than 20, and observe that the median and
+// ranks have changed accordingly:
+//..
+    IntTree::Iterator it = tree.begin();
+    while (*it < 20) {
+        it = tree.erase(it);
+    }
+    ASSERT(40 == tree.size());
+    ASSERT(61 == *tree.select(20));
+    ASSERT(15 == tree.rank(tree.lowerBound(50)));
+//..
+// Finally, we find the distance between two iterators from their ranks,
+// without visiting the values between them:
+//..
+    IntTree::ConstIterator first = tree.find(21);
+    IntTree::ConstIterator last  = tree.find(81);
+    ASSERT(30 == tree.rank(last) - tree.rank(first));
+    ASSERT(tree.size() == tree.rank(tree.end()));
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING EXCEPTION SAFETY OF 'insert'
+        //
+        // Concerns:
+        //: 1 If an allocation fails during an insertion, whether of a node or
+        //:   of memory for the copy of the value, the tree is unchanged, and
+        //:   no memory is leaked.
+        //:
+        //: 2 Insertions at every depth of the tree are covered.
+        //
+        // Plan:
+        //: 1 Insert, in the presence of injected exceptions, each of a
+        //:   sequence of 'bsl::string' pairs having long (allocated) keys into
+        //:   a tree, and verify after each exception that the tree is well
+        //:   formed and unchanged.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for 'BigValue' objects, whose copy constructor does
+        //:   not allocate, so that the node allocations fail.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Insertion is exception neutral with the strong guarantee.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING EXCEPTION SAFETY OF 'insert'"
+                            "\n====================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        const int N = 400;
+
+        if (verbose) printf("\nInserting 'bsl::string' pairs.\n");
+        {
+            StringObj mX(std::less<bsl::string>(), &oa);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                char buffer[64];
+                sprintf(buffer,
+                        "a key long enough to be allocated: %05d",
+                        (i * 37) % N);
+                const StringPair VALUE(bsl::string(buffer, &sa),
+                                       bsl::string("value", &sa),
+                                       &sa);
+
+                const StringObj::SizeType SIZE = X.size();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, SIZE == X.size());
+                    ASSERTV(i, X.end() == X.find(VALUE.first));
+                    ASSERTV(i, X.isWellFormed());
+
+                    ASSERTV(i, mX.insert(VALUE).second);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, SIZE + 1 == X.size());
+                ASSERTV(i, X.isWellFormed());
+                ASSERTV(i, VALUE == *X.find(VALUE.first));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nInserting 'BigValue' objects.\n");
+        {
+            BigObj mX(std::less<int>(), &oa);  const BigObj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                const BigValue VALUE((i * 37) % N);
+
+                const BigObj::SizeType SIZE = X.size();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, SIZE == X.size());
+                    ASSERTV(i, X.isWellFormed());
+                    ASSERTV(i, static_cast<int>(SIZE + 1)
+                                                   == BigValue::s_numObjects);
+
+                    ASSERTV(i, mX.insert(VALUE).second);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, SIZE + 1 == X.size());
+                ASSERTV(i, X.isWellFormed());
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(BigValue::s_numObjects, 0 == BigValue::s_numObjects);
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND CLEAR
+        //
+        // Concerns:
+        //: 1 A copy has the values, and the subtree sizes, of the original,
+        //:   and uses the allocator supplied to it.
+        //:
+        //: 2 The assignment operator gives the target the values of the
+        //:   source, using the allocator of the target, and self-assignment
+        //:   has no effect.
+        //:
+        //: 3 'swap' exchanges the values of two trees, without allocating if
+        //:   they use the same allocator.
+        //:
+        //: 4 'clear' removes all values, retaining their nodes for reuse.
+        //:
+        //: 5 The copy constructor is exception neutral, and leaks no memory.
+        //
+        // Plan:
+        //: 1 For each row of the table, build a tree of 'BigValue' objects,
+        //:   copy it with and without injected exceptions, and compare the
+        //:   copy with the model.  (C-1, 5)
+        //:
+        //: 2 For each pair of rows of the table, assign, and swap, trees
+        //:   using the same and different allocators, and compare them with
+        //:   the models.  (C-2..3)
+        //:
+        //: 3 Clear each tree and verify that it is empty, and that refilling
+        //:   it allocates no memory.  (C-4)
+        //
+        // Testing:
+        //   RankedTree(const RankedTree& original, const ALLOCATOR& alloc);
+        //   RankedTree& operator=(const RankedTree& rhs);
+        //   void swap(RankedTree& other);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING COPY, ASSIGNMENT, SWAP, AND CLEAR"
+                            "\n=========================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+
+        const int NUM_DATA = 9;  // rows of at most 500 values
+
+        if (verbose) printf("\nTesting copy construction.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            bslma::TestAllocator ya("original", veryVeryVeryVerbose);
+
+            BigObj mY(std::less<int>(), &ya);  const BigObj& Y = mY;
+            Model  model(&sa);
+            for (int i = 0; i < N; ++i) {
+                mY.insert(BigValue(valueAt(ti, i)));
+                model.insert(valueAt(ti, i));
+            }
+
+            {
+                BigObj mX(Y, &oa);  const BigObj& X = mX;
+
+                ASSERTV(LINE, X.isWellFormed());
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, (0 < N) == (0 < oa.numBlocksInUse()));
+                for (int i = 0; i <= N; ++i) {
+                    ASSERTV(LINE, i, i == static_cast<int>(
+                                                     X.rank(X.select(i))));
+                }
+                ASSERTV(LINE, &oa == X.allocator().mechanism());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                BigObj mX(Y, &oa);  const BigObj& X = mX;
+                ASSERTV(LINE, isEqual(X, model));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+            ASSERTV(LINE, static_cast<int>(Y.size())
+                                                   == BigValue::s_numObjects);
+        }
+
+        if (verbose) printf("\nTesting assignment and 'swap'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int ILINE = DEFAULT_DATA[ti].d_line;
+                const int JLINE = DEFAULT_DATA[tj].d_line;
+
+                Obj   mX(std::less<int>(), &oa);  const Obj& X = mX;
+                Obj   mY(std::less<int>(), &oa);  const Obj& Y = mY;
+                Obj   mZ(std::less<int>(), &za);  const Obj& Z = mZ;
+                Model modelX(&sa);
+                Model modelY(&sa);
+                for (int i = 0; i < DEFAULT_DATA[ti].d_numValues; ++i) {
+                    mX.insert(valueAt(ti, i));
+                    modelX.insert(valueAt(ti, i));
+                }
+                for (int i = 0; i < DEFAULT_DATA[tj].d_numValues; ++i) {
+                    mY.insert(valueAt(tj, i) + 1);
+                    mZ.insert(valueAt(tj, i) + 1);
+                    modelY.insert(valueAt(tj, i) + 1);
+                }
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+                mX.swap(mY);
+                ASSERTV(ILINE, JLINE, NUM_BLOCKS == oa.numBlocksTotal());
+                ASSERTV(ILINE, JLINE, isEqual(X, modelY));
+                ASSERTV(ILINE, JLINE, isEqual(Y, modelX));
+                ASSERTV(ILINE, JLINE, X.isWellFormed() && Y.isWellFormed());
+
+                mX.swap(mZ);
+                ASSERTV(ILINE, JLINE, isEqual(X, modelY));
+                ASSERTV(ILINE, JLINE, isEqual(Z, modelY));
+                ASSERTV(ILINE, JLINE, &oa == X.allocator().mechanism());
+                ASSERTV(ILINE, JLINE, &za == Z.allocator().mechanism());
+
+                mZ = Y;
+                ASSERTV(ILINE, JLINE, isEqual(Z, modelX));
+                ASSERTV(ILINE, JLINE, Z.isWellFormed());
+                ASSERTV(ILINE, JLINE, &za == Z.allocator().mechanism());
+
+                mZ = Z;
+                ASSERTV(ILINE, JLINE, isEqual(Z, modelX));
+
+                mX.clear();
+                mY.clear();
+                ASSERTV(ILINE, JLINE, 0 == X.size() && X.isWellFormed());
+                ASSERTV(ILINE, JLINE, 0 == Y.size() && Y.isWellFormed());
+
+                const bsls::Types::Int64 NUM_Z_BLOCKS = za.numBlocksTotal();
+                const Obj::SizeType      Z_SIZE       = Z.size();
+                mZ.clear();
+                ASSERTV(ILINE, JLINE, Z.begin() == Z.end());
+                mZ.clear();
+                ASSERTV(ILINE, JLINE, Z.begin() == Z.end());
+
+                for (int i = 0; i < static_cast<int>(Z_SIZE); ++i) {
+                    mZ.insert(i);
+                }
+                ASSERTV(ILINE, JLINE, NUM_Z_BLOCKS == za.numBlocksTotal());
+                ASSERTV(ILINE, JLINE, Z.isWellFormed());
+            }
+        }
+        ASSERTV(BigValue::s_numObjects, 0 == BigValue::s_numObjects);
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCHES
+        //
+        // Concerns:
+        //: 1 'find', 'lowerBound', and 'upperBound' return the same positions
+        //:   as the corresponding methods of 'bsl::set', for keys present in
+        //:   the tree, and for keys ordered before, between, and after them.
+        //:
+        //: 2 The manipulators return the same positions as the accessors.
+        //
+        // Plan:
+        //: 1 For each row of the table, build trees of 'int' and 'BigValue'
+        //:   objects holding the even values of the row, and compare the
+        //:   results of searching for each key from -1 to one more than the
+        //:   largest value with those of a model.  (C-1..2)
+        //
+        // Testing:
+        //   Iterator find(const KeyType& key);
+        //   Iterator lowerBound(const KeyType& key);
+        //   Iterator upperBound(const KeyType& key);
+        //   ConstIterator find(const KeyType& key) const;
+        //   ConstIterator lowerBound(const KeyType& key) const;
+        //   ConstIterator upperBound(const KeyType& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCHES"
+                            "\n================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int NUM_DATA = 11;  // rows of at most 2000 values
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            Obj    mX(std::less<int>(), &oa);  const Obj&    X = mX;
+            BigObj mB(std::less<int>(), &oa);  const BigObj& B = mB;
+            Model  model(&oa);
+            for (int i = 0; i < N; ++i) {
+                mX.insert(valueAt(ti, i));
+                mB.insert(BigValue(valueAt(ti, i)));
+                model.insert(valueAt(ti, i));
+            }
+            const Model& M = model;
+
+            for (int key = -1; key <= 2 * N; ++key) {
+                if (veryVeryVerbose) { T_ P_(N) P(key) }
+
+                const int FIND  = offsetOf(M, M.find(key));
+                const int LOWER = offsetOf(M, M.lower_bound(key));
+                const int UPPER = offsetOf(M, M.upper_bound(key));
+
+                ASSERTV(LINE, key, FIND  == offsetOf(X, X.find(key)));
+                ASSERTV(LINE, key, LOWER == offsetOf(X, X.lowerBound(key)));
+                ASSERTV(LINE, key, UPPER == offsetOf(X, X.upperBound(key)));
+
+                ASSERTV(LINE, key, FIND  == offsetOf(B, B.find(key)));
+                ASSERTV(LINE, key, LOWER == offsetOf(B, B.lowerBound(key)));
+                ASSERTV(LINE, key, UPPER == offsetOf(B, B.upperBound(key)));
+
+                ASSERTV(LINE, key, X.find(key)       == mX.find(key));
+                ASSERTV(LINE, key, X.lowerBound(key) == mX.lowerBound(key));
+                ASSERTV(LINE, key, X.upperBound(key) == mX.upperBound(key));
+                ASSERTV(LINE, key, B.find(key)       == mB.find(key));
+                ASSERTV(LINE, key, B.lowerBound(key) == mB.lowerBound(key));
+                ASSERTV(LINE, key, B.upperBound(key) == mB.upperBound(key));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'erase'
+        //
+        // Concerns:
+        //: 1 Erasing a value from a leaf node, and from a node having one or
+        //:   two children, removes only that value, and leaves the tree well
+        //:   formed, with valid subtree sizes.
+        //:
+        //: 2 Erasures that rebalance the tree, and that remove the root,
+        //:   leave the tree well formed.
+        //:
+        //: 3 'erase' returns the position of the value that followed the
+        //:   erased one, or the past-the-end position.
+        //:
+        //: 4 Erasing all values releases all nodes and destroys all values.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, build trees of 'int' and 'BigValue'
+        //:   objects, and erase every third value in increasing order, and
+        //:   then the remaining values at varying positions, comparing with a
+        //:   model after each erasure.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   Iterator erase(ConstIterator position);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'erase'"
+                            "\n===============\n");
+
+        // 'testInsertAndErase' checks the results of 'insert' as well as
+        // those of 'erase'; 'insert' is tested (with less coverage) in case 2.
+
+        for (int ti = 0; ti < DEFAULT_NUM_DATA; ++ti) {
+            if (veryVerbose) { T_ P(DEFAULT_DATA[ti].d_numValues) }
+
+            testInsertAndErase<Obj, int>(ti);
+            testInsertAndErase<BigObj, BigValue>(ti);
+        }
+        ASSERTV(BigValue::s_numObjects, 0 == BigValue::s_numObjects);
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            mX.insert(1);
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(Obj::ConstIterator()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'rank' AND 'select'
+        //
+        // Concerns:
+        //: 1 'rank' returns the number of values preceding a position, and
+        //:   the size of the tree for the past-the-end position.
+        //:
+        //: 2 'select' returns the position preceded by the supplied number of
+        //:   values, and the past-the-end position for the size of the tree.
+        //:
+        //: 3 The manipulator 'select' returns the same position as the
+        //:   accessor.
+        //:
+        //: 4 Ranks remain correct after erasures that rebalance the tree.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each row of the table, build trees of 'int' and 'BigValue'
+        //:   objects, and compare the rank of each position, and the position
+        //:   selected by each index, with a walk from the first value.
+        //:   (C-1..3)
+        //:
+        //: 2 Erase every other value of the trees of P-1 and repeat P-1.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   Iterator select(SizeType index);
+        //   ConstIterator select(SizeType index) const;
+        //   SizeType rank(ConstIterator position) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'rank' AND 'select'"
+                            "\n===========================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int NUM_DATA = 11;  // rows of at most 2000 values
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            Obj    mX(std::less<int>(), &oa);  const Obj&    X = mX;
+            BigObj mB(std::less<int>(), &oa);  const BigObj& B = mB;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(valueAt(ti, i));
+                mB.insert(BigValue(valueAt(ti, i)));
+            }
+
+            for (int pass = 0; pass < 2; ++pass) {
+                const int SIZE = static_cast<int>(X.size());
+
+                if (veryVerbose) { T_ P_(LINE) P_(pass) P(SIZE) }
+
+                int                   index = 0;
+                Obj::ConstIterator    it = X.begin();
+                BigObj::ConstIterator jt = B.begin();
+                for (; index <= SIZE; ++index) {
+                    ASSERTV(LINE, pass, index,
+                            index == static_cast<int>(X.rank(it)));
+                    ASSERTV(LINE, pass, index,
+                            index == static_cast<int>(B.rank(jt)));
+                    ASSERTV(LINE, pass, index, it == X.select(index));
+                    ASSERTV(LINE, pass, index, jt == B.select(index));
+                    ASSERTV(LINE, pass, index, it == mX.select(index));
+                    ASSERTV(LINE, pass, index, jt == mB.select(index));
+
+                    if (index < SIZE) {
+                        ++it;
+                        ++jt;
+                    }
+                }
+                ASSERTV(LINE, pass, X.end() == it);
+                ASSERTV(LINE, pass, B.end() == jt);
+
+                // Erase every other value.
+
+                Obj::Iterator    xt = mX.begin();
+                BigObj::Iterator bt = mB.begin();
+                while (xt != X.end()) {
+                    xt = mX.erase(xt);
+                    bt = mB.erase(bt);
+                    if (xt != X.end()) {
+                        ++xt;
+                        ++bt;
+                    }
+                }
+                ASSERTV(LINE, pass, X.isWellFormed());
+                ASSERTV(LINE, pass, B.isWellFormed());
+                ASSERTV(LINE, pass, SIZE / 2 == static_cast<int>(X.size()));
+            }
+        }
+        ASSERTV(BigValue::s_numObjects, 0 == BigValue::s_numObjects);
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            mX.insert(1);
+            mX.insert(2);
+
+            ASSERT_SAFE_PASS(X.select(0));
+            ASSERT_SAFE_PASS(X.select(2));
+            ASSERT_SAFE_FAIL(X.select(3));
+            ASSERT_SAFE_PASS(mX.select(2));
+            ASSERT_SAFE_FAIL(mX.select(3));
+
+            ASSERT_SAFE_PASS(X.rank(X.end()));
+            ASSERT_SAFE_FAIL(X.rank(Obj::ConstIterator()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed tree is empty and well formed, uses the
+        //:   supplied comparator and allocator, and allocates no memory.
+        //:
+        //: 2 'insert' adds a value whose key is not present, returning its
+        //:   position and 'true', and leaves the tree unchanged, returning the
+        //:   position of the existing value and 'false', otherwise.
+        //:
+        //: 3 Insertions that rebalance the tree leave it well formed, with
+        //:   valid subtree sizes.
+        //:
+        //: 4 All memory comes from the supplied allocator, and is released by
+        //:   the destructor, which destroys every value.
+        //
+        // Plan:
+        //: 1 Create trees with different comparators and allocators, and
+        //:   verify the basic accessors.  (C-1)
+        //:
+        //: 2 For each row of the table, insert the values of the row into
+        //:   trees of 'int' and 'BigValue' objects, and verify the result of
+        //:   each insertion, and the values of the tree.  (C-2..4)
+        //
+        // Testing:
+        //   RankedTree(const COMPARATOR& comp, const ALLOCATOR& allocator);
+        //   ~RankedTree();
+        //   pair<Iterator, bool> insert(const ValueType& value);
+        //   Iterator begin();
+        //   Iterator end();
+        //   ALLOCATOR allocator() const;
+        //   const COMPARATOR& comparator() const;
+        //   ConstIterator begin() const;
+        //   ConstIterator end() const;
+        //   SizeType size() const;
+        //   SizeType maxSize() const;
+        //   bool isWellFormed() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          "\n================================================"
+                          "\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting default state.\n");
+        {
+            const Obj X(std::less<int>(), &oa);
+
+            ASSERT(0 == X.size());
+            ASSERT(0 <  X.maxSize());
+            ASSERT(INT_MAX >= X.maxSize());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.isWellFormed());
+            ASSERT(&oa == X.allocator().mechanism());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            typedef bslstl::RankedTree<IntConfig,
+                                       std::greater<int>,
+                                       bsl::allocator<int> > GreaterObj;
+
+            const std::greater<int>   COMPARATOR;
+            const bsl::allocator<int> ALLOCATOR;
+
+            GreaterObj mY(COMPARATOR, ALLOCATOR);
+            const GreaterObj& Y = mY;
+            ASSERT(Y.comparator()(2, 1));
+            ASSERT(&da == Y.allocator().mechanism());
+
+            mY.insert(1);
+            mY.insert(3);
+            mY.insert(2);
+            ASSERT(3 == *Y.begin());
+            ASSERT(0 <  da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        if (verbose) printf("\nTesting 'insert'.\n");
+
+        for (int ti = 0; ti < DEFAULT_NUM_DATA; ++ti) {
+            const int LINE = DEFAULT_DATA[ti].d_line;
+            const int N    = DEFAULT_DATA[ti].d_numValues;
+
+            {
+                Obj    mX(std::less<int>(), &oa);  const Obj&    X = mX;
+                BigObj mB(std::less<int>(), &oa);  const BigObj& B = mB;
+                Model  model(&sa);
+
+                for (int i = 0; i < N; ++i) {
+                    const int KEY = valueAt(ti, i);
+
+                    bsl::pair<Obj::Iterator, bool> result = mX.insert(KEY);
+                    ASSERTV(LINE, i, result.second);
+                    ASSERTV(LINE, i, KEY == *result.first);
+
+                    bsl::pair<BigObj::Iterator, bool> bigResult =
+                                                      mB.insert(BigValue(KEY));
+                    ASSERTV(LINE, i, bigResult.second);
+                    ASSERTV(LINE, i, KEY == bigResult.first->key());
+
+                    model.insert(KEY);
+
+                    result = mX.insert(KEY);
+                    ASSERTV(LINE, i, !result.second);
+                    ASSERTV(LINE, i, KEY == *result.first);
+
+                    ASSERTV(LINE, i, i + 1 == static_cast<int>(X.size()));
+                    ASSERTV(LINE, i, i + 1 == static_cast<int>(B.size()));
+                    if (N <= 100) {
+                        ASSERTV(LINE, i, X.isWellFormed());
+                        ASSERTV(LINE, i, B.isWellFormed());
+                    }
+                }
+                ASSERTV(LINE, X.isWellFormed());
+                ASSERTV(LINE, B.isWellFormed());
+                ASSERTV(LINE, isEqual(X, model));
+                ASSERTV(LINE, isEqual(B, model));
+                ASSERTV(LINE, N == BigValue::s_numObjects);
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+            ASSERTV(LINE, 0 == BigValue::s_numObjects);
+        }
+        ASSERTV(da.numBlocksTotal(),
+                NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, rank, select, iterate over, and erase the values
+        //:   of a tree.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(X.isWellFormed());
+            ASSERT(X.begin() == X.end());
+
+            const int N = 10000;
+            for (int i = 0; i < N; ++i) {
+                ASSERT(mX.insert((i * 7919) % N).second);
+            }
+            ASSERT(N == static_cast<int>(X.size()));
+            ASSERT(X.isWellFormed());
+
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, i == *X.find(i));
+                ASSERTV(i, i == static_cast<int>(X.rank(X.find(i))));
+                ASSERTV(i, i == *X.select(i));
+            }
+            ASSERT(X.end() == X.find(N));
+
+            int expected = 0;
+            for (Obj::ConstIterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(expected, expected == *it);
+                ++expected;
+            }
+            ASSERT(N == expected);
+
+            for (int i = 0; i < N; i += 2) {
+                Obj::Iterator it = mX.erase(X.find(i));
+                ASSERTV(i, i + 1 == *it);
+                ASSERTV(i, i / 2 == static_cast<int>(X.rank(it)));
+            }
+            ASSERT(N / 2 == static_cast<int>(X.size()));
+            ASSERT(X.isWellFormed());
+
+            Obj::Iterator it = mX.begin();
+            while (it != X.end()) {
+                it = mX.erase(it);
+            }
+            ASSERT(0 == X.size());
+            ASSERT(X.isWellFormed());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
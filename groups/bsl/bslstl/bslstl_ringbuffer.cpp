@@ -0,0 +1,61 @@
+// bslstl_ringbuffer.cpp                                              -*-C++-*-
+#include <bslstl_ringbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace bsl {
+
+                           // ----------------------
+                           // struct RingBuffer_Util
+                           // ----------------------
+
+// CLASS METHODS
+std::size_t RingBuffer_Util::computeNumSlots(std::size_t minNumSlots)
+{
+    std::size_t numSlots = minNumSlots ? 1 : 0;
+    while (numSlots < minNumSlots) {
+        BSLS_ASSERT_SAFE(numSlots <= ~std::size_t(0) / 2);
+
+        numSlots *= 2;
+    }
+    return numSlots;
+}
+
+std::size_t RingBuffer_Util::maxNumSlots(std::size_t maxLength)
+{
+    if (0 == maxLength) {
+        return 0;                                                     // RETURN
+    }
+
+    std::size_t numSlots = 1;
+    while (numSlots <= maxLength / 2) {
+        numSlots *= 2;
+    }
+    return numSlots;
+}
+
+}  // close namespace bsl
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1638 @@
+// bslstl_ringbuffer.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_RINGBUFFER
+#define INCLUDED_BSLSTL_RINGBUFFER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a double-ended sequence held in a circular array.
+//
+//@CLASSES:
+//   bsl::ring_buffer: sequence of values held in a power-of-two ring buffer
+//
+//@SEE_ALSO: bslstl_deque, bslstl_queue, bslstl_stack
+//
+//@DESCRIPTION: This component defines a single class template, 'ring_buffer',
+// implementing a container holding a sequence of values that may be added and
+// removed at either end in constant time, and that is held in a single
+// contiguous array of slots used as a circular buffer.  A 'ring_buffer'
+// provides the members required of the underlying container of 'bsl::queue'
+// (see 'bslstl_queue') and of 'bsl::stack' (see 'bslstl_stack').
+//
+// An instantiation of 'ring_buffer' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of elements) and the sequence
+// of values the 'ring_buffer' contains.  Its capacity, and whether that
+// capacity is fixed (see below), are *not* salient attributes.
+//
+///Choosing Between 'deque' and 'ring_buffer'
+///------------------------------------------
+// A 'bsl::deque' holds its elements in fixed-size blocks addressed through an
+// array of block pointers, so each 'push_back' or 'pop_front' steps an
+// iterator that must check whether it has crossed into another block, and
+// each element access goes through two indirections.  A 'ring_buffer' holds
+// its elements in an array of slots whose number is a power of two, and
+// locates the slot of the element having an index 'i' by masking the sum of
+// 'i' and the slot of the first element: the hot path of each 'push_back',
+// 'pop_front', and 'operator[]' is a few arithmetic instructions on a single
+// array, and a queue whose length is stable allocates no memory at all.
+//
+// In exchange, a growable 'ring_buffer' relocates all its elements when it
+// grows (by doubling its number of slots, so that adding an element takes
+// amortized constant time), which a 'deque' never does; a 'ring_buffer' does
+// not support insertion or erasure other than at its ends; and it never
+// returns memory to its allocator before it is destroyed.  Also, any 'push'
+// that grows the 'ring_buffer' invalidates all iterators and references to its
+// elements.  Elements are relocated by 'bslalg::ArrayPrimitives', which moves
+// them with 'memcpy' if 'VALUE_TYPE' has the 'bslmf::IsBitwiseMoveable' trait.
+//
+///Fixed-Capacity Mode
+///-------------------
+// A 'ring_buffer' constructed with a fixed capacity allocates, at
+// construction, the slots for that number of elements, and never allocates
+// again: the references to its elements are never invalidated by adding other
+// elements, and an attempt to add an element to a full 'ring_buffer' (one for
+// which 'full()' returns 'true') throws a 'bsl::length_error' exception and
+// leaves the 'ring_buffer' unchanged.  Whether a 'ring_buffer' has a fixed
+// capacity, and that capacity, are copied by copy construction, assignment,
+// and 'swap' along with its value.  A 'ring_buffer' constructed with only an
+// allocator (as it is by 'bsl::queue' and 'bsl::stack') is growable: to use a
+// fixed-capacity 'ring_buffer' in a 'bsl::queue', supply a (typically empty)
+// fixed-capacity 'ring_buffer' to the constructor of the 'queue' (see Example
+// 1).
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a ring buffer's 'ALLOCATOR' template parameter
+// determines how that ring buffer will allocate memory.  If the 'ALLOCATOR' is
+// 'bsl::allocator' (the default), then objects of the ring buffer type conform
+// to the standard behavior of a 'bslma'-allocator-enabled type: the ring
+// buffer accepts an optional 'bslma::Allocator' argument at construction, uses
+// it to supply memory for its array of slots throughout its lifetime, and
+// supplies it to the constructors of the elements it holds if 'VALUE_TYPE' has
+// the 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'ring_buffer':
+//..
+//  Legend
+//  ------
+//  'V'             - (template parameter) type 'VALUE_TYPE' of the ring buffer
+//  'a', 'b'        - two distinct objects of type 'ring_buffer<V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - a fixed capacity
+//  'al'            - an STL-style memory allocator
+//  'v'             - an object of type 'V'
+//  'i'             - an index into 'a'
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | ring_buffer<V> a;    (default construction)        | O[1]               |
+//  | ring_buffer<V> a(al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | ring_buffer<V> a(c, al);                           | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | ring_buffer<V> a(b); (copy construction)           | O[m]               |
+//  | ring_buffer<V> a(b, al);                           |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~ring_buffer<V>(); (destruction)                 | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;               (assignment)                  | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty(), a.full()                      | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.capacity(), a.max_size(), a.is_fixed_capacity()  | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.push_back(v), a.push_front(v)                    | Amortized O[1]     |
+//  +----------------------------------------------------+--------------------+
+//  | a.pop_back(), a.pop_front()                        | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.front(), a.back(), a[i], a.at(i)                 | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(c)                                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: A Bounded Send Queue
+///- - - - - - - - - - - - - - - -
+// Suppose that each session of a server queues the identifiers of the
+// messages it has yet to send, and that, to bound the memory used by a slow
+// client, a session refuses to queue more than a fixed number of messages.
+//
+// First, we define the type of the send queue, a 'bsl::queue' using a
+// 'ring_buffer' as its underlying container:
+//..
+//  typedef bsl::queue<int, bsl::ring_buffer<int> > SendQueue;
+//..
+// Then, we create a send queue from an empty 'ring_buffer' having a fixed
+// capacity of 3 messages, which allocates its slots immediately:
+//..
+//  bslma::TestAllocator allocator;
+//  SendQueue            sendQueue(bsl::ring_buffer<int>(3, &allocator),
+//                                 &allocator);
+//  assert(0 < allocator.numBlocksInUse());
+//
+//  const bsls::Types::Int64 numAllocations = allocator.numAllocations();
+//..
+// Next, we queue messages, which allocates no memory, until the queue holds
+// as many messages as the session allows:
+//..
+//  sendQueue.push(101);
+//  sendQueue.push(102);
+//  sendQueue.push(103);
+//  assert(3 == sendQueue.size());
+//  assert(numAllocations == allocator.numAllocations());
+//..
+// Note that an attempt to 'push' a fourth message would throw a
+// 'bsl::length_error' exception, leaving the queue unchanged, so that a
+// session would rather compare the size of its queue to the capacity with
+// which it created the 'ring_buffer' before queuing a message.
+//
+// Finally, we send the messages in the order in which they were queued, and
+// queue another:
+//..
+//  assert(101 == sendQueue.front());  sendQueue.pop();
+//  assert(102 == sendQueue.front());  sendQueue.pop();
+//  sendQueue.push(104);
+//  assert(103 == sendQueue.front());  sendQueue.pop();
+//  assert(104 == sendQueue.front());  sendQueue.pop();
+//  assert(true == sendQueue.empty());
+//  assert(numAllocations == allocator.numAllocations());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_RANDOMACCESSITERATOR
+#include <bslstl_randomaccessiterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_AUTOARRAYDESTRUCTOR
+#include <bslalg_autoarraydestructor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_CONTAINERBASE
+#include <bslalg_containerbase.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // 'equal', 'lexicographical_compare'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                           // ======================
+                           // struct RingBuffer_Util
+                           // ======================
+
+struct RingBuffer_Util {
+    // This 'struct' provides a namespace for utility functions computing the
+    // number of slots of a 'ring_buffer'.
+
+    // CLASS METHODS
+    static std::size_t computeNumSlots(std::size_t minNumSlots);
+        // Return the least power of two that is greater than or equal to the
+        // specified 'minNumSlots', or 0 if 'minNumSlots' is 0.  The behavior
+        // is undefined unless such a power of two is representable by
+        // 'std::size_t'.
+
+    static std::size_t maxNumSlots(std::size_t maxLength);
+        // Return the greatest power of two that is less than or equal to the
+        // specified 'maxLength', or 0 if 'maxLength' is 0.
+};
+
+                       // ============================
+                       // class RingBuffer_IteratorImp
+                       // ============================
+
+template <class VALUE_TYPE>
+class RingBuffer_IteratorImp {
+    // This class template provides the implementation of the iterators of a
+    // 'ring_buffer', meeting the requirements of the 'ITER_IMP' template
+    // parameter of 'bslstl::RandomAccessIterator'.  An iterator refers to the
+    // element having an index 'i' in a ring buffer whose first element is held
+    // in the slot 's' by the *position* 's + i', which, masked by the number
+    // of slots minus one, is the slot holding the element.  As 's' is less
+    // than the number of slots, positions do not wrap, and the difference of
+    // the positions of two iterators is the difference of the indices of the
+    // elements to which they refer.
+
+    // DATA
+    VALUE_TYPE  *d_slots_p;   // array of slots of the ring buffer
+    std::size_t  d_mask;      // number of slots of the ring buffer, minus one
+    std::size_t  d_position;  // position of the element referred to
+
+  public:
+    // CREATORS
+    RingBuffer_IteratorImp();
+        // Create an iterator that does not refer to any element.
+
+    RingBuffer_IteratorImp(VALUE_TYPE  *slots,
+                           std::size_t  mask,
+                           std::size_t  position);
+        // Create an iterator referring to the element at the specified
+        // 'position' in the specified array of 'slots' of a ring buffer having
+        // the specified 'mask + 1' slots.
+
+    // RingBuffer_IteratorImp(const RingBuffer_IteratorImp& original) =
+    //                                                                default;
+    // ~RingBuffer_IteratorImp() = default;
+
+    // MANIPULATORS
+    // RingBuffer_IteratorImp& operator=(const RingBuffer_IteratorImp& rhs) =
+    //                                                                default;
+
+    void operator++();
+        // Refer to the element following the element referred to by this
+        // iterator.
+
+    void operator--();
+        // Refer to the element preceding the element referred to by this
+        // iterator.
+
+    void operator+=(std::ptrdiff_t offset);
+        // Refer to the element at the specified 'offset' from the element
+        // referred to by this iterator.
+
+    // ACCESSORS
+    VALUE_TYPE& operator*() const;
+        // Return a reference providing modifiable access to the element
+        // referred to by this iterator.  The behavior is undefined unless
+        // this iterator refers to an element.
+
+    std::size_t position() const;
+        // Return the position of the element referred to by this iterator.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE>
+bool operator==(const RingBuffer_IteratorImp<VALUE_TYPE>& lhs,
+                const RingBuffer_IteratorImp<VALUE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same element, and 'false' otherwise.  The behavior is undefined unless
+    // 'lhs' and 'rhs' are iterators into the same ring buffer.
+
+template <class VALUE_TYPE>
+bool operator<(const RingBuffer_IteratorImp<VALUE_TYPE>& lhs,
+               const RingBuffer_IteratorImp<VALUE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' iterator refers to an element
+    // preceding that referred to by the specified 'rhs' iterator, and 'false'
+    // otherwise.  The behavior is undefined unless 'lhs' and 'rhs' are
+    // iterators into the same ring buffer.
+
+template <class VALUE_TYPE>
+std::ptrdiff_t operator-(const RingBuffer_IteratorImp<VALUE_TYPE>& lhs,
+                         const RingBuffer_IteratorImp<VALUE_TYPE>& rhs);
+    // Return the number of elements from the element referred to by the
+    // specified 'rhs' iterator to that referred to by the specified 'lhs'
+    // iterator.  The behavior is undefined unless 'lhs' and 'rhs' are
+    // iterators into the same ring buffer.
+
+                            // =================
+                            // class ring_buffer
+                            // =================
+
+template <class VALUE_TYPE, class ALLOCATOR = bsl::allocator<VALUE_TYPE> >
+class ring_buffer : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template implements a value-semantic container type holding
+    // a sequence of values (of the template parameter type, 'VALUE_TYPE'),
+    // which may be added and removed at either end, in an array of slots,
+    // whose number is zero or a power of two, used as a circular buffer.  If
+    // the capacity of a 'ring_buffer' is not fixed (see {Fixed-Capacity
+    // Mode}), adding an element to a full 'ring_buffer' doubles its number of
+    // slots.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR> ContainerBase;
+        // Container base type, containing the allocator and applying empty
+        // base class optimization (EBO) whenever appropriate.
+
+    typedef RingBuffer_IteratorImp<VALUE_TYPE>            IteratorImp;
+
+    class Guard {
+        // This class provides a proctor for deallocating an array of slots of
+        // a 'ring_buffer', to be used while the elements of the array are
+        // being constructed.
+
+        // DATA
+        VALUE_TYPE    *d_slots_p;      // array of slots
+        std::size_t    d_numSlots;     // number of slots of the array
+        ContainerBase *d_container_p;  // container base pointer
+
+      public:
+        // CREATORS
+        Guard(VALUE_TYPE    *slots,
+              std::size_t    numSlots,
+              ContainerBase *container);
+            // Create a proctor for the specified array of 'slots' having the
+            // specified 'numSlots', using the 'deallocateN' method of the
+            // specified 'container' to return 'slots' to its allocator upon
+            // destruction, unless this proctor's 'release' is called prior.
+
+        ~Guard();
+            // Destroy this proctor, deallocating any slots under management.
+
+        // MANIPULATORS
+        void release();
+            // Release the slots from management by this proctor.
+    };
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                                 value_type;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef std::size_t                                size_type;
+    typedef std::ptrdiff_t                             difference_type;
+    typedef typename ALLOCATOR::pointer                pointer;
+    typedef typename ALLOCATOR::const_pointer          const_pointer;
+
+    typedef BloombergLP::bslstl::RandomAccessIterator<VALUE_TYPE,
+                                                      IteratorImp>
+                                                       iterator;
+    typedef BloombergLP::bslstl::RandomAccessIterator<const VALUE_TYPE,
+                                                      IteratorImp>
+                                                       const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    VALUE_TYPE *d_slots_p;          // array of 'd_numSlots' slots, or 0
+    size_type   d_numSlots;         // number of slots, 0 or a power of two
+    size_type   d_start;            // slot holding the first element, less
+                                    // than 'd_numSlots' (or 0)
+    size_type   d_length;           // number of elements
+    size_type   d_capacity;         // maximum number of elements before
+                                    // growing (or throwing if fixed)
+    bool        d_isFixedCapacity;  // 'true' if 'd_capacity' is fixed
+
+    // PRIVATE MANIPULATORS
+    void privateInstall(VALUE_TYPE *slots, size_type numSlots);
+        // Deallocate the slots of this ring buffer, whose elements have been
+        // relocated to the beginning of the specified array of 'slots' having
+        // the specified 'numSlots', and adopt 'slots'.
+
+    void privateRelocate(VALUE_TYPE *slots);
+        // Move the elements of this ring buffer, in order, to the beginning
+        // of the specified uninitialized array of 'slots', leaving the slots
+        // of this ring buffer uninitialized.  If an exception is thrown,
+        // neither this ring buffer nor 'slots' are modified.  The behavior is
+        // undefined unless 'slots' has room for 'size()' elements.
+
+    void privateSwap(ring_buffer& other);
+        // Exchange the value and capacity of this object with those of the
+        // specified 'other' object, without exchanging their allocators.
+
+    // PRIVATE ACCESSORS
+    size_type privateGrowthNumSlots() const;
+        // Return the number of slots to which this ring buffer grows when
+        // full.  Throw 'bsl::length_error' if this ring buffer has a fixed
+        // capacity, or if that number of slots would exceed 'max_size()'.
+
+    void privateCopy(VALUE_TYPE *slots) const;
+        // Copy-construct the elements of this ring buffer, in order, at the
+        // beginning of the specified uninitialized array of 'slots', using the
+        // allocator of this ring buffer for their construction.  If an
+        // exception is thrown, 'slots' is not modified.  The behavior is
+        // undefined unless 'slots' has room for 'size()' elements.
+
+    VALUE_TYPE *privateSlot(size_type index) const;
+        // Return the address of the slot holding the element at the specified
+        // 'index' in this ring buffer.
+
+  public:
+    // CREATORS
+    explicit ring_buffer(const ALLOCATOR& allocator = ALLOCATOR());
+        // Construct an empty, growable ring buffer.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not supplied,
+        // a default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'allocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator' and
+        // 'allocator' is not supplied, the currently installed default
+        // allocator is used to supply memory.  No memory is allocated until an
+        // element is added.
+
+    explicit ring_buffer(size_type        fixedCapacity,
+                         const ALLOCATOR& allocator = ALLOCATOR());
+        // Construct an empty ring buffer having the specified 'fixedCapacity'
+        // that allocates, from the optionally specified 'allocator', the slots
+        // for 'fixedCapacity' elements, and never grows.  If 'allocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  If the 'ALLOCATOR' is
+        // 'bsl::allocator' (the default), then 'allocator', if supplied, shall
+        // be convertible to 'bslma::Allocator *'.  Throw 'bsl::length_error'
+        // if 'fixedCapacity' exceeds the 'max_size()' of a growable ring
+        // buffer.  Note that, unlike the similar constructor of 'bsl::vector'
+        // or 'bsl::deque', this constructor creates no elements.
+
+    ring_buffer(const ring_buffer& original);
+        // Construct a ring buffer having the same value and capacity as the
+        // specified 'original', and having a fixed capacity if 'original'
+        // does.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) type 'VALUE_TYPE' be "copy-constructible".
+
+    ring_buffer(const ring_buffer& original, const ALLOCATOR& allocator);
+        // Construct a ring buffer having the same value and capacity as the
+        // specified 'original', and having a fixed capacity if 'original'
+        // does, that will use the specified 'allocator' to supply memory.
+        // This method requires that the (template parameter) type
+        // 'VALUE_TYPE' be "copy-constructible".
+
+    ~ring_buffer();
+        // Destroy this object.
+
+    // MANIPULATORS
+    ring_buffer& operator=(const ring_buffer& rhs);
+        // Assign to this object the value and capacity of the specified 'rhs'
+        // object, making the capacity of this object fixed if and only if
+        // that of 'rhs' is, and return a reference providing modifiable access
+        // to this object.  This method requires that the (template parameter)
+        // type 'VALUE_TYPE' be "copy-constructible".
+
+    void push_back(const VALUE_TYPE& value);
+        // Append to the end of this ring buffer a copy of the specified
+        // 'value'.  If this ring buffer is full, grow it, invalidating all
+        // iterators and references to its elements, or, if its capacity is
+        // fixed, throw 'bsl::length_error'.  If an exception is thrown, this
+        // ring buffer is unchanged.  This method requires that the (template
+        // parameter) type 'VALUE_TYPE' be "copy-constructible".
+
+    void push_front(const VALUE_TYPE& value);
+        // Prepend to the beginning of this ring buffer a copy of the specified
+        // 'value'.  If this ring buffer is full, grow it, invalidating all
+        // iterators and references to its elements, or, if its capacity is
+        // fixed, throw 'bsl::length_error'.  If an exception is thrown, this
+        // ring buffer is unchanged.  This method requires that the (template
+        // parameter) type 'VALUE_TYPE' be "copy-constructible".
+
+    void pop_back();
+        // Erase the last element from this ring buffer.  The behavior is
+        // undefined if this ring buffer is empty.
+
+    void pop_front();
+        // Erase the first element from this ring buffer.  The behavior is
+        // undefined if this ring buffer is empty.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this ring buffer such that it is at least
+        // the specified 'numElements', invalidating all iterators and
+        // references to its elements if it grows.  Throw 'bsl::length_error'
+        // if 'numElements > max_size()' (which, if the capacity of this ring
+        // buffer is fixed, is its capacity).  If an exception is thrown, this
+        // ring buffer is unchanged.  Note that this method has no effect if
+        // 'numElements <= capacity()'.
+
+    void clear();
+        // Remove all elements from this ring buffer, retaining its slots.
+
+    void swap(ring_buffer& other);
+        // Exchange the value and capacity of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if this object and 'other' use the same
+        // allocator, and otherwise copies the elements of each ring buffer
+        // using the allocator of the other.
+
+    reference operator[](size_type index);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'index' in this ring buffer.  The behavior is
+        // undefined unless 'index < size()'.
+
+    reference at(size_type index);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'index' in this ring buffer.  Throw
+        // 'bsl::out_of_range' if 'index >= size()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // of this ring buffer.  The behavior is undefined if this ring buffer
+        // is empty.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // of this ring buffer.  The behavior is undefined if this ring buffer
+        // is empty.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first element
+        // of this ring buffer, or the 'end' iterator if it is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element of this ring buffer.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // element of this ring buffer, or 'rend' if it is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element of this ring buffer.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // ring buffer.
+
+    const_reference operator[](size_type index) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'index' in this ring buffer.  The behavior is
+        // undefined unless 'index < size()'.
+
+    const_reference at(size_type index) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'index' in this ring buffer.  Throw
+        // 'bsl::out_of_range' if 'index >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this ring buffer.  The behavior is undefined if this ring
+        // buffer is empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this ring buffer.  The behavior is undefined if this ring
+        // buffer is empty.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // element of this ring buffer, or the 'end' iterator if it is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element of this ring buffer.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element of this ring buffer, or 'rend' if it is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element of this ring buffer.
+
+    bool empty() const;
+        // Return 'true' if this ring buffer contains no elements, and 'false'
+        // otherwise.
+
+    bool full() const;
+        // Return 'true' if the number of elements of this ring buffer is its
+        // capacity, so that adding an element would grow it (or, if its
+        // capacity is fixed, throw), and 'false' otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this ring buffer.
+
+    size_type capacity() const;
+        // Return the number of elements that this ring buffer can hold without
+        // allocating memory (if it is growable) or at all (if its capacity is
+        // fixed).
+
+    bool is_fixed_capacity() const;
+        // Return 'true' if the capacity of this ring buffer is fixed, and
+        // 'false' if it grows as elements are added.
+
+    size_type max_size() const;
+        // Return the capacity of this ring buffer if it is fixed, and
+        // otherwise a theoretical upper bound on the largest number of
+        // elements that it could possibly hold.  Note that there is no
+        // guarantee that a growable ring buffer can successfully grow to the
+        // returned size, or even close to that size without running out of
+        // resources.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+bool operator==(const ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                const ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'ring_buffer' objects have the same
+    // value if they have the same number of elements, and each element in the
+    // sequence of elements of one object is equal to the element at the same
+    // index in the other.  Note that the capacities of 'lhs' and 'rhs' are
+    // not compared.  This method requires that the (template parameter) type
+    // 'VALUE_TYPE' be "equality-comparable".
+
+template <class VALUE_TYPE, class ALLOCATOR>
+bool operator!=(const ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                const ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  This method requires that the
+    // (template parameter) type 'VALUE_TYPE' be "equality-comparable".
+
+template <class VALUE_TYPE, class ALLOCATOR>
+bool operator<(const ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+               const ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ring buffer is
+    // lexicographically less than that of the specified 'rhs' ring buffer,
+    // and 'false' otherwise.  This method requires that 'operator<', inducing
+    // a total order, be defined for 'VALUE_TYPE'.
+
+template <class VALUE_TYPE, class ALLOCATOR>
+bool operator>(const ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+               const ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ring buffer is
+    // lexicographically greater than that of the specified 'rhs' ring buffer,
+    // and 'false' otherwise.  This method requires that 'operator<', inducing
+    // a total order, be defined for 'VALUE_TYPE'.
+
+template <class VALUE_TYPE, class ALLOCATOR>
+bool operator<=(const ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                const ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ring buffer is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // ring buffer, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'VALUE_TYPE'.
+
+template <class VALUE_TYPE, class ALLOCATOR>
+bool operator>=(const ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                const ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ring buffer is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // ring buffer, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'VALUE_TYPE'.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, class ALLOCATOR>
+void swap(ring_buffer<VALUE_TYPE, ALLOCATOR>& a,
+          ring_buffer<VALUE_TYPE, ALLOCATOR>& b);
+    // Exchange the value and capacity of the specified 'a' object with those
+    // of the specified 'b' object.  This method provides the no-throw
+    // exception-safety guarantee if 'a' and 'b' use the same allocator.
+
+                  // ========================================
+                  // TEMPLATE AND INLINE FUNCTION DEFINITIONS
+                  // ========================================
+
+                       // ----------------------------
+                       // class RingBuffer_IteratorImp
+                       // ----------------------------
+
+// CREATORS
+template <class VALUE_TYPE>
+inline
+RingBuffer_IteratorImp<VALUE_TYPE>::RingBuffer_IteratorImp()
+: d_slots_p(0)
+, d_mask(0)
+, d_position(0)
+{
+}
+
+template <class VALUE_TYPE>
+inline
+RingBuffer_IteratorImp<VALUE_TYPE>::RingBuffer_IteratorImp(
+                                                     VALUE_TYPE  *slots,
+                                                     std::size_t  mask,
+                                                     std::size_t  position)
+: d_slots_p(slots)
+, d_mask(mask)
+, d_position(position)
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE>
+inline
+void RingBuffer_IteratorImp<VALUE_TYPE>::operator++()
+{
+    ++d_position;
+}
+
+template <class VALUE_TYPE>
+inline
+void RingBuffer_IteratorImp<VALUE_TYPE>::operator--()
+{
+    --d_position;
+}
+
+template <class VALUE_TYPE>
+inline
+void RingBuffer_IteratorImp<VALUE_TYPE>::operator+=(std::ptrdiff_t offset)
+{
+    d_position += offset;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE& RingBuffer_IteratorImp<VALUE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_slots_p);
+
+    return d_slots_p[d_position & d_mask];
+}
+
+template <class VALUE_TYPE>
+inline
+std::size_t RingBuffer_IteratorImp<VALUE_TYPE>::position() const
+{
+    return d_position;
+}
+
+// FREE OPERATORS
+template <class VALUE_TYPE>
+inline
+bool operator==(const RingBuffer_IteratorImp<VALUE_TYPE>& lhs,
+                const RingBuffer_IteratorImp<VALUE_TYPE>& rhs)
+{
+    return lhs.position() == rhs.position();
+}
+
+template <class VALUE_TYPE>
+inline
+bool operator<(const RingBuffer_IteratorImp<VALUE_TYPE>& lhs,
+               const RingBuffer_IteratorImp<VALUE_TYPE>& rhs)
+{
+    return lhs.position() < rhs.position();
+}
+
+template <class VALUE_TYPE>
+inline
+std::ptrdiff_t operator-(const RingBuffer_IteratorImp<VALUE_TYPE>& lhs,
+                         const RingBuffer_IteratorImp<VALUE_TYPE>& rhs)
+{
+    return static_cast<std::ptrdiff_t>(lhs.position() - rhs.position());
+}
+
+                         // ------------------------
+                         // class ring_buffer::Guard
+                         // ------------------------
+
+// CREATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+ring_buffer<VALUE_TYPE, ALLOCATOR>::Guard::Guard(VALUE_TYPE    *slots,
+                                                 std::size_t    numSlots,
+                                                 ContainerBase *container)
+: d_slots_p(slots)
+, d_numSlots(numSlots)
+, d_container_p(container)
+{
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+ring_buffer<VALUE_TYPE, ALLOCATOR>::Guard::~Guard()
+{
+    if (d_slots_p) {
+        d_container_p->deallocateN(d_slots_p, d_numSlots);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::Guard::release()
+{
+    d_slots_p = 0;
+}
+
+                            // -----------------
+                            // class ring_buffer
+                            // -----------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::privateInstall(VALUE_TYPE *slots,
+                                                        size_type   numSlots)
+{
+    if (d_slots_p) {
+        this->deallocateN(d_slots_p, d_numSlots);
+    }
+    d_slots_p  = slots;
+    d_numSlots = numSlots;
+    d_start    = 0;
+    if (!d_isFixedCapacity) {
+        d_capacity = numSlots;
+    }
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::privateRelocate(VALUE_TYPE *slots)
+{
+    if (0 == d_length) {
+        return;                                                       // RETURN
+    }
+
+    // The elements occupy the slots from 'd_start' to the end of the array,
+    // followed, if they wrap around, by the slots from the beginning of the
+    // array.
+
+    VALUE_TYPE      *first    = d_slots_p + d_start;
+    const size_type  numFirst = d_length < d_numSlots - d_start
+                              ? d_length
+                              : d_numSlots - d_start;
+    const size_type  numWrapped = d_length - numFirst;
+
+    if (BloombergLP::bslmf::IsBitwiseMoveable<VALUE_TYPE>::value) {
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       slots,
+                                                       first,
+                                                       first + numFirst,
+                                                       this->bslmaAllocator());
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       slots + numFirst,
+                                                       d_slots_p,
+                                                       d_slots_p + numWrapped,
+                                                       this->bslmaAllocator());
+    }
+    else {
+        // Copy both segments before destroying either, so that an exception
+        // leaves the elements of this ring buffer in place.
+
+        privateCopy(slots);
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                            first,
+                                                            first + numFirst);
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                       d_slots_p,
+                                                       d_slots_p + numWrapped);
+    }
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::privateSwap(ring_buffer& other)
+{
+    std::swap(d_slots_p,         other.d_slots_p);
+    std::swap(d_numSlots,        other.d_numSlots);
+    std::swap(d_start,           other.d_start);
+    std::swap(d_length,          other.d_length);
+    std::swap(d_capacity,        other.d_capacity);
+    std::swap(d_isFixedCapacity, other.d_isFixedCapacity);
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, class ALLOCATOR>
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::size_type
+ring_buffer<VALUE_TYPE, ALLOCATOR>::privateGrowthNumSlots() const
+{
+    if (d_isFixedCapacity) {
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                         "ring_buffer<...>: ring buffer full");
+    }
+    if (d_numSlots > max_size() / 2) {
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                     "ring_buffer<...>: ring buffer too long");
+    }
+    return d_numSlots ? 2 * d_numSlots : 1;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::privateCopy(VALUE_TYPE *slots) const
+{
+    if (0 == d_length) {
+        return;                                                       // RETURN
+    }
+
+    const VALUE_TYPE *first    = d_slots_p + d_start;
+    const size_type   numFirst = d_length < d_numSlots - d_start
+                               ? d_length
+                               : d_numSlots - d_start;
+
+    BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
+                                                       slots,
+                                                       first,
+                                                       first + numFirst,
+                                                       this->bslmaAllocator());
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE> guard(
+                                                            slots,
+                                                            slots + numFirst);
+    const VALUE_TYPE *wrapped = d_slots_p;
+    BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
+                                               slots + numFirst,
+                                               wrapped,
+                                               wrapped + d_length - numFirst,
+                                               this->bslmaAllocator());
+    guard.release();
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+VALUE_TYPE *
+ring_buffer<VALUE_TYPE, ALLOCATOR>::privateSlot(size_type index) const
+{
+    return d_slots_p + ((d_start + index) & (d_numSlots - 1));
+}
+
+// CREATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+ring_buffer<VALUE_TYPE, ALLOCATOR>::ring_buffer(const ALLOCATOR& allocator)
+: ContainerBase(allocator)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_start(0)
+, d_length(0)
+, d_capacity(0)
+, d_isFixedCapacity(false)
+{
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+ring_buffer<VALUE_TYPE, ALLOCATOR>::ring_buffer(size_type        fixedCapacity,
+                                                const ALLOCATOR& allocator)
+: ContainerBase(allocator)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_start(0)
+, d_length(0)
+, d_capacity(fixedCapacity)
+, d_isFixedCapacity(true)
+{
+    if (fixedCapacity > RingBuffer_Util::maxNumSlots(
+                                           this->allocator().max_size())) {
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                   "ring_buffer<...>::ring_buffer(n,a): ring buffer too long");
+    }
+    d_numSlots = RingBuffer_Util::computeNumSlots(fixedCapacity);
+    if (d_numSlots) {
+        d_slots_p = this->allocateN((VALUE_TYPE *)0, d_numSlots);
+    }
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+ring_buffer<VALUE_TYPE, ALLOCATOR>::ring_buffer(const ring_buffer& original)
+: ContainerBase(bsl::allocator_traits<ALLOCATOR>::
+                   select_on_container_copy_construction(original.allocator()))
+, d_slots_p(0)
+, d_numSlots(0)
+, d_start(0)
+, d_length(0)
+, d_capacity(0)
+, d_isFixedCapacity(original.d_isFixedCapacity)
+{
+    d_numSlots = RingBuffer_Util::computeNumSlots(d_isFixedCapacity
+                                                  ? original.d_capacity
+                                                  : original.d_length);
+    d_capacity = d_isFixedCapacity ? original.d_capacity : d_numSlots;
+    if (d_numSlots) {
+        d_slots_p = this->allocateN((VALUE_TYPE *)0, d_numSlots);
+
+        Guard guard(d_slots_p, d_numSlots, this);
+        original.privateCopy(d_slots_p);
+        guard.release();
+    }
+    d_length = original.d_length;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+ring_buffer<VALUE_TYPE, ALLOCATOR>::ring_buffer(const ring_buffer& original,
+                                                const ALLOCATOR&   allocator)
+: ContainerBase(allocator)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_start(0)
+, d_length(0)
+, d_capacity(0)
+, d_isFixedCapacity(original.d_isFixedCapacity)
+{
+    d_numSlots = RingBuffer_Util::computeNumSlots(d_isFixedCapacity
+                                                  ? original.d_capacity
+                                                  : original.d_length);
+    d_capacity = d_isFixedCapacity ? original.d_capacity : d_numSlots;
+    if (d_numSlots) {
+        d_slots_p = this->allocateN((VALUE_TYPE *)0, d_numSlots);
+
+        Guard guard(d_slots_p, d_numSlots, this);
+        original.privateCopy(d_slots_p);
+        guard.release();
+    }
+    d_length = original.d_length;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+ring_buffer<VALUE_TYPE, ALLOCATOR>::~ring_buffer()
+{
+    clear();
+    if (d_slots_p) {
+        this->deallocateN(d_slots_p, d_numSlots);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+ring_buffer<VALUE_TYPE, ALLOCATOR>&
+ring_buffer<VALUE_TYPE, ALLOCATOR>::operator=(const ring_buffer& rhs)
+{
+    if (this != &rhs) {
+        ring_buffer copy(rhs, this->allocator());
+        privateSwap(copy);
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::push_back(const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_length < d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
+                                                       privateSlot(d_length),
+                                                       value,
+                                                       this->bslmaAllocator());
+        ++d_length;
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // Construct the new element in the new array of slots before relocating
+    // the existing elements, in case 'value' refers to one of them.
+
+    const size_type  numSlots = privateGrowthNumSlots();
+    VALUE_TYPE      *slots    = this->allocateN((VALUE_TYPE *)0, numSlots);
+    Guard            guard(slots, numSlots, this);
+
+    BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
+                                                       slots + d_length,
+                                                       value,
+                                                       this->bslmaAllocator());
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE> valueGuard(
+                                                         slots + d_length,
+                                                         slots + d_length + 1);
+    privateRelocate(slots);
+    valueGuard.release();
+    guard.release();
+
+    privateInstall(slots, numSlots);
+    ++d_length;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::push_front(const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_length < d_capacity)) {
+        const size_type start = (d_start - 1) & (d_numSlots - 1);
+
+        BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
+                                                       d_slots_p + start,
+                                                       value,
+                                                       this->bslmaAllocator());
+        d_start = start;
+        ++d_length;
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // Construct the new element in the last slot of the new array of slots,
+    // and relocate the existing elements to its beginning, so that the new
+    // element precedes them.
+
+    const size_type  numSlots = privateGrowthNumSlots();
+    VALUE_TYPE      *slots    = this->allocateN((VALUE_TYPE *)0, numSlots);
+    Guard            guard(slots, numSlots, this);
+
+    BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
+                                                       slots + numSlots - 1,
+                                                       value,
+                                                       this->bslmaAllocator());
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE> valueGuard(
+                                                         slots + numSlots - 1,
+                                                         slots + numSlots);
+    privateRelocate(slots);
+    valueGuard.release();
+    guard.release();
+
+    privateInstall(slots, numSlots);
+    d_start = numSlots - 1;
+    ++d_length;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_length;
+    BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(
+                                                        privateSlot(d_length));
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::pop_front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(
+                                                        d_slots_p + d_start);
+    d_start = (d_start + 1) & (d_numSlots - 1);
+    --d_length;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::reserve(size_type numElements)
+{
+    if (numElements <= d_capacity) {
+        return;                                                       // RETURN
+    }
+    if (numElements > max_size()) {
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                         "ring_buffer<...>::reserve(n): ring buffer too long");
+    }
+
+    const size_type  numSlots = RingBuffer_Util::computeNumSlots(numElements);
+    VALUE_TYPE      *slots    = this->allocateN((VALUE_TYPE *)0, numSlots);
+    Guard            guard(slots, numSlots, this);
+
+    privateRelocate(slots);
+    guard.release();
+
+    privateInstall(slots, numSlots);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::clear()
+{
+    while (d_length) {
+        pop_back();
+    }
+    d_start = 0;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void ring_buffer<VALUE_TYPE, ALLOCATOR>::swap(ring_buffer& other)
+{
+    if (this->allocator() == other.allocator()) {
+        privateSwap(other);
+    }
+    else {
+        ring_buffer toOtherCopy(*this, other.allocator());
+        ring_buffer toThisCopy(other, this->allocator());
+
+        toOtherCopy.privateSwap(other);
+        toThisCopy.privateSwap(*this);
+    }
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::operator[](size_type index)
+{
+    BSLS_ASSERT_SAFE(index < d_length);
+
+    return *privateSlot(index);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::at(size_type index)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(index >= d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                  "ring_buffer<...>::at(n): invalid position");
+    }
+    return *privateSlot(index);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_slots_p[d_start];
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *privateSlot(d_length - 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::begin()
+{
+    return IteratorImp(d_slots_p, d_numSlots - 1, d_start);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::end()
+{
+    return IteratorImp(d_slots_p, d_numSlots - 1, d_start + d_length);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::reverse_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::reverse_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::allocator_type
+ring_buffer<VALUE_TYPE, ALLOCATOR>::get_allocator() const
+{
+    return this->allocator();
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::operator[](size_type index) const
+{
+    BSLS_ASSERT_SAFE(index < d_length);
+
+    return *privateSlot(index);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::at(size_type index) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(index >= d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                  "ring_buffer<...>::at(n): invalid position");
+    }
+    return *privateSlot(index);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_slots_p[d_start];
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reference
+ring_buffer<VALUE_TYPE, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *privateSlot(d_length - 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::begin() const
+{
+    return IteratorImp(d_slots_p, d_numSlots - 1, d_start);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::end() const
+{
+    return IteratorImp(d_slots_p, d_numSlots - 1, d_start + d_length);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reverse_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reverse_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reverse_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::const_reverse_iterator
+ring_buffer<VALUE_TYPE, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool ring_buffer<VALUE_TYPE, ALLOCATOR>::empty() const
+{
+    return 0 == d_length;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool ring_buffer<VALUE_TYPE, ALLOCATOR>::full() const
+{
+    return d_length == d_capacity;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::size_type
+ring_buffer<VALUE_TYPE, ALLOCATOR>::size() const
+{
+    return d_length;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::size_type
+ring_buffer<VALUE_TYPE, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool ring_buffer<VALUE_TYPE, ALLOCATOR>::is_fixed_capacity() const
+{
+    return d_isFixedCapacity;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename ring_buffer<VALUE_TYPE, ALLOCATOR>::size_type
+ring_buffer<VALUE_TYPE, ALLOCATOR>::max_size() const
+{
+    return d_isFixedCapacity
+           ? d_capacity
+           : RingBuffer_Util::maxNumSlots(this->allocator().max_size());
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                     const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                     const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                    const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs)
+{
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(),
+                                        rhs.cbegin(), rhs.cend());
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                    const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                     const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& lhs,
+                     const bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void bsl::swap(bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& a,
+               bsl::ring_buffer<VALUE_TYPE, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+                                // ===========
+                                // TYPE TRAITS
+                                // ===========
+
+// Type traits for ring buffers:
+//: o A ring buffer defines STL iterators.
+//: o A ring buffer is bitwise moveable if the allocator is bitwise moveable.
+//: o A ring buffer uses 'bslma' allocators if the parameterized 'ALLOCATOR' is
+//:     convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <typename VALUE_TYPE, typename ALLOCATOR>
+struct HasStlIterators<bsl::ring_buffer<VALUE_TYPE, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslmf {
+
+template <typename VALUE_TYPE, typename ALLOCATOR>
+struct IsBitwiseMoveable<bsl::ring_buffer<VALUE_TYPE, ALLOCATOR> >
+    : IsBitwiseMoveable<ALLOCATOR>
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <typename VALUE_TYPE, typename ALLOCATOR>
+struct UsesBslmaAllocator<bsl::ring_buffer<VALUE_TYPE, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1488 @@
+// bslstl_ringbuffer.t.cpp                                            -*-C++-*-
+#include <bslstl_ringbuffer.h>
+
+#include <bslstl_deque.h>
+#include <bslstl_queue.h>
+#include <bslstl_stack.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_newdeleteallocator.h>      // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatorexception.h>  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+
+#include <bsltf_templatetestfacility.h>    // for testing only
+#include <bsltf_testvaluesarray.h>         // for testing only
+
+#include <deque>
+#include <stdexcept>  // 'length_error', 'out_of_range'
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container holding a sequence
+// of values in a circular array of slots.  We verify the state of a
+// 'ring_buffer' after each sequence of operations described in a table,
+// chosen to make the sequence wrap around the end of the array and to grow the
+// array while it does, by comparing the 'ring_buffer' with a 'std::deque'
+// subjected to the same operations, for element types that are and are not
+// bitwise moveable and that do and do not allocate memory.  We verify that the
+// allocator supplied at construction is used for all memory, that an
+// operation that throws leaves the 'ring_buffer' unchanged, and that a
+// 'ring_buffer' having a fixed capacity never allocates after construction.
+// Finally, we verify that a 'ring_buffer' can be used as the underlying
+// container of 'bsl::queue' and 'bsl::stack'.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ring_buffer(const A& allocator = A());
+// [ 3] ring_buffer(size_type fixedCapacity, const A& allocator = A());
+// [ 4] ring_buffer(const ring_buffer& original);
+// [ 4] ring_buffer(const ring_buffer& original, const A& allocator);
+// [ 2] ~ring_buffer();
+//
+// MANIPULATORS
+// [ 4] ring_buffer& operator=(const ring_buffer& rhs);
+// [ 2] void push_back(const VALUE_TYPE& value);
+// [ 2] void push_front(const VALUE_TYPE& value);
+// [ 2] void pop_back();
+// [ 2] void pop_front();
+// [ 3] void reserve(size_type numElements);
+// [ 2] void clear();
+// [ 4] void swap(ring_buffer& other);
+// [ 2] reference operator[](size_type index);
+// [ 2] reference at(size_type index);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_reference operator[](size_type index) const;
+// [ 2] const_reference at(size_type index) const;
+// [ 2] const_reference front() const;
+// [ 2] const_reference back() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] bool empty() const;
+// [ 2] bool full() const;
+// [ 2] size_type size() const;
+// [ 2] size_type capacity() const;
+// [ 3] bool is_fixed_capacity() const;
+// [ 3] size_type max_size() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const ring_buffer& lhs, const ring_buffer& rhs);
+// [ 4] bool operator!=(const ring_buffer& lhs, const ring_buffer& rhs);
+// [ 4] bool operator<(const ring_buffer& lhs, const ring_buffer& rhs);
+// [ 4] bool operator>(const ring_buffer& lhs, const ring_buffer& rhs);
+// [ 4] bool operator<=(const ring_buffer& lhs, const ring_buffer& rhs);
+// [ 4] bool operator>=(const ring_buffer& lhs, const ring_buffer& rhs);
+// [ 4] void swap(ring_buffer& a, ring_buffer& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 2] CONCERN: The type has the expected traits.
+// [ 2] CONCERN: Growing does not invalidate the value pushed.
+// [ 5] CONCERN: 'ring_buffer' is usable in 'bsl::queue' and 'bsl::stack'.
+// [-1] PERFORMANCE: 'bsl::queue' OF 'ring_buffer' VS. OF 'deque'
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::ring_buffer<int> Obj;
+typedef std::deque<int>       Model;
+
+struct DefaultDataRow {
+    int         d_line;  // source line number
+    const char *d_spec;  // operations, in order (see 'gg')
+};
+
+static
+const DefaultDataRow DEFAULT_DATA[] = {
+    //line  spec
+    //----  ------------------------------------------------------------------
+    { L_,   ""                                                               },
+    { L_,   "A"                                                              },
+    { L_,   "a"                                                              },
+    { L_,   "AB"                                                             },
+    { L_,   "ab"                                                             },
+    { L_,   "Ab"                                                             },
+    { L_,   "AB<"                                                            },
+    { L_,   "AB>"                                                            },
+    { L_,   "A<B<C<"                                                         },
+    { L_,   "ABC<<<D"                                                        },
+    { L_,   "ABCD"                                                           },
+    { L_,   "abcd"                                                           },
+    { L_,   "ABCD<<EF"                                                       },
+    { L_,   "ABCD<<EFG"                                                      },
+    { L_,   "ABCD<<EFGHIJ"                                                   },
+    { L_,   "ABCD>>efg"                                                      },
+    { L_,   "ABCD>>efghij"                                                   },
+    { L_,   "aAbBcCdDeE"                                                     },
+    { L_,   "ABCDEFGH<<<<<<IJKLMN"                                           },
+    { L_,   "ABCDEFGH<<<<<<IJKLMNOPQ"                                        },
+    { L_,   "ABCDEFGH>>>>>>ijklmnopq"                                        },
+    { L_,   "ABCDEFGHIJKLMNOPQRSTUVWXYZ"                                     },
+    { L_,   "ABCDEFGHIJKLMNOPQ<<<<<<<<<<<<<<<<<"                             },
+    { L_,   "ABCD<E>F<G>H<I>J<K>L<M>N<O>P<Q>"                                },
+};
+static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class OBJECT>
+class ExceptionGuard {
+    // This scoped guard helps to verify the full guarantee of rollback in
+    // exception-throwing code, by comparing, on destruction, a guarded object
+    // with a copy of its value at the time the guard was created.
+
+    // DATA
+    int           d_line;      // line number of the guarded operation
+    const OBJECT *d_object_p;  // guarded object, or 0 if released
+    OBJECT        d_control;   // copy of the value of the guarded object
+
+  public:
+    // CREATORS
+    ExceptionGuard(const OBJECT     *object,
+                   int               line,
+                   bslma::Allocator *allocator)
+    : d_line(line)
+    , d_object_p(object)
+    , d_control(*object, allocator)
+    {
+    }
+
+    ~ExceptionGuard()
+    {
+        if (d_object_p) {
+            ASSERTV(d_line, d_control == *d_object_p);
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+    {
+        d_object_p = 0;
+    }
+};
+
+template <class TYPE>
+void gg(bsl::ring_buffer<TYPE>              *object,
+        Model                               *model,
+        const bsltf::TestValuesArray<TYPE>&  values,
+        const char                          *spec)
+    // Apply to the specified 'object' and 'model' the operations described by
+    // the specified 'spec', in which each upper-case letter 'X' denotes
+    // 'push_back', and each lower-case letter 'x' denotes 'push_front', of
+    // the element of the specified 'values' at the index 'X - 'A'' (or
+    // 'x - 'a''), each '<' denotes 'pop_front', and each '>' denotes
+    // 'pop_back'.  The 'model' holds the indices, in 'values', of the
+    // elements of 'object'.
+{
+    for (; *spec; ++spec) {
+        const char c = *spec;
+        if ('A' <= c && c <= 'Z') {
+            object->push_back(values[c - 'A']);
+            model->push_back(c - 'A');
+        }
+        else if ('a' <= c && c <= 'z') {
+            object->push_front(values[c - 'a']);
+            model->push_front(c - 'a');
+        }
+        else if ('<' == c) {
+            object->pop_front();
+            model->pop_front();
+        }
+        else {
+            ASSERTV(c, '>' == c);
+            object->pop_back();
+            model->pop_back();
+        }
+    }
+}
+
+template <class TYPE>
+bool isEqual(const bsl::ring_buffer<TYPE>&       object,
+             const Model&                        model,
+             const bsltf::TestValuesArray<TYPE>& values)
+    // Return 'true' if the specified 'object' holds the elements of the
+    // specified 'values' at the indices held by the specified 'model', in
+    // order, as observed through each of its accessors, and 'false'
+    // otherwise.
+{
+    typedef bsl::ring_buffer<TYPE> RingBuffer;
+
+    const int LENGTH = static_cast<int>(model.size());
+
+    if (object.size() != model.size()
+     || object.empty() != (0 == LENGTH)
+     || object.capacity() < object.size()
+     || object.full() != (object.size() == object.capacity())
+     || object.end() - object.begin() != LENGTH
+     || object.cend() - object.cbegin() != LENGTH
+     || object.rend() - object.rbegin() != LENGTH) {
+        return false;                                                 // RETURN
+    }
+    if (0 == LENGTH) {
+        return object.begin() == object.end();                        // RETURN
+    }
+    if (!(values[model.front()] == object.front())
+     || !(values[model.back()] == object.back())) {
+        return false;                                                 // RETURN
+    }
+
+    typename RingBuffer::const_iterator         it  = object.cbegin();
+    typename RingBuffer::const_reverse_iterator rit = object.crbegin();
+    for (int i = 0; i < LENGTH; ++i, ++it, ++rit) {
+        const TYPE& expected        = values[model[i]];
+        const TYPE& reverseExpected = values[model[LENGTH - 1 - i]];
+
+        if (!(expected == object[i])
+         || &object[i] != &object.at(i)
+         || &object[i] != &*it
+         || &object[i] != &object.begin()[i]
+         || &object[i] != &*(object.begin() + i)
+         || !(reverseExpected == *rit)) {
+            return false;                                             // RETURN
+        }
+    }
+    return it == object.cend() && rit == object.crend();
+}
+
+                            // ================
+                            // class TestDriver
+                            // ================
+
+template <class TYPE>
+class TestDriver {
+    // This class template provides a namespace for testing 'ring_buffer' with
+    // elements of the (template parameter) 'TYPE'.
+
+    // PRIVATE TYPES
+    typedef bsl::ring_buffer<TYPE>       Obj;
+    typedef bsltf::TestValuesArray<TYPE> TestValues;
+
+  public:
+    // TEST CASES
+    static void testCase3();
+        // Test the fixed-capacity mode and 'reserve'.
+
+    static void testCase2();
+        // Test the manipulators and accessors of a growable ring buffer.
+};
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase3()
+{
+    const TestValues VALUES;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (verbose) printf("\tTesting fixed capacity.\n");
+
+    for (int capacity = 0; capacity <= 17; ++capacity) {
+        const std::size_t CAPACITY  = capacity;
+        const std::size_t NUM_SLOTS =
+                               bsl::RingBuffer_Util::computeNumSlots(CAPACITY);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj mX(CAPACITY, &oa);  const Obj& X = mX;
+        Model model;
+
+        ASSERTV(capacity, CAPACITY == X.capacity());
+        ASSERTV(capacity, CAPACITY == X.max_size());
+        ASSERTV(capacity, true == X.is_fixed_capacity());
+        ASSERTV(capacity, (0 == CAPACITY) == X.full());
+        ASSERTV(capacity, (0 != CAPACITY ? 1 : 0) == oa.numBlocksInUse());
+        ASSERTV(capacity, CAPACITY <= NUM_SLOTS);
+        ASSERTV(capacity, NUM_SLOTS < 2 * CAPACITY || 0 == CAPACITY);
+
+        mX.reserve(CAPACITY);
+        ASSERTV(capacity, CAPACITY == X.capacity());
+
+        // Fill the ring buffer, then cycle its elements so that they wrap
+        // around the end of its slots, observing that no slot is allocated
+        // after construction.
+
+        const TYPE *SLOTS = 0;
+        for (int i = 0; i < capacity; ++i) {
+            mX.push_back(VALUES[i % 26]);
+            model.push_back(i % 26);
+            if (0 == i) {
+                SLOTS = &X.front();
+            }
+        }
+        ASSERTV(capacity, isEqual(X, model, VALUES));
+        ASSERTV(capacity, true == X.full());
+
+        for (int i = 0; i < 3 * capacity; ++i) {
+            if (i % 2) {
+                mX.pop_front();
+                mX.push_back(VALUES[i % 26]);
+                model.pop_front();
+                model.push_back(i % 26);
+            }
+            else {
+                mX.pop_back();
+                mX.push_front(VALUES[i % 26]);
+                model.pop_back();
+                model.push_front(i % 26);
+            }
+            ASSERTV(capacity, i, isEqual(X, model, VALUES));
+            ASSERTV(capacity, i, true == X.full());
+            for (int j = 0; j < capacity; ++j) {
+                ASSERTV(capacity, i, j, SLOTS <= &X[j]);
+                ASSERTV(capacity, i, j, &X[j] < SLOTS + NUM_SLOTS);
+            }
+        }
+        ASSERTV(capacity, CAPACITY == X.capacity());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        // Adding an element to the full ring buffer throws, and leaves it
+        // unchanged.
+
+        for (int i = 0; i < 3; ++i) {
+            ExceptionGuard<Obj> guard(&X, L_, &sa);
+            bool                caught = false;
+            try {
+                switch (i) {
+                  case 0: mX.push_back(VALUES[0]);  break;
+                  case 1: mX.push_front(VALUES[0]); break;
+                  case 2: mX.reserve(CAPACITY + 1); break;
+                }
+            }
+            catch (std::length_error&) {
+                caught = true;
+            }
+            ASSERTV(capacity, i, caught);
+        }
+#endif
+    }
+    ASSERT(0 == da.numBlocksTotal());
+
+    if (verbose) printf("\tTesting 'reserve' of a growable ring buffer.\n");
+
+    for (int numElements = 0; numElements <= 17; ++numElements) {
+        const std::size_t NUM_ELEMENTS = numElements;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        Model model;
+
+        ASSERTV(numElements, false == X.is_fixed_capacity());
+        ASSERTV(numElements, 0 == X.capacity());
+        ASSERTV(numElements, 0 == oa.numBlocksTotal());
+
+        gg(&mX, &model, VALUES, "AB<C");
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            ExceptionGuard<Obj> guard(&X, L_, &sa);
+
+            mX.reserve(NUM_ELEMENTS);
+            guard.release();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        const std::size_t CAPACITY = X.capacity();
+
+        ASSERTV(numElements, isEqual(X, model, VALUES));
+        ASSERTV(numElements, NUM_ELEMENTS <= CAPACITY);
+        ASSERTV(numElements, CAPACITY ==
+                     bsl::RingBuffer_Util::computeNumSlots(CAPACITY));
+        ASSERTV(numElements, 4 > NUM_ELEMENTS || CAPACITY < 2 * NUM_ELEMENTS);
+
+        // Filling the reserved capacity does not grow the ring buffer.
+
+        const TYPE *FRONT = &X.front();
+        while (!X.full()) {
+            gg(&mX, &model, VALUES, "Z");
+        }
+        ASSERTV(numElements, FRONT == &X.front());
+        ASSERTV(numElements, CAPACITY == X.capacity());
+        ASSERTV(numElements, isEqual(X, model, VALUES));
+    }
+    ASSERT(0 == da.numBlocksTotal());
+
+    if (verbose) printf("\tTesting 'max_size' of a growable ring buffer.\n");
+    {
+        const Obj X;
+
+        const std::size_t MAX_SIZE = X.max_size();
+        ASSERT(0 < MAX_SIZE);
+        ASSERT(MAX_SIZE == bsl::RingBuffer_Util::computeNumSlots(MAX_SIZE));
+        ASSERT(MAX_SIZE <= X.get_allocator().max_size());
+        ASSERT(MAX_SIZE > X.get_allocator().max_size() / 2);
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bool caught = false;
+        try {
+            Obj mY(MAX_SIZE + 1);
+        }
+        catch (std::length_error&) {
+            caught = true;
+        }
+        ASSERT(caught);
+#endif
+    }
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase2()
+{
+    const int              NUM_DATA = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    const TestValues VALUES;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (verbose) printf("\tTesting manipulators and accessors.\n");
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE = DATA[ti].d_line;
+        const char *const SPEC = DATA[ti].d_spec;
+
+        if (veryVerbose) { T_ P_(LINE) P(SPEC) }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Model model;
+
+            ASSERTV(LINE, &oa == X.get_allocator());
+            ASSERTV(LINE, 0 == X.capacity());
+            ASSERTV(LINE, true == X.full());
+            ASSERTV(LINE, isEqual(X, model, VALUES));
+
+            // Apply the operations one by one, verifying the state after each.
+
+            for (const char *op = SPEC; *op; ++op) {
+                const char OP[] = { *op, 0 };
+                gg(&mX, &model, VALUES, OP);
+                ASSERTV(LINE, op - SPEC, isEqual(X, model, VALUES));
+                ASSERTV(LINE, op - SPEC, X.capacity() ==
+                             bsl::RingBuffer_Util::computeNumSlots(
+                                                               X.capacity()));
+            }
+
+            // Modify each element through each manipulator.
+
+            if (!X.empty()) {
+                const int LENGTH = static_cast<int>(X.size());
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX[i] = VALUES[26 + i % 26];
+                    model[i] = 26 + i % 26;
+                }
+                ASSERTV(LINE, isEqual(X, model, VALUES));
+
+                mX.front() = VALUES[30];
+                model.front() = 30;
+                mX.back() = VALUES[31];
+                model.back() = 31;
+                ASSERTV(LINE, isEqual(X, model, VALUES));
+
+                *mX.begin() = VALUES[32];
+                model.front() = 32;
+                *mX.rbegin() = VALUES[33];
+                model.back() = 33;
+                mX.at(LENGTH / 2) = VALUES[34];
+                model[LENGTH / 2] = 34;
+                ASSERTV(LINE, isEqual(X, model, VALUES));
+                ASSERTV(LINE, mX.end() - mX.begin() == LENGTH);
+                ASSERTV(LINE, mX.rend() - mX.rbegin() == LENGTH);
+            }
+
+#ifdef BDE_BUILD_TARGET_EXC
+            for (int i = 0; i < 2; ++i) {
+                bool caught = false;
+                try {
+                    if (i) {
+                        mX.at(X.size());
+                    }
+                    else {
+                        X.at(X.size());
+                    }
+                }
+                catch (std::out_of_range&) {
+                    caught = true;
+                }
+                ASSERTV(LINE, i, caught);
+            }
+#endif
+
+            const std::size_t CAPACITY = X.capacity();
+
+            mX.clear();
+            model.clear();
+            ASSERTV(LINE, isEqual(X, model, VALUES));
+            ASSERTV(LINE, CAPACITY == X.capacity());
+        }
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+    }
+
+    if (verbose) printf("\tTesting exception safety and aliasing.\n");
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE = DATA[ti].d_line;
+        const char *const SPEC = DATA[ti].d_spec;
+
+        for (int op = 0; op < 4; ++op) {
+            // Push, onto the ring buffer created from 'SPEC', a new value
+            // ('op' is 0 or 1) or its own first or last element ('op' is 2 or
+            // 3), at its end ('op' is even) or beginning ('op' is odd).
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(&oa);  const Obj& X = mX;
+                Model model;
+
+                {
+                    const bsls::Types::Int64 AL = oa.allocationLimit();
+                    oa.setAllocationLimit(-1);
+                    gg(&mX, &model, VALUES, SPEC);
+                    oa.setAllocationLimit(AL);
+                }
+                if (op < 2 || !X.empty()) {
+                    const int   INDEX = op < 2     ? 35
+                                      : 2 == op    ? model.front()
+                                      :              model.back();
+                    const TYPE& VALUE = op < 2     ? VALUES[INDEX]
+                                      : 2 == op    ? X.front()
+                                      :              X.back();
+
+                    ExceptionGuard<Obj> guard(&X, L_, &sa);
+
+                    if (op % 2) {
+                        mX.push_front(VALUE);
+                        model.push_front(INDEX);
+                    }
+                    else {
+                        mX.push_back(VALUE);
+                        model.push_back(INDEX);
+                    }
+                    guard.release();
+
+                    ASSERTV(LINE, op, isEqual(X, model, VALUES));
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, op, 0 == oa.numBlocksInUse());
+        }
+    }
+    ASSERT(0 == da.numBlocksTotal());
+
+    if (verbose) printf("\tTesting growth while full.\n");
+    {
+        // Growth relocates the elements, in order, whether or not they wrap
+        // around the end of the slots, and whether pushed at either end.
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int capacity = 1; capacity <= 16; capacity *= 2) {
+            for (int start = 0; start < capacity; ++start) {
+                for (int atFront = 0; atFront < 2; ++atFront) {
+                    Obj mX(&oa);  const Obj& X = mX;
+                    Model model;
+
+                    mX.reserve(capacity);
+                    for (int i = 0; i < start; ++i) {
+                        gg(&mX, &model, VALUES, "A<");
+                    }
+                    while (!X.full()) {
+                        mX.push_back(VALUES[model.size()]);
+                        model.push_back(static_cast<int>(model.size()));
+                    }
+                    ASSERTV(capacity, start, isEqual(X, model, VALUES));
+
+                    gg(&mX, &model, VALUES, atFront ? "z" : "Z");
+
+                    ASSERTV(capacity, start,
+                            2 * capacity == static_cast<int>(X.capacity()));
+                    ASSERTV(capacity, start, isEqual(X, model, VALUES));
+                }
+            }
+        }
+    }
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: A Bounded Send Queue
+///- - - - - - - - - - - - - - - -
+// Suppose that each session of a server queues the identifiers of the
+// messages it has yet to send, and that, to bound the memory used by a slow
+// client, a session refuses to queue more than a fixed number of messages.
+//
+// First, we define the type of the send queue, a 'bsl::queue' using a
+// 'ring_buffer' as its underlying container:
+//..
+    typedef bsl::queue<int, bsl::ring_buffer<int> > SendQueue;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a send queue from an empty 'ring_buffer' having a fixed
+// capacity of 3 messages, which allocates its slots immediately:
+//..
+    bslma::TestAllocator allocator;
+    SendQueue            sendQueue(bsl::ring_buffer<int>(3, &allocator),
+                                   &allocator);
+    ASSERT(0 < allocator.numBlocksInUse());
+
+    const bsls::Types::Int64 numAllocations = allocator.numAllocations();
+//..
+// Next, we queue messages, which allocates no memory, until the queue holds
+// as many messages as the session allows:
+//..
+    sendQueue.push(101);
+    sendQueue.push(102);
+    sendQueue.push(103);
+    ASSERT(3 == sendQueue.size());
+    ASSERT(numAllocations == allocator.numAllocations());
+//..
+// Note that an attempt to 'push' a fourth message would throw a
+// 'bsl::length_error' exception, leaving the queue unchanged, so that a
+// session would rather compare the size of its queue to the capacity with
+// which it created the 'ring_buffer' before queuing a message.
+//
+// Finally, we send the messages in the order in which they were queued, and
+// queue another:
+//..
+    ASSERT(101 == sendQueue.front());  sendQueue.pop();
+    ASSERT(102 == sendQueue.front());  sendQueue.pop();
+    sendQueue.push(104);
+    ASSERT(103 == sendQueue.front());  sendQueue.pop();
+    ASSERT(104 == sendQueue.front());  sendQueue.pop();
+    ASSERT(true == sendQueue.empty());
+    ASSERT(numAllocations == allocator.numAllocations());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING USE IN 'queue' AND 'stack'
+        //
+        // Concerns:
+        //: 1 A 'ring_buffer' provides each member required of the underlying
+        //:   container of a 'bsl::queue' and of a 'bsl::stack'.
+        //:
+        //: 2 The adaptors supply their allocator to the 'ring_buffer', and
+        //:   copies of the adaptors copy its value and capacity.
+        //:
+        //: 3 An adaptor created from a fixed-capacity 'ring_buffer' does not
+        //:   allocate memory after its creation.
+        //
+        // Plan:
+        //: 1 Push and pop values through a 'queue' and a 'stack' of
+        //:   'ring_buffer', and through the same adaptors of 'deque', and
+        //:   compare their observable states.  (C-1)
+        //:
+        //: 2 Create the adaptors with a test allocator, copy them, and verify
+        //:   the use of memory.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: 'ring_buffer' is usable in 'bsl::queue' and 'bsl::stack'.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING USE IN 'queue' AND 'stack'"
+                            "\n==================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        typedef bsl::queue<int, Obj>   Queue;
+        typedef bsl::queue<int, Model> ModelQueue;
+        typedef bsl::stack<int, Obj>   Stack;
+        typedef bsl::stack<int, Model> ModelStack;
+
+        if (verbose) printf("\tTesting 'queue'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Queue      mX(&oa);  const Queue& X = mX;
+            ModelQueue model;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.push(i);
+                model.push(i);
+                if (i % 3 == 2) {
+                    mX.pop();
+                    model.pop();
+                }
+                ASSERTV(i, model.size()  == X.size());
+                ASSERTV(i, model.empty() == X.empty());
+                ASSERTV(i, model.front() == X.front());
+                ASSERTV(i, model.back()  == X.back());
+            }
+            ASSERT(0 < oa.numBlocksInUse());
+
+            Queue mY(X, &oa);  const Queue& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(!(X < Y));
+
+            mY.pop();
+            ASSERT(X != Y);
+            ASSERT(X <  Y);
+
+            while (!X.empty()) {
+                ASSERT(model.front() == X.front());
+                mX.pop();
+                model.pop();
+            }
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tTesting 'queue' of fixed capacity.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Queue mX(Obj(5, &oa), &oa);  const Queue& X = mX;
+
+            const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.push(i);
+                if (5 == X.size()) {
+                    ASSERTV(i, i - 4 == X.front());
+                    mX.pop();
+                }
+            }
+            ASSERT(NUM_TOTAL == oa.numBlocksTotal());
+
+            Queue mY(X, &oa);  const Queue& Y = mY;
+            ASSERT(X == Y);
+            mY.push(-1);
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mY.push(-2);
+            }
+            catch (std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(5 == Y.size());
+#endif
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tTesting 'stack'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Stack      mX(&oa);  const Stack& X = mX;
+            ModelStack model;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.push(i);
+                model.push(i);
+                if (i % 3 == 2) {
+                    mX.pop();
+                    model.pop();
+                }
+                ASSERTV(i, model.size()  == X.size());
+                ASSERTV(i, model.empty() == X.empty());
+                ASSERTV(i, model.top()   == X.top());
+            }
+            ASSERT(0 < oa.numBlocksInUse());
+
+            Stack mY(X, &oa);  const Stack& Y = mY;
+            ASSERT(X == Y);
+
+            while (!X.empty()) {
+                ASSERT(model.top() == X.top());
+                mX.pop();
+                model.pop();
+            }
+            ASSERT(X < Y);
+        }
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, uses the allocator
+        //:   supplied, or the default allocator if none is, and has the same
+        //:   capacity, fixed if that of the original is.
+        //:
+        //: 2 Assignment gives the target the value and capacity of the
+        //:   source, which is unchanged.
+        //:
+        //: 3 Two ring buffers compare equal if and only if they hold the same
+        //:   elements, whatever their capacities, and are ordered
+        //:   lexicographically otherwise.
+        //:
+        //: 4 The member and free 'swap' functions exchange the values and
+        //:   capacities of two ring buffers, without allocating if they use
+        //:   the same allocator.
+        //:
+        //: 5 No memory is leaked if an exception is thrown while copying.
+        //
+        // Plan:
+        //: 1 For each row of the table, copy a growable and a fixed-capacity
+        //:   ring buffer created from the row, with and without an allocator,
+        //:   in the presence of injected exceptions.  (C-1, 5)
+        //:
+        //: 2 For each pair of rows of the table, create a ring buffer from
+        //:   each row, and compare them with each operator, checking the
+        //:   result against that of the model.  (C-3)
+        //:
+        //: 3 Assign and swap the ring buffers, and verify their values,
+        //:   capacities, and the use of memory.  (C-2, 4)
+        //
+        // Testing:
+        //   ring_buffer(const ring_buffer& original);
+        //   ring_buffer(const ring_buffer& original, const A& allocator);
+        //   ring_buffer& operator=(const ring_buffer& rhs);
+        //   void swap(ring_buffer& other);
+        //   bool operator==(const ring_buffer& lhs, const ring_buffer& rhs);
+        //   bool operator!=(const ring_buffer& lhs, const ring_buffer& rhs);
+        //   bool operator<(const ring_buffer& lhs, const ring_buffer& rhs);
+        //   bool operator>(const ring_buffer& lhs, const ring_buffer& rhs);
+        //   bool operator<=(const ring_buffer& lhs, const ring_buffer& rhs);
+        //   bool operator>=(const ring_buffer& lhs, const ring_buffer& rhs);
+        //   void swap(ring_buffer& a, ring_buffer& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING VALUE-SEMANTIC OPERATIONS"
+                            "\n=================================\n");
+
+        const int              NUM_DATA = DEFAULT_NUM_DATA;
+        const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+        const bsltf::TestValuesArray<int> VALUES;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\nTesting copy constructors.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+
+            for (int fixed = 0; fixed < 2; ++fixed) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+
+                Obj   mY(&sa);  const Obj& Y = mY;
+                Model model;
+                if (fixed) {
+                    Obj(strlen(SPEC) + 2, &sa).swap(mY);
+                }
+                gg(&mY, &model, VALUES, SPEC);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const Obj X(Y, &oa);
+                    ASSERTV(LINE, fixed, Y == X);
+                    ASSERTV(LINE, fixed, isEqual(X, model, VALUES));
+                    ASSERTV(LINE, fixed, &oa == X.get_allocator());
+                    ASSERTV(LINE, fixed, Y.is_fixed_capacity() ==
+                                                        X.is_fixed_capacity());
+                    ASSERTV(LINE, fixed, !fixed ||
+                                                Y.capacity() == X.capacity());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(LINE, fixed, 0 == oa.numBlocksInUse());
+
+                {
+                    const Obj X(Y);
+                    ASSERTV(LINE, fixed, Y == X);
+                    ASSERTV(LINE, fixed, isEqual(X, model, VALUES));
+                    ASSERTV(LINE, fixed, &da == X.get_allocator());
+                    ASSERTV(LINE, fixed, Y.is_fixed_capacity() ==
+                                                        X.is_fixed_capacity());
+                    ASSERTV(LINE, fixed, !fixed ||
+                                                Y.capacity() == X.capacity());
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting comparison, assignment, and swap.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE1 = DATA[ti].d_line;
+            const char *const SPEC1 = DATA[ti].d_spec;
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2 = DATA[tj].d_line;
+                const char *const SPEC2 = DATA[tj].d_spec;
+
+                if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj   mX(&oa);  const Obj& X = mX;
+                Model model1;
+                gg(&mX, &model1, VALUES, SPEC1);
+
+                Obj   mY(strlen(SPEC2), &oa);  const Obj& Y = mY;
+                Model model2;
+                gg(&mY, &model2, VALUES, SPEC2);
+
+                ASSERTV(LINE1, LINE2, (model1 == model2) == (X == Y));
+                ASSERTV(LINE1, LINE2, (model1 != model2) == (X != Y));
+                ASSERTV(LINE1, LINE2, (model1 <  model2) == (X <  Y));
+                ASSERTV(LINE1, LINE2, (model1 >  model2) == (X >  Y));
+                ASSERTV(LINE1, LINE2, (model1 <= model2) == (X <= Y));
+                ASSERTV(LINE1, LINE2, (model1 >= model2) == (X >= Y));
+
+                const std::size_t XC = X.capacity();
+                const std::size_t YC = Y.capacity();
+
+                const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+                mX.swap(mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2, VALUES));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model1, VALUES));
+                ASSERTV(LINE1, LINE2, YC == X.capacity());
+                ASSERTV(LINE1, LINE2, XC == Y.capacity());
+                ASSERTV(LINE1, LINE2, true  == X.is_fixed_capacity());
+                ASSERTV(LINE1, LINE2, false == Y.is_fixed_capacity());
+
+                swap(mX, mY);
+                ASSERTV(LINE1, LINE2, isEqual(X, model1, VALUES));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2, VALUES));
+                ASSERTV(LINE1, LINE2, XC == X.capacity());
+                ASSERTV(LINE1, LINE2, YC == Y.capacity());
+                ASSERTV(LINE1, LINE2, NUM_TOTAL == oa.numBlocksTotal());
+
+                Obj *mR = &(mX = Y);
+                ASSERTV(LINE1, LINE2, &X == mR);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2, VALUES));
+                ASSERTV(LINE1, LINE2, isEqual(Y, model2, VALUES));
+                ASSERTV(LINE1, LINE2, YC == X.capacity());
+                ASSERTV(LINE1, LINE2, true == X.is_fixed_capacity());
+                ASSERTV(LINE1, LINE2, &oa == X.get_allocator());
+
+                mR = &(mX = X);
+                ASSERTV(LINE1, LINE2, &X == mR);
+                ASSERTV(LINE1, LINE2, isEqual(X, model2, VALUES));
+            }
+        }
+
+        if (verbose) printf("\nTesting swap with different allocators.\n");
+        {
+            bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+            bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+            Obj   mX(&oa1);  const Obj& X = mX;
+            Model model1;
+            gg(&mX, &model1, VALUES, "ABC<DE");
+
+            Obj   mY(3, &oa2);  const Obj& Y = mY;
+            Model model2;
+            gg(&mY, &model2, VALUES, "FGH<I");
+
+            mX.swap(mY);
+            ASSERT(isEqual(X, model2, VALUES));
+            ASSERT(isEqual(Y, model1, VALUES));
+            ASSERT(true  == X.is_fixed_capacity());
+            ASSERT(false == Y.is_fixed_capacity());
+            ASSERT(3 == X.capacity());
+            ASSERT(&oa1 == X.get_allocator());
+            ASSERT(&oa2 == Y.get_allocator());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING FIXED CAPACITY AND 'reserve'
+        //
+        // Concerns:
+        //: 1 A ring buffer created with a fixed capacity allocates the slots
+        //:   for that many elements (rounded up to a power of two) on
+        //:   construction, and never allocates slots afterward, however many
+        //:   times its elements wrap around the end of its slots.
+        //:
+        //: 2 Adding an element to a full fixed-capacity ring buffer, or
+        //:   reserving more than its capacity, throws 'bsl::length_error' and
+        //:   leaves the ring buffer unchanged.
+        //:
+        //: 3 'reserve' grows a growable ring buffer to the least power of two
+        //:   not less than the requested capacity, preserving its value, and
+        //:   leaves it unchanged if an allocation fails.
+        //:
+        //: 4 The 'max_size' of a growable ring buffer is the greatest power of
+        //:   two not exceeding the 'max_size' of its allocator, and a fixed
+        //:   capacity exceeding it is rejected.
+        //
+        // Plan:
+        //: 1 For each fixed capacity from 0 to 17, fill a ring buffer, cycle
+        //:   its elements through both ends, and verify its state and that of
+        //:   its slots after each operation.  (C-1)
+        //:
+        //: 2 Attempt to add an element to, and reserve capacity in, the full
+        //:   ring buffer, and verify that it throws and is unchanged.  (C-2)
+        //:
+        //: 3 Reserve each capacity from 0 to 17 in a growable ring buffer
+        //:   holding wrapped elements, in the presence of injected exceptions,
+        //:   and verify its capacity and value.  (C-3)
+        //:
+        //: 4 Verify 'max_size' directly.  (C-4)
+        //
+        // Testing:
+        //   ring_buffer(size_type fixedCapacity, const A& allocator = A());
+        //   void reserve(size_type numElements);
+        //   bool is_fixed_capacity() const;
+        //   size_type max_size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING FIXED CAPACITY AND 'reserve'"
+                            "\n====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase3,
+                      int,
+                      bsltf::AllocTestType,
+                      bsltf::AllocBitwiseMoveableTestType);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each sequence of pushes and pops at either end produces the
+        //:   sequence of elements that the same operations produce in a
+        //:   'deque', as observed through each accessor and iterator,
+        //:   including when the elements wrap around the end of the slots.
+        //:
+        //: 2 A growable ring buffer allocates no memory on construction, and
+        //:   grows by doubling its slots, preserving the order of its
+        //:   elements, when an element is added to it while it is full.
+        //:
+        //: 3 The elements may be modified through each manipulator.
+        //:
+        //: 4 'at' throws 'bsl::out_of_range' for an invalid index.
+        //:
+        //: 5 'clear' removes all elements but retains the slots.
+        //:
+        //: 6 If an allocation fails while a value is pushed, the ring buffer
+        //:   is unchanged, and no memory is leaked.
+        //:
+        //: 7 A value referring to an element of the ring buffer itself is
+        //:   pushed correctly, even if the ring buffer grows.
+        //:
+        //: 8 All memory, including that of the elements, is supplied by the
+        //:   allocator of the ring buffer.
+        //:
+        //: 9 Elements that are not bitwise moveable are relocated by copy.
+        //:
+        //:10 The type has the expected traits.
+        //
+        // Plan:
+        //: 1 For each row of the table, apply its operations one by one to a
+        //:   ring buffer and to a 'deque' model, and verify the state of the
+        //:   ring buffer after each, then modify, access out of range, and
+        //:   clear it.  (C-1..5, 8)
+        //:
+        //: 2 For each row of the table, push a new value, the first element,
+        //:   and the last element at either end of the resulting ring buffer
+        //:   in the presence of injected exceptions, and verify its state.
+        //:   (C-6..7)
+        //:
+        //: 3 For each power-of-two capacity up to 16 and each position of the
+        //:   first element, fill a ring buffer and push one more element at
+        //:   either end.  (C-2)
+        //:
+        //: 4 Run the above for 'int', for a type that allocates and is not
+        //:   bitwise moveable (and whose objects verify that they have not
+        //:   been moved), and for a type that allocates and is bitwise
+        //:   moveable.  (C-9)
+        //:
+        //: 5 Verify the traits directly.  (C-10)
+        //
+        // Testing:
+        //   ring_buffer(const A& allocator = A());
+        //   ~ring_buffer();
+        //   void push_back(const VALUE_TYPE& value);
+        //   void push_front(const VALUE_TYPE& value);
+        //   void pop_back();
+        //   void pop_front();
+        //   void clear();
+        //   reference operator[](size_type index);
+        //   reference at(size_type index);
+        //   reference front();
+        //   reference back();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   allocator_type get_allocator() const;
+        //   const_reference operator[](size_type index) const;
+        //   const_reference at(size_type index) const;
+        //   const_reference front() const;
+        //   const_reference back() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   bool empty() const;
+        //   bool full() const;
+        //   size_type size() const;
+        //   size_type capacity() const;
+        //   CONCERN: The type has the expected traits.
+        //   CONCERN: Growing does not invalidate the value pushed.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING MANIPULATORS AND ACCESSORS"
+                            "\n==================================\n");
+
+        ASSERT(true  == bslalg::HasStlIterators<Obj>::value);
+        ASSERT(true  == bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(true  == bslmf::IsBitwiseMoveable<Obj>::value);
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase2,
+                      int,
+                      bsltf::AllocTestType,
+                      bsltf::AllocBitwiseMoveableTestType);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push and pop elements at both ends of a ring buffer, until they
+        //:   wrap around and the ring buffer grows, and copy and compare it.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(true == X.empty());
+        ASSERT(0 == X.capacity());
+        ASSERT(0 == oa.numBlocksTotal());
+
+        mX.push_back(2);
+        mX.push_back(3);
+        mX.push_front(1);
+        ASSERT(3 == X.size());
+        ASSERT(4 == X.capacity());
+        ASSERT(1 == X.front());
+        ASSERT(3 == X.back());
+        ASSERT(2 == X[1]);
+
+        mX.pop_front();
+        mX.push_back(4);
+        mX.push_back(5);
+        ASSERT(true == X.full());
+        ASSERT(2 == X.front());
+        ASSERT(5 == X.back());
+
+        mX.push_back(6);
+        ASSERT(5 == X.size());
+        ASSERT(8 == X.capacity());
+        for (int i = 0; i < 5; ++i) {
+            ASSERTV(i, i + 2 == X[i]);
+        }
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+        mY.pop_back();
+        ASSERT(X != Y);
+        ASSERT(Y < X);
+
+        Obj mZ(2, &oa);  const Obj& Z = mZ;
+        ASSERT(true == Z.is_fixed_capacity());
+        mZ.push_back(7);
+        mZ.push_back(8);
+        ASSERT(true == Z.full());
+        mZ.pop_front();
+        mZ.push_back(9);
+        ASSERT(8 == Z.front());
+        ASSERT(9 == Z.back());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'bsl::queue' OF 'ring_buffer' VS. OF 'deque'
+        //
+        // Concerns:
+        //   Provide a benchmark of the throughput of a 'bsl::queue' whose
+        //   underlying container is a 'ring_buffer' (growable and of fixed
+        //   capacity), compared with one whose container is a 'deque'.
+        //
+        // Plan:
+        //   For queues of various lengths, report the time taken to push and
+        //   pop (by default) 10 million 'int' values in steady state, and to
+        //   push and then pop bursts of as many values as the length, with
+        //   memory supplied by the 'new'/'delete' allocator.
+        //
+        // Testing:
+        //   PERFORMANCE: 'bsl::queue' OF 'ring_buffer' VS. OF 'deque'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'bsl::queue' OF 'ring_buffer' VS."
+                            " OF 'deque'"
+                            "\n==============================================="
+                            "==========\n");
+
+        typedef bsl::queue<int, Obj>              RingQueue;
+        typedef bsl::queue<int, bsl::deque<int> > DequeQueue;
+
+        const int NUM_OPS = argc > 2 && atoi(argv[2]) > 0
+                            ? atoi(argv[2])
+                            : 10 * 1000 * 1000;
+
+        const int LENGTHS[]   = { 1, 100, 10 * 1000, 1000 * 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        for (int burst = 0; burst < 2; ++burst) {
+            printf("\t%s:\n", burst ? "Bursts of 'push', then of 'pop'"
+                                    : "Alternating 'push' and 'pop'");
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                double   times[3];
+                unsigned sums[3] = { 0, 0, 0 };
+
+                for (int ci = 0; ci < 3; ++ci) {
+                    DequeQueue dequeQueue(allocator);
+                    RingQueue  ringQueue(0 == ci ? Obj(allocator)
+                                                 : Obj(LENGTH + 1, allocator),
+                                         allocator);
+
+                    bsls::Stopwatch timer;
+                    if (2 == ci) {
+                        if (!burst) {
+                            for (int i = 0; i < LENGTH; ++i) {
+                                dequeQueue.push(i);
+                            }
+                        }
+                        timer.start();
+                        for (int i = 0; i < NUM_OPS; i += LENGTH) {
+                            for (int j = 0; j < LENGTH; ++j) {
+                                dequeQueue.push(j);
+                                if (!burst) {
+                                    sums[ci] += dequeQueue.front();
+                                    dequeQueue.pop();
+                                }
+                            }
+                            for (int j = 0; burst && j < LENGTH; ++j) {
+                                sums[ci] += dequeQueue.front();
+                                dequeQueue.pop();
+                            }
+                        }
+                        timer.stop();
+                    }
+                    else {
+                        if (!burst) {
+                            for (int i = 0; i < LENGTH; ++i) {
+                                ringQueue.push(i);
+                            }
+                        }
+                        timer.start();
+                        for (int i = 0; i < NUM_OPS; i += LENGTH) {
+                            for (int j = 0; j < LENGTH; ++j) {
+                                ringQueue.push(j);
+                                if (!burst) {
+                                    sums[ci] += ringQueue.front();
+                                    ringQueue.pop();
+                                }
+                            }
+                            for (int j = 0; burst && j < LENGTH; ++j) {
+                                sums[ci] += ringQueue.front();
+                                ringQueue.pop();
+                            }
+                        }
+                        timer.stop();
+                    }
+                    times[ci] = timer.elapsedTime();
+                }
+                ASSERTV(LENGTH, sums[0] == sums[1]);
+                ASSERTV(LENGTH, sums[0] == sums[2]);
+
+                printf("\t\tlength %7d: ring_buffer %6.3fs, fixed %6.3fs,"
+                       " deque %6.3fs\n",
+                       LENGTH, times[0], times[1], times[2]);
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,989 @@
+// bslstl_rope.cpp                                                    -*-C++-*-
+#include <bslstl_rope.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_types.h>
+
+#include <cstring>
+#include <ostream>
+
+namespace BloombergLP {
+namespace bslstl {
+
+namespace {
+
+                              // ===============
+                              // struct LeafNode
+                              // ===============
+
+struct LeafNode : Rope_Node {
+    // This 'struct' provides a leaf of the tree representing a rope.  The
+    // characters of the leaf are stored immediately after this header,
+    // followed by 'd_capacity - d_length' bytes of spare capacity.
+
+    // DATA
+    std::size_t d_capacity;  // number of characters that can be stored
+
+    // MANIPULATORS
+    char *characters()
+        // Return the address of the characters of this leaf.
+    {
+        return reinterpret_cast<char *>(this + 1);
+    }
+};
+
+                          // ========================
+                          // struct ConcatenationNode
+                          // ========================
+
+struct ConcatenationNode : Rope_Node {
+    // This 'struct' provides a node of the tree representing a rope that is
+    // the concatenation of two non-empty nodes.
+
+    // DATA
+    Rope_Node *d_left_p;   // first part (owned reference)
+    Rope_Node *d_right_p;  // second part (owned reference)
+};
+
+                            // ====================
+                            // struct SubstringNode
+                            // ====================
+
+struct SubstringNode : Rope_Node {
+    // This 'struct' provides a node of the tree representing a rope that is
+    // a part of the characters of a leaf.
+
+    // DATA
+    LeafNode    *d_leaf_p;  // leaf holding the characters (owned reference)
+    std::size_t  d_offset;  // offset of the first character in the leaf
+};
+
+enum {
+    k_SHORT_LENGTH        = 128,   // nodes of at most this total length are
+                                   // concatenated by copying
+
+    k_MAX_APPEND_CAPACITY = 4096 - sizeof(LeafNode),
+                                   // limit of the spare capacity of a leaf
+                                   // created by 'append'
+
+    k_MAX_DEPTH           = 92     // depth above which no tree is balanced
+};
+
+const bsls::Types::Uint64 k_MIN_LENGTH[k_MAX_DEPTH + 1] = {
+    // The minimum length of a balanced tree of each depth: a tree of depth
+    // 'd' is balanced if its length is at least 'k_MIN_LENGTH[d]', the
+    // 'd + 2'nd Fibonacci number.  The last entry is saturated.
+
+    1ULL, 2ULL, 3ULL,
+    5ULL, 8ULL, 13ULL,
+    21ULL, 34ULL, 55ULL,
+    89ULL, 144ULL, 233ULL,
+    377ULL, 610ULL, 987ULL,
+    1597ULL, 2584ULL, 4181ULL,
+    6765ULL, 10946ULL, 17711ULL,
+    28657ULL, 46368ULL, 75025ULL,
+    121393ULL, 196418ULL, 317811ULL,
+    514229ULL, 832040ULL, 1346269ULL,
+    2178309ULL, 3524578ULL, 5702887ULL,
+    9227465ULL, 14930352ULL, 24157817ULL,
+    39088169ULL, 63245986ULL, 102334155ULL,
+    165580141ULL, 267914296ULL, 433494437ULL,
+    701408733ULL, 1134903170ULL, 1836311903ULL,
+    2971215073ULL, 4807526976ULL, 7778742049ULL,
+    12586269025ULL, 20365011074ULL, 32951280099ULL,
+    53316291173ULL, 86267571272ULL, 139583862445ULL,
+    225851433717ULL, 365435296162ULL, 591286729879ULL,
+    956722026041ULL, 1548008755920ULL, 2504730781961ULL,
+    4052739537881ULL, 6557470319842ULL, 10610209857723ULL,
+    17167680177565ULL, 27777890035288ULL, 44945570212853ULL,
+    72723460248141ULL, 117669030460994ULL, 190392490709135ULL,
+    308061521170129ULL, 498454011879264ULL, 806515533049393ULL,
+    1304969544928657ULL, 2111485077978050ULL, 3416454622906707ULL,
+    5527939700884757ULL, 8944394323791464ULL, 14472334024676221ULL,
+    23416728348467685ULL, 37889062373143906ULL, 61305790721611591ULL,
+    99194853094755497ULL, 160500643816367088ULL, 259695496911122585ULL,
+    420196140727489673ULL, 679891637638612258ULL, 1100087778366101931ULL,
+    1779979416004714189ULL, 2880067194370816120ULL, 4660046610375530309ULL,
+    7540113804746346429ULL, 12200160415121876738ULL, 18446744073709551615ULL
+};
+
+// LOCAL FUNCTIONS
+inline
+Rope_Node *acquireNode(Rope_Node *node)
+    // Increment the reference count of the specified 'node', if not 0, and
+    // return 'node'.
+{
+    if (node) {
+        bsls::AtomicOperations::addIntNvRelaxed(&node->d_refCount, 1);
+    }
+    return node;
+}
+
+void releaseNode(Rope_Node *node)
+    // Decrement the reference count of the specified 'node', if not 0, and
+    // destroy it, releasing its references to other nodes, if it was the last
+    // reference.
+{
+    if (!node || 0 != bsls::AtomicOperations::decrementIntNvAcqRel(
+                                                         &node->d_refCount)) {
+        return;                                                       // RETURN
+    }
+
+    if (Rope_Node::e_CONCATENATION == node->d_kind) {
+        ConcatenationNode *concatenation =
+                                      static_cast<ConcatenationNode *>(node);
+        releaseNode(concatenation->d_left_p);
+        releaseNode(concatenation->d_right_p);
+    }
+    else if (Rope_Node::e_SUBSTRING == node->d_kind) {
+        releaseNode(static_cast<SubstringNode *>(node)->d_leaf_p);
+    }
+    node->d_allocator_p->deallocate(node);
+}
+
+inline
+bool isUnique(const Rope_Node *node)
+    // Return 'true' if the specified 'node' has a single reference, and
+    // 'false' otherwise.
+{
+    return 1 == bsls::AtomicOperations::getIntAcquire(&node->d_refCount);
+}
+
+inline
+bool isBalanced(const Rope_Node *node)
+    // Return 'true' if the tree rooted at the specified 'node' is not too
+    // deep for its length, and 'false' otherwise.
+{
+    return node->d_depth < k_MAX_DEPTH
+        && node->d_length >= k_MIN_LENGTH[node->d_depth];
+}
+
+inline
+const char *chunkData(const Rope_Node *node)
+    // Return the address of the characters of the specified 'node'.  The
+    // behavior is undefined unless 'node' is a leaf or a substring.
+{
+    if (Rope_Node::e_LEAF == node->d_kind) {
+        const LeafNode *leaf = static_cast<const LeafNode *>(node);
+        return reinterpret_cast<const char *>(leaf + 1);              // RETURN
+    }
+
+    const SubstringNode *substring = static_cast<const SubstringNode *>(node);
+    return substring->d_leaf_p->characters() + substring->d_offset;
+}
+
+void initNode(Rope_Node        *node,
+              Rope_Node::Kind   kind,
+              std::size_t       length,
+              int               depth,
+              bslma::Allocator *allocator)
+    // Initialize the header of the specified 'node' with a reference count
+    // of 1 and the specified 'kind', 'length', 'depth', and 'allocator'.
+{
+    bsls::AtomicOperations::initInt(&node->d_refCount, 1);
+    node->d_kind        = static_cast<unsigned char>(kind);
+    node->d_depth       = static_cast<unsigned char>(depth);
+    node->d_length      = length;
+    node->d_allocator_p = allocator;
+}
+
+LeafNode *createLeaf(std::size_t capacity, bslma::Allocator *allocator)
+    // Return a new, empty leaf, having a reference count of 1 and the
+    // specified 'capacity', allocated using the specified 'allocator'.
+{
+    LeafNode *leaf = static_cast<LeafNode *>(
+                          allocator->allocate(sizeof(LeafNode) + capacity));
+    initNode(leaf, Rope_Node::e_LEAF, 0, 0, allocator);
+    leaf->d_capacity = capacity;
+    return leaf;
+}
+
+Rope_Node *createConcatenation(Rope_Node        *left,
+                               Rope_Node        *right,
+                               bslma::Allocator *allocator)
+    // Return the concatenation of the specified 'left' and 'right' nodes,
+    // adopting the references to them, allocated using the specified
+    // 'allocator', or 'left' if 'right' is 0, or 'right' if 'left' is 0.  If
+    // an exception is thrown, the references to 'left' and 'right' are not
+    // adopted.
+{
+    if (!right) {
+        return left;                                                  // RETURN
+    }
+    if (!left) {
+        return right;                                                 // RETURN
+    }
+
+    ConcatenationNode *node = static_cast<ConcatenationNode *>(
+                               allocator->allocate(sizeof(ConcatenationNode)));
+    initNode(node,
+             Rope_Node::e_CONCATENATION,
+             left->d_length + right->d_length,
+             1 + (left->d_depth > right->d_depth ? left->d_depth
+                                                  : right->d_depth),
+             allocator);
+    node->d_left_p  = left;
+    node->d_right_p = right;
+    return node;
+}
+
+                             // =================
+                             // class NodeProctor
+                             // =================
+
+class NodeProctor {
+    // This class implements a proctor that releases a reference to a node
+    // on destruction, unless the reference has been released from the
+    // proctor.
+
+    // DATA
+    Rope_Node *d_node_p;  // managed reference, or 0
+
+  private:
+    // NOT IMPLEMENTED
+    NodeProctor(const NodeProctor&);
+    NodeProctor& operator=(const NodeProctor&);
+
+  public:
+    // CREATORS
+    explicit NodeProctor(Rope_Node *node)
+        // Create a proctor managing the specified 'node' reference.
+    : d_node_p(node)
+    {
+    }
+
+    ~NodeProctor()
+        // Release the managed reference, if any.
+    {
+        releaseNode(d_node_p);
+    }
+
+    // MANIPULATORS
+    Rope_Node *release()
+        // Return the managed reference, and stop managing it.
+    {
+        Rope_Node *node = d_node_p;
+        d_node_p = 0;
+        return node;
+    }
+
+    void reset(Rope_Node *node)
+        // Manage the specified 'node' reference.  The behavior is undefined
+        // unless no reference is currently managed.
+    {
+        d_node_p = node;
+    }
+
+    // ACCESSORS
+    Rope_Node *get() const
+        // Return the managed reference.
+    {
+        return d_node_p;
+    }
+};
+
+Rope_Node *concatenate(Rope_Node        *left,
+                       Rope_Node        *right,
+                       bslma::Allocator *allocator)
+    // Return the concatenation of the specified 'left' and 'right' nodes,
+    // either of which may be 0, adopting the references to them, and using
+    // the specified 'allocator' to create new nodes.  If 'left' and 'right'
+    // are short chunks, their characters are copied into a new leaf.  If an
+    // exception is thrown, the references to 'left' and 'right' are not
+    // adopted.
+{
+    if (left && right
+     && Rope_Node::e_CONCATENATION != left->d_kind
+     && Rope_Node::e_CONCATENATION != right->d_kind
+     && left->d_length + right->d_length <= k_SHORT_LENGTH) {
+        const std::size_t length = left->d_length + right->d_length;
+
+        LeafNode *leaf = createLeaf(length, allocator);
+        std::memcpy(leaf->characters(), chunkData(left), left->d_length);
+        std::memcpy(leaf->characters() + left->d_length,
+                    chunkData(right),
+                    right->d_length);
+        leaf->d_length = length;
+
+        releaseNode(left);
+        releaseNode(right);
+        return leaf;                                                  // RETURN
+    }
+
+    return createConcatenation(left, right, allocator);
+}
+
+Rope_Node *substring(Rope_Node        *node,
+                     std::size_t       position,
+                     std::size_t       length,
+                     bslma::Allocator *allocator)
+    // Return a new reference to a node representing the specified 'length'
+    // characters of the specified 'node' starting at the specified
+    // 'position', or 0 if 'length' is 0, using the specified 'allocator' to
+    // create new nodes.  The behavior is undefined unless
+    // 'position + length <= node->d_length'.
+{
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+    if (0 == position && node->d_length == length) {
+        return acquireNode(node);                                     // RETURN
+    }
+
+    switch (node->d_kind) {
+      case Rope_Node::e_CONCATENATION: {
+        ConcatenationNode *concatenation =
+                                      static_cast<ConcatenationNode *>(node);
+        const std::size_t leftLength = concatenation->d_left_p->d_length;
+
+        if (position + length <= leftLength) {
+            return substring(concatenation->d_left_p,
+                             position,
+                             length,
+                             allocator);                              // RETURN
+        }
+        if (position >= leftLength) {
+            return substring(concatenation->d_right_p,
+                             position - leftLength,
+                             length,
+                             allocator);                              // RETURN
+        }
+
+        NodeProctor left(substring(concatenation->d_left_p,
+                                   position,
+                                   leftLength - position,
+                                   allocator));
+        NodeProctor right(substring(concatenation->d_right_p,
+                                    0,
+                                    position + length - leftLength,
+                                    allocator));
+
+        Rope_Node *result = concatenate(left.get(), right.get(), allocator);
+        left.release();
+        right.release();
+        return result;                                                // RETURN
+      }
+      case Rope_Node::e_SUBSTRING: {
+        SubstringNode *substringNode = static_cast<SubstringNode *>(node);
+        return substring(substringNode->d_leaf_p,
+                         substringNode->d_offset + position,
+                         length,
+                         allocator);                                  // RETURN
+      }
+    }
+
+    // 'node' is a leaf.  Short parts are copied, so that they do not keep a
+    // large leaf alive.
+
+    LeafNode *leaf = static_cast<LeafNode *>(node);
+
+    if (length <= k_SHORT_LENGTH) {
+        LeafNode *result = createLeaf(length, allocator);
+        std::memcpy(result->characters(),
+                    leaf->characters() + position,
+                    length);
+        result->d_length = length;
+        return result;                                                // RETURN
+    }
+
+    SubstringNode *result = static_cast<SubstringNode *>(
+                                   allocator->allocate(sizeof(SubstringNode)));
+    initNode(result, Rope_Node::e_SUBSTRING, length, 0, allocator);
+    result->d_leaf_p = static_cast<LeafNode *>(acquireNode(leaf));
+    result->d_offset = position;
+    return result;
+}
+
+std::size_t copyCharacters(char            *result,
+                           const Rope_Node *node,
+                           std::size_t      position,
+                           std::size_t      length)
+    // Copy to the specified 'result' the specified 'length' characters of the
+    // specified 'node' starting at the specified 'position', and return
+    // 'length'.  The behavior is undefined unless
+    // 'position + length <= node->d_length'.
+{
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    if (Rope_Node::e_CONCATENATION != node->d_kind) {
+        std::memcpy(result, chunkData(node) + position, length);
+        return length;                                                // RETURN
+    }
+
+    const ConcatenationNode *concatenation =
+                                static_cast<const ConcatenationNode *>(node);
+    const std::size_t leftLength = concatenation->d_left_p->d_length;
+
+    if (position >= leftLength) {
+        return copyCharacters(result,
+                              concatenation->d_right_p,
+                              position - leftLength,
+                              length);                                // RETURN
+    }
+
+    const std::size_t numLeft = leftLength - position < length
+                              ? leftLength - position
+                              : length;
+
+    copyCharacters(result, concatenation->d_left_p, position, numLeft);
+    copyCharacters(result + numLeft,
+                   concatenation->d_right_p,
+                   0,
+                   length - numLeft);
+    return length;
+}
+
+                           // ====================
+                           // class CopyCharacters
+                           // ====================
+
+class CopyCharacters {
+    // This class implements a functor, suitable for
+    // 'bsl::string::resize_and_overwrite', that copies all of the characters
+    // of a node to the supplied buffer.
+
+    // DATA
+    const Rope_Node *d_node_p;  // node to copy (held, not owned), or 0
+
+  public:
+    // CREATORS
+    explicit CopyCharacters(const Rope_Node *node)
+        // Create a functor copying the characters of the specified 'node'.
+    : d_node_p(node)
+    {
+    }
+
+    // ACCESSORS
+    std::size_t operator()(char *result, std::size_t length) const
+        // Copy the specified 'length' characters of the node held by this
+        // functor to the specified 'result', and return 'length'.  The
+        // behavior is undefined unless 'length' is the length of the node.
+    {
+        return d_node_p ? copyCharacters(result, d_node_p, 0, length) : 0;
+    }
+};
+
+std::size_t countChunks(const Rope_Node *node)
+    // Return the number of chunks of the specified 'node'.
+{
+    if (Rope_Node::e_CONCATENATION != node->d_kind) {
+        return 1;                                                     // RETURN
+    }
+
+    const ConcatenationNode *concatenation =
+                                static_cast<const ConcatenationNode *>(node);
+    return countChunks(concatenation->d_left_p)
+         + countChunks(concatenation->d_right_p);
+}
+
+                               // ============
+                               // class Forest
+                               // ============
+
+class Forest {
+    // This class implements the rebalancing algorithm of Boehm, Atkinson, and
+    // Plass: balanced subtrees are inserted, in order, into a sequence of
+    // slots, each holding a balanced tree whose length is in the range
+    // '[k_MIN_LENGTH[i], k_MIN_LENGTH[i + 1])', concatenating the slots
+    // holding shorter trees as they are filled.  The concatenation of the
+    // slots, in decreasing order, is a balanced tree.
+
+    // DATA
+    Rope_Node        *d_trees[k_MAX_DEPTH + 1];  // slots (owned references)
+    bslma::Allocator *d_allocator_p;             // allocator for new nodes
+
+  private:
+    // NOT IMPLEMENTED
+    Forest(const Forest&);
+    Forest& operator=(const Forest&);
+
+    // PRIVATE MANIPULATORS
+    void insertBalanced(Rope_Node *tree);
+        // Insert the specified balanced 'tree', adopting the reference to it,
+        // after the trees previously inserted.
+
+  public:
+    // CREATORS
+    explicit Forest(bslma::Allocator *allocator);
+        // Create an empty forest using the specified 'allocator' to create
+        // concatenation nodes.
+
+    ~Forest();
+        // Release the trees held by this forest.
+
+    // MANIPULATORS
+    void insert(Rope_Node *tree);
+        // Insert, after the trees previously inserted, the balanced subtrees
+        // of the specified 'tree'.
+
+    Rope_Node *concatenateAll();
+        // Return the concatenation of the trees held by this forest, and make
+        // this forest empty.
+};
+
+Forest::Forest(bslma::Allocator *allocator)
+: d_allocator_p(allocator)
+{
+    for (int i = 0; i <= k_MAX_DEPTH; ++i) {
+        d_trees[i] = 0;
+    }
+}
+
+Forest::~Forest()
+{
+    for (int i = 0; i <= k_MAX_DEPTH; ++i) {
+        releaseNode(d_trees[i]);
+    }
+}
+
+void Forest::insertBalanced(Rope_Node *tree)
+{
+    NodeProctor       insertee(tree);
+    const std::size_t length = tree->d_length;
+
+    // Concatenate the slots holding trees shorter than 'tree'.
+
+    int         i = 0;
+    NodeProctor tooShort(0);
+
+    for (; i < k_MAX_DEPTH && length >= k_MIN_LENGTH[i + 1]; ++i) {
+        if (d_trees[i]) {
+            Rope_Node *concatenation = createConcatenation(d_trees[i],
+                                                           tooShort.get(),
+                                                           d_allocator_p);
+            d_trees[i] = 0;
+            tooShort.release();
+            tooShort.reset(concatenation);
+        }
+    }
+
+    {
+        Rope_Node *concatenation = createConcatenation(tooShort.get(),
+                                                       insertee.get(),
+                                                       d_allocator_p);
+        tooShort.release();
+        insertee.release();
+        insertee.reset(concatenation);
+    }
+
+    // Carry the result into the first empty slot long enough for it.
+
+    for (;; ++i) {
+        if (d_trees[i]) {
+            Rope_Node *concatenation = createConcatenation(d_trees[i],
+                                                           insertee.get(),
+                                                           d_allocator_p);
+            d_trees[i] = 0;
+            insertee.release();
+            insertee.reset(concatenation);
+        }
+        if (k_MAX_DEPTH == i
+         || insertee.get()->d_length < k_MIN_LENGTH[i + 1]) {
+            d_trees[i] = insertee.release();
+            return;                                                   // RETURN
+        }
+    }
+}
+
+void Forest::insert(Rope_Node *tree)
+{
+    if (isBalanced(tree)) {
+        insertBalanced(acquireNode(tree));
+        return;                                                       // RETURN
+    }
+
+    // Only concatenations can be unbalanced.
+
+    ConcatenationNode *concatenation = static_cast<ConcatenationNode *>(tree);
+    insert(concatenation->d_left_p);
+    insert(concatenation->d_right_p);
+}
+
+Rope_Node *Forest::concatenateAll()
+{
+    NodeProctor result(0);
+    for (int i = 0; i <= k_MAX_DEPTH; ++i) {
+        if (d_trees[i]) {
+            Rope_Node *concatenation = createConcatenation(d_trees[i],
+                                                           result.get(),
+                                                           d_allocator_p);
+            d_trees[i] = 0;
+            result.release();
+            result.reset(concatenation);
+        }
+    }
+    return result.release();
+}
+
+}  // close unnamed namespace
+
+                                // ----------
+                                // class Rope
+                                // ----------
+
+// PRIVATE MANIPULATORS
+void Rope::assignRoot(Rope_Node *root)
+{
+    if (root && !isBalanced(root)) {
+        NodeProctor unbalanced(root);
+
+        Forest forest(d_allocator_p);
+        forest.insert(root);
+        root = forest.concatenateAll();
+    }
+
+    Rope_Node *previous = d_root_p;
+    d_root_p = root;
+    releaseNode(previous);
+}
+
+// CREATORS
+Rope::Rope(const StringRef& string, bslma::Allocator *basicAllocator)
+: d_root_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (!string.isEmpty()) {
+        const std::size_t length = string.length();
+
+        LeafNode *leaf = createLeaf(length, d_allocator_p);
+        std::memcpy(leaf->characters(), string.data(), length);
+        leaf->d_length = length;
+        d_root_p = leaf;
+    }
+}
+
+// MANIPULATORS
+void Rope::append(const StringRef& string)
+{
+    const char        *characters = string.data();
+    const std::size_t  length     = string.length();
+
+    if (0 == length) {
+        return;                                                       // RETURN
+    }
+
+    // Copy the characters into the spare capacity of the last leaf if they
+    // fit, and neither the leaf nor any node on the path to it is shared.
+
+    Rope_Node *last = d_root_p;
+    while (last
+        && isUnique(last)
+        && Rope_Node::e_CONCATENATION == last->d_kind) {
+        last = static_cast<ConcatenationNode *>(last)->d_right_p;
+    }
+
+    if (last
+     && Rope_Node::e_LEAF == last->d_kind
+     && isUnique(last)
+     && static_cast<LeafNode *>(last)->d_capacity - last->d_length >= length) {
+        LeafNode *leaf = static_cast<LeafNode *>(last);
+
+        std::memcpy(leaf->characters() + leaf->d_length, characters, length);
+
+        Rope_Node *node = d_root_p;
+        while (node != leaf) {
+            node->d_length += length;
+            node = static_cast<ConcatenationNode *>(node)->d_right_p;
+        }
+        leaf->d_length += length;
+        return;                                                       // RETURN
+    }
+
+    // Otherwise, copy the characters into a new leaf, having spare capacity
+    // for subsequent appends.
+
+    std::size_t capacity = this->length() + length;
+    if (capacity > k_MAX_APPEND_CAPACITY) {
+        capacity = k_MAX_APPEND_CAPACITY;
+    }
+    if (capacity < length) {
+        capacity = length;
+    }
+
+    LeafNode *leaf = createLeaf(capacity, d_allocator_p);
+    std::memcpy(leaf->characters(), characters, length);
+    leaf->d_length = length;
+
+    NodeProctor proctor(leaf);
+
+    Rope_Node *root = createConcatenation(d_root_p, leaf, d_allocator_p);
+    acquireNode(d_root_p);
+    proctor.release();
+    assignRoot(root);
+}
+
+void Rope::append(const Rope& rope)
+{
+    insert(length(), rope);
+}
+
+void Rope::erase(std::size_t position, std::size_t numChars)
+{
+    BSLS_ASSERT(position <= length());
+
+    const std::size_t end = numChars < length() - position
+                          ? position + numChars
+                          : length();
+
+    if (position == end) {
+        return;                                                       // RETURN
+    }
+
+    NodeProctor prefix(substring(d_root_p, 0, position, d_allocator_p));
+    NodeProctor suffix(substring(d_root_p,
+                                 end,
+                                 length() - end,
+                                 d_allocator_p));
+
+    Rope_Node *root = concatenate(prefix.get(), suffix.get(), d_allocator_p);
+    prefix.release();
+    suffix.release();
+    assignRoot(root);
+}
+
+void Rope::insert(std::size_t position, const StringRef& string)
+{
+    BSLS_ASSERT(position <= length());
+
+    if (position == length()) {
+        append(string);
+        return;                                                       // RETURN
+    }
+
+    insert(position, Rope(string, d_allocator_p));
+}
+
+void Rope::insert(std::size_t position, const Rope& rope)
+{
+    BSLS_ASSERT(position <= length());
+
+    if (rope.empty()) {
+        return;                                                       // RETURN
+    }
+
+    NodeProctor prefix(substring(d_root_p, 0, position, d_allocator_p));
+    NodeProctor suffix(substring(d_root_p,
+                                 position,
+                                 length() - position,
+                                 d_allocator_p));
+    NodeProctor middle(acquireNode(rope.d_root_p));
+
+    Rope_Node *root = concatenate(prefix.get(), middle.get(), d_allocator_p);
+    prefix.release();
+    middle.release();
+    middle.reset(root);
+
+    root = concatenate(middle.get(), suffix.get(), d_allocator_p);
+    middle.release();
+    suffix.release();
+    assignRoot(root);
+}
+
+void Rope::prepend(const StringRef& string)
+{
+    insert(0, Rope(string, d_allocator_p));
+}
+
+void Rope::prepend(const Rope& rope)
+{
+    insert(0, rope);
+}
+
+// ACCESSORS
+char Rope::operator[](std::size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < length());
+
+    const Rope_Node *node = d_root_p;
+    while (Rope_Node::e_CONCATENATION == node->d_kind) {
+        const ConcatenationNode *concatenation =
+                                static_cast<const ConcatenationNode *>(node);
+        if (position < concatenation->d_left_p->d_length) {
+            node = concatenation->d_left_p;
+        }
+        else {
+            position -= concatenation->d_left_p->d_length;
+            node      = concatenation->d_right_p;
+        }
+    }
+    return chunkData(node)[position];
+}
+
+int Rope::compare(const Rope& other) const
+{
+    RopeChunkIterator lhs(*this);
+    RopeChunkIterator rhs(other);
+
+    std::size_t lhsOffset = 0;  // offset in the current chunk of 'lhs'
+    std::size_t rhsOffset = 0;  // offset in the current chunk of 'rhs'
+
+    while (lhs.isValid() && rhs.isValid()) {
+        const std::size_t lhsLength = lhs.chunk().length() - lhsOffset;
+        const std::size_t rhsLength = rhs.chunk().length() - rhsOffset;
+        const std::size_t length    = lhsLength < rhsLength ? lhsLength
+                                                            : rhsLength;
+
+        const int result = std::memcmp(lhs.chunk().data() + lhsOffset,
+                                       rhs.chunk().data() + rhsOffset,
+                                       length);
+        if (result) {
+            return result;                                            // RETURN
+        }
+
+        lhsOffset += length;
+        rhsOffset += length;
+        if (lhsOffset == lhs.chunk().length()) {
+            ++lhs;
+            lhsOffset = 0;
+        }
+        if (rhsOffset == rhs.chunk().length()) {
+            ++rhs;
+            rhsOffset = 0;
+        }
+    }
+
+    return lhs.isValid() ? 1 : rhs.isValid() ? -1 : 0;
+}
+
+int Rope::compare(const StringRef& other) const
+{
+    const std::size_t otherLength = other.length();
+    std::size_t       position    = 0;
+
+    for (RopeChunkIterator it(*this); it.isValid(); ++it) {
+        const std::size_t remaining = otherLength - position;
+        const std::size_t length    = it.chunk().length() < remaining
+                                    ? it.chunk().length()
+                                    : remaining;
+
+        const int result = std::memcmp(it.chunk().data(),
+                                       other.data() + position,
+                                       length);
+        if (result) {
+            return result;                                            // RETURN
+        }
+        if (length < it.chunk().length()) {
+            return 1;                                                 // RETURN
+        }
+        position += length;
+    }
+
+    return position < otherLength ? -1 : 0;
+}
+
+std::size_t Rope::copy(char        *result,
+                       std::size_t  numChars,
+                       std::size_t  position) const
+{
+    BSLS_ASSERT(position <= length());
+    BSLS_ASSERT(result || 0 == numChars);
+
+    if (numChars > length() - position) {
+        numChars = length() - position;
+    }
+
+    return copyCharacters(result, d_root_p, position, numChars);
+}
+
+void Rope::flatten(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->resize_and_overwrite(length(), CopyCharacters(d_root_p));
+}
+
+std::size_t Rope::numChunks() const
+{
+    return d_root_p ? countChunks(d_root_p) : 0;
+}
+
+bsl::string Rope::str() const
+{
+    bsl::string result;
+    flatten(&result);
+    return result;
+}
+
+Rope Rope::substr(std::size_t position, std::size_t numChars) const
+{
+    BSLS_ASSERT(position <= length());
+
+    if (numChars > length() - position) {
+        numChars = length() - position;
+    }
+
+    Rope result(d_allocator_p);
+    result.assignRoot(substring(d_root_p, position, numChars, d_allocator_p));
+    return result;
+}
+
+                          // -----------------------
+                          // class RopeChunkIterator
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+void RopeChunkIterator::findChunk()
+{
+    if (!d_root_p || d_position >= d_root_p->d_length) {
+        d_chunk.reset();
+        return;                                                       // RETURN
+    }
+
+    const Rope_Node *node     = d_root_p;
+    std::size_t      position = d_position;
+
+    while (Rope_Node::e_CONCATENATION == node->d_kind) {
+        const ConcatenationNode *concatenation =
+                                static_cast<const ConcatenationNode *>(node);
+        if (position < concatenation->d_left_p->d_length) {
+            node = concatenation->d_left_p;
+        }
+        else {
+            position -= concatenation->d_left_p->d_length;
+            node      = concatenation->d_right_p;
+        }
+    }
+
+    d_chunk.assign(chunkData(node) + position,
+                   static_cast<int>(node->d_length - position));
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+std::ostream& bslstl::operator<<(std::ostream& stream, const Rope& rope)
+{
+    for (RopeChunkIterator it(rope); it.isValid() && stream.good(); ++it) {
+        stream.write(it.chunk().data(), it.chunk().length());
+    }
+    return stream;
+}
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,664 @@
+// bslstl_rope.h                                                      -*-C++-*-
+#ifndef INCLUDED_BSLSTL_ROPE
+#define INCLUDED_BSLSTL_ROPE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a string built from shared chunks for cheap splicing.
+//
+//@CLASSES:
+//        bslstl::Rope: string represented as a balanced tree of chunks
+//  bslstl::RopeChunkIterator: iterator over the contiguous chunks of a rope
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref, bslstl_sharedstring
+//
+//@DESCRIPTION: This component provides a value-semantic class, 'bslstl::Rope'
+// (also known as a *cord*), holding a sequence of 'char's represented as a
+// binary tree whose leaves are contiguous *chunks* of characters, and an
+// iterator, 'bslstl::RopeChunkIterator', providing access to those chunks in
+// order.  A rope is intended for building and editing very large strings
+// (e.g., multi-megabyte message payloads): appending to, prepending to, and
+// taking a substring of a rope never copy the characters already in the rope,
+// and inserting into or erasing from the middle of a rope copies at most the
+// characters being inserted.  By contrast, appending to a 'bsl::string' copies
+// the whole string each time its capacity is exceeded, and inserting into a
+// 'bsl::string' moves every character after the insertion point.
+//
+// The characters of a rope are not stored contiguously.  They can be visited
+// one chunk at a time using a 'bslstl::RopeChunkIterator' (e.g., to fill an
+// 'iovec' array for a scatter-gather write without copying), copied to a
+// buffer using 'copy', or flattened into a 'bsl::string' using 'flatten'.
+//
+///Representation
+///--------------
+// The nodes of the tree are immutable (with one exception, below) and
+// reference-counted, so that copies of a rope, and ropes built from parts of
+// other ropes, share nodes: copying or assigning a rope takes constant time,
+// and never allocates memory.  There are three kinds of node:
+//
+//: o A *leaf* holds a chunk of characters, copied from the strings passed to
+//:   the manipulators of 'bslstl::Rope'.
+//:
+//: o A *concatenation* holds the addresses of two child nodes, and
+//:   represents their concatenation.
+//:
+//: o A *substring* holds the address of a leaf and represents a contiguous
+//:   part of its characters.
+//
+// Each node records its length and depth, so that the character at a given
+// position, and the node representing a given range of positions, can be
+// found by descending from the root of the tree.  After each modification,
+// the tree is rebalanced if it has become too deep for its length (using the
+// criterion, and algorithm, of Boehm, Atkinson, and Plass, "Ropes: an
+// Alternative to Strings", 1995), so that its depth is logarithmic in the
+// number of its leaves.  Since the balanced subtrees are reused as they are,
+// rebalancing after a sequence of appends visits only the nodes created by
+// those appends.
+//
+// The one exception to immutability is that a leaf that is not shared (i.e.,
+// referred to by a single node or rope) is created with spare capacity, and
+// characters appended to the rope are copied into that capacity when the leaf
+// is the last chunk of the rope and the path to it is not shared either.  A
+// sequence of small appends therefore fills chunks of a few kilobytes, rather
+// than creating a leaf for each append.  Short strings concatenated to a short
+// leaf are likewise copied into a new leaf.
+//
+///Complexity
+/// - - - - -
+// For a rope of length 'N' having 'M' chunks:
+//..
+//  Operation                          Complexity
+//  ---------------------------------  --------------------------------------
+//  copy construction, assignment      O(1)
+//  append, prepend                    O(1) amortized, plus the length of the
+//                                     argument if it is a 'StringRef'
+//  insert, erase, substr              O(log M), plus the length of the
+//                                     argument if it is a 'StringRef'
+//  operator[]                         O(log M)
+//  iteration over all chunks          O(M log M)
+//  copy, flatten, comparison          O(N + M log M)
+//..
+//
+///Memory Allocation and Thread Safety
+///-----------------------------------
+// A rope allocates the nodes it creates using the allocator supplied at its
+// construction.  Nodes shared with other ropes (e.g., by copy construction)
+// are not copied, and each node is returned to the allocator that supplied
+// it when the last rope referring to it is destroyed.  The reference counts
+// of the nodes are maintained atomically, so that distinct 'bslstl::Rope'
+// objects sharing nodes may be used (and modified) concurrently from distinct
+// threads, and a single 'bslstl::Rope' object may be read concurrently from
+// several threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Assembling a Message Payload
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we assemble a large message from a header, a number of records,
+// and a trailer, and that the length of the records, which is known only when
+// all of them have been added, must be spliced in after the header.
+//
+// First, we create a rope and append the header and the records:
+//..
+//  bslma::TestAllocator ta;
+//  bslstl::Rope         payload(&ta);
+//
+//  payload.append("<msg len=>");
+//  for (int i = 0; i < 1000; ++i) {
+//      payload.append("<record/>");
+//  }
+//  payload.append("</msg>");
+//
+//  assert(10 + 9000 + 6 == payload.length());
+//..
+// Then, we splice the length of the records into the header.  Note that the
+// characters of the records are not copied:
+//..
+//  payload.insert(9, "9000");
+//
+//  assert(payload.substr(0, 23) == "<msg len=9000><record/>");
+//..
+// Next, we write the payload one chunk at a time, as we would fill the
+// buffers of a scatter-gather write:
+//..
+//  bsl::string written;
+//  for (bslstl::RopeChunkIterator it(payload); it.isValid(); ++it) {
+//      written.append(it.chunk().begin(), it.chunk().end());
+//  }
+//  assert(payload == written);
+//..
+// Finally, we flatten the trailer of the payload into a 'bsl::string':
+//..
+//  bsl::string trailer;
+//  payload.substr(payload.length() - 15).flatten(&trailer);
+//
+//  assert("<record/></msg>" == trailer);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRING
+#include <bslstl_string.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_IOSFWD
+#include <iosfwd>
+#define INCLUDED_IOSFWD
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                             // ================
+                             // struct Rope_Node
+                             // ================
+
+struct Rope_Node {
+    // This component-private 'struct' provides the header common to the
+    // nodes of the tree representing a 'Rope'.  The remainder of each node,
+    // which depends on its kind, is defined in the implementation file.
+
+    // TYPES
+    enum Kind {
+        e_LEAF,           // chunk of characters
+        e_CONCATENATION,  // concatenation of two nodes
+        e_SUBSTRING       // part of the characters of a leaf
+    };
+
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Int
+                      d_refCount;     // number of nodes and ropes referring
+                                      // to this node
+
+    unsigned char     d_kind;         // 'Kind' of this node
+
+    unsigned char     d_depth;        // depth of the tree rooted at this node
+                                      // (0 for a leaf or substring)
+
+    std::size_t       d_length;       // number of characters represented
+
+    bslma::Allocator *d_allocator_p;  // allocator that supplied this node
+                                      // (held, not owned)
+};
+
+                                // ==========
+                                // class Rope
+                                // ==========
+
+class Rope {
+    // This value-semantic class provides a string represented as a balanced
+    // tree of shared, reference-counted chunks of characters, that can be
+    // appended to, spliced, and cut without copying the characters it holds.
+    // See the component-level documentation for details.
+
+    // DATA
+    Rope_Node        *d_root_p;       // root of the tree, or 0 if this rope
+                                      // is empty
+
+    bslma::Allocator *d_allocator_p;  // allocator used to create nodes (held,
+                                      // not owned)
+
+    // FRIENDS
+    friend class RopeChunkIterator;
+
+    // PRIVATE MANIPULATORS
+    void assignRoot(Rope_Node *root);
+        // Make the specified 'root', whose reference (if 'root' is not 0) is
+        // adopted by this object, the root of this rope, rebalancing it if it
+        // is too deep for its length, and release the previous root.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Rope, bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(Rope, bslmf::IsBitwiseMoveable);
+
+    // PUBLIC CLASS DATA
+    static const std::size_t npos = ~std::size_t(0);
+        // Value used, as a length, to mean "until the end of the rope".
+
+    // CREATORS
+    explicit Rope(bslma::Allocator *basicAllocator = 0);
+        // Create an empty rope.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit Rope(const StringRef&  string,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create a rope having the value of the specified 'string'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    Rope(const Rope& original, bslma::Allocator *basicAllocator = 0);
+        // Create a rope having the value of the specified 'original' rope,
+        // sharing its chunks.  Optionally specify a 'basicAllocator' used to
+        // supply memory for the nodes subsequently created by this rope.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that this operation takes constant time, and does not
+        // allocate memory.
+
+    ~Rope();
+        // Destroy this object, releasing its reference to the chunks it
+        // holds.
+
+    // MANIPULATORS
+    Rope& operator=(const Rope& rhs);
+        // Assign to this rope the value of the specified 'rhs' rope, sharing
+        // its chunks, and return a reference providing modifiable access to
+        // this rope.  Note that this operation takes constant time, and does
+        // not allocate memory.
+
+    void append(const StringRef& string);
+        // Append a copy of the specified 'string' to this rope.
+
+    void append(const Rope& rope);
+        // Append the value of the specified 'rope' to this rope, sharing the
+        // chunks of 'rope'.
+
+    void clear();
+        // Make this rope empty.
+
+    void erase(std::size_t position, std::size_t numChars = npos);
+        // Remove from this rope the specified 'numChars' characters starting
+        // at the specified 'position', or the characters from 'position' to
+        // the end of this rope if 'numChars' is 'npos' or exceeds
+        // 'length() - position'.  The behavior is undefined unless
+        // 'position <= length()'.
+
+    void insert(std::size_t position, const StringRef& string);
+        // Insert a copy of the specified 'string' into this rope before the
+        // character at the specified 'position'.  The behavior is undefined
+        // unless 'position <= length()'.
+
+    void insert(std::size_t position, const Rope& rope);
+        // Insert the value of the specified 'rope' into this rope before the
+        // character at the specified 'position', sharing the chunks of
+        // 'rope'.  The behavior is undefined unless 'position <= length()'.
+
+    void prepend(const StringRef& string);
+        // Prepend a copy of the specified 'string' to this rope.
+
+    void prepend(const Rope& rope);
+        // Prepend the value of the specified 'rope' to this rope, sharing the
+        // chunks of 'rope'.
+
+    void swap(Rope& other);
+        // Efficiently exchange the value of this object with the value of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    char operator[](std::size_t position) const;
+        // Return the character at the specified 'position' in this rope.  The
+        // behavior is undefined unless 'position < length()'.
+
+    bslma::Allocator *allocator() const;
+        // Return the address of the allocator used by this rope to supply
+        // memory.
+
+    int compare(const Rope& other) const;
+    int compare(const StringRef& other) const;
+        // Return a negative value if this rope is lexicographically less than
+        // the specified 'other' string, 0 if they have the same value, and a
+        // positive value otherwise.  Characters are compared as
+        // 'unsigned char's.
+
+    std::size_t copy(char        *result,
+                     std::size_t  numChars,
+                     std::size_t  position = 0) const;
+        // Copy to the specified 'result' buffer the specified 'numChars'
+        // characters of this rope starting at the optionally specified
+        // 'position', or the characters from 'position' to the end of this
+        // rope if 'numChars' exceeds 'length() - position', and return the
+        // number of characters copied.  The behavior is undefined unless
+        // 'position <= length()' and 'result' has room for the characters
+        // copied.  Note that 'result' is not null-terminated.
+
+    bool empty() const;
+        // Return 'true' if this rope has length 0, and 'false' otherwise.
+
+    void flatten(bsl::string *result) const;
+        // Load into the specified 'result' the characters of this rope.
+
+    std::size_t length() const;
+        // Return the number of characters in this rope.
+
+    std::size_t numChunks() const;
+        // Return the number of chunks visited by a 'RopeChunkIterator' over
+        // this rope.  Note that this operation takes time proportional to the
+        // number of chunks.
+
+    bsl::string str() const;
+        // Return a string holding the characters of this rope.
+
+    Rope substr(std::size_t position = 0, std::size_t numChars = npos) const;
+        // Return a rope, using the allocator of this rope, having the value
+        // of the specified 'numChars' characters of this rope starting at the
+        // specified 'position', or of the characters from 'position' to the
+        // end of this rope if 'numChars' is 'npos' or exceeds
+        // 'length() - position'.  The chunks of the returned rope are shared
+        // with this rope.  The behavior is undefined unless
+        // 'position <= length()'.
+};
+
+// FREE OPERATORS
+bool operator==(const Rope& lhs, const Rope& rhs);
+bool operator==(const Rope& lhs, const StringRef& rhs);
+bool operator==(const StringRef& lhs, const Rope& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings have the same
+    // value, and 'false' otherwise.  Two strings have the same value if they
+    // have the same length, and the same character at each position.
+
+bool operator!=(const Rope& lhs, const Rope& rhs);
+bool operator!=(const Rope& lhs, const StringRef& rhs);
+bool operator!=(const StringRef& lhs, const Rope& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings do not have the
+    // same value, and 'false' otherwise.  Two strings do not have the same
+    // value if they do not have the same length, or differ in the character
+    // at some position.
+
+std::ostream& operator<<(std::ostream& stream, const Rope& rope);
+    // Write the characters of the specified 'rope' to the specified 'stream'
+    // and return a reference to 'stream'.
+
+// FREE FUNCTIONS
+void swap(Rope& a, Rope& b);
+    // Exchange the values of the specified 'a' and 'b' ropes.  The behavior
+    // is undefined unless 'a' and 'b' were created with the same allocator.
+
+                          // =======================
+                          // class RopeChunkIterator
+                          // =======================
+
+class RopeChunkIterator {
+    // This class provides an iterator over the chunks of a 'Rope', in order.
+    // Each chunk is a non-empty, contiguous sequence of characters of the
+    // rope.  The behavior is undefined if the rope is modified or destroyed
+    // while it is being iterated over.
+
+    // DATA
+    const Rope_Node *d_root_p;    // root of the rope iterated over
+    std::size_t      d_position;  // position of the current chunk
+    StringRef        d_chunk;     // current chunk (empty at the end)
+
+    // PRIVATE MANIPULATORS
+    void findChunk();
+        // Load into 'd_chunk' the chunk holding the character at
+        // 'd_position', or an empty chunk if 'd_position' is the length of
+        // the rope.
+
+  public:
+    // CREATORS
+    explicit RopeChunkIterator(const Rope& rope);
+        // Create an iterator referring to the first chunk of the specified
+        // 'rope', or an invalid iterator if 'rope' is empty.
+
+    //! RopeChunkIterator(const RopeChunkIterator& original) = default;
+    //! ~RopeChunkIterator() = default;
+
+    // MANIPULATORS
+    //! RopeChunkIterator& operator=(const RopeChunkIterator& rhs) = default;
+
+    RopeChunkIterator& operator++();
+        // Advance this iterator to the next chunk, and return a reference
+        // providing modifiable access to this iterator.  The behavior is
+        // undefined unless this iterator is valid.  Note that this operation
+        // takes time logarithmic in the number of chunks.
+
+    // ACCESSORS
+    const StringRef& chunk() const;
+        // Return a reference to the current chunk.  The behavior is undefined
+        // unless this iterator is valid.
+
+    bool isValid() const;
+        // Return 'true' if this iterator refers to a chunk, and 'false' if it
+        // has been advanced past the last chunk.
+
+    std::size_t position() const;
+        // Return the position, in the rope, of the first character of the
+        // current chunk (or the length of the rope if this iterator is not
+        // valid).
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                                // ----------
+                                // class Rope
+                                // ----------
+
+// CREATORS
+inline
+Rope::Rope(bslma::Allocator *basicAllocator)
+: d_root_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+inline
+Rope::Rope(const Rope& original, bslma::Allocator *basicAllocator)
+: d_root_p(original.d_root_p)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (d_root_p) {
+        bsls::AtomicOperations::addIntNvRelaxed(&d_root_p->d_refCount, 1);
+    }
+}
+
+inline
+Rope::~Rope()
+{
+    assignRoot(0);
+}
+
+// MANIPULATORS
+inline
+Rope& Rope::operator=(const Rope& rhs)
+{
+    if (rhs.d_root_p) {
+        bsls::AtomicOperations::addIntNvRelaxed(&rhs.d_root_p->d_refCount, 1);
+    }
+    assignRoot(rhs.d_root_p);
+    return *this;
+}
+
+inline
+void Rope::clear()
+{
+    assignRoot(0);
+}
+
+inline
+void Rope::swap(Rope& other)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == other.d_allocator_p);
+
+    Rope_Node *root = d_root_p;
+    d_root_p        = other.d_root_p;
+    other.d_root_p  = root;
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *Rope::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bool Rope::empty() const
+{
+    return 0 == d_root_p;
+}
+
+inline
+std::size_t Rope::length() const
+{
+    return d_root_p ? d_root_p->d_length : 0;
+}
+
+                          // -----------------------
+                          // class RopeChunkIterator
+                          // -----------------------
+
+// CREATORS
+inline
+RopeChunkIterator::RopeChunkIterator(const Rope& rope)
+: d_root_p(rope.d_root_p)
+, d_position(0)
+, d_chunk()
+{
+    findChunk();
+}
+
+// MANIPULATORS
+inline
+RopeChunkIterator& RopeChunkIterator::operator++()
+{
+    BSLS_ASSERT_SAFE(isValid());
+
+    d_position += d_chunk.length();
+    findChunk();
+    return *this;
+}
+
+// ACCESSORS
+inline
+const StringRef& RopeChunkIterator::chunk() const
+{
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_chunk;
+}
+
+inline
+bool RopeChunkIterator::isValid() const
+{
+    return !d_chunk.isEmpty();
+}
+
+inline
+std::size_t RopeChunkIterator::position() const
+{
+    return d_position;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bslstl::operator==(const Rope& lhs, const Rope& rhs)
+{
+    return lhs.length() == rhs.length() && 0 == lhs.compare(rhs);
+}
+
+inline
+bool bslstl::operator==(const Rope& lhs, const StringRef& rhs)
+{
+    return lhs.length() == static_cast<std::size_t>(rhs.length())
+        && 0 == lhs.compare(rhs);
+}
+
+inline
+bool bslstl::operator==(const StringRef& lhs, const Rope& rhs)
+{
+    return rhs == lhs;
+}
+
+inline
+bool bslstl::operator!=(const Rope& lhs, const Rope& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool bslstl::operator!=(const Rope& lhs, const StringRef& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool bslstl::operator!=(const StringRef& lhs, const Rope& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+inline
+void bslstl::swap(Rope& a, Rope& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
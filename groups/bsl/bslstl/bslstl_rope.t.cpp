@@ -0,0 +1,1329 @@
+// bslstl_rope.t.cpp                                                  -*-C++-*-
+#include <bslstl_rope.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslma_testallocatormonitor.h>    // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+
+#include <sstream>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::Rope' is a value-semantic type whose value is a sequence of
+// 'char's, and whose representation is a tree of shared nodes.  Each
+// manipulator is tested by applying it, in sequences of operations generated
+// pseudo-randomly, both to a rope and to a 'bsl::string' model, and verifying
+// after each operation that the rope has the value of the model when
+// observed through each accessor ('operator[]', 'copy', 'flatten', and a
+// 'RopeChunkIterator').  Sharing is tested by verifying that copies of a rope,
+// and ropes built from parts of it, are unaffected by subsequent modification
+// of the rope, and that copying does not allocate.  The balance of the tree is
+// tested indirectly, by building ropes from long sequences of operations that
+// would otherwise create trees too deep to destroy recursively.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit Rope(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit Rope(const StringRef& string, Allocator *ba = 0);
+// [ 4] Rope(const Rope& original, bslma::Allocator *basicAllocator = 0);
+// [ 2] ~Rope();
+//
+// MANIPULATORS
+// [ 4] Rope& operator=(const Rope& rhs);
+// [ 2] void append(const StringRef& string);
+// [ 3] void append(const Rope& rope);
+// [ 2] void clear();
+// [ 3] void erase(std::size_t position, std::size_t numChars = npos);
+// [ 3] void insert(std::size_t position, const StringRef& string);
+// [ 3] void insert(std::size_t position, const Rope& rope);
+// [ 3] void prepend(const StringRef& string);
+// [ 3] void prepend(const Rope& rope);
+// [ 4] void swap(Rope& other);
+//
+// ACCESSORS
+// [ 2] char operator[](std::size_t position) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 5] int compare(const Rope& other) const;
+// [ 5] int compare(const StringRef& other) const;
+// [ 2] std::size_t copy(char *result, size_t numChars, size_t pos = 0) const;
+// [ 2] bool empty() const;
+// [ 2] void flatten(bsl::string *result) const;
+// [ 2] std::size_t length() const;
+// [ 6] std::size_t numChunks() const;
+// [ 2] bsl::string str() const;
+// [ 3] Rope substr(size_t position = 0, size_t numChars = npos) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const Rope& lhs, const Rope& rhs);
+// [ 5] bool operator==(const Rope& lhs, const StringRef& rhs);
+// [ 5] bool operator==(const StringRef& lhs, const Rope& rhs);
+// [ 5] bool operator!=(const Rope& lhs, const Rope& rhs);
+// [ 5] bool operator!=(const Rope& lhs, const StringRef& rhs);
+// [ 5] bool operator!=(const StringRef& lhs, const Rope& rhs);
+// [ 5] std::ostream& operator<<(std::ostream& stream, const Rope& rope);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(Rope& a, Rope& b);
+//
+// RopeChunkIterator
+// [ 6] explicit RopeChunkIterator(const Rope& rope);
+// [ 6] RopeChunkIterator& operator++();
+// [ 6] const StringRef& chunk() const;
+// [ 6] bool isValid() const;
+// [ 6] std::size_t position() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCERN: Long sequences of operations keep the tree balanced.
+// [ 7] CONCERN: Manipulators are exception-neutral.
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: BUILDING AND SPLICING STRINGS
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::Rope              Obj;
+typedef bslstl::RopeChunkIterator ChunkIterator;
+typedef bslstl::StringRef         StringRef;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                              // ============
+                              // class Random
+                              // ============
+
+class Random {
+    // This class provides a deterministic pseudo-random number generator.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    std::size_t operator()(std::size_t limit)
+        // Return a pseudo-random number in the range '[0, limit)'.  The
+        // behavior is undefined unless '0 < limit'.
+    {
+        d_state = d_state * 1103515245 + 12345;
+        return (d_state >> 8) % limit;
+    }
+};
+
+static
+bsl::string makeString(Random& random, std::size_t length)
+    // Return a string, using the default allocator, of the specified
+    // 'length', having characters (including null characters) generated by
+    // the specified 'random'.
+{
+    bsl::string result(length, '\0');
+    for (std::size_t i = 0; i < length; ++i) {
+        result[i] = static_cast<char>(random(256));
+    }
+    return result;
+}
+
+static
+bool verify(const Obj& object, const bsl::string& expected, int line)
+    // Return 'true' if the specified 'object' has the value of the specified
+    // 'expected' string, as observed through each of its accessors, and
+    // 'false' otherwise, reporting any difference against the specified
+    // 'line'.
+{
+    bool result = true;
+
+    if (object.length() != expected.length()) {
+        ASSERTV(line, object.length(), expected.length(), false);
+        return false;                                                 // RETURN
+    }
+    if (object.empty() != expected.empty()) {
+        ASSERTV(line, false);
+        result = false;
+    }
+
+    for (std::size_t i = 0; i < expected.length(); i += 1 + i / 8) {
+        if (object[i] != expected[i]) {
+            ASSERTV(line, i, false);
+            result = false;
+            break;
+        }
+    }
+
+    bsl::string flattened("garbage");
+    object.flatten(&flattened);
+    if (flattened != expected) {
+        ASSERTV(line, false);
+        result = false;
+    }
+
+    bsl::string chunks;
+    std::size_t numChunks = 0;
+    for (ChunkIterator it(object); it.isValid(); ++it) {
+        if (it.position() != chunks.length() || it.chunk().isEmpty()) {
+            ASSERTV(line, it.position(), chunks.length(), false);
+            result = false;
+        }
+        chunks.append(it.chunk().begin(), it.chunk().end());
+        ++numChunks;
+    }
+    if (chunks != expected || numChunks != object.numChunks()) {
+        ASSERTV(line, numChunks, object.numChunks(), false);
+        result = false;
+    }
+
+    const std::size_t POSITION = expected.length() / 3;
+    const std::size_t NUM      = expected.length() / 2;
+    bsl::string       copied(NUM + 1, 'X');
+    if (NUM != object.copy(&copied[0], NUM, POSITION)
+     || 'X' != copied[NUM]
+     || 0 != expected.compare(POSITION, NUM, copied, 0, NUM)) {
+        ASSERTV(line, false);
+        result = false;
+    }
+
+    return result;
+}
+
+#define VERIFY(OBJECT, EXPECTED) verify(OBJECT, EXPECTED, __LINE__)
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Assembling a Message Payload
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we assemble a large message from a header, a number of records,
+// and a trailer, and that the length of the records, which is known only when
+// all of them have been added, must be spliced in after the header.
+//
+// First, we create a rope and append the header and the records:
+//..
+    bslma::TestAllocator ta;
+    bslstl::Rope         payload(&ta);
+
+    payload.append("<msg len=>");
+    for (int i = 0; i < 1000; ++i) {
+        payload.append("<record/>");
+    }
+    payload.append("</msg>");
+
+    ASSERT(10 + 9000 + 6 == payload.length());
+//..
+// Then, we splice the length of the records into the header.  Note that the
+// characters of the records are not copied:
+//..
+    payload.insert(9, "9000");
+
+    ASSERT(payload.substr(0, 23) == "<msg len=9000><record/>");
+//..
+// Next, we write the payload one chunk at a time, as we would fill the
+// buffers of a scatter-gather write:
+//..
+    bsl::string written;
+    for (bslstl::RopeChunkIterator it(payload); it.isValid(); ++it) {
+        written.append(it.chunk().begin(), it.chunk().end());
+    }
+    ASSERT(payload == written);
+//..
+// Finally, we flatten the trailer of the payload into a 'bsl::string':
+//..
+    bsl::string trailer;
+    payload.substr(payload.length() - 15).flatten(&trailer);
+
+    ASSERT("<record/></msg>" == trailer);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: BALANCE AND EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 Long sequences of appends, prepends, and inserts of strings too
+        //:   long to be merged into a single leaf keep the tree balanced, so
+        //:   that the rope can be accessed, and destroyed, without exhausting
+        //:   the stack.
+        //:
+        //: 2 Appending many short strings creates chunks of a few kilobytes.
+        //:
+        //: 3 If an allocation fails, the manipulators leave the rope (and the
+        //:   ropes sharing its nodes) unchanged, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Build ropes from 100,000 operations of each kind, verifying the
+        //:   value, and the number of chunks, of the result.  (C-1..2)
+        //:
+        //: 2 Apply each manipulator within the 'bslma' exception test macros,
+        //:   and verify the value of the rope, and of a copy of it made
+        //:   beforehand, and the memory in use, afterwards.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Long sequences of operations keep the tree balanced.
+        //   CONCERN: Manipulators are exception-neutral.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: BALANCE AND EXCEPTION NEUTRALITY"
+                            "\n=========================================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int   N = 100000;
+        const char *CHUNK =
+                         "0123456789012345678901234567890123456789"
+                         "0123456789012345678901234567890123456789"
+                         "0123456789012345678901234567890123456789"
+                         "0123456789012345678901234567890123456789"
+                         "0123456789012345678901234567890123456789";
+        const std::size_t CHUNK_LENGTH = strlen(CHUNK);
+
+        if (verbose) printf("\tMany appends of short strings.\n");
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.append(StringRef(CHUNK + i % 10, 10));
+            }
+            ASSERT(10 * N == X.length());
+            ASSERTV(X.numChunks(), X.numChunks() <= 10 * N / 4000 + 20);
+            ASSERT('6' == X[10 * N - 3]);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tMany appends, prepends, and inserts.\n");
+        {
+            Obj mA(&ta);  const Obj& A = mA;
+            Obj mP(&ta);  const Obj& P = mP;
+            Obj mI(&ta);  const Obj& I = mI;
+            Obj mR(&ta);  const Obj& R = mR;
+
+            const Obj LONG(StringRef(CHUNK), &ta);
+
+            Random random(7);
+            for (int i = 0; i < N; ++i) {
+                mA.append(LONG);
+                mP.prepend(StringRef(CHUNK));
+                mI.insert(I.length() / 2, StringRef(CHUNK));
+                mR.insert(CHUNK_LENGTH * random(i + 1), LONG);
+            }
+
+            const std::size_t LENGTH = N * CHUNK_LENGTH;
+            ASSERT(LENGTH == A.length());
+            ASSERT(LENGTH == P.length());
+            ASSERT(LENGTH == I.length());
+            ASSERT(LENGTH == R.length());
+
+            ASSERT(A == P);
+            ASSERT(A == I);
+            ASSERT(A == R);
+            ASSERT(A.substr(LENGTH - 50) == StringRef(CHUNK + 150));
+
+            // Erase the second half of the chunks, one at a time.
+
+            for (int i = 0; i < N / 2; ++i) {
+                mI.erase(CHUNK_LENGTH * (N / 2), CHUNK_LENGTH);
+            }
+            ASSERT(A.substr(0, LENGTH / 2) == I);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tException neutrality.\n");
+        {
+            Random random(11);
+
+            for (int ti = 0; ti < 20; ++ti) {
+                const bsl::string VALUE = makeString(random, 100 * ti);
+                const bsl::string OTHER = makeString(random, 17 * ti + 1);
+
+                Obj mX(&ta);  const Obj& X = mX;
+                for (std::size_t i = 0; i < VALUE.length(); i += 37) {
+                    mX.append(StringRef(VALUE.data() + i,
+                                        VALUE.length() - i < 37
+                                        ? VALUE.length() - i
+                                        : 37));
+                }
+
+                const Obj          COPY(X, &ta);
+                const Obj          Y(StringRef(OTHER), &ta);
+                const std::size_t  POS = VALUE.length() / 3;
+                const bsls::Types::Int64 BLOCKS = ta.numBlocksInUse();
+
+                for (int op = 0; op < 6; ++op) {
+                    bsl::string expected(VALUE);
+                    switch (op) {
+                      case 0: expected.append(OTHER);                 break;
+                      case 1: expected.insert(0, OTHER);              break;
+                      case 2: expected.insert(POS, OTHER);            break;
+                      case 3: expected.insert(POS, OTHER);            break;
+                      case 4: expected.erase(POS, VALUE.length() / 2); break;
+                      case 5: expected.append(OTHER);                 break;
+                    }
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                        Obj mZ(X, &ta);  const Obj& Z = mZ;
+
+                        switch (op) {
+                          case 0: mZ.append(StringRef(OTHER));        break;
+                          case 1: mZ.prepend(StringRef(OTHER));       break;
+                          case 2: mZ.insert(POS, StringRef(OTHER));   break;
+                          case 3: mZ.insert(POS, Y);                  break;
+                          case 4: mZ.erase(POS, VALUE.length() / 2);  break;
+                          case 5: mZ.append(Y);                       break;
+                        }
+                        ASSERTV(ti, op, VERIFY(Z, expected));
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(ti, op, VERIFY(X, VALUE));
+                    ASSERTV(ti, op, VERIFY(COPY, VALUE));
+                    ASSERTV(ti, op, BLOCKS == ta.numBlocksInUse());
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'RopeChunkIterator' AND 'numChunks'
+        //
+        // Concerns:
+        //: 1 An iterator over an empty rope is not valid.
+        //:
+        //: 2 The chunks of a rope are non-empty, are visited in order, and
+        //:   their concatenation is the value of the rope.  'position'
+        //:   reports the position of each chunk.
+        //:
+        //: 3 'numChunks' returns the number of chunks visited.
+        //:
+        //: 4 Chunks refer to the characters stored in the rope: iterating does
+        //:   not copy characters or allocate memory.
+        //
+        // Plan:
+        //: 1 Iterate over an empty rope.  (C-1)
+        //:
+        //: 2 Iterate over ropes built by sequences of appends of strings of
+        //:   various lengths, and verify the chunks, their positions, and the
+        //:   memory allocated.  (C-2..4)
+        //
+        // Testing:
+        //   explicit RopeChunkIterator(const Rope& rope);
+        //   RopeChunkIterator& operator++();
+        //   const StringRef& chunk() const;
+        //   bool isValid() const;
+        //   std::size_t position() const;
+        //   std::size_t numChunks() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'RopeChunkIterator' AND 'numChunks'"
+                            "\n===========================================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            const Obj X(&ta);
+            ChunkIterator it(X);
+            ASSERT(!it.isValid());
+            ASSERT(0 == it.position());
+            ASSERT(0 == X.numChunks());
+        }
+
+        const int LENGTHS[] = { 1, 5, 100, 129, 1000, 5000, 70000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        Random random(3);
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            for (int numParts = 1; numParts <= 20; numParts += 3) {
+                Obj mX(&ta);  const Obj& X = mX;
+                bsl::string expected;
+
+                for (int part = 0; part < numParts; ++part) {
+                    const bsl::string S = makeString(random, LENGTH);
+                    if (part % 2) {
+                        mX.append(StringRef(S));
+                        expected.append(S);
+                    }
+                    else {
+                        mX.append(Obj(StringRef(S), &ta));
+                        expected.append(S);
+                    }
+                }
+
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                bsl::string concatenation;
+                std::size_t numChunks = 0;
+                for (ChunkIterator it(X); it.isValid(); ++it) {
+                    ASSERTV(LENGTH, numParts, !it.chunk().isEmpty());
+                    ASSERTV(LENGTH, numParts,
+                            concatenation.length() == it.position());
+                    concatenation.append(it.chunk().begin(), it.chunk().end());
+                    ++numChunks;
+                }
+                ASSERTV(LENGTH, numParts, expected == concatenation);
+                ASSERTV(LENGTH, numParts, numChunks == X.numChunks());
+                ASSERTV(LENGTH, numParts, tam.isTotalSame());
+
+                // Chunks refer to the characters of 'X', which are also those
+                // of a copy of 'X'.
+
+                const Obj     Y(X, &ta);
+                ChunkIterator xi(X);
+                ChunkIterator yi(Y);
+                for (; xi.isValid(); ++xi, ++yi) {
+                    ASSERTV(LENGTH, numParts,
+                            xi.chunk().data() == yi.chunk().data());
+                }
+                ASSERTV(LENGTH, numParts, !yi.isValid());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING COMPARISON AND OUTPUT
+        //
+        // Concerns:
+        //: 1 'compare' returns a negative value, 0, or a positive value as the
+        //:   rope is lexicographically less than, equal to, or greater than
+        //:   its argument, comparing characters as 'unsigned char's, for any
+        //:   division of the ropes into chunks.
+        //:
+        //: 2 The equality operators compare values.
+        //:
+        //: 3 'operator<<' writes the characters of the rope.
+        //
+        // Plan:
+        //: 1 For each pair of values in a table, build ropes from the values
+        //:   in chunks of several sizes, and compare them with each other and
+        //:   with the values, verifying the results against those of
+        //:   'bsl::string::compare'.  (C-1..2)
+        //:
+        //: 2 Write ropes to a 'std::ostringstream'.  (C-3)
+        //
+        // Testing:
+        //   int compare(const Rope& other) const;
+        //   int compare(const StringRef& other) const;
+        //   bool operator==(const Rope& lhs, const Rope& rhs);
+        //   bool operator==(const Rope& lhs, const StringRef& rhs);
+        //   bool operator==(const StringRef& lhs, const Rope& rhs);
+        //   bool operator!=(const Rope& lhs, const Rope& rhs);
+        //   bool operator!=(const Rope& lhs, const StringRef& rhs);
+        //   bool operator!=(const StringRef& lhs, const Rope& rhs);
+        //   std::ostream& operator<<(std::ostream& stream, const Rope& rope);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING COMPARISON AND OUTPUT"
+                            "\n=============================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const char *VALUES[] = {
+            "",
+            "a",
+            "ab",
+            "abc",
+            "abd",
+            "b",
+            "\xff",
+            "a\xff",
+            "abcdefghijklmnopqrstuvwxyz",
+            "abcdefghijklmnopqrstuvwxyZ",
+            "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz",
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        const std::size_t PIECES[] = { 1, 2, 3, 7, 100 };
+        const int NUM_PIECES = sizeof PIECES / sizeof *PIECES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const bsl::string U(VALUES[i]);
+
+            for (int pi = 0; pi < NUM_PIECES; ++pi) {
+                // Build 'X' from pieces that are not merged into one leaf.
+
+                Obj mX(&ta);  const Obj& X = mX;
+                for (std::size_t k = 0; k < U.length(); k += PIECES[pi]) {
+                    mX.insert(X.length(),
+                              Obj(StringRef(U).substr(k, PIECES[pi]), &ta));
+                }
+                ASSERTV(i, pi, VERIFY(X, U));
+
+                for (int j = 0; j < NUM_VALUES; ++j) {
+                    const bsl::string V(VALUES[j]);
+                    const Obj         Y(StringRef(V), &ta);
+
+                    const int EXP = U.compare(V) < 0 ? -1
+                                  : U.compare(V) > 0 ?  1
+                                  :                     0;
+
+                    const int R1 = X.compare(Y);
+                    const int R2 = X.compare(StringRef(V));
+                    ASSERTV(i, j, pi, EXP, R1,
+                            EXP == (R1 < 0 ? -1 : R1 > 0 ? 1 : 0));
+                    ASSERTV(i, j, pi, EXP, R2,
+                            EXP == (R2 < 0 ? -1 : R2 > 0 ? 1 : 0));
+
+                    ASSERTV(i, j, pi, (i == j) == (X == Y));
+                    ASSERTV(i, j, pi, (i != j) == (X != Y));
+                    ASSERTV(i, j, pi, (i == j) == (X == StringRef(V)));
+                    ASSERTV(i, j, pi, (i != j) == (X != StringRef(V)));
+                    ASSERTV(i, j, pi, (i == j) == (StringRef(V) == X));
+                    ASSERTV(i, j, pi, (i != j) == (StringRef(V) != X));
+                }
+
+                std::ostringstream stream;
+                stream << X;
+                ASSERTV(i, pi, stream.str() == VALUES[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 Copy construction and assignment give the value of the source,
+        //:   and do not allocate memory.
+        //:
+        //: 2 The copy uses the allocator supplied at its construction (or the
+        //:   default allocator) for the nodes it subsequently creates.
+        //:
+        //: 3 Modifying a rope (including appending into the spare capacity of
+        //:   its last chunk) does not affect its copies, or ropes holding
+        //:   parts of it, and vice versa.
+        //:
+        //: 4 Self-assignment, and assignment of an empty rope, are supported.
+        //:
+        //: 5 'swap' exchanges the values of the ropes without allocating.
+        //
+        // Plan:
+        //: 1 Copy, and assign, ropes of several lengths, and verify the values
+        //:   and the memory allocated.  (C-1..2, 4)
+        //:
+        //: 2 Copy a rope, and take a substring of it, then append to and erase
+        //:   from the rope and the copies in turn, verifying all the values
+        //:   after each modification.  (C-3)
+        //:
+        //: 3 Swap ropes, using the member and free functions.  (C-5)
+        //
+        // Testing:
+        //   Rope(const Rope& original, bslma::Allocator *basicAllocator = 0);
+        //   Rope& operator=(const Rope& rhs);
+        //   void swap(Rope& other);
+        //   void swap(Rope& a, Rope& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING COPY, ASSIGNMENT, AND SWAP"
+                            "\n==================================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator tb("other", veryVeryVerbose);
+
+        Random random(5);
+
+        if (verbose) printf("\tCopy construction and assignment.\n");
+
+        for (int length = 0; length < 20000; length = length * 3 + 1) {
+            const bsl::string VALUE = makeString(random, length);
+
+            Obj mX(&ta);  const Obj& X = mX;
+            for (int i = 0; i < length; i += 50) {
+                mX.append(StringRef(VALUE.data() + i,
+                                    length - i < 50 ? length - i : 50));
+            }
+            ASSERTV(length, VERIFY(X, VALUE));
+
+            bslma::TestAllocatorMonitor tam(&ta);
+            bslma::TestAllocatorMonitor tbm(&tb);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            const Obj Y(X);
+            const Obj Z(X, &tb);
+            Obj       mW(&tb);  const Obj& W = mW;
+            mW = X;
+
+            ASSERTV(length, tam.isTotalSame());
+            ASSERTV(length, tbm.isTotalSame());
+            ASSERTV(length, dam.isTotalSame());
+
+            ASSERTV(length, &defaultAllocator == Y.allocator());
+            ASSERTV(length, &tb == Z.allocator());
+            ASSERTV(length, &tb == W.allocator());
+
+            ASSERTV(length, VERIFY(Y, VALUE));
+            ASSERTV(length, VERIFY(Z, VALUE));
+            ASSERTV(length, VERIFY(W, VALUE));
+
+            // Self-assignment, and assignment of an empty rope.
+
+            mW = W;
+            ASSERTV(length, VERIFY(W, VALUE));
+
+            mW = Obj(&ta);
+            ASSERTV(length, VERIFY(W, ""));
+            ASSERTV(length, VERIFY(X, VALUE));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+
+        if (verbose) printf("\tIndependence of shared ropes.\n");
+
+        for (int length = 1; length < 20000; length = length * 3 + 1) {
+            const bsl::string VALUE = makeString(random, length);
+            const bsl::string EXTRA = makeString(random, 10);
+
+            bsl::string expectedX(VALUE);
+            bsl::string expectedY(VALUE);
+            bsl::string expectedS(VALUE, length / 2);
+
+            // Build 'X' by short appends, so that its last leaf has spare
+            // capacity.
+
+            Obj mX(&ta);  const Obj& X = mX;
+            for (int i = 0; i < length; ++i) {
+                mX.append(StringRef(VALUE.data() + i, 1));
+            }
+
+            Obj mY(X, &ta);                     const Obj& Y = mY;
+            Obj mS(X.substr(length / 2), &ta);  const Obj& S = mS;
+
+            for (int round = 0; round < 3; ++round) {
+                mX.append(StringRef(EXTRA));
+                expectedX.append(EXTRA);
+                ASSERTV(length, round, VERIFY(X, expectedX));
+                ASSERTV(length, round, VERIFY(Y, expectedY));
+                ASSERTV(length, round, VERIFY(S, expectedS));
+
+                mY.append(StringRef(EXTRA.data(), round + 1));
+                expectedY.append(EXTRA.data(), round + 1);
+                ASSERTV(length, round, VERIFY(X, expectedX));
+                ASSERTV(length, round, VERIFY(Y, expectedY));
+                ASSERTV(length, round, VERIFY(S, expectedS));
+
+                mS.append(StringRef(EXTRA.data(), 3));
+                expectedS.append(EXTRA.data(), 3);
+                mX.erase(0, 1);
+                expectedX.erase(0, 1);
+                ASSERTV(length, round, VERIFY(X, expectedX));
+                ASSERTV(length, round, VERIFY(Y, expectedY));
+                ASSERTV(length, round, VERIFY(S, expectedS));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX(StringRef("hello"), &ta);  const Obj& X = mX;
+            Obj mY(StringRef("world!"), &ta);  const Obj& Y = mY;
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            mX.swap(mY);
+            ASSERT(X == "world!");
+            ASSERT(Y == "hello");
+
+            swap(mX, mY);
+            ASSERT(X == "hello");
+            ASSERT(Y == "world!");
+
+            ASSERT(tam.isTotalSame());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING SPLICING MANIPULATORS AND 'substr'
+        //
+        // Concerns:
+        //: 1 'insert', 'prepend', 'append' (of a rope), 'erase', and 'substr'
+        //:   produce the values produced by the corresponding operations on
+        //:   'bsl::string', at every position, including the ends.
+        //:
+        //: 2 'erase' and 'substr' accept 'npos', and lengths exceeding the
+        //:   remainder of the rope.
+        //:
+        //: 3 A rope can be inserted into itself.
+        //:
+        //: 4 'substr' returns a rope using the allocator of this rope, and
+        //:   does not copy long runs of characters.
+        //:
+        //: 5 Precondition violations are detected in appropriate build
+        //:   modes.
+        //
+        // Plan:
+        //: 1 Apply long pseudo-random sequences of the operations to a rope
+        //:   and to a 'bsl::string' model, and verify the value after each
+        //:   operation.  (C-1..3)
+        //:
+        //: 2 Take substrings of a long rope, and verify the memory allocated.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid positions.  (C-5)
+        //
+        // Testing:
+        //   void append(const Rope& rope);
+        //   void erase(std::size_t position, std::size_t numChars = npos);
+        //   void insert(std::size_t position, const StringRef& string);
+        //   void insert(std::size_t position, const Rope& rope);
+        //   void prepend(const StringRef& string);
+        //   void prepend(const Rope& rope);
+        //   Rope substr(size_t position = 0, size_t numChars = npos) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SPLICING MANIPULATORS AND 'substr'"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) printf("\tRandom sequences of operations.\n");
+
+        const std::size_t MAX_LENGTHS[] = { 2, 10, 200, 5000 };
+        const int NUM_MAX_LENGTHS = sizeof MAX_LENGTHS / sizeof *MAX_LENGTHS;
+
+        for (int ti = 0; ti < NUM_MAX_LENGTHS; ++ti) {
+            const std::size_t MAX_LENGTH = MAX_LENGTHS[ti];
+
+            Random      random(static_cast<unsigned int>(ti));
+            Obj         mX(&ta);  const Obj& X = mX;
+            bsl::string expected;
+
+            for (int i = 0; i < 2000; ++i) {
+                const int         OP       = static_cast<int>(random(9));
+                const std::size_t POSITION = random(expected.length() + 1);
+                const std::size_t LENGTH   = random(MAX_LENGTH + 1);
+                const bsl::string S        = makeString(random, LENGTH);
+
+                switch (OP) {
+                  case 0: {
+                    mX.insert(POSITION, StringRef(S));
+                    expected.insert(POSITION, S);
+                  } break;
+                  case 1: {
+                    mX.insert(POSITION, Obj(StringRef(S), &ta));
+                    expected.insert(POSITION, S);
+                  } break;
+                  case 2: {
+                    mX.prepend(StringRef(S));
+                    expected.insert(0, S);
+                  } break;
+                  case 3: {
+                    mX.prepend(Obj(StringRef(S), &ta));
+                    expected.insert(0, S);
+                  } break;
+                  case 4: {
+                    mX.append(Obj(StringRef(S), &ta));
+                    expected.append(S);
+                  } break;
+                  case 5: {
+                    mX.erase(POSITION, LENGTH);
+                    expected.erase(POSITION, LENGTH);
+                  } break;
+                  case 6: {
+                    const Obj SUB = X.substr(POSITION, LENGTH);
+                    ASSERTV(ti, i,
+                            VERIFY(SUB, expected.substr(POSITION, LENGTH)));
+                    ASSERTV(ti, i, &ta == SUB.allocator());
+                  } break;
+                  case 7: {
+                    // Insert a part of this rope into itself, keeping the
+                    // length bounded.
+
+                    if (expected.length() < 20 * MAX_LENGTH) {
+                        mX.insert(POSITION, X.substr(0, LENGTH));
+                        expected.insert(POSITION, expected.substr(0, LENGTH));
+                    }
+                    else {
+                        mX.erase(POSITION);
+                        expected.erase(POSITION);
+                    }
+                  } break;
+                  case 8: {
+                    if (expected.length() < 10 * MAX_LENGTH) {
+                        mX.insert(POSITION, X);
+                        expected.insert(POSITION, bsl::string(expected));
+                    }
+                    else {
+                        mX = X.substr(POSITION, MAX_LENGTH);
+                        expected = expected.substr(POSITION, MAX_LENGTH);
+                    }
+                  } break;
+                }
+                if (!VERIFY(X, expected)) {
+                    ASSERTV(ti, i, OP, POSITION, LENGTH, false);
+                    break;
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tEnds and 'npos'.\n");
+        {
+            const Obj X(StringRef("abcdef"), &ta);
+
+            ASSERT(X.substr()     == "abcdef");
+            ASSERT(X.substr(6)    == "");
+            ASSERT(X.substr(2)    == "cdef");
+            ASSERT(X.substr(2, 2) == "cd");
+            ASSERT(X.substr(2, 9) == "cdef");
+            ASSERT(X.substr(0, 0).empty());
+
+            Obj mY(X, &ta);  const Obj& Y = mY;
+            mY.erase(4);
+            ASSERT(Y == "abcd");
+            mY.erase(1, Obj::npos);
+            ASSERT(Y == "a");
+            mY.erase(1);
+            ASSERT(Y == "a");
+            mY.erase(0);
+            ASSERT(Y.empty());
+
+            mY.insert(0, X);
+            mY.insert(6, StringRef("gh"));
+            mY.insert(0, StringRef(""));
+            mY.insert(3, Obj(&ta));
+            ASSERT(Y == "abcdefgh");
+        }
+
+        if (verbose) printf("\tSubstrings share long runs.\n");
+        {
+            Random            random(99);
+            const bsl::string VALUE = makeString(random, 100000);
+            const Obj         X(StringRef(VALUE), &ta);
+
+            bslma::TestAllocatorMonitor tam(&ta);
+            {
+                const Obj Y = X.substr(1000, 90000);
+                ASSERT(VERIFY(Y, VALUE.substr(1000, 90000)));
+            }
+            ASSERTV(ta.numBytesMax(), ta.numBytesMax() < 100000 + 1000);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(StringRef("abc"), &ta);
+
+            ASSERT_PASS(mX.substr(3));
+            ASSERT_FAIL(mX.substr(4));
+
+            ASSERT_PASS(mX.insert(3, StringRef("x")));
+            ASSERT_FAIL(mX.insert(5, StringRef("x")));
+            ASSERT_FAIL(mX.insert(5, Obj(&ta)));
+
+            ASSERT_PASS(mX.erase(4));
+            ASSERT_FAIL(mX.erase(5));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed rope is empty, and does not allocate.
+        //:
+        //: 2 A rope constructed from, or appended with, a string has the value
+        //:   of the string (or of the concatenation), including null
+        //:   characters, as observed by all the basic accessors.
+        //:
+        //: 3 Memory is supplied by the allocator supplied at construction (or
+        //:   by the default allocator), and is released on destruction and by
+        //:   'clear'.
+        //:
+        //: 4 Appending short strings copies them into the spare capacity of
+        //:   the last chunk.
+        //:
+        //: 5 Precondition violations are detected in appropriate build
+        //:   modes.
+        //
+        // Plan:
+        //: 1 Create ropes with and without an allocator, and verify the
+        //:   memory allocated.  (C-1, 3)
+        //:
+        //: 2 For a set of lengths, build ropes by appending pieces of a value
+        //:   of several sizes, and verify the value after each append, and the
+        //:   number of chunks at the end.  (C-2, 4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid positions.  (C-5)
+        //
+        // Testing:
+        //   explicit Rope(bslma::Allocator *basicAllocator = 0);
+        //   explicit Rope(const StringRef& string, Allocator *ba = 0);
+        //   ~Rope();
+        //   void append(const StringRef& string);
+        //   void clear();
+        //   char operator[](std::size_t position) const;
+        //   bslma::Allocator *allocator() const;
+        //   std::size_t copy(char *result, size_t numChars, size_t pos) const;
+        //   bool empty() const;
+        //   void flatten(bsl::string *result) const;
+        //   std::size_t length() const;
+        //   bsl::string str() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PRIMARY MANIPULATORS AND ACCESSORS"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) printf("\tAllocators.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.length());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+            ASSERT(VERIFY(X, ""));
+
+            Obj mY(&ta);  const Obj& Y = mY;
+            ASSERT(&ta == Y.allocator());
+            ASSERT(0 == ta.numBlocksTotal());
+
+            const Obj Z(StringRef(""), &ta);
+            ASSERT(Z.empty());
+            ASSERT(0 == ta.numBlocksTotal());
+
+            mX.append(StringRef("abc"));
+            mY.append(StringRef("abc"));
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+            ASSERT(0 < ta.numBlocksInUse());
+
+            mX.clear();
+            mY.clear();
+            ASSERT(X.empty());
+            ASSERT(Y.empty());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAppending.\n");
+
+        Random random(1);
+
+        const std::size_t PIECES[] = { 1, 3, 100, 129, 4000, 10000 };
+        const int NUM_PIECES = sizeof PIECES / sizeof *PIECES;
+
+        for (int pi = 0; pi < NUM_PIECES; ++pi) {
+            const std::size_t PIECE = PIECES[pi];
+            const std::size_t N     = PIECE < 100 ? 3000 : 30 * PIECE;
+            const bsl::string VALUE = makeString(random, N);
+
+            {
+                const Obj X(StringRef(VALUE), &ta);
+                ASSERTV(PIECE, VERIFY(X, VALUE));
+                ASSERTV(PIECE, 1 == X.numChunks());
+                ASSERTV(PIECE, VALUE == X.str());
+            }
+
+            Obj mX(&ta);  const Obj& X = mX;
+            for (std::size_t k = 0; k < N; k += PIECE) {
+                mX.append(StringRef(VALUE).substr(k, PIECE));
+
+                const std::size_t LENGTH = k + PIECE < N ? k + PIECE : N;
+                if (0 == k % (PIECE * 7) || LENGTH == N) {
+                    ASSERTV(PIECE, k,
+                            VERIFY(X, bsl::string(VALUE, 0, LENGTH)));
+                }
+            }
+
+            // Short appends fill chunks of about 4 kilobytes.
+
+            ASSERTV(PIECE, X.numChunks(),
+                    X.numChunks() <= N / 3000 + N / PIECE / 2 + 13);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            const Obj X(StringRef("abc"), &ta);
+            char      buffer[4];
+
+            ASSERT_SAFE_PASS(X[2]);
+            ASSERT_SAFE_FAIL(X[3]);
+
+            ASSERT_PASS(X.copy(buffer, 1, 3));
+            ASSERT_FAIL(X.copy(buffer, 1, 4));
+            ASSERT_PASS(X.copy(0, 0));
+            ASSERT_FAIL(X.copy(0, 1));
+
+            ASSERT_FAIL(X.flatten(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build, splice, and copy a few ropes.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            mX.append(StringRef("world"));
+            mX.prepend(StringRef("hello "));
+            mX.append(StringRef("!"));
+            ASSERT(X == "hello world!");
+            ASSERT(12 == X.length());
+            ASSERT('w' == X[6]);
+
+            Obj mY(X, &ta);  const Obj& Y = mY;
+            mY.insert(5, StringRef(","));
+            mY.erase(Y.length() - 1);
+            ASSERT(Y == "hello, world");
+            ASSERT(X == "hello world!");
+
+            ASSERT(X.substr(6, 5) == Y.substr(7));
+            ASSERT("world!" == X.substr(6).str());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BUILDING AND SPLICING STRINGS
+        //
+        // Concerns:
+        //: 1 Building a large string by repeated appends is not slower using
+        //:   a rope than using 'bsl::string', and inserting into the middle
+        //:   of a large string is much faster.
+        //
+        // Plan:
+        //: 1 Build a payload of (by default) 64 megabytes by appending records
+        //:   of 100 bytes, using 'bsl::string' and 'bslstl::Rope', and
+        //:   report the time taken, including the time to flatten the rope.
+        //:
+        //: 2 Insert records at pseudo-random positions into the payload, and
+        //:   report the time per insertion.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BUILDING AND SPLICING STRINGS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: BUILDING AND SPLICING STRINGS"
+                            "\n==========================================\n");
+
+        const std::size_t NUM_MEGABYTES = argc > 2 && atoi(argv[2]) > 0
+                                          ? atoi(argv[2])
+                                          : 64;
+        const std::size_t RECORD_LENGTH = 100;
+        const std::size_t NUM_RECORDS   =
+                                  NUM_MEGABYTES * 1024 * 1024 / RECORD_LENGTH;
+        const std::size_t NUM_INSERTS   = 1000;
+
+        Random            random(1);
+        const bsl::string RECORD = makeString(random, RECORD_LENGTH);
+
+        bsls::Stopwatch timer;
+
+        {
+            bsl::string payload;
+
+            timer.reset();
+            timer.start();
+            for (std::size_t i = 0; i < NUM_RECORDS; ++i) {
+                payload.append(RECORD);
+            }
+            timer.stop();
+            printf("\tbsl::string:  append %3d MB: %8.3fs\n",
+                   static_cast<int>(NUM_MEGABYTES),
+                   timer.elapsedTime());
+
+            timer.reset();
+            timer.start();
+            for (std::size_t i = 0; i < NUM_INSERTS; ++i) {
+                payload.insert(random(payload.length()), RECORD);
+            }
+            timer.stop();
+            printf("\tbsl::string:  insert:         %8.3fus/insert\n",
+                   timer.elapsedTime() * 1.0e6 / NUM_INSERTS);
+        }
+        {
+            Obj payload;
+
+            timer.reset();
+            timer.start();
+            for (std::size_t i = 0; i < NUM_RECORDS; ++i) {
+                payload.append(StringRef(RECORD));
+            }
+            timer.stop();
+            printf("\tbslstl::Rope: append %3d MB: %8.3fs (%d chunks)\n",
+                   static_cast<int>(NUM_MEGABYTES),
+                   timer.elapsedTime(),
+                   static_cast<int>(payload.numChunks()));
+
+            timer.reset();
+            timer.start();
+            for (std::size_t i = 0; i < NUM_INSERTS; ++i) {
+                payload.insert(random(payload.length()), StringRef(RECORD));
+            }
+            timer.stop();
+            printf("\tbslstl::Rope: insert:         %8.3fus/insert\n",
+                   timer.elapsedTime() * 1.0e6 / NUM_INSERTS);
+
+            bsl::string flattened;
+            timer.reset();
+            timer.start();
+            payload.flatten(&flattened);
+            timer.stop();
+            printf("\tbslstl::Rope: flatten:        %8.3fs (%d chunks)\n",
+                   timer.elapsedTime(),
+                   static_cast<int>(payload.numChunks()));
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -119,6 +119,9 @@ BSLS_IDENT("$Id: $")
 //  |                                                    | otherwise, where N |
 //  |                                                    | is distance(i1,i2) |
 //  +----------------------------------------------------+--------------------+
+//  | set<K> a(sorted_unique, i1, i2);                   | O[N]               |
+//  | set<K> a(sorted_unique, i1, i2, c, al);            |                    |
+//  +----------------------------------------------------+--------------------+
 //  | a.~set<K>(); (destruction)                         | O[n]               |
 //  +----------------------------------------------------+--------------------+
 //  | a = b;       (assignment)                          | O[n]               |
@@ -157,6 +160,16 @@ BSLS_IDENT("$Id: $")
 //  |                                                    |                    |
 //  |                                                    | where N is         |
 //  |                                                    | n + distance(i1,i2)|
+//  |                                                    | or O[N] if [i1,i2) |
+//  |                                                    | is sorted with     |
+//  |                                                    | 'a.value_comp()'   |
+//  |                                                    | and that is less   |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[min(N, log(N) *  |
+//  |                                                    |   distance(i1,i2))]|
+//  |                                                    |                    |
+//  |                                                    | where N is         |
+//  |                                                    | n + distance(i1,i2)|
 //  +----------------------------------------------------+--------------------+
 //  | a.erase(p1)                                        | amortized constant |
 //  +----------------------------------------------------+--------------------+
@@ -171,6 +184,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.key_comp()                                       | O[1]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.value_comp()                                     | O[1]               |
@@ -477,6 +492,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_setcomparator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_SORTEDTAG
+#include <bslstl_sortedtag.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
 #include <bslstl_stdexceptutil.h>
 #endif
@@ -517,6 +536,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -623,6 +646,51 @@ class set {
         // Return a reference providing modifiable access to the
         // comparator for this tree.
 
+    template <class INPUT_ITERATOR>
+    void buildSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Append to this set, which is empty, a newly created node holding
+        // each 'value_type' object in the ordered prefix of the sequence
+        // starting at the specified '*first' element and ending immediately
+        // before the specified 'last' element, skipping those that are the
+        // same as the previous object, and rebuild the resulting vine (see
+        // 'bslalg_rbtreeutil') into a balanced tree; then insert the value of
+        // the object ending that prefix (if any), and load into '*first' the
+        // position following that object.  Each object in the prefix except
+        // the first requires two comparisons.  The behavior is undefined
+        // unless this set is empty and '*first != last'.  Note that if an
+        // exception is thrown, the tree of this set may be left as a vine,
+        // which can only be destroyed (e.g., by a
+        // 'bslalg::RbTreeUtilTreeProctor').
+
+    template <class INPUT_ITERATOR>
+    void insertSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // ordered prefix of the sequence starting at the specified '*first'
+        // element and ending immediately before the specified 'last' element,
+        // whose key is not already contained in this set, followed by the
+        // value of the object ending that prefix (if any), and load into
+        // '*first' the position following the last object inserted.  Each
+        // value in the prefix is inserted immediately before the first node
+        // that is not ordered before it, found by walking forward from the
+        // position of the previous value, and falling back on a search from
+        // the root if that walk exceeds 'log(n)' steps, so that the prefix is
+        // inserted in O[min(n + N, N * log(n))] time, where n is the size of
+        // this set and N the length of the prefix.  A node is created only for
+        // a value that is inserted.  The behavior is undefined if '*first ==
+        // last'.  Note that each object in the sequence is accessed only once,
+        // as required for an input iterator.
+
+    template <class INPUT_ITERATOR>
+    void appendSortedRange(BloombergLP::bslalg::RbTreeAnchor *vine,
+                           INPUT_ITERATOR                     first,
+                           INPUT_ITERATOR                     last);
+        // Append to the specified 'vine' (see 'bslalg_rbtreeutil') a newly
+        // created node holding each 'value_type' object in the sequence
+        // starting at the specified 'first' element and ending immediately
+        // before the specified 'last' element, without comparing them.  The
+        // behavior is undefined unless the objects in the sequence are unique
+        // and ordered, and ordered after the last node of 'vine'.
+
     void quickSwap(set& other);
         // Efficiently exchange the value and comparator of this object with
         // the value of the specified 'other' object.  This method provides
@@ -726,6 +794,40 @@ class set {
         // that the (template parameter) type 'KEY' be "copy-constructible"
         // (see {Requirements on 'KEY'}).
 
+    template <class INPUT_ITERATOR>
+    set(sorted_unique_t,
+        INPUT_ITERATOR    first,
+        INPUT_ITERATOR    last,
+        const COMPARATOR& comparator = COMPARATOR(),
+        const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, which are (as asserted by
+        // passing 'bsl::sorted_unique') unique and ordered according to the
+        // identified 'comparator'.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'allocator' used to
+        // supply memory.  If 'allocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the template parameter 'ALLOCATOR' argument
+        // is of type 'bsl::allocator' (the default) then 'allocator', if
+        // supplied, shall be convertible to 'bslma::Allocator *'.  If the
+        // template parameter 'ALLOCATOR' argument is of type 'bsl::allocator'
+        // and 'allocator' is not supplied, the currently installed default
+        // allocator will be used to supply memory.  This operation has O[N]
+        // complexity, where N is the number of elements between 'first' and
+        // 'last', and does not compare keys (except to verify their order in
+        // safe build modes).  The (template parameter) type 'INPUT_ITERATOR'
+        // shall meet the requirements of an input iterator defined in the
+        // C++11 standard [24.2.3] providing access to values of a type
+        // convertible to 'value_type'.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last', and the values in that
+        // sequence are unique and ordered according to 'comparator'.  This
+        // method requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" (see {Requirements on 'KEY'}).
+
     ~set();
         // Destroy this object.
 
@@ -790,13 +892,38 @@ class set {
         // Insert into this set the value of each 'value_type' object in the
         // range starting at the specified 'first' iterator and ending
         // immediately before the specified 'last' iterator, whose key is not
-        // already contained in this set.  The (template parameter) type
+        // already contained in this set (nor appears earlier in the range).
+        // If the range is ordered according to the comparator of this set,
+        // this operation has O[N] complexity if this set is empty, and O[min(n
+        // + N, N * log(n))] complexity otherwise, where n is the size of this
+        // set and N is the number of elements in the range; otherwise it has
+        // O[N * log(n + N)] complexity.  The (template parameter) type
         // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
         // defined in the C++11 standard [24.2.3] providing access to values of
-        // a type convertible to 'value_type'.  This method requires that the
+        // a type convertible to 'value_type'. This method requires that the
         // (template parameter) type 'KEY' be "copy-constructible" (see
         // {Requirements on 'KEY'}).
 
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, which are (as
+        // asserted by passing 'bsl::sorted_unique') unique and ordered
+        // according to the comparator of this set, and whose key is not
+        // already contained in this set.  If this set is empty, this operation
+        // has O[N] complexity, where N is the number of elements in the range,
+        // and does not compare keys (except to verify their order in safe
+        // build modes); otherwise it has O[min(n + N, N * log(n))] complexity,
+        // where n is the size of this set.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless the values in the range are unique and ordered according to
+        // the comparator of this set.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible" (see {Requirements on
+        // 'KEY'}).
+
     iterator erase(const_iterator position);
         // Remove from this set the 'value_type' object at the specified
         // 'position', and return an iterator referring to the element
@@ -833,6 +960,18 @@ class set {
         // Remove all entries from this set.  Note that the set is empty after
         // this call, but allocated memory may be retained for future use.
 
+    void compact();
+        // Reallocate the nodes of this set contiguously, in the order of
+        // iteration, and release all the memory previously used for nodes.
+        // Each element is copied into its new node, and the original element
+        // destroyed.  All iterators, pointers, and references to elements of
+        // this set are invalidated.  If an exception is thrown, this set is
+        // not modified.  Note that, after a long sequence of insertions and
+        // removals, the nodes visited by iterating over a set are typically
+        // scattered across memory, and that this method restores the locality
+        // of iteration, at the cost of temporarily allocating memory for a
+        // second copy of the elements.
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the 'value_type'
         // object in this set that is the same as the specified 'key', if such
@@ -1130,6 +1269,127 @@ set<KEY, COMPARATOR, ALLOCATOR>::comparator()
     return d_compAndAlloc;
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::buildSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(0 == d_tree.numNodes());
+    BSLS_ASSERT_SAFE(*first != last);
+
+    BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                            &d_tree,
+                                            nodeFactory().createNode(**first));
+    for (++*first; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (this->comparator()(value, *d_tree.rootNode())) {
+            // 'value' ends the ordered prefix, so build the tree before
+            // inserting 'value' normally.
+
+            BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+            insert(value);
+            ++*first;
+            return;                                                   // RETURN
+        }
+        if (this->comparator()(*d_tree.rootNode(), value)) {
+            BloombergLP::bslalg::RbTreeUtil::appendToVine(
+                                             &d_tree,
+                                             nodeFactory().createNode(value));
+        }
+    }
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::insertSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(*first != last);
+
+    // 'hint' tracks the first node not ordered before the current value, and
+    // (while the values are ordered) only moves forward.  Nodes are inserted
+    // one at a time (rather than merged as a vine) so that no node is created
+    // for a value whose key is already present, and so that the values
+    // inserted remain in this set if an exception is thrown.
+
+    int maxSteps = 0;
+    for (int n = d_tree.numNodes(); n; n >>= 1) {
+        ++maxSteps;
+    }
+
+    BloombergLP::bslalg::RbTreeNode *hint     = 0;
+    BloombergLP::bslalg::RbTreeNode *prevNode = 0;
+    for (; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (0 == prevNode) {
+            hint = BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            value);
+        }
+        else {
+            if (this->comparator()(value, *prevNode)) {
+                // 'value' ends the ordered prefix, so insert it normally.
+
+                insert(value);
+                ++*first;
+                return;                                               // RETURN
+            }
+            for (int steps = 0;
+                 d_tree.sentinel() != hint
+                                    && this->comparator()(*hint, value);
+                 ++steps) {
+                if (maxSteps == steps) {
+                    hint = BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            value);
+                    break;
+                }
+                hint = BloombergLP::bslalg::RbTreeUtil::next(hint);
+            }
+        }
+
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+                BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                           &comparisonResult,
+                                                           &d_tree,
+                                                           this->comparator(),
+                                                           value,
+                                                           hint);
+        if (!comparisonResult) {
+            prevNode = insertLocation;
+            continue;
+        }
+        prevNode = nodeFactory().createNode(value);
+        BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                  insertLocation,
+                                                  comparisonResult < 0,
+                                                  prevNode);
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::appendSortedRange(
+                                    BloombergLP::bslalg::RbTreeAnchor *vine,
+                                    INPUT_ITERATOR                     first,
+                                    INPUT_ITERATOR                     last)
+{
+    for (; first != last; ++first) {
+        BloombergLP::bslalg::RbTreeNode *node =
+                                              nodeFactory().createNode(*first);
+        BloombergLP::bslalg::RbTreeUtil::appendToVine(vine, node);
+
+        BSLS_ASSERT_SAFE(!node->leftChild()
+                      || this->comparator()(*node->leftChild(), *node));
+    }
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 void set<KEY, COMPARATOR, ALLOCATOR>::quickSwap(set& other)
@@ -1178,39 +1438,43 @@ set<KEY, COMPARATOR, ALLOCATOR>::set(INPUT_ITERATOR    first,
                                                                &d_tree,
                                                                &nodeFactory());
 
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inseted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
+        // The following guarantees linear time to insert an ordered sequence
+        // of values (as required by the standard).  The nodes for the ordered
+        // prefix of the sequence are appended to a vine (see
+        // 'bslalg_rbtreeutil') without rebalancing, and the vine is then
+        // rebuilt into a balanced tree in a single pass.
 
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
+        buildSortedPrefix(&first, last);
 
-            const value_type& value = *first;
-            if (this->comparator()(value, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
+        // The remaining values are not in order, so insert them normally.
 
-            if (this->comparator()(*prevNode, value)) {
-                BloombergLP::bslalg::RbTreeNode *node =
-                                               nodeFactory().createNode(value);
-                BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                          prevNode,
-                                                          false,
-                                                          node);
-                prevNode = node;
-            }
+        for (; first != last; ++first) {
+            insert(*first);
         }
 
         proctor.release();
     }
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+set<KEY, COMPARATOR, ALLOCATOR>::set(sorted_unique_t,
+                                     INPUT_ITERATOR    first,
+                                     INPUT_ITERATOR    last,
+                                     const COMPARATOR& comparator,
+                                     const ALLOCATOR&  allocator)
+: d_compAndAlloc(comparator, allocator)
+, d_tree()
+{
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &d_tree,
+                                                               &nodeFactory());
+    appendSortedRange(&d_tree, first, last);
+    BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+    proctor.release();
+}
+
 
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1367,13 +1631,41 @@ set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator   hint,
 
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 template <class INPUT_ITERATOR>
-inline
 void set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                              INPUT_ITERATOR last)
 {
-    while (first != last) {
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    // The values in the ordered prefix of the range are merged into this
+    // set in a single forward pass.
+
+    insertSortedPrefix(&first, last);
+
+    // The remaining values are not in order, so insert them normally.
+
+    for (; first != last; ++first) {
         insert(*first);
-        ++first;
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                             INPUT_ITERATOR first,
+                                             INPUT_ITERATOR last)
+{
+    if (0 == d_tree.numNodes()) {
+        BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &d_tree,
+                                                               &nodeFactory());
+        appendSortedRange(&d_tree, first, last);
+        BloombergLP::bslalg::RbTreeUtil::vineToTree(&d_tree);
+        proctor.release();
+    }
+    else {
+        insert(first, last);
     }
 }
 
@@ -1466,6 +1758,23 @@ void set<KEY, COMPARATOR, ALLOCATOR>::clear()
 #endif
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::compact()
+{
+    if (0 < size()) {
+        set other(this->comparator().keyComparator(),
+                  nodeFactory().allocator());
+
+        // Reserve the nodes in a single chunk, handing them out in address
+        // order, and append them to a vine in the order of this object.
+
+        other.nodeFactory().reserveNodes(size());
+        other.appendSortedRange(&other.d_tree, cbegin(), cend());
+        BloombergLP::bslalg::RbTreeUtil::vineToTree(&other.d_tree);
+        quickSwap(other);
+    }
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
@@ -204,6 +204,15 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs);
+        // Return 'true' if 'value()' of the specified 'lhs' after being cast
+        // to 'NodeType' is less than (ordered before, according to the
+        // comparator held by this object) 'value()' of the specified 'rhs'
+        // after being cast to 'NodeType', and 'false' otherwise.  The
+        // behavior is undefined unless 'lhs' and 'rhs' can be safely cast to
+        // 'NodeType'.
+
     void swap(SetComparator& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -226,6 +235,15 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+        // Return 'true' if 'value()' of the specified 'lhs' after being cast
+        // to 'NodeType' is less than (ordered before, according to the
+        // comparator held by this object) 'value()' of the specified 'rhs'
+        // after being cast to 'NodeType', and 'false' otherwise.  The
+        // behavior is undefined unless 'lhs' and 'rhs' can be safely cast to
+        // 'NodeType'.
+
     COMPARATOR& keyComparator();
         // Return a reference providing modifiable access to the function
         // pointer or functor to which this comparator delegates comparison
@@ -320,6 +338,26 @@ bool SetComparator<KEY, COMPARATOR>::operator()(
     return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
 }
 
+template <class KEY, class COMPARATOR>
+inline
+bool SetComparator<KEY, COMPARATOR>::operator()(
+                                                 const bslalg::RbTreeNode& lhs,
+                                                 const bslalg::RbTreeNode& rhs)
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value(),
+                           static_cast<const NodeType&>(rhs).value());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool SetComparator<KEY, COMPARATOR>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const bslalg::RbTreeNode& rhs) const
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value(),
+                           static_cast<const NodeType&>(rhs).value());
+}
+
 template <class KEY, class COMPARATOR>
 inline
 COMPARATOR& SetComparator<KEY, COMPARATOR>::keyComparator()
@@ -0,0 +1,93 @@
+// bslstl_sharedstring.cpp                                            -*-C++-*-
+#include <bslstl_sharedstring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <ostream>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                             // ------------------
+                             // class SharedString
+                             // ------------------
+
+// PRIVATE CLASS METHODS
+SharedString_Rep *SharedString::createRep(const char       *characters,
+                                          std::size_t       length,
+                                          bslma::Allocator *basicAllocator)
+{
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    const std::size_t size = sizeof(SharedString_Rep) + length + 1;
+
+    SharedString_Rep *rep = static_cast<SharedString_Rep *>(
+                                                  allocator->allocate(size));
+
+    // Compute the hash value as 'bsl::hashBasicString' does, so that a shared
+    // string and a 'bsl::string' having the same value have the same hash
+    // value.
+
+    unsigned long hashValue = 0;
+    for (std::size_t i = 0; i < length; ++i) {
+        hashValue = 5 * hashValue + characters[i];
+    }
+
+    bsls::AtomicOperations::initInt(&rep->d_refCount, 1);
+    rep->d_length      = length;
+    rep->d_hash        = static_cast<std::size_t>(hashValue);
+    rep->d_allocator_p = allocator;
+
+    std::memcpy(rep->characters(), characters, length);
+    rep->characters()[length] = '\0';
+
+    return rep;
+}
+
+void SharedString::destroyRep(SharedString_Rep *rep)
+{
+    BSLS_ASSERT(rep);
+
+    rep->d_allocator_p->deallocate(rep);
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+std::ostream& bslstl::operator<<(std::ostream&       stream,
+                                 const SharedString& string)
+{
+    return stream << static_cast<StringRef>(string);
+}
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
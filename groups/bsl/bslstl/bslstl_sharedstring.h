@@ -0,0 +1,682 @@
+// bslstl_sharedstring.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SHAREDSTRING
+#define INCLUDED_BSLSTL_SHAREDSTRING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an immutable, reference-counted string.
+//
+//@CLASSES:
+//  bslstl::SharedString: immutable string sharing a counted representation
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'bslstl::SharedString', holding an immutable sequence of 'char's.  Copies of
+// a 'bslstl::SharedString' share a single representation, so that copying,
+// assigning, and destroying a 'bslstl::SharedString' takes constant time and
+// never allocates memory.  This makes 'bslstl::SharedString' suitable for
+// values (e.g., security symbols) that are stored as keys or attributes in
+// many containers and messages at once, where each copy of a 'bsl::string'
+// longer than its short string buffer would allocate.
+//
+///Representation
+///--------------
+// A non-empty 'bslstl::SharedString' refers to a representation obtained in a
+// single allocation, holding (in order) an atomic reference count, the length
+// of the string, the hash value of the string, the allocator that supplied
+// the representation, and the characters of the string followed by a null
+// terminator.  An empty 'bslstl::SharedString' has no representation, so that
+// default construction does not allocate.  The footprint of a
+// 'bslstl::SharedString' object is that of a single pointer.
+//
+// The hash value is computed once, when the representation is created, and is
+// equal to the value returned by 'bsl::hash<bsl::string>' for a 'bsl::string'
+// having the same value; 'bsl::hash<bslstl::SharedString>' returns the cached
+// value.  The equality operators compare the addresses of the representations
+// and then the cached hash values before comparing any characters.
+//
+///Memory Allocation
+///-----------------
+// The constructors creating a representation take an optional
+// 'bslma::Allocator' argument, used to supply the memory for that
+// representation (the currently installed default allocator is used if no
+// allocator is supplied).  The representation records its allocator, and is
+// returned to it when the last 'bslstl::SharedString' referring to it is
+// destroyed or assigned.  Because copies share the representation of the
+// original, 'bslstl::SharedString' is not a 'bslma'-allocator-aware type (in
+// the sense of 'bslma::UsesBslmaAllocator'), in the same way as
+// 'bsl::shared_ptr': a copy does not take an allocator, and uses the memory
+// of the string from which it was copied.  Clients must therefore ensure that
+// the allocator supplied at construction outlives every copy of the string.
+//
+///Thread Safety
+///-------------
+// Distinct 'bslstl::SharedString' objects may be used concurrently from
+// different threads, even if they share a representation.  A single
+// 'bslstl::SharedString' object is 'const' thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Symbol Among Many Records
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a market data cache stores the symbol of a security in each of the
+// many subscriptions and quotes referring to that security.  We define a
+// subscription record holding a 'bslstl::SharedString':
+//..
+//  struct Subscription {
+//      // This 'struct' describes a subscription to a security.
+//
+//      bslstl::SharedString d_symbol;    // symbol of the security
+//      int                  d_userId;    // subscribing user
+//  };
+//..
+// Then, we create the symbol once, using a test allocator to observe the
+// memory it supplies:
+//..
+//  bslma::TestAllocator ta;
+//
+//  const bslstl::SharedString SYMBOL("VOD LN Equity (London Stock Exchange)",
+//                                    &ta);
+//  assert(37 == SYMBOL.length());
+//  assert( 1 == ta.numBlocksInUse());
+//..
+// Next, we create many subscriptions to the security.  Copying the symbol
+// into each subscription does not allocate memory:
+//..
+//  Subscription subscriptions[100];
+//  for (int i = 0; i < 100; ++i) {
+//      subscriptions[i].d_symbol = SYMBOL;
+//      subscriptions[i].d_userId = i;
+//  }
+//  assert(  1 == ta.numBlocksInUse());
+//  assert(101 == SYMBOL.numReferences());
+//..
+// Then, we observe that a 'bslstl::SharedString' converts, without copying
+// its characters, to a 'bslstl::StringRef', and compares with one:
+//..
+//  const bslstl::StringRef ref = subscriptions[42].d_symbol;
+//  assert(SYMBOL.data() == ref.data());
+//  assert(subscriptions[42].d_symbol == ref);
+//..
+// Finally, we observe that the hash value of the symbol is that of a
+// 'bsl::string' having the same value:
+//..
+//  const bsl::string copy(SYMBOL.data(), SYMBOL.length());
+//  assert(bsl::hash<bsl::string>()(copy)
+//                             == bsl::hash<bslstl::SharedString>()(SYMBOL));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_HASH
+#include <bslstl_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_IOSFWD
+#include <iosfwd>
+#define INCLUDED_IOSFWD
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // =======================
+                          // struct SharedString_Rep
+                          // =======================
+
+struct SharedString_Rep {
+    // This component-private 'struct' provides the header of the
+    // representation shared by 'SharedString' objects.  The characters of the
+    // string, followed by a null terminator, are stored immediately after the
+    // header, in the same block of memory.
+
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Int
+                      d_refCount;     // number of 'SharedString' objects
+                                      // referring to this representation
+
+    std::size_t       d_length;       // length of the string
+
+    std::size_t       d_hash;         // hash value of the string
+
+    bslma::Allocator *d_allocator_p;  // allocator that supplied this
+                                      // representation (held, not owned)
+
+    // MANIPULATORS
+    char *characters();
+        // Return the address of the modifiable characters of the string
+        // described by this header.
+
+    // ACCESSORS
+    const char *characters() const;
+        // Return the address of the non-modifiable characters of the string
+        // described by this header.
+};
+
+                             // ==================
+                             // class SharedString
+                             // ==================
+
+class SharedString {
+    // This class provides an immutable string whose copies share a single,
+    // reference-counted representation.  See the component-level
+    // documentation for details.
+
+    // DATA
+    SharedString_Rep *d_rep_p;  // shared representation, or 0 if this string
+                                // is empty
+
+    // PRIVATE CLASS METHODS
+    static SharedString_Rep *createRep(const char       *characters,
+                                       std::size_t       length,
+                                       bslma::Allocator *basicAllocator);
+        // Return the address of a new representation, having a reference
+        // count of 1, of the string of the specified 'length' at the specified
+        // 'characters', using the specified 'basicAllocator' to supply memory,
+        // or 0 if '0 == length'.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    static void destroyRep(SharedString_Rep *rep);
+        // Return the memory of the specified 'rep' to the allocator that
+        // supplied it.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SharedString, bslmf::IsBitwiseMoveable);
+
+    // TYPES
+    typedef char               value_type;
+    typedef const char        *const_iterator;
+    typedef std::size_t        size_type;
+
+    // CREATORS
+    SharedString();
+        // Create an empty string.  Note that no memory is allocated.
+
+    explicit SharedString(const char       *characters,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create a string having the value of the specified null-terminated
+        // 'characters'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'characters' is
+        // not 0.
+
+    SharedString(const char       *characters,
+                 size_type         length,
+                 bslma::Allocator *basicAllocator = 0);
+        // Create a string having the value of the specified 'length'
+        // characters at the specified 'characters' address.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'characters' is not 0 or
+        // '0 == length'.
+
+    explicit SharedString(const StringRef&  value,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create a string having the value of the string bound to the
+        // specified 'value' (e.g., a 'bsl::string').  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    SharedString(const SharedString& original);
+        // Create a string having the value of the specified 'original' string
+        // and sharing its representation.  Note that no memory is allocated.
+
+    ~SharedString();
+        // Destroy this object, and release the representation it refers to if
+        // this object is the last referring to that representation.
+
+    // MANIPULATORS
+    SharedString& operator=(const SharedString& rhs);
+        // Make this string refer to the representation of the specified 'rhs'
+        // string, releasing the representation this string referred to, and
+        // return a reference providing modifiable access to this object.  Note
+        // that no memory is allocated.
+
+    void reset();
+        // Make this string empty, releasing the representation it referred to.
+
+    void swap(SharedString& other);
+        // Exchange the value of this string with that of the specified 'other'
+        // string.  This method provides the no-throw exception-safety
+        // guarantee.
+
+    // ACCESSORS
+    operator StringRef() const;
+        // Return a string reference bound to the characters of this string.
+        // Note that the characters are not copied.
+
+    const char& operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the character
+        // at the specified 'position' in this string.  The behavior is
+        // undefined unless 'position < length()'.
+
+    bslma::Allocator *allocator() const;
+        // Return the address of the allocator that supplied the representation
+        // of this string, or 0 if this string is empty.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first character of this string,
+        // or the 'end' iterator if this string is empty.
+
+    const char *c_str() const;
+        // Return the address of the null-terminated characters of this string.
+
+    const char *data() const;
+        // Return the address of the characters of this string.  Note that the
+        // characters are null-terminated.
+
+    const_iterator end() const;
+        // Return an iterator referring to one past the last character of this
+        // string.
+
+    std::size_t hashValue() const;
+        // Return the hash value of this string, which is the value returned by
+        // 'bsl::hash<bsl::string>' for a 'bsl::string' having the value of
+        // this string.  Note that the hash value is computed once, when the
+        // representation of this string is created.
+
+    bool isEmpty() const;
+        // Return 'true' if this string has a length of 0, and 'false'
+        // otherwise.
+
+    size_type length() const;
+        // Return the number of characters in this string.
+
+    int numReferences() const;
+        // Return the number of 'SharedString' objects referring to the
+        // representation of this string, or 0 if this string is empty.  Note
+        // that the returned value may be out-of-date by the time it is used
+        // if copies of this string are accessed by other threads.
+};
+
+// FREE OPERATORS
+bool operator==(const SharedString& lhs, const SharedString& rhs);
+bool operator==(const SharedString& lhs, const StringRef&    rhs);
+bool operator==(const StringRef&    lhs, const SharedString& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings have the same
+    // value, and 'false' otherwise.  Two strings have the same value if they
+    // have the same length, and the characters at each respective position
+    // have the same value.
+
+bool operator!=(const SharedString& lhs, const SharedString& rhs);
+bool operator!=(const SharedString& lhs, const StringRef&    rhs);
+bool operator!=(const StringRef&    lhs, const SharedString& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings do not have the
+    // same value, and 'false' otherwise.  Two strings do not have the same
+    // value if they differ in length, or differ in at least one character
+    // at a respective position.
+
+bool operator<(const SharedString& lhs, const SharedString& rhs);
+bool operator<(const SharedString& lhs, const StringRef&    rhs);
+bool operator<(const StringRef&    lhs, const SharedString& rhs);
+    // Return 'true' if the specified 'lhs' string is lexicographically less
+    // than the specified 'rhs' string, and 'false' otherwise.  See
+    // 'bslstl_stringref' for the definition of lexicographic comparison.
+
+std::ostream& operator<<(std::ostream& stream, const SharedString& string);
+    // Write the characters of the specified 'string' to the specified output
+    // 'stream', and return a reference to 'stream'.
+
+// FREE FUNCTIONS
+void swap(SharedString& a, SharedString& b);
+    // Exchange the values of the specified 'a' and 'b' strings.  This function
+    // provides the no-throw exception-safety guarantee.
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                    // =====================================
+                    // struct hash<bslstl::SharedString>
+                    // =====================================
+
+template <>
+struct hash<BloombergLP::bslstl::SharedString> {
+    // This specialization of 'hash' returns the hash value cached by a
+    // 'bslstl::SharedString', which is equal to the hash value of a
+    // 'bsl::string' having the same value.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(hash, bsl::is_trivially_copyable);
+
+    // ACCESSORS
+    std::size_t operator()(const BloombergLP::bslstl::SharedString& x) const;
+        // Return the hash value of the specified 'x'.
+};
+
+}  // close namespace bsl
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // -----------------------
+                          // struct SharedString_Rep
+                          // -----------------------
+
+// MANIPULATORS
+inline
+char *SharedString_Rep::characters()
+{
+    return reinterpret_cast<char *>(this + 1);
+}
+
+// ACCESSORS
+inline
+const char *SharedString_Rep::characters() const
+{
+    return reinterpret_cast<const char *>(this + 1);
+}
+
+                             // ------------------
+                             // class SharedString
+                             // ------------------
+
+// CREATORS
+inline
+SharedString::SharedString()
+: d_rep_p(0)
+{
+}
+
+inline
+SharedString::SharedString(const char       *characters,
+                           bslma::Allocator *basicAllocator)
+: d_rep_p(0)
+{
+    BSLS_ASSERT_SAFE(characters);
+
+    d_rep_p = createRep(characters, std::strlen(characters), basicAllocator);
+}
+
+inline
+SharedString::SharedString(const char       *characters,
+                           size_type         length,
+                           bslma::Allocator *basicAllocator)
+: d_rep_p(0)
+{
+    BSLS_ASSERT_SAFE(characters || 0 == length);
+
+    d_rep_p = createRep(characters, length, basicAllocator);
+}
+
+inline
+SharedString::SharedString(const StringRef&  value,
+                           bslma::Allocator *basicAllocator)
+: d_rep_p(createRep(value.data(), value.length(), basicAllocator))
+{
+}
+
+inline
+SharedString::SharedString(const SharedString& original)
+: d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        bsls::AtomicOperations::addIntNvRelaxed(&d_rep_p->d_refCount, 1);
+    }
+}
+
+inline
+SharedString::~SharedString()
+{
+    if (d_rep_p
+     && 0 == bsls::AtomicOperations::decrementIntNvAcqRel(
+                                                      &d_rep_p->d_refCount)) {
+        destroyRep(d_rep_p);
+    }
+}
+
+// MANIPULATORS
+inline
+SharedString& SharedString::operator=(const SharedString& rhs)
+{
+    SharedString(rhs).swap(*this);
+    return *this;
+}
+
+inline
+void SharedString::reset()
+{
+    SharedString().swap(*this);
+}
+
+inline
+void SharedString::swap(SharedString& other)
+{
+    SharedString_Rep *rep = d_rep_p;
+    d_rep_p               = other.d_rep_p;
+    other.d_rep_p         = rep;
+}
+
+// ACCESSORS
+inline
+SharedString::operator StringRef() const
+{
+    return d_rep_p ? StringRef(d_rep_p->characters(),
+                               static_cast<int>(d_rep_p->d_length))
+                   : StringRef();
+}
+
+inline
+const char& SharedString::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < length());
+
+    return d_rep_p->characters()[position];
+}
+
+inline
+bslma::Allocator *SharedString::allocator() const
+{
+    return d_rep_p ? d_rep_p->d_allocator_p : 0;
+}
+
+inline
+SharedString::const_iterator SharedString::begin() const
+{
+    return data();
+}
+
+inline
+const char *SharedString::c_str() const
+{
+    return data();
+}
+
+inline
+const char *SharedString::data() const
+{
+    return d_rep_p ? d_rep_p->characters() : "";
+}
+
+inline
+SharedString::const_iterator SharedString::end() const
+{
+    return data() + length();
+}
+
+inline
+std::size_t SharedString::hashValue() const
+{
+    return d_rep_p ? d_rep_p->d_hash : 0;
+}
+
+inline
+bool SharedString::isEmpty() const
+{
+    return 0 == d_rep_p;
+}
+
+inline
+SharedString::size_type SharedString::length() const
+{
+    return d_rep_p ? d_rep_p->d_length : 0;
+}
+
+inline
+int SharedString::numReferences() const
+{
+    return d_rep_p
+           ? bsls::AtomicOperations::getIntRelaxed(&d_rep_p->d_refCount)
+           : 0;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bslstl::operator==(const SharedString& lhs, const SharedString& rhs)
+{
+    if (lhs.data() == rhs.data()) {
+        return true;                                                  // RETURN
+    }
+    return lhs.hashValue() == rhs.hashValue()
+        && lhs.length()    == rhs.length()
+        && 0 == std::memcmp(lhs.data(), rhs.data(), lhs.length());
+}
+
+inline
+bool bslstl::operator==(const SharedString& lhs, const StringRef& rhs)
+{
+    return lhs.length() == static_cast<std::size_t>(rhs.length())
+        && 0 == std::memcmp(lhs.data(), rhs.data(), lhs.length());
+}
+
+inline
+bool bslstl::operator==(const StringRef& lhs, const SharedString& rhs)
+{
+    return rhs == lhs;
+}
+
+inline
+bool bslstl::operator!=(const SharedString& lhs, const SharedString& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool bslstl::operator!=(const SharedString& lhs, const StringRef& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool bslstl::operator!=(const StringRef& lhs, const SharedString& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool bslstl::operator<(const SharedString& lhs, const SharedString& rhs)
+{
+    return static_cast<StringRef>(lhs) < static_cast<StringRef>(rhs);
+}
+
+inline
+bool bslstl::operator<(const SharedString& lhs, const StringRef& rhs)
+{
+    return static_cast<StringRef>(lhs) < rhs;
+}
+
+inline
+bool bslstl::operator<(const StringRef& lhs, const SharedString& rhs)
+{
+    return lhs < static_cast<StringRef>(rhs);
+}
+
+// FREE FUNCTIONS
+inline
+void bslstl::swap(SharedString& a, SharedString& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+namespace bsl {
+
+                    // -------------------------------------
+                    // struct hash<bslstl::SharedString>
+                    // -------------------------------------
+
+// ACCESSORS
+inline
+std::size_t hash<BloombergLP::bslstl::SharedString>::operator()(
+                            const BloombergLP::bslstl::SharedString& x) const
+{
+    return x.hashValue();
+}
+
+}  // close namespace bsl
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,982 @@
+// bslstl_sharedstring.t.cpp                                          -*-C++-*-
+#include <bslstl_sharedstring.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslmf_issame.h>                  // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_objectbuffer.h>             // for testing only
+#include <bsls_platform.h>                 // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+
+#include <sstream>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::SharedString' is an immutable string whose copies share a
+// reference-counted representation.  The creators are tested by observing the
+// value and the reference count through the accessors, and the memory supplied
+// by test allocators: only the constructors creating a representation may
+// allocate, and the representation is released when its last reference is
+// destroyed.  The comparison operators and the hash value are tested against
+// those of 'bsl::string' over a table of values, and the atomicity of the
+// reference count is tested by copying and destroying strings sharing a
+// representation from several threads.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SharedString();
+// [ 2] explicit SharedString(const char *characters, Allocator *ba = 0);
+// [ 2] SharedString(const char *characters, size_type length, ba = 0);
+// [ 4] explicit SharedString(const StringRef& value, Allocator *ba = 0);
+// [ 3] SharedString(const SharedString& original);
+// [ 2] ~SharedString();
+//
+// MANIPULATORS
+// [ 3] SharedString& operator=(const SharedString& rhs);
+// [ 3] void reset();
+// [ 3] void swap(SharedString& other);
+//
+// ACCESSORS
+// [ 4] operator StringRef() const;
+// [ 2] const char& operator[](size_type position) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const char *c_str() const;
+// [ 2] const char *data() const;
+// [ 2] const_iterator end() const;
+// [ 5] std::size_t hashValue() const;
+// [ 2] bool isEmpty() const;
+// [ 2] size_type length() const;
+// [ 2] int numReferences() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const SharedString&, const SharedString&);
+// [ 5] bool operator==(const SharedString&, const StringRef&);
+// [ 5] bool operator==(const StringRef&, const SharedString&);
+// [ 5] bool operator!=(const SharedString&, const SharedString&);
+// [ 5] bool operator!=(const SharedString&, const StringRef&);
+// [ 5] bool operator!=(const StringRef&, const SharedString&);
+// [ 5] bool operator<(const SharedString&, const SharedString&);
+// [ 5] bool operator<(const SharedString&, const StringRef&);
+// [ 5] bool operator<(const StringRef&, const SharedString&);
+// [ 4] ostream& operator<<(ostream& stream, const SharedString& string);
+// [ 3] void swap(SharedString& a, SharedString& b);
+// [ 5] size_t bsl::hash<SharedString>::operator()(const SharedString&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: The reference count is updated atomically.
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: COPYING KEYS INTO MANY RECORDS
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::SharedString Obj;
+typedef bsls::Types::Int64   Int64;
+
+static const struct {
+    int         d_line;    // source line number
+    const char *d_value;   // string value
+} DATA[] = {
+    //LINE  VALUE
+    //----  ----------------------------------------------------------------
+    { L_,   ""                                                              },
+    { L_,   "A"                                                             },
+    { L_,   "B"                                                             },
+    { L_,   "AB"                                                            },
+    { L_,   "BA"                                                            },
+    { L_,   "ABC"                                                           },
+    { L_,   "IBM US Equity"                                                 },
+    { L_,   "VOD LN Equity"                                                 },
+    { L_,   "VOD LN Equity (London Stock Exchange)"                         },
+    { L_,   "VOD LN Equity (London Stock Exchange) "                        },
+    { L_,   "\x80\xff non-ASCII characters"                                 },
+};
+const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+enum { k_NUM_COPIES_PER_THREAD = 64 };
+
+extern "C" void *copyStringThread(void *arg)
+    // Repeatedly copy the 'bslstl::SharedString' at the specified 'arg' into,
+    // and then release, a number of local strings.
+{
+    const Obj& shared = *static_cast<const Obj *>(arg);
+
+    for (int iteration = 0; iteration < 2000; ++iteration) {
+        Obj copies[k_NUM_COPIES_PER_THREAD];
+        for (int i = 0; i < k_NUM_COPIES_PER_THREAD; ++i) {
+            copies[i] = shared;
+        }
+        for (int i = 0; i < k_NUM_COPIES_PER_THREAD; i += 2) {
+            copies[i].reset();
+        }
+    }
+    return 0;
+}
+
+                       // ===============================
+                       // struct SharedStringBenchmarkUtil
+                       // ===============================
+
+template <class STRING>
+struct SharedStringBenchmarkUtil {
+    // This 'struct' provides a namespace for a benchmark measuring the cost of
+    // copying a key having the (template parameter) 'STRING' type into many
+    // records.
+
+    static void run(const char *name,
+                    const char *key,
+                    int         numRecords,
+                    int         numIterations);
+        // Print to 'stdout', on a line prefixed by the specified 'name', the
+        // number of bytes allocated and the time taken to copy the specified
+        // 'key' into the specified 'numRecords' records, and then to destroy
+        // the records, repeated the specified 'numIterations' times.
+};
+
+template <class STRING>
+void SharedStringBenchmarkUtil<STRING>::run(const char *name,
+                                            const char *key,
+                                            int         numRecords,
+                                            int         numIterations)
+{
+    bslma::TestAllocator         ta;
+    bslma::DefaultAllocatorGuard guard(&ta);
+
+    bsls::ObjectBuffer<STRING> *records =
+                                    new bsls::ObjectBuffer<STRING>[numRecords];
+
+    const STRING KEY(key, &ta);
+
+    bsls::Stopwatch    timer;
+    double             copyTime    = 0.0;
+    double             destroyTime = 0.0;
+    Int64              bytesInUse  = 0;
+
+    for (int iteration = 0; iteration < numIterations; ++iteration) {
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < numRecords; ++i) {
+            new (records[i].buffer()) STRING(KEY);
+        }
+        timer.stop();
+        copyTime += timer.elapsedTime();
+
+        bytesInUse = ta.numBytesInUse();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < numRecords; ++i) {
+            records[i].object().~STRING();
+        }
+        timer.stop();
+        destroyTime += timer.elapsedTime();
+    }
+
+    delete [] records;
+
+    const double numOperations = static_cast<double>(numRecords)
+                                                               * numIterations;
+
+    printf("\t%-20s len=%2d bytes/record=%6.1f"
+           "  copy=%6.2fns  destroy=%6.2fns\n",
+           name,
+           static_cast<int>(strlen(key)),
+           static_cast<double>(bytesInUse) / numRecords
+                                        + static_cast<double>(sizeof(STRING)),
+           copyTime    * 1.0e9 / numOperations,
+           destroyTime * 1.0e9 / numOperations);
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Symbol Among Many Records
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a market data cache stores the symbol of a security in each of the
+// many subscriptions and quotes referring to that security.  We define a
+// subscription record holding a 'bslstl::SharedString':
+//..
+    struct Subscription {
+        // This 'struct' describes a subscription to a security.
+
+        bslstl::SharedString d_symbol;    // symbol of the security
+        int                  d_userId;    // subscribing user
+    };
+//..
+// Then, we create the symbol once, using a test allocator to observe the
+// memory it supplies:
+//..
+    bslma::TestAllocator ta;
+
+    const bslstl::SharedString SYMBOL("VOD LN Equity (London Stock Exchange)",
+                                      &ta);
+    ASSERT(37 == SYMBOL.length());
+    ASSERT( 1 == ta.numBlocksInUse());
+//..
+// Next, we create many subscriptions to the security.  Copying the symbol
+// into each subscription does not allocate memory:
+//..
+    Subscription subscriptions[100];
+    for (int i = 0; i < 100; ++i) {
+        subscriptions[i].d_symbol = SYMBOL;
+        subscriptions[i].d_userId = i;
+    }
+    ASSERT(  1 == ta.numBlocksInUse());
+    ASSERT(101 == SYMBOL.numReferences());
+//..
+// Then, we observe that a 'bslstl::SharedString' converts, without copying
+// its characters, to a 'bslstl::StringRef', and compares with one:
+//..
+    const bslstl::StringRef ref = subscriptions[42].d_symbol;
+    ASSERT(SYMBOL.data() == ref.data());
+    ASSERT(subscriptions[42].d_symbol == ref);
+//..
+// Finally, we observe that the hash value of the symbol is that of a
+// 'bsl::string' having the same value:
+//..
+    const bsl::string copy(SYMBOL.data(), SYMBOL.length());
+    ASSERT(bsl::hash<bsl::string>()(copy)
+                               == bsl::hash<bslstl::SharedString>()(SYMBOL));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: THE REFERENCE COUNT IS UPDATED ATOMICALLY
+        //
+        // Concerns:
+        //: 1 Strings sharing a representation can be copied and destroyed
+        //:   concurrently from several threads.
+        //:
+        //: 2 The representation is released exactly once, when the last
+        //:   string referring to it is destroyed.
+        //
+        // Plan:
+        //: 1 Create a string using a test allocator, and start several
+        //:   threads that each repeatedly copy it into, and release, many
+        //:   local strings.  After joining the threads, verify that the
+        //:   reference count is 1, and that the representation is released
+        //:   when the string is destroyed.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: The reference count is updated atomically.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: THE REFERENCE COUNT IS UPDATED"
+                            " ATOMICALLY"
+                            "\n======================================="
+                            "===========\n");
+
+        enum { k_NUM_THREADS = 4 };
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            const Obj X("VOD LN Equity (London Stock Exchange)", &ta);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            ThreadId threads[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads[i] = createThread(&copyStringThread,
+                                          const_cast<Obj *>(&X));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+            }
+
+            ASSERTV(X.numReferences(), 1 == X.numReferences());
+            ASSERT(1 == ta.numBlocksInUse());
+            ASSERT(1 == ta.numBlocksTotal());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COMPARISON OPERATORS AND HASH
+        //
+        // Concerns:
+        //: 1 Two strings compare equal if and only if they have the same
+        //:   value, whether or not they share a representation.
+        //:
+        //: 2 The operators comparing with a 'bslstl::StringRef' give the same
+        //:   results as those comparing two shared strings.
+        //:
+        //: 3 'operator<' gives the same result as the corresponding operator
+        //:   of 'bsl::string'.
+        //:
+        //: 4 The hash value of a string, whether obtained from 'hashValue' or
+        //:   'bsl::hash', is equal to that of a 'bsl::string' having the same
+        //:   value.
+        //:
+        //: 5 The comparison operators and the hash do not allocate.
+        //
+        // Plan:
+        //: 1 For each pair of values in a table, create a string for each
+        //:   value, and verify the results of the operators against those of
+        //:   the same operators applied to 'bsl::string's having the same
+        //:   values.  Repeat with a copy of the first string, and with a
+        //:   string reference to the second string.  (C-1..3, 5)
+        //:
+        //: 2 For each value in the table, verify 'hashValue' and 'bsl::hash'
+        //:   against 'bsl::hash<bsl::string>'.  (C-4)
+        //
+        // Testing:
+        //   bool operator==(const SharedString&, const SharedString&);
+        //   bool operator==(const SharedString&, const StringRef&);
+        //   bool operator==(const StringRef&, const SharedString&);
+        //   bool operator!=(const SharedString&, const SharedString&);
+        //   bool operator!=(const SharedString&, const StringRef&);
+        //   bool operator!=(const StringRef&, const SharedString&);
+        //   bool operator<(const SharedString&, const SharedString&);
+        //   bool operator<(const SharedString&, const StringRef&);
+        //   bool operator<(const StringRef&, const SharedString&);
+        //   std::size_t hashValue() const;
+        //   size_t bsl::hash<SharedString>::operator()(const SharedString&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOMPARISON OPERATORS AND HASH"
+                            "\n=============================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE1  = DATA[ti].d_line;
+            const char *VALUE1 = DATA[ti].d_value;
+
+            const Obj         X(VALUE1, &ta);
+            const Obj         XX(X);
+            const bsl::string S1(VALUE1);
+
+            ASSERTV(LINE1, bsl::hash<bsl::string>()(S1) == X.hashValue());
+            ASSERTV(LINE1, bsl::hash<bsl::string>()(S1)
+                                                    == bsl::hash<Obj>()(X));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int   LINE2  = DATA[tj].d_line;
+                const char *VALUE2 = DATA[tj].d_value;
+
+                const Obj               Y(VALUE2, &ta);
+                const bsl::string       S2(VALUE2);
+                const bslstl::StringRef R(S2);
+
+                const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+                const bool EQ = S1 == S2;
+                const bool LT = S1 <  S2;
+
+                ASSERTV(LINE1, LINE2, (ti == tj) == EQ);
+
+                ASSERTV(LINE1, LINE2, EQ  == (X  == Y));
+                ASSERTV(LINE1, LINE2, EQ  == (XX == Y));
+                ASSERTV(LINE1, LINE2, EQ  == (X  == R));
+                ASSERTV(LINE1, LINE2, EQ  == (R  == X));
+                ASSERTV(LINE1, LINE2, !EQ == (X  != Y));
+                ASSERTV(LINE1, LINE2, !EQ == (XX != Y));
+                ASSERTV(LINE1, LINE2, !EQ == (X  != R));
+                ASSERTV(LINE1, LINE2, !EQ == (R  != X));
+
+                ASSERTV(LINE1, LINE2, LT == (X < Y));
+                ASSERTV(LINE1, LINE2, LT == (X < R));
+                ASSERTV(LINE1, LINE2, (S2 < S1) == (R < X));
+
+                ASSERTV(LINE1, LINE2, NUM_ALLOCATIONS == ta.numAllocations());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONVERSIONS
+        //
+        // Concerns:
+        //: 1 A string converts to a 'bslstl::StringRef' bound to its
+        //:   characters, without copying them or allocating.
+        //:
+        //: 2 A string can be created from a 'bslstl::StringRef', and hence
+        //:   from a 'bsl::string', using the supplied allocator.
+        //:
+        //: 3 'operator<<' writes the characters of the string.
+        //
+        // Plan:
+        //: 1 For each value in a table, create a 'bsl::string', create a
+        //:   string from it, and convert that string to a string reference.
+        //:   Verify the values, addresses, and allocators.  Write the string
+        //:   to an 'ostringstream' and verify the result.  (C-1..3)
+        //
+        // Testing:
+        //   explicit SharedString(const StringRef& value, Allocator *ba = 0);
+        //   operator StringRef() const;
+        //   ostream& operator<<(ostream& stream, const SharedString& string);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONVERSIONS"
+                            "\n===========\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const char *VALUE = DATA[ti].d_value;
+            const int   LENGTH = static_cast<int>(strlen(VALUE));
+
+            const bsl::string S(VALUE);
+
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            const Obj X(S, &ta);
+            ASSERTV(LINE, LENGTH == static_cast<int>(X.length()));
+            ASSERTV(LINE, S == X.c_str());
+            ASSERTV(LINE, NUM_ALLOCATIONS + (LENGTH ? 1 : 0)
+                                                       == ta.numAllocations());
+
+            const Obj Y(bslstl::StringRef(VALUE), &ta);
+            ASSERTV(LINE, X == Y);
+
+            const bslstl::StringRef R = X;
+            ASSERTV(LINE, LENGTH   == static_cast<int>(R.length()));
+            ASSERTV(LINE, X.data() == R.data() || 0 == LENGTH);
+            ASSERTV(LINE, S        == R);
+
+            std::ostringstream os;
+            os << X;
+            ASSERTV(LINE, os.str() == VALUE);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, RESET, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy shares the representation of the original, increments the
+        //:   reference count, and does not allocate.
+        //:
+        //: 2 Assignment releases the representation referred to by the
+        //:   target, and shares that of the source, including when the source
+        //:   and the target are the same object or share a representation.
+        //:
+        //: 3 'reset' makes a string empty, releasing its representation.
+        //:
+        //: 4 'swap' exchanges the representations of two strings.
+        //:
+        //: 5 A representation is returned to its allocator when the last
+        //:   string referring to it is destroyed, whichever string that is.
+        //
+        // Plan:
+        //: 1 For each pair of values in a table, create strings using
+        //:   distinct test allocators, copy, assign, swap, and reset them, and
+        //:   verify the values, reference counts, and the memory in use from
+        //:   each allocator.  (C-1..5)
+        //
+        // Testing:
+        //   SharedString(const SharedString& original);
+        //   SharedString& operator=(const SharedString& rhs);
+        //   void reset();
+        //   void swap(SharedString& other);
+        //   void swap(SharedString& a, SharedString& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, RESET, AND SWAP"
+                            "\n=================================\n");
+
+        bslma::TestAllocator ta("x", veryVeryVerbose);
+        bslma::TestAllocator tb("y", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE1  = DATA[ti].d_line;
+            const char *VALUE1 = DATA[ti].d_value;
+            const int   BLOCKS1 = *VALUE1 ? 1 : 0;
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int   LINE2   = DATA[tj].d_line;
+                const char *VALUE2  = DATA[tj].d_value;
+                const int   BLOCKS2 = *VALUE2 ? 1 : 0;
+                {
+                    Obj mX(VALUE1, &ta);  const Obj& X = mX;
+                    Obj mY(VALUE2, &tb);  const Obj& Y = mY;
+
+                    const Int64 NUM_ALLOCATIONS =
+                                   ta.numAllocations() + tb.numAllocations();
+
+                    // Copy.
+
+                    Obj *mZ = new Obj(X);
+                    ASSERTV(LINE1, LINE2, X == *mZ);
+                    ASSERTV(LINE1, LINE2, X.data() == mZ->data());
+                    ASSERTV(LINE1, LINE2, 2 * BLOCKS1 == X.numReferences());
+
+                    // Assignment, including self-assignment and assignment
+                    // from a string sharing the representation.
+
+                    mX = X;
+                    ASSERTV(LINE1, LINE2, 2 * BLOCKS1 == X.numReferences());
+                    mX = *mZ;
+                    ASSERTV(LINE1, LINE2, 2 * BLOCKS1 == X.numReferences());
+
+                    *mZ = Y;
+                    ASSERTV(LINE1, LINE2, Y == *mZ);
+                    ASSERTV(LINE1, LINE2, BLOCKS1 == X.numReferences());
+                    ASSERTV(LINE1, LINE2, 2 * BLOCKS2 == Y.numReferences());
+                    ASSERTV(LINE1, LINE2, BLOCKS1 == ta.numBlocksInUse());
+                    ASSERTV(LINE1, LINE2, BLOCKS2 == tb.numBlocksInUse());
+
+                    // Swap, as a member and as a free function.
+
+                    mX.swap(*mZ);
+                    ASSERTV(LINE1, LINE2, X.data() == Y.data());
+                    ASSERTV(LINE1, LINE2, mZ->length() == strlen(VALUE1));
+                    swap(mX, *mZ);
+                    ASSERTV(LINE1, LINE2, mZ->data() == Y.data());
+                    ASSERTV(LINE1, LINE2, X.length() == strlen(VALUE1));
+
+                    // The last reference releases the representation.
+
+                    mY.reset();
+                    ASSERTV(LINE1, LINE2, Y.isEmpty());
+                    ASSERTV(LINE1, LINE2, BLOCKS2 == tb.numBlocksInUse());
+                    ASSERTV(LINE1, LINE2, BLOCKS2 == mZ->numReferences());
+
+                    delete mZ;
+                    ASSERTV(LINE1, LINE2, 0 == tb.numBlocksInUse());
+
+                    mY = X;
+                    mX.reset();
+                    ASSERTV(LINE1, LINE2, BLOCKS1 == ta.numBlocksInUse());
+                    ASSERTV(LINE1, LINE2, Y == bslstl::StringRef(VALUE1));
+
+                    ASSERTV(LINE1, LINE2, NUM_ALLOCATIONS ==
+                                    ta.numAllocations() + tb.numAllocations());
+                }
+                ASSERTV(LINE1, LINE2, 0 == ta.numBlocksInUse());
+                ASSERTV(LINE1, LINE2, 0 == tb.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed string is empty, and does not allocate.
+        //:
+        //: 2 A string created from characters has their value, and a
+        //:   reference count of 1.
+        //:
+        //: 3 A non-empty string allocates a single block, from the supplied
+        //:   allocator or, if none is supplied, from the default allocator.
+        //:   An empty string does not allocate.
+        //:
+        //: 4 The characters of a string are null-terminated, and may contain
+        //:   embedded null characters.
+        //:
+        //: 5 The accessors return consistent values.
+        //:
+        //: 6 The memory is returned to the allocator on destruction.
+        //:
+        //: 7 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each value in a table, create a string using each of the
+        //:   value constructors, with and without an allocator, and verify
+        //:   the accessors and the memory supplied by the allocators.
+        //:   (C-1..6)
+        //:
+        //: 2 Create a string from characters having an embedded null
+        //:   character.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   SharedString();
+        //   explicit SharedString(const char *characters, Allocator *ba = 0);
+        //   SharedString(const char *characters, size_type length, ba = 0);
+        //   ~SharedString();
+        //   const char& operator[](size_type position) const;
+        //   bslma::Allocator *allocator() const;
+        //   const_iterator begin() const;
+        //   const char *c_str() const;
+        //   const char *data() const;
+        //   const_iterator end() const;
+        //   bool isEmpty() const;
+        //   size_type length() const;
+        //   int numReferences() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nVALUE CONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n======================================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.numReferences());
+            ASSERT(0 == X.allocator());
+            ASSERT(0 == X.hashValue());
+            ASSERT(X.begin() == X.end());
+            ASSERT(0 == strcmp("", X.c_str()));
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *VALUE  = DATA[ti].d_value;
+            const int   LENGTH = static_cast<int>(strlen(VALUE));
+            const int   BLOCKS = LENGTH ? 1 : 0;
+
+            for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+                const Int64 NUM_TA = ta.numBlocksTotal();
+                const Int64 NUM_DA = defaultAllocator.numBlocksTotal();
+
+                Obj              *objPtr = 0;
+                bslma::Allocator *expectedAllocator = 0;
+
+                switch (cfg) {
+                  case 'a': {
+                    objPtr = new Obj(VALUE);
+                    expectedAllocator = &defaultAllocator;
+                  } break;
+                  case 'b': {
+                    objPtr = new Obj(VALUE, &ta);
+                    expectedAllocator = &ta;
+                  } break;
+                  case 'c': {
+                    objPtr = new Obj(VALUE, LENGTH);
+                    expectedAllocator = &defaultAllocator;
+                  } break;
+                  case 'd': {
+                    objPtr = new Obj(VALUE, LENGTH, &ta);
+                    expectedAllocator = &ta;
+                  } break;
+                  default: {
+                    ASSERTV(cfg, !"Bad allocator config.");
+                  } break;
+                }
+
+                const Obj& X = *objPtr;
+
+                bslma::TestAllocator& oa =
+                               *static_cast<bslma::TestAllocator *>(
+                                                            expectedAllocator);
+                bslma::TestAllocator& noa = &oa == &ta ? defaultAllocator
+                                                       : ta;
+
+                ASSERTV(LINE, cfg, LENGTH == static_cast<int>(X.length()));
+                ASSERTV(LINE, cfg, (0 == LENGTH) == X.isEmpty());
+                ASSERTV(LINE, cfg, BLOCKS == X.numReferences());
+                ASSERTV(LINE, cfg, (LENGTH ? expectedAllocator : 0)
+                                                           == X.allocator());
+                ASSERTV(LINE, cfg, X.data() == X.c_str());
+                ASSERTV(LINE, cfg, X.begin() == X.data());
+                ASSERTV(LINE, cfg, X.end() == X.data() + LENGTH);
+                ASSERTV(LINE, cfg, 0 == strcmp(VALUE, X.c_str()));
+                ASSERTV(LINE, cfg, X.data() != VALUE || 0 == LENGTH);
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LINE, cfg, i, VALUE[i] == X[i]);
+                }
+
+                const Int64 NUM_OA  = &oa == &ta ? NUM_TA : NUM_DA;
+                const Int64 NUM_NOA = &oa == &ta ? NUM_DA : NUM_TA;
+
+                ASSERTV(LINE, cfg, NUM_OA + BLOCKS == oa.numBlocksTotal());
+                ASSERTV(LINE, cfg, BLOCKS == oa.numBlocksInUse());
+                ASSERTV(LINE, cfg, NUM_NOA == noa.numBlocksTotal());
+
+                delete objPtr;
+
+                ASSERTV(LINE, cfg, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) printf("\tEmbedded null characters.\n");
+        {
+            const char VALUE[] = "ab\0cd";
+
+            const Obj X(VALUE, 5, &ta);
+            ASSERT(5    == X.length());
+            ASSERT('\0' == X[2]);
+            ASSERT('d'  == X[4]);
+            ASSERT('\0' == X.c_str()[5]);
+            ASSERT(X != Obj(VALUE, &ta));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(Obj((const char *)0, 0, &ta));
+            ASSERT_SAFE_FAIL(Obj((const char *)0, 1, &ta));
+            ASSERT_SAFE_FAIL(Obj((const char *)0, &ta));
+
+            const Obj X("abc", &ta);
+            ASSERT_SAFE_PASS(X[2]);
+            ASSERT_SAFE_FAIL(X[3]);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create, copy, compare, and destroy a few strings.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX("IBM US Equity", &ta);  const Obj& X = mX;
+            ASSERT(13 == X.length());
+            ASSERT(1  == ta.numBlocksInUse());
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(2 == X.numReferences());
+            ASSERT(1 == ta.numBlocksInUse());
+
+            mY = Obj("VOD LN Equity", &ta);
+            ASSERT(X != Y);
+            ASSERT(1 == X.numReferences());
+            ASSERT(2 == ta.numBlocksInUse());
+            ASSERT(X < Y);
+
+            mX = Y;
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COPYING KEYS INTO MANY RECORDS
+        //
+        // Concerns:
+        //: 1 Copying a shared string into many records takes less memory, and
+        //:   less time, than copying a 'bsl::string' that does not fit in its
+        //:   short string buffer.
+        //
+        // Plan:
+        //: 1 For keys of several lengths, copy a key into a large number of
+        //:   records, and then destroy the records, using 'bsl::string' and
+        //:   'bslstl::SharedString'.  Report the memory per record (including
+        //:   the footprint) and the time taken per copy and per destruction.
+        //
+        // Testing:
+        //   PERFORMANCE: COPYING KEYS INTO MANY RECORDS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COPYING KEYS INTO MANY RECORDS"
+                            "\n===========================================\n");
+
+        const int NUM_ITERATIONS = argc > 2 && atoi(argv[2]) > 0
+                                   ? atoi(argv[2])
+                                   : 20;
+        const int NUM_RECORDS    = 100000;
+
+        const char *KEYS[] = {
+            "IBM US",
+            "VOD LN Equity",
+            "VOD LN Equity (London Stock Exchange)",
+            "US912828U816 Govt (United States Treasury Note/Bond)",
+        };
+        const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            SharedStringBenchmarkUtil<bsl::string>::run("bsl::string",
+                                                        KEYS[i],
+                                                        NUM_RECORDS,
+                                                        NUM_ITERATIONS);
+            SharedStringBenchmarkUtil<Obj>::run("bslstl::SharedString",
+                                                KEYS[i],
+                                                NUM_RECORDS,
+                                                NUM_ITERATIONS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
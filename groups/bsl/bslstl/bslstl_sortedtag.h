@@ -0,0 +1,187 @@
+// bslstl_sortedtag.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SORTEDTAG
+#define INCLUDED_BSLSTL_SORTEDTAG
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide tags asserting that a range of values is already sorted.
+//
+//@CLASSES:
+//  bsl::sorted_unique_t: tag type for sorted ranges of unique values
+//  bsl::sorted_equivalent_t: tag type for sorted ranges of values
+//
+//@SEE_ALSO: bslstl_map, bslstl_set, bslstl_multimap, bslstl_multiset
+//
+//@DESCRIPTION: This component provides two empty tag types,
+// 'bsl::sorted_unique_t' and 'bsl::sorted_equivalent_t', and a constant
+// object of each type, 'bsl::sorted_unique' and 'bsl::sorted_equivalent'.
+// The tags follow the C++23 tags of the same name, and are passed as the
+// first argument of the constructors and range 'insert' overloads of the
+// ordered associative containers to assert that the range of values supplied
+// is already sorted according to the comparator of the container, allowing
+// the container to build its tree directly from the range without comparing
+// the values:
+//
+//: 'sorted_unique':
+//:   Asserts that the range is sorted, and that no two values in the range
+//:   have equivalent keys.  Accepted by containers with unique keys (e.g.,
+//:   'bsl::map' and 'bsl::set').
+//:
+//: 'sorted_equivalent':
+//:   Asserts that the range is sorted, but allows values with equivalent keys.
+//:   Accepted by containers with equivalent keys (e.g., 'bsl::multimap' and
+//:   'bsl::multiset').
+//
+// The behavior of an operation accepting a tag is undefined if the range does
+// not satisfy the corresponding requirement.  Implementations are encouraged
+// to verify the requirement in safe build modes (see 'bsls_assert').
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Skipping a Sort for Sorted Input
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a container holding a sorted array of unique integers, that
+// sorts the values it is constructed from.  We want clients that already hold
+// sorted data to be able to skip the sort.
+//
+// First, we define the container, providing a constructor overload taking a
+// 'bsl::sorted_unique_t' as its first argument:
+//..
+//  class SortedIntArray {
+//      // This class holds a sorted array of unique 'int' values.
+//
+//      // DATA
+//      int d_values[16];  // sorted values
+//      int d_size;        // number of values
+//
+//    public:
+//      // CREATORS
+//      SortedIntArray(const int *first, const int *last)
+//          // Create an array holding the unique values in the specified
+//          // range '[first, last)'.  The behavior is undefined unless
+//          // 'last - first <= 16'.
+//      : d_size(0)
+//      {
+//          int values[16];
+//          std::copy(first, last, values);
+//          std::sort(values, values + (last - first));
+//          d_size = static_cast<int>(
+//                      std::unique(values, values + (last - first)) - values);
+//          std::copy(values, values + d_size, d_values);
+//      }
+//
+//      SortedIntArray(bsl::sorted_unique_t, const int *first, const int *last)
+//          // Create an array holding the values in the specified range
+//          // '[first, last)'.  The behavior is undefined unless the values
+//          // in the range are sorted and unique, and 'last - first <= 16'.
+//      : d_size(static_cast<int>(last - first))
+//      {
+//          std::copy(first, last, d_values);
+//      }
+//
+//      // ACCESSORS
+//      int operator[](int index) const { return d_values[index]; }
+//          // Return the value at the specified 'index'.
+//
+//      int size() const { return d_size; }
+//          // Return the number of values in this array.
+//  };
+//..
+// Then, we create an array from unsorted values:
+//..
+//  const int VALUES[] = { 5, 1, 3, 1 };
+//
+//  SortedIntArray a(VALUES, VALUES + 4);
+//  assert(3 == a.size());
+//  assert(1 == a[0]);  assert(3 == a[1]);  assert(5 == a[2]);
+//..
+// Finally, we create an array from values we know to be sorted and unique,
+// passing 'bsl::sorted_unique' to skip the sort:
+//..
+//  const int SORTED[] = { 2, 4, 6 };
+//
+//  SortedIntArray b(bsl::sorted_unique, SORTED, SORTED + 3);
+//  assert(3 == b.size());
+//  assert(2 == b[0]);  assert(4 == b[1]);  assert(6 == b[2]);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_map.h> instead of <bslstl_sortedtag.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+namespace bsl {
+
+                           // ======================
+                           // struct sorted_unique_t
+                           // ======================
+
+struct sorted_unique_t {
+    // This empty 'struct' is a tag type, asserting that a range of values is
+    // sorted and that no two values in the range have equivalent keys.
+
+    // CREATORS
+    sorted_unique_t() {}
+        // Create a 'sorted_unique_t' object.  Note that a user-provided
+        // default constructor is required to define a 'const' object of this
+        // type.
+};
+
+extern const sorted_unique_t sorted_unique;
+    // This object is passed to indicate that a range of values is sorted and
+    // that no two values in the range have equivalent keys.
+
+                         // ==========================
+                         // struct sorted_equivalent_t
+                         // ==========================
+
+struct sorted_equivalent_t {
+    // This empty 'struct' is a tag type, asserting that a range of values is
+    // sorted (and may hold values having equivalent keys).
+
+    // CREATORS
+    sorted_equivalent_t() {}
+        // Create a 'sorted_equivalent_t' object.  Note that a user-provided
+        // default constructor is required to define a 'const' object of this
+        // type.
+};
+
+extern const sorted_equivalent_t sorted_equivalent;
+    // This object is passed to indicate that a range of values is sorted.
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
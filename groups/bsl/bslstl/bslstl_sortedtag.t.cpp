@@ -0,0 +1,293 @@
+// bslstl_sortedtag.t.cpp                                             -*-C++-*-
+#include <bslstl_sortedtag.h>
+
+#include <bslmf_issame.h>                  // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+
+#include <algorithm>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// This component provides two empty tag types, and a constant object of each.
+// We verify that the types are distinct, that the objects have the expected
+// types, and that the tags select the intended overload of a function.
+//-----------------------------------------------------------------------------
+// [ 1] struct sorted_unique_t;
+// [ 1] struct sorted_equivalent_t;
+// [ 1] const sorted_unique_t sorted_unique;
+// [ 1] const sorted_equivalent_t sorted_equivalent;
+//-----------------------------------------------------------------------------
+// [ 2] USAGE EXAMPLE
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int overload(...)
+    // Return 0.
+{
+    return 0;
+}
+
+int overload(bsl::sorted_unique_t)
+    // Return 1.
+{
+    return 1;
+}
+
+int overload(bsl::sorted_equivalent_t)
+    // Return 2.
+{
+    return 2;
+}
+
+template <class TYPE>
+bool isSameType(const TYPE&, const TYPE&)
+    // Return 'true'.  Note that this function is only viable if both
+    // arguments have the same type (ignoring cv-qualification).
+{
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Skipping a Sort for Sorted Input
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a container holding a sorted array of unique integers, that
+// sorts the values it is constructed from.  We want clients that already hold
+// sorted data to be able to skip the sort.
+//
+// First, we define the container, providing a constructor overload taking a
+// 'bsl::sorted_unique_t' as its first argument:
+//..
+    class SortedIntArray {
+        // This class holds a sorted array of unique 'int' values.
+
+        // DATA
+        int d_values[16];  // sorted values
+        int d_size;        // number of values
+
+      public:
+        // CREATORS
+        SortedIntArray(const int *first, const int *last)
+            // Create an array holding the unique values in the specified
+            // range '[first, last)'.  The behavior is undefined unless
+            // 'last - first <= 16'.
+        : d_size(0)
+        {
+            int values[16];
+            std::copy(first, last, values);
+            std::sort(values, values + (last - first));
+            d_size = static_cast<int>(
+                        std::unique(values, values + (last - first)) - values);
+            std::copy(values, values + d_size, d_values);
+        }
+
+        SortedIntArray(bsl::sorted_unique_t, const int *first, const int *last)
+            // Create an array holding the values in the specified range
+            // '[first, last)'.  The behavior is undefined unless the values
+            // in the range are sorted and unique, and 'last - first <= 16'.
+        : d_size(static_cast<int>(last - first))
+        {
+            std::copy(first, last, d_values);
+        }
+
+        // ACCESSORS
+        int operator[](int index) const { return d_values[index]; }
+            // Return the value at the specified 'index'.
+
+        int size() const { return d_size; }
+            // Return the number of values in this array.
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create an array from unsorted values:
+//..
+    const int VALUES[] = { 5, 1, 3, 1 };
+
+    SortedIntArray a(VALUES, VALUES + 4);
+    ASSERT(3 == a.size());
+    ASSERT(1 == a[0]);  ASSERT(3 == a[1]);  ASSERT(5 == a[2]);
+//..
+// Finally, we create an array from values we know to be sorted and unique,
+// passing 'bsl::sorted_unique' to skip the sort:
+//..
+    const int SORTED[] = { 2, 4, 6 };
+
+    SortedIntArray b(bsl::sorted_unique, SORTED, SORTED + 3);
+    ASSERT(3 == b.size());
+    ASSERT(2 == b[0]);  ASSERT(4 == b[1]);  ASSERT(6 == b[2]);
+//..
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The tag types are distinct.
+        //:
+        //: 2 'sorted_unique' and 'sorted_equivalent' have the corresponding
+        //:   tag types, and can be copied.
+        //:
+        //: 3 Each tag selects the overload of a function taking its type.
+        //
+        // Plan:
+        //: 1 Use 'bslmf::IsSame' to verify the types are distinct.  (C-1)
+        //:
+        //: 2 Pass each object (and a copy of it) to a function template
+        //:   deducing a single type from two arguments.  (C-2)
+        //:
+        //: 3 Call a function overloaded for each tag type (and for an
+        //:   ellipsis) with each object, and verify the overload called.
+        //:   (C-3)
+        //
+        // Testing:
+        //   struct sorted_unique_t;
+        //   struct sorted_equivalent_t;
+        //   const sorted_unique_t sorted_unique;
+        //   const sorted_equivalent_t sorted_equivalent;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT((!bslmf::IsSame<bsl::sorted_unique_t,
+                               bsl::sorted_equivalent_t>::value));
+
+        const bsl::sorted_unique_t     U = bsl::sorted_unique;
+        const bsl::sorted_equivalent_t E = bsl::sorted_equivalent;
+
+        ASSERT(isSameType(U, bsl::sorted_unique_t()));
+        ASSERT(isSameType(E, bsl::sorted_equivalent_t()));
+
+        ASSERT(1 == overload(bsl::sorted_unique));
+        ASSERT(2 == overload(bsl::sorted_equivalent));
+        ASSERT(1 == overload(U));
+        ASSERT(2 == overload(E));
+        ASSERT(0 == overload(0));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
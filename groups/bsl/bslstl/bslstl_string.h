@@ -13,6 +13,8 @@ BSLS_IDENT("$Id: $")
 //  bsl::basic_string: C++ standard compliant 'basic_string' implementation
 //  bsl::string: 'typedef' for 'bsl::basic_string<char>'
 //  bsl::wstring: 'typedef' for 'bsl::basic_string<wchar>'
+//  bslstl::StringBufferAllocator: allocator configuring the short buffer size
+//  bslstl::ShortBufferString: meta-function for strings with a larger buffer
 //
 //@SEE_ALSO: ISO C++ Standard, Section 21 [strings]
 //
@@ -62,6 +64,37 @@ BSLS_IDENT("$Id: $")
 // use the default allocator installed at the time of the 'basic_string''s
 // construction (see 'bslma_default').
 //
+///Short String Buffer Size
+///------------------------
+// A 'basic_string' stores a string whose length does not exceed the capacity
+// of a short buffer, held within the 'basic_string' object itself, without
+// allocating memory.  By default the short buffer occupies 20 bytes (rounded
+// up to a multiple of the word size), which holds, e.g., 23 'char's on a
+// 64-bit platform.  Applications whose strings are typically somewhat longer
+// (e.g., keys and identifiers of 24 to 40 characters) can configure a larger
+// short buffer by instantiating 'basic_string' with the allocator
+// 'bslstl::StringBufferAllocator<CHAR_TYPE, N>', which behaves exactly as
+// 'bsl::allocator<CHAR_TYPE>' but specifies a short buffer of (at least) 'N'
+// bytes.  The meta-function 'bslstl::ShortBufferString<N, CHAR_TYPE>' names
+// the resulting 'basic_string' type.  Note that the footprint of each such
+// object grows by the additional size of the buffer.
+//
+// A 'basic_string' having a configured short buffer size interoperates with
+// a 'basic_string' having the same character type and traits, but a different
+// allocator type (e.g., 'bsl::string'): each can be constructed and assigned
+// from the other, the two can be compared using the free comparison
+// operators, and both bind to a 'bslstl::StringRef'.  For example:
+//..
+//  typedef bslstl::ShortBufferString<40>::Type Key;
+//
+//  Key         key("customer.account.region.12345");  // does not allocate
+//  bsl::string copy(key);                             // allocates
+//  Key         other(copy);                           // does not allocate
+//
+//  assert(key == copy);
+//  assert(key == other);
+//..
+//
 ///Lexicographical Comparisons
 ///---------------------------
 // Two 'basic_string's 'lhs' and 'rhs' are lexicographically compared by first
@@ -577,6 +610,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_containerbase.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_CHARTRAITSUTIL
+#include <bslstl_chartraitsutil.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_HASH
 #include <bslstl_hash.h>
 #endif
@@ -593,6 +630,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_stringrefdata.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGSEARCHUTIL
+#include <bslstl_stringsearchutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
 #include <bslalg_scalarprimitives.h>
 #endif
@@ -692,80 +733,125 @@ namespace bsl {
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
 class basic_string;
 
-#if defined(BSLS_PLATFORM_CMP_SUN) || defined(BSLS_PLATFORM_CMP_HP)
-template <class ORIGINAL_TRAITS>
-class String_Traits {
-    // This 'class' provides an implementation of the 'find' function for the
-    // parameterized 'ORIGINAL_TRAITS' type.  This is an alternate
-    // representation for Sun's 'char_traits::find' that returns an incorrect
-    // result for character types other than 'char' (such as 'wchar').
+}  // close namespace bsl
 
-    // PRIVATE TYPES
-    typedef typename ORIGINAL_TRAITS::char_type char_type;
-    typedef native_std::size_t                  size_type;
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ===========================
+                        // class StringBufferAllocator
+                        // ===========================
+
+template <class TYPE, int SHORT_BUFFER_MIN_BYTES>
+class StringBufferAllocator : public bsl::allocator<TYPE> {
+    // This class template provides an STL-compatible allocator that behaves
+    // exactly as 'bsl::allocator<TYPE>' (from which it derives), and that, in
+    // addition, specifies that the short string buffer of a 'basic_string'
+    // using this allocator has room for at least 'SHORT_BUFFER_MIN_BYTES'
+    // bytes (rather than the default of 20).  See "Short String Buffer Size"
+    // in the component-level documentation.
 
   public:
-    // CLASS METHODS
-    static const char_type *find(const char_type  *s,
-                                 size_type         n,
-                                 const char_type&  a);
-        // Return an address providing non-modifiable access to the first
-        // character that matches the specified character 'a' in the specified
-        // 'n' characters of the specified 's' string.
-};
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StringBufferAllocator,
+                                   bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(StringBufferAllocator,
+                                   BloombergLP::bslmf::IsBitwiseMoveable);
+    BSLMF_NESTED_TRAIT_DECLARATION(StringBufferAllocator,
+                              BloombergLP::bslmf::IsBitwiseEqualityComparable);
 
-template <>
-class String_Traits<native_std::char_traits<char> > {
-    // Sun implemented 'find' for 'char' properly, so this specialization
-    // simply forwards the call to Sun.
+    // PUBLIC TYPES
+    template <class OTHER_TYPE>
+    struct rebind {
+        // This nested 'struct' template provides an 'other' type alias, which
+        // is the allocator type having the same short string buffer size that
+        // allocates elements of the (template parameter) 'OTHER_TYPE'.
+
+        typedef StringBufferAllocator<OTHER_TYPE, SHORT_BUFFER_MIN_BYTES>
+                                                                         other;
+    };
 
-    // PRIVATE TYPES
-    typedef native_std::size_t size_type;
+    // CREATORS
+    StringBufferAllocator();
+        // Create an allocator that forwards allocation calls to the currently
+        // installed default allocator.
 
-  public:
-    // CLASS METHODS
-    static const char *find(const char *s, size_type n, const char& a);
-        // Return an address providing non-modifiable access to the first
-        // character that matches the specified character 'a' in the specified
-        // 'n' characters of the specified 's' string.
+    StringBufferAllocator(bslma::Allocator *mechanism);             // IMPLICIT
+        // Create an allocator that forwards allocation calls to the specified
+        // 'mechanism'.  If 'mechanism' is 0, the currently installed default
+        // allocator is used.
+
+    template <class OTHER_TYPE>
+    StringBufferAllocator(const bsl::allocator<OTHER_TYPE>& original);
+                                                                    // IMPLICIT
+        // Create an allocator that forwards allocation calls to the mechanism
+        // of the specified 'original' allocator.
+
+    //! StringBufferAllocator(const StringBufferAllocator& original) = default;
+    //! ~StringBufferAllocator() = default;
+    //! StringBufferAllocator& operator=(const StringBufferAllocator&) =
+    //!                                                                default;
 };
 
-// CLASS METHODS
-template <class ORIGINAL_TRAITS>
-const typename ORIGINAL_TRAITS::char_type *
-String_Traits<ORIGINAL_TRAITS>::find(const char_type  *s,
-                                     size_type         n,
-                                     const char_type&  a)
-{
-    while (n > 0 && !ORIGINAL_TRAITS::eq(*s, a)) {
-        --n;
-        ++s;
-    }
-    return n > 0 ? s : 0;
-}
+                        // ========================
+                        // struct ShortBufferString
+                        // ========================
+
+template <int SHORT_BUFFER_MIN_BYTES, class CHAR_TYPE = char>
+struct ShortBufferString {
+    // This meta-function provides, as 'Type', the 'bsl::basic_string' type
+    // for the (template parameter) 'CHAR_TYPE' whose short string buffer has
+    // room for at least 'SHORT_BUFFER_MIN_BYTES' bytes, and that uses
+    // 'bslma'-style allocators.
+
+    typedef bsl::basic_string<
+                     CHAR_TYPE,
+                     native_std::char_traits<CHAR_TYPE>,
+                     StringBufferAllocator<CHAR_TYPE, SHORT_BUFFER_MIN_BYTES> >
+                                                                          Type;
+};
 
-inline
-const char *
-String_Traits<native_std::char_traits<char> >::find(const char  *s,
-                                                    size_type    n,
-                                                    const char&  a)
-{
-    return native_std::char_traits<char>::find(s, n, a);
-}
+}  // close package namespace
+}  // close enterprise namespace
 
-#define BSLSTL_CHAR_TRAITS String_Traits<CHAR_TRAITS>
+namespace bsl {
 
-#else
+                        // =============================
+                        // struct String_ShortBufferSize
+                        // =============================
 
-#define BSLSTL_CHAR_TRAITS CHAR_TRAITS
+template <class ALLOCATOR>
+struct String_ShortBufferSize {
+    // This component-private meta-function provides, as 'VALUE', the minimum
+    // size, in bytes, of the short string buffer of a 'basic_string' using the
+    // (template parameter) 'ALLOCATOR'.
 
-#endif
+    enum { VALUE = 20 };
+};
+
+template <class TYPE, int SHORT_BUFFER_MIN_BYTES>
+struct String_ShortBufferSize<
+        BloombergLP::bslstl::StringBufferAllocator<TYPE,
+                                                   SHORT_BUFFER_MIN_BYTES> > {
+    // This partial specialization provides the buffer size specified by a
+    // 'bslstl::StringBufferAllocator'.
+
+    enum { VALUE = SHORT_BUFFER_MIN_BYTES };
+};
+
+#define BSLSTL_CHAR_TRAITS BloombergLP::bslstl::CharTraitsUtil<CHAR_TRAITS>
+    // The operations of 'CHAR_TRAITS' on arrays of characters ('length',
+    // 'find', 'compare', and the filling 'assign') are performed through
+    // 'bslstl::CharTraitsUtil', which provides vectorized implementations for
+    // wide characters.
 
                         // ================
                         // class String_Imp
                         // ================
 
-template <typename CHAR_TYPE, typename SIZE_TYPE>
+template <typename CHAR_TYPE,
+          typename SIZE_TYPE,
+          int      SHORT_MIN_BYTES = 20>
 class String_Imp {
     // This component private 'class' describes the basic data layout for a
     // string class and provides methods to help encapsulate internal string
@@ -777,7 +863,9 @@ class String_Imp {
     // to implement a "short string optimization" such that strings with
     // lengths shorter than a certain number of characters are stored directly
     // inside the string object (inside the short string buffer), and thereby
-    // avoid memory allocations/deallocations.
+    // avoid memory allocations/deallocations.  The (template parameter)
+    // 'SHORT_MIN_BYTES' is the minimum size of the short string buffer in
+    // bytes (see 'String_ShortBufferSize').
 
   public:
     // TYPES
@@ -794,8 +882,9 @@ class String_Imp {
         // value.  It defines the capacity of the short string buffer and also
         // the capacity of the default-constructed empty string object.
 
-        SHORT_BUFFER_MIN_BYTES  = 20, // minimum required size of the short
-                                      // string buffer in bytes
+        SHORT_BUFFER_MIN_BYTES  = SHORT_MIN_BYTES,
+                                    // minimum required size of the short
+                                    // string buffer in bytes
 
         SHORT_BUFFER_NEED_BYTES =
                               (SHORT_BUFFER_MIN_BYTES + sizeof(SIZE_TYPE) - 1)
@@ -935,7 +1024,9 @@ template <typename CHAR_TYPE,
           typename CHAR_TRAITS = char_traits<CHAR_TYPE>,
           typename ALLOCATOR = allocator<CHAR_TYPE> >
 class basic_string
-    : private String_Imp<CHAR_TYPE, typename ALLOCATOR::size_type>
+    : private String_Imp<CHAR_TYPE,
+                         typename ALLOCATOR::size_type,
+                         String_ShortBufferSize<ALLOCATOR>::VALUE>
     , public BloombergLP::bslalg::ContainerBase<ALLOCATOR>
 {
     // This class template provides an STL-compliant 'string' that conforms to
@@ -989,7 +1080,9 @@ class basic_string
 
   private:
     // PRIVATE TYPES
-    typedef String_Imp<CHAR_TYPE, typename ALLOCATOR::size_type> Imp;
+    typedef String_Imp<CHAR_TYPE,
+                       typename ALLOCATOR::size_type,
+                       String_ShortBufferSize<ALLOCATOR>::VALUE> Imp;
 
     // PRIVATE MANIPULATORS
 
@@ -1335,6 +1428,19 @@ class basic_string
         // memory.  If 'allocator' is not specified, then a default-constructed
         // allocator is used.
 
+    template <typename ALLOC2>
+    basic_string(
+              const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& original,
+              const ALLOCATOR&                                  allocator =
+                                                                 ALLOCATOR());
+        // Create a string that has the same value as the specified 'original'
+        // string, where the type of 'original' is a 'basic_string' having the
+        // same character type and traits type, but a different allocator type
+        // (e.g., a 'bslstl::StringBufferAllocator' specifying a different
+        // short string buffer size).  Optionally specify an 'allocator' used
+        // to supply memory.  If 'allocator' is not specified, then a
+        // default-constructed allocator is used.
+
     basic_string(const BloombergLP::bslstl::StringRefData<CHAR_TYPE>& strRef,
                  const ALLOCATOR& allocator = ALLOCATOR());
         // Create a string that has the same value as the specified 'strRef'
@@ -1377,6 +1483,26 @@ class basic_string
         // the appropriate number of copies of the specified 'character' at the
         // end if 'length() < newLength'.
 
+    template <class OPERATION>
+    void resize_and_overwrite(size_type newLength, OPERATION operation);
+        // Ensure this string can hold at least the specified 'newLength'
+        // characters, invoke the specified 'operation' as
+        // 'operation(data, newLength)', where 'data' is a 'CHAR_TYPE *'
+        // addressing the first character of this string, and set the length
+        // of this string to the value returned by 'operation'.  Throw
+        // 'length_error' if 'newLength > max_size()'.  'operation' must
+        // return a value convertible to 'size_type' that is not greater than
+        // 'newLength', and must write every character in the range
+        // '[length(), result)' it intends to keep (where 'result' is the
+        // returned value); the first 'min(length(), newLength)' characters
+        // hold the original contents of this string, and the remaining
+        // characters in '[data, data + newLength)' have unspecified values
+        // on entry.  If 'operation' throws, this string is left in a valid
+        // but unspecified state.  Note that, unlike 'resize', this method
+        // does not initialize characters that 'operation' will overwrite,
+        // making it suitable for using a string as the target buffer of an
+        // I/O or encoding operation.
+
     void reserve(size_type newCapacity = 0);
         // Change the capacity of this string to the specified 'newCapacity'.
         // Note that the capacity of a string is the maximum length it can
@@ -2124,6 +2250,10 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
 bool
 operator==(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
            const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+bool
+operator==(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 bool operator==(const CHAR_TYPE                                  *lhs,
                 const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>&  rhs);
@@ -2146,6 +2276,10 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
 bool
 operator!=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
            const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+bool
+operator!=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 bool operator!=(const CHAR_TYPE                                  *lhs,
                 const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>&  rhs);
@@ -2168,6 +2302,10 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
 bool
 operator<(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
           const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+bool
+operator<(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+          const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 bool operator<(const CHAR_TYPE                                  *lhs,
                const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>&  rhs);
@@ -2189,6 +2327,10 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
 bool
 operator>(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
           const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+bool
+operator>(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+          const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 bool operator>(const CHAR_TYPE                                  *lhs,
                const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>&  rhs);
@@ -2210,6 +2352,10 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
 bool
 operator<=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
            const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+bool
+operator<=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 bool operator<=(const CHAR_TYPE                                  *lhs,
                 const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>&  rhs);
@@ -2232,6 +2378,10 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
 bool
 operator>=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
            const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+bool
+operator>=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs);
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 bool operator>=(const CHAR_TYPE                                  *lhs,
                 const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>&  rhs);
@@ -2373,11 +2523,12 @@ struct hash<basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> >
                           // ----------------
 
 // CLASS METHODS
-template <typename CHAR_TYPE, typename SIZE_TYPE>
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
 SIZE_TYPE
-String_Imp<CHAR_TYPE, SIZE_TYPE>::computeNewCapacity(SIZE_TYPE newLength,
-                                                     SIZE_TYPE oldCapacity,
-                                                     SIZE_TYPE maxSize)
+String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::computeNewCapacity(
+                                                        SIZE_TYPE newLength,
+                                                        SIZE_TYPE oldCapacity,
+                                                        SIZE_TYPE maxSize)
 {
     BSLS_ASSERT_SAFE(newLength >= oldCapacity);
 
@@ -2404,17 +2555,18 @@ String_Imp<CHAR_TYPE, SIZE_TYPE>::computeNewCapacity(SIZE_TYPE newLength,
 }
 
 // CREATORS
-template <typename CHAR_TYPE, typename SIZE_TYPE>
-String_Imp<CHAR_TYPE, SIZE_TYPE>::String_Imp()
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
+String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::String_Imp()
 : d_start_p(0)
 , d_length(0)
 , d_capacity(SHORT_BUFFER_CAPACITY)
 {
 }
 
-template <typename CHAR_TYPE, typename SIZE_TYPE>
-String_Imp<CHAR_TYPE, SIZE_TYPE>::String_Imp(SIZE_TYPE length,
-                                             SIZE_TYPE capacity)
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
+String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::String_Imp(
+                                                           SIZE_TYPE length,
+                                                           SIZE_TYPE capacity)
 : d_start_p(0)
 , d_length(length)
 , d_capacity(capacity <= static_cast<SIZE_TYPE>(SHORT_BUFFER_CAPACITY)
@@ -2424,8 +2576,8 @@ String_Imp<CHAR_TYPE, SIZE_TYPE>::String_Imp(SIZE_TYPE length,
 }
 
 // MANIPULATORS
-template <typename CHAR_TYPE, typename SIZE_TYPE>
-void String_Imp<CHAR_TYPE, SIZE_TYPE>::swap(String_Imp& other)
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
+void String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::swap(String_Imp& other)
 {
     if (!isShortString() && !other.isShortString()) {
         // If both strings are long, swap the individual fields.
@@ -2441,18 +2593,18 @@ void String_Imp<CHAR_TYPE, SIZE_TYPE>::swap(String_Imp& other)
 }
 
 // PRIVATE MANIPULATORS
-template <typename CHAR_TYPE, typename SIZE_TYPE>
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
 inline
-void String_Imp<CHAR_TYPE, SIZE_TYPE>::resetFields()
+void String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::resetFields()
 {
     d_start_p  = 0;
     d_length   = 0;
     d_capacity = SHORT_BUFFER_CAPACITY;
 }
 
-template <typename CHAR_TYPE, typename SIZE_TYPE>
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
 inline
-CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE>::dataPtr()
+CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::dataPtr()
 {
     return isShortString()
            ? reinterpret_cast<CHAR_TYPE *>((void *)d_short.buffer())
@@ -2460,16 +2612,17 @@ CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE>::dataPtr()
 }
 
 // PRIVATE ACCESSORS
-template <typename CHAR_TYPE, typename SIZE_TYPE>
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
 inline
-bool String_Imp<CHAR_TYPE, SIZE_TYPE>::isShortString() const
+bool String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::isShortString() const
 {
     return d_capacity == SHORT_BUFFER_CAPACITY;
 }
 
-template <typename CHAR_TYPE, typename SIZE_TYPE>
+template <typename CHAR_TYPE, typename SIZE_TYPE, int SHORT_MIN_BYTES>
 inline
-const CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE>::dataPtr() const
+const CHAR_TYPE *
+String_Imp<CHAR_TYPE, SIZE_TYPE, SHORT_MIN_BYTES>::dataPtr() const
 {
     return isShortString()
           ? reinterpret_cast<const CHAR_TYPE *>((const void *)d_short.buffer())
@@ -2660,7 +2813,9 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateAppendRaw(
 
     size_type newLength = this->d_length + numChars;
     privateReserveRaw(newLength);
-    CHAR_TRAITS::assign(this->dataPtr() + this->d_length, numChars, character);
+    BSLSTL_CHAR_TRAITS::assign(this->dataPtr() + this->d_length,
+                               numChars,
+                               character);
     this->d_length = newLength;
     CHAR_TRAITS::assign(*(this->dataPtr() + newLength), CHAR_TYPE());
     return *this;
@@ -2968,7 +3123,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateReplaceRaw(
     if (newBuffer) {
         CHAR_TYPE *dest = newBuffer + outPosition;
 
-        CHAR_TRAITS::assign(dest, numChars, character);
+        BSLSTL_CHAR_TRAITS::assign(dest, numChars, character);
         CHAR_TRAITS::copy(dest + numChars, tail, tailLen);
         CHAR_TRAITS::assign(*(newBuffer + newLength), CHAR_TYPE());
 
@@ -2981,7 +3136,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateReplaceRaw(
         CHAR_TYPE *dest = this->dataPtr() + outPosition;
 
         CHAR_TRAITS::move(dest + numChars, tail, tailLen);
-        CHAR_TRAITS::assign(dest, numChars, character);
+        BSLSTL_CHAR_TRAITS::assign(dest, numChars, character);
         CHAR_TRAITS::assign(*(this->dataPtr() + newLength), CHAR_TYPE());
     }
 
@@ -3194,9 +3349,9 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateResizeRaw(
     privateReserveRaw(newLength);
 
     if (newLength > this->d_length) {
-        CHAR_TRAITS::assign(this->dataPtr() + this->d_length,
-                            newLength - this->d_length,
-                            character);
+        BSLSTL_CHAR_TRAITS::assign(this->dataPtr() + this->d_length,
+                                   newLength - this->d_length,
+                                   character);
     }
     this->d_length = newLength;
     CHAR_TRAITS::assign(*(this->dataPtr() + this->d_length), CHAR_TYPE());
@@ -3218,7 +3373,7 @@ int basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateCompareRaw(
 
     size_type numChars = lhsNumChars < otherNumChars ? lhsNumChars
                                                      : otherNumChars;
-    int cmpResult = CHAR_TRAITS::compare(this->dataPtr() + lhsPosition,
+    int cmpResult = BSLSTL_CHAR_TRAITS::compare(this->dataPtr() + lhsPosition,
                                          other,
                                          numChars);
     if (cmpResult) {
@@ -3344,6 +3499,17 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::basic_string(
     this->assign(original.data(), original.length());
 }
 
+template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
+template <typename ALLOC2>
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::basic_string(
+              const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& original,
+              const ALLOCATOR&                                  allocator)
+: Imp()
+, BloombergLP::bslalg::ContainerBase<allocator_type>(allocator)
+{
+    this->assign(original.data(), original.length());
+}
+
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
 inline
 basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::basic_string(
@@ -3419,6 +3585,27 @@ void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::resize(size_type newLength)
     privateResizeRaw(newLength, CHAR_TYPE());
 }
 
+template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
+template <class OPERATION>
+void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::resize_and_overwrite(
+                                                   size_type newLength,
+                                                   OPERATION operation)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newLength > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                   "string<...>::resize_and_overwrite(n,op): string too long");
+    }
+    privateReserveRaw(newLength);
+
+    size_type result = operation(this->dataPtr(), newLength);
+
+    BSLS_ASSERT(result <= newLength);
+
+    this->d_length = result;
+    CHAR_TRAITS::assign(*(this->dataPtr() + this->d_length), CHAR_TYPE());
+}
+
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
 void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::reserve(
                                                          size_type newCapacity)
@@ -3617,7 +3804,8 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(
 {
     BSLS_ASSERT_SAFE(characterString);
 
-    return append(characterString, CHAR_TRAITS::length(characterString));
+    return append(characterString,
+                  BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -3700,7 +3888,8 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::assign(
 {
     BSLS_ASSERT_SAFE(characterString);
 
-    return assign(characterString, CHAR_TRAITS::length(characterString));
+    return assign(characterString,
+                  BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -3813,7 +4002,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::insert(
 
     return insert(position,
                   characterString,
-                  CHAR_TRAITS::length(characterString));
+                  BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4079,7 +4268,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::replace(
     return replace(outPosition,
                    outNumChars,
                    characterString,
-                   CHAR_TRAITS::length(characterString));
+                   BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4182,7 +4371,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::replace(
     return replace(first,
                    last,
                    characterString,
-                   CHAR_TRAITS::length(characterString));
+                   BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4477,22 +4666,13 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find(
     if (position > length() || numChars > remChars) {
         return npos;                                                  // RETURN
     }
-    if (0 == numChars) {
-        return position;                                              // RETURN
-    }
-    const CHAR_TYPE *thisString = this->dataPtr() + position;
-    const CHAR_TYPE *nextString;
-    for (remChars -= numChars - 1;
-         0 != (nextString = BSLSTL_CHAR_TRAITS::find(thisString,
-                                                     remChars,
-                                                     *string));
-         remChars -= ++nextString - thisString, thisString = nextString)
-    {
-        if (0 == CHAR_TRAITS::compare(nextString, string, numChars)) {
-            return nextString - this->dataPtr();                      // RETURN
-        }
-    }
-    return npos;
+    const CHAR_TYPE *result =
+        BloombergLP::bslstl::StringSearchUtil<CHAR_TRAITS>::find(
+                                                   this->dataPtr() + position,
+                                                   remChars,
+                                                   string,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4503,7 +4683,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find(
 {
     BSLS_ASSERT_SAFE(string);
 
-    return find(string, position, CHAR_TRAITS::length(string));
+    return find(string, position, BSLSTL_CHAR_TRAITS::length(string));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4542,20 +4722,19 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::rfind(
     if (0 == numChars) {
         return position > length() ? length() : position;             // RETURN
     }
-    if (numChars <= length()) {
-        if (position > length() - numChars) {
-            position = length() - numChars;
-        }
-        const CHAR_TYPE *thisString = this->dataPtr() + position;
-        for (; position != npos; --thisString, --position) {
-            if (0 == CHAR_TRAITS::compare(thisString,
-                                          characterString,
-                                          numChars)) {
-                return position;                                      // RETURN
-            }
-        }
+    if (numChars > length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    if (position > length() - numChars) {
+        position = length() - numChars;
+    }
+    const CHAR_TYPE *result =
+        BloombergLP::bslstl::StringSearchUtil<CHAR_TRAITS>::rfind(
+                                                          this->dataPtr(),
+                                                          position + numChars,
+                                                          characterString,
+                                                          numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4568,7 +4747,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::rfind(
 
     return rfind(characterString,
                  position,
-                 CHAR_TRAITS::length(characterString));
+                 BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4597,18 +4776,16 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_of(
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (0 < numChars && position < length()) {
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != this->dataPtr() + length();
-             ++current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(characterString, numChars, *current)
-                != 0) {
-                return current - this->dataPtr();                     // RETURN
-            }
-        }
+    if (position >= length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    const CHAR_TYPE *result =
+        BloombergLP::bslstl::StringSearchUtil<CHAR_TRAITS>::findFirstOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4621,7 +4798,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_of(
 
     return find_first_of(characterString,
                          position,
-                         CHAR_TRAITS::length(characterString));
+                         BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4651,22 +4828,17 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_of(
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (0 < numChars && 0 < length()) {
-        size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             ;
-             --current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-            if (current == this->dataPtr()) {
-                break;
-            }
-        }
+    if (0 == length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    size_type remChars = position < length() ? position : length() - 1;
+    const CHAR_TYPE *result =
+        BloombergLP::bslstl::StringSearchUtil<CHAR_TRAITS>::findLastOf(
+                                                              this->dataPtr(),
+                                                              remChars + 1,
+                                                              characterString,
+                                                              numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4679,7 +4851,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_of(
 
     return find_last_of(characterString,
                         position,
-                        CHAR_TRAITS::length(characterString));
+                        BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4709,19 +4881,16 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_not_of(
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (position < length()) {
-        const CHAR_TYPE *last = this->dataPtr() + length();
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != last;
-             ++current)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-        }
+    if (position >= length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    const CHAR_TYPE *result =
+        BloombergLP::bslstl::StringSearchUtil<CHAR_TRAITS>::findFirstNotOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4734,7 +4903,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_not_of(
 
     return find_first_not_of(characterString,
                              position,
-                             CHAR_TRAITS::length(characterString));
+                             BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4764,19 +4933,17 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_not_of (
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (0 < length()) {
-        size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             remChars != npos;
-             --current, --remChars)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-        }
+    if (0 == length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    size_type remChars = position < length() ? position : length() - 1;
+    const CHAR_TYPE *result =
+        BloombergLP::bslstl::StringSearchUtil<CHAR_TRAITS>::findLastNotOf(
+                                                              this->dataPtr(),
+                                                              remChars + 1,
+                                                              characterString,
+                                                              numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4789,7 +4956,7 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_not_of (
 
     return find_last_not_of(characterString,
                             position,
-                            CHAR_TRAITS::length(characterString));
+                            BSLSTL_CHAR_TRAITS::length(characterString));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4878,7 +5045,7 @@ int basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::compare(
     return privateCompareRaw(size_type(0),
                              length(),
                              other,
-                             CHAR_TRAITS::length(other));
+                             BSLSTL_CHAR_TRAITS::length(other));
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4915,7 +5082,7 @@ int basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::compare(
     return compare(lhsPosition,
                    lhsNumChars,
                    other,
-                   CHAR_TRAITS::length(other));
+                   BSLSTL_CHAR_TRAITS::length(other));
 }
 
 // FREE FUNCTIONS
@@ -4936,7 +5103,9 @@ bool operator==(const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>& lhs,
                 const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>& rhs)
 {
     return lhs.size() == rhs.size()
-        && 0 == CHAR_TRAITS::compare(lhs.data(), rhs.data(), lhs.size());
+        && 0 == BSLSTL_CHAR_TRAITS::compare(lhs.data(),
+                                            rhs.data(),
+                                            lhs.size());
 }
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
@@ -4946,7 +5115,9 @@ operator==(const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
            const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>&        rhs)
 {
     return lhs.size() == rhs.size()
-        && 0 == CHAR_TRAITS::compare(lhs.data(), rhs.data(), lhs.size());
+        && 0 == BSLSTL_CHAR_TRAITS::compare(lhs.data(),
+                                            rhs.data(),
+                                            lhs.size());
 }
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
@@ -4956,7 +5127,21 @@ operator==(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
            const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs)
 {
     return lhs.size() == rhs.size()
-        && 0 == CHAR_TRAITS::compare(lhs.data(), rhs.data(), lhs.size());
+        && 0 == BSLSTL_CHAR_TRAITS::compare(lhs.data(),
+                                            rhs.data(),
+                                            lhs.size());
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+inline
+bool
+operator==(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && 0 == BSLSTL_CHAR_TRAITS::compare(lhs.data(),
+                                            rhs.data(),
+                                            lhs.size());
 }
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
@@ -4966,9 +5151,9 @@ bool operator==(const CHAR_TYPE                                  *lhs,
 {
     BSLS_ASSERT_SAFE(lhs);
 
-    std::size_t len = CHAR_TRAITS::length(lhs);
+    std::size_t len = BSLSTL_CHAR_TRAITS::length(lhs);
     return len == rhs.size()
-        && 0 == CHAR_TRAITS::compare(lhs, rhs.data(), len);
+        && 0 == BSLSTL_CHAR_TRAITS::compare(lhs, rhs.data(), len);
 }
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
@@ -4978,9 +5163,9 @@ bool operator==(const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>& lhs,
 {
     BSLS_ASSERT_SAFE(rhs);
 
-    std::size_t len = CHAR_TRAITS::length(rhs);
+    std::size_t len = BSLSTL_CHAR_TRAITS::length(rhs);
     return lhs.size() == len
-        && 0 == CHAR_TRAITS::compare(lhs.data(), rhs, len);
+        && 0 == BSLSTL_CHAR_TRAITS::compare(lhs.data(), rhs, len);
 }
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
@@ -5009,6 +5194,15 @@ operator!=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
     return !(lhs == rhs);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+inline
+bool
+operator!=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 inline
 bool operator!=(const CHAR_TYPE                                  *lhs,
@@ -5035,7 +5229,7 @@ bool operator<(const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>& lhs,
 {
     const std::size_t minLen = lhs.length() < rhs.length()
                              ? lhs.length() : rhs.length();
-    int ret = CHAR_TRAITS::compare(lhs.data(), rhs.data(), minLen);
+    int ret = BSLSTL_CHAR_TRAITS::compare(lhs.data(), rhs.data(), minLen);
     if (0 == ret) {
         return lhs.length() < rhs.length();                           // RETURN
     }
@@ -5049,7 +5243,7 @@ operator<(const native_std::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
 {
     const std::size_t minLen = lhs.length() < rhs.length()
                              ? lhs.length() : rhs.length();
-    int ret = CHAR_TRAITS::compare(lhs.data(), rhs.data(), minLen);
+    int ret = BSLSTL_CHAR_TRAITS::compare(lhs.data(), rhs.data(), minLen);
     if (0 == ret) {
         return lhs.length() < rhs.length();                           // RETURN
     }
@@ -5063,7 +5257,21 @@ operator<(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
 {
     const std::size_t minLen = lhs.length() < rhs.length()
                              ? lhs.length() : rhs.length();
-    int ret = CHAR_TRAITS::compare(lhs.data(), rhs.data(), minLen);
+    int ret = BSLSTL_CHAR_TRAITS::compare(lhs.data(), rhs.data(), minLen);
+    if (0 == ret) {
+        return lhs.length() < rhs.length();                           // RETURN
+    }
+    return ret < 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+bool
+operator<(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+          const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs)
+{
+    const std::size_t minLen = lhs.length() < rhs.length()
+                             ? lhs.length() : rhs.length();
+    int ret = BSLSTL_CHAR_TRAITS::compare(lhs.data(), rhs.data(), minLen);
     if (0 == ret) {
         return lhs.length() < rhs.length();                           // RETURN
     }
@@ -5076,9 +5284,9 @@ bool operator<(const CHAR_TYPE                                  *lhs,
 {
     BSLS_ASSERT_SAFE(lhs);
 
-    const std::size_t lhsLen = CHAR_TRAITS::length(lhs);
+    const std::size_t lhsLen = BSLSTL_CHAR_TRAITS::length(lhs);
     const std::size_t minLen = lhsLen < rhs.length() ? lhsLen : rhs.length();
-    int ret = CHAR_TRAITS::compare(lhs, rhs.data(), minLen);
+    int ret = BSLSTL_CHAR_TRAITS::compare(lhs, rhs.data(), minLen);
     if (0 == ret) {
         return lhsLen < rhs.length();                                 // RETURN
     }
@@ -5091,9 +5299,9 @@ bool operator<(const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC>&  lhs,
 {
     BSLS_ASSERT_SAFE(rhs);
 
-    const std::size_t rhsLen = CHAR_TRAITS::length(rhs);
+    const std::size_t rhsLen = BSLSTL_CHAR_TRAITS::length(rhs);
     const std::size_t minLen = rhsLen < lhs.length() ? rhsLen : lhs.length();
-    int ret = CHAR_TRAITS::compare(lhs.data(), rhs, minLen);
+    int ret = BSLSTL_CHAR_TRAITS::compare(lhs.data(), rhs, minLen);
     if (0 == ret) {
         return lhs.length() < rhsLen;                                 // RETURN
     }
@@ -5125,6 +5333,15 @@ operator>(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
     return rhs < lhs;
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+inline
+bool
+operator>(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+          const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs)
+{
+    return rhs < lhs;
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 inline
 bool operator>(const CHAR_TYPE                                  *lhs,
@@ -5170,6 +5387,15 @@ operator<=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
     return !(rhs < lhs);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+inline
+bool
+operator<=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs)
+{
+    return !(rhs < lhs);
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 inline
 bool operator<=(const CHAR_TYPE                                  *lhs,
@@ -5215,6 +5441,15 @@ operator>=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>&        lhs,
     return !(lhs < rhs);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC1, class ALLOC2>
+inline
+bool
+operator>=(const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC1>& lhs,
+           const bsl::basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOC2>& rhs)
+{
+    return !(lhs < rhs);
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOC>
 inline
 bool operator>=(const CHAR_TYPE                                  *lhs,
@@ -5279,7 +5514,7 @@ operator+(const CHAR_TYPE                                      *lhs,
     BSLS_ASSERT_SAFE(lhs);
 
     typename basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::size_type
-                                          lhsLength = CHAR_TRAITS::length(lhs);
+                                   lhsLength = BSLSTL_CHAR_TRAITS::length(lhs);
     basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR> result;
     result.reserve(lhsLength + rhs.length());
     result.append(lhs, lhsLength);
@@ -5307,7 +5542,7 @@ operator+(const basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&  lhs,
     BSLS_ASSERT_SAFE(rhs);
 
     typename basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::size_type
-                                          rhsLength = CHAR_TRAITS::length(rhs);
+                                   rhsLength = BSLSTL_CHAR_TRAITS::length(rhs);
     basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR> result;
     result.reserve(lhs.length() + rhsLength);
     result += lhs;
@@ -5513,6 +5748,41 @@ hashBasicString(const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str)
 
 }  // close namespace bsl
 
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ---------------------------
+                        // class StringBufferAllocator
+                        // ---------------------------
+
+// CREATORS
+template <class TYPE, int SHORT_BUFFER_MIN_BYTES>
+inline
+StringBufferAllocator<TYPE, SHORT_BUFFER_MIN_BYTES>::StringBufferAllocator()
+: bsl::allocator<TYPE>()
+{
+}
+
+template <class TYPE, int SHORT_BUFFER_MIN_BYTES>
+inline
+StringBufferAllocator<TYPE, SHORT_BUFFER_MIN_BYTES>::StringBufferAllocator(
+                                                 bslma::Allocator *mechanism)
+: bsl::allocator<TYPE>(mechanism)
+{
+}
+
+template <class TYPE, int SHORT_BUFFER_MIN_BYTES>
+template <class OTHER_TYPE>
+inline
+StringBufferAllocator<TYPE, SHORT_BUFFER_MIN_BYTES>::StringBufferAllocator(
+                                 const bsl::allocator<OTHER_TYPE>& original)
+: bsl::allocator<TYPE>(original.mechanism())
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ============================================================================
 //                                TYPE TRAITS
 // ============================================================================
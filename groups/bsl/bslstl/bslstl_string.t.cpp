@@ -128,6 +128,7 @@ using namespace std;
 // [14] void resize(size_type n);
 // [14] void resize(size_type n, C c);
 // [14] void reserve(size_type n);
+// [30] void resize_and_overwrite(size_type n, OPERATION op);
 // [ 2] void clear();
 // [15] reference operator[](size_type pos);
 // [15] reference at(size_type pos);
@@ -250,6 +251,19 @@ using namespace std;
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
 // [25] CONCERN: 'std::length_error' is used properly
+// [28] CONCERN: short string optimization
+// [29] class bslstl::StringBufferAllocator
+// [29] struct bslstl::ShortBufferString
+// [29] string(const basic_string<C,CT,A2>& original, a = A());
+// [29] bool operator==(const string&, const basic_string<C,CT,A2>&);
+// [29] bool operator!=(const string&, const basic_string<C,CT,A2>&);
+// [29] bool operator<(const string&, const basic_string<C,CT,A2>&);
+// [29] bool operator>(const string&, const basic_string<C,CT,A2>&);
+// [29] bool operator<=(const string&, const basic_string<C,CT,A2>&);
+// [29] bool operator>=(const string&, const basic_string<C,CT,A2>&);
+// [31] USAGE EXAMPLE
+// [-2] PERFORMANCE: CONFIGURED SHORT STRING BUFFER SIZE
+// [-3] PERFORMANCE: 'resize_and_overwrite' VS. 'resize'
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(string *object, const char *spec, int vF = 1);
@@ -383,12 +397,6 @@ const int  LARGE_SIZE_VALUE = 2 * bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
     // Declare a large value for insertions into the string.  Note this value
     // will cause multiple resizes during insertion into the string.
 
-const size_t SHORT_STRING_BUFFER_BYTES
-                           = (20 + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1);
-    // The size of the short string buffer, according to our implementation (20
-    // bytes rounded to the word boundary - 1).  Appending one more than this
-    // number of characters to a default object causes a reallocation.
-
 const size_t INITIAL_CAPACITY_FOR_NON_EMPTY_OBJECT = 1;
                                 // bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1;
     // The capacity of a default constructed object after the first
@@ -789,6 +797,58 @@ inline
 bool isNativeString(const std::basic_string<TYPE,TRAITS,ALLOC>&)
     { return true; }
 
+                           // ======================
+                           // class OverwriteFunctor
+                           // ======================
+
+template <class TYPE>
+class OverwriteFunctor {
+    // This class implements a functor, suitable for
+    // 'basic_string::resize_and_overwrite', that records the arguments it is
+    // invoked with, writes a value to a range of the supplied buffer, and
+    // returns a length specified at construction.
+
+    // DATA
+    TYPE          d_value;       // value written to the buffer
+    size_t        d_begin;       // first position written
+    size_t        d_result;      // value returned (one past last written)
+    const TYPE  **d_data_p;      // address of supplied buffer (out)
+    size_t       *d_length_p;    // supplied length (out)
+
+  public:
+    // CREATORS
+    OverwriteFunctor(const TYPE&   value,
+                     size_t        begin,
+                     size_t        result,
+                     const TYPE  **data,
+                     size_t       *length)
+        // Create a functor that writes the specified 'value' to the positions
+        // '[begin, result)' of the buffer it is supplied, loads the buffer
+        // address and length it is supplied into the specified 'data' and
+        // 'length', and returns the specified 'result'.
+    : d_value(value)
+    , d_begin(begin)
+    , d_result(result)
+    , d_data_p(data)
+    , d_length_p(length)
+    {
+    }
+
+    // ACCESSORS
+    size_t operator()(TYPE *data, size_t length) const
+        // Overwrite the configured range of the specified 'data', record
+        // 'data' and the specified 'length', and return the configured
+        // result.
+    {
+        *d_data_p   = data;
+        *d_length_p = length;
+        for (size_t i = d_begin; i < d_result; ++i) {
+            data[i] = d_value;
+        }
+        return d_result;
+    }
+};
+
 //=============================================================================
 //                       TEST DRIVER TEMPLATE
 //-----------------------------------------------------------------------------
@@ -846,6 +906,15 @@ struct TestDriver {
 
     // CONSTANTS
     enum {
+        SHORT_STRING_BUFFER_BYTES =
+                   (bsl::String_ShortBufferSize<ALLOC>::VALUE
+                                + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1),
+            // The size of the short string buffer, according to our
+            // implementation (20 bytes, or the size specified by a
+            // 'bslstl::StringBufferAllocator', rounded to the word boundary).
+            // Appending one more than 'DEFAULT_CAPACITY' characters to a
+            // default object causes a reallocation.
+
         DEFAULT_CAPACITY = SHORT_STRING_BUFFER_BYTES / sizeof(TYPE) > 0
                                 ? SHORT_STRING_BUFFER_BYTES / sizeof(TYPE) - 1
                                 : 0
@@ -906,6 +975,12 @@ struct TestDriver {
         // specifications, and check that the specified 'result' agrees.
 
     // TEST CASES
+    static void testCase30();
+        // Test 'resize_and_overwrite'.
+
+    static void testCase29();
+        // Test strings having a configured short string buffer size.
+
     static void testCase28();
         // Test the short string optimization.
 
@@ -1191,6 +1266,341 @@ void TestDriver<TYPE,TRAITS,ALLOC>::checkCompare(const Obj& X,
                                  // TEST CASES
                                  // ----------
 
+template <class TYPE, class TRAITS, class ALLOC>
+void TestDriver<TYPE,TRAITS,ALLOC>::testCase30()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'resize_and_overwrite'
+    //
+    // Concerns:
+    //: 1 The operation is supplied the address of the string's buffer and the
+    //:   requested length, and the buffer has room for that many characters.
+    //:
+    //: 2 The characters preceding those written by the operation retain the
+    //:   original value of the string, the characters written by the
+    //:   operation are retained, and the length of the string is the value
+    //:   returned by the operation.
+    //:
+    //: 3 The string is null-terminated after the operation.
+    //:
+    //: 4 No memory is allocated if the requested length does not exceed the
+    //:   capacity of the string.
+    //:
+    //: 5 'std::length_error' is thrown if the requested length exceeds
+    //:   'max_size()'.
+    //:
+    //: 6 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 Using a table-driven technique, create strings of various lengths,
+    //:   invoke 'resize_and_overwrite' with an 'OverwriteFunctor' writing a
+    //:   range of the buffer and returning various lengths, and verify the
+    //:   arguments supplied to the functor, and the value, capacity, and
+    //:   allocations of the resulting string.  (C-1..4)
+    //:
+    //: 2 Using a 'LimitAllocator', verify that 'std::length_error' is thrown
+    //:   when the requested length exceeds 'max_size()'.  (C-5)
+    //:
+    //: 3 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered if the operation returns a value greater than the
+    //:   requested length (using the 'BSLS_ASSERTTEST_*' macros).  (C-6)
+    //
+    // Testing:
+    //   void resize_and_overwrite(size_type n, OPERATION op);
+    // ------------------------------------------------------------------------
+
+    const TYPE *values     = 0;
+    const int   NUM_VALUES = getValues(&values);
+    (void)NUM_VALUES;
+
+    const TYPE VALUE = values[1];
+
+    static const struct {
+        int    d_line;       // source line number
+        size_t d_length;     // initial length
+        size_t d_newLength;  // length supplied to 'resize_and_overwrite'
+        size_t d_begin;      // first position written by the operation
+        size_t d_result;     // length returned by the operation
+    } DATA[] = {
+        //LINE  LENGTH  NEW_LENGTH  BEGIN  RESULT
+        //----  ------  ----------  -----  ------
+        { L_,        0,          0,     0,      0 },
+        { L_,        0,          1,     0,      0 },
+        { L_,        0,          1,     0,      1 },
+        { L_,        3,          3,     3,      3 },
+        { L_,        3,          2,     2,      2 },
+        { L_,        3,          0,     0,      0 },
+        { L_,        3,         10,     3,      7 },
+        { L_,        3,         10,     3,     10 },
+        { L_,        3,         10,     0,     10 },
+        { L_,       10,         50,    10,     20 },
+        { L_,       10,         50,    10,     50 },
+        { L_,       50,         20,    20,     20 },
+        { L_,       50,        100,     5,     60 },
+        { L_,       50,        100,    50,    100 },
+        { L_,      100,        200,   100,    150 },
+        { L_,      100,        200,     0,      0 },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    if (verbose) printf("\nTesting 'resize_and_overwrite'.\n");
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int    LINE       = DATA[ti].d_line;
+        const size_t LENGTH     = DATA[ti].d_length;
+        const size_t NEW_LENGTH = DATA[ti].d_newLength;
+        const size_t BEGIN      = DATA[ti].d_begin;
+        const size_t RESULT     = DATA[ti].d_result;
+
+        if (veryVerbose) {
+            T_ P_(LINE); P_(LENGTH); P_(NEW_LENGTH); P_(BEGIN); P(RESULT);
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const Obj EXP = g(LENGTH, values[0]);
+
+        Obj mX(EXP, &oa);  const Obj& X = mX;
+
+        const size_t              CAPACITY = X.capacity();
+        const bsls::Types::Int64  BLOCKS   = oa.numBlocksTotal();
+
+        const TYPE *data   = 0;
+        size_t      length = 0;
+
+        mX.resize_and_overwrite(
+                 NEW_LENGTH,
+                 OverwriteFunctor<TYPE>(VALUE, BEGIN, RESULT, &data, &length));
+
+        LOOP_ASSERT(LINE, X.data()   == data);
+        LOOP_ASSERT(LINE, NEW_LENGTH == length);
+        LOOP_ASSERT(LINE, RESULT     == X.length());
+        LOOP_ASSERT(LINE, NEW_LENGTH <= X.capacity());
+        LOOP_ASSERT(LINE, TYPE()     == X.c_str()[RESULT]);
+
+        for (size_t i = 0; i < BEGIN && i < RESULT; ++i) {
+            LOOP2_ASSERT(LINE, i, EXP[i] == X[i]);
+        }
+        for (size_t i = BEGIN; i < RESULT; ++i) {
+            LOOP2_ASSERT(LINE, i, VALUE == X[i]);
+        }
+
+        if (NEW_LENGTH <= CAPACITY) {
+            LOOP_ASSERT(LINE, BLOCKS   == oa.numBlocksTotal());
+            LOOP_ASSERT(LINE, CAPACITY == X.capacity());
+        }
+    }
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (verbose) printf("\nTesting 'std::length_error'.\n");
+    {
+        typedef bsl::basic_string<TYPE,TRAITS,LimitAllocator<ALLOC> >
+                                                                      LimitObj;
+
+        bslma::TestAllocator  oa("object", veryVeryVeryVerbose);
+        LimitAllocator<ALLOC> a(&oa);
+
+        const size_t LENGTH = 32;
+
+        for (size_t limit = LENGTH - 2; limit <= LENGTH + 2; ++limit) {
+            a.setMaxSize(limit);
+
+            LimitObj mX(a);
+
+            const TYPE *data   = 0;
+            size_t      length = 0;
+
+            bool exceptionCaught = false;
+            try {
+                mX.resize_and_overwrite(
+                     LENGTH,
+                     OverwriteFunctor<TYPE>(VALUE, 0, LENGTH, &data, &length));
+            }
+            catch (std::length_error&) {
+                exceptionCaught = true;
+            }
+            LOOP_ASSERT(limit, (limit <= LENGTH) == exceptionCaught);
+            LOOP_ASSERT(limit, (limit <= LENGTH) == (0 == data));
+            LOOP_ASSERT(limit, (limit <= LENGTH ? 0 : LENGTH) == mX.length());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+    }
+#endif
+
+    if (verbose) printf("\nNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        const TYPE *data   = 0;
+        size_t      length = 0;
+
+        Obj mX;
+
+        ASSERT_PASS(mX.resize_and_overwrite(
+                        4,
+                        OverwriteFunctor<TYPE>(VALUE, 0, 4, &data, &length)));
+        ASSERT_FAIL(mX.resize_and_overwrite(
+                        4,
+                        OverwriteFunctor<TYPE>(VALUE, 5, 5, &data, &length)));
+    }
+}
+
+template <class TYPE, class TRAITS, class ALLOC>
+void TestDriver<TYPE,TRAITS,ALLOC>::testCase29()
+{
+    // ------------------------------------------------------------------------
+    // TESTING CONFIGURABLE SHORT STRING BUFFER SIZE
+    //
+    // Concerns:
+    //: 1 A string whose allocator is a 'bslstl::StringBufferAllocator' has a
+    //:   short string buffer of (at least) the specified size, and does not
+    //:   allocate until its length exceeds the capacity of that buffer.
+    //:
+    //: 2 Such a string converts to and from a 'bsl::basic_string' having the
+    //:   default allocator, both explicitly and implicitly, and the result
+    //:   uses the allocator supplied (or the default allocator).
+    //:
+    //: 3 Such a string compares with a 'bsl::basic_string' having the default
+    //:   allocator using all six comparison operators.
+    //:
+    //: 4 Such a string can be constructed from a 'bslstl::StringRefData'.
+    //:
+    //: 5 The 'bslma'-allocator traits of such a string are those of a
+    //:   'bsl::basic_string' having the default allocator.
+    //
+    // Plan:
+    //: 1 For each length up to twice the capacity of the short string
+    //:   buffer, create a string and a copy of it using a test allocator, and
+    //:   verify that memory is allocated only for lengths greater than
+    //:   'DEFAULT_CAPACITY'.  (C-1)
+    //:
+    //: 2 For each pair of a set of values, convert between the two string
+    //:   types, compare them, and bind a string reference to them.  Verify the
+    //:   results and the allocators in use.  (C-2..4)
+    //:
+    //: 3 Check the traits.  (C-5)
+    //
+    // Testing:
+    //   class bslstl::StringBufferAllocator
+    //   struct bslstl::ShortBufferString
+    //   basic_string(const basic_string<C,CT,A2>& original, const A& a);
+    //   bool operator==(const basic_string<C,CT,A1>&, const ...<C,CT,A2>&);
+    //   bool operator!=(const basic_string<C,CT,A1>&, const ...<C,CT,A2>&);
+    //   bool operator<(const basic_string<C,CT,A1>&, const ...<C,CT,A2>&);
+    //   bool operator>(const basic_string<C,CT,A1>&, const ...<C,CT,A2>&);
+    //   bool operator<=(const basic_string<C,CT,A1>&, const ...<C,CT,A2>&);
+    //   bool operator>=(const basic_string<C,CT,A1>&, const ...<C,CT,A2>&);
+    // ------------------------------------------------------------------------
+
+    typedef bsl::basic_string<TYPE, TRAITS> DefaultString;
+
+    bslma::TestAllocator oa(veryVeryVerbose);
+    bslma::TestAllocator da(veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (verbose) printf("\nShort string buffer capacity.\n");
+    {
+        Obj emptyStr;
+        ASSERT(DEFAULT_CAPACITY == emptyStr.capacity());
+        ASSERT(DEFAULT_CAPACITY >=
+                                bsl::String_ShortBufferSize<ALLOC>::VALUE
+                                                           / sizeof(TYPE) - 1);
+
+        for (size_t length = 0; length <= 2 * DEFAULT_CAPACITY; ++length) {
+            const Obj X(length, TYPE('a'), &oa);
+            const Obj Y(X, &oa);
+
+            LOOP_ASSERT(length, (length <= DEFAULT_CAPACITY)
+                                               == (0 == oa.numBlocksInUse()));
+            LOOP_ASSERT(length, Y == X);
+        }
+        ASSERT(0 == da.numBlocksTotal());
+    }
+
+    if (verbose) printf("\nConversions and comparisons.\n");
+    {
+        const char *SPECS[] = {
+            "",
+            "A",
+            "AB",
+            "ABC",
+            "ABCDEFGH",
+            "ABCDEFGHABCDEFGHABCDEFGH",
+            "ABCDEFGHABCDEFGHABCDEFGHABCDEFGHABCDEFGHABCDEFGHABCDEFGH",
+            "B",
+            "BA",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        for (int i = 0; i < NUM_SPECS; ++i) {
+            Obj mX(&oa);  const Obj& X = gg(&mX, SPECS[i]);
+
+            // Conversion to the default string type, implicitly and with an
+            // allocator, and back.
+
+            const DefaultString D = X;
+            const DefaultString E(X, &oa);
+
+            LOOP_ASSERT(i, D.size() == X.size());
+            LOOP_ASSERT(i, TRAITS::compare(D.data(), X.data(), X.size()) == 0);
+            LOOP_ASSERT(i, E == D);
+            LOOP_ASSERT(i, &da == D.get_allocator().mechanism());
+            LOOP_ASSERT(i, &oa == E.get_allocator().mechanism());
+
+            const Obj Y(D, &oa);
+            LOOP_ASSERT(i, Y == X);
+            LOOP_ASSERT(i, &oa == Y.get_allocator().mechanism());
+
+            Obj mZ(&oa);
+            mZ = D;
+            LOOP_ASSERT(i, mZ == X);
+            LOOP_ASSERT(i, &oa == mZ.get_allocator().mechanism());
+
+            // String references.
+
+            const BloombergLP::bslstl::StringRefData<TYPE> R(
+                                                       D.data(),
+                                                       D.data() + D.size());
+            const Obj S(R, &oa);
+            LOOP_ASSERT(i, S == X);
+
+            for (int j = 0; j < NUM_SPECS; ++j) {
+                const DefaultString W(g(SPECS[j]));
+
+                const bool EQ = (i == j);
+                const bool LT = native_std::lexicographical_compare(
+                                                             X.begin(),
+                                                             X.end(),
+                                                             W.begin(),
+                                                             W.end());
+                const bool GT = !EQ && !LT;
+
+                LOOP2_ASSERT(i, j, EQ  == (X == W));
+                LOOP2_ASSERT(i, j, EQ  == (W == X));
+                LOOP2_ASSERT(i, j, !EQ == (X != W));
+                LOOP2_ASSERT(i, j, !EQ == (W != X));
+                LOOP2_ASSERT(i, j, LT  == (X <  W));
+                LOOP2_ASSERT(i, j, LT  == (W >  X));
+                LOOP2_ASSERT(i, j, GT  == (X >  W));
+                LOOP2_ASSERT(i, j, GT  == (W <  X));
+                LOOP2_ASSERT(i, j, !GT == (X <= W));
+                LOOP2_ASSERT(i, j, !GT == (W >= X));
+                LOOP2_ASSERT(i, j, !LT == (X >= W));
+                LOOP2_ASSERT(i, j, !LT == (W <= X));
+            }
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\nTraits.\n");
+    {
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        ASSERT(bslma::UsesBslmaAllocator<DefaultString>::value);
+        ASSERT(bslmf::IsBitwiseMoveable<DefaultString>::value);
+    }
+}
+
 template <class TYPE, class TRAITS, class ALLOC>
 void TestDriver<TYPE,TRAITS,ALLOC>::testCase28()
 {
@@ -13517,6 +13927,119 @@ void TestDriver<TYPE,TRAITS,ALLOC>::testCaseM1(const int /* NITER */,
     // F3) FIND_FIRST_NOT_OF AND FIND_LAST_NOT_OF OPERATIONS
 }
 
+                       // ===============================
+                       // struct ShortBufferBenchmarkUtil
+                       // ===============================
+
+template <class STRING>
+struct ShortBufferBenchmarkUtil {
+    // This 'struct' provides a namespace for a benchmark measuring the cost of
+    // constructing, and copying, keys of a given length having the
+    // (template parameter) 'STRING' type.
+
+    static void run(const char *name,
+                    int         keyLength,
+                    int         numKeys,
+                    int         numIterations);
+        // Print to 'stdout', on a line prefixed by the specified 'name', the
+        // number of allocations and the time taken to construct, and then to
+        // copy, the specified 'numKeys' keys of the specified 'keyLength',
+        // repeated the specified 'numIterations' times.
+};
+
+template <class STRING>
+void ShortBufferBenchmarkUtil<STRING>::run(const char *name,
+                                           int         keyLength,
+                                           int         numKeys,
+                                           int         numIterations)
+{
+    bslma::TestAllocator ta;
+
+    char *source = new char[keyLength + numKeys];
+    for (int i = 0; i < keyLength + numKeys; ++i) {
+        source[i] = static_cast<char>('a' + i % 26);
+    }
+
+    bsls::Stopwatch timer;
+    double          constructTime = 0.0;
+    double          copyTime      = 0.0;
+
+    bsls::ObjectBuffer<STRING> *keys   = new bsls::ObjectBuffer<STRING>[
+                                                                     numKeys];
+    bsls::ObjectBuffer<STRING> *copies = new bsls::ObjectBuffer<STRING>[
+                                                                     numKeys];
+
+    for (int iteration = 0; iteration < numIterations; ++iteration) {
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < numKeys; ++i) {
+            new (keys[i].buffer()) STRING(&source[i], keyLength, &ta);
+        }
+        timer.stop();
+        constructTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < numKeys; ++i) {
+            new (copies[i].buffer()) STRING(keys[i].object(), &ta);
+        }
+        timer.stop();
+        copyTime += timer.elapsedTime();
+
+        for (int i = 0; i < numKeys; ++i) {
+            keys[i].object().~STRING();
+            copies[i].object().~STRING();
+        }
+    }
+
+    delete [] keys;
+    delete [] copies;
+    delete [] source;
+
+    const double numOperations = static_cast<double>(numKeys)
+                                                               * numIterations;
+
+    printf("\t%-16s len=%2d sizeof=%2d allocs/key=%4.2f"
+           "  construct=%6.2fns  copy=%6.2fns\n",
+           name,
+           keyLength,
+           static_cast<int>(sizeof(STRING)),
+           static_cast<double>(ta.numAllocations()) / numOperations,
+           constructTime * 1.0e9 / numOperations,
+           copyTime      * 1.0e9 / numOperations);
+}
+
+                            // ==================
+                            // class SimulatedRead
+                            // ==================
+
+class SimulatedRead {
+    // This class implements a functor, suitable for
+    // 'basic_string::resize_and_overwrite', that simulates reading data into
+    // the supplied buffer (e.g., from a socket) by copying from a source
+    // buffer.
+
+    // DATA
+    const char *d_source_p;  // data to "read" (held, not owned)
+
+  public:
+    // CREATORS
+    explicit SimulatedRead(const char *source)
+        // Create a functor that "reads" from the specified 'source'.
+    : d_source_p(source)
+    {
+    }
+
+    // ACCESSORS
+    size_t operator()(char *buffer, size_t length) const
+        // Copy the specified 'length' characters to the specified 'buffer',
+        // and return 'length'.
+    {
+        memcpy(buffer, d_source_p, length);
+        return length;
+    }
+};
+
 //=============================================================================
 //                                USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -13892,7 +14415,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -14104,6 +14627,111 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING 'resize_and_overwrite'
+        //
+        // Plan:
+        //   Run 'testCase30' for 'char' and 'wchar_t' strings, and for a
+        //   string having a configured short string buffer size.
+        //
+        // Testing:
+        //   void resize_and_overwrite(size_type n, OPERATION op);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'resize_and_overwrite'"
+                            "\n==============================\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testCase30();
+
+        if (verbose) printf("\n... with 'wchar_t'.\n");
+        TestDriver<wchar_t>::testCase30();
+
+        if (verbose) printf("\n... with a 64-byte short string buffer.\n");
+        TestDriver<char,
+                   bsl::char_traits<char>,
+                   BloombergLP::bslstl::StringBufferAllocator<char, 64> >::
+                                                                 testCase30();
+      } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING CONFIGURABLE SHORT STRING BUFFER SIZE
+        //
+        // Concerns:
+        //: 1 A string using a 'bslstl::StringBufferAllocator' behaves as a
+        //:   string using the default allocator, except for the capacity of
+        //:   its short string buffer.
+        //:
+        //: 2 Such a string interoperates with 'bsl::basic_string'.
+        //
+        // Plan:
+        //: 1 Run the short string optimization test, and a selection of the
+        //:   value-semantic and manipulator tests, for strings configured with
+        //:   a number of short string buffer sizes.  (C-1)
+        //:
+        //: 2 Run 'testCase29' for those strings.  (C-2)
+        //
+        // Testing:
+        //   class bslstl::StringBufferAllocator
+        //   struct bslstl::ShortBufferString
+        //   string(const basic_string<C,CT,A2>& original, a = A());
+        //   bool operator==(const string&, const basic_string<C,CT,A2>&);
+        //   bool operator!=(const string&, const basic_string<C,CT,A2>&);
+        //   bool operator<(const string&, const basic_string<C,CT,A2>&);
+        //   bool operator>(const string&, const basic_string<C,CT,A2>&);
+        //   bool operator<=(const string&, const basic_string<C,CT,A2>&);
+        //   bool operator>=(const string&, const basic_string<C,CT,A2>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONFIGURABLE SHORT STRING BUFFER SIZE"
+                            "\n============================================="
+                            "\n");
+
+        using BloombergLP::bslstl::ShortBufferString;
+        using BloombergLP::bslstl::StringBufferAllocator;
+
+        typedef StringBufferAllocator<char, 8>     CA8;
+        typedef StringBufferAllocator<char, 40>    CA40;
+        typedef StringBufferAllocator<char, 64>    CA64;
+        typedef StringBufferAllocator<wchar_t, 64> WA64;
+
+        typedef bsl::char_traits<char>    CT;
+        typedef bsl::char_traits<wchar_t> WT;
+
+        ASSERT((bsl::is_same<bsl::basic_string<char, CT, CA40>,
+                             ShortBufferString<40>::Type>::value));
+        ASSERT((bsl::is_same<bsl::basic_string<wchar_t, WT, WA64>,
+                             ShortBufferString<64, wchar_t>::Type>::value));
+
+        ASSERT(sizeof(bsl::string) < sizeof(ShortBufferString<40>::Type));
+
+        if (verbose) printf("\n... with 'char' and 8 bytes.\n");
+        TestDriver<char, CT, CA8>::testCase2();
+        TestDriver<char, CT, CA8>::testCase28();
+        TestDriver<char, CT, CA8>::testCase29();
+
+        if (verbose) printf("\n... with 'char' and 40 bytes.\n");
+        TestDriver<char, CT, CA40>::testCase2();
+        TestDriver<char, CT, CA40>::testCase3();
+        TestDriver<char, CT, CA40>::testCase7();
+        TestDriver<char, CT, CA40>::testCase9();
+        TestDriver<char, CT, CA40>::testCase13();
+        TestDriver<char, CT, CA40>::testCase14();
+        TestDriver<char, CT, CA40>::testCase18();
+        TestDriver<char, CT, CA40>::testCase28();
+        TestDriver<char, CT, CA40>::testCase29();
+
+        if (verbose) printf("\n... with 'char' and 64 bytes.\n");
+        TestDriver<char, CT, CA64>::testCase2();
+        TestDriver<char, CT, CA64>::testCase28();
+        TestDriver<char, CT, CA64>::testCase29();
+
+        if (verbose) printf("\n... with 'wchar_t' and 64 bytes.\n");
+        TestDriver<wchar_t, WT, WA64>::testCase2();
+        TestDriver<wchar_t, WT, WA64>::testCase28();
+        TestDriver<wchar_t, WT, WA64>::testCase29();
+      } break;
       case 28: {
         // --------------------------------------------------------------------
         // TESTING THE SHORT STRING OPTIMIZATION
@@ -15127,6 +15755,137 @@ int main(int argc, char *argv[])
         TestDriver<char>::testCaseM1(NITER, RANDOM_SEED);
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONFIGURED SHORT STRING BUFFER SIZE
+        //
+        // Concerns:
+        //: 1 Keys of typical lengths that do not fit the default short string
+        //:   buffer, but fit a configured one, are constructed and copied
+        //:   without allocating, and faster.
+        //
+        // Plan:
+        //: 1 For a range of key lengths, construct and copy a large number of
+        //:   keys using 'bsl::string', and strings configured with short
+        //:   string buffers of 32 and 48 bytes, and report the number of
+        //:   allocations per key and the time taken per operation.
+        //
+        // Testing:
+        //   PERFORMANCE: CONFIGURED SHORT STRING BUFFER SIZE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                       "\nPERFORMANCE: CONFIGURED SHORT STRING BUFFER SIZE"
+                       "\n================================================\n");
+
+        const int NUM_ITERATIONS = (argc < 3) ? 20 : std::atoi(argv[2]);
+        const int NUM_KEYS       = 100000;
+
+        typedef BloombergLP::bslstl::ShortBufferString<32>::Type String32;
+        typedef BloombergLP::bslstl::ShortBufferString<48>::Type String48;
+
+        const int KEY_LENGTHS[] = { 8, 16, 24, 32, 40, 64 };
+        const int NUM_KEY_LENGTHS = sizeof KEY_LENGTHS / sizeof *KEY_LENGTHS;
+
+        for (int i = 0; i < NUM_KEY_LENGTHS; ++i) {
+            const int LENGTH = KEY_LENGTHS[i];
+
+            ShortBufferBenchmarkUtil<bsl::string>::run("bsl::string",
+                                                       LENGTH,
+                                                       NUM_KEYS,
+                                                       NUM_ITERATIONS);
+            ShortBufferBenchmarkUtil<String32>::run("ShortBuffer<32>",
+                                                    LENGTH,
+                                                    NUM_KEYS,
+                                                    NUM_ITERATIONS);
+            ShortBufferBenchmarkUtil<String48>::run("ShortBuffer<48>",
+                                                    LENGTH,
+                                                    NUM_KEYS,
+                                                    NUM_ITERATIONS);
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'resize_and_overwrite' VS. 'resize'
+        //
+        // Concerns:
+        //: 1 Receiving data into a string using 'resize_and_overwrite' is
+        //:   faster than using 'resize' followed by a copy, as the buffer is
+        //:   not first filled with null characters.
+        //
+        // Plan:
+        //: 1 For a range of buffer sizes, repeatedly "read" a buffer's worth
+        //:   of data into a reused string, once using 'resize' followed by
+        //:   'memcpy', and once using 'resize_and_overwrite' with a
+        //:   'SimulatedRead' functor, and report the throughput of each.
+        //
+        // Testing:
+        //   PERFORMANCE: 'resize_and_overwrite' VS. 'resize'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\nPERFORMANCE: 'resize_and_overwrite' VS. 'resize'"
+                        "\n================================================"
+                        "\n");
+
+        const size_t TOTAL_BYTES = (argc > 2 && atoi(argv[2]) > 0)
+                                 ? static_cast<size_t>(atoi(argv[2])) << 20
+                                 : size_t(2) << 30;
+
+        const size_t BUFFER_SIZES[] = { 4096, 65536, 1 << 20, 16 << 20 };
+        const int    NUM_BUFFER_SIZES = sizeof  BUFFER_SIZES
+                                      / sizeof *BUFFER_SIZES;
+
+        const size_t MAX_SIZE = BUFFER_SIZES[NUM_BUFFER_SIZES - 1];
+
+        char *source = new char[MAX_SIZE];
+        for (size_t i = 0; i < MAX_SIZE; ++i) {
+            source[i] = static_cast<char>('a' + i % 26);
+        }
+
+        for (int i = 0; i < NUM_BUFFER_SIZES; ++i) {
+            const size_t SIZE           = BUFFER_SIZES[i];
+            const size_t NUM_ITERATIONS = TOTAL_BYTES / SIZE;
+
+            bsl::string     buffer;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (size_t j = 0; j < NUM_ITERATIONS; ++j) {
+                buffer.clear();
+                buffer.resize(SIZE);
+                memcpy(&buffer[0], source, SIZE);
+            }
+            timer.stop();
+            const double resizeTime = timer.elapsedTime();
+
+            bsl::string().swap(buffer);
+
+            timer.reset();
+            timer.start();
+            for (size_t j = 0; j < NUM_ITERATIONS; ++j) {
+                buffer.clear();
+                buffer.resize_and_overwrite(SIZE, SimulatedRead(source));
+            }
+            timer.stop();
+            const double overwriteTime = timer.elapsedTime();
+
+            ASSERT(SIZE == buffer.size());
+            ASSERT(0    == memcmp(buffer.data(), source, SIZE));
+
+            const double megabytes = static_cast<double>(SIZE)
+                                   * static_cast<double>(NUM_ITERATIONS)
+                                   / (1 << 20);
+
+            printf("\tbuffer=%9d  resize=%8.1fMB/s"
+                   "  resize_and_overwrite=%8.1fMB/s\n",
+                   static_cast<int>(SIZE),
+                   megabytes / resizeTime,
+                   megabytes / overwriteTime);
+        }
+
+        delete [] source;
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -13,7 +13,8 @@ BSLS_IDENT("$Id: $")
 //  bsl::stringbuf: C++03-compatible 'stringbuf' class
 //  bsl::StringBufContainer: wrapper for 'basic_stringbuf'
 //
-//@SEE_ALSO: bslstl_stringstream, bslstl_ostringstream, bslstl_istringstream
+//@SEE_ALSO: bslstl_stringstream, bslstl_ostringstream, bslstl_istringstream,
+//           bslstl_stringref
 //
 //@DESCRIPTION: This component is for internal use only.  Please include
 // '<bsl_sstream.h>' instead.
@@ -77,6 +78,35 @@ BSLS_IDENT("$Id: $")
 // default allocator installed at the time of the stream buffer's construction
 // (see 'bslma_default').
 //
+///Accessing the Buffered Sequence Without Copying
+///-----------------------------------------------
+// The standard 'str' accessor returns a copy of the buffered sequence of
+// characters, so a client that formats a large message into a
+// 'basic_stringbuf' (or into one of the string streams built on it) and then
+// hands the message off pays for an allocation and a copy of every character.
+// 'basic_stringbuf' provides four non-standard methods that avoid that copy:
+//
+//: o 'view' returns a 'bslstl::StringRefImp' referring to the buffered
+//:   sequence in place.  The reference is invalidated by any subsequent
+//:   operation that modifies the stream buffer (including output through the
+//:   stream buffer's public interface).
+//:
+//: o 'release' moves the buffered sequence out of the stream buffer, either
+//:   into a 'basic_string' supplied by the caller or into a returned
+//:   'basic_string', and resets the stream buffer to the empty sequence.  No
+//:   characters are copied if the target string uses the same allocator as
+//:   the stream buffer.  'release' is the C++03 analogue of the C++20
+//:   'std::move(buffer).str()'.
+//:
+//: o 'adopt' is the converse of 'release': it resets the buffered sequence to
+//:   the value of a caller-supplied 'basic_string', taking over the storage
+//:   of that string rather than copying it.  'adopt' is the C++03 analogue of
+//:   the C++20 'str(basic_string&&)'.
+//:
+//: o 'reserve' sets aside capacity for a sequence of a known (or estimated)
+//:   length, so that the internal buffer is not repeatedly reallocated (and
+//:   its contents copied) as characters are written.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -135,6 +165,51 @@ BSLS_IDENT("$Id: $")
 //
 //  assert(orig == result);
 //..
+//
+///Example 2: Building a Message Without Copying
+///- - - - - - - - - - - - - - - - - - - - - - -
+// The following example demonstrates the use of 'view' and 'release' to access
+// the characters written to a 'bsl::stringbuf' without copying them.
+//
+// Suppose that we encode messages having a header line followed by a body of
+// (possibly many) fields, and that we know approximately how large an encoded
+// message will be.  First, we define a function that writes a message to a
+// stream buffer:
+//..
+//  void encodeMessage(bsl::stringbuf *buffer, int numFields)
+//  {
+//      buffer->sputn("HDR|", 4);
+//      for (int i = 0; i < numFields; ++i) {
+//          buffer->sputn("field=value|", 12);
+//      }
+//  }
+//..
+// Next, we create a stream buffer, reserve capacity for the encoded message,
+// and encode a message having 100 fields:
+//..
+//  bsl::stringbuf buffer;
+//  buffer.reserve(4 + 100 * 12);
+//
+//  encodeMessage(&buffer, 100);
+//..
+// Then, we inspect the message in place using 'view', which does not copy
+// the buffered characters:
+//..
+//  assert(4 + 100 * 12 == buffer.view().length());
+//  assert(buffer.view().starts_with("HDR|field=value|"));
+//..
+// Finally, we move the encoded message out of the stream buffer using
+// 'release'.  Because 'message' uses the same (default) allocator as
+// 'buffer', the characters are not copied, and 'buffer' is left empty, ready
+// to encode the next message:
+//..
+//  bsl::string message;
+//  buffer.release(&message);
+//
+//  assert(4 + 100 * 12 == message.length());
+//  assert(0 == message.compare(0, 4, "HDR|"));
+//  assert(buffer.view().isEmpty());
+//..
 
 // Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
 // mode.  Doing so is unsupported, and is likely to cause compilation errors.
@@ -159,6 +234,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_string.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_TYPETRAITS
 #include <bslalg_typetraits.h>
 #endif
@@ -205,6 +284,22 @@ namespace bsl {
 
 using native_std::ios_base;
 
+                      // =================================
+                      // struct StringBuf_ExtendToCapacity
+                      // =================================
+
+struct StringBuf_ExtendToCapacity {
+    // This component-private functor is supplied to
+    // 'basic_string::resize_and_overwrite' to extend the internal buffer of a
+    // 'basic_stringbuf' to the requested length without initializing the
+    // characters that are added.
+
+    // ACCESSORS
+    native_std::size_t operator()(const void         *,
+                                  native_std::size_t  length) const;
+        // Return the specified 'length'.
+};
+
                             // =====================
                             // class basic_stringbuf
                             // =====================
@@ -220,6 +315,7 @@ class basic_stringbuf
     // PRIVATE TYPES
     typedef native_std::basic_streambuf<CHAR_TYPE, CHAR_TRAITS>  BaseType;
     typedef bsl::basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> StringType;
+    typedef BloombergLP::bslstl::StringRefImp<CHAR_TYPE>         StringRefType;
 
   public:
     // TYPES
@@ -464,9 +560,45 @@ class basic_stringbuf
         // the updated buffer, and update the current output position to be the
         // end of the updated buffer.
 
+    void adopt(StringType *value);
+        // Reset the internally buffered sequence of characters to the value
+        // of the specified 'value', and leave 'value' empty.  Update the
+        // beginning and end of both the input and output sequences, and the
+        // current input and output positions, as for 'str(*value)'.  Note
+        // that the characters of 'value' are not copied if 'value' uses the
+        // same allocator as this stream buffer (in which case this stream
+        // buffer takes over the storage of 'value').
+
+    void release(StringType *result);
+        // Load into the specified 'result' the currently buffered sequence of
+        // characters, and reset the internally buffered sequence to the empty
+        // sequence.  Note that the characters are not copied if 'result' uses
+        // the same allocator as this stream buffer (in which case this stream
+        // buffer reuses the storage previously held by 'result').
+
+    StringType release();
+        // Return the currently buffered sequence of characters, and reset the
+        // internally buffered sequence to the empty sequence.  The returned
+        // string uses the allocator of this stream buffer.  Note that the
+        // characters are not copied.
+
+    void reserve(native_std::size_t numCharacters);
+        // Ensure that the internal buffer has sufficient capacity to hold a
+        // sequence of at least the specified 'numCharacters' characters, so
+        // that writing a sequence of up to that length does not reallocate
+        // the buffer.  The buffered sequence of characters and the current
+        // input and output positions are unchanged.
+
     // ACCESSORS
     StringType str() const;
         // Return the currently buffered sequence of characters.
+
+    StringRefType view() const;
+        // Return a reference to the currently buffered sequence of
+        // characters.  The returned reference is invalidated by any operation
+        // that modifies this stream buffer (including output through its
+        // public interface).  Note that, unlike 'str', this method does not
+        // copy the buffered characters.
 };
 
 // STANDARD TYPEDEFS
@@ -549,6 +681,19 @@ class StringBufContainer {
 //                       TEMPLATE FUNCTION DEFINITIONS
 // ============================================================================
 
+                      // ---------------------------------
+                      // struct StringBuf_ExtendToCapacity
+                      // ---------------------------------
+
+// ACCESSORS
+inline
+native_std::size_t
+StringBuf_ExtendToCapacity::operator()(const void         *,
+                                       native_std::size_t  length) const
+{
+    return length;
+}
+
                             // ---------------------
                             // class basic_stringbuf
                             // ---------------------
@@ -592,9 +737,12 @@ void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::
     updateStreamPositions(off_type inputOffset, off_type outputOffset)
 {
     // Extend the internal buffer to the full capacity of the string to allow
-    // us to use the full capacity for buffering output.
+    // us to use the full capacity for buffering output.  The characters
+    // beyond 'streamSize()' are never read before being written, so they are
+    // left uninitialized.
 
-    d_str.resize(d_str.capacity());
+    d_str.resize_and_overwrite(d_str.capacity(),
+                               StringBuf_ExtendToCapacity());
     char_type *dataPtr = &d_str[0];
 
     if (d_mode & ios_base::in) {
@@ -1026,6 +1174,72 @@ void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::str(
     updateStreamPositions(0, d_mode & ios_base::ate ? d_lastWrittenChar : 0);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::adopt(
+                                                             StringType *value)
+{
+    BSLS_ASSERT_SAFE(value);
+
+    d_str.swap(*value);
+    value->clear();
+
+    // Clear the output area, which refers to the previous buffer, so that it
+    // does not contribute to the stream size.
+
+    this->setp(0, 0);
+
+    d_lastWrittenChar = d_str.size();
+    updateStreamPositions(0, d_mode & ios_base::ate ? d_lastWrittenChar : 0);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::release(
+                                                            StringType *result)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    // Trim the internal buffer to the written characters (which does not
+    // reallocate), and exchange it with 'result'.
+
+    d_str.resize(streamSize());
+    d_str.swap(*result);
+    d_str.clear();
+
+    this->setp(0, 0);
+
+    d_lastWrittenChar = 0;
+    updateStreamPositions();
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+typename basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringType
+basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::release()
+{
+    StringType result(d_str.get_allocator());
+    release(&result);
+    return result;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+void basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::reserve(
+                                              native_std::size_t numCharacters)
+{
+    if (numCharacters <= d_str.capacity()) {
+        return;                                                       // RETURN
+    }
+
+    // Store the input and output offsets so they can be used to restore the
+    // input and output positions after the buffer is reallocated.
+
+    off_type inputOffset  = this->gptr() - this->eback();
+    off_type outputOffset = this->pptr() - this->pbase();
+
+    d_lastWrittenChar = streamSize();
+    d_str.reserve(numCharacters);
+    updateStreamPositions(inputOffset, outputOffset);
+}
+
 // ACCESSORS
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 inline
@@ -1035,6 +1249,14 @@ typename basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringType
     return StringType(d_str.begin(), d_str.begin() + streamSize());
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+typename basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::StringRefType
+    basic_stringbuf<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>::view() const
+{
+    return StringRefType(d_str.data(), d_str.data() + streamSize());
+}
+
 }  // close namespace bsl
 
 // ============================================================================
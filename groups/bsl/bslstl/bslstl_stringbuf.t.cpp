@@ -6,6 +6,7 @@
 #include <bslma_default.h>
 #include <bslma_testallocator.h>
 #include <bslma_defaultallocatorguard.h>
+#include <bsls_stopwatch.h>
 
 #include <iostream>
 #include <istream>
@@ -43,11 +44,17 @@
 // [ 8] pbackfail(int)
 // [ 9] xsputn(const char *, streamsize)
 // [10] overflow(int)
+// [13] void adopt(string *)
+// [13] void release(string *)
+// [13] string release()
+// [13] void reserve(size_t)
+// [13] StringRef view() const
 //-----------------------------------------------------------------------------
 // [11] OUTPUT TO STRINGBUF VIA PUBLIC INTERFACE
 // [12] INPUT FROM STRINGBUF VIA PUBLIC INTERFACE
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 1] BREATHING TEST
+// [-1] PERFORMANCE: 'str' VS. 'release'
 
 //==========================================================================
 //                       STANDARD BDE ASSERT TEST MACRO
@@ -684,6 +691,25 @@ namespace {
         return result;
     }
 //..
+//
+///Example 2: Building a Message Without Copying
+///- - - - - - - - - - - - - - - - - - - - - - -
+// The following example demonstrates the use of 'view' and 'release' to access
+// the characters written to a 'bsl::stringbuf' without copying them.
+//
+// Suppose that we encode messages having a header line followed by a body of
+// (possibly many) fields, and that we know approximately how large an encoded
+// message will be.  First, we define a function that writes a message to a
+// stream buffer:
+//..
+    void encodeMessage(bsl::stringbuf *buffer, int numFields)
+    {
+        buffer->sputn("HDR|", 4);
+        for (int i = 0; i < numFields; ++i) {
+            buffer->sputn("field=value|", 12);
+        }
+    }
+//..
 
 }  // close unnamed namespace
 
@@ -735,7 +761,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -758,6 +784,288 @@ int main(int argc, char *argv[])
 //
     ASSERT(orig == result);
 //..
+//
+///Example 2: Building a Message Without Copying
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Next, we create a stream buffer, reserve capacity for the encoded message,
+// and encode a message having 100 fields:
+//..
+    bsl::stringbuf buffer;
+    buffer.reserve(4 + 100 * 12);
+
+    encodeMessage(&buffer, 100);
+//..
+// Then, we inspect the message in place using 'view', which does not copy
+// the buffered characters:
+//..
+    ASSERT(4 + 100 * 12 == buffer.view().length());
+    ASSERT(buffer.view().starts_with("HDR|field=value|"));
+//..
+// Finally, we move the encoded message out of the stream buffer using
+// 'release'.  Because 'message' uses the same (default) allocator as
+// 'buffer', the characters are not copied, and 'buffer' is left empty, ready
+// to encode the next message:
+//..
+    bsl::string message;
+    buffer.release(&message);
+
+    ASSERT(4 + 100 * 12 == message.length());
+    ASSERT(0 == message.compare(0, 4, "HDR|"));
+    ASSERT(buffer.view().isEmpty());
+//..
+
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'view', 'release', 'adopt', AND 'reserve'
+        //
+        // Concerns:
+        //: 1 'view' refers to exactly the buffered sequence of characters
+        //:   (i.e., the characters returned by 'str'), in every open mode,
+        //:   including after the output position has been moved back from
+        //:   the last written character.
+        //:
+        //: 2 'release' loads the buffered sequence into the target string and
+        //:   leaves the stream buffer empty and usable, without allocating
+        //:   memory if the target string uses the same allocator.
+        //:
+        //: 3 'release' loads the correct value into a target string that uses
+        //:   a different allocator.
+        //:
+        //: 4 The string returned by value from 'release' uses the allocator
+        //:   of the stream buffer.
+        //:
+        //: 5 'adopt' resets the buffered sequence to the value of the source
+        //:   string without allocating memory if the source string uses the
+        //:   same allocator, leaves the source string empty, and honors
+        //:   'ios_base::ate'.
+        //:
+        //: 6 After 'reserve(N)', a sequence of 'N' characters can be written
+        //:   without allocating memory, and 'reserve' does not change the
+        //:   buffered sequence or the input and output positions.
+        //
+        // Plan:
+        //: 1 For each open mode, create a stream buffer from an initial
+        //:   string, write to it (where permitted), and compare 'view' with
+        //:   'str'.  Seek the output position back and repeat.  (C-1)
+        //:
+        //: 2 Using a test allocator, write to a stream buffer, 'release' into
+        //:   a string using the same allocator, and verify the value of the
+        //:   string, that no memory was allocated, and that the stream buffer
+        //:   is empty and accepts further output.  (C-2)
+        //:
+        //: 3 Repeat P-2 with a target string using a different allocator.
+        //:   (C-3)
+        //:
+        //: 4 Call 'release()' and verify the value and allocator of the
+        //:   result.  (C-4)
+        //:
+        //: 5 'adopt' a string, in each of the default and 'ate' modes, and
+        //:   verify the buffered sequence, the source string, the allocation
+        //:   count, and the position of subsequent output.  (C-5)
+        //:
+        //: 6 'reserve' capacity in a stream buffer having a partially read
+        //:   sequence, verify the input and output positions, then write the
+        //:   reserved number of characters and verify that no memory was
+        //:   allocated.  (C-6)
+        //
+        // Testing:
+        //   void adopt(string *);
+        //   void release(string *);
+        //   string release();
+        //   void reserve(size_t);
+        //   StringRef view() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                         "\nTESTING 'view', 'release', 'adopt', AND 'reserve'"
+                         "\n================================================="
+                         "\n");
+
+        typedef std::ios_base IOS;
+
+        if (verbose) printf("\tTesting 'view'.\n");
+        {
+            const IOS::openmode MODES[] = {
+                IOS::in, IOS::out, IOS::in | IOS::out, IOS::out | IOS::ate
+            };
+            const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+            for (int ti = 0; ti < NUM_MODES; ++ti) {
+                const IOS::openmode MODE = MODES[ti];
+
+                bsl::stringbuf mX(bsl::string("abcdef"), MODE);
+                const bsl::stringbuf& X = mX;
+
+                LOOP_ASSERT(ti, X.view() == X.str());
+
+                mX.sputn("0123456789", 10);
+                LOOP_ASSERT(ti, X.view() == X.str());
+
+                mX.pubseekoff(0, IOS::beg, IOS::out);
+                mX.sputc('x');
+                LOOP_ASSERT(ti, X.view() == X.str());
+                LOOP_ASSERT(ti, X.view().length() == X.str().length());
+
+                if (MODE & IOS::out) {
+                    LOOP_ASSERT(ti, 'x' == X.view()[0]);
+                }
+                else {
+                    LOOP_ASSERT(ti, X.view() == "abcdef");
+                }
+            }
+
+            bsl::stringbuf mX;  const bsl::stringbuf& X = mX;
+            ASSERT(X.view().isEmpty());
+
+            // The view refers to the buffer in place.
+
+            mX.sputn("abc", 3);
+            ASSERT(X.view().data() == X.view().data());
+            ASSERT(X.view() == "abc");
+        }
+
+        if (verbose) printf("\tTesting 'release(string *)'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const char *DATA = "The quick brown fox jumps over the lazy dog.";
+
+            bsl::stringbuf mX(&oa);  const bsl::stringbuf& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.sputn(DATA, std::strlen(DATA));
+            }
+            const bsl::string EXPECTED = X.str();
+
+            // Move out into a string having the same allocator.
+
+            bsl::string result("initial value", &oa);
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            mX.release(&result);
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(EXPECTED  == result);
+            ASSERT(X.view().isEmpty());
+            ASSERT(X.str().empty());
+
+            // The stream buffer remains usable.
+
+            mX.sputn("abc", 3);
+            ASSERT(X.str() == "abc");
+            ASSERT(X.view() == "abc");
+
+            mX.pubseekpos(0, IOS::in);
+            ASSERT('a' == mX.sbumpc());
+
+            // Move out into a string having a different allocator.
+
+            bsl::string other(&sa);
+            mX.release(&other);
+
+            ASSERT(other == "abc");
+            ASSERT(X.str().empty());
+            ASSERT(other.get_allocator() == bsl::allocator<char>(&sa));
+
+            // Release after moving the output position back.
+
+            mX.sputn("0123456789", 10);
+            mX.pubseekpos(2, IOS::out);
+            mX.sputc('x');
+
+            mX.release(&result);
+            ASSERT(result == "01x3456789");
+            ASSERT(X.str().empty());
+        }
+
+        if (verbose) printf("\tTesting 'release()'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::stringbuf mX(&oa);  const bsl::stringbuf& X = mX;
+
+            mX.sputn("hello, world", 12);
+
+            bsl::string result = mX.release();
+
+            ASSERT(result == "hello, world");
+            ASSERT(result.get_allocator() == bsl::allocator<char>(&oa));
+            ASSERT(X.str().empty());
+        }
+
+        if (verbose) printf("\tTesting 'adopt'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::stringbuf mX(&oa);  const bsl::stringbuf& X = mX;
+
+            mX.sputn("old value", 9);
+
+            bsl::string value("a value too long for the short buffer", &oa);
+            const bsl::string EXPECTED = value;
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            mX.adopt(&value);
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(value.empty());
+            ASSERT(EXPECTED == X.str());
+            ASSERT(EXPECTED == X.view());
+
+            // Output starts at the beginning of the adopted sequence.
+
+            mX.sputc('A');
+            ASSERT('A' == X.view()[0]);
+            ASSERT(EXPECTED.length() == X.view().length());
+
+            // In 'ate' mode, output is appended to the adopted sequence.
+
+            bsl::stringbuf mY(IOS::in | IOS::out | IOS::ate, &oa);
+            const bsl::stringbuf& Y = mY;
+
+            bsl::string text("abc", &oa);
+            mY.adopt(&text);
+            mY.sputc('d');
+
+            ASSERT(Y.str() == "abcd");
+            ASSERT('a' == mY.sbumpc());
+        }
+
+        if (verbose) printf("\tTesting 'reserve'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const std::size_t SIZES[] = { 0, 1, 15, 100, 1000, 65536 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const std::size_t SIZE = SIZES[ti];
+
+                bsl::stringbuf mX(bsl::string("abcdef", &oa), &oa);
+                const bsl::stringbuf& X = mX;
+
+                mX.pubseekpos(2, IOS::in);
+                mX.pubseekpos(3, IOS::out);
+
+                mX.reserve(SIZE);
+
+                LOOP_ASSERT(ti, X.str() == "abcdef");
+                LOOP_ASSERT(ti, 'c' == mX.sgetc());
+                LOOP_ASSERT(ti, 3 == mX.pubseekoff(0, IOS::cur, IOS::out));
+
+                const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+                mX.pubseekpos(0, IOS::out);
+                for (std::size_t i = 0; i < SIZE; ++i) {
+                    mX.sputc(char('a' + i % 26));
+                }
+                LOOP_ASSERT(ti, NUM_ALLOC == oa.numAllocations());
+                LOOP_ASSERT(ti, native_std::max<std::size_t>(SIZE, 6)
+                                                       == X.view().length());
+            }
+        }
 
       } break;
       case 12: {
@@ -1421,6 +1729,92 @@ int main(int argc, char *argv[])
                             "\n==============\n");
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'str' VS. 'release'
+        //
+        // Concerns:
+        //: 1 Moving an encoded message out of a stream buffer using 'release'
+        //:   (with 'reserve') is faster than copying it out using 'str'.
+        //
+        // Plan:
+        //: 1 For message sizes from 1 KB to 1 MB, encode the same total volume
+        //:   of messages by writing fixed-size fields to a stream buffer, and
+        //:   retrieve each message using: (1) a new stream buffer and 'str',
+        //:   (2) a reused stream buffer and 'release', and (3) a reused stream
+        //:   buffer, 'reserve', and 'release'.  Report the time taken by
+        //:   each.  Optionally specify the total volume in megabytes as the
+        //:   second command-line argument (the default is 256).
+        //
+        // Testing:
+        //   PERFORMANCE: 'str' VS. 'release'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: 'str' VS. 'release'"
+               "\n================================\n");
+
+        const int TOTAL_MB = verbose ? atoi(argv[2]) : 256;
+        const bsls::Types::Int64 TOTAL = bsls::Types::Int64(TOTAL_MB) << 20;
+
+        static const char FIELD[] = "tag=field_value_0123456789|";
+        const int         FIELD_LENGTH = sizeof FIELD - 1;
+
+        printf("%10s %10s %12s %12s %12s\n",
+               "size", "messages", "str", "release", "reserve");
+
+        for (int size = 1024; size <= (1 << 20); size *= 4) {
+            const int NUM_FIELDS   = size / FIELD_LENGTH;
+            const int NUM_MESSAGES = int(TOTAL / size);
+            double    times[3];
+            int       totalLength = 0;
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                bsl::stringbuf buffer;
+                for (int j = 0; j < NUM_FIELDS; ++j) {
+                    buffer.sputn(FIELD, FIELD_LENGTH);
+                }
+                bsl::string message(buffer.str());
+                totalLength += int(message.length());
+            }
+            timer.stop();
+            times[0] = timer.elapsedTime();
+
+            bsl::stringbuf buffer;
+            bsl::string    message;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                for (int j = 0; j < NUM_FIELDS; ++j) {
+                    buffer.sputn(FIELD, FIELD_LENGTH);
+                }
+                buffer.release(&message);
+                totalLength -= int(message.length());
+            }
+            timer.stop();
+            times[1] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                buffer.reserve(NUM_FIELDS * FIELD_LENGTH);
+                for (int j = 0; j < NUM_FIELDS; ++j) {
+                    buffer.sputn(FIELD, FIELD_LENGTH);
+                }
+                buffer.release(&message);
+            }
+            timer.stop();
+            times[2] = timer.elapsedTime();
+
+            ASSERT(0 == totalLength);
+
+            printf("%10d %10d %12.4f %12.4f %12.4f\n",
+                   size, NUM_MESSAGES, times[0], times[1], times[2]);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
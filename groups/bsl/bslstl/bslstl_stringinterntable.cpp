@@ -0,0 +1,415 @@
+// bslstl_stringinterntable.cpp                                       -*-C++-*-
+#include <bslstl_stringinterntable.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+#include <cstring>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                       // ==============================
+                       // struct StringInternTable_Entry
+                       // ==============================
+
+struct StringInternTable_Entry {
+    // This component-private 'struct' provides the header of an interned
+    // string stored in the arena of a 'StringInternTable'.  The characters of
+    // the string, followed by a null terminator, are stored immediately after
+    // the header.
+
+    // DATA
+    std::size_t d_hash;    // hash value of the string
+    std::size_t d_length;  // length of the string
+
+    // ACCESSORS
+    const char *characters() const
+        // Return the address of the characters of the string.
+    {
+        return reinterpret_cast<const char *>(this + 1);
+    }
+};
+
+                       // ==============================
+                       // struct StringInternTable_Slots
+                       // ==============================
+
+struct StringInternTable_Slots {
+    // This component-private 'struct' provides an open-addressed hash table
+    // of the entries of a 'StringInternTable'.  The slots, each holding the
+    // address of an entry or 0, are stored immediately after the header.
+
+    // DATA
+    std::size_t              d_mask;       // capacity - 1 (capacity is a
+                                           // power of two)
+
+    StringInternTable_Slots *d_retired_p;  // hash table replaced by this one,
+                                           // retained for concurrent lookups
+
+    // MANIPULATORS
+    bsls::AtomicOperations::AtomicTypes::Pointer *slots()
+        // Return the address of the first slot.
+    {
+        return reinterpret_cast<bsls::AtomicOperations::AtomicTypes::Pointer *>
+                                                                  (this + 1);
+    }
+
+    // ACCESSORS
+    const bsls::AtomicOperations::AtomicTypes::Pointer *slots() const
+        // Return the address of the first slot.
+    {
+        return reinterpret_cast<
+                  const bsls::AtomicOperations::AtomicTypes::Pointer *>(
+                                                                     this + 1);
+    }
+};
+
+                        // =============================
+                        // union StringInternTable_Block
+                        // =============================
+
+union StringInternTable_Block {
+    // This component-private 'union' provides the header of a block of the
+    // arena of a 'StringInternTable', and ensures that the memory following
+    // the header is maximally aligned.
+
+    // DATA
+    StringInternTable_Block             *d_next_p;  // next block in list
+    bsls::AlignmentUtil::MaxAlignedType  d_align;   // force alignment
+};
+
+namespace {
+
+enum {
+    k_INITIAL_CAPACITY   = 64,           // capacity of the first hash table
+
+    k_INITIAL_BLOCK_SIZE = 4 * 1024,     // size of the first arena block
+
+    k_MAX_BLOCK_SIZE     = 1024 * 1024   // limit of the geometric growth of
+                                         // the arena blocks
+};
+
+typedef bsls::AtomicOperations AtomicOps;
+
+inline
+std::size_t hashString(const char *characters, std::size_t length)
+    // Return a hash value for the string of the specified 'length' at the
+    // specified 'characters'.  Note that the low-order bits of the result are
+    // used to select a slot, and so must depend on every character.
+{
+    // 64-bit FNV-1a, followed by a final mix of the high-order bits into the
+    // low-order bits.
+
+    bsls::Types::Uint64 hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(characters[i]);
+        hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 32;
+    hash ^= hash >> 17;
+
+    return static_cast<std::size_t>(hash);
+}
+
+inline
+bool isMatch(const StringInternTable_Entry *entry,
+             const char                    *characters,
+             std::size_t                    length,
+             std::size_t                    hash)
+    // Return 'true' if the specified 'entry' holds the string of the
+    // specified 'length' at the specified 'characters', having the specified
+    // 'hash', and 'false' otherwise.
+{
+    return entry->d_hash   == hash
+        && entry->d_length == length
+        && 0 == std::memcmp(entry->characters(), characters, length);
+}
+
+const StringInternTable_Entry *lookup(
+                                   const StringInternTable_Slots *table,
+                                   const char                    *characters,
+                                   std::size_t                    length,
+                                   std::size_t                    hash)
+    // Return the address of the entry in the specified 'table' holding the
+    // string of the specified 'length' at the specified 'characters', having
+    // the specified 'hash', or 0 if 'table' has no such entry.
+{
+    const AtomicOps::AtomicTypes::Pointer *slots = table->slots();
+
+    for (std::size_t i = hash & table->d_mask;; i = (i + 1) & table->d_mask) {
+        const StringInternTable_Entry *entry =
+                                 static_cast<const StringInternTable_Entry *>(
+                                          AtomicOps::getPtrAcquire(slots + i));
+        if (!entry) {
+            return 0;                                                 // RETURN
+        }
+        if (isMatch(entry, characters, length, hash)) {
+            return entry;                                             // RETURN
+        }
+    }
+}
+
+void insert(StringInternTable_Slots       *table,
+            const StringInternTable_Entry *entry)
+    // Publish the specified 'entry' in the first free slot of its probe
+    // sequence in the specified 'table'.  The behavior is undefined unless
+    // 'table' has a free slot.
+{
+    AtomicOps::AtomicTypes::Pointer *slots = table->slots();
+
+    std::size_t i = entry->d_hash & table->d_mask;
+    while (AtomicOps::getPtrRelaxed(slots + i)) {
+        i = (i + 1) & table->d_mask;
+    }
+    AtomicOps::setPtrRelease(slots + i,
+                             const_cast<StringInternTable_Entry *>(entry));
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // class StringInternTable
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+const StringInternTable_Entry *
+StringInternTable::createEntry(const char  *characters,
+                               std::size_t  length,
+                               std::size_t  hash)
+{
+    enum { k_ALIGNMENT = sizeof(std::size_t) };
+
+    const std::size_t size = (sizeof(StringInternTable_Entry) + length + 1
+                                  + k_ALIGNMENT - 1) & ~(k_ALIGNMENT - 1);
+
+    if (static_cast<std::size_t>(d_end_p - d_cursor_p) < size) {
+        std::size_t blockSize = d_nextBlockSize;
+        if (blockSize < size + sizeof(StringInternTable_Block)) {
+            blockSize = size + sizeof(StringInternTable_Block);
+        }
+        else if (d_nextBlockSize < k_MAX_BLOCK_SIZE) {
+            d_nextBlockSize *= 2;
+        }
+
+        StringInternTable_Block *block =
+                                     static_cast<StringInternTable_Block *>(
+                                           d_allocator_p->allocate(blockSize));
+        block->d_next_p = d_blocks_p;
+        d_blocks_p      = block;
+
+        d_cursor_p = reinterpret_cast<char *>(block + 1);
+        d_end_p    = reinterpret_cast<char *>(block) + blockSize;
+
+        AtomicOps::addInt64Relaxed(&d_numBytesAllocated, blockSize);
+    }
+
+    StringInternTable_Entry *entry =
+                       reinterpret_cast<StringInternTable_Entry *>(d_cursor_p);
+    d_cursor_p += size;
+
+    entry->d_hash   = hash;
+    entry->d_length = length;
+
+    char *entryCharacters = reinterpret_cast<char *>(entry + 1);
+    std::memcpy(entryCharacters, characters, length);
+    entryCharacters[length] = '\0';
+
+    return entry;
+}
+
+StringInternTable_Slots *StringInternTable::growSlots(std::size_t minCapacity)
+{
+    StringInternTable_Slots *oldTable =
+                                      static_cast<StringInternTable_Slots *>(
+                                          AtomicOps::getPtrRelaxed(&d_slots));
+
+    std::size_t capacity = oldTable
+                         ? (oldTable->d_mask + 1) * 2
+                         : static_cast<std::size_t>(k_INITIAL_CAPACITY);
+    while (capacity < minCapacity) {
+        capacity *= 2;
+    }
+
+    const std::size_t size = sizeof(StringInternTable_Slots)
+                   + capacity * sizeof(AtomicOps::AtomicTypes::Pointer);
+
+    StringInternTable_Slots *newTable = static_cast<StringInternTable_Slots *>(
+                                                d_allocator_p->allocate(size));
+    newTable->d_mask      = capacity - 1;
+    newTable->d_retired_p = oldTable;
+
+    AtomicOps::AtomicTypes::Pointer *slots = newTable->slots();
+    for (std::size_t i = 0; i < capacity; ++i) {
+        AtomicOps::initPointer(slots + i, 0);
+    }
+
+    if (oldTable) {
+        const AtomicOps::AtomicTypes::Pointer *oldSlots = oldTable->slots();
+        for (std::size_t i = 0; i <= oldTable->d_mask; ++i) {
+            const StringInternTable_Entry *entry =
+                                 static_cast<const StringInternTable_Entry *>(
+                                       AtomicOps::getPtrRelaxed(oldSlots + i));
+            if (entry) {
+                insert(newTable, entry);
+            }
+        }
+    }
+
+    AtomicOps::addInt64Relaxed(&d_numBytesAllocated, size);
+    AtomicOps::setPtrRelease(&d_slots, newTable);
+
+    return newTable;
+}
+
+// CREATORS
+StringInternTable::StringInternTable(bslma::Allocator *basicAllocator)
+: d_lock()
+, d_blocks_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_nextBlockSize(k_INITIAL_BLOCK_SIZE)
+, d_numRequests()
+, d_numBytesRequested()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    AtomicOps::initPointer(&d_slots, 0);
+    AtomicOps::initInt64(&d_numStrings, 0);
+    AtomicOps::initInt64(&d_numBytesStored, 0);
+    AtomicOps::initInt64(&d_numBytesAllocated, 0);
+}
+
+StringInternTable::~StringInternTable()
+{
+    StringInternTable_Slots *table = static_cast<StringInternTable_Slots *>(
+                                          AtomicOps::getPtrRelaxed(&d_slots));
+    while (table) {
+        StringInternTable_Slots *retired = table->d_retired_p;
+        d_allocator_p->deallocate(table);
+        table = retired;
+    }
+
+    while (d_blocks_p) {
+        StringInternTable_Block *next = d_blocks_p->d_next_p;
+        d_allocator_p->deallocate(d_blocks_p);
+        d_blocks_p = next;
+    }
+}
+
+// MANIPULATORS
+StringRef StringInternTable::intern(const StringRef& string)
+{
+    const std::size_t length = static_cast<std::size_t>(string.length());
+    const std::size_t hash   = hashString(string.data(), length);
+
+    d_numRequests.increment();
+    d_numBytesRequested.add(static_cast<bsls::Types::Int64>(length));
+
+    // Look the string up without acquiring the lock first: interning a string
+    // that is already in the table is expected to be the common case.
+
+    const StringInternTable_Slots *table =
+                                 static_cast<const StringInternTable_Slots *>(
+                                          AtomicOps::getPtrAcquire(&d_slots));
+    const StringInternTable_Entry *entry =
+                     table ? lookup(table, string.data(), length, hash) : 0;
+
+    if (!entry) {
+        bsls::AdaptiveLockGuard guard(&d_lock);
+
+        // Another thread may have inserted the string, or replaced the hash
+        // table, since the lookup above.
+
+        StringInternTable_Slots *currentTable =
+                                      static_cast<StringInternTable_Slots *>(
+                                          AtomicOps::getPtrRelaxed(&d_slots));
+        if (currentTable) {
+            entry = lookup(currentTable, string.data(), length, hash);
+        }
+
+        if (!entry) {
+            const bsls::Types::Int64 numStrings =
+                                   AtomicOps::getInt64Relaxed(&d_numStrings);
+
+            if (!currentTable || static_cast<std::size_t>(numStrings + 1) * 2
+                                                 > currentTable->d_mask + 1) {
+                currentTable = growSlots(0);
+            }
+
+            entry = createEntry(string.data(), length, hash);
+            insert(currentTable, entry);
+
+            AtomicOps::setInt64Relaxed(&d_numStrings, numStrings + 1);
+            AtomicOps::addInt64Relaxed(
+                                 &d_numBytesStored,
+                                 static_cast<bsls::Types::Int64>(length));
+        }
+    }
+
+    return StringRef(entry->characters(), static_cast<int>(length));
+}
+
+void StringInternTable::reserve(std::size_t numStrings)
+{
+    bsls::AdaptiveLockGuard guard(&d_lock);
+
+    const StringInternTable_Slots *table =
+                                 static_cast<const StringInternTable_Slots *>(
+                                          AtomicOps::getPtrRelaxed(&d_slots));
+
+    if (!table || table->d_mask + 1 < numStrings * 2) {
+        growSlots(numStrings * 2);
+    }
+}
+
+// ACCESSORS
+StringRef StringInternTable::find(const StringRef& string) const
+{
+    const StringInternTable_Slots *table =
+                                 static_cast<const StringInternTable_Slots *>(
+                                          AtomicOps::getPtrAcquire(&d_slots));
+    if (!table) {
+        return StringRef();                                           // RETURN
+    }
+
+    const std::size_t length = static_cast<std::size_t>(string.length());
+    const StringInternTable_Entry *entry =
+                                lookup(table,
+                                       string.data(),
+                                       length,
+                                       hashString(string.data(), length));
+
+    return entry ? StringRef(entry->characters(), static_cast<int>(length))
+                 : StringRef();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,362 @@
+// bslstl_stringinterntable.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLSTL_STRINGINTERNTABLE
+#define INCLUDED_BSLSTL_STRINGINTERNTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe table of interned strings.
+//
+//@CLASSES:
+//  bslstl::StringInternTable: table storing each distinct string once
+//
+//@SEE_ALSO: bslstl_stringref, bslstl_sharedstring
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bslstl::StringInternTable', that *interns* strings: the table stores a
+// single copy of each distinct string value passed to its 'intern' method,
+// and returns a 'bslstl::StringRef' bound to that copy.  The characters
+// referred to by the returned reference are stable, remaining valid, at the
+// same address, for the lifetime of the table.  Two references returned by
+// the same table therefore have the same value if and only if they refer to
+// the same characters, so that equality of interned strings can be tested by
+// comparing the addresses of their data:
+//..
+//  const bslstl::StringRef a = table.intern(x);
+//  const bslstl::StringRef b = table.intern(y);
+//  assert((a.data() == b.data()) == (x == y));
+//..
+// This makes interning suitable for identifiers (e.g., instrument codes or
+// account identifiers) that occur millions of times in a data set, but take
+// comparatively few distinct values.
+//
+///Storage
+///-------
+// The characters of the interned strings, each preceded by its hash value and
+// length and followed by a null terminator, are stored contiguously in large
+// blocks of memory obtained from the allocator supplied at construction (an
+// arena), and are released only when the table is destroyed.  The table
+// itself is an open-addressed hash table with linear probing, each of whose
+// slots holds the address of an interned string; it grows, doubling its
+// capacity, when it becomes half full.  Note that interning a string that is
+// already in the table neither allocates memory nor copies any characters.
+//
+// The accessors 'numBytesRequested' and 'numBytesStored' report the total
+// length of the strings passed to 'intern' and the total length of the
+// distinct strings stored, respectively; the difference between them is the
+// memory saved by interning, relative to storing a copy of each string
+// requested.  'numBytesAllocated' reports the memory obtained from the
+// allocator for the arena and the hash table.
+//
+///Thread Safety
+///-------------
+// 'bslstl::StringInternTable' is fully thread-safe: 'intern', 'reserve', and
+// all the accessors may be called concurrently from any number of threads.
+// Lookups ('find', and 'intern' of a string already in the table) do not
+// acquire a lock: new strings are published to the hash table using
+// release-acquire atomic operations, and the hash table is replaced, rather
+// than modified in place, when it grows (the replaced tables are retained
+// until the intern table is destroyed, so that a concurrent lookup never
+// reads released memory).  Insertions of new strings are serialized by a
+// 'bsls::AdaptiveLock'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Interning Identifiers Read from a Feed
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we process a stream of trade records, each naming an account, and
+// that the same few accounts occur in a great number of records.  We intern
+// the account identifiers as they are read, so that each distinct identifier
+// is stored once, and accounts can be compared by address.
+//
+// First, we create an intern table:
+//..
+//  bslma::TestAllocator       ta;
+//  bslstl::StringInternTable  table(&ta);
+//..
+// Then, we intern the account identifiers of a number of records:
+//..
+//  const char *records[] = { "ACCT-000017", "ACCT-004711", "ACCT-000017",
+//                            "ACCT-000017", "ACCT-004711", "ACCT-000042" };
+//  bslstl::StringRef accounts[6];
+//
+//  for (int i = 0; i < 6; ++i) {
+//      accounts[i] = table.intern(records[i]);
+//  }
+//..
+// Next, we observe that equal identifiers have been interned to the same
+// address, and distinct identifiers to distinct addresses:
+//..
+//  assert(accounts[0].data() == accounts[2].data());
+//  assert(accounts[0].data() == accounts[3].data());
+//  assert(accounts[1].data() == accounts[4].data());
+//  assert(accounts[0].data() != accounts[1].data());
+//  assert(accounts[0].data() != accounts[5].data());
+//  assert("ACCT-000042"      == accounts[5]);
+//..
+// Then, we look up an identifier without interning it:
+//..
+//  assert(table.find("ACCT-004711").data() == accounts[1].data());
+//  assert(0 == table.find("ACCT-999999").data());
+//..
+// Finally, we observe the memory saved by interning:
+//..
+//  assert( 3 == table.numStrings());
+//  assert( 6 == table.numInternRequests());
+//  assert(66 == table.numBytesRequested());
+//  assert(33 == table.numBytesStored());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ADAPTIVELOCK
+#include <bsls_adaptivelock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_SHARDEDCOUNTER
+#include <bsls_shardedcounter.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+struct StringInternTable_Entry;
+struct StringInternTable_Slots;
+union  StringInternTable_Block;
+
+                          // =======================
+                          // class StringInternTable
+                          // =======================
+
+class StringInternTable {
+    // This mechanism stores a single copy of each distinct string passed to
+    // its 'intern' method, and returns stable references to those copies.
+    // See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations         AtomicOps;
+    typedef AtomicOps::AtomicTypes::Int64  AtomicInt64;
+
+    // DATA
+    AtomicOps::AtomicTypes::Pointer
+                            d_slots;              // current hash table
+                                                  // ('StringInternTable_Slots'
+                                                  // or 0)
+
+    bsls::AdaptiveLock      d_lock;               // serializes insertions
+
+    StringInternTable_Block
+                           *d_blocks_p;           // list of arena blocks
+
+    char                   *d_cursor_p;           // next free byte in the
+                                                  // current arena block
+
+    char                   *d_end_p;              // end of the current arena
+                                                  // block
+
+    std::size_t             d_nextBlockSize;      // size of the next arena
+                                                  // block to allocate
+
+    AtomicInt64             d_numStrings;         // number of distinct strings
+
+    AtomicInt64             d_numBytesStored;     // total length of distinct
+                                                  // strings
+
+    AtomicInt64             d_numBytesAllocated;  // memory obtained from
+                                                  // 'd_allocator_p'
+
+    bsls::ShardedCounter    d_numRequests;        // calls to 'intern'
+
+    bsls::ShardedCounter    d_numBytesRequested;  // total length of strings
+                                                  // passed to 'intern'
+
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held,
+                                                  // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    StringInternTable(const StringInternTable&);             // = delete
+    StringInternTable& operator=(const StringInternTable&);  // = delete
+
+    // PRIVATE MANIPULATORS
+    const StringInternTable_Entry *createEntry(const char  *characters,
+                                               std::size_t  length,
+                                               std::size_t  hash);
+        // Copy the string of the specified 'length' at the specified
+        // 'characters', having the specified 'hash', into the arena, and
+        // return the address of the new entry.  The behavior is undefined
+        // unless the calling thread holds 'd_lock'.
+
+    StringInternTable_Slots *growSlots(std::size_t minCapacity);
+        // Replace the hash table of this object with one having a capacity of
+        // at least the specified 'minCapacity' and holding the same entries,
+        // publish the new table, and return its address.  The behavior is
+        // undefined unless the calling thread holds 'd_lock'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StringInternTable,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit StringInternTable(bslma::Allocator *basicAllocator = 0);
+        // Create an empty intern table.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  Note that no memory is
+        // allocated until the first string is interned.
+
+    ~StringInternTable();
+        // Destroy this object, releasing the memory of all the strings it
+        // stores.  The behavior is undefined if any reference returned by
+        // this object is used after it is destroyed.
+
+    // MANIPULATORS
+    StringRef intern(const StringRef& string);
+        // Return a reference to the copy, stored in this table, of the
+        // specified 'string', first storing a copy if this table does not
+        // already hold a string having the value of 'string'.  The returned
+        // reference remains valid for the lifetime of this table, and is
+        // bound to the same characters for every call with an equal 'string'.
+        // Note that the characters of the stored copy are null-terminated.
+
+    void reserve(std::size_t numStrings);
+        // Ensure that this table can hold at least the specified 'numStrings'
+        // distinct strings without growing its hash table.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the address of the allocator used by this object to supply
+        // memory.
+
+    StringRef find(const StringRef& string) const;
+        // Return a reference to the copy, stored in this table, of the
+        // specified 'string' if this table holds a string having the value of
+        // 'string', and a default-constructed 'StringRef' (whose 'data' is 0)
+        // otherwise.
+
+    bsls::Types::Int64 numBytesAllocated() const;
+        // Return the number of bytes of memory obtained by this table from its
+        // allocator, for both the stored strings and the hash table.
+
+    bsls::Types::Int64 numBytesRequested() const;
+        // Return the total length of the strings passed to 'intern'.
+
+    bsls::Types::Int64 numBytesStored() const;
+        // Return the total length of the distinct strings stored in this
+        // table.  Note that 'numBytesRequested() - numBytesStored()' is the
+        // number of bytes saved by interning.
+
+    bsls::Types::Int64 numInternRequests() const;
+        // Return the number of calls to 'intern'.
+
+    bsls::Types::Int64 numStrings() const;
+        // Return the number of distinct strings stored in this table.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class StringInternTable
+                          // -----------------------
+
+// ACCESSORS
+inline
+bslma::Allocator *StringInternTable::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsls::Types::Int64 StringInternTable::numBytesAllocated() const
+{
+    return AtomicOps::getInt64Relaxed(&d_numBytesAllocated);
+}
+
+inline
+bsls::Types::Int64 StringInternTable::numBytesRequested() const
+{
+    return d_numBytesRequested.value();
+}
+
+inline
+bsls::Types::Int64 StringInternTable::numBytesStored() const
+{
+    return AtomicOps::getInt64Relaxed(&d_numBytesStored);
+}
+
+inline
+bsls::Types::Int64 StringInternTable::numInternRequests() const
+{
+    return d_numRequests.value();
+}
+
+inline
+bsls::Types::Int64 StringInternTable::numStrings() const
+{
+    return AtomicOps::getInt64Relaxed(&d_numStrings);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,855 @@
+// bslstl_stringinterntable.t.cpp                                     -*-C++-*-
+#include <bslstl_stringinterntable.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bslstl_string.h>                 // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_platform.h>                 // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::StringInternTable' is a mechanism whose observable behavior is the
+// address and value of the references returned by 'intern' and 'find', its
+// statistics, and its use of memory.  The single-threaded behavior is tested
+// against a straightforward model (an array of the distinct values interned
+// so far), over enough strings to grow the hash table and the arena several
+// times, verifying that previously returned references remain valid.  The
+// concurrent behavior is tested by interning overlapping sets of strings from
+// several threads, while other threads look them up, and verifying that every
+// thread obtained the same address for each value.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StringInternTable(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~StringInternTable();
+//
+// MANIPULATORS
+// [ 2] StringRef intern(const StringRef& string);
+// [ 4] void reserve(std::size_t numStrings);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] StringRef find(const StringRef& string) const;
+// [ 3] bsls::Types::Int64 numBytesAllocated() const;
+// [ 3] bsls::Types::Int64 numBytesRequested() const;
+// [ 3] bsls::Types::Int64 numBytesStored() const;
+// [ 3] bsls::Types::Int64 numInternRequests() const;
+// [ 3] bsls::Types::Int64 numStrings() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: 'intern' and 'find' may be called concurrently.
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: INTERNING A CORPUS OF TOKENS
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::StringInternTable Obj;
+typedef bsls::Types::Int64        Int64;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+enum { k_TOKEN_SIZE = 24 };  // size of the buffer holding a generated token
+
+static
+int formatToken(char *buffer, int index)
+    // Write to the specified 'buffer', which must have at least
+    // 'k_TOKEN_SIZE' bytes, a null-terminated identifier that is distinct for
+    // each specified 'index', and whose length depends on 'index', and return
+    // the length of the identifier.
+{
+    return sprintf(buffer, "%.*sID%d", index % 7, "XXXXXXX", index);
+}
+
+                       // ======================
+                       // struct ConcurrencyTest
+                       // ======================
+
+enum {
+    k_NUM_THREADS        = 4,
+    k_NUM_THREAD_STRINGS = 20000
+};
+
+struct ConcurrencyTest {
+    // This 'struct' holds the state shared by the threads of the concurrency
+    // test case.
+
+    Obj               *d_table_p;
+    const char        *d_results[k_NUM_THREADS][k_NUM_THREAD_STRINGS];
+    int                d_numMissing[k_NUM_THREADS];
+};
+
+struct ConcurrencyTestArgs {
+    // This 'struct' provides the arguments of a thread of the concurrency
+    // test case.
+
+    ConcurrencyTest *d_test_p;
+    int              d_threadIndex;
+};
+
+extern "C" void *internThread(void *arg)
+    // Intern, in an order depending on the thread, the strings of the
+    // concurrency test identified by the specified 'arg', recording the
+    // address of the data returned for each.
+{
+    ConcurrencyTestArgs& args = *static_cast<ConcurrencyTestArgs *>(arg);
+    ConcurrencyTest&     test = *args.d_test_p;
+
+    // Each thread visits the strings with a stride coprime with their number.
+
+    static const int STRIDES[k_NUM_THREADS] = { 1, 3, 7, 9 };
+    const int        stride = STRIDES[args.d_threadIndex];
+
+    char buffer[k_TOKEN_SIZE];
+    for (int i = 0; i < k_NUM_THREAD_STRINGS; ++i) {
+        const int index = (i * stride) % k_NUM_THREAD_STRINGS;
+        formatToken(buffer, index);
+        test.d_results[args.d_threadIndex][index] =
+                                         test.d_table_p->intern(buffer).data();
+
+        // Every string interned before by this thread must be found.
+
+        formatToken(buffer, (i / 2 * stride) % k_NUM_THREAD_STRINGS);
+        if (0 == test.d_table_p->find(buffer).data()) {
+            ++test.d_numMissing[args.d_threadIndex];
+        }
+    }
+    return 0;
+}
+
+                       // ===========================
+                       // struct InternBenchmarkArgs
+                       // ===========================
+
+struct InternBenchmarkArgs {
+    // This 'struct' provides the arguments of a thread of the lookup
+    // benchmark.
+
+    const Obj  *d_table_p;
+    const char *d_vocabulary;
+    int         d_vocabularySize;
+    int         d_numLookups;
+    int         d_numFound;
+};
+
+extern "C" void *lookupThread(void *arg)
+    // Look up, in the table identified by the specified 'arg', a number of
+    // tokens chosen from its vocabulary, and record the number found.
+{
+    InternBenchmarkArgs& args = *static_cast<InternBenchmarkArgs *>(arg);
+
+    unsigned int random = static_cast<unsigned int>(
+                                  reinterpret_cast<bsls::Types::UintPtr>(arg));
+    int numFound = 0;
+    for (int i = 0; i < args.d_numLookups; ++i) {
+        random = random * 1103515245 + 12345;
+        const int index = static_cast<int>((random >> 8)
+                                                      % args.d_vocabularySize);
+        if (args.d_table_p->find(args.d_vocabulary
+                                              + index * k_TOKEN_SIZE).data()) {
+            ++numFound;
+        }
+    }
+    args.d_numFound = numFound;
+    return 0;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void) veryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Interning Identifiers Read from a Feed
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we process a stream of trade records, each naming an account, and
+// that the same few accounts occur in a great number of records.  We intern
+// the account identifiers as they are read, so that each distinct identifier
+// is stored once, and accounts can be compared by address.
+//
+// First, we create an intern table:
+//..
+    bslma::TestAllocator       ta;
+    bslstl::StringInternTable  table(&ta);
+//..
+// Then, we intern the account identifiers of a number of records:
+//..
+    const char *records[] = { "ACCT-000017", "ACCT-004711", "ACCT-000017",
+                              "ACCT-000017", "ACCT-004711", "ACCT-000042" };
+    bslstl::StringRef accounts[6];
+
+    for (int i = 0; i < 6; ++i) {
+        accounts[i] = table.intern(records[i]);
+    }
+//..
+// Next, we observe that equal identifiers have been interned to the same
+// address, and distinct identifiers to distinct addresses:
+//..
+    ASSERT(accounts[0].data() == accounts[2].data());
+    ASSERT(accounts[0].data() == accounts[3].data());
+    ASSERT(accounts[1].data() == accounts[4].data());
+    ASSERT(accounts[0].data() != accounts[1].data());
+    ASSERT(accounts[0].data() != accounts[5].data());
+    ASSERT("ACCT-000042"      == accounts[5]);
+//..
+// Then, we look up an identifier without interning it:
+//..
+    ASSERT(table.find("ACCT-004711").data() == accounts[1].data());
+    ASSERT(0 == table.find("ACCT-999999").data());
+//..
+// Finally, we observe the memory saved by interning:
+//..
+    ASSERT( 3 == table.numStrings());
+    ASSERT( 6 == table.numInternRequests());
+    ASSERT(66 == table.numBytesRequested());
+    ASSERT(33 == table.numBytesStored());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'intern' AND 'find' MAY BE CALLED CONCURRENTLY
+        //
+        // Concerns:
+        //: 1 Strings interned concurrently by several threads are stored
+        //:   once, and each thread obtains the same address for a value.
+        //:
+        //: 2 A string interned by a thread is found by that thread
+        //:   thereafter, while other threads grow the table.
+        //
+        // Plan:
+        //: 1 Start several threads, each interning the same set of strings,
+        //:   in a different order, and looking up strings it has interned.
+        //:   After joining the threads, verify that all threads obtained the
+        //:   same address for each string, that no lookup failed, and that
+        //:   the table holds one copy of each string.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'intern' and 'find' may be called concurrently.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: 'intern' AND 'find' MAY BE CALLED"
+                            " CONCURRENTLY"
+                            "\n=========================================="
+                            "=============\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int iteration = 0; iteration < 5; ++iteration) {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ConcurrencyTest *testState = new ConcurrencyTest;
+            testState->d_table_p = &mX;
+
+            ConcurrencyTestArgs args[k_NUM_THREADS];
+            ThreadId            threads[k_NUM_THREADS];
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                testState->d_numMissing[t] = 0;
+                args[t].d_test_p      = testState;
+                args[t].d_threadIndex = t;
+                threads[t] = createThread(&internThread, &args[t]);
+            }
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                joinThread(threads[t]);
+            }
+
+            ASSERTV(X.numStrings(), k_NUM_THREAD_STRINGS == X.numStrings());
+            ASSERT(k_NUM_THREADS * k_NUM_THREAD_STRINGS
+                                                   == X.numInternRequests());
+
+            char buffer[k_TOKEN_SIZE];
+            for (int i = 0; i < k_NUM_THREAD_STRINGS; ++i) {
+                formatToken(buffer, i);
+                const char *EXP = X.find(buffer).data();
+                ASSERTV(i, 0 != EXP);
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    ASSERTV(i, t, EXP == testState->d_results[t][i]);
+                }
+            }
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                ASSERTV(t, 0 == testState->d_numMissing[t]);
+            }
+
+            delete testState;
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'reserve'
+        //
+        // Concerns:
+        //: 1 After 'reserve(n)', interning 'n' distinct strings does not grow
+        //:   the hash table.
+        //:
+        //: 2 'reserve' does not shrink the hash table, and does not affect
+        //:   the strings already interned.
+        //
+        // Plan:
+        //: 1 Reserve space for a number of strings, intern that number of
+        //:   strings, and verify, using the number of blocks allocated, that
+        //:   the only allocations are those of the arena.  (C-1)
+        //:
+        //: 2 Reserve space for fewer strings, and verify that no memory is
+        //:   allocated, and that the strings are still found.  (C-2)
+        //
+        // Testing:
+        //   void reserve(std::size_t numStrings);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'reserve'"
+                            "\n=================\n");
+
+        const int NUMS[] = { 0, 1, 31, 32, 33, 100, 1000, 5000 };
+        const int NUM_NUMS = sizeof NUMS / sizeof *NUMS;
+
+        for (int ti = 0; ti < NUM_NUMS; ++ti) {
+            const int N = NUMS[ti];
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.reserve(N);
+            ASSERTV(N, 1 == ta.numBlocksTotal());
+
+            // Strings are no longer than 16 bytes, so the size of an entry
+            // is at most 40 bytes, and every arena block (except possibly the
+            // last) is at least half full.
+
+            const Int64 MIN_BLOCK_SIZE = 4 * 1024;
+
+            char buffer[k_TOKEN_SIZE];
+            for (int i = 0; i < N; ++i) {
+                formatToken(buffer, i);
+                mX.intern(buffer);
+            }
+            const Int64 NUM_BLOCKS = ta.numBlocksTotal();
+            ASSERTV(N, NUM_BLOCKS,
+                    NUM_BLOCKS <= 2 + (N * 40 * 2) / MIN_BLOCK_SIZE);
+
+            mX.reserve(N / 2);
+            ASSERTV(N, NUM_BLOCKS == ta.numBlocksTotal());
+
+            // Growing the hash table afterwards retains the strings.
+
+            mX.reserve(4 * N + 100);
+            for (int i = 0; i < N; ++i) {
+                formatToken(buffer, i);
+                ASSERTV(N, i, X.find(buffer) == buffer);
+            }
+            ASSERTV(N, N == X.numStrings());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING STATISTICS
+        //
+        // Concerns:
+        //: 1 'numStrings' and 'numBytesStored' report the number and the total
+        //:   length of the distinct strings interned.
+        //:
+        //: 2 'numInternRequests' and 'numBytesRequested' report the number of
+        //:   calls to 'intern' and the total length of their arguments.
+        //:
+        //: 3 'numBytesAllocated' reports the memory in use from the
+        //:   allocator.
+        //:
+        //: 4 'find' does not affect the statistics.
+        //
+        // Plan:
+        //: 1 Intern, and look up, a sequence of strings having repeated
+        //:   values, and verify the statistics against values computed
+        //:   independently, and the memory in use from a test allocator.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numBytesAllocated() const;
+        //   bsls::Types::Int64 numBytesRequested() const;
+        //   bsls::Types::Int64 numBytesStored() const;
+        //   bsls::Types::Int64 numInternRequests() const;
+        //   bsls::Types::Int64 numStrings() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING STATISTICS"
+                            "\n==================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(0 == X.numStrings());
+        ASSERT(0 == X.numInternRequests());
+        ASSERT(0 == X.numBytesRequested());
+        ASSERT(0 == X.numBytesStored());
+        ASSERT(0 == X.numBytesAllocated());
+
+        const int N = 3000;
+
+        Int64 numStrings     = 0;
+        Int64 numRequests    = 0;
+        Int64 bytesRequested = 0;
+        Int64 bytesStored    = 0;
+
+        char buffer[k_TOKEN_SIZE];
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < N; ++i) {
+                // Each round interns the values of the previous rounds, and
+                // as many new values.
+
+                const int index  = i % ((round + 1) * N / 3);
+                const int length = formatToken(buffer, index);
+
+                const bool isNew = 0 == X.find(buffer).data();
+
+                mX.intern(buffer);
+
+                ++numRequests;
+                bytesRequested += length;
+                if (isNew) {
+                    ++numStrings;
+                    bytesStored += length;
+                }
+
+                ASSERTV(round, i, numStrings     == X.numStrings());
+                ASSERTV(round, i, numRequests    == X.numInternRequests());
+                ASSERTV(round, i, bytesRequested == X.numBytesRequested());
+                ASSERTV(round, i, bytesStored    == X.numBytesStored());
+                ASSERTV(round, i, ta.numBytesInUse()
+                                                     == X.numBytesAllocated());
+            }
+        }
+        ASSERT(N == numStrings);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'intern' AND 'find'
+        //
+        // Concerns:
+        //: 1 'intern' returns a reference having the value of its argument,
+        //:   to null-terminated characters owned by the table.
+        //:
+        //: 2 'intern' returns the same address for equal values, and distinct
+        //:   addresses for distinct values, including values differing only
+        //:   in length, and values having embedded null characters.
+        //:
+        //: 3 The references returned remain valid, and at the same address,
+        //:   as the table grows.
+        //:
+        //: 4 'find' returns the reference returned by 'intern' for an
+        //:   interned value, and a reference having a null 'data' otherwise.
+        //:   The empty string can be interned, and is then found.
+        //:
+        //: 5 Memory is supplied by the allocator supplied at construction (or
+        //:   by the default allocator), and is released on destruction.
+        //
+        // Plan:
+        //: 1 Intern a large number of distinct values, twice each, recording
+        //:   the addresses returned, and verify them after each call, and
+        //:   again when all the values have been interned.  (C-1..4)
+        //:
+        //: 2 Intern values having embedded null characters, and values that
+        //:   are prefixes of one another.  (C-2)
+        //:
+        //: 3 Create tables with and without an allocator, and verify the
+        //:   memory in use from the allocators.  (C-5)
+        //
+        // Testing:
+        //   explicit StringInternTable(bslma::Allocator *basicAllocator = 0);
+        //   ~StringInternTable();
+        //   StringRef intern(const StringRef& string);
+        //   bslma::Allocator *allocator() const;
+        //   StringRef find(const StringRef& string) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'intern' AND 'find'"
+                            "\n===========================\n");
+
+        if (verbose) printf("\tAllocators.\n");
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX;  const Obj& X = mX;
+                ASSERT(&defaultAllocator == X.allocator());
+
+                Obj mY(&ta);  const Obj& Y = mY;
+                ASSERT(&ta == Y.allocator());
+                ASSERT(0 == ta.numBlocksTotal());
+                ASSERT(0 == Y.find("").data());
+
+                mX.intern("x");
+                mY.intern("y");
+                ASSERT(0 <  ta.numBlocksInUse());
+                ASSERT(0 <  defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tMany values.\n");
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const int    N = 20000;
+            const char **addresses = new const char *[N];
+
+            char buffer[k_TOKEN_SIZE];
+            for (int i = 0; i < N; ++i) {
+                const int length = formatToken(buffer, i);
+
+                const bslstl::StringRef R = mX.intern(buffer);
+                ASSERTV(i, R == buffer);
+                ASSERTV(i, R.data() != buffer);
+                ASSERTV(i, '\0' == R.data()[length]);
+                addresses[i] = R.data();
+
+                ASSERTV(i, addresses[i] == mX.intern(buffer).data());
+                ASSERTV(i, addresses[i] == X.find(buffer).data());
+
+                formatToken(buffer, i / 2);
+                ASSERTV(i, addresses[i / 2] == X.find(buffer).data());
+
+                formatToken(buffer, i + 1);
+                ASSERTV(i, 0 == X.find(buffer).data());
+            }
+
+            for (int i = 0; i < N; ++i) {
+                const int length = formatToken(buffer, i);
+                ASSERTV(i, 0 == memcmp(addresses[i], buffer, length + 1));
+                ASSERTV(i, addresses[i] == X.find(buffer).data());
+            }
+            ASSERT(N == X.numStrings());
+
+            delete [] addresses;
+        }
+
+        if (verbose) printf("\tEmbedded nulls and prefixes.\n");
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const char VALUE[] = "ab\0ab\0";
+
+            const char *ADDRESSES[7];
+            for (int length = 0; length <= 6; ++length) {
+                ADDRESSES[length] =
+                          mX.intern(bslstl::StringRef(VALUE, length)).data();
+                ASSERTV(length, 0 != ADDRESSES[length]);
+            }
+            for (int i = 0; i <= 6; ++i) {
+                const bslstl::StringRef R =
+                                       X.find(bslstl::StringRef(VALUE, i));
+                ASSERTV(i, ADDRESSES[i] == R.data());
+                ASSERTV(i, i            == static_cast<int>(R.length()));
+                for (int j = 0; j < i; ++j) {
+                    ASSERTV(i, j, ADDRESSES[i] != ADDRESSES[j]);
+                }
+            }
+            ASSERT(0 == X.find("").length());
+            ASSERT(7 == X.numStrings());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Intern and look up a few strings.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bsl::string A("IBM US Equity");
+            const bsl::string B("IBM US Equity");
+            const bsl::string C("VOD LN Equity");
+
+            const bslstl::StringRef RA = mX.intern(A);
+            const bslstl::StringRef RB = mX.intern(B);
+            const bslstl::StringRef RC = mX.intern(C);
+
+            ASSERT(RA.data() == RB.data());
+            ASSERT(RA.data() != RC.data());
+            ASSERT(RA        == A);
+            ASSERT(RC        == C);
+
+            ASSERT(RC.data() == X.find("VOD LN Equity").data());
+            ASSERT(0         == X.find("VOD").data());
+
+            ASSERT(2 == X.numStrings());
+            ASSERT(3 == X.numInternRequests());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: INTERNING A CORPUS OF TOKENS
+        //
+        // Concerns:
+        //: 1 Interning a large corpus of tokens drawn, with a skewed
+        //:   distribution, from a much smaller vocabulary, stores each
+        //:   distinct token once and runs at a high rate.
+        //:
+        //: 2 Lookups scale with the number of threads.
+        //
+        // Plan:
+        //: 1 Intern a corpus of (by default) 50 million tokens drawn from a
+        //:   vocabulary of one million identifiers, and report the time taken
+        //:   and the memory statistics.  (C-1)
+        //:
+        //: 2 Look up tokens from several threads concurrently, and report the
+        //:   aggregate rate.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE: INTERNING A CORPUS OF TOKENS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: INTERNING A CORPUS OF TOKENS"
+                            "\n=========================================\n");
+
+        const int NUM_TOKENS = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 50 * 1000 * 1000;
+        const int VOCABULARY_SIZE = 1000 * 1000;
+
+        char *vocabulary = new char[VOCABULARY_SIZE * k_TOKEN_SIZE];
+        for (int i = 0; i < VOCABULARY_SIZE; ++i) {
+            formatToken(vocabulary + i * k_TOKEN_SIZE, i);
+        }
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        Obj                  mX(&ta);
+
+        bsls::Stopwatch timer;
+        timer.start();
+
+        unsigned int random = 1;
+        for (int i = 0; i < NUM_TOKENS; ++i) {
+            // Draw indices with a skewed distribution: small indices (common
+            // identifiers) are much more likely than large ones.
+
+            random = random * 1103515245 + 12345;
+            const bsls::Types::Uint64 u    = random >> 8;
+            const bsls::Types::Uint64 cube = (u * u >> 24) * u >> 28;
+            const int index = static_cast<int>(cube * VOCABULARY_SIZE >> 20);
+
+            mX.intern(vocabulary + index * k_TOKEN_SIZE);
+        }
+        timer.stop();
+
+        const double elapsed = timer.elapsedTime();
+
+        printf("\tinterned %d tokens in %.3fs (%.1f million tokens/s)\n",
+               NUM_TOKENS,
+               elapsed,
+               NUM_TOKENS / elapsed / 1.0e6);
+        printf("\tdistinct strings:   %lld\n", mX.numStrings());
+        printf("\tbytes requested:    %lld\n", mX.numBytesRequested());
+        printf("\tbytes stored:       %lld\n", mX.numBytesStored());
+        printf("\tbytes allocated:    %lld\n", mX.numBytesAllocated());
+        printf("\tbytes saved:        %lld\n",
+               mX.numBytesRequested() - mX.numBytesAllocated());
+
+        const int NUM_LOOKUPS = 10 * 1000 * 1000;
+
+        for (int numThreads = 1; numThreads <= 4; numThreads *= 2) {
+            InternBenchmarkArgs args[4];
+            ThreadId            threads[4];
+
+            timer.reset();
+            timer.start();
+            for (int t = 0; t < numThreads; ++t) {
+                args[t].d_table_p        = &mX;
+                args[t].d_vocabulary     = vocabulary;
+                args[t].d_vocabularySize = VOCABULARY_SIZE;
+                args[t].d_numLookups     = NUM_LOOKUPS;
+                args[t].d_numFound       = 0;
+                threads[t] = createThread(&lookupThread, &args[t]);
+            }
+            for (int t = 0; t < numThreads; ++t) {
+                joinThread(threads[t]);
+            }
+            timer.stop();
+
+            printf("\t%d thread(s): %.1f million lookups/s\n",
+                   numThreads,
+                   numThreads * NUM_LOOKUPS / timer.elapsedTime() / 1.0e6);
+        }
+
+        delete [] vocabulary;
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
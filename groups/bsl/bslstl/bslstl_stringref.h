@@ -10,9 +10,14 @@ BSLS_IDENT("$Id: $")
 //@PURPOSE: Provide a reference to a 'const' string.
 //
 //@CLASSES:
-//   bslstl::StringRefImp: reference wrapper for a generic string
-//      bslstl::StringRef: reference wrapper for a 'char' string
-//  bslstl::StringRefWide: reference wrapper for a 'wchar_t' string
+//                bslstl::StringRefImp: reference wrapper for a generic string
+//                   bslstl::StringRef: reference wrapper for a 'char' string
+//               bslstl::StringRefWide: reference wrapper for a wide string
+//   bslstl::StringRefSplitIteratorImp: iterator over fields of a string
+//      bslstl::StringRefSplitIterator: iterator over fields of a 'char' string
+//  bslstl::StringRefSplitIteratorWide: iterator over fields of a wide string
+//
+//@SEE_ALSO: bslstl_stringsearchutil
 //
 //@DESCRIPTION: This component defines two classes, 'bsls::StringRef' and
 // 'bsls::StringRefWide', each providing a reference to a non-modifiable string
@@ -67,6 +72,30 @@ BSLS_IDENT("$Id: $")
 // enable the use of 'bslstl::StringRef' with STL hash containers (e.g.,
 // 'bsl::unordered_set' and 'bsl::unordered_map').
 //
+///Searching, Slicing, and Splitting
+///---------------------------------
+// 'bslstl::StringRef' provides the non-modifying search methods of
+// 'bsl::string' ('find', 'rfind', 'find_first_of', 'find_last_of',
+// 'find_first_not_of', and 'find_last_not_of'), with the same semantics for
+// positions and the same return value ('npos') if nothing is found.  The
+// searches are performed by 'bslstl::StringSearchUtil', as they are for
+// 'bsl::string', and neither they nor any of the following operations
+// allocate memory:
+//
+//: o 'substr' returns a string reference to part of the referenced string.
+//:
+//: o 'starts_with' and 'ends_with' test for a prefix or a suffix.
+//:
+//: o 'remove_prefix', 'remove_suffix', and 'trim' rebind a string reference
+//:   to part of the string it references ('trim' removes leading and
+//:   trailing whitespace).
+//
+// 'bslstl::StringRefSplitIterator' (and its 'wchar_t' variant,
+// 'bslstl::StringRefSplitIteratorWide') iterates over the fields of a string
+// separated by any of a set of delimiter characters, providing each field as
+// a 'bslstl::StringRef' that refers to the original string.  Fields may be
+// empty: a string containing 'N' delimiters has 'N + 1' fields.
+//
 ///Efficiency and Usage Considerations
 ///-----------------------------------
 // Using 'bslstl::StringRef' to pass strings as function arguments can be
@@ -247,6 +276,59 @@ BSLS_IDENT("$Id: $")
 //  numBlanks = getNumBlanks(bslstl::StringRef(poemWithNulls, poemLength));
 //  assert(42 == numBlanks);
 //..
+//
+///Example 2: Parsing Fields Without Allocating Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive messages consisting of 'tag=value' fields separated
+// by '|' characters, and that we need to extract the value of a tag without
+// creating any 'bsl::string' objects.
+//
+// First, we define a function, 'findValue', that splits the message into
+// fields, and splits each field at its '=' character:
+//..
+//  bslstl::StringRef findValue(const bslstl::StringRef& message,
+//                              const bslstl::StringRef& tag)
+//      // Return a reference to the (trimmed) value of the first field of the
+//      // specified 'message' having the specified 'tag', or an empty
+//      // reference if there is no such field.
+//  {
+//      for (bslstl::StringRefSplitIterator it(message, "|");
+//           it.isValid();
+//           ++it) {
+//          const bslstl::StringRef::size_type equals = it->find('=');
+//
+//          if (bslstl::StringRef::npos != equals
+//           && tag == it->substr(0, equals)) {
+//              bslstl::StringRef value = it->substr(equals + 1);
+//              value.trim();
+//              return value;                                         // RETURN
+//          }
+//      }
+//      return bslstl::StringRef();
+//  }
+//..
+// Then, we define a message, in which the field with tag '55' has a value that
+// is padded with blanks, and the last field is empty:
+//..
+//  const char message[] = "8=FIX.4.2|35=D|55= IBM |54=1||";
+//..
+// Now, we look for a few tags:
+//..
+//  assert("IBM"     == findValue(message, "55"));
+//  assert("FIX.4.2" == findValue(message, "8"));
+//  assert(findValue(message, "99").isEmpty());
+//..
+// Finally, we use the search methods directly to check the format of the
+// message, and to find its last field:
+//..
+//  const bslstl::StringRef msg(message);
+//
+//  assert(msg.starts_with("8=FIX"));
+//  assert(msg.ends_with("|"));
+//  assert(9  == msg.find_first_of("=|", 2));
+//  assert(29 == msg.rfind('|'));
+//  assert(msg.substr(msg.rfind('|') + 1).isEmpty());
+//..
 
 #ifndef INCLUDED_BSLSCM_VERSION
 #include <bslscm_version.h>
@@ -256,6 +338,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_CHARTRAITSUTIL
+#include <bslstl_chartraitsutil.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_STRING
 #include <bslstl_string.h>
 #endif
@@ -264,6 +350,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_stringrefdata.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGSEARCHUTIL
+#include <bslstl_stringsearchutil.h>
+#endif
+
 #ifndef INCLUDED_IOSFWD
 #include <iosfwd>
 #define INCLUDED_IOSFWD
@@ -313,6 +403,16 @@ class StringRefImp : public StringRefData<CHAR_TYPE> {
   private:
     typedef StringRefData<CHAR_TYPE> Base;
 
+    typedef CharTraitsUtil<native_std::char_traits<CHAR_TYPE> >   Traits;
+
+    typedef StringSearchUtil<native_std::char_traits<CHAR_TYPE> > Search;
+
+    // PRIVATE CLASS METHODS
+    static bool isSpace(CHAR_TYPE character);
+        // Return 'true' if the specified 'character' is a blank, tab,
+        // newline, vertical tab, form feed, or carriage return, and 'false'
+        // otherwise.
+
     // PRIVATE ACCESSORS
     void write(std::basic_ostream<CHAR_TYPE>& stream) const;
         // Write the value of this string reference to the specified output
@@ -335,6 +435,11 @@ class StringRefImp : public StringRefData<CHAR_TYPE> {
     typedef std::size_t         size_type;
         // Standard Library general container requirements.
 
+    // PUBLIC CLASS DATA
+    static const size_type npos = ~size_type(0);
+        // Value returned by the search methods if nothing is found, and
+        // denoting "all remaining characters" when used as a length.
+
   public:
     // CREATORS
     StringRefImp();
@@ -377,10 +482,17 @@ class StringRefImp : public StringRefData<CHAR_TYPE> {
 
     StringRefImp(const native_std::basic_string<CHAR_TYPE>& str);
     StringRefImp(const bsl::basic_string<CHAR_TYPE>& str);
+    template <class ALLOCATOR>
+    StringRefImp(const bsl::basic_string<CHAR_TYPE,
+                                         native_std::char_traits<CHAR_TYPE>,
+                                         ALLOCATOR>& str);
         // Create a string-reference object having a valid 'std::string' value,
         // whose external representation is defined by the specified 'str'
         // object.  The external representation must remain valid as long as it
-        // is bound to this string reference.
+        // is bound to this string reference.  Note that the last overload
+        // accepts a 'bsl::basic_string' having any allocator type (e.g., one
+        // whose short string buffer size is specified by a
+        // 'bslstl::StringBufferAllocator').
 
     StringRefImp(const StringRefImp& original);
         // Create a string-reference object having a valid 'std::string' value,
@@ -443,6 +555,21 @@ class StringRefImp : public StringRefData<CHAR_TYPE> {
         //  isEmpty() == true
         //..
 
+    void remove_prefix(size_type numCharacters);
+        // Rebind this string reference to exclude the specified first
+        // 'numCharacters' characters of the string it references.  The
+        // behavior is undefined unless 'numCharacters <= length()'.
+
+    void remove_suffix(size_type numCharacters);
+        // Rebind this string reference to exclude the specified last
+        // 'numCharacters' characters of the string it references.  The
+        // behavior is undefined unless 'numCharacters <= length()'.
+
+    void trim();
+        // Rebind this string reference to exclude the leading and trailing
+        // whitespace (blank, tab, newline, vertical tab, form feed, and
+        // carriage return) characters of the string it references.
+
     // ACCESSORS
     const_reference operator[](int index) const;
         // Return a reference providing a non-modifiable access to the
@@ -489,6 +616,69 @@ class StringRefImp : public StringRefData<CHAR_TYPE> {
         // comparison and return a negative value if this string is less than
         // 'other' string, a positive value if this string is greater than
         // 'other' string, and 0 if this string is equal to 'other' string.
+
+    bool starts_with(const StringRefImp& prefix) const;
+        // Return 'true' if the string bound to this string reference begins
+        // with the specified 'prefix', and 'false' otherwise.
+
+    bool ends_with(const StringRefImp& suffix) const;
+        // Return 'true' if the string bound to this string reference ends
+        // with the specified 'suffix', and 'false' otherwise.
+
+    StringRefImp substr(size_type position      = 0,
+                        size_type numCharacters = npos) const;
+        // Return a string reference to the characters of the string bound to
+        // this string reference starting at the optionally specified
+        // 'position' (0 by default) and extending for the lesser of the
+        // optionally specified 'numCharacters' (all remaining characters by
+        // default) and 'length() - position' characters.  The behavior is
+        // undefined unless 'position <= length()'.  Note that, unlike
+        // 'bsl::string::substr', this method does not copy the characters.
+
+    size_type find(const StringRefImp& subString,
+                   size_type           position = 0) const;
+    size_type find(CHAR_TYPE character, size_type position = 0) const;
+        // Return the starting position of the *first* occurrence of the
+        // specified 'subString' (or 'character') in the string bound to this
+        // string reference at or after the optionally specified 'position' (0
+        // by default), and 'npos' if there is no such occurrence.
+
+    size_type rfind(const StringRefImp& subString,
+                    size_type           position = npos) const;
+    size_type rfind(CHAR_TYPE character, size_type position = npos) const;
+        // Return the starting position of the *last* occurrence of the
+        // specified 'subString' (or 'character') in the string bound to this
+        // string reference starting at or before the optionally specified
+        // 'position' ('npos' by default), and 'npos' if there is no such
+        // occurrence.
+
+    size_type find_first_of(const StringRefImp& characters,
+                            size_type           position = 0) const;
+        // Return the position of the *first* character at or after the
+        // optionally specified 'position' (0 by default) in the string bound
+        // to this string reference that is one of the specified 'characters',
+        // and 'npos' if there is no such character.
+
+    size_type find_last_of(const StringRefImp& characters,
+                           size_type           position = npos) const;
+        // Return the position of the *last* character at or before the
+        // optionally specified 'position' ('npos' by default) in the string
+        // bound to this string reference that is one of the specified
+        // 'characters', and 'npos' if there is no such character.
+
+    size_type find_first_not_of(const StringRefImp& characters,
+                                size_type           position = 0) const;
+        // Return the position of the *first* character at or after the
+        // optionally specified 'position' (0 by default) in the string bound
+        // to this string reference that is *not* one of the specified
+        // 'characters', and 'npos' if there is no such character.
+
+    size_type find_last_not_of(const StringRefImp& characters,
+                               size_type           position = npos) const;
+        // Return the position of the *last* character at or before the
+        // optionally specified 'position' ('npos' by default) in the string
+        // bound to this string reference that is *not* one of the specified
+        // 'characters', and 'npos' if there is no such character.
 };
 
 // FREE OPERATORS
@@ -684,6 +874,67 @@ std::basic_ostream<CHAR_TYPE>&
     // specified output 'stream' and return a reference to the modifiable
     // 'stream'.
 
+                    // ==========================================
+                    // class StringRefSplitIteratorImp<CHAR_TYPE>
+                    // ==========================================
+
+template <typename CHAR_TYPE>
+class StringRefSplitIteratorImp {
+    // This class provides an iterator over the fields of a string that are
+    // separated by any of a set of delimiter characters.  Each field is
+    // provided as a 'StringRefImp' referring to part of the original string,
+    // so that no characters are copied, and no memory is allocated.  The
+    // string and the delimiters must remain valid as long as they are used by
+    // this iterator.
+
+    // DATA
+    StringRefImp<CHAR_TYPE>  d_field;       // current field
+    StringRefImp<CHAR_TYPE>  d_delimiters;  // delimiter characters
+    const CHAR_TYPE         *d_next_p;      // start of the next field
+    const CHAR_TYPE         *d_end_p;       // end of the string
+    bool                     d_hasNext;     // 'true' if there is a field
+                                            // after the current one
+    bool                     d_isValid;     // 'true' if 'd_field' is a field
+
+  public:
+    // CREATORS
+    StringRefSplitIteratorImp(const StringRefImp<CHAR_TYPE>& string,
+                              const StringRefImp<CHAR_TYPE>& delimiters);
+        // Create an iterator over the fields of the specified 'string' that
+        // are separated by any of the specified 'delimiters' characters,
+        // referring to the first field.  Note that an empty 'string' has a
+        // single (empty) field.
+
+    // ~StringRefSplitIteratorImp() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    StringRefSplitIteratorImp& operator++();
+        // Advance this iterator to refer to the next field, or make it
+        // invalid if the current field is the last one, and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless 'isValid()'.
+
+    // ACCESSORS
+    const StringRefImp<CHAR_TYPE>& operator*() const;
+        // Return a reference providing non-modifiable access to the current
+        // field.  The behavior is undefined unless 'isValid()'.
+
+    const StringRefImp<CHAR_TYPE> *operator->() const;
+        // Return the address of the current field.  The behavior is undefined
+        // unless 'isValid()'.
+
+    bool isValid() const;
+        // Return 'true' if this iterator refers to a field, and 'false' if it
+        // has been advanced beyond the last field.
+
+    StringRefImp<CHAR_TYPE> remainder() const;
+        // Return a string reference to the part of the string following the
+        // delimiter that terminates the current field, or an empty string
+        // reference if the current field is the last one.  The behavior is
+        // undefined unless 'isValid()'.
+};
+
 // ===========================================================================
 //                                  TYPEDEFS
 // ===========================================================================
@@ -691,6 +942,9 @@ std::basic_ostream<CHAR_TYPE>&
 typedef StringRefImp<char>       StringRef;
 typedef StringRefImp<wchar_t>    StringRefWide;
 
+typedef StringRefSplitIteratorImp<char>    StringRefSplitIterator;
+typedef StringRefSplitIteratorImp<wchar_t> StringRefSplitIteratorWide;
+
 // ===========================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ===========================================================================
@@ -699,6 +953,20 @@ typedef StringRefImp<wchar_t>    StringRefWide;
                           // class StringRefImp
                           // ------------------
 
+// PUBLIC CLASS DATA
+template <typename CHAR_TYPE>
+const typename StringRefImp<CHAR_TYPE>::size_type
+                                                StringRefImp<CHAR_TYPE>::npos;
+
+// PRIVATE CLASS METHODS
+template <typename CHAR_TYPE>
+inline
+bool StringRefImp<CHAR_TYPE>::isSpace(CHAR_TYPE character)
+{
+    return CHAR_TYPE(' ') == character
+        || (CHAR_TYPE('\t') <= character && character <= CHAR_TYPE('\r'));
+}
+
 // PRIVATE ACCESSORS
 template <typename CHAR_TYPE>
 inline
@@ -742,7 +1010,7 @@ StringRefImp<CHAR_TYPE>::StringRefImp(const_iterator begin,
 template <typename CHAR_TYPE>
 inline
 StringRefImp<CHAR_TYPE>::StringRefImp(const CHAR_TYPE *data)
-: Base(data, data + native_std::char_traits<CHAR_TYPE>::length(data))
+: Base(data, data + Traits::length(data))
 {
 }
 
@@ -753,6 +1021,17 @@ StringRefImp<CHAR_TYPE>::StringRefImp(const bsl::basic_string<CHAR_TYPE>& str)
 {
 }
 
+template <typename CHAR_TYPE>
+template <class ALLOCATOR>
+inline
+StringRefImp<CHAR_TYPE>::StringRefImp(
+                    const bsl::basic_string<CHAR_TYPE,
+                                            native_std::char_traits<CHAR_TYPE>,
+                                            ALLOCATOR>& str)
+: Base(str.data(), str.data() + str.length())
+{
+}
+
 template <typename CHAR_TYPE>
 inline
 StringRefImp<CHAR_TYPE>::StringRefImp(
@@ -803,9 +1082,7 @@ void StringRefImp<CHAR_TYPE>::assign(const CHAR_TYPE *data)
 {
     BSLS_ASSERT_SAFE(data);
 
-    *this = StringRefImp(
-                data,
-                data + native_std::char_traits<CHAR_TYPE>::length(data));
+    *this = StringRefImp(data, data + Traits::length(data));
 }
 
 template <typename CHAR_TYPE>
@@ -829,6 +1106,39 @@ void StringRefImp<CHAR_TYPE>::reset()
     *this = StringRefImp(0, 0);
 }
 
+template <typename CHAR_TYPE>
+inline
+void StringRefImp<CHAR_TYPE>::remove_prefix(size_type numCharacters)
+{
+    BSLS_ASSERT_SAFE(numCharacters <= length());
+
+    *this = StringRefImp(begin() + numCharacters, end());
+}
+
+template <typename CHAR_TYPE>
+inline
+void StringRefImp<CHAR_TYPE>::remove_suffix(size_type numCharacters)
+{
+    BSLS_ASSERT_SAFE(numCharacters <= length());
+
+    *this = StringRefImp(begin(), end() - numCharacters);
+}
+
+template <typename CHAR_TYPE>
+void StringRefImp<CHAR_TYPE>::trim()
+{
+    const_iterator first = begin();
+    const_iterator last  = end();
+
+    while (first != last && isSpace(*first)) {
+        ++first;
+    }
+    while (first != last && isSpace(last[-1])) {
+        --last;
+    }
+    *this = StringRefImp(first, last);
+}
+
 // ACCESSORS
 template <typename CHAR_TYPE>
 inline
@@ -896,7 +1206,7 @@ inline
 int StringRefImp<CHAR_TYPE>::compare(
         const StringRefImp<CHAR_TYPE>& other) const
 {
-    int result = native_std::char_traits<CHAR_TYPE>::compare(
+    int result = Traits::compare(
                     this->data(),
                     other.data(),
                     native_std::min(this->length(), other.length()));
@@ -904,6 +1214,250 @@ int StringRefImp<CHAR_TYPE>::compare(
     return result != 0 ? result : this->length() - other.length();
 }
 
+template <typename CHAR_TYPE>
+inline
+bool StringRefImp<CHAR_TYPE>::starts_with(const StringRefImp& prefix) const
+{
+    return prefix.length() <= length()
+        && 0 == Traits::compare(data(), prefix.data(), prefix.length());
+}
+
+template <typename CHAR_TYPE>
+inline
+bool StringRefImp<CHAR_TYPE>::ends_with(const StringRefImp& suffix) const
+{
+    return suffix.length() <= length()
+        && 0 == Traits::compare(end() - suffix.length(),
+                                suffix.data(),
+                                suffix.length());
+}
+
+template <typename CHAR_TYPE>
+inline
+StringRefImp<CHAR_TYPE>
+StringRefImp<CHAR_TYPE>::substr(size_type position,
+                                size_type numCharacters) const
+{
+    BSLS_ASSERT_SAFE(position <= length());
+
+    const size_type remaining = length() - position;
+    if (numCharacters > remaining) {
+        numCharacters = remaining;
+    }
+    return StringRefImp(begin() + position,
+                        begin() + position + numCharacters);
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::find(const StringRefImp& subString,
+                              size_type           position) const
+{
+    if (position > length() || subString.length() > length() - position) {
+        return npos;                                                  // RETURN
+    }
+    if (subString.isEmpty()) {
+        return position;                                              // RETURN
+    }
+    const CHAR_TYPE *result = Search::find(data() + position,
+                                           length() - position,
+                                           subString.data(),
+                                           subString.length());
+    return result ? result - data() : npos;
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::find(CHAR_TYPE character, size_type position) const
+{
+    if (position >= length()) {
+        return npos;                                                  // RETURN
+    }
+    const CHAR_TYPE *result = Search::find(data() + position,
+                                           length() - position,
+                                           &character,
+                                           1);
+    return result ? result - data() : npos;
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::rfind(const StringRefImp& subString,
+                               size_type           position) const
+{
+    if (subString.length() > length()) {
+        return npos;                                                  // RETURN
+    }
+    if (position > length() - subString.length()) {
+        position = length() - subString.length();
+    }
+    if (subString.isEmpty()) {
+        return position;                                              // RETURN
+    }
+    const CHAR_TYPE *result = Search::rfind(data(),
+                                            position + subString.length(),
+                                            subString.data(),
+                                            subString.length());
+    return result ? result - data() : npos;
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::rfind(CHAR_TYPE character, size_type position) const
+{
+    return rfind(StringRefImp(&character, 1), position);
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::find_first_of(const StringRefImp& characters,
+                                       size_type           position) const
+{
+    if (position >= length()) {
+        return npos;                                                  // RETURN
+    }
+    const CHAR_TYPE *result = Search::findFirstOf(data() + position,
+                                                  length() - position,
+                                                  characters.data(),
+                                                  characters.length());
+    return result ? result - data() : npos;
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::find_last_of(const StringRefImp& characters,
+                                      size_type           position) const
+{
+    if (isEmpty()) {
+        return npos;                                                  // RETURN
+    }
+    const size_type last = position < length() ? position : length() - 1;
+    const CHAR_TYPE *result = Search::findLastOf(data(),
+                                                 last + 1,
+                                                 characters.data(),
+                                                 characters.length());
+    return result ? result - data() : npos;
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::find_first_not_of(const StringRefImp& characters,
+                                           size_type           position) const
+{
+    if (position >= length()) {
+        return npos;                                                  // RETURN
+    }
+    const CHAR_TYPE *result = Search::findFirstNotOf(data() + position,
+                                                     length() - position,
+                                                     characters.data(),
+                                                     characters.length());
+    return result ? result - data() : npos;
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::find_last_not_of(const StringRefImp& characters,
+                                          size_type           position) const
+{
+    if (isEmpty()) {
+        return npos;                                                  // RETURN
+    }
+    const size_type last = position < length() ? position : length() - 1;
+    const CHAR_TYPE *result = Search::findLastNotOf(data(),
+                                                    last + 1,
+                                                    characters.data(),
+                                                    characters.length());
+    return result ? result - data() : npos;
+}
+
+                    // ------------------------------------------
+                    // class StringRefSplitIteratorImp<CHAR_TYPE>
+                    // ------------------------------------------
+
+// CREATORS
+template <typename CHAR_TYPE>
+inline
+StringRefSplitIteratorImp<CHAR_TYPE>::StringRefSplitIteratorImp(
+                                     const StringRefImp<CHAR_TYPE>& string,
+                                     const StringRefImp<CHAR_TYPE>& delimiters)
+: d_field()
+, d_delimiters(delimiters)
+, d_next_p(string.begin())
+, d_end_p(string.end())
+, d_hasNext(true)
+, d_isValid(true)
+{
+    ++*this;
+}
+
+// MANIPULATORS
+template <typename CHAR_TYPE>
+StringRefSplitIteratorImp<CHAR_TYPE>&
+StringRefSplitIteratorImp<CHAR_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_isValid);
+
+    if (!d_hasNext) {
+        d_isValid = false;
+        return *this;                                                 // RETURN
+    }
+
+    const CHAR_TYPE *delimiter =
+        StringSearchUtil<native_std::char_traits<CHAR_TYPE> >::findFirstOf(
+                                                     d_next_p,
+                                                     d_end_p - d_next_p,
+                                                     d_delimiters.data(),
+                                                     d_delimiters.length());
+    if (delimiter) {
+        d_field.assign(d_next_p, delimiter);
+        d_next_p = delimiter + 1;
+    }
+    else {
+        d_field.assign(d_next_p, d_end_p);
+        d_next_p  = d_end_p;
+        d_hasNext = false;
+    }
+    return *this;
+}
+
+// ACCESSORS
+template <typename CHAR_TYPE>
+inline
+const StringRefImp<CHAR_TYPE>&
+StringRefSplitIteratorImp<CHAR_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_isValid);
+
+    return d_field;
+}
+
+template <typename CHAR_TYPE>
+inline
+const StringRefImp<CHAR_TYPE> *
+StringRefSplitIteratorImp<CHAR_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_isValid);
+
+    return &d_field;
+}
+
+template <typename CHAR_TYPE>
+inline
+bool StringRefSplitIteratorImp<CHAR_TYPE>::isValid() const
+{
+    return d_isValid;
+}
+
+template <typename CHAR_TYPE>
+inline
+StringRefImp<CHAR_TYPE>
+StringRefSplitIteratorImp<CHAR_TYPE>::remainder() const
+{
+    BSLS_ASSERT_SAFE(d_isValid);
+
+    return StringRefImp<CHAR_TYPE>(d_next_p, d_end_p);
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
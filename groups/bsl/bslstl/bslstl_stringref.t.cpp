@@ -32,6 +32,7 @@ using namespace bsl;  // automatically added by script
 // [ 2] bslstl::StringRef(const char *begin);
 // [ 2] bslstl::StringRef(const bsl::string& begin);
 // [ 2] bslstl::StringRef(const native_std::string& begin);
+// [ 2] bslstl::StringRef(const bsl::basic_string<C, CT, A>& begin);
 // [ 2] bslstl::StringRef(const bslstl::StringRef& original);
 // [ 2] ~bslstl::StringRef();
 //
@@ -105,9 +106,33 @@ using namespace bsl;  // automatically added by script
 // [ 7] operator+(const char *lhs, const StringRef& rhs);
 // [ 7] operator+(const StringRef& lhs, const char *rhs);
 // [ 8] bsl::hash<BloombergLP::bslstl::StringRef>
+//
+// SEARCHING AND SLICING
+// [ 9] size_type find(const StringRef& subString, size_type position) const;
+// [ 9] size_type find(char character, size_type position) const;
+// [ 9] size_type rfind(const StringRef& subString, size_type position) const;
+// [ 9] size_type rfind(char character, size_type position) const;
+// [ 9] size_type find_first_of(const StringRef&, size_type) const;
+// [ 9] size_type find_last_of(const StringRef&, size_type) const;
+// [ 9] size_type find_first_not_of(const StringRef&, size_type) const;
+// [ 9] size_type find_last_not_of(const StringRef&, size_type) const;
+// [10] StringRef substr(size_type position, size_type numCharacters) const;
+// [10] bool starts_with(const StringRef& prefix) const;
+// [10] bool ends_with(const StringRef& suffix) const;
+// [10] void remove_prefix(size_type numCharacters);
+// [10] void remove_suffix(size_type numCharacters);
+// [10] void trim();
+//
+// StringRefSplitIterator
+// [11] StringRefSplitIterator(const StringRef& s, const StringRef& delims);
+// [11] StringRefSplitIterator& operator++();
+// [11] const StringRef& operator*() const;
+// [11] const StringRef *operator->() const;
+// [11] bool isValid() const;
+// [11] StringRef remainder() const;
 //--------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE
+// [12] USAGE
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACROS
 //-----------------------------------------------------------------------------
@@ -235,6 +260,141 @@ char const * NON_EMPTY_STRING = TestData<char>::nonEmptyString;
 // algorithm.  This delegation is made possible by the STL-compatible iterators
 // provided by the 'begin' and 'end' accessors.
 
+///Example 2: Parsing Fields Without Allocating Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive messages consisting of 'tag=value' fields separated
+// by '|' characters, and that we need to extract the value of a tag without
+// creating any 'bsl::string' objects.
+//
+// First, we define a function, 'findValue', that splits the message into
+// fields, and splits each field at its '=' character:
+//..
+    bslstl::StringRef findValue(const bslstl::StringRef& message,
+                                const bslstl::StringRef& tag)
+        // Return a reference to the (trimmed) value of the first field of the
+        // specified 'message' having the specified 'tag', or an empty
+        // reference if there is no such field.
+    {
+        for (bslstl::StringRefSplitIterator it(message, "|");
+             it.isValid();
+             ++it) {
+            const bslstl::StringRef::size_type equals = it->find('=');
+
+            if (bslstl::StringRef::npos != equals
+             && tag == it->substr(0, equals)) {
+                bslstl::StringRef value = it->substr(equals + 1);
+                value.trim();
+                return value;                                         // RETURN
+            }
+        }
+        return bslstl::StringRef();
+    }
+//..
+
+template <typename CHAR>
+bsl::basic_string<CHAR> widen(const char *string)
+    // Return a string having the characters of the specified null-terminated
+    // 'string' converted to 'CHAR'.
+{
+    bsl::basic_string<CHAR> result;
+    for (; *string; ++string) {
+        result.push_back(CHAR(*string));
+    }
+    return result;
+}
+
+template <typename CHAR>
+void testSearch(bool verbose)
+    // Verify that each search method of 'bslstl::StringRefImp<CHAR>' returns
+    // the same result as the corresponding method of 'bsl::basic_string<CHAR>'
+    // for each of a set of strings, patterns, and positions, and print a
+    // summary of the test if the specified 'verbose' is 'true'.
+{
+    typedef bslstl::StringRefImp<CHAR>    Ref;
+    typedef bsl::basic_string<CHAR>       String;
+    typedef typename Ref::size_type       size_type;
+
+    if (verbose) std::cout << "\tCHARACTER SIZE: " << sizeof(CHAR)
+                           << std::endl;
+
+    ASSERT(static_cast<size_type>(String::npos) == Ref::npos);
+
+    static const char *STRINGS[] = {
+        "",
+        "a",
+        "ab",
+        "abcabcab",
+        "a,b;;c, d",
+        "  padded  ",
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab",
+        "the quick brown fox jumps over the lazy dog, twice: the quick brown "
+        "fox jumps over the lazy dog"
+    };
+    const int NUM_STRINGS = sizeof STRINGS / sizeof *STRINGS;
+
+    static const char *PATTERNS[] = {
+        "", "a", "b", "ab", "ca", "bca", "z", ",;", " ", "abc", "the",
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab", "lazy dog", "fox jumps over the"
+    };
+    const int NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS;
+
+    for (int i = 0; i < NUM_STRINGS; ++i) {
+        const String STR = widen<CHAR>(STRINGS[i]);
+        const Ref    X(STR);
+
+        for (int j = 0; j < NUM_PATTERNS; ++j) {
+            const String PAT = widen<CHAR>(PATTERNS[j]);
+            const Ref    Y(PAT);
+
+            for (size_type pos = 0; pos <= STR.length() + 2; ++pos) {
+                const size_type POS = pos == STR.length() + 2 ? Ref::npos
+                                                              : pos;
+
+                LOOP3_ASSERT(i, j, pos,
+                             STR.find(PAT, POS) == X.find(Y, POS));
+                LOOP3_ASSERT(i, j, pos,
+                             STR.rfind(PAT, POS) == X.rfind(Y, POS));
+                LOOP3_ASSERT(i, j, pos,
+                             STR.find_first_of(PAT, POS)
+                                                  == X.find_first_of(Y, POS));
+                LOOP3_ASSERT(i, j, pos,
+                             STR.find_last_of(PAT, POS)
+                                                   == X.find_last_of(Y, POS));
+                LOOP3_ASSERT(i, j, pos,
+                             STR.find_first_not_of(PAT, POS)
+                                              == X.find_first_not_of(Y, POS));
+                LOOP3_ASSERT(i, j, pos,
+                             STR.find_last_not_of(PAT, POS)
+                                               == X.find_last_not_of(Y, POS));
+
+                if (!PAT.empty()) {
+                    LOOP3_ASSERT(i, j, pos,
+                                 STR.find(PAT[0], POS) == X.find(PAT[0], POS));
+                    LOOP3_ASSERT(i, j, pos,
+                                 STR.rfind(PAT[0], POS)
+                                                     == X.rfind(PAT[0], POS));
+                }
+            }
+        }
+    }
+
+    // A default-constructed reference has a null 'data()'.
+
+    const Ref EMPTY;
+    const Ref ABC(TestData<CHAR>::stringValue1, 3);
+
+    ASSERT(0         == EMPTY.find(EMPTY));
+    ASSERT(0         == EMPTY.rfind(EMPTY));
+    ASSERT(Ref::npos == EMPTY.find(ABC));
+    ASSERT(Ref::npos == EMPTY.find_first_of(ABC));
+    ASSERT(Ref::npos == EMPTY.find_last_not_of(ABC));
+    ASSERT(0         == ABC.find(EMPTY));
+    ASSERT(3         == ABC.rfind(EMPTY));
+    ASSERT(Ref::npos == ABC.find_first_of(EMPTY));
+    ASSERT(0         == ABC.find_first_not_of(EMPTY));
+    ASSERT(2         == ABC.find_last_not_of(EMPTY));
+}
+
 template <typename CHAR>
 void testBasicAccessors(bool verbose)
 {
@@ -342,7 +502,7 @@ int main(int argc, char *argv[])
     std::cout << "TEST " << __FILE__ << " CASE " << test << std::endl;
 
     switch (test) { case 0:
-      case 9: {
+      case 12: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -454,6 +614,297 @@ int main(int argc, char *argv[])
     numBlanks = getNumBlanks(bslstl::StringRef(poemWithNulls, poemLength));
     ASSERT(42 == numBlanks);
 //..
+
+// Then, we define a message, in which the field with tag '55' has a value that
+// is padded with blanks, and the last field is empty:
+//..
+    const char message[] = "8=FIX.4.2|35=D|55= IBM |54=1||";
+//..
+// Now, we look for a few tags:
+//..
+    ASSERT("IBM"     == findValue(message, "55"));
+    ASSERT("FIX.4.2" == findValue(message, "8"));
+    ASSERT(findValue(message, "99").isEmpty());
+//..
+// Finally, we use the search methods directly to check the format of the
+// message, and to find its last field:
+//..
+    const bslstl::StringRef msg(message);
+
+    ASSERT(msg.starts_with("8=FIX"));
+    ASSERT(msg.ends_with("|"));
+    ASSERT(9  == msg.find_first_of("=|", 2));
+    ASSERT(29 == msg.rfind('|'));
+    ASSERT(msg.substr(msg.rfind('|') + 1).isEmpty());
+//..
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'StringRefSplitIterator'
+        //
+        // Concerns:
+        //: 1 The iterator provides, in order, each of the fields of the
+        //:   string separated by any of the delimiter characters, including
+        //:   empty fields at the beginning, the end, and between adjacent
+        //:   delimiters, and becomes invalid after the last field.
+        //:
+        //: 2 An empty string has a single empty field, and a string without
+        //:   delimiters (or an empty set of delimiters) is a single field.
+        //:
+        //: 3 Each field refers to the original string (no copy is made).
+        //:
+        //: 4 'remainder' returns the part of the string after the current
+        //:   field's delimiter.
+        //:
+        //: 5 The iterator works for 'wchar_t' strings.
+        //
+        // Plan:
+        //: 1 For a table of strings and delimiter sets, concatenate the
+        //:   fields, each enclosed in brackets, and compare with the expected
+        //:   result.  Verify that each field lies within the original string
+        //:   and that 'remainder' begins after the field.  (C-1..4)
+        //:
+        //: 2 Split a wide string.  (C-5)
+        //
+        // Testing:
+        //   StringRefSplitIterator(const StringRef& s, const StringRef& d);
+        //   StringRefSplitIterator& operator++();
+        //   const StringRef& operator*() const;
+        //   const StringRef *operator->() const;
+        //   bool isValid() const;
+        //   StringRef remainder() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) std::cout << "\nTESTING 'StringRefSplitIterator'"
+                               << "\n================================"
+                               << std::endl;
+
+        static const struct {
+            int         d_line;        // source line number
+            const char *d_string_p;    // string to split
+            const char *d_delims_p;    // delimiters
+            const char *d_expected_p;  // bracketed fields
+        } DATA[] = {
+            //LINE  STRING            DELIMS    EXPECTED
+            //----  ----------------  --------  --------------
+            { L_,   "",               ",",      "[]"           },
+            { L_,   "abc",            ",",      "[abc]"        },
+            { L_,   "abc",            "",       "[abc]"        },
+            { L_,   ",",              ",",      "[][]"         },
+            { L_,   "a,b",            ",",      "[a][b]"       },
+            { L_,   "a,,b",           ",",      "[a][][b]"     },
+            { L_,   ",a,",            ",",      "[][a][]"      },
+            { L_,   "a,b;c d",        ",; ",    "[a][b][c][d]" },
+            { L_,   "8=A\x01" "9=B",  "=\x01",  "[8][A][9][B]" },
+            { L_,   "x|y|",           "|",      "[x][y][]"     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const Obj         STRING(DATA[ti].d_string_p);
+            const Obj         DELIMS(DATA[ti].d_delims_p);
+            const char *const EXPECTED = DATA[ti].d_expected_p;
+
+            bsl::string result;
+            for (bslstl::StringRefSplitIterator it(STRING, DELIMS);
+                 it.isValid();
+                 ++it) {
+                const Obj& FIELD = *it;
+
+                LOOP_ASSERT(LINE, &FIELD == it.operator->());
+                LOOP_ASSERT(LINE, STRING.begin() <= FIELD.begin());
+                LOOP_ASSERT(LINE, FIELD.end()    <= STRING.end());
+
+                const Obj REMAINDER = it.remainder();
+                if (FIELD.end() == STRING.end()) {
+                    LOOP_ASSERT(LINE, REMAINDER.isEmpty());
+                }
+                else {
+                    LOOP_ASSERT(LINE, REMAINDER.begin() == FIELD.end() + 1);
+                    LOOP_ASSERT(LINE, REMAINDER.end()   == STRING.end());
+                }
+
+                result += '[';
+                result += FIELD;
+                result += ']';
+            }
+            if (veryVerbose) { T_() P_(LINE) P(result) }
+            LOOP2_ASSERT(LINE, result, EXPECTED == result);
+        }
+
+        if (verbose) std::cout << "\tWide strings." << std::endl;
+        {
+            bslstl::StringRefSplitIteratorWide it(L"ab;;c", L";");
+            ASSERT(it.isValid());  ASSERT(L"ab" == *it);  ++it;
+            ASSERT(it.isValid());  ASSERT(it->isEmpty()); ++it;
+            ASSERT(it.isValid());  ASSERT(L"c"  == *it);  ++it;
+            ASSERT(!it.isValid());
+        }
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING SLICING AND TRIMMING
+        //
+        // Concerns:
+        //: 1 'substr' refers to the specified part of the original string,
+        //:   truncated at its end, and defaults to the whole string.
+        //:
+        //: 2 'starts_with' and 'ends_with' accept empty arguments, and reject
+        //:   arguments longer than the string.
+        //:
+        //: 3 'remove_prefix' and 'remove_suffix' rebind the reference to part
+        //:   of the same string.
+        //:
+        //: 4 'trim' removes all leading and trailing whitespace characters,
+        //:   and only those, and leaves an empty reference for a string of
+        //:   whitespace.
+        //
+        // Plan:
+        //: 1 Exercise each method on a few strings, verifying both the value
+        //:   and the address of the result.  (C-1..4)
+        //
+        // Testing:
+        //   StringRef substr(size_type position, size_type numChars) const;
+        //   bool starts_with(const StringRef& prefix) const;
+        //   bool ends_with(const StringRef& suffix) const;
+        //   void remove_prefix(size_type numCharacters);
+        //   void remove_suffix(size_type numCharacters);
+        //   void trim();
+        // --------------------------------------------------------------------
+
+        if (verbose) std::cout << "\nTESTING SLICING AND TRIMMING"
+                               << "\n============================"
+                               << std::endl;
+
+        const char *const S = "Tangled Up in Blue";
+        const Obj         X(S);
+
+        if (verbose) std::cout << "\tTesting 'substr'." << std::endl;
+        {
+            ASSERT(X == X.substr());
+            ASSERT(S == X.substr().data());
+            ASSERT("Up" == X.substr(8, 2));
+            ASSERT(S + 8 == X.substr(8, 2).data());
+            ASSERT("Blue" == X.substr(14));
+            ASSERT("Blue" == X.substr(14, 100));
+            ASSERT(X.substr(18).isEmpty());
+            ASSERT(X.substr(3, 0).isEmpty());
+            ASSERT(Obj().substr().isEmpty());
+        }
+
+        if (verbose) std::cout << "\tTesting 'starts_with' and 'ends_with'."
+                               << std::endl;
+        {
+            ASSERT( X.starts_with(""));
+            ASSERT( X.starts_with("T"));
+            ASSERT( X.starts_with("Tangled"));
+            ASSERT( X.starts_with(X));
+            ASSERT(!X.starts_with("tangled"));
+            ASSERT(!X.starts_with("Tangled Up in Blue!"));
+            ASSERT( X.ends_with(""));
+            ASSERT( X.ends_with("Blue"));
+            ASSERT( X.ends_with(X));
+            ASSERT(!X.ends_with("blue"));
+            ASSERT(!X.ends_with("!Tangled Up in Blue"));
+            ASSERT( Obj().starts_with(""));
+            ASSERT(!Obj().ends_with("a"));
+        }
+
+        if (verbose) std::cout << "\tTesting 'remove_prefix' and "
+                                  "'remove_suffix'." << std::endl;
+        {
+            Obj x(X);
+            x.remove_prefix(8);
+            ASSERT("Up in Blue" == x);
+            ASSERT(S + 8 == x.data());
+            x.remove_suffix(5);
+            ASSERT("Up in" == x);
+            ASSERT(S + 8 == x.data());
+            x.remove_prefix(5);
+            ASSERT(x.isEmpty());
+        }
+
+        if (verbose) std::cout << "\tTesting 'trim'." << std::endl;
+        {
+            static const struct {
+                int         d_line;        // source line number
+                const char *d_string_p;    // string to trim
+                int         d_begin;       // offset of the result
+                int         d_length;      // length of the result
+            } DATA[] = {
+                //LINE  STRING           BEGIN  LENGTH
+                //----  ---------------  -----  ------
+                { L_,   "",                  0,      0 },
+                { L_,   " ",                 1,      0 },
+                { L_,   " \t\n\v\f\r",       6,      0 },
+                { L_,   "a",                 0,      1 },
+                { L_,   " a",                1,      1 },
+                { L_,   "a ",                0,      1 },
+                { L_,   "\t a b \r\n",       2,      3 },
+                { L_,   "\x01" "a\x0e",      0,      3 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const STRING = DATA[ti].d_string_p;
+
+                Obj x(STRING);
+                x.trim();
+
+                LOOP_ASSERT(LINE, DATA[ti].d_length == (int) x.length());
+                if (!x.isEmpty()) {
+                    LOOP_ASSERT(LINE, STRING + DATA[ti].d_begin == x.data());
+                }
+            }
+
+            bslstl::StringRefWide w(L" wide\t");
+            w.trim();
+            ASSERT(L"wide" == w);
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCH METHODS
+        //
+        // Concerns:
+        //: 1 Each search method returns the same position as the method of
+        //:   the same name of 'bsl::basic_string', for every position,
+        //:   including positions beyond the end of the string and 'npos'.
+        //:
+        //: 2 Empty strings and patterns, including a default-constructed
+        //:   reference (whose 'data' is null), are handled correctly.
+        //:
+        //: 3 The methods work for both 'char' and 'wchar_t'.
+        //
+        // Plan:
+        //: 1 For a table of strings and patterns, including patterns long
+        //:   enough to use each of the substring search algorithms, compare
+        //:   the result of each method with that of 'bsl::basic_string' for
+        //:   every position up to two past the end of the string, and 'npos'.
+        //:   (C-1, 3)
+        //:
+        //: 2 Search for empty and non-empty patterns in empty references.
+        //:   (C-2)
+        //
+        // Testing:
+        //   size_type find(const StringRef& subString, size_type pos) const;
+        //   size_type find(char character, size_type position) const;
+        //   size_type rfind(const StringRef& subString, size_type pos) const;
+        //   size_type rfind(char character, size_type position) const;
+        //   size_type find_first_of(const StringRef&, size_type) const;
+        //   size_type find_last_of(const StringRef&, size_type) const;
+        //   size_type find_first_not_of(const StringRef&, size_type) const;
+        //   size_type find_last_not_of(const StringRef&, size_type) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) std::cout << "\nTESTING SEARCH METHODS"
+                               << "\n======================"
+                               << std::endl;
+
+        testSearch<char>(verbose);
+        testSearch<wchar_t>(verbose);
       } break;
       case 8: {
         // --------------------------------------------------------------------
@@ -2504,6 +2955,7 @@ int main(int argc, char *argv[])
         //   bslstl::StringRef(const char *begin);
         //   bslstl::StringRef(const bsl::string& begin);
         //   bslstl::StringRef(const native_std::string& begin);
+        //   bslstl::StringRef(const bsl::basic_string<C, CT, A>& begin);
         //   bslstl::StringRef(const bslstl::StringRef& original);
         //   ~bslstl::StringRef();
         //   bslstl::StringRef& operator=(const bslstl::StringRef&);
@@ -2668,6 +3120,33 @@ int main(int argc, char *argv[])
                                              nonEmptyString.begin())));
         }
 
+        if (veryVerbose)
+            std::cout
+                << "\nbslstl_StringRef(const bsl::basic_string<C, CT, A>&)"
+                << "\n  =  =  =  =  =  =  =  =  =  =  =  =  =  =  =  =  ="
+                << std::endl;
+
+        {
+          typedef BloombergLP::bslstl::ShortBufferString<40>::Type String;
+
+          // Empty string
+          const String emptyString(EMPTY_STRING);
+          Obj x1(emptyString);  const Obj& X1 = x1;
+          ASSERT(X1.isEmpty());
+          ASSERT(X1.length()    == 0);
+          ASSERT(X1.begin()     == X1.end());
+          ASSERT(emptyString.data() + emptyString.length() == X1.end());
+
+          // Non-empty string
+          String nonEmptyString(NON_EMPTY_STRING);
+          Obj x2(nonEmptyString);  const Obj& X2 = x2;
+          ASSERT(!X2.isEmpty());
+          ASSERT(X2.length()  == 30);
+          ASSERT(&*X2.begin() == nonEmptyString.data());
+          ASSERT(X2.end()     == nonEmptyString.data() + 30);
+          ASSERT(nonEmptyString.capacity() >= 30);
+        }
+
         if (verbose) std::cout << "\nTesting copy constructor"
                                << "\n= = = = = = = = = = = = " << std::endl;
         if (veryVerbose)
@@ -0,0 +1,624 @@
+// bslstl_stringsearchutil.cpp                                        -*-C++-*-
+#include <bslstl_stringsearchutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <string.h>  // 'memchr', 'memcmp'
+
+#if (defined(BSLS_PLATFORM_CPU_X86_64)                                       \
+  || defined(__SSE2__)                                                        \
+  || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))                                \
+ && (defined(BSLS_PLATFORM_CMP_GNU)                                           \
+  || defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || defined(BSLS_PLATFORM_CMP_MSVC))
+    #define BSLSTL_STRINGSEARCHUTIL_USE_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    #include <intrin.h>
+#endif
+
+// IMPLEMENTATION NOTES: The specialization for 'native_std::char_traits<char>'
+// relies on the fact that 'native_std::char_traits<char>::eq' compares
+// characters by value, and that 'compare' is equivalent to 'memcmp' for the
+// purpose of detecting equality, so that characters may be handled as
+// 'unsigned char' values (e.g., as indices of tables) and compared in bulk.
+//
+// The Two-Way implementation follows the presentation in "Two-way string
+// matching" by Crochemore and Perrin (Journal of the ACM, 38(3):651-675,
+// 1991), with the "bad character" shift table of Horspool applied to the
+// last character of each window, as in the GNU C library's 'memmem'.
+
+namespace BloombergLP {
+
+namespace {
+
+typedef native_std::size_t SizeType;
+
+const SizeType k_LONG_PATTERN = 32;  // least length of a pattern searched for
+                                     // using the Two-Way algorithm
+
+const SizeType k_NPOS = ~static_cast<SizeType>(0);
+
+                            // ==================
+                            // class CharacterSet
+                            // ==================
+
+class CharacterSet {
+    // This class implements a set of 'char' values as a 256-bit table.
+
+    // DATA
+    unsigned int d_bits[256 / 32];  // bit 'c % 32' of word 'c / 32' is set
+                                    // if 'c' is a member
+
+  public:
+    // CREATORS
+    CharacterSet(const char *characters, SizeType numCharacters)
+        // Create a set of the specified 'numCharacters' in the specified
+        // 'characters' array.
+    {
+        for (int i = 0; i < 256 / 32; ++i) {
+            d_bits[i] = 0;
+        }
+        for (const char *end = characters + numCharacters;
+             characters != end;
+             ++characters) {
+            const unsigned char c = static_cast<unsigned char>(*characters);
+            d_bits[c >> 5] |= 1u << (c & 31);
+        }
+    }
+
+    // ACCESSORS
+    bool contains(char character) const
+        // Return 'true' if the specified 'character' is a member of this set,
+        // and 'false' otherwise.
+    {
+        const unsigned char c = static_cast<unsigned char>(character);
+        return (d_bits[c >> 5] >> (c & 31)) & 1;
+    }
+};
+
+                         // ------------------------
+                         // local functions: bit ops
+                         // ------------------------
+
+#if defined(BSLSTL_STRINGSEARCHUTIL_USE_SSE2)
+
+inline
+int lowestBit(unsigned int mask)
+    // Return the index of the least-significant set bit of the specified
+    // 'mask'.  The behavior is undefined unless '0 != mask'.
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+inline
+int highestBit(unsigned int mask)
+    // Return the index of the most-significant set bit of the specified
+    // 'mask'.  The behavior is undefined unless '0 != mask'.
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return static_cast<int>(index);
+#else
+    return 31 - __builtin_clz(mask);
+#endif
+}
+
+inline
+unsigned int candidateMask(const char    *window,
+                           SizeType       last,
+                           const __m128i& first,
+                           const __m128i& lastCharacter)
+    // Return a 16-bit mask having bit 'i' set if 'window[i]' is equal to
+    // (every byte of) the specified 'first', and 'window[i + last]' is equal
+    // to the specified 'lastCharacter', for the specified 'window' and
+    // 'last', and all other bits clear.
+{
+    typedef const __m128i *BlockPtr;
+
+    const __m128i firstBlock = _mm_loadu_si128(
+                                           reinterpret_cast<BlockPtr>(window));
+    const __m128i lastBlock  = _mm_loadu_si128(
+                                    reinterpret_cast<BlockPtr>(window + last));
+
+    return static_cast<unsigned int>(_mm_movemask_epi8(
+                          _mm_and_si128(_mm_cmpeq_epi8(firstBlock, first),
+                                        _mm_cmpeq_epi8(lastBlock,
+                                                       lastCharacter))));
+}
+
+#endif
+
+                     // ---------------------------------
+                     // local functions: substring search
+                     // ---------------------------------
+
+inline
+bool matchesInterior(const char *candidate,
+                     const char *pattern,
+                     SizeType    last)
+    // Return 'true' if the characters strictly between the first and the
+    // specified 'last' positions of the specified 'candidate' and 'pattern'
+    // are equal, and 'false' otherwise.
+{
+    return last <= 1 || 0 == memcmp(candidate + 1, pattern + 1, last - 1);
+}
+
+const char *findShortPattern(const char *string,
+                             SizeType    length,
+                             const char *pattern,
+                             SizeType    patternLength)
+    // Return the address of the first occurrence of the specified 'pattern'
+    // of the specified 'patternLength' in the specified 'string' of the
+    // specified 'length', or 0 if there is none, by filtering candidate
+    // positions on the first and last characters of 'pattern'.  The behavior
+    // is undefined unless '2 <= patternLength <= length'.
+{
+    const SizeType last          = patternLength - 1;
+    const SizeType numCandidates = length - last;
+    SizeType       position      = 0;
+
+#if defined(BSLSTL_STRINGSEARCHUTIL_USE_SSE2)
+    const __m128i first         = _mm_set1_epi8(pattern[0]);
+    const __m128i lastCharacter = _mm_set1_epi8(pattern[last]);
+
+    // The block loads read 'string[position + last + 15]' at most, which is
+    // within 'string' as long as 'position + 16 <= numCandidates'.
+
+    for (; position + 16 <= numCandidates; position += 16) {
+        const char   *window = string + position;
+        unsigned int  mask   = candidateMask(window,
+                                             last,
+                                             first,
+                                             lastCharacter);
+        while (mask) {
+            const char *candidate = window + lowestBit(mask);
+            if (matchesInterior(candidate, pattern, last)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    const char *const end = string + numCandidates;
+
+    for (const char *current = string + position; current != end; ++current) {
+        current = static_cast<const char *>(
+                                 memchr(current, pattern[0], end - current));
+        if (!current) {
+            return 0;                                                 // RETURN
+        }
+        if (current[last] == pattern[last]
+         && matchesInterior(current, pattern, last)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+SizeType criticalFactorization(const unsigned char *pattern,
+                               SizeType             patternLength,
+                               SizeType            *period)
+    // Return the position of a critical factorization of the specified
+    // 'pattern' of the specified 'patternLength', and load into the specified
+    // 'period' the period of the right half of the factorization.  The
+    // behavior is undefined unless '2 <= patternLength'.
+{
+    // Compute the maximal suffixes of 'pattern' for the lexicographic order
+    // and its reverse; the later-starting of the two gives a critical
+    // factorization.  Note that 'maxSuffix' starts at "-1".
+
+    SizeType maxSuffix = k_NPOS;
+    SizeType j         = 0;
+    SizeType k         = 1;
+    SizeType p         = 1;
+
+    while (j + k < patternLength) {
+        const unsigned char a = pattern[j + k];
+        const unsigned char b = pattern[maxSuffix + k];
+        if (a < b) {
+            j += k;
+            k  = 1;
+            p  = j - maxSuffix;
+        }
+        else if (a == b) {
+            if (k != p) {
+                ++k;
+            }
+            else {
+                j += p;
+                k  = 1;
+            }
+        }
+        else {
+            maxSuffix = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+
+    SizeType maxSuffixReverse = k_NPOS;
+    j = 0;
+    k = p = 1;
+
+    while (j + k < patternLength) {
+        const unsigned char a = pattern[j + k];
+        const unsigned char b = pattern[maxSuffixReverse + k];
+        if (b < a) {
+            j += k;
+            k  = 1;
+            p  = j - maxSuffixReverse;
+        }
+        else if (a == b) {
+            if (k != p) {
+                ++k;
+            }
+            else {
+                j += p;
+                k  = 1;
+            }
+        }
+        else {
+            maxSuffixReverse = j++;
+            k = p = 1;
+        }
+    }
+
+    if (maxSuffixReverse + 1 < maxSuffix + 1) {
+        return maxSuffix + 1;                                         // RETURN
+    }
+    *period = p;
+    return maxSuffixReverse + 1;
+}
+
+const char *findLongPattern(const char *string,
+                            SizeType    length,
+                            const char *pattern,
+                            SizeType    patternLength)
+    // Return the address of the first occurrence of the specified 'pattern'
+    // of the specified 'patternLength' in the specified 'string' of the
+    // specified 'length', or 0 if there is none, using the Two-Way algorithm
+    // with a "bad character" shift table.  The behavior is undefined unless
+    // '2 <= patternLength <= length'.
+{
+    const unsigned char *s = reinterpret_cast<const unsigned char *>(string);
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(pattern);
+
+    const SizeType last = patternLength - 1;
+
+    SizeType period;
+    const SizeType suffix = criticalFactorization(p, patternLength, &period);
+
+    // 'shift[c]' is the distance from the last occurrence of 'c' in the
+    // pattern (not counting the final position) to the end of the pattern.
+
+    SizeType shift[256];
+    for (int i = 0; i < 256; ++i) {
+        shift[i] = patternLength;
+    }
+    for (SizeType i = 0; i < last; ++i) {
+        shift[p[i]] = last - i;
+    }
+    shift[p[last]] = 0;
+    for (SizeType i = 0; i < last; ++i) {
+        if (p[i] == p[last]) {
+            shift[p[i]] = 0;
+        }
+    }
+
+    SizeType j = 0;  // start of the current window
+
+    if (0 == memcmp(p, p + period, suffix)) {
+        // The pattern is periodic: after a match of the right half, the left
+        // half need only be verified up to the part already known to match
+        // ('memory').
+
+        SizeType memory = 0;
+
+        while (j + patternLength <= length) {
+            SizeType skip = shift[s[j + last]];
+            if (0 < skip) {
+                if (memory && skip < period) {
+                    skip = patternLength - period;
+                }
+                memory = 0;
+                j += skip;
+                continue;
+            }
+
+            SizeType i = suffix > memory ? suffix : memory;
+            while (i < last && p[i] == s[i + j]) {
+                ++i;
+            }
+            if (last <= i) {
+                i = suffix - 1;
+                while (memory < i + 1 && p[i] == s[i + j]) {
+                    --i;
+                }
+                if (i + 1 < memory + 1) {
+                    return string + j;                                // RETURN
+                }
+                j      += period;
+                memory  = patternLength - period;
+            }
+            else {
+                j      += i - suffix + 1;
+                memory  = 0;
+            }
+        }
+    }
+    else {
+        // The halves of the pattern do not overlap in any shift smaller than
+        // the larger half, which is therefore a safe shift after a mismatch
+        // in the left half.
+
+        period = (suffix > patternLength - suffix
+                  ? suffix
+                  : patternLength - suffix) + 1;
+
+        while (j + patternLength <= length) {
+            const SizeType skip = shift[s[j + last]];
+            if (0 < skip) {
+                j += skip;
+                continue;
+            }
+
+            SizeType i = suffix;
+            while (i < last && p[i] == s[i + j]) {
+                ++i;
+            }
+            if (last <= i) {
+                i = suffix - 1;
+                while (k_NPOS != i && p[i] == s[i + j]) {
+                    --i;
+                }
+                if (k_NPOS == i) {
+                    return string + j;                                // RETURN
+                }
+                j += period;
+            }
+            else {
+                j += i - suffix + 1;
+            }
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+namespace bslstl {
+
+            // ------------------------------------------------------
+            // struct StringSearchUtil<native_std::char_traits<char> >
+            // ------------------------------------------------------
+
+// CLASS METHODS
+const char *
+StringSearchUtil<native_std::char_traits<char> >::find(
+                                                const char *string,
+                                                SizeType    length,
+                                                const char *pattern,
+                                                SizeType    patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (0 == patternLength) {
+        return string;                                                // RETURN
+    }
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+    if (1 == patternLength) {
+        return static_cast<const char *>(memchr(string, *pattern, length));
+                                                                      // RETURN
+    }
+    if (patternLength < k_LONG_PATTERN) {
+        return findShortPattern(string, length, pattern, patternLength);
+                                                                      // RETURN
+    }
+    return findLongPattern(string, length, pattern, patternLength);
+}
+
+const char *
+StringSearchUtil<native_std::char_traits<char> >::rfind(
+                                                const char *string,
+                                                SizeType    length,
+                                                const char *pattern,
+                                                SizeType    patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (0 == patternLength) {
+        return string + length;                                       // RETURN
+    }
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+
+    const SizeType last     = patternLength - 1;
+    SizeType       position = length - last;  // one past the last candidate
+
+#if defined(BSLSTL_STRINGSEARCHUTIL_USE_SSE2)
+    const __m128i first         = _mm_set1_epi8(pattern[0]);
+    const __m128i lastCharacter = _mm_set1_epi8(pattern[last]);
+
+    for (; 16 <= position; position -= 16) {
+        const char   *window = string + position - 16;
+        unsigned int  mask   = candidateMask(window,
+                                             last,
+                                             first,
+                                             lastCharacter);
+        while (mask) {
+            const int   bit       = highestBit(mask);
+            const char *candidate = window + bit;
+            if (matchesInterior(candidate, pattern, last)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+#endif
+
+    while (0 < position) {
+        const char *candidate = string + --position;
+        if (candidate[0]    == pattern[0]
+         && candidate[last] == pattern[last]
+         && matchesInterior(candidate, pattern, last)) {
+            return candidate;                                         // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *
+StringSearchUtil<native_std::char_traits<char> >::findFirstOf(
+                                                const char *string,
+                                                SizeType    length,
+                                                const char *characterSet,
+                                                SizeType    setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == setLength || 0 == length) {
+        return 0;                                                     // RETURN
+    }
+    if (1 == setLength) {
+        return static_cast<const char *>(memchr(string,
+                                                *characterSet,
+                                                length));             // RETURN
+    }
+
+    const CharacterSet set(characterSet, setLength);
+
+    for (const char *end = string + length; string != end; ++string) {
+        if (set.contains(*string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *
+StringSearchUtil<native_std::char_traits<char> >::findFirstNotOf(
+                                                const char *string,
+                                                SizeType    length,
+                                                const char *characterSet,
+                                                SizeType    setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+    if (1 >= setLength) {
+        // No table is needed to skip at most one distinct character.
+
+        if (0 == setLength || *string != *characterSet) {
+            return string;                                            // RETURN
+        }
+        for (const char *end = string + length; string != end; ++string) {
+            if (*string != *characterSet) {
+                return string;                                        // RETURN
+            }
+        }
+        return 0;                                                     // RETURN
+    }
+
+    const CharacterSet set(characterSet, setLength);
+
+    for (const char *end = string + length; string != end; ++string) {
+        if (!set.contains(*string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *
+StringSearchUtil<native_std::char_traits<char> >::findLastOf(
+                                                const char *string,
+                                                SizeType    length,
+                                                const char *characterSet,
+                                                SizeType    setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == setLength) {
+        return 0;                                                     // RETURN
+    }
+
+    const CharacterSet set(characterSet, setLength);
+
+    for (const char *current = string + length; current != string; ) {
+        --current;
+        if (set.contains(*current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *
+StringSearchUtil<native_std::char_traits<char> >::findLastNotOf(
+                                                const char *string,
+                                                SizeType    length,
+                                                const char *characterSet,
+                                                SizeType    setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    const CharacterSet set(characterSet, setLength);
+
+    for (const char *current = string + length; current != string; ) {
+        --current;
+        if (!set.contains(*current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
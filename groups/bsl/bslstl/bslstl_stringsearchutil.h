@@ -0,0 +1,485 @@
+// bslstl_stringsearchutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLSTL_STRINGSEARCHUTIL
+#define INCLUDED_BSLSTL_STRINGSEARCHUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide substring and character-set search algorithms for strings.
+//
+//@CLASSES:
+//  bslstl::StringSearchUtil: namespace for string search algorithms
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref
+//
+//@DESCRIPTION: This component provides a 'struct' template,
+// 'bslstl::StringSearchUtil', parameterized by a character traits type, that
+// serves as a namespace for the search algorithms underlying the 'find',
+// 'rfind', 'find_first_of', 'find_last_of', 'find_first_not_of', and
+// 'find_last_not_of' methods of 'bsl::basic_string'.  The algorithms operate
+// on arrays of characters specified by address and length (which need not be
+// null-terminated), compare characters using the 'eq' and 'compare' methods
+// of the traits type, and return the address of the character found, or 0 if
+// there is none.
+//
+// The primary template implements the algorithms for any traits type in
+// terms of the 'find' and 'compare' functions of 'bslstl::CharTraitsUtil'
+// (which vectorizes them for wide characters).  The (full) specialization for
+// 'native_std::char_traits<char>', which is the traits type of 'bsl::string'
+// and 'bslstl::StringRef', implements them using faster algorithms that rely
+// on characters being compared as (unsigned) bytes:
+//
+//: o Substring search ('find') for patterns shorter than 32 characters
+//:   filters candidate positions by comparing both the first and the last
+//:   character of the pattern against 16 positions at a time using SSE2
+//:   instructions (where available), and compares the rest of the pattern
+//:   only at positions passing the filter.  Longer patterns are searched for
+//:   using the Two-Way algorithm of Crochemore and Perrin, augmented with a
+//:   Boyer-Moore-Horspool "bad character" shift table, which examines fewer
+//:   characters than the length of the string in typical cases and is linear
+//:   in the worst case.
+//:
+//: o Character-set searches ('findFirstOf', etc.) for sets of more than one
+//:   character build a 256-bit table of the members of the set, so that each
+//:   character of the string is tested with a single lookup, rather than with
+//:   a search of the set.
+//
+// Note that the results of the functions do not depend on the algorithm used,
+// so the specialization is transparent to clients, such as 'bsl::string',
+// that use 'StringSearchUtil<CHAR_TRAITS>' for any traits type.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Buffer that is not a String
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to locate the end of the header of an HTTP message
+// that has been read into a buffer, which is not null-terminated.  First, we
+// define the buffer:
+//..
+//  const char   buffer[] = "GET / HTTP/1.1\r\nHost: example.com\r\n\r\nbody";
+//  const size_t length   = sizeof buffer - 1;
+//..
+// Then, we search for the blank line terminating the header, using the
+// algorithms for 'char' strings:
+//..
+//  typedef bslstl::StringSearchUtil<std::char_traits<char> > Search;
+//
+//  const char *end = Search::find(buffer, length, "\r\n\r\n", 4);
+//  assert(buffer + 33 == end);
+//..
+// Next, we look for the first character that is either a space or a line
+// terminator, to find the end of the method of the request line:
+//..
+//  const char *delimiter = Search::findFirstOf(buffer, length, " \r\n", 3);
+//  assert(buffer + 3 == delimiter);
+//..
+// Finally, we note that the search functions return 0 if they find nothing:
+//..
+//  assert(0 == Search::find(buffer, length, "Content-Length", 14));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_string.h> instead of <bslstl_stringsearchutil.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_CHARTRAITSUTIL
+#include <bslstl_chartraitsutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_STRING
+#include <string>  // for 'native_std::char_traits'
+#define INCLUDED_STRING
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                          // =======================
+                          // struct StringSearchUtil
+                          // =======================
+
+template <class CHAR_TRAITS>
+struct StringSearchUtil {
+    // This 'struct' template provides a namespace for algorithms searching
+    // arrays of the characters of the parameterized 'CHAR_TRAITS' type.  Each
+    // function takes the address and length of the array to search (the
+    // "string"), which need not be null-terminated, and returns the address of
+    // the character found, or 0 if there is none.  The behavior of each
+    // function is undefined unless each array argument is either valid for
+    // the specified length, or null with a length of 0.
+
+    // PUBLIC TYPES
+    typedef typename CHAR_TRAITS::char_type CharType;
+    typedef native_std::size_t              SizeType;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static const CharType *findCharacter(const CharType  *string,
+                                         SizeType         length,
+                                         const CharType&  character);
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' that is equal to the specified
+        // 'character', or 0 if there is none.
+
+  public:
+    // CLASS METHODS
+    static const CharType *find(const CharType *string,
+                                SizeType        length,
+                                const CharType *pattern,
+                                SizeType        patternLength);
+        // Return the address of the first character of the first occurrence
+        // of the specified 'pattern' of the specified 'patternLength' in the
+        // specified 'string' of the specified 'length', or 0 if 'pattern'
+        // does not occur in 'string'.  Return 'string' if 'patternLength' is
+        // 0.
+
+    static const CharType *rfind(const CharType *string,
+                                 SizeType        length,
+                                 const CharType *pattern,
+                                 SizeType        patternLength);
+        // Return the address of the first character of the last occurrence
+        // of the specified 'pattern' of the specified 'patternLength' in the
+        // specified 'string' of the specified 'length', or 0 if 'pattern'
+        // does not occur in 'string'.  Return 'string + length' if
+        // 'patternLength' is 0.
+
+    static const CharType *findFirstOf(const CharType *string,
+                                       SizeType        length,
+                                       const CharType *characterSet,
+                                       SizeType        setLength);
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' that is equal to one of the
+        // characters in the specified 'characterSet' of the specified
+        // 'setLength', or 0 if there is none.
+
+    static const CharType *findFirstNotOf(const CharType *string,
+                                          SizeType        length,
+                                          const CharType *characterSet,
+                                          SizeType        setLength);
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' of the specified
+        // 'setLength', or 0 if there is none.
+
+    static const CharType *findLastOf(const CharType *string,
+                                      SizeType        length,
+                                      const CharType *characterSet,
+                                      SizeType        setLength);
+        // Return the address of the last character in the specified 'string'
+        // of the specified 'length' that is equal to one of the characters in
+        // the specified 'characterSet' of the specified 'setLength', or 0 if
+        // there is none.
+
+    static const CharType *findLastNotOf(const CharType *string,
+                                         SizeType        length,
+                                         const CharType *characterSet,
+                                         SizeType        setLength);
+        // Return the address of the last character in the specified 'string'
+        // of the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' of the specified
+        // 'setLength', or 0 if there is none.
+};
+
+            // =======================================================
+            // struct StringSearchUtil<native_std::char_traits<char> >
+            // =======================================================
+
+template <>
+struct StringSearchUtil<native_std::char_traits<char> > {
+    // This specialization of 'StringSearchUtil' for 'char' strings provides
+    // the same functions, with the same contracts, as the primary template,
+    // implemented using algorithms that compare characters as bytes (see
+    // {DESCRIPTION}).
+
+    // PUBLIC TYPES
+    typedef char               CharType;
+    typedef native_std::size_t SizeType;
+
+    // CLASS METHODS
+    static const char *find(const char *string,
+                            SizeType    length,
+                            const char *pattern,
+                            SizeType    patternLength);
+        // Return the address of the first character of the first occurrence
+        // of the specified 'pattern' of the specified 'patternLength' in the
+        // specified 'string' of the specified 'length', or 0 if 'pattern'
+        // does not occur in 'string'.  Return 'string' if 'patternLength' is
+        // 0.
+
+    static const char *rfind(const char *string,
+                             SizeType    length,
+                             const char *pattern,
+                             SizeType    patternLength);
+        // Return the address of the first character of the last occurrence
+        // of the specified 'pattern' of the specified 'patternLength' in the
+        // specified 'string' of the specified 'length', or 0 if 'pattern'
+        // does not occur in 'string'.  Return 'string + length' if
+        // 'patternLength' is 0.
+
+    static const char *findFirstOf(const char *string,
+                                   SizeType    length,
+                                   const char *characterSet,
+                                   SizeType    setLength);
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' that is equal to one of the
+        // characters in the specified 'characterSet' of the specified
+        // 'setLength', or 0 if there is none.
+
+    static const char *findFirstNotOf(const char *string,
+                                      SizeType    length,
+                                      const char *characterSet,
+                                      SizeType    setLength);
+        // Return the address of the first character in the specified
+        // 'string' of the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' of the specified
+        // 'setLength', or 0 if there is none.
+
+    static const char *findLastOf(const char *string,
+                                  SizeType    length,
+                                  const char *characterSet,
+                                  SizeType    setLength);
+        // Return the address of the last character in the specified 'string'
+        // of the specified 'length' that is equal to one of the characters in
+        // the specified 'characterSet' of the specified 'setLength', or 0 if
+        // there is none.
+
+    static const char *findLastNotOf(const char *string,
+                                     SizeType    length,
+                                     const char *characterSet,
+                                     SizeType    setLength);
+        // Return the address of the last character in the specified 'string'
+        // of the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' of the specified
+        // 'setLength', or 0 if there is none.
+};
+
+// ============================================================================
+//                      TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // struct StringSearchUtil
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+template <class CHAR_TRAITS>
+inline
+const typename StringSearchUtil<CHAR_TRAITS>::CharType *
+StringSearchUtil<CHAR_TRAITS>::findCharacter(const CharType  *string,
+                                             SizeType         length,
+                                             const CharType&  character)
+{
+    return CharTraitsUtil<CHAR_TRAITS>::find(string, length, character);
+}
+
+// CLASS METHODS
+template <class CHAR_TRAITS>
+const typename StringSearchUtil<CHAR_TRAITS>::CharType *
+StringSearchUtil<CHAR_TRAITS>::find(const CharType *string,
+                                    SizeType        length,
+                                    const CharType *pattern,
+                                    SizeType        patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (0 == patternLength) {
+        return string;                                                // RETURN
+    }
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+
+    // Candidate positions are in the range '[string, end)'.  Check the last
+    // character of the pattern before comparing the rest of it, which rejects
+    // most false candidates more cheaply.
+
+    const CharType *const end  = string + (length - patternLength) + 1;
+    const SizeType        last = patternLength - 1;
+
+    for (const CharType *current = string; current != end; ++current) {
+        current = findCharacter(current, end - current, *pattern);
+        if (!current) {
+            return 0;                                                 // RETURN
+        }
+        if (CHAR_TRAITS::eq(current[last], pattern[last])
+         && 0 == CharTraitsUtil<CHAR_TRAITS>::compare(current + 1,
+                                                      pattern + 1,
+                                                      last)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename StringSearchUtil<CHAR_TRAITS>::CharType *
+StringSearchUtil<CHAR_TRAITS>::rfind(const CharType *string,
+                                     SizeType        length,
+                                     const CharType *pattern,
+                                     SizeType        patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (0 == patternLength) {
+        return string + length;                                       // RETURN
+    }
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+
+    for (const CharType *current = string + (length - patternLength);
+         ;
+         --current) {
+        if (CHAR_TRAITS::eq(*current, *pattern)
+         && 0 == CharTraitsUtil<CHAR_TRAITS>::compare(current,
+                                                      pattern,
+                                                      patternLength)) {
+            return current;                                           // RETURN
+        }
+        if (current == string) {
+            break;
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename StringSearchUtil<CHAR_TRAITS>::CharType *
+StringSearchUtil<CHAR_TRAITS>::findFirstOf(const CharType *string,
+                                           SizeType        length,
+                                           const CharType *characterSet,
+                                           SizeType        setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (1 == setLength) {
+        return findCharacter(string, length, *characterSet);          // RETURN
+    }
+    if (0 < setLength) {
+        for (const CharType *end = string + length; string != end; ++string) {
+            if (findCharacter(characterSet, setLength, *string)) {
+                return string;                                        // RETURN
+            }
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename StringSearchUtil<CHAR_TRAITS>::CharType *
+StringSearchUtil<CHAR_TRAITS>::findFirstNotOf(const CharType *string,
+                                              SizeType        length,
+                                              const CharType *characterSet,
+                                              SizeType        setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    for (const CharType *end = string + length; string != end; ++string) {
+        if (!findCharacter(characterSet, setLength, *string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename StringSearchUtil<CHAR_TRAITS>::CharType *
+StringSearchUtil<CHAR_TRAITS>::findLastOf(const CharType *string,
+                                          SizeType        length,
+                                          const CharType *characterSet,
+                                          SizeType        setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 < setLength) {
+        for (const CharType *current = string + length; current != string; ) {
+            --current;
+            if (findCharacter(characterSet, setLength, *current)) {
+                return current;                                       // RETURN
+            }
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename StringSearchUtil<CHAR_TRAITS>::CharType *
+StringSearchUtil<CHAR_TRAITS>::findLastNotOf(const CharType *string,
+                                             SizeType        length,
+                                             const CharType *characterSet,
+                                             SizeType        setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    for (const CharType *current = string + length; current != string; ) {
+        --current;
+        if (!findCharacter(characterSet, setLength, *current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
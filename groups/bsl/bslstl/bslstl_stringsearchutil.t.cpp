@@ -0,0 +1,1009 @@
+// bslstl_stringsearchutil.t.cpp                                      -*-C++-*-
+
+#include <bslstl_stringsearchutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::StringSearchUtil' is a utility 'struct' template whose functions
+// return the address of the character found by a search, or 0.  Each function
+// is tested by comparing its result with that of a straightforward reference
+// implementation, for every string and pattern (or character set) over a
+// small alphabet up to a modest length, and for a large number of randomly
+// generated strings and patterns, constructed to exercise each of the paths
+// of the optimized specialization for 'native_std::char_traits<char>': the
+// 16-byte blocks of the SSE2 filter and the scalar remainder, and the
+// periodic and non-periodic cases of the Two-Way algorithm.  The same tests
+// are applied to the primary template, instantiated for 'wchar_t' and for a
+// traits type for 'char' that is not 'native_std::char_traits<char>'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] const CharType *find(string, length, pattern, patternLength);
+// [ 2] const CharType *rfind(string, length, pattern, patternLength);
+// [ 3] const CharType *findFirstOf(string, length, set, setLength);
+// [ 3] const CharType *findFirstNotOf(string, length, set, setLength);
+// [ 3] const CharType *findLastOf(string, length, set, setLength);
+// [ 3] const CharType *findLastNotOf(string, length, set, setLength);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 4] CONCERN: Precondition violations are detected when enabled.
+// [-1] PERFORMANCE: TOKENIZER WORKLOADS
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::StringSearchUtil<native_std::char_traits<char> >    Obj;
+typedef bslstl::StringSearchUtil<native_std::char_traits<wchar_t> > WObj;
+
+struct OtherTraits : native_std::char_traits<char> {
+    // This 'struct' is a traits type for 'char' that is distinct from
+    // 'native_std::char_traits<char>', so that 'StringSearchUtil' is
+    // instantiated from its primary template.
+};
+
+typedef bslstl::StringSearchUtil<OtherTraits> GObj;
+
+const int MAX_LENGTH = 1024;  // maximum length of a string under test
+
+namespace {
+
+unsigned int randomState = 1;
+
+int randomInt(int limit)
+    // Return a pseudo-random integer in the range '[0, limit)'.
+{
+    randomState = randomState * 1103515245 + 12345;
+    return static_cast<int>((randomState >> 8) % limit);
+}
+
+char randomChar(int alphabetSize)
+    // Return a pseudo-random character from among the first (if less than
+    // 256) specified 'alphabetSize' lowercase letters, or from all 'char'
+    // values otherwise.
+{
+    return static_cast<char>(alphabetSize < 256 ? 'a' + randomInt(alphabetSize)
+                                                : randomInt(256));
+}
+
+                        // ==========================
+                        // reference implementations
+                        // ==========================
+
+template <class CHAR_TYPE>
+const CHAR_TYPE *naiveFind(const CHAR_TYPE *string,
+                           size_t           length,
+                           const CHAR_TYPE *pattern,
+                           size_t           patternLength)
+    // Return the address of the first occurrence of the specified 'pattern'
+    // of the specified 'patternLength' in the specified 'string' of the
+    // specified 'length', or 0 if there is none.
+{
+    for (size_t i = 0; i + patternLength <= length; ++i) {
+        size_t j = 0;
+        while (j < patternLength && string[i + j] == pattern[j]) {
+            ++j;
+        }
+        if (j == patternLength) {
+            return string + i;                                        // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE>
+const CHAR_TYPE *naiveRfind(const CHAR_TYPE *string,
+                            size_t           length,
+                            const CHAR_TYPE *pattern,
+                            size_t           patternLength)
+    // Return the address of the last occurrence of the specified 'pattern' of
+    // the specified 'patternLength' in the specified 'string' of the
+    // specified 'length', or 0 if there is none.
+{
+    for (size_t i = length + 1; i-- > 0; ) {
+        if (i + patternLength > length) {
+            continue;
+        }
+        size_t j = 0;
+        while (j < patternLength && string[i + j] == pattern[j]) {
+            ++j;
+        }
+        if (j == patternLength) {
+            return string + i;                                        // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE>
+bool isMember(CHAR_TYPE character, const CHAR_TYPE *set, size_t setLength)
+    // Return 'true' if the specified 'character' is among the specified
+    // 'setLength' characters of the specified 'set', and 'false' otherwise.
+{
+    for (size_t i = 0; i < setLength; ++i) {
+        if (set[i] == character) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+template <class CHAR_TYPE>
+const CHAR_TYPE *naiveFindFirst(const CHAR_TYPE *string,
+                                size_t           length,
+                                const CHAR_TYPE *set,
+                                size_t           setLength,
+                                bool             member)
+    // Return the address of the first character in the specified 'string' of
+    // the specified 'length' whose membership in the specified 'set' of the
+    // specified 'setLength' equals the specified 'member', or 0 if there is
+    // none.
+{
+    for (size_t i = 0; i < length; ++i) {
+        if (isMember(string[i], set, setLength) == member) {
+            return string + i;                                        // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE>
+const CHAR_TYPE *naiveFindLast(const CHAR_TYPE *string,
+                               size_t           length,
+                               const CHAR_TYPE *set,
+                               size_t           setLength,
+                               bool             member)
+    // Return the address of the last character in the specified 'string' of
+    // the specified 'length' whose membership in the specified 'set' of the
+    // specified 'setLength' equals the specified 'member', or 0 if there is
+    // none.
+{
+    for (size_t i = length; i-- > 0; ) {
+        if (isMember(string[i], set, setLength) == member) {
+            return string + i;                                        // RETURN
+        }
+    }
+    return 0;
+}
+
+                        // ========================
+                        // verification functions
+                        // ========================
+
+template <class UTIL>
+void verifySearch(int         line,
+                  const char *string,
+                  size_t      length,
+                  const char *pattern,
+                  size_t      patternLength)
+    // Verify that 'UTIL::find' and 'UTIL::rfind' return the same results as
+    // the reference implementations for the specified 'pattern' of the
+    // specified 'patternLength' in the specified 'string' of the specified
+    // 'length', after converting each character to 'UTIL::CharType', and
+    // report failures using the specified 'line'.
+{
+    typedef typename UTIL::CharType CharType;
+
+    CharType s[MAX_LENGTH] = {};
+    CharType p[MAX_LENGTH] = {};
+    for (size_t i = 0; i < length; ++i) {
+        s[i] = static_cast<CharType>(static_cast<unsigned char>(string[i]));
+    }
+    for (size_t i = 0; i < patternLength; ++i) {
+        p[i] = static_cast<CharType>(static_cast<unsigned char>(pattern[i]));
+    }
+
+    const CharType *EXP_FIND  = naiveFind(s, length, p, patternLength);
+    const CharType *EXP_RFIND = naiveRfind(s, length, p, patternLength);
+
+    const CharType *find  = UTIL::find(s, length, p, patternLength);
+    const CharType *rfind = UTIL::rfind(s, length, p, patternLength);
+
+    ASSERTV(line, length, patternLength, EXP_FIND - s, find - s,
+            EXP_FIND == find);
+    ASSERTV(line, length, patternLength, EXP_RFIND - s, rfind - s,
+            EXP_RFIND == rfind);
+}
+
+template <class UTIL>
+void verifySetSearch(int         line,
+                     const char *string,
+                     size_t      length,
+                     const char *set,
+                     size_t      setLength)
+    // Verify that the character-set search functions of 'UTIL' return the
+    // same results as the reference implementations for the specified 'set'
+    // of the specified 'setLength' in the specified 'string' of the specified
+    // 'length', after converting each character to 'UTIL::CharType', and
+    // report failures using the specified 'line'.
+{
+    typedef typename UTIL::CharType CharType;
+
+    CharType s[MAX_LENGTH] = {};
+    CharType c[MAX_LENGTH] = {};
+    for (size_t i = 0; i < length; ++i) {
+        s[i] = static_cast<CharType>(static_cast<unsigned char>(string[i]));
+    }
+    for (size_t i = 0; i < setLength; ++i) {
+        c[i] = static_cast<CharType>(static_cast<unsigned char>(set[i]));
+    }
+
+    ASSERTV(line, length, setLength,
+            naiveFindFirst(s, length, c, setLength, true)
+                             == UTIL::findFirstOf(s, length, c, setLength));
+    ASSERTV(line, length, setLength,
+            naiveFindFirst(s, length, c, setLength, false)
+                             == UTIL::findFirstNotOf(s, length, c, setLength));
+    ASSERTV(line, length, setLength,
+            naiveFindLast(s, length, c, setLength, true)
+                             == UTIL::findLastOf(s, length, c, setLength));
+    ASSERTV(line, length, setLength,
+            naiveFindLast(s, length, c, setLength, false)
+                             == UTIL::findLastNotOf(s, length, c, setLength));
+}
+
+void verifyAll(int         line,
+               const char *string,
+               size_t      length,
+               const char *pattern,
+               size_t      patternLength)
+    // Verify the substring search functions of the specialization for
+    // 'native_std::char_traits<char>' and of the primary template, for 'char'
+    // and 'wchar_t', for the specified 'pattern' of the specified
+    // 'patternLength' in the specified 'string' of the specified 'length', and
+    // report failures using the specified 'line'.
+{
+    verifySearch<Obj>(line, string, length, pattern, patternLength);
+    verifySearch<WObj>(line, string, length, pattern, patternLength);
+    verifySearch<GObj>(line, string, length, pattern, patternLength);
+}
+
+void verifyAllSets(int         line,
+                   const char *string,
+                   size_t      length,
+                   const char *set,
+                   size_t      setLength)
+    // Verify the character-set search functions of the specialization for
+    // 'native_std::char_traits<char>' and of the primary template, for 'char'
+    // and 'wchar_t', for the specified 'set' of the specified 'setLength' in
+    // the specified 'string' of the specified 'length', and report failures
+    // using the specified 'line'.
+{
+    verifySetSearch<Obj>(line, string, length, set, setLength);
+    verifySetSearch<WObj>(line, string, length, set, setLength);
+    verifySetSearch<GObj>(line, string, length, set, setLength);
+}
+
+int generate(char *buffer, int length, unsigned int index, char first)
+    // Load into the specified 'buffer' the string of the specified 'length'
+    // whose characters are the base-2 digits of the specified 'index' (least
+    // significant first), represented by the specified 'first' character and
+    // its successor, and return 'length'.
+{
+    for (int i = 0; i < length; ++i, index >>= 1) {
+        buffer[i] = static_cast<char>(first + (index & 1));
+    }
+    return length;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Buffer that is not a String
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to locate the end of the header of an HTTP message
+// that has been read into a buffer, which is not null-terminated.  First, we
+// define the buffer:
+//..
+    const char   buffer[] = "GET / HTTP/1.1\r\nHost: example.com\r\n\r\nbody";
+    const size_t length   = sizeof buffer - 1;
+//..
+// Then, we search for the blank line terminating the header, using the
+// algorithms for 'char' strings:
+//..
+    typedef bslstl::StringSearchUtil<std::char_traits<char> > Search;
+
+    const char *end = Search::find(buffer, length, "\r\n\r\n", 4);
+    ASSERT(buffer + 33 == end);
+//..
+// Next, we look for the first character that is either a space or a line
+// terminator, to find the end of the method of the request line:
+//..
+    const char *delimiter = Search::findFirstOf(buffer, length, " \r\n", 3);
+    ASSERT(buffer + 3 == delimiter);
+//..
+// Finally, we note that the search functions return 0 if they find nothing:
+//..
+    ASSERT(0 == Search::find(buffer, length, "Content-Length", 14));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING PRECONDITIONS
+        //
+        // Concerns:
+        //: 1 Null string, pattern, or set addresses are detected in safe
+        //:   builds unless the corresponding length is 0.
+        //
+        // Plan:
+        //: 1 Use 'BSLS_ASSERTTEST_*' macros to verify that each function
+        //:   detects a null address with a non-zero length, for the
+        //:   specialization and for the primary template.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Precondition violations are detected when enabled.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PRECONDITIONS"
+                            "\n=====================\n");
+
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+#if defined(BDE_BUILD_TARGET_EXC) && defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
+        const char    S[]  = "abc";
+        const wchar_t WS[] = L"abc";
+#endif
+
+        if (verbose) printf("\t'find' and 'rfind'\n");
+
+        ASSERT_SAFE_PASS(Obj::find(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(Obj::find(0, 1, S, 1));
+        ASSERT_SAFE_FAIL(Obj::find(S, 3, 0, 1));
+        ASSERT_SAFE_PASS(Obj::rfind(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(Obj::rfind(0, 1, S, 1));
+        ASSERT_SAFE_FAIL(Obj::rfind(S, 3, 0, 1));
+
+        ASSERT_SAFE_PASS(WObj::find(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(WObj::find(0, 1, WS, 1));
+        ASSERT_SAFE_FAIL(WObj::find(WS, 3, 0, 1));
+        ASSERT_SAFE_PASS(WObj::rfind(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(WObj::rfind(0, 1, WS, 1));
+        ASSERT_SAFE_FAIL(WObj::rfind(WS, 3, 0, 1));
+
+        if (verbose) printf("\tCharacter-set searches\n");
+
+        ASSERT_SAFE_PASS(Obj::findFirstOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(Obj::findFirstOf(0, 1, S, 1));
+        ASSERT_SAFE_FAIL(Obj::findFirstOf(S, 3, 0, 1));
+        ASSERT_SAFE_PASS(Obj::findFirstNotOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(Obj::findFirstNotOf(0, 1, S, 1));
+        ASSERT_SAFE_FAIL(Obj::findFirstNotOf(S, 3, 0, 1));
+        ASSERT_SAFE_PASS(Obj::findLastOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(Obj::findLastOf(0, 1, S, 1));
+        ASSERT_SAFE_FAIL(Obj::findLastOf(S, 3, 0, 1));
+        ASSERT_SAFE_PASS(Obj::findLastNotOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(Obj::findLastNotOf(0, 1, S, 1));
+        ASSERT_SAFE_FAIL(Obj::findLastNotOf(S, 3, 0, 1));
+
+        ASSERT_SAFE_PASS(WObj::findFirstOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(WObj::findFirstOf(0, 1, WS, 1));
+        ASSERT_SAFE_FAIL(WObj::findFirstOf(WS, 3, 0, 1));
+        ASSERT_SAFE_PASS(WObj::findFirstNotOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(WObj::findFirstNotOf(0, 1, WS, 1));
+        ASSERT_SAFE_FAIL(WObj::findFirstNotOf(WS, 3, 0, 1));
+        ASSERT_SAFE_PASS(WObj::findLastOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(WObj::findLastOf(0, 1, WS, 1));
+        ASSERT_SAFE_FAIL(WObj::findLastOf(WS, 3, 0, 1));
+        ASSERT_SAFE_PASS(WObj::findLastNotOf(0, 0, 0, 0));
+        ASSERT_SAFE_FAIL(WObj::findLastNotOf(0, 1, WS, 1));
+        ASSERT_SAFE_FAIL(WObj::findLastNotOf(WS, 3, 0, 1));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CHARACTER-SET SEARCHES
+        //
+        // Concerns:
+        //: 1 Each function returns the address of the first (or last)
+        //:   character that is (or is not) a member of the set, or 0 if there
+        //:   is none.
+        //:
+        //: 2 An empty set has no members, so that 'findFirstOf' and
+        //:   'findLastOf' find nothing, and 'findFirstNotOf' and
+        //:   'findLastNotOf' find the first and last character.
+        //:
+        //: 3 Sets having repeated members, and sets and strings having
+        //:   characters whose (signed) 'char' value is negative, are handled
+        //:   correctly.
+        //:
+        //: 4 The results do not depend on the length of the string or the
+        //:   size of the set (i.e., on the algorithm used).
+        //
+        // Plan:
+        //: 1 For every string of length up to 7 and every set of size up to 4
+        //:   over a three-letter alphabet, compare the result of each function
+        //:   with that of a reference implementation.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for strings of length up to 300 and sets of size up to
+        //:   20 generated at random from alphabets of 2, 5, 26, and 256
+        //:   characters.  (C-1..4)
+        //
+        // Testing:
+        //   const CharType *findFirstOf(string, length, set, setLength);
+        //   const CharType *findFirstNotOf(string, length, set, setLength);
+        //   const CharType *findLastOf(string, length, set, setLength);
+        //   const CharType *findLastNotOf(string, length, set, setLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CHARACTER-SET SEARCHES"
+                            "\n==============================\n");
+
+        if (verbose) printf("\tExhaustive test over a small alphabet\n");
+        {
+            char string[8];
+            char set[4];
+
+            int numStrings = 1;  // number of strings of the current length
+            for (int length = 0; length <= 7; ++length, numStrings *= 3) {
+                for (int i = 0; i < numStrings; ++i) {
+                    for (int k = 0, index = i; k < length; ++k, index /= 3) {
+                        string[k] = static_cast<char>('a' + index % 3);
+                    }
+
+                    int numSets = 1;
+                    for (int setLength = 0; setLength <= 4; ++setLength) {
+                        for (int j = 0; j < numSets; ++j) {
+                            for (int k = 0, index = j;
+                                 k < setLength;
+                                 ++k, index /= 3) {
+                                set[k] = static_cast<char>('a' + index % 3);
+                            }
+                            verifyAllSets(L_, string, length, set, setLength);
+                        }
+                        numSets *= 3;
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tRandom strings and sets\n");
+        {
+            const int ALPHABETS[]   = { 2, 5, 26, 256 };
+            const int NUM_ALPHABETS = sizeof ALPHABETS / sizeof *ALPHABETS;
+
+            const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 2000;
+
+            char string[300];
+            char set[20];
+
+            for (int ti = 0; ti < NUM_ALPHABETS; ++ti) {
+                const int ALPHABET = ALPHABETS[ti];
+
+                if (veryVerbose) { T_ P(ALPHABET) }
+
+                for (int iteration = 0;
+                     iteration < NUM_ITERATIONS;
+                     ++iteration) {
+                    const int length    = randomInt(300);
+                    const int setLength = randomInt(20);
+
+                    for (int i = 0; i < length; ++i) {
+                        string[i] = randomChar(ALPHABET);
+                    }
+                    for (int i = 0; i < setLength; ++i) {
+                        set[i] = randomChar(ALPHABET);
+                    }
+                    verifyAllSets(L_, string, length, set, setLength);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'find' AND 'rfind'
+        //
+        // Concerns:
+        //: 1 'find' and 'rfind' return the address of the first and last
+        //:   occurrence of the pattern in the string, or 0 if there is none.
+        //:
+        //: 2 An empty pattern is found at the beginning ('find') and the end
+        //:   ('rfind') of any string, and a pattern longer than the string is
+        //:   never found.
+        //:
+        //: 3 Occurrences are found at every position relative to the 16-byte
+        //:   blocks of the filter, including in the scalar remainder, and
+        //:   matches of only the first and last characters are rejected.
+        //:
+        //: 4 Patterns of at least 32 characters are found correctly whether
+        //:   or not they are periodic, in strings having many partial matches.
+        //:
+        //: 5 Characters whose (signed) 'char' value is negative are compared
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 For every string of length up to 12 and every pattern of length
+        //:   up to 5 over a two-letter alphabet, compare the results of 'find'
+        //:   and 'rfind' with those of reference implementations.  (C-1..2)
+        //:
+        //: 2 For every pattern length up to 64 and every position in a string
+        //:   of length 100, plant the pattern at the position and compare the
+        //:   results with those of the reference implementations, both with
+        //:   the pattern intact and with its interior corrupted.  (C-1, 3)
+        //:
+        //: 3 Repeat P-1 for strings of length up to 1000 and patterns of
+        //:   length up to 100 generated from alphabets of 2, 4, and 256
+        //:   characters, taking the pattern both at random and from the
+        //:   string, and for strings and patterns made of repetitions of a
+        //:   random unit with occasional changes.  (C-1..5)
+        //
+        // Testing:
+        //   const CharType *find(string, length, pattern, patternLength);
+        //   const CharType *rfind(string, length, pattern, patternLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'find' AND 'rfind'"
+                            "\n==========================\n");
+
+        if (verbose) printf("\tExhaustive test over a small alphabet\n");
+        {
+            char string[12];
+            char pattern[5];
+
+            for (int length = 0; length <= 12; ++length) {
+                for (unsigned int i = 0; i < (1u << length); ++i) {
+                    generate(string, length, i, 'a');
+                    for (int patternLength = 0;
+                         patternLength <= 5;
+                         ++patternLength) {
+                        for (unsigned int j = 0;
+                             j < (1u << patternLength);
+                             ++j) {
+                            generate(pattern, patternLength, j, 'a');
+                            verifyAll(L_,
+                                      string,
+                                      length,
+                                      pattern,
+                                      patternLength);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tPatterns planted at every position\n");
+        {
+            const int LENGTH = 100;
+
+            char string[LENGTH];
+            char pattern[64];
+
+            for (int patternLength = 1; patternLength <= 64; ++patternLength) {
+                for (int i = 0; i < patternLength; ++i) {
+                    pattern[i] = randomChar(256);
+                }
+                for (int position = 0;
+                     position + patternLength <= LENGTH;
+                     ++position) {
+                    for (int i = 0; i < LENGTH; ++i) {
+                        string[i] = randomChar(4);
+                    }
+                    memcpy(string + position, pattern, patternLength);
+                    verifyAll(L_, string, LENGTH, pattern, patternLength);
+
+                    if (2 < patternLength) {
+                        // Keep only the first and last characters.
+
+                        string[position + patternLength / 2] ^= 1;
+                        verifyAll(L_, string, LENGTH, pattern, patternLength);
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tRandom strings and patterns\n");
+        {
+            const int ALPHABETS[]   = { 2, 4, 256 };
+            const int NUM_ALPHABETS = sizeof ALPHABETS / sizeof *ALPHABETS;
+
+            const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 1000;
+
+            char string[1000];
+            char pattern[100];
+
+            for (int ti = 0; ti < NUM_ALPHABETS; ++ti) {
+                const int ALPHABET = ALPHABETS[ti];
+
+                if (veryVerbose) { T_ P(ALPHABET) }
+
+                for (int iteration = 0;
+                     iteration < NUM_ITERATIONS;
+                     ++iteration) {
+                    const int length        = randomInt(1000);
+                    const int patternLength = 1 + randomInt(100);
+
+                    for (int i = 0; i < length; ++i) {
+                        string[i] = randomChar(ALPHABET);
+                    }
+                    for (int i = 0; i < patternLength; ++i) {
+                        pattern[i] = randomChar(ALPHABET);
+                    }
+                    verifyAll(L_, string, length, pattern, patternLength);
+
+                    if (patternLength <= length) {
+                        const int position =
+                                    randomInt(length - patternLength + 1);
+                        verifyAll(L_,
+                                  string,
+                                  length,
+                                  string + position,
+                                  patternLength);
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tPeriodic strings and patterns\n");
+        {
+            const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 1000;
+
+            char string[1000];
+            char pattern[100];
+            char unit[8];
+
+            for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+                const int unitLength    = 1 + randomInt(8);
+                const int length        = randomInt(1000);
+                const int patternLength = 1 + randomInt(100);
+
+                for (int i = 0; i < unitLength; ++i) {
+                    unit[i] = randomChar(2);
+                }
+                for (int i = 0; i < length; ++i) {
+                    string[i] = 0 == randomInt(200) ? randomChar(3)
+                                                    : unit[i % unitLength];
+                }
+                for (int i = 0; i < patternLength; ++i) {
+                    pattern[i] = unit[(i + iteration) % unitLength];
+                }
+                if (0 == iteration % 4) {
+                    pattern[randomInt(patternLength)] = randomChar(3);
+                }
+
+                if (veryVerbose) {
+                    T_ P_(unitLength) P_(length) P(patternLength)
+                }
+
+                verifyAll(L_, string, length, pattern, patternLength);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Search for a few patterns and sets in a short string.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const char   S[] = "the quick brown fox jumps over the lazy dog";
+        const size_t N   = sizeof S - 1;
+
+        ASSERT(S      == Obj::find(S, N, "the", 3));
+        ASSERT(S + 31 == Obj::rfind(S, N, "the", 3));
+        ASSERT(S + 16 == Obj::find(S, N, "fox", 3));
+        ASSERT(0      == Obj::find(S, N, "cat", 3));
+        ASSERT(S      == Obj::find(S, N, "", 0));
+        ASSERT(S + N  == Obj::rfind(S, N, "", 0));
+
+        ASSERT(S + 3  == Obj::findFirstOf(S, N, " ,", 2));
+        ASSERT(S + 39 == Obj::findLastOf(S, N, " ,", 2));
+        ASSERT(S + 1  == Obj::findFirstNotOf(S, N, "t", 1));
+        ASSERT(S + 41 == Obj::findLastNotOf(S, N, "gt", 2));
+
+        const char   LONG[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+        const size_t M      = sizeof LONG - 1;
+
+        char buffer[256];
+        memset(buffer, 'A', sizeof buffer);
+        memcpy(buffer + 200, LONG, M);
+
+        ASSERT(buffer + 200 == Obj::find(buffer, sizeof buffer, LONG, M));
+        ASSERT(buffer + 200 == Obj::rfind(buffer, sizeof buffer, LONG, M));
+        ASSERT(0 == Obj::find(buffer, 235, LONG, M));
+
+        const wchar_t WS[] = L"hello, world";
+
+        ASSERT(WS + 7 == WObj::find(WS, 12, L"world", 5));
+        ASSERT(WS + 5 == WObj::findFirstOf(WS, 12, L", ", 2));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TOKENIZER WORKLOADS
+        //
+        // Concerns:
+        //: 1 The specialization for 'native_std::char_traits<char>' is faster
+        //:   than the generic algorithms for searches typical of tokenizers
+        //:   and parsers.
+        //
+        // Plan:
+        //: 1 Generate a text of words separated by delimiters, and time the
+        //:   splitting of the text into tokens at the delimiters, the search
+        //:   for short and long patterns that do not occur in the text, and
+        //:   the search for a long pattern in a highly repetitive text, using
+        //:   the specialization, and using the primary template for an
+        //:   equivalent traits type.
+        //
+        // Testing:
+        //   PERFORMANCE: TOKENIZER WORKLOADS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: TOKENIZER WORKLOADS"
+                            "\n================================\n");
+
+        const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 20;
+        const int LENGTH         = 1 << 20;
+
+        char *text = static_cast<char *>(malloc(LENGTH));
+        for (int i = 0; i < LENGTH; ++i) {
+            text[i] = 0 == randomInt(7) ? " ,;\n"[randomInt(4)]
+                                        : randomChar(26);
+        }
+
+        char *repetitive = static_cast<char *>(malloc(LENGTH));
+        memset(repetitive, 'a', LENGTH);
+
+        const char   DELIMITERS[] = " ,;\n";
+        const size_t NUM_DELIMITERS = 4;
+
+        char longPattern[64];
+        memset(longPattern, 'a', sizeof longPattern);
+        longPattern[sizeof longPattern - 1] = 'b';
+
+        const char *WORKLOADS[] = {
+            "split at delimiters ('findFirstOf')",
+            "skip to token ('findFirstNotOf')",
+            "absent 6-character pattern ('find')",
+            "absent 20-character pattern ('find')",
+            "'a...ab' (64) in 'aaa...' ('find')",
+        };
+        const int NUM_WORKLOADS = sizeof WORKLOADS / sizeof *WORKLOADS;
+
+        for (int wi = 0; wi < NUM_WORKLOADS; ++wi) {
+            double times[2];
+
+            for (int variant = 0; variant < 2; ++variant) {
+                bsls::Stopwatch timer;
+                timer.start();
+
+                size_t checksum = 0;
+                for (int iteration = 0;
+                     iteration < NUM_ITERATIONS;
+                     ++iteration) {
+                    switch (wi) {
+                      case 0: {
+                        const char *current = text;
+                        const char *end     = text + LENGTH;
+                        while (current != end) {
+                            const char *found = 0 == variant
+                              ? Obj::findFirstOf(current,
+                                                 end - current,
+                                                 DELIMITERS,
+                                                 NUM_DELIMITERS)
+                              : GObj::findFirstOf(current,
+                                                  end - current,
+                                                  DELIMITERS,
+                                                  NUM_DELIMITERS);
+                            if (!found) {
+                                break;
+                            }
+                            ++checksum;
+                            current = found + 1;
+                        }
+                      } break;
+                      case 1: {
+                        const char *current = text;
+                        const char *end     = text + LENGTH;
+                        while (current != end) {
+                            const char *found = 0 == variant
+                              ? Obj::findFirstNotOf(current,
+                                                    end - current,
+                                                    DELIMITERS,
+                                                    NUM_DELIMITERS)
+                              : GObj::findFirstNotOf(current,
+                                                     end - current,
+                                                     DELIMITERS,
+                                                     NUM_DELIMITERS);
+                            if (!found) {
+                                break;
+                            }
+                            ++checksum;
+                            current = found + 1;
+                        }
+                      } break;
+                      case 2:
+                      case 3: {
+                        const char   *pattern       = 2 == wi
+                                                    ? "zqzqzq"
+                                                    : "zqzqzqzqzqzqzqzqzqzq";
+                        const size_t  patternLength = 2 == wi ? 6 : 20;
+
+                        checksum += 0 == variant
+                                  ? !Obj::find(text,
+                                               LENGTH,
+                                               pattern,
+                                               patternLength)
+                                  : !GObj::find(text,
+                                                LENGTH,
+                                                pattern,
+                                                patternLength);
+                      } break;
+                      default: {
+                        checksum += 0 == variant
+                                  ? !Obj::find(repetitive,
+                                               LENGTH,
+                                               longPattern,
+                                               sizeof longPattern)
+                                  : !GObj::find(repetitive,
+                                                LENGTH,
+                                                longPattern,
+                                                sizeof longPattern);
+                      } break;
+                    }
+                }
+
+                timer.stop();
+                times[variant] = timer.elapsedTime();
+
+                if (veryVerbose) { T_ P(checksum) }
+            }
+
+            printf("%-40s specialized: %8.4fs  generic: %8.4fs\n",
+                   WORKLOADS[wi],
+                   times[0],
+                   times[1]);
+        }
+
+        free(repetitive);
+        free(text);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
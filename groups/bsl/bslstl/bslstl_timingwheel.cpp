@@ -0,0 +1,280 @@
+// bslstl_timingwheel.cpp                                             -*-C++-*-
+#include <bslstl_timingwheel.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    #include <intrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+namespace {
+
+inline
+int lowestBit(bsls::Types::Uint64 value)
+    // Return the index of the least significant bit set in the specified
+    // 'value'.  The behavior is undefined unless '0 != value'.
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctzll(value);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    int result = 0;
+    for (int shift = 32; shift > 0; shift >>= 1) {
+        const bsls::Types::Uint64 mask =
+                                 (bsls::Types::Uint64(1) << shift) - 1;
+        if (0 == (value & mask)) {
+            value  >>= shift;
+            result  += shift;
+        }
+    }
+    return result;
+#endif
+}
+
+}  // close unnamed namespace
+
+                            // -----------------
+                            // class TimingWheel
+                            // -----------------
+
+// PRIVATE MANIPULATORS
+void TimingWheel::cascade()
+{
+    BSLS_ASSERT_SAFE(0 == (d_currentTick & k_SLOT_MASK));
+
+    // Find the highest level whose span of a slot ends at the current tick,
+    // and, from that level down, move the timers of the slot whose span
+    // begins at the current tick.  Each timer moves to a lower level, but for
+    // those in the highest level that are still beyond its span.
+
+    int maxLevel = 1;
+    while (maxLevel < k_NUM_LEVELS - 1
+        && 0 == (d_currentTick & ((bsls::Types::Int64(1)
+                                  << (k_SLOT_BITS * (maxLevel + 1))) - 1))) {
+        ++maxLevel;
+    }
+
+    for (int level = maxLevel; 0 < level; --level) {
+        const int index = static_cast<int>(d_currentTick
+                                           >> (k_SLOT_BITS * level))
+                        & k_SLOT_MASK;
+
+        if (0 == (d_occupied[level] & (bsls::Types::Uint64(1) << index))) {
+            continue;
+        }
+
+        Link *link = detach(level * k_NUM_SLOTS + index);
+        while (link) {
+            Link *next = link->nextLink();
+            insert(static_cast<TimingWheelTimer *>(link));
+            link = next;
+        }
+    }
+}
+
+TimingWheel::Link *TimingWheel::detach(int slot)
+{
+    BSLS_ASSERT_SAFE(0 <= slot && slot < k_NUM_LEVELS * k_NUM_SLOTS);
+
+    Link *const head = d_slots_p + slot;
+    if (head == head->nextLink()) {
+        return 0;                                                     // RETURN
+    }
+
+    Link *const first = head->nextLink();
+    head->previousLink()->setNextLink(0);
+    first->setPreviousLink(0);
+
+    head->setNextLink(head);
+    head->setPreviousLink(head);
+    d_occupied[slot >> k_SLOT_BITS] &=
+                             ~(bsls::Types::Uint64(1) << (slot & k_SLOT_MASK));
+
+    return first;
+}
+
+// CREATORS
+TimingWheel::TimingWheel(bsls::Types::Int64  resolution,
+                         bsls::Types::Int64  startTime,
+                         bslma::Allocator   *basicAllocator)
+: d_slots_p(0)
+, d_currentTick(0)
+, d_startTime(startTime)
+, d_resolution(resolution)
+, d_numTimers(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_SAFE(0 < resolution);
+
+    d_slots_p = static_cast<Link *>(d_allocator_p->allocate(
+                                k_NUM_LEVELS * k_NUM_SLOTS * sizeof(Link)));
+
+    for (int slot = 0; slot < k_NUM_LEVELS * k_NUM_SLOTS; ++slot) {
+        d_slots_p[slot].setNextLink(d_slots_p + slot);
+        d_slots_p[slot].setPreviousLink(d_slots_p + slot);
+    }
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        d_occupied[level] = 0;
+    }
+}
+
+TimingWheel::~TimingWheel()
+{
+    cancelAll();
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+void TimingWheel::cancelAll()
+{
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        while (d_occupied[level]) {
+            const int index = lowestBit(d_occupied[level]);
+
+            Link *link = detach(level * k_NUM_SLOTS + index);
+            while (link) {
+                TimingWheelTimer *timer =
+                                       static_cast<TimingWheelTimer *>(link);
+                link = link->nextLink();
+
+                timer->reset();
+                timer->d_slot = -1;
+            }
+        }
+    }
+    d_numTimers = 0;
+}
+
+TimingWheelTimer *TimingWheel::expire()
+{
+    return expire(bsls::TimeUtil::getTimer());
+}
+
+TimingWheelTimer *TimingWheel::expire(bsls::Types::Int64 now)
+{
+    if (now < d_startTime) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 lastTick = (now - d_startTime) / d_resolution;
+
+    TimingWheelTimer *first = 0;  // first timer expired
+    Link             *last  = 0;  // last timer expired
+
+    // Visit only the ticks in which a slot is cascaded or expired; no timer
+    // can be placed in a tick between two of them.
+
+    while (d_numTimers) {
+        const bsls::Types::Int64 tick = nextBusyTick();
+        if (lastTick < tick) {
+            break;
+        }
+
+        d_currentTick = tick;
+
+        const int index = static_cast<int>(tick) & k_SLOT_MASK;
+        if (0 == index) {
+            cascade();
+        }
+
+        Link *link = detach(index);
+        if (link) {
+            if (last) {
+                last->setNextLink(link);
+                link->setPreviousLink(last);
+            }
+            else {
+                first = static_cast<TimingWheelTimer *>(link);
+            }
+            for (; link; link = link->nextLink()) {
+                static_cast<TimingWheelTimer *>(link)->d_slot = -1;
+                --d_numTimers;
+                last = link;
+            }
+        }
+
+        d_currentTick = tick + 1;
+    }
+
+    if (d_currentTick <= lastTick) {
+        d_currentTick = lastTick + 1;
+    }
+
+    return first;
+}
+
+// ACCESSORS
+bsls::Types::Int64 TimingWheel::nextBusyTick() const
+{
+    BSLS_ASSERT_SAFE(0 < d_numTimers);
+
+    // For each level, find the first tick, not before the current tick, at
+    // which the span of an occupied slot of that level begins.
+
+    bsls::Types::Int64 result = -1;
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        const bsls::Types::Uint64 occupied = d_occupied[level];
+        if (0 == occupied) {
+            continue;
+        }
+
+        const int                shift = k_SLOT_BITS * level;
+        const bsls::Types::Int64 span  = bsls::Types::Int64(1) << shift;
+        const bsls::Types::Int64 begin = ((d_currentTick + span - 1) >> shift)
+                                                                     << shift;
+        const int                index = static_cast<int>(begin >> shift)
+                                       & k_SLOT_MASK;
+
+        const bsls::Types::Uint64 rotated = 0 == index
+                                          ? occupied
+                                          : occupied >> index
+                                          | occupied << (k_NUM_SLOTS - index);
+
+        const bsls::Types::Int64 tick =
+                     begin + (bsls::Types::Int64(lowestBit(rotated)) << shift);
+
+        if (result < 0 || tick < result) {
+            result = tick;
+        }
+    }
+
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,629 @@
+// bslstl_timingwheel.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_TIMINGWHEEL
+#define INCLUDED_BSLSTL_TIMINGWHEEL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hierarchical timing wheel of intrusive timers.
+//
+//@CLASSES:
+//  bslstl::TimingWheel: hierarchical timing wheel scheduling timers
+//  bslstl::TimingWheelTimer: intrusive timer scheduled in a timing wheel
+//
+//@SEE_ALSO: bslalg_bidirectionallink, bsls_timeutil,
+//           bslstl_addressablepriorityqueue
+//
+//@DESCRIPTION: This component provides a mechanism, 'bslstl::TimingWheel',
+// that schedules timers, each of which expires at a deadline, and an
+// intrusive timer, 'bslstl::TimingWheelTimer', that a client embeds in (or
+// derives from) the object to be notified when the timer expires, such as a
+// session awaiting a heartbeat or an order awaiting its timeout.  Scheduling
+// and cancelling a timer take constant time, and neither allocates memory:
+// a timer is a 'bslalg::BidirectionalLink', linked into a list held by the
+// wheel.  The timers that are due are removed from the wheel in a batch by
+// 'expire', which returns them as a list:
+//..
+//  for (bslstl::TimingWheelTimer *timer = wheel.expire(now); timer; ) {
+//      bslstl::TimingWheelTimer *next = timer->nextTimer();
+//      // ... handle 'timer', which may be scheduled again ...
+//      timer = next;
+//  }
+//..
+// A timing wheel is preferable to a priority queue (e.g., a 'priority_queue',
+// or an 'addressable_priority_queue' supporting cancellation) or a 'multimap'
+// when many timers are scheduled, most of which are cancelled or rescheduled
+// before they expire, and expiry need only be accurate to a fixed resolution.
+//
+///Time and Resolution
+///-------------------
+// Times (deadlines, and the times passed to 'expire') are expressed in
+// nanoseconds, on the scale of 'bsls::TimeUtil::getTimer', which is used by
+// the overload of 'expire' taking no arguments.  A wheel divides time, from
+// the start time supplied at construction, into *ticks* of the resolution
+// supplied at construction, and expires timers a tick at a time: a timer
+// having deadline 'd' expires in the tick that ends at 'd', or at the first
+// tick boundary after it, so that it is never returned by 'expire' before
+// its deadline, and is returned by the first call to 'expire' whose time is at
+// least its deadline rounded up to a tick boundary.  A timer whose deadline
+// is in a tick that has already expired is returned by the first call to
+// 'expire' that expires another tick.  The timers returned by a call to
+// 'expire' are in the order of the ticks in which they expire, and in an
+// unspecified order within a tick.
+//
+///Structure
+///---------
+// A wheel holds its timers in 6 levels of 64 slots each, every slot being a
+// circular list of timers.  The 64 slots of level 0 hold the timers expiring
+// in each of the next 64 ticks; each slot of level 1 holds the timers expiring
+// in a span of 64 ticks, each slot of level 2 a span of 64 * 64 ticks, and so
+// on.  As the wheel turns past the end of the span of a slot of a higher
+// level, the timers in the next slot of that level are *cascaded*: moved to
+// the slots of the lower levels in which they now belong.  A timer is
+// therefore moved at most 5 times before it expires, and a timer that is
+// cancelled or rescheduled before its deadline (which is typical of
+// heartbeats and timeouts) is usually never moved.  A timer whose deadline is
+// more than 64 ** 6 (about 6.9e10) ticks ahead is held in the last slot of the
+// highest level until it is within that span.
+//
+// The occupied slots of each level are recorded in a 64-bit mask, so that
+// 'expire' skips directly to the next tick in which a slot is expired or
+// cascaded, however many ticks pass without a timer expiring.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on a wheel
+// holding 'n' timers:
+//..
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | TimingWheel w(resolution, startTime, allocator)    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | w.~TimingWheel(), w.cancelAll()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | w.schedule(timer, deadline), w.cancel(timer)       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | w.expire(now)                                      | O[k + s], for 'k'  |
+//  |                                                    | timers expired or  |
+//  |                                                    | cascaded, from 's' |
+//  |                                                    | slots              |
+//  +----------------------------------------------------+--------------------+
+//  | w.numTimers(), w.resolution(), w.startTime(),      | O[1]               |
+//  | w.allocator()                                      |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Memory Allocation
+///-----------------
+// A wheel obtains the heads of its 6 * 64 lists from the allocator supplied
+// at construction (or the default allocator), and allocates no other memory:
+// the timers are supplied, and owned, by the client.  Timers and the wheel
+// are not copyable.
+//
+///Thread Safety
+///-------------
+// 'bslstl::TimingWheel' is not thread-safe: a wheel, and the timers scheduled
+// in it, must not be used concurrently by different threads without external
+// synchronization.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting Missed Heartbeats
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a gateway disconnects each session from which no message has
+// been received for 30 seconds.  Messages arrive far more often than that, so
+// that the timer of a session is almost always rescheduled, rather than
+// expired.
+//
+// First, we define a session, which is the timer of its heartbeat, expiring
+// when the session has been silent for too long:
+//..
+//  struct Session : bslstl::TimingWheelTimer {
+//      int  d_id;         // identifies the session
+//      bool d_connected;  // 'false' once disconnected
+//  };
+//
+//  const bsls::Types::Int64 k_MILLISECOND = 1000 * 1000;  // in nanoseconds
+//  const bsls::Types::Int64 k_TIMEOUT     = 30 * 1000 * k_MILLISECOND;
+//..
+// Then, we create three sessions, and a wheel having a resolution of 10
+// milliseconds, starting at a time we choose, in which we schedule the
+// heartbeat of each session.  Note that the wheel is created after the
+// sessions, so that it is destroyed, cancelling the timers it holds, before
+// they are:
+//..
+//  Session sessions[3];
+//
+//  const bsls::Types::Int64 startTime = 0;
+//
+//  bslma::TestAllocator ta;
+//  bslstl::TimingWheel  wheel(10 * k_MILLISECOND, startTime, &ta);
+//
+//  for (int i = 0; i < 3; ++i) {
+//      sessions[i].d_id        = i;
+//      sessions[i].d_connected = true;
+//      wheel.schedule(&sessions[i], startTime + k_TIMEOUT);
+//  }
+//  assert(3 == wheel.numTimers());
+//..
+// Next, messages arrive on sessions 0 and 2 after 20 seconds, each of which
+// reschedules the heartbeat of its session, and session 1 is closed by its
+// peer, so that its heartbeat is cancelled:
+//..
+//  bsls::Types::Int64 now = startTime + 20 * 1000 * k_MILLISECOND;
+//
+//  wheel.schedule(&sessions[0], now + k_TIMEOUT);
+//  wheel.schedule(&sessions[2], now + k_TIMEOUT);
+//
+//  assert(0 == wheel.cancel(&sessions[1]));
+//  sessions[1].d_connected = false;
+//
+//  assert(2 == wheel.numTimers());
+//  assert(0 == wheel.expire(now));
+//..
+// Then, no message arrives on session 2 for the next 30 seconds, while
+// session 0 keeps receiving them:
+//..
+//  now += 15 * 1000 * k_MILLISECOND;
+//  wheel.schedule(&sessions[0], now + k_TIMEOUT);
+//  assert(0 == wheel.expire(now));
+//
+//  now += 15 * 1000 * k_MILLISECOND;
+//..
+// Finally, we expire the heartbeats that are due, and disconnect their
+// sessions:
+//..
+//  int numDisconnected = 0;
+//  for (bslstl::TimingWheelTimer *timer = wheel.expire(now); timer; ) {
+//      bslstl::TimingWheelTimer *next = timer->nextTimer();
+//
+//      Session *session = static_cast<Session *>(timer);
+//      assert(false == session->isScheduled());
+//      session->d_connected = false;
+//      ++numDisconnected;
+//
+//      timer = next;
+//  }
+//  assert(1     == numDisconnected);
+//  assert(false == sessions[2].d_connected);
+//  assert(true  == sessions[0].d_connected);
+//  assert(1     == wheel.numTimers());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
+#include <bslalg_bidirectionallink.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALLINKLISTUTIL
+#include <bslalg_bidirectionallinklistutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ======================
+                          // class TimingWheelTimer
+                          // ======================
+
+class TimingWheelTimer : public bslalg::BidirectionalLink {
+    // This class provides a timer that can be scheduled in a 'TimingWheel',
+    // and is embedded in, or is a base class of, the object it notifies.  A
+    // scheduled timer is linked into a list held by its wheel; an expired
+    // timer is linked into the list returned by 'TimingWheel::expire'.
+
+    // DATA
+    bsls::Types::Int64 d_deadline;  // time at which the timer expires
+
+    bsls::Types::Int64 d_tick;      // tick in which the timer expires
+
+    int                d_slot;      // index of the slot of the wheel holding
+                                    // the timer, or -1 if not scheduled
+
+    // FRIENDS
+    friend class TimingWheel;
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheelTimer(const TimingWheelTimer&);             // = delete
+    TimingWheelTimer& operator=(const TimingWheelTimer&);  // = delete
+
+  public:
+    // CREATORS
+    TimingWheelTimer();
+        // Create a timer that is not scheduled.
+
+    ~TimingWheelTimer();
+        // Destroy this timer.  The behavior is undefined if this timer is
+        // scheduled.
+
+    // ACCESSORS
+    bsls::Types::Int64 deadline() const;
+        // Return the deadline with which this timer was last scheduled, or 0
+        // if it has never been scheduled.
+
+    bool isScheduled() const;
+        // Return 'true' if this timer is scheduled in a wheel, and 'false'
+        // otherwise.  Note that a timer is not scheduled once it has been
+        // cancelled or has expired.
+
+    TimingWheelTimer *nextTimer() const;
+        // Return the address of the timer following this one in the list
+        // returned by 'TimingWheel::expire', or 0 if this timer is the last.
+        // The behavior is undefined unless this timer is in such a list, and
+        // has not been scheduled since.
+};
+
+                            // =================
+                            // class TimingWheel
+                            // =================
+
+class TimingWheel {
+    // This mechanism schedules 'TimingWheelTimer' objects in a hierarchical
+    // timing wheel, and expires them, a tick of a fixed resolution at a time,
+    // as time passes.  See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef bslalg::BidirectionalLink Link;
+
+    enum {
+        k_SLOT_BITS  = 6,                     // log2 of 'k_NUM_SLOTS'
+
+        k_NUM_SLOTS  = 1 << k_SLOT_BITS,      // number of slots of a level
+
+        k_SLOT_MASK  = k_NUM_SLOTS - 1,       // mask of a slot index
+
+        k_NUM_LEVELS = 6                      // number of levels
+    };
+
+    // DATA
+    Link               *d_slots_p;      // heads of the circular lists of
+                                        // timers, 'k_NUM_SLOTS' for each
+                                        // level, in order of level
+
+    bsls::Types::Uint64 d_occupied[k_NUM_LEVELS];
+                                        // bit 's' of element 'l' is set if
+                                        // and only if slot 's' of level 'l'
+                                        // holds a timer
+
+    bsls::Types::Int64  d_currentTick;  // first tick not yet expired
+
+    bsls::Types::Int64  d_startTime;    // time at which tick 0 ends
+
+    bsls::Types::Int64  d_resolution;   // length of a tick
+
+    std::size_t         d_numTimers;    // number of timers scheduled
+
+    bslma::Allocator   *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheel(const TimingWheel&);             // = delete
+    TimingWheel& operator=(const TimingWheel&);  // = delete
+
+    // PRIVATE MANIPULATORS
+    void cascade();
+        // Move the timers held by each slot of a level above 0 whose span
+        // begins at 'd_currentTick' to the slots in which they now belong.
+        // The behavior is undefined unless 'd_currentTick' is a multiple of
+        // 'k_NUM_SLOTS'.
+
+    Link *detach(int slot);
+        // Unlink the timers held by the specified 'slot' from it, and return
+        // the address of the first of them, linked in a list through their
+        // 'nextLink' attributes and terminated by 0, or 0 if 'slot' is empty.
+        // Note that the timers remain marked as held by 'slot'.
+
+    void insert(TimingWheelTimer *timer);
+        // Link the specified 'timer', which expires in the tick
+        // 'timer->d_tick', into the slot in which it belongs.  The behavior
+        // is undefined unless 'd_currentTick <= timer->d_tick'.
+
+    // PRIVATE ACCESSORS
+    bsls::Types::Int64 nextBusyTick() const;
+        // Return the first tick, not before 'd_currentTick', in which the
+        // span of an occupied slot begins, so that the slot is expired (for
+        // level 0) or cascaded (for the higher levels).  The behavior is
+        // undefined unless this wheel holds a timer.
+
+    bsls::Types::Int64 tickOf(bsls::Types::Int64 deadline) const;
+        // Return the tick in which a timer having the specified 'deadline'
+        // expires, if that tick has not already expired, and
+        // 'd_currentTick' otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimingWheel, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    TimingWheel(bsls::Types::Int64  resolution,
+                bsls::Types::Int64  startTime,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a wheel, holding no timers, that expires timers in ticks of
+        // the specified 'resolution', in nanoseconds, beginning at the
+        // specified 'startTime', in nanoseconds on the scale of
+        // 'bsls::TimeUtil::getTimer' (see {Time and Resolution}).  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < resolution'.
+
+    ~TimingWheel();
+        // Destroy this object, first cancelling the timers it holds.
+
+    // MANIPULATORS
+    int cancel(TimingWheelTimer *timer);
+        // Cancel the specified 'timer' if it is scheduled.  Return 0 if
+        // 'timer' was scheduled, and a non-zero value (with no effect)
+        // otherwise.  The behavior is undefined if 'timer' is scheduled in
+        // another wheel.
+
+    void cancelAll();
+        // Cancel every timer scheduled in this wheel.
+
+    TimingWheelTimer *expire();
+        // Expire the timers due at the current time, as returned by
+        // 'bsls::TimeUtil::getTimer', and return the address of the first of
+        // them, linked in a list through 'TimingWheelTimer::nextTimer', or 0
+        // if no timer is due.  See 'expire(bsls::Types::Int64 now)'.
+
+    TimingWheelTimer *expire(bsls::Types::Int64 now);
+        // Expire the timers due at the specified time 'now', in nanoseconds,
+        // and return the address of the first of them, linked in a list
+        // through 'TimingWheelTimer::nextTimer', or 0 if no timer is due.  The
+        // returned timers are no longer scheduled, and are returned in the
+        // order of the ticks in which they expire (see {Time and
+        // Resolution}).  Note that a returned timer may be scheduled again (in
+        // this or another wheel), but its 'nextTimer' is then no longer
+        // valid, so that the next timer of the list should be obtained first.
+        // Also note that, if 'now' is earlier than a time previously passed
+        // to 'expire', no timer is expired.
+
+    void schedule(TimingWheelTimer *timer, bsls::Types::Int64 deadline);
+        // Schedule the specified 'timer' to expire at the specified
+        // 'deadline', in nanoseconds, first cancelling 'timer' if it is
+        // scheduled.  The behavior is undefined if 'timer' is scheduled in
+        // another wheel.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the address of the allocator used by this object to supply
+        // memory.
+
+    std::size_t numTimers() const;
+        // Return the number of timers scheduled in this wheel.
+
+    bsls::Types::Int64 resolution() const;
+        // Return the length, in nanoseconds, of the ticks in which this wheel
+        // expires timers.
+
+    bsls::Types::Int64 startTime() const;
+        // Return the start time, in nanoseconds, supplied at construction.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // class TimingWheelTimer
+                          // ----------------------
+
+// CREATORS
+inline
+TimingWheelTimer::TimingWheelTimer()
+: d_deadline(0)
+, d_tick(0)
+, d_slot(-1)
+{
+    reset();
+}
+
+inline
+TimingWheelTimer::~TimingWheelTimer()
+{
+    BSLS_ASSERT_SAFE(!isScheduled());
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 TimingWheelTimer::deadline() const
+{
+    return d_deadline;
+}
+
+inline
+bool TimingWheelTimer::isScheduled() const
+{
+    return 0 <= d_slot;
+}
+
+inline
+TimingWheelTimer *TimingWheelTimer::nextTimer() const
+{
+    BSLS_ASSERT_SAFE(!isScheduled());
+
+    return static_cast<TimingWheelTimer *>(nextLink());
+}
+
+                            // -----------------
+                            // class TimingWheel
+                            // -----------------
+
+// PRIVATE MANIPULATORS
+inline
+void TimingWheel::insert(TimingWheelTimer *timer)
+{
+    BSLS_ASSERT_SAFE(d_currentTick <= timer->d_tick);
+
+    // Select the lowest level whose slots, together, span the distance to the
+    // tick of 'timer'.  A timer beyond the span of the highest level is placed
+    // as if it expired in the last tick of that span.
+
+    const bsls::Types::Int64 distance = timer->d_tick - d_currentTick;
+
+    bsls::Types::Int64 tick  = timer->d_tick;
+    int                level = 0;
+    while (distance >> (k_SLOT_BITS * (level + 1))) {
+        if (k_NUM_LEVELS - 1 == level) {
+            tick = d_currentTick
+                 + ((bsls::Types::Int64(1) << (k_SLOT_BITS * k_NUM_LEVELS))
+                                                                         - 1);
+            break;
+        }
+        ++level;
+    }
+
+    const int index = static_cast<int>(tick >> (k_SLOT_BITS * level))
+                    & k_SLOT_MASK;
+    const int slot  = level * k_NUM_SLOTS + index;
+
+    bslalg::BidirectionalLinkListUtil::insertLinkBeforeTarget(
+                                                            timer,
+                                                            d_slots_p + slot);
+    d_occupied[level] |= bsls::Types::Uint64(1) << index;
+    timer->d_slot      = slot;
+}
+
+// PRIVATE ACCESSORS
+inline
+bsls::Types::Int64 TimingWheel::tickOf(bsls::Types::Int64 deadline) const
+{
+    if (deadline <= d_startTime) {
+        return d_currentTick;                                         // RETURN
+    }
+
+    // Round up, without risking overflow.
+
+    const bsls::Types::Int64 elapsed = deadline - d_startTime;
+    const bsls::Types::Int64 tick    = elapsed / d_resolution
+                                     + (0 != elapsed % d_resolution);
+
+    return tick < d_currentTick ? d_currentTick : tick;
+}
+
+// MANIPULATORS
+inline
+int TimingWheel::cancel(TimingWheelTimer *timer)
+{
+    BSLS_ASSERT_SAFE(timer);
+
+    if (!timer->isScheduled()) {
+        return -1;                                                    // RETURN
+    }
+
+    const int   slot = timer->d_slot;
+    Link *const head = d_slots_p + slot;
+
+    BSLS_ASSERT_SAFE(0 <= slot && slot < k_NUM_LEVELS * k_NUM_SLOTS);
+
+    bslalg::BidirectionalLinkListUtil::unlink(timer);
+    timer->reset();
+    timer->d_slot = -1;
+    --d_numTimers;
+
+    if (head == head->nextLink()) {
+        d_occupied[slot >> k_SLOT_BITS] &=
+                             ~(bsls::Types::Uint64(1) << (slot & k_SLOT_MASK));
+    }
+    return 0;
+}
+
+inline
+void TimingWheel::schedule(TimingWheelTimer   *timer,
+                           bsls::Types::Int64  deadline)
+{
+    BSLS_ASSERT_SAFE(timer);
+
+    cancel(timer);
+
+    timer->d_deadline = deadline;
+    timer->d_tick     = tickOf(deadline);
+    insert(timer);
+    ++d_numTimers;
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *TimingWheel::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+std::size_t TimingWheel::numTimers() const
+{
+    return d_numTimers;
+}
+
+inline
+bsls::Types::Int64 TimingWheel::resolution() const
+{
+    return d_resolution;
+}
+
+inline
+bsls::Types::Int64 TimingWheel::startTime() const
+{
+    return d_startTime;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
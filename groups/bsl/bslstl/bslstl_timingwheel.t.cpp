@@ -0,0 +1,1142 @@
+// bslstl_timingwheel.t.cpp                                           -*-C++-*-
+#include <bslstl_timingwheel.h>
+
+#include <bslstl_addressablepriorityqueue.h>
+#include <bslstl_multimap.h>
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_newdeleteallocator.h>      // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bsls_asserttest.h>               // for testing only
+#include <bsls_bsltestutil.h>              // for testing only
+#include <bsls_stopwatch.h>                // for testing only
+#include <bsls_timeutil.h>                 // for testing only
+#include <bsls_types.h>                    // for testing only
+
+#include <functional>  // 'greater'
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::TimingWheel' is a mechanism whose observable behavior is the list
+// of timers returned by each call to 'expire', the scheduling state of its
+// timers, and its use of memory.  It is tested against a straightforward
+// model, recording for each of an array of timers whether it is scheduled and
+// the tick in which it is due to expire, under pseudo-random sequences of
+// 'schedule', 'cancel', and 'expire' whose deadlines and times span from a
+// fraction of a tick to well beyond the span of the highest level of the
+// wheel, for several resolutions and start times.  Every list returned by
+// 'expire' is verified to be well formed, and to hold exactly the timers due,
+// in the order of their ticks.
+//-----------------------------------------------------------------------------
+// bslstl::TimingWheelTimer
+// ------------------------
+// CREATORS
+// [ 2] TimingWheelTimer();
+// [ 2] ~TimingWheelTimer();
+//
+// ACCESSORS
+// [ 2] bsls::Types::Int64 deadline() const;
+// [ 2] bool isScheduled() const;
+// [ 3] TimingWheelTimer *nextTimer() const;
+//
+// bslstl::TimingWheel
+// -------------------
+// CREATORS
+// [ 2] TimingWheel(Int64 resolution, Int64 startTime, Allocator *ba = 0);
+// [ 2] ~TimingWheel();
+//
+// MANIPULATORS
+// [ 3] int cancel(TimingWheelTimer *timer);
+// [ 4] void cancelAll();
+// [ 4] TimingWheelTimer *expire();
+// [ 3] TimingWheelTimer *expire(bsls::Types::Int64 now);
+// [ 3] void schedule(TimingWheelTimer *timer, bsls::Types::Int64 deadline);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 3] std::size_t numTimers() const;
+// [ 2] bsls::Types::Int64 resolution() const;
+// [ 2] bsls::Types::Int64 startTime() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: HEARTBEATS OF MANY SESSIONS
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslstl::TimingWheel      Obj;
+typedef bslstl::TimingWheelTimer Timer;
+typedef bsls::Types::Int64       Int64;
+
+const Int64 k_MAX_SPAN = Int64(1) << 36;
+    // number of ticks spanned by the slots of all the levels of a wheel
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+Int64 nextRandom(bsls::Types::Uint64 *seed)
+    // Return a pseudo-random non-negative number of 62 bits, advancing the
+    // specified 'seed'.
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<Int64>(*seed >> 2);
+}
+
+                            // ================
+                            // class WheelModel
+                            // ================
+
+class WheelModel {
+    // This class provides a model of a 'TimingWheel' scheduling the timers of
+    // an array, recording, for each, whether it is scheduled and the tick in
+    // which it is due to expire.
+
+    // DATA
+    Int64         d_resolution;    // length of a tick
+    Int64         d_startTime;     // end of tick 0
+    Int64         d_currentTick;   // first tick not yet expired
+    const Timer  *d_timers_p;      // array of timers
+    int           d_numTimers;     // length of 'd_timers_p'
+    bool         *d_isScheduled;   // whether each timer is scheduled
+    Int64        *d_ticks;         // tick of each scheduled timer
+
+  private:
+    // NOT IMPLEMENTED
+    WheelModel(const WheelModel&);
+    WheelModel& operator=(const WheelModel&);
+
+  public:
+    // CREATORS
+    WheelModel(Int64        resolution,
+               Int64        startTime,
+               const Timer *timers,
+               int          numTimers)
+        // Create a model of a wheel having the specified 'resolution' and
+        // 'startTime', none of the specified 'numTimers' timers at the
+        // specified 'timers' being scheduled.
+    : d_resolution(resolution)
+    , d_startTime(startTime)
+    , d_currentTick(0)
+    , d_timers_p(timers)
+    , d_numTimers(numTimers)
+    , d_isScheduled(new bool[numTimers])
+    , d_ticks(new Int64[numTimers])
+    {
+        for (int i = 0; i < numTimers; ++i) {
+            d_isScheduled[i] = false;
+            d_ticks[i]       = 0;
+        }
+    }
+
+    ~WheelModel()
+        // Destroy this object.
+    {
+        delete [] d_isScheduled;
+        delete [] d_ticks;
+    }
+
+    // MANIPULATORS
+    void cancel(int index)
+        // Record that the timer having the specified 'index' is not
+        // scheduled.
+    {
+        d_isScheduled[index] = false;
+    }
+
+    void expire(Int64 now)
+        // Record that the timers due at the specified time 'now' expired.
+    {
+        if (now < d_startTime) {
+            return;                                                   // RETURN
+        }
+        const Int64 lastTick = (now - d_startTime) / d_resolution;
+        for (int i = 0; i < d_numTimers; ++i) {
+            if (d_isScheduled[i] && d_ticks[i] <= lastTick) {
+                d_isScheduled[i] = false;
+            }
+        }
+        if (d_currentTick <= lastTick) {
+            d_currentTick = lastTick + 1;
+        }
+    }
+
+    void schedule(int index, Int64 deadline)
+        // Record that the timer having the specified 'index' is scheduled
+        // with the specified 'deadline'.
+    {
+        Int64 tick = 0;
+        if (deadline > d_startTime) {
+            const Int64 elapsed = deadline - d_startTime;
+            tick = elapsed / d_resolution + (0 != elapsed % d_resolution);
+        }
+        d_isScheduled[index] = true;
+        d_ticks[index]       = tick < d_currentTick ? d_currentTick : tick;
+    }
+
+    // ACCESSORS
+    int indexOf(const Timer *timer) const
+        // Return the index of the specified 'timer' in the array of timers
+        // of this model, or -1 if it is not an element of that array.
+    {
+        return d_timers_p <= timer && timer < d_timers_p + d_numTimers
+               ? static_cast<int>(timer - d_timers_p)
+               : -1;
+    }
+
+    bool isDue(int index, Int64 now) const
+        // Return 'true' if the timer having the specified 'index' is
+        // scheduled, and due to expire at the specified time 'now', and
+        // 'false' otherwise.
+    {
+        return d_isScheduled[index]
+            && now >= d_startTime
+            && d_ticks[index] <= (now - d_startTime) / d_resolution;
+    }
+
+    bool isScheduled(int index) const
+        // Return 'true' if the timer having the specified 'index' is
+        // scheduled, and 'false' otherwise.
+    {
+        return d_isScheduled[index];
+    }
+
+    int numDue(Int64 now) const
+        // Return the number of timers due to expire at the specified time
+        // 'now'.
+    {
+        int result = 0;
+        for (int i = 0; i < d_numTimers; ++i) {
+            result += isDue(i, now);
+        }
+        return result;
+    }
+
+    int numScheduled() const
+        // Return the number of timers scheduled.
+    {
+        int result = 0;
+        for (int i = 0; i < d_numTimers; ++i) {
+            result += d_isScheduled[i];
+        }
+        return result;
+    }
+
+    Int64 tick(int index) const
+        // Return the tick in which the timer having the specified 'index' is
+        // due to expire.  The behavior is undefined unless that timer is
+        // scheduled.
+    {
+        return d_ticks[index];
+    }
+};
+
+static
+bool verifyExpiry(const WheelModel& model, Timer *first, Int64 now, int line)
+    // Return 'true' if the list of timers beginning at the specified 'first',
+    // returned by 'expire' for the specified time 'now', is well formed, and
+    // holds exactly the timers that the specified 'model' records as due at
+    // 'now', in the order of their ticks, none of which is scheduled, and
+    // 'false' otherwise, reporting a discrepancy with the specified 'line'.
+{
+    int   numFound = 0;
+    Int64 lastTick = -1;
+
+    const bslalg::BidirectionalLink *previous = 0;
+    for (Timer *timer = first; timer; timer = timer->nextTimer()) {
+        const int index = model.indexOf(timer);
+        if (index < 0
+         || !model.isDue(index, now)
+         || previous != timer->previousLink()
+         || timer->isScheduled()
+         || model.tick(index) < lastTick) {
+            ASSERTV(line, index, now, false);
+            return false;                                             // RETURN
+        }
+        lastTick = model.tick(index);
+        previous = timer;
+        ++numFound;
+    }
+
+    // As each timer found is due, and they are in the order of their ticks,
+    // finding as many timers as are due means that each was found once.
+
+    ASSERTV(line, now, numFound, model.numDue(now),
+            numFound == model.numDue(now));
+    return numFound == model.numDue(now);
+}
+
+                        // ========================
+                        // Heartbeat Benchmark Aids
+                        // ========================
+
+const Int64 k_MILLISECOND = 1000 * 1000;             // in nanoseconds
+const Int64 k_TIMEOUT     = 30 * 1000 * k_MILLISECOND;
+                                                     // silence after which a
+                                                     // session expires
+
+static
+Int64 benchmarkTime(int op, int numSessions)
+    // Return the simulated time, in nanoseconds, at which the specified 'op'
+    // is performed on the specified 'numSessions' sessions, such that a
+    // session receives a message every 60 seconds on average.
+{
+    return static_cast<Int64>(op) * 60 * 1000 / numSessions * k_MILLISECOND;
+}
+
+static
+double runWheel(int numSessions, int numOps, Int64 *checksum)
+    // Report the time, in seconds, taken by the specified 'numOps' messages
+    // received by pseudo-random sessions of the specified 'numSessions',
+    // each of which reschedules the heartbeat of its session, the heartbeats
+    // being held in a 'TimingWheel' that is expired whenever the time
+    // changes, reconnecting (and rescheduling) each session that expires, and
+    // add to the specified 'checksum' the identifiers of the sessions
+    // expired.
+{
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    Timer *timers = new Timer[numSessions];
+
+    bsls::Types::Uint64 seed = 1;
+    bsls::Stopwatch     timer;
+    {
+        Obj wheel(k_MILLISECOND, 0, allocator);
+
+        for (int i = 0; i < numSessions; ++i) {
+            wheel.schedule(timers + i,
+                           k_TIMEOUT + nextRandom(&seed) % 1000
+                                                             * k_MILLISECOND);
+        }
+
+        Int64 now = 0;
+
+        timer.start();
+        for (int op = 0; op < numOps; ++op) {
+            const Int64 time = benchmarkTime(op, numSessions);
+            if (time != now) {
+                now = time;
+                for (Timer *t = wheel.expire(now); t; ) {
+                    Timer *next = t->nextTimer();
+                    *checksum += t - timers;
+                    wheel.schedule(t, now + k_TIMEOUT);
+                    t = next;
+                }
+            }
+            const int session = static_cast<int>(nextRandom(&seed)
+                                                 % numSessions);
+            wheel.schedule(timers + session,
+                           now + k_TIMEOUT + nextRandom(&seed) % 1000
+                                                             * k_MILLISECOND);
+        }
+        timer.stop();
+    }
+    delete [] timers;
+
+    return timer.elapsedTime();
+}
+
+static
+double runHeap(int numSessions, int numOps, Int64 *checksum)
+    // Report the time, in seconds, taken by the same operations as 'runWheel'
+    // for the specified 'numSessions' and 'numOps', the heartbeats being held
+    // in an 'addressable_priority_queue' whose earliest deadline is at its
+    // top, and add to the specified 'checksum' the identifiers of the
+    // sessions expired.
+{
+    typedef bsl::pair<Int64, int>                                  Deadline;
+    typedef bsl::addressable_priority_queue<Deadline,
+                                            std::greater<Deadline> > Queue;
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    Queue                           queue(allocator);
+    bsl::vector<Queue::handle_type> handles(allocator);
+
+    bsls::Types::Uint64 seed = 1;
+    for (int i = 0; i < numSessions; ++i) {
+        handles.push_back(queue.push(Deadline(
+                    k_TIMEOUT + nextRandom(&seed) % 1000 * k_MILLISECOND, i)));
+    }
+
+    Int64 now = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int op = 0; op < numOps; ++op) {
+        const Int64 time = benchmarkTime(op, numSessions);
+        if (time != now) {
+            now = time;
+            while (queue.top().first <= now) {
+                const int session = queue.top().second;
+                *checksum += session;
+                queue.update(queue.top_handle(),
+                             Deadline(now + k_TIMEOUT, session));
+            }
+        }
+        const int session = static_cast<int>(nextRandom(&seed)
+                                             % numSessions);
+        queue.update(handles[session],
+                     Deadline(now + k_TIMEOUT + nextRandom(&seed) % 1000
+                                                             * k_MILLISECOND,
+                              session));
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+static
+double runMultimap(int numSessions, int numOps, Int64 *checksum)
+    // Report the time, in seconds, taken by the same operations as 'runWheel'
+    // for the specified 'numSessions' and 'numOps', the heartbeats being held
+    // in a 'multimap' from deadline to session, and add to the specified
+    // 'checksum' the identifiers of the sessions expired.
+{
+    typedef bsl::multimap<Int64, int> Map;
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    Map                         deadlines(allocator);
+    bsl::vector<Map::iterator>  positions(allocator);
+
+    bsls::Types::Uint64 seed = 1;
+    for (int i = 0; i < numSessions; ++i) {
+        positions.push_back(deadlines.insert(Map::value_type(
+                    k_TIMEOUT + nextRandom(&seed) % 1000 * k_MILLISECOND, i)));
+    }
+
+    Int64 now = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int op = 0; op < numOps; ++op) {
+        const Int64 time = benchmarkTime(op, numSessions);
+        if (time != now) {
+            now = time;
+            while (deadlines.begin()->first <= now) {
+                const int session = deadlines.begin()->second;
+                *checksum += session;
+                deadlines.erase(deadlines.begin());
+                positions[session] = deadlines.insert(
+                                   Map::value_type(now + k_TIMEOUT, session));
+            }
+        }
+        const int session = static_cast<int>(nextRandom(&seed)
+                                             % numSessions);
+        deadlines.erase(positions[session]);
+        positions[session] = deadlines.insert(Map::value_type(
+                   now + k_TIMEOUT + nextRandom(&seed) % 1000 * k_MILLISECOND,
+                   session));
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting Missed Heartbeats
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a gateway disconnects each session from which no message has
+// been received for 30 seconds.  Messages arrive far more often than that, so
+// that the timer of a session is almost always rescheduled, rather than
+// expired.
+//
+// First, we define a session, which is the timer of its heartbeat, expiring
+// when the session has been silent for too long:
+//..
+    struct Session : bslstl::TimingWheelTimer {
+        int  d_id;         // identifies the session
+        bool d_connected;  // 'false' once disconnected
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        const bsls::Types::Int64 k_MILLISECOND = 1000 * 1000;
+                                                            // in nanoseconds
+        const bsls::Types::Int64 k_TIMEOUT     = 30 * 1000 * k_MILLISECOND;
+
+// Then, we create three sessions, and a wheel having a resolution of 10
+// milliseconds, starting at a time we choose, in which we schedule the
+// heartbeat of each session.  Note that the wheel is created after the
+// sessions, so that it is destroyed, cancelling the timers it holds, before
+// they are:
+//..
+    Session sessions[3];
+
+    const bsls::Types::Int64 startTime = 0;
+
+    bslma::TestAllocator ta;
+    bslstl::TimingWheel  wheel(10 * k_MILLISECOND, startTime, &ta);
+
+    for (int i = 0; i < 3; ++i) {
+        sessions[i].d_id        = i;
+        sessions[i].d_connected = true;
+        wheel.schedule(&sessions[i], startTime + k_TIMEOUT);
+    }
+    ASSERT(3 == wheel.numTimers());
+//..
+// Next, messages arrive on sessions 0 and 2 after 20 seconds, each of which
+// reschedules the heartbeat of its session, and session 1 is closed by its
+// peer, so that its heartbeat is cancelled:
+//..
+    bsls::Types::Int64 now = startTime + 20 * 1000 * k_MILLISECOND;
+
+    wheel.schedule(&sessions[0], now + k_TIMEOUT);
+    wheel.schedule(&sessions[2], now + k_TIMEOUT);
+
+    ASSERT(0 == wheel.cancel(&sessions[1]));
+    sessions[1].d_connected = false;
+
+    ASSERT(2 == wheel.numTimers());
+    ASSERT(0 == wheel.expire(now));
+//..
+// Then, no message arrives on session 2 for the next 30 seconds, while
+// session 0 keeps receiving them:
+//..
+    now += 15 * 1000 * k_MILLISECOND;
+    wheel.schedule(&sessions[0], now + k_TIMEOUT);
+    ASSERT(0 == wheel.expire(now));
+
+    now += 15 * 1000 * k_MILLISECOND;
+//..
+// Finally, we expire the heartbeats that are due, and disconnect their
+// sessions:
+//..
+    int numDisconnected = 0;
+    for (bslstl::TimingWheelTimer *timer = wheel.expire(now); timer; ) {
+        bslstl::TimingWheelTimer *next = timer->nextTimer();
+
+        Session *session = static_cast<Session *>(timer);
+        ASSERT(false == session->isScheduled());
+        session->d_connected = false;
+        ++numDisconnected;
+
+        timer = next;
+    }
+    ASSERT(1     == numDisconnected);
+    ASSERT(false == sessions[2].d_connected);
+    ASSERT(true  == sessions[0].d_connected);
+    ASSERT(1     == wheel.numTimers());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'cancelAll' AND 'expire()'
+        //
+        // Concerns:
+        //: 1 'cancelAll' cancels every timer, in every level, after which the
+        //:   wheel can be used as before.
+        //:
+        //: 2 'expire' without arguments expires the timers due at the time
+        //:   returned by 'bsls::TimeUtil::getTimer', and no others.
+        //
+        // Plan:
+        //: 1 Schedule timers whose deadlines are spread over every level of a
+        //:   wheel, cancel them all, and verify that none is scheduled, that
+        //:   'expire' returns no timer, and that the timers can be scheduled
+        //:   and expired again.  (C-1)
+        //:
+        //: 2 Create a wheel starting at the current time, schedule a timer
+        //:   whose deadline has passed and one due in an hour, and verify
+        //:   that 'expire' returns only the first.  (C-2)
+        //
+        // Testing:
+        //   void cancelAll();
+        //   TimingWheelTimer *expire();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'cancelAll' AND 'expire()'"
+                            "\n==================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting 'cancelAll'.\n");
+        {
+            enum { k_NUM_TIMERS = 40 };
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Timer timers[k_NUM_TIMERS];
+            Obj   mX(1, 0, &oa);  const Obj& X = mX;
+
+            for (int round = 0; round < 2; ++round) {
+                for (int i = 0; i < k_NUM_TIMERS; ++i) {
+                    mX.schedule(timers + i, Int64(1) << i);
+                }
+                ASSERTV(round, k_NUM_TIMERS == X.numTimers());
+
+                mX.cancelAll();
+                ASSERTV(round, 0 == X.numTimers());
+                for (int i = 0; i < k_NUM_TIMERS; ++i) {
+                    ASSERTV(round, i, false == timers[i].isScheduled());
+                    ASSERTV(round, i, 0 != mX.cancel(timers + i));
+                }
+                ASSERTV(round, 0 == mX.expire(Int64(1) << 50));
+            }
+
+            mX.schedule(timers, (Int64(1) << 50) + 2);
+            ASSERT(0      == mX.expire((Int64(1) << 50) + 1));
+            ASSERT(timers == mX.expire((Int64(1) << 50) + 2));
+            ASSERT(0      == X.numTimers());
+        }
+
+        if (verbose) printf("\tTesting 'expire()'.\n");
+        {
+            const Int64 START = bsls::TimeUtil::getTimer();
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Timer past;
+            Timer future;
+            Obj   mX(k_MILLISECOND, START, &oa);
+
+            mX.schedule(&past,   START - 1);
+            mX.schedule(&future, START + 3600 * 1000 * k_MILLISECOND);
+
+            Timer *first = mX.expire();
+            ASSERT(&past == first);
+            ASSERT(0     == first->nextTimer());
+            ASSERT(true  == future.isScheduled());
+            ASSERT(0     == mX.expire());
+            ASSERT(0     == mX.cancel(&future));
+        }
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'schedule', 'cancel', AND 'expire'
+        //
+        // Concerns:
+        //: 1 'expire' returns exactly the timers whose deadlines, rounded up
+        //:   to a tick boundary, are not after the time given, and the timers
+        //:   whose deadlines were in ticks already expired when they were
+        //:   scheduled, once the time given reaches a tick not yet expired.
+        //:
+        //: 2 The list returned by 'expire' is well formed, terminated by 0,
+        //:   and in the order of the ticks of its timers, which are no longer
+        //:   scheduled.
+        //:
+        //: 3 Timers whose deadlines are beyond the span of any level, or of
+        //:   every level, are cascaded correctly, however far time advances
+        //:   in a call to 'expire'.
+        //:
+        //: 4 'schedule' reschedules a scheduled timer, and 'cancel' cancels a
+        //:   scheduled timer, returning 0, and otherwise returns a non-zero
+        //:   value with no effect.
+        //:
+        //: 5 An expired timer can be scheduled again while the list returned
+        //:   by 'expire' is traversed.
+        //:
+        //: 6 Passing to 'expire' a time earlier than a previous one expires
+        //:   no timer.
+        //:
+        //: 7 No memory is allocated after construction.
+        //
+        // Plan:
+        //: 1 For several resolutions and start times, apply a pseudo-random
+        //:   sequence of 'schedule', 'cancel', and 'expire' to a wheel and to
+        //:   a model, with deadlines and advances of time drawn from scales
+        //:   ranging from a tick to beyond the span of the highest level,
+        //:   verifying each list returned by 'expire' against the model, and
+        //:   the state of every timer and the number of timers after each
+        //:   operation, and rescheduling half the timers of each list
+        //:   returned while traversing it.  (C-1..7)
+        //
+        // Testing:
+        //   int cancel(TimingWheelTimer *timer);
+        //   TimingWheelTimer *expire(bsls::Types::Int64 now);
+        //   void schedule(TimingWheelTimer *timer, bsls::Types::Int64 dl);
+        //   std::size_t numTimers() const;
+        //   TimingWheelTimer *nextTimer() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'schedule', 'cancel', AND 'expire'"
+                            "\n==========================================\n");
+
+        static const struct {
+            int   d_line;        // source line number
+            Int64 d_resolution;  // length of a tick
+            Int64 d_startTime;   // end of tick 0
+        } DATA[] = {
+            //LINE  RESOLUTION     START TIME
+            //----  -------------  ---------------
+            { L_,               1,               0 },
+            { L_,               1,           -1000 },
+            { L_,               7,              13 },
+            { L_,            1000,       123456789 },
+            { L_,         1000000, -50000000000LL },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        enum { k_NUM_TIMERS = 48, k_NUM_OPS = 4000 };
+
+        // Deadlines, and advances of time, are drawn from these numbers of
+        // ticks, from less than one tick to beyond the span of every level.
+
+        const Int64 SCALES[] = { 1, 64, 64 * 64, Int64(1) << 20,
+                                 Int64(1) << 30, k_MAX_SPAN * 4 };
+        const int   NUM_SCALES = static_cast<int>(sizeof  SCALES
+                                                / sizeof *SCALES);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE       = DATA[ti].d_line;
+            const Int64 RESOLUTION = DATA[ti].d_resolution;
+            const Int64 START      = DATA[ti].d_startTime;
+
+            if (veryVerbose) { T_ P_(LINE) P_(RESOLUTION) P(START) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Timer timers[k_NUM_TIMERS];
+            {
+                Obj        mX(RESOLUTION, START, &oa);  const Obj& X = mX;
+                WheelModel model(RESOLUTION, START, timers, k_NUM_TIMERS);
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                bsls::Types::Uint64 seed   = LINE;
+                Int64               now    = START - 3 * RESOLUTION;
+                int                 numDue = 0;
+
+                for (int op = 0; op < k_NUM_OPS; ++op) {
+                    const int   CHOICE = static_cast<int>(
+                                                     nextRandom(&seed) % 100);
+                    const int   INDEX  = static_cast<int>(
+                                            nextRandom(&seed) % k_NUM_TIMERS);
+                    const Int64 SCALE  = SCALES[nextRandom(&seed)
+                                                % NUM_SCALES] * RESOLUTION;
+                    const Int64 OFFSET = nextRandom(&seed) % SCALE
+                                       - (CHOICE % 4 ? 0 : SCALE / 4);
+
+                    if (CHOICE < 45) {
+                        mX.schedule(timers + INDEX, now + OFFSET);
+                        model.schedule(INDEX, now + OFFSET);
+                        ASSERTV(LINE, op,
+                                now + OFFSET == timers[INDEX].deadline());
+                    }
+                    else if (CHOICE < 60) {
+                        const int RC = mX.cancel(timers + INDEX);
+                        ASSERTV(LINE, op,
+                                model.isScheduled(INDEX) == (0 == RC));
+                        model.cancel(INDEX);
+                    }
+                    else {
+                        // Advance time, occasionally moving it back.
+
+                        now += OFFSET;
+
+                        Timer *first = mX.expire(now);
+                        ASSERTV(LINE, op,
+                                verifyExpiry(model, first, now, LINE));
+                        model.expire(now);
+
+                        for (Timer *timer = first; timer; ) {
+                            Timer *next = timer->nextTimer();
+                            ++numDue;
+
+                            const int index = model.indexOf(timer);
+                            if (index % 2) {
+                                const Int64 DEADLINE =
+                                      now + nextRandom(&seed) % (64 * SCALE);
+                                mX.schedule(timer, DEADLINE);
+                                model.schedule(index, DEADLINE);
+                            }
+                            timer = next;
+                        }
+                    }
+
+                    ASSERTV(LINE, op, model.numScheduled() ==
+                                          static_cast<int>(X.numTimers()));
+                    for (int i = 0; i < k_NUM_TIMERS; ++i) {
+                        ASSERTV(LINE, op, i, model.isScheduled(i) ==
+                                                     timers[i].isScheduled());
+                    }
+                }
+                ASSERTV(LINE, numDue, 100 < numDue);
+                ASSERTV(LINE, NUM_BLOCKS == oa.numBlocksTotal());
+
+                if (veryVerbose) { T_ T_ P_(numDue) P(X.numTimers()) }
+            }
+            for (int i = 0; i < k_NUM_TIMERS; ++i) {
+                ASSERTV(LINE, i, false == timers[i].isScheduled());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Timer timer;
+            Obj   mX(1, 0, &oa);
+
+            ASSERT_SAFE_FAIL(mX.schedule(0, 0));
+            ASSERT_SAFE_PASS(mX.schedule(&timer, 0));
+
+            ASSERT_SAFE_FAIL(timer.nextTimer());
+
+            ASSERT_SAFE_FAIL(mX.cancel(0));
+            ASSERT_SAFE_PASS(mX.cancel(&timer));
+
+            ASSERT_SAFE_PASS(timer.nextTimer());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed timer is not scheduled, and has a deadline
+        //:   of 0.
+        //:
+        //: 2 A wheel has the resolution and start time supplied at
+        //:   construction, and holds no timers.
+        //:
+        //: 3 A wheel obtains one block of memory, from the allocator supplied
+        //:   at construction or, if none is, the default allocator, and
+        //:   returns it on destruction.
+        //:
+        //: 4 Destroying a wheel cancels the timers it holds.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a timer, and verify its accessors.  (C-1)
+        //:
+        //: 2 Create wheels with and without an allocator, verify their
+        //:   accessors and the memory used from each allocator, schedule
+        //:   timers in them, and verify that the timers are not scheduled
+        //:   once the wheels are destroyed.  (C-2..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   TimingWheelTimer();
+        //   ~TimingWheelTimer();
+        //   bsls::Types::Int64 deadline() const;
+        //   bool isScheduled() const;
+        //   TimingWheel(Int64 resolution, Int64 startTime, Allocator *ba = 0);
+        //   ~TimingWheel();
+        //   bslma::Allocator *allocator() const;
+        //   bsls::Types::Int64 resolution() const;
+        //   bsls::Types::Int64 startTime() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS AND BASIC ACCESSORS"
+                            "\n====================================\n");
+
+        {
+            const Timer T;
+            ASSERT(false == T.isScheduled());
+            ASSERT(0     == T.deadline());
+        }
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int withAllocator = 0; withAllocator < 2; ++withAllocator) {
+            bslma::TestAllocator  oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator& EA = withAllocator ? oa : da;
+
+            Timer timers[3];
+            {
+                Obj mX(1000, -17, withAllocator ? &oa : 0);  const Obj& X = mX;
+
+                ASSERTV(withAllocator, &EA   == X.allocator());
+                ASSERTV(withAllocator, 1000  == X.resolution());
+                ASSERTV(withAllocator, -17   == X.startTime());
+                ASSERTV(withAllocator, 0     == X.numTimers());
+                ASSERTV(withAllocator, 1     == EA.numBlocksInUse());
+
+                mX.schedule(timers + 0, 5);
+                mX.schedule(timers + 1, 5000000);
+                mX.schedule(timers + 2, Int64(1) << 60);
+                ASSERTV(withAllocator, 3    == X.numTimers());
+                ASSERTV(withAllocator, true == timers[2].isScheduled());
+                ASSERTV(withAllocator, Int64(1) << 60 == timers[2].deadline());
+                ASSERTV(withAllocator, 1    == EA.numBlocksTotal());
+            }
+            ASSERTV(withAllocator, 0 == EA.numBlocksInUse());
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(withAllocator, i, false == timers[i].isScheduled());
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_FAIL(Obj(0,  0));
+            ASSERT_SAFE_FAIL(Obj(-1, 0));
+            ASSERT_SAFE_PASS(Obj(1,  0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Schedule, cancel, reschedule, and expire timers in a wheel.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Timer t1, t2, t3;
+        Obj   mX(10, 0, &oa);  const Obj& X = mX;
+
+        mX.schedule(&t1, 100);
+        mX.schedule(&t2, 15);
+        mX.schedule(&t3, 1000000);
+        ASSERT(3 == X.numTimers());
+
+        ASSERT(0 == mX.expire(19));
+
+        Timer *first = mX.expire(20);
+        ASSERT(&t2 == first);
+        ASSERT(0   == first->nextTimer());
+        ASSERT(2   == X.numTimers());
+
+        ASSERT(0 == mX.cancel(&t1));
+        ASSERT(0 != mX.cancel(&t1));
+        ASSERT(1 == X.numTimers());
+
+        mX.schedule(&t1, 40);
+        mX.schedule(&t2, 25);
+        first = mX.expire(1000000);
+        ASSERT(&t2 == first);
+        ASSERT(&t1 == first->nextTimer());
+        ASSERT(&t3 == first->nextTimer()->nextTimer());
+        ASSERT(0   == first->nextTimer()->nextTimer()->nextTimer());
+        ASSERT(0   == X.numTimers());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: HEARTBEATS OF MANY SESSIONS
+        //
+        // Concerns:
+        //: 1 Rescheduling the heartbeat of a session is faster with a timing
+        //:   wheel than with a priority queue, or a 'multimap', when sessions
+        //:   are numerous.
+        //
+        // Plan:
+        //: 1 For several numbers of sessions, each receiving a message every
+        //:   minute on average, and expiring after 30 seconds of silence,
+        //:   report the time taken by (by default) 2 million messages, each
+        //:   rescheduling the heartbeat of its session, and the expiry of the
+        //:   heartbeats as the simulated time passes, with heartbeats held in
+        //:   a 'TimingWheel' having a resolution of 1 millisecond, an
+        //:   'addressable_priority_queue', and a 'multimap', verifying that
+        //:   each expires the same sessions.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: HEARTBEATS OF MANY SESSIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: HEARTBEATS OF MANY SESSIONS"
+                            "\n========================================\n");
+
+        const int NUM_OPS = argc > 2 && atoi(argv[2]) > 0
+                            ? atoi(argv[2])
+                            : 2 * 1000 * 1000;
+
+        const int NUM_SESSIONS[]   = { 1000, 100 * 1000, 1000 * 1000 };
+        const int NUM_NUM_SESSIONS = static_cast<int>(sizeof  NUM_SESSIONS
+                                                    / sizeof *NUM_SESSIONS);
+
+        printf("\t%10s %10s %10s %10s %10s\n",
+               "sessions", "checksum", "wheel", "heap", "multimap");
+
+        for (int ti = 0; ti < NUM_NUM_SESSIONS; ++ti) {
+            const int SESSIONS = NUM_SESSIONS[ti];
+
+            Int64 sums[3] = { 0, 0, 0 };
+
+            const double wheelTime    = runWheel(SESSIONS, NUM_OPS, &sums[0]);
+            const double heapTime     = runHeap(SESSIONS, NUM_OPS, &sums[1]);
+            const double multimapTime = runMultimap(SESSIONS,
+                                                    NUM_OPS,
+                                                    &sums[2]);
+
+            ASSERTV(SESSIONS, sums[0] == sums[1]);
+            ASSERTV(SESSIONS, sums[0] == sums[2]);
+
+            printf("\t%10d %10lld %9.3fs %9.3fs %9.3fs\n",
+                   SESSIONS,
+                   sums[0],
+                   wheelTime,
+                   heapTime,
+                   multimapTime);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
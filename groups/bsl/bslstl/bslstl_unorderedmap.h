@@ -148,6 +148,8 @@ BSLS_IDENT("$Id: $")
 //  'al               - an STL-style memory allocator
 //  'i1', 'i2'        - two iterators defining a sequence of 'value_type'
 //                      objects
+//  'j1', 'j2'        - two iterators defining a sequence of 'K' objects
+//  'o'               - an output iterator
 //  'k'               - an object of type 'K'
 //  'v'               - an object of type 'value_type'
 //  'p1', 'p2'        - two iterators belonging to 'a'
@@ -233,9 +235,16 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.find(j1, j2, o)                                  | Average: O[        |
+//  |                                                    |   distance(j1,j2)] |
+//  |                                                    | Worst:   O[n *     |
+//  |                                                    |   distance(j1,j2)] |
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -915,6 +924,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_CSTDDEF
 #include <cstddef>  // for 'std::size_t'
 #define INCLUDED_CSTDDEF
@@ -1177,6 +1190,19 @@ class unordered_map {
         // unordered map will be empty after this call, but allocated memory
         // may be retained for future use.
 
+    void compact();
+        // Reallocate the nodes of this unordered map contiguously, in the
+        // order of iteration, and release all the memory previously used for
+        // nodes.  Each element is copied into its new node, and the original
+        // element destroyed.  The number of buckets is not reduced.  All
+        // iterators, pointers, and references to elements of this unordered
+        // map are invalidated.  If an exception is thrown, this unordered map
+        // is not modified.  Note that, after a long sequence of insertions and
+        // removals, the nodes visited by iterating over an unordered map are
+        // typically scattered across memory, and that this method restores the
+        // locality of iteration, at the cost of temporarily allocating memory
+        // for a second copy of the elements.
+
     iterator erase(const_iterator position);
         // Remove from this unordered map the 'value_type' object at the
         // specified 'position', and return an iterator referring to the
@@ -1206,6 +1232,25 @@ class unordered_map {
         // object in this unordered map having the specified 'key', if such an
         // entry exists, and the past-the-end iterator ('end') otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find(FORWARD_ITERATOR first,
+                         FORWARD_ITERATOR last,
+                         OUTPUT_ITERATOR  result);
+        // Write to the specified 'result', in order, for each key in the range
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position, an iterator providing
+        // modifiable access to the 'value_type' object in this unordered map
+        // having that key, if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise; return 'result' advanced past the last
+        // iterator written.  The keys are looked up in batches, overlapping
+        // the cache misses incurred by the keys of each batch (see
+        // 'bslalg_hashtableimputil'), which is substantially faster than
+        // calling 'find' for each key when this unordered map is larger than
+        // the processor caches.  'FORWARD_ITERATOR' shall be a forward
+        // iterator whose 'operator*' returns a reference to a 'key_type'
+        // object, and 'iterator' shall be assignable to '*result'.  The
+        // behavior is undefined unless '[first, last)' is a valid range.
+
     template <class SOURCE_TYPE>
     pair<iterator, bool> insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this unordered map if the key (the
@@ -1387,6 +1432,22 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find(FORWARD_ITERATOR first,
+                         FORWARD_ITERATOR last,
+                         OUTPUT_ITERATOR  result) const;
+        // Write to the specified 'result', in order, for each key in the range
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position, an iterator providing
+        // non-modifiable access to the 'value_type' object in this unordered
+        // map having that key, if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise; return 'result' advanced past the last
+        // iterator written.  The keys are looked up in batches, as for the
+        // manipulator of the same name.  'FORWARD_ITERATOR' shall be a forward
+        // iterator whose 'operator*' returns a reference to a 'key_type'
+        // object, and 'const_iterator' shall be assignable to '*result'.  The
+        // behavior is undefined unless '[first, last)' is a valid range.
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -1616,6 +1677,14 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::clear()
     d_impl.removeAll();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::compact()
+{
+    d_impl.compact();
+}
+
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
@@ -1676,6 +1745,36 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                      FORWARD_ITERATOR first,
+                                                      FORWARD_ITERATOR last,
+                                                      OUTPUT_ITERATOR  result)
+{
+    enum { k_BATCH_SIZE = 16 };
+
+    const key_type *keys[k_BATCH_SIZE];
+    HashTableLink  *links[k_BATCH_SIZE];
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            keys[numKeys] = BSLS_UTIL_ADDRESSOF(*first);
+            ++numKeys;
+            ++first;
+        } while (numKeys < k_BATCH_SIZE && first != last);
+
+        d_impl.findBatch(links, keys, numKeys);
+
+        for (int i = 0; i < numKeys; ++i, ++result) {
+            *result = iterator(links[i]);
+        }
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 template <class SOURCE_TYPE>
 bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -1963,6 +2062,36 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                FORWARD_ITERATOR first,
+                                                FORWARD_ITERATOR last,
+                                                OUTPUT_ITERATOR  result) const
+{
+    enum { k_BATCH_SIZE = 16 };
+
+    const key_type *keys[k_BATCH_SIZE];
+    HashTableLink  *links[k_BATCH_SIZE];
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            keys[numKeys] = BSLS_UTIL_ADDRESSOF(*first);
+            ++numKeys;
+            ++first;
+        } while (numKeys < k_BATCH_SIZE && first != last);
+
+        d_impl.findBatch(links, keys, numKeys);
+
+        for (int i = 0; i < numKeys; ++i, ++result) {
+            *result = const_iterator(links[i]);
+        }
+    }
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
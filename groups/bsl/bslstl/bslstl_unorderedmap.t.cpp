@@ -26,6 +26,7 @@
 #include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_util.h>
 
 #include <bsltf_stdtestallocator.h>
@@ -56,9 +57,14 @@ using namespace BloombergLP;
 // guarantees.
 //-----------------------------------------------------------------------------
 // [ ]
+// [17] OUTPUT_ITERATOR find(FORWARD_ITERATOR, FORWARD_ITERATOR, OUTPUT_IT);
+// [17] OUTPUT_ITERATOR find(FORWARD_ITER, FORWARD_ITER, OUTPUT_IT) const;
+// [18] void compact();
 //-----------------------------------------------------------------------------
-// [1] BREATHING TEST
-// [2] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+// [19] USAGE EXAMPLE
+// [-1] PERFORMANCE: BATCHED LOOKUP
+// [-2] PERFORMANCE: ITERATION AFTER 'compact'
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -5979,6 +5985,12 @@ class TestDriver {
   public:
     // TEST CASES
 
+    static void testCase18();
+        // Compact
+
+    static void testCase17();
+        // Batched lookup
+
     static void testCase16();
         // Testing Typedefs
 
@@ -6118,6 +6130,209 @@ void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::matchFirstValues(
     delete[] foundValues;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase18()
+{
+    // ------------------------------------------------------------------------
+    // COMPACT
+    //
+    // Concerns:
+    //: 1 'compact' does not change the value of the object, nor the order in
+    //:   which its elements are iterated over, nor its number of buckets.
+    //:
+    //: 2 After 'compact', the addresses of the elements increase in the order
+    //:   of iteration.
+    //:
+    //: 3 After 'compact', the object uses the same number of blocks of memory
+    //:   as a copy of it, the memory released by erased elements having been
+    //:   returned to the allocator.
+    //:
+    //: 4 Any memory allocation is from the object allocator.
+    //:
+    //: 5 'compact' provides the strong exception guarantee.
+    //
+    // Plan:
+    //: 1 For each length up to 16, create an object by inserting twice as
+    //:   many values, erasing every other value and inserting back half of
+    //:   them in reverse order.  Call 'compact' in the presence of injected
+    //:   exceptions, and verify that the value, the order of iteration and
+    //:   the number of buckets of the object are those recorded before the
+    //:   call.  (C-1, 5)
+    //:
+    //: 2 Verify that the addresses of the elements increase in the order of
+    //:   iteration, that the object allocator has as many blocks in use as
+    //:   that of a copy of the object, and that no memory is allocated from
+    //:   the default allocator.  (C-2..4)
+    //
+    // Testing:
+    //   void compact();
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;
+
+    const int MAX_LENGTH = 16;
+
+    if (verbose) printf("\nTesting 'compact'.\n");
+
+    for (int ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const int LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 2 * LENGTH; ++i) {
+            mX.insert(VALUES[i]);
+        }
+        for (int i = 0; i < 2 * LENGTH; i += 2) {
+            mX.erase(VALUES[i].first);
+        }
+        for (int i = 2 * LENGTH - 2; i >= 0; i -= 4) {
+            mX.insert(VALUES[i]);
+        }
+
+        const Obj W(X, &sa);
+
+        bsl::vector<KEY> keys(&sa);
+        for (CIter it = X.begin(); it != X.end(); ++it) {
+            keys.push_back(it->first);
+        }
+
+        const size_t             NUM_BUCKETS = X.bucket_count();
+        const bsls::Types::Int64 NUM_IN_USE  = oa.numBlocksInUse();
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            ASSERTV(ti, W == X);
+
+            mX.compact();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERTV(ti, W == X);
+        ASSERTV(ti, NUM_BUCKETS == X.bucket_count());
+
+        size_t n    = 0;
+        CIter  prev = X.end();
+        for (CIter it = X.begin(); it != X.end(); prev = it, ++it, ++n) {
+            ASSERTV(ti, n, n < keys.size() && keys[n] == it->first);
+            if (prev != X.end()) {
+                ASSERTV(ti, n, bsls::Util::addressOf(*prev)
+                                                < bsls::Util::addressOf(*it));
+            }
+        }
+        ASSERTV(ti, keys.size() == n);
+
+        {
+            bslma::TestAllocator ca("copy", veryVeryVeryVerbose);
+
+            const Obj Y(X, &ca);
+
+            ASSERTV(ti, ca.numBlocksInUse(), oa.numBlocksInUse(),
+                    ca.numBlocksInUse() == oa.numBlocksInUse());
+        }
+
+        ASSERTV(ti, NUM_IN_USE, oa.numBlocksInUse(),
+                NUM_IN_USE >= oa.numBlocksInUse());
+
+        ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase17()
+{
+    // ------------------------------------------------------------------------
+    // BATCHED LOOKUP
+    //
+    // Concerns:
+    //: 1 The range 'find' writes, for each key of the range, the iterator that
+    //:   'find' returns for that key, in the order of the range, whether or
+    //:   not the key is in the container.
+    //:
+    //: 2 The range 'find' returns the output iterator advanced past the last
+    //:   iterator written.
+    //:
+    //: 3 Keys are found correctly whatever their number, in particular when
+    //:   it is not a multiple of the size of the batches looked up together.
+    //:
+    //: 4 Both the 'const' and non-'const' versions write the same iterators.
+    //:
+    //: 5 No memory is allocated.
+    //
+    // Plan:
+    //: 1 For each length up to 25, create an object holding every other
+    //:   value of 'VALUES', and look up, in a single call of each version of
+    //:   the range 'find', the keys of all the values of 'VALUES' up to twice
+    //:   the length.  Verify each iterator written against 'find', and verify
+    //:   the iterators returned.  (C-1..4)
+    //:
+    //: 2 Verify no memory is allocated from the object or default allocators
+    //:   by the lookups.  (C-5)
+    //
+    // Testing:
+    //   OUTPUT_ITERATOR find(FORWARD_ITERATOR, FORWARD_ITERATOR, OUTPUT_IT);
+    //   OUTPUT_ITERATOR find(FORWARD_ITER, FORWARD_ITER, OUTPUT_IT) const;
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;
+
+    const int MAX_LENGTH = 25;
+
+    if (verbose) printf("\nTesting batched lookup.\n");
+
+    for (int ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const int LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < LENGTH; ++i) {
+            mX.insert(VALUES[2 * i + 1]);
+        }
+
+        bsl::vector<KEY> keys(&sa);
+        for (int tj = 0; tj <= 2 * LENGTH; ++tj) {
+            keys.push_back(VALUES[tj].first);
+        }
+
+        bsl::vector<Iter>  iters(keys.size(), Iter(), &sa);
+        bsl::vector<CIter> citers(keys.size(), CIter(), &sa);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        typedef typename bsl::vector<Iter>::iterator  IterIter;
+        typedef typename bsl::vector<CIter>::iterator CIterIter;
+
+        const IterIter  ITEND  = mX.find(keys.begin(),
+                                         keys.end(),
+                                         iters.begin());
+        const CIterIter CITEND =  X.find(keys.begin(),
+                                         keys.end(),
+                                         citers.begin());
+
+        ASSERTV(ti, oam.isTotalSame());
+        ASSERTV(ti, dam.isTotalSame());
+
+        ASSERTV(ti, iters.end()  == ITEND);
+        ASSERTV(ti, citers.end() == CITEND);
+
+        for (int tj = 0; tj <= 2 * LENGTH; ++tj) {
+            ASSERTV(ti, tj, mX.find(keys[tj]) == iters[tj]);
+            ASSERTV(ti, tj,  X.find(keys[tj]) == citers[tj]);
+            ASSERTV(ti, tj, (X.end() == citers[tj]) == (0 == tj % 2));
+        }
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase16()
 {
@@ -9567,7 +9782,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
 #if !defined(BSLSTL_UNORDEREDMAP_DO_NOT_TEST_USAGE)
-        case 17: {
+        case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9588,6 +9803,30 @@ int main(int argc, char *argv[])
         usage();
       } break;
 #endif
+      case 18: {
+        // --------------------------------------------------------------------
+        // COMPACT
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing Compact\n"
+                            "===============\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase18,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // BATCHED LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing Batched Lookup\n"
+                            "======================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase17,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
@@ -10012,6 +10251,169 @@ int main(int argc, char *argv[])
         if (veryVerbose)
             printf("Final message to confim the end of the breathing test.\n");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCHED LOOKUP
+        //
+        // Concerns:
+        //: 1 Looking up a sequence of keys in an unordered map larger than the
+        //:   processor caches with the range 'find' is faster than calling
+        //:   'find' for each key.
+        //
+        // Plan:
+        //: 1 Create an unordered map of (by default) 8 million values, and
+        //:   report the time taken to look up 1 million random keys (half of
+        //:   which are present), calling 'find' for each key, and calling the
+        //:   range 'find' once.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCHED LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: BATCHED LOOKUP"
+                            "\n===========================\n");
+
+        typedef bsl::unordered_map<int, int> IntMap;
+
+        const int NUM_VALUES = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 8 * 1000 * 1000;
+        const int NUM_KEYS   = 1000 * 1000;
+
+        bslma::MallocFreeAllocator& ma =
+                                      bslma::MallocFreeAllocator::singleton();
+
+        // The map holds the even keys in '[0 .. 2 * NUM_VALUES)', inserted in
+        // a random order so that the nodes of neighboring keys are not
+        // neighbors in memory.
+
+        bsl::vector<int> values(&ma);
+        values.reserve(NUM_VALUES);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            values.push_back(2 * i);
+        }
+        srand(1);
+        std::random_shuffle(values.begin(), values.end());
+
+        IntMap mX(&ma);  const IntMap& X = mX;
+        mX.reserve(NUM_VALUES);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.insert(bsl::pair<int, int>(values[i], i));
+        }
+
+        bsl::vector<int> keys(&ma);
+        keys.reserve(NUM_KEYS);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys.push_back(values[rand() % NUM_VALUES] + rand() % 2);
+        }
+
+        bsl::vector<IntMap::const_iterator> results(NUM_KEYS,
+                                                    X.end(),
+                                                    &ma);
+
+        bsls::Stopwatch timer;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            results[i] = X.find(keys[i]);
+        }
+        timer.stop();
+        ASSERT(results[NUM_KEYS - 1] == X.find(keys[NUM_KEYS - 1]));
+        printf("\t'find', one key at a time: %8.3fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        X.find(keys.begin(), keys.end(), results.begin());
+        timer.stop();
+        ASSERT(results[NUM_KEYS - 1] == X.find(keys[NUM_KEYS - 1]));
+        printf("\trange 'find':              %8.3fs\n", timer.elapsedTime());
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ITERATION AFTER 'compact'
+        //
+        // Concerns:
+        //: 1 Iterating over an unordered map whose nodes have been scattered
+        //:   in memory by insertions and erasures is faster after 'compact'.
+        //
+        // Plan:
+        //: 1 Create an unordered map of (by default) 4 million values, and
+        //:   churn it by erasing all of them and inserting as many new ones,
+        //:   in random orders.  Report the time taken to iterate over the map
+        //:   before and after calling 'compact', and the time taken by
+        //:   'compact'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ITERATION AFTER 'compact'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: ITERATION AFTER 'compact'"
+                            "\n======================================\n");
+
+        typedef bsl::unordered_map<int, int> IntMap;
+
+        const int NUM_VALUES = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 4 * 1000 * 1000;
+
+        bslma::MallocFreeAllocator& ma =
+                                      bslma::MallocFreeAllocator::singleton();
+
+        bsl::vector<int> values(&ma);
+        values.reserve(NUM_VALUES);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            values.push_back(i);
+        }
+
+        IntMap mX(&ma);  const IntMap& X = mX;
+        mX.reserve(NUM_VALUES);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.insert(bsl::pair<int, int>(2 * values[i], i));
+        }
+
+        // Erase the even keys, in a random order, and insert the odd keys, in
+        // another random order, so that nodes are reused in an order
+        // unrelated to that of the list of the map.
+
+        srand(1);
+        std::random_shuffle(values.begin(), values.end());
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.erase(2 * values[i]);
+        }
+        std::random_shuffle(values.begin(), values.end());
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.insert(bsl::pair<int, int>(2 * values[i] + 1, i));
+        }
+
+        bsls::Stopwatch timer;
+        long long       sum = 0;
+
+        timer.reset();
+        timer.start();
+        for (IntMap::const_iterator it = X.begin(); it != X.end(); ++it) {
+            sum += it->second;
+        }
+        timer.stop();
+        ASSERT(sum == static_cast<long long>(NUM_VALUES - 1) * NUM_VALUES / 2);
+        printf("\titerate, after churn:     %8.3fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        mX.compact();
+        timer.stop();
+        printf("\t'compact':                %8.3fs\n", timer.elapsedTime());
+
+        sum = 0;
+        timer.reset();
+        timer.start();
+        for (IntMap::const_iterator it = X.begin(); it != X.end(); ++it) {
+            sum += it->second;
+        }
+        timer.stop();
+        ASSERT(sum == static_cast<long long>(NUM_VALUES - 1) * NUM_VALUES / 2);
+        printf("\titerate, after 'compact': %8.3fs\n", timer.elapsedTime());
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
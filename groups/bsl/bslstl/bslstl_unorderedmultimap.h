@@ -222,6 +222,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -828,6 +830,19 @@ class unordered_multimap
         // empty after this call, but allocated memory may be retained for
         // future use.
 
+    void compact();
+        // Reallocate the nodes of this unordered multimap contiguously, in the
+        // order of iteration, and release all the memory previously used for
+        // nodes.  Each element is copied into its new node, and the original
+        // element destroyed.  The number of buckets is not reduced.  All
+        // iterators, pointers, and references to elements of this unordered
+        // multimap are invalidated.  If an exception is thrown, this unordered
+        // multimap is not modified.  Note that, after a long sequence of
+        // insertions and removals, the nodes visited by iterating over an
+        // unordered multimap are typically scattered across memory, and that
+        // this method restores the locality of iteration, at the cost of
+        // temporarily allocating memory for a second copy of the elements.
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the first
         // 'value_type' object in the sequence of all the 'value_type' objects
@@ -1133,6 +1148,13 @@ void unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::clear()
     d_impl.removeAll();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::compact()
+{
+    d_impl.compact();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
 unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
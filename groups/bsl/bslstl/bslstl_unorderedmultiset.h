@@ -219,6 +219,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -848,6 +850,19 @@ class unordered_multiset
         // empty after this call, but allocated memory may be retained for
         // future use.
 
+    void compact();
+        // Reallocate the nodes of this unordered multiset contiguously, in the
+        // order of iteration, and release all the memory previously used for
+        // nodes.  Each element is copied into its new node, and the original
+        // element destroyed.  The number of buckets is not reduced.  All
+        // iterators, pointers, and references to elements of this unordered
+        // multiset are invalidated.  If an exception is thrown, this unordered
+        // multiset is not modified.  Note that, after a long sequence of
+        // insertions and removals, the nodes visited by iterating over an
+        // unordered multiset are typically scattered across memory, and that
+        // this method restores the locality of iteration, at the cost of
+        // temporarily allocating memory for a second copy of the elements.
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this multi-set having the
@@ -1257,6 +1272,14 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::clear()
     d_impl.removeAll();
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::compact()
+{
+    d_impl.compact();
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
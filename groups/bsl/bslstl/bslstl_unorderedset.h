@@ -139,6 +139,8 @@ BSLS_IDENT("$Id: $")
 //  'c'             - comparator providing an ordering for objects of type 'K'
 //  'al             - an STL-style memory allocator
 //  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'j1', 'j2'      - two iterators defining a sequence of 'K' objects
+//  'o'             - an output iterator
 //  'k'             - an object of type 'K'
 //  'v'             - an object of type 'value_type'
 //  'p1', 'p2'      - two iterators belonging to 'a'
@@ -217,9 +219,16 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.find(j1, j2, o)                                  | Average: O[        |
+//  |                                                    |   distance(j1,j2)] |
+//  |                                                    | Worst:   O[n *     |
+//  |                                                    |   distance(j1,j2)] |
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -570,6 +579,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_CSTDDEF
 #include <cstddef>  // for 'std::size_t'
 #define INCLUDED_CSTDDEF
@@ -794,6 +807,19 @@ class unordered_set
         // empty after this call, but allocated memory may be retained for
         // future use.
 
+    void compact();
+        // Reallocate the nodes of this unordered set contiguously, in the
+        // order of iteration, and release all the memory previously used for
+        // nodes.  Each element is copied into its new node, and the original
+        // element destroyed.  The number of buckets is not reduced.  All
+        // iterators, pointers, and references to elements of this unordered
+        // set are invalidated.  If an exception is thrown, this unordered set
+        // is not modified.  Note that, after a long sequence of insertions and
+        // removals, the nodes visited by iterating over an unordered set are
+        // typically scattered across memory, and that this method restores the
+        // locality of iteration, at the cost of temporarily allocating memory
+        // for a second copy of the elements.
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this unordered set having the
@@ -832,6 +858,25 @@ class unordered_set
         // object in this set having the specified 'key', if such an entry
         // exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find(FORWARD_ITERATOR first,
+                         FORWARD_ITERATOR last,
+                         OUTPUT_ITERATOR  result);
+        // Write to the specified 'result', in order, for each key in the range
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position, an iterator providing
+        // modifiable access to the 'value_type' object in this set having
+        // that key, if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise; return 'result' advanced past the last iterator
+        // written.  The keys are looked up in batches, overlapping the cache
+        // misses incurred by the keys of each batch (see
+        // 'bslalg_hashtableimputil'), which is substantially faster than
+        // calling 'find' for each key when this set is larger than the
+        // processor caches.  'FORWARD_ITERATOR' shall be a forward iterator
+        // whose 'operator*' returns a reference to a 'key_type' object, and
+        // 'iterator' shall be assignable to '*result'.  The behavior is
+        // undefined unless '[first, last)' is a valid range.
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this set if the key (the 'first'
         // element) of the 'value' does not already exist in this set;
@@ -974,6 +1019,22 @@ class unordered_set
         // 'value_type' object in this set having the specified 'key', if such
         // an entry exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find(FORWARD_ITERATOR first,
+                         FORWARD_ITERATOR last,
+                         OUTPUT_ITERATOR  result) const;
+        // Write to the specified 'result', in order, for each key in the range
+        // starting at the specified 'first' position and ending immediately
+        // before the specified 'last' position, an iterator providing
+        // non-modifiable access to the 'value_type' object in this set having
+        // that key, if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise; return 'result' advanced past the last iterator
+        // written.  The keys are looked up in batches, as for the manipulator
+        // of the same name.  'FORWARD_ITERATOR' shall be a forward iterator
+        // whose 'operator*' returns a reference to a 'key_type' object, and
+        // 'const_iterator' shall be assignable to '*result'.  The behavior is
+        // undefined unless '[first, last)' is a valid range.
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // set.
@@ -1175,6 +1236,13 @@ void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::clear()
     d_impl.removeAll();
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::compact()
+{
+    d_impl.compact();
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -1252,6 +1320,35 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(FORWARD_ITERATOR first,
+                                                 FORWARD_ITERATOR last,
+                                                 OUTPUT_ITERATOR  result)
+{
+    enum { k_BATCH_SIZE = 16 };
+
+    const key_type *keys[k_BATCH_SIZE];
+    HashTableLink  *links[k_BATCH_SIZE];
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            keys[numKeys] = BSLS_UTIL_ADDRESSOF(*first);
+            ++numKeys;
+            ++first;
+        } while (numKeys < k_BATCH_SIZE && first != last);
+
+        d_impl.findBatch(links, keys, numKeys);
+
+        for (int i = 0; i < numKeys; ++i, ++result) {
+            *result = iterator(links[i]);
+        }
+    }
+    return result;
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
@@ -1428,6 +1525,36 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(
+                                                FORWARD_ITERATOR first,
+                                                FORWARD_ITERATOR last,
+                                                OUTPUT_ITERATOR  result) const
+{
+    enum { k_BATCH_SIZE = 16 };
+
+    const key_type *keys[k_BATCH_SIZE];
+    HashTableLink  *links[k_BATCH_SIZE];
+
+    while (first != last) {
+        int numKeys = 0;
+        do {
+            keys[numKeys] = BSLS_UTIL_ADDRESSOF(*first);
+            ++numKeys;
+            ++first;
+        } while (numKeys < k_BATCH_SIZE && first != last);
+
+        d_impl.findBatch(links, keys, numKeys);
+
+        for (int i = 0; i < numKeys; ++i, ++result) {
+            *result = const_iterator(links[i]);
+        }
+    }
+    return result;
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
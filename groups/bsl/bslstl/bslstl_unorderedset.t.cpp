@@ -2,6 +2,8 @@
 
 #include <bslstl_unorderedset.h>
 
+#include <bslstl_vector.h>
+
 #include <bslalg_rangecompare.h>
 #include <bslalg_swaputil.h>
 
@@ -165,6 +167,9 @@ using namespace BloombergLP;
 // set operations:
 //*[13] iterator find(const key_type& key);
 //*[13] const_iterator find(const key_type& key) const;
+// [28] OUTPUT_ITERATOR find(FORWARD_ITERATOR, FORWARD_ITERATOR, OUTPUT_IT);
+// [28] OUTPUT_ITERATOR find(FORWARD_ITER, FORWARD_ITER, OUTPUT_IT) const;
+// [29] void compact();
 //*[13] size_type count(const key_type& key) const;
 //*[13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 //*[13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
@@ -198,7 +203,7 @@ using namespace BloombergLP;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [29] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -1213,6 +1218,12 @@ class TestDriver {
   public:
     // TEST CASES
 
+    static void testCase29();
+        // Compact
+
+    static void testCase28();
+        // Batched lookup
+
     static void testCase99();
         // Test spread of nodes into different buckets
 
@@ -1416,6 +1427,209 @@ TestDriver<KEY, HASH, EQUAL, ALLOC>::getIterForIndex(const Obj& obj,
     return ret;
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase29()
+{
+    // ------------------------------------------------------------------------
+    // COMPACT
+    //
+    // Concerns:
+    //: 1 'compact' does not change the value of the object, nor the order in
+    //:   which its elements are iterated over, nor its number of buckets.
+    //:
+    //: 2 After 'compact', the addresses of the elements increase in the order
+    //:   of iteration.
+    //:
+    //: 3 After 'compact', the object uses the same number of blocks of memory
+    //:   as a copy of it, the memory released by erased elements having been
+    //:   returned to the allocator.
+    //:
+    //: 4 Any memory allocation is from the object allocator.
+    //:
+    //: 5 'compact' provides the strong exception guarantee.
+    //
+    // Plan:
+    //: 1 For each length up to 16, create an object by inserting twice as
+    //:   many values, erasing every other value and inserting back half of
+    //:   them in reverse order.  Call 'compact' in the presence of injected
+    //:   exceptions, and verify that the value, the order of iteration and
+    //:   the number of buckets of the object are those recorded before the
+    //:   call.  (C-1, 5)
+    //:
+    //: 2 Verify that the addresses of the elements increase in the order of
+    //:   iteration, that the object allocator has as many blocks in use as
+    //:   that of a copy of the object, and that no memory is allocated from
+    //:   the default allocator.  (C-2..4)
+    //
+    // Testing:
+    //   void compact();
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;
+
+    const int MAX_LENGTH = 16;
+
+    if (verbose) printf("\nTesting 'compact'.\n");
+
+    for (int ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const int LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 2 * LENGTH; ++i) {
+            mX.insert(VALUES[i]);
+        }
+        for (int i = 0; i < 2 * LENGTH; i += 2) {
+            mX.erase(VALUES[i]);
+        }
+        for (int i = 2 * LENGTH - 2; i >= 0; i -= 4) {
+            mX.insert(VALUES[i]);
+        }
+
+        const Obj W(X, &sa);
+
+        bsl::vector<KEY> keys(&sa);
+        for (CIter it = X.begin(); it != X.end(); ++it) {
+            keys.push_back(*it);
+        }
+
+        const size_t             NUM_BUCKETS = X.bucket_count();
+        const bsls::Types::Int64 NUM_IN_USE  = oa.numBlocksInUse();
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            ASSERTV(ti, W == X);
+
+            mX.compact();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERTV(ti, W == X);
+        ASSERTV(ti, NUM_BUCKETS == X.bucket_count());
+
+        size_t n    = 0;
+        CIter  prev = X.end();
+        for (CIter it = X.begin(); it != X.end(); prev = it, ++it, ++n) {
+            ASSERTV(ti, n, n < keys.size() && keys[n] == *it);
+            if (prev != X.end()) {
+                ASSERTV(ti, n, bsls::Util::addressOf(*prev)
+                                                < bsls::Util::addressOf(*it));
+            }
+        }
+        ASSERTV(ti, keys.size() == n);
+
+        {
+            bslma::TestAllocator ca("copy", veryVeryVeryVerbose);
+
+            const Obj Y(X, &ca);
+
+            ASSERTV(ti, ca.numBlocksInUse(), oa.numBlocksInUse(),
+                    ca.numBlocksInUse() == oa.numBlocksInUse());
+        }
+
+        ASSERTV(ti, NUM_IN_USE, oa.numBlocksInUse(),
+                NUM_IN_USE >= oa.numBlocksInUse());
+
+        ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase28()
+{
+    // ------------------------------------------------------------------------
+    // BATCHED LOOKUP
+    //
+    // Concerns:
+    //: 1 The range 'find' writes, for each key of the range, the iterator that
+    //:   'find' returns for that key, in the order of the range, whether or
+    //:   not the key is in the container.
+    //:
+    //: 2 The range 'find' returns the output iterator advanced past the last
+    //:   iterator written.
+    //:
+    //: 3 Keys are found correctly whatever their number, in particular when
+    //:   it is not a multiple of the size of the batches looked up together.
+    //:
+    //: 4 Both the 'const' and non-'const' versions write the same iterators.
+    //:
+    //: 5 No memory is allocated.
+    //
+    // Plan:
+    //: 1 For each length up to 25, create an object holding every other
+    //:   value of 'VALUES', and look up, in a single call of each version of
+    //:   the range 'find', the keys of all the values of 'VALUES' up to twice
+    //:   the length.  Verify each iterator written against 'find', and verify
+    //:   the iterators returned.  (C-1..4)
+    //:
+    //: 2 Verify no memory is allocated from the object or default allocators
+    //:   by the lookups.  (C-5)
+    //
+    // Testing:
+    //   OUTPUT_ITERATOR find(FORWARD_ITERATOR, FORWARD_ITERATOR, OUTPUT_IT);
+    //   OUTPUT_ITERATOR find(FORWARD_ITER, FORWARD_ITER, OUTPUT_IT) const;
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;
+
+    const int MAX_LENGTH = 25;
+
+    if (verbose) printf("\nTesting batched lookup.\n");
+
+    for (int ti = 0; ti <= MAX_LENGTH; ++ti) {
+        const int LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < LENGTH; ++i) {
+            mX.insert(VALUES[2 * i + 1]);
+        }
+
+        bsl::vector<KEY> keys(&sa);
+        for (int tj = 0; tj <= 2 * LENGTH; ++tj) {
+            keys.push_back(VALUES[tj]);
+        }
+
+        bsl::vector<Iter>  iters(keys.size(), Iter(), &sa);
+        bsl::vector<CIter> citers(keys.size(), CIter(), &sa);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        typedef typename bsl::vector<Iter>::iterator  IterIter;
+        typedef typename bsl::vector<CIter>::iterator CIterIter;
+
+        const IterIter  ITEND  = mX.find(keys.begin(),
+                                         keys.end(),
+                                         iters.begin());
+        const CIterIter CITEND =  X.find(keys.begin(),
+                                         keys.end(),
+                                         citers.begin());
+
+        ASSERTV(ti, oam.isTotalSame());
+        ASSERTV(ti, dam.isTotalSame());
+
+        ASSERTV(ti, iters.end()  == ITEND);
+        ASSERTV(ti, citers.end() == CITEND);
+
+        for (int tj = 0; tj <= 2 * LENGTH; ++tj) {
+            ASSERTV(ti, tj, mX.find(keys[tj]) == iters[tj]);
+            ASSERTV(ti, tj,  X.find(keys[tj]) == citers[tj]);
+            ASSERTV(ti, tj, (X.end() == citers[tj]) == (0 == tj % 2));
+        }
+    }
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase99()
 {
@@ -6378,7 +6592,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 28: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6533,6 +6747,30 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // COMPACT
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing Compact\n"
+                            "===============\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase29,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // BATCHED LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing Batched Lookup\n"
+                            "======================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase28,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // TESTING SPREAD
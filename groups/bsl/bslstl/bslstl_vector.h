@@ -544,6 +544,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_issame.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYDEFAULTCONSTRUCTIBLE
+#include <bslmf_istriviallydefaultconstructible.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_MATCHANYTYPE
 #include <bslmf_matchanytype.h>
 #endif
@@ -1008,6 +1012,20 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // specified and "default-constructible" otherwise (see {Requirements
         // on 'VALUE_TYPE'}).
 
+    void resize_default_init(size_type newSize);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end if 'newSize < size()' or appending
+        // default-initialized elements at the end if 'size() < newSize'.
+        // Throw 'std::length_error' if 'newSize > max_size()'.  If
+        // 'bsl::is_trivially_default_constructible<VALUE_TYPE>' is 'true',
+        // the appended elements are left uninitialized (i.e., have
+        // indeterminate values that must be written before being read);
+        // otherwise this method is equivalent to 'resize(newSize)'.  This
+        // method requires that the (template parameter) type 'VALUE_TYPE' be
+        // "default-constructible" (see {Requirements on 'VALUE_TYPE'}).  Note
+        // that this method avoids the cost of value-initializing a buffer
+        // that is about to be overwritten, e.g., by a 'read' system call.
+
     void reserve(size_type newCapacity);
         // Change the capacity of this vector to the specified 'newCapacity'.
         // Note that the capacity of a vector is the maximum number of elements
@@ -1503,6 +1521,8 @@ class vector< VALUE_TYPE *, ALLOCATOR >
         { Base::resize(newLength); }
     void resize(size_type newLength, VALUE_TYPE *value)
         { Base::resize(newLength, (void *)value); }
+    void resize_default_init(size_type newLength)
+        { Base::resize_default_init(newLength); }
 
     // void reserve(size_type newCapacity);
     // can be inherited from Base without cast
@@ -1736,6 +1756,8 @@ class vector< const VALUE_TYPE *, ALLOCATOR >
         { Base::resize(newLength); }
     void resize(size_type newLength, const VALUE_TYPE *value)
         { Base::resize(newLength, (const void *)value); }
+    void resize_default_init(size_type newLength)
+        { Base::resize_default_init(newLength); }
 
     // void reserve(size_type newCapacity);
     // can be inherited from Base without cast.
@@ -2645,6 +2667,41 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize(size_type         newSize,
     }
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize_default_init(size_type newSize)
+{
+    if (!bsl::is_trivially_default_constructible<VALUE_TYPE>::value) {
+        resize(newSize);
+        return;                                                       // RETURN
+    }
+
+    if (newSize <= this->size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   this->d_dataBegin + newSize,
+                                                   this->d_dataEnd);
+        this->d_dataEnd = this->d_dataBegin + newSize;
+        return;                                                       // RETURN
+    }
+
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > maxSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                 "vector<...>::resize_default_init(newSize): vector too long");
+    }
+
+    if (newSize > this->d_capacity) {
+        reserve(Vector_Util::computeNewCapacity(newSize,
+                                                this->d_capacity,
+                                                maxSize));
+    }
+
+    // Trivially default-constructible elements need no construction: simply
+    // extend the size over the (uninitialized) reserved storage.
+
+    this->d_dataEnd = this->d_dataBegin + newSize;
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 void Vector_Imp<VALUE_TYPE, ALLOCATOR>::reserve(size_type newCapacity)
 {
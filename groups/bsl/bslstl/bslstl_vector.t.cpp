@@ -14,6 +14,7 @@
 #include <bslma_testallocatorexception.h>  // for testing only
 
 #include <bslmf_issame.h>                  // for testing only
+#include <bslmf_istriviallydefaultconstructible.h>
 
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
@@ -35,6 +36,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstddef>
+#include <cstring>
 
 
 using namespace BloombergLP;
@@ -109,6 +111,7 @@ using namespace bsl;
 // [14] void resize(size_type n);
 // [14] void resize(size_type n, const T& val);
 // [14] void reserve(size_type n);
+// [24] void resize_default_init(size_type n);
 // [14] void shrink_to_fit();
 // [ 2] void clear();
 // [15] reference front();
@@ -156,8 +159,9 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [18] USAGE EXAMPLE
+// [25] USAGE EXAMPLE
 // [21] CONCERN: 'std::length_error' is used properly
+// [-2] PERFORMANCE: 'resize_default_init' VS. 'resize'
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(vector<T,A> *object, const char *spec, int vF = 1);
@@ -1315,6 +1319,9 @@ struct TestDriver {
     static void testCaseM1();
         // Performance test.
 
+    static void testCase24();
+        // Test 'resize_default_init'.
+
     static void testCase22();
         // Test overloaded new/delete.
 
@@ -2119,6 +2126,137 @@ void TestDriver<TYPE,ALLOC>::testCaseM1()
     }
 }
 
+template <class TYPE, class ALLOC>
+void TestDriver<TYPE,ALLOC>::testCase24()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'resize_default_init'
+    //
+    // Concerns:
+    //: 1 'resize_default_init(n)' brings the size of the vector to 'n', and
+    //:   the first 'min(n, size())' elements retain their original values.
+    //:
+    //: 2 If 'VALUE_TYPE' is not trivially default-constructible, the
+    //:   appended elements are default-constructed.
+    //:
+    //: 3 The appended elements are usable (i.e., can be assigned to).
+    //:
+    //: 4 No memory is allocated if 'n' does not exceed the capacity of the
+    //:   vector (and 'VALUE_TYPE' does not allocate).
+    //:
+    //: 5 The capacity grows geometrically, so that growing the vector one
+    //:   element at a time allocates a logarithmic number of times (if
+    //:   'VALUE_TYPE' does not allocate).
+    //:
+    //: 6 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For vectors of various initial sizes, call 'resize_default_init'
+    //:   for various new sizes, and verify the size, capacity, value, and
+    //:   allocations of the resulting vector; then assign to the appended
+    //:   elements and verify their values.  (C-1..4)
+    //:
+    //: 2 Grow a vector one element at a time using 'resize_default_init',
+    //:   and verify the number of allocations.  (C-5)
+    //:
+    //: 3 Use a test allocator and verify that no memory is in use at the end
+    //:   of each test.  (C-6)
+    //
+    // Testing:
+    //   void resize_default_init(size_type n);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator  testAllocator(veryVeryVerbose);
+    bslma::Allocator     *Z = &testAllocator;
+
+    const TYPE         *values     = 0;
+    const TYPE *const&  VALUES     = values;
+    const int           NUM_VALUES = getValues(&values);
+
+    const bool IS_TRIVIAL =
+                         bsl::is_trivially_default_constructible<TYPE>::value;
+    const bool TYPE_ALLOC = bslma::UsesBslmaAllocator<TYPE>::value;
+
+    static const size_t DATA[] = {
+        0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    if (verbose) printf("\tTesting 'resize_default_init' (trivial = %d).\n",
+                        IS_TRIVIAL);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const size_t NE = DATA[ti];
+
+        for (int ni = 0; ni < NUM_DATA; ++ni) {
+            const size_t NS = DATA[ni];
+
+            if (veryVerbose) {
+                T_ P_(NE); P(NS);
+            }
+
+            {
+                Obj mX(Z);  const Obj& X = mX;
+
+                for (size_t i = 0; i < NE; ++i) {
+                    mX.push_back(VALUES[i % NUM_VALUES]);
+                }
+
+                const bsls::Types::Int64 NUM_ALLOC_BEFORE =
+                                                testAllocator.numAllocations();
+                const size_t             CAPACITY         = X.capacity();
+
+                mX.resize_default_init(NS);
+
+                LOOP2_ASSERT(NE, NS, NS == X.size());
+                LOOP2_ASSERT(NE, NS, NS <= X.capacity());
+
+                for (size_t i = 0; i < NE && i < NS; ++i) {
+                    LOOP3_ASSERT(NE, NS, i, VALUES[i % NUM_VALUES] == X[i]);
+                }
+
+                if (!IS_TRIVIAL) {
+                    for (size_t i = NE; i < NS; ++i) {
+                        LOOP3_ASSERT(NE, NS, i, TYPE() == X[i]);
+                    }
+                }
+
+                if (NS <= CAPACITY && !TYPE_ALLOC) {
+                    LOOP2_ASSERT(NE, NS, NUM_ALLOC_BEFORE ==
+                                              testAllocator.numAllocations());
+                    LOOP2_ASSERT(NE, NS, CAPACITY == X.capacity());
+                }
+
+                for (size_t i = NE; i < NS; ++i) {
+                    mX[i] = VALUES[i % NUM_VALUES];
+                }
+                for (size_t i = 0; i < NS; ++i) {
+                    LOOP3_ASSERT(NE, NS, i, VALUES[i % NUM_VALUES] == X[i]);
+                }
+            }
+            LOOP2_ASSERT(NE, NS, 0 == testAllocator.numBytesInUse());
+        }
+    }
+
+    if (verbose) printf("\tTesting geometric growth.\n");
+    if (!TYPE_ALLOC) {
+        const size_t NUM_ELEMENTS = 1000;
+
+        Obj mX(Z);  const Obj& X = mX;
+
+        const bsls::Types::Int64 NUM_ALLOC_BEFORE =
+                                                testAllocator.numAllocations();
+
+        for (size_t i = 1; i <= NUM_ELEMENTS; ++i) {
+            mX.resize_default_init(i);
+            mX[i - 1] = VALUES[i % NUM_VALUES];
+        }
+        ASSERT(NUM_ELEMENTS == X.size());
+        ASSERT(testAllocator.numAllocations() - NUM_ALLOC_BEFORE <= 11);
+    }
+    ASSERT(0 == testAllocator.numBytesInUse());
+}
+
 template <class TYPE, class ALLOC>
 void TestDriver<TYPE,ALLOC>::testCase22()
 {
@@ -9202,7 +9340,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 24: {
+      case 25: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9246,6 +9384,49 @@ int main(int argc, char *argv[])
             ASSERT(4 == m1.theValue(1, 1));
         }
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // TESTING 'resize_default_init'
+        //
+        // Testing:
+        //   void resize_default_init(size_type n);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'resize_default_init'"
+                            "\n=============================\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testCase24();
+
+        if (verbose) printf("\n... with 'TestType'.\n");
+        TestDriver<T>::testCase24();
+
+        if (verbose) printf("\n... with 'BitwiseCopyableTestType'.\n");
+        TestDriver<BCT>::testCase24();
+
+        if (verbose) printf("\n... with pointer types.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            int value = 0;
+
+            bsl::vector<int *> mX(&oa);  const bsl::vector<int *>& X = mX;
+            mX.push_back(&value);
+            mX.resize_default_init(100);
+            ASSERT(100    == X.size());
+            ASSERT(&value == X[0]);
+
+            bsl::vector<const int *> mY(&oa);
+            const bsl::vector<const int *>& Y = mY;
+            mY.resize_default_init(100);
+            mY[99] = &value;
+            ASSERT(100    == Y.size());
+            ASSERT(&value == Y[99]);
+
+            mY.resize_default_init(1);
+            ASSERT(1 == Y.size());
+        }
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // RANGE INSERT FUNCTION PTR BUG
@@ -10223,6 +10404,86 @@ int main(int argc, char *argv[])
         TestDriver<BCT>::testCaseM1Range(CharArray<BCT>());
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'resize_default_init' VS. 'resize'
+        //
+        // Concerns:
+        //: 1 Receiving data into a 'vector<char>' buffer is faster using
+        //:   'resize_default_init' than using 'resize', as the buffer is not
+        //:   first filled with zeros.
+        //
+        // Plan:
+        //: 1 For a range of buffer sizes, repeatedly "read" a buffer's worth
+        //:   of data into a reused vector, once using 'resize' followed by
+        //:   'memcpy', and once using 'resize_default_init' followed by
+        //:   'memcpy', and report the throughput of each.
+        //
+        // Testing:
+        //   PERFORMANCE: 'resize_default_init' VS. 'resize'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'resize_default_init' VS. 'resize'"
+                            "\n==============================================="
+                            "\n");
+
+        const size_t TOTAL_BYTES = (argc > 2 && atoi(argv[2]) > 0)
+                                 ? static_cast<size_t>(atoi(argv[2])) << 20
+                                 : size_t(2) << 30;
+
+        const size_t BUFFER_SIZES[] = { 4096, 65536, 1 << 20, 16 << 20 };
+        const int    NUM_BUFFER_SIZES = sizeof  BUFFER_SIZES
+                                      / sizeof *BUFFER_SIZES;
+
+        const size_t MAX_SIZE = BUFFER_SIZES[NUM_BUFFER_SIZES - 1];
+
+        bsl::vector<char> source(MAX_SIZE);
+        for (size_t i = 0; i < MAX_SIZE; ++i) {
+            source[i] = static_cast<char>('a' + i % 26);
+        }
+
+        for (int i = 0; i < NUM_BUFFER_SIZES; ++i) {
+            const size_t SIZE           = BUFFER_SIZES[i];
+            const size_t NUM_ITERATIONS = TOTAL_BYTES / SIZE;
+
+            bsl::vector<char> buffer;
+            bsls::Stopwatch   timer;
+
+            timer.start();
+            for (size_t j = 0; j < NUM_ITERATIONS; ++j) {
+                buffer.clear();
+                buffer.resize(SIZE);
+                memcpy(buffer.data(), source.data(), SIZE);
+            }
+            timer.stop();
+            const double resizeTime = timer.elapsedTime();
+
+            bsl::vector<char>().swap(buffer);
+
+            timer.reset();
+            timer.start();
+            for (size_t j = 0; j < NUM_ITERATIONS; ++j) {
+                buffer.clear();
+                buffer.resize_default_init(SIZE);
+                memcpy(buffer.data(), source.data(), SIZE);
+            }
+            timer.stop();
+            const double defaultInitTime = timer.elapsedTime();
+
+            ASSERT(SIZE == buffer.size());
+            ASSERT(0    == memcmp(buffer.data(), source.data(), SIZE));
+
+            const double megabytes = static_cast<double>(SIZE)
+                                   * static_cast<double>(NUM_ITERATIONS)
+                                   / (1 << 20);
+
+            printf("\tbuffer=%9d  resize=%8.1fMB/s"
+                   "  resize_default_init=%8.1fMB/s\n",
+                   static_cast<int>(SIZE),
+                   megabytes / resizeTime,
+                   megabytes / defaultInitTime);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;